@@ -5,11 +5,44 @@
 #include <sstream>
 #include <stdexcept>
 #include <cassert>
+#include <map>
+#include <mutex>
+#include <limits>
+#include <memory>
+#include <vector>
+#include <complex>
+#include <algorithm>
 #include <btas/generic/gemm_impl.h>
 #include <btas/generic/scal_impl.h>
 
 namespace btas {
 
+// Dense transposition used by contract_ttgt: out(perm) = beta * out(perm) + alpha * in.
+// dims are the extents of "in" with the first index running fastest; the q-th index of "out" is the perm[q]-th index of "in".
+// This is a plain loop; programs with an optimized transposition specialize this class template.
+template<typename T>
+struct contract_transpose {
+  static void call(const T* in, T* out, const int rank, const int* dims, const int* perm, const T alpha = 1.0, const T beta = 0.0) {
+    std::vector<size_t> stride(rank); // stride in "out" of each index of "in"
+    size_t size = 1;
+    for (int q = 0; q != rank; ++q) {
+      stride[perm[q]] = size;
+      size *= dims[perm[q]];
+    }
+    std::vector<int> index(rank, 0);
+    size_t o = 0;
+    for (size_t i = 0; i != size; ++i) {
+      out[o] = beta == static_cast<T>(0.0) ? alpha * in[i] : beta * out[o] + alpha * in[i];
+      for (int p = 0; p != rank; ++p) {
+        o += stride[p];
+        if (++index[p] != dims[p]) break;
+        o -= stride[p] * dims[p];
+        index[p] = 0;
+      }
+    }
+  }
+};
+
 template<typename _T, class _TensorA, class _TensorB, class _TensorC,
          typename _UA, typename _UB, typename _UC
         >
@@ -171,19 +204,290 @@ void contract_332(const _T& alpha, const _TensorA& A, const btas::varray<_UA>& a
       assert(!conjgB);
       for (int i = 0; i != A.extent(2); ++i)
         gemm_impl<true>::call(CblasColMajor, conjgA ? CblasConjTrans : CblasTrans, CblasNoTrans, C.extent(0), C.extent(1), A.extent(0),
-                              alpha, &*A.begin()+i*ablock, A.extent(0), &*B.begin()+i*bblock, B.extent(0), 1.0, &*C.begin(), C.extent(0));
+                              alpha, &*A.begin()+i*ablock, A.extent(0), &*B.begin()+i*bblock, B.extent(0), static_cast<_T>(1.0), &*C.begin(), C.extent(0));
     } else {
       assert(A.extent(0) == B.extent(0) && A.extent(2) == B.extent(2) && B.extent(1) == C.extent(0) && A.extent(1) == C.extent(1));
       assert(!conjgA);
       for (int i = 0; i != A.extent(2); ++i)
         gemm_impl<true>::call(CblasColMajor, conjgB ? CblasConjTrans : CblasTrans, CblasNoTrans, C.extent(0), C.extent(1), A.extent(0),
-                              alpha, &*B.begin()+i*bblock, B.extent(0), &*A.begin()+i*ablock, A.extent(0), 1.0, &*C.begin(), C.extent(0));
+                              alpha, &*B.begin()+i*bblock, B.extent(0), &*A.begin()+i*ablock, A.extent(0), static_cast<_T>(1.0), &*C.begin(), C.extent(0));
     }
   } else
     throw std::logic_error("not yet implemented");
 }
 
 
+// General contraction by transpose-transpose-GEMM-transpose (TTGT).
+// Indices are classified into M (A and C), N (B and C) and K (A and B). A and B are copied into a GEMM layout
+// only when their annotation is not already one ([M,K] or [K,M] for A), and the product is written to a buffer
+// and permuted into C only when C is not [M,N] or [N,M]. When trailing indices of C are also the trailing
+// indices of A (or B), they are looped over instead, which often avoids all the copies.
+// Analyses are cached by annotation and extents. The cache holds at most max_plans entries and is emptied when full;
+// plans in use are kept alive by their callers.
+struct ContractPlan {
+  // GEMM is called as C = op(first) op(second); first is B if swap
+  bool swap;
+  bool transA, transB;
+  // permutations applied to A and B prior to GEMM (in the convention of contract_transpose), and to the product
+  std::vector<int> permA, permB, permC;
+  std::vector<int> dimsC;
+  size_t m, n, k;
+  // loop over the trailing indices shared by C and A (peelA) or B
+  bool peelA;
+  size_t nbatch, strideX, strideC;
+  size_t cost;
+};
+
+
+class ContractPlanCache {
+  protected:
+    std::mutex mutex_;
+    std::map<std::vector<long>, std::shared_ptr<const ContractPlan>> plans_;
+    const size_t max_plans_;
+
+    using Labels = std::vector<long>;
+    static bool has(const Labels& v, const long x) { return std::find(v.begin(), v.end(), x) != v.end(); }
+
+    static std::vector<int> permutation(const Labels& from, const Labels& to) {
+      std::vector<int> out;
+      for (auto& i : to)
+        out.push_back(std::find(from.begin(), from.end(), i) - from.begin());
+      return out;
+    }
+
+    // GEMM layout for a problem without batching
+    static ContractPlan layout(Labels la, Labels lb, const Labels& lc, const std::map<long,size_t>& ext, bool conjA, bool conjB) {
+      ContractPlan out;
+      out.peelA = false;
+      out.nbatch = 1;
+      out.strideX = out.strideC = 0;
+      // GEMM writes C with the indices of its first operand running fastest
+      out.swap = !lc.empty() && !has(la, lc.front());
+      if (out.swap) {
+        std::swap(la, lb);
+        std::swap(conjA, conjB);
+      }
+      auto size = [&ext](const Labels& l) { size_t o = 1; for (auto& i : l) o *= ext.at(i); return o; };
+
+      Labels cm, cn, ka, kb;
+      for (auto& i : lc) (has(la, i) ? cm : cn).push_back(i);
+      for (auto& i : la) if (!has(lc, i)) ka.push_back(i);
+      for (auto& i : lb) if (!has(lc, i)) kb.push_back(i);
+      auto cat = [](const Labels& a, const Labels& b) { Labels o(a); o.insert(o.end(), b.begin(), b.end()); return o; };
+
+      // the order of the contracted indices is taken from either A or B, whichever needs fewer copies
+      out.cost = std::numeric_limits<size_t>::max();
+      for (auto& korder : {ka, kb}) {
+        bool transa, transb;
+        Labels ta, tb;
+        size_t cost = 0;
+        if (la == cat(cm, korder) && !conjA) {
+          transa = false;
+        } else if (la == cat(korder, cm)) {
+          transa = true;
+        } else {
+          // conjugation is applied by GEMM, which requires the transposed layout
+          transa = conjA;
+          ta = transa ? cat(korder, cm) : cat(cm, korder);
+          cost += size(la);
+        }
+        if (lb == cat(korder, cn) && !conjB) {
+          transb = false;
+        } else if (lb == cat(cn, korder)) {
+          transb = true;
+        } else {
+          transb = conjB;
+          tb = transb ? cat(cn, korder) : cat(korder, cn);
+          cost += size(lb);
+        }
+        if (cost < out.cost) {
+          out.cost = cost;
+          out.transA = transa;
+          out.transB = transb;
+          out.permA = ta.empty() ? std::vector<int>() : permutation(la, ta);
+          out.permB = tb.empty() ? std::vector<int>() : permutation(lb, tb);
+          out.k = size(korder);
+        }
+      }
+      const Labels g = cat(cm, cn);
+      if (g != lc) {
+        out.permC = permutation(g, lc);
+        for (auto& i : g) out.dimsC.push_back(ext.at(i));
+        out.cost += 2*size(lc);
+      }
+      out.m = size(cm);
+      out.n = size(cn);
+      // store the permutations with respect to the original A and B
+      if (out.swap) {
+        std::swap(out.transA, out.transB);
+        std::swap(out.permA, out.permB);
+      }
+      return out;
+    }
+
+    static ContractPlan analyze(const Labels& la, const Labels& lb, const Labels& lc, const std::map<long,size_t>& ext, const bool conjA, const bool conjB) {
+      for (auto& i : lc)
+        if (has(la, i) == has(lb, i))
+          throw std::logic_error("ContractPlanCache: Hadamard or unmatched indices are not supported");
+      for (auto& i : la)
+        if (!has(lb, i) && !has(lc, i))
+          throw std::logic_error("ContractPlanCache: an index of A appears nowhere else");
+      for (auto& i : lb)
+        if (!has(la, i) && !has(lc, i))
+          throw std::logic_error("ContractPlanCache: an index of B appears nowhere else");
+
+      ContractPlan best = layout(la, lb, lc, ext, conjA, conjB);
+      // try looping over trailing indices that C shares with A or B
+      for (const bool peela : {true, false}) {
+        const Labels& lx = peela ? la : lb;
+        size_t nbatch = 1;
+        for (int p = 1; p <= std::min(lx.size(), lc.size()) && best.cost > 0; ++p) {
+          if (lx[lx.size()-p] != lc[lc.size()-p]) break;
+          nbatch *= ext.at(lc[lc.size()-p]);
+          const Labels rx(lx.begin(), lx.end()-p);
+          const Labels rc(lc.begin(), lc.end()-p);
+          ContractPlan cand = peela ? layout(rx, lb, rc, ext, conjA, conjB) : layout(la, rx, rc, ext, conjA, conjB);
+          if (!cand.permC.empty() || !(peela ? cand.permA : cand.permB).empty() || cand.cost >= best.cost) continue;
+          cand.peelA = peela;
+          cand.nbatch = nbatch;
+          cand.strideC = cand.m * cand.n;
+          cand.strideX = 1;
+          for (auto& i : rx) cand.strideX *= ext.at(i);
+          best = cand;
+        }
+      }
+      return best;
+    }
+
+  public:
+    ContractPlanCache(const size_t max_plans = 4096) : max_plans_(max_plans) { }
+
+    static ContractPlanCache& global() {
+      static ContractPlanCache cache;
+      return cache;
+    }
+
+    template<typename _UA, typename _UB, typename _UC>
+    std::shared_ptr<const ContractPlan> get(const std::vector<_UA>& aA, const std::vector<size_t>& eA, const std::vector<_UB>& aB, const std::vector<size_t>& eB,
+                                            const std::vector<_UC>& aC, const std::vector<size_t>& eC, const bool conjA, const bool conjB) {
+      Labels key{static_cast<long>(aA.size()), static_cast<long>(aB.size()), static_cast<long>(aC.size()), conjA, conjB};
+      for (auto& i : aA) key.push_back(static_cast<long>(i));
+      for (auto& i : aB) key.push_back(static_cast<long>(i));
+      for (auto& i : aC) key.push_back(static_cast<long>(i));
+      key.insert(key.end(), eA.begin(), eA.end());
+      key.insert(key.end(), eB.begin(), eB.end());
+      key.insert(key.end(), eC.begin(), eC.end());
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = plans_.find(key);
+        if (iter != plans_.end())
+          return iter->second;
+      }
+
+      const Labels la(aA.begin(), aA.end()), lb(aB.begin(), aB.end()), lc(aC.begin(), aC.end());
+      std::map<long,size_t> ext;
+      auto setext = [&ext](const Labels& l, const std::vector<size_t>& e) {
+        for (int i = 0; i != l.size(); ++i) {
+          auto iter = ext.find(l[i]);
+          if (iter != ext.end() && iter->second != e[i])
+            throw std::logic_error("ContractPlanCache: inconsistent extents");
+          ext[l[i]] = e[i];
+        }
+      };
+      setext(la, eA);
+      setext(lb, eB);
+      setext(lc, eC);
+      auto plan = std::make_shared<const ContractPlan>(analyze(la, lb, lc, ext, conjA, conjB));
+
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (plans_.size() >= max_plans_)
+        plans_.clear();
+      plans_.emplace(key, plan);
+      return plan;
+    }
+
+    void clear() {
+      std::lock_guard<std::mutex> lock(mutex_);
+      plans_.clear();
+    }
+
+    size_t size() {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return plans_.size();
+    }
+};
+
+
+
+template<typename _T, class _TensorA, class _TensorB, class _TensorC,
+         typename _UA, typename _UB, typename _UC
+        >
+void contract_ttgt(const _T& alpha, const _TensorA& A, const btas::varray<_UA>& aA, const _TensorB& B, const btas::varray<_UB>& aB,
+                   const _T& beta, _TensorC& C, const btas::varray<_UC>& aC, const bool conjgA, const bool conjgB) {
+  assert(A.range().ordinal().contiguous() && B.range().ordinal().contiguous() && C.range().ordinal().contiguous());
+  using value_type = typename std::remove_cv<typename _TensorC::value_type>::type;
+  constexpr const bool cmplx = std::is_same<value_type, std::complex<double>>::value;
+
+  std::vector<size_t> eA, eB, eC;
+  for (int i = 0; i != A.rank(); ++i) eA.push_back(A.extent(i));
+  for (int i = 0; i != B.rank(); ++i) eB.push_back(B.extent(i));
+  for (int i = 0; i != C.rank(); ++i) eC.push_back(C.extent(i));
+  std::shared_ptr<const ContractPlan> plan
+    = ContractPlanCache::global().get(std::vector<_UA>(aA.begin(), aA.end()), eA, std::vector<_UB>(aB.begin(), aB.end()), eB,
+                                      std::vector<_UC>(aC.begin(), aC.end()), eC, cmplx && conjgA, cmplx && conjgB);
+
+  const value_type* a = &*A.begin();
+  const value_type* b = &*B.begin();
+  value_type* c = &*C.begin();
+
+  // copies of A and B in the GEMM layout
+  std::unique_ptr<value_type[]> abuf, bbuf;
+  if (!plan->permA.empty()) {
+    abuf = std::unique_ptr<value_type[]>(new value_type[A.size()]);
+    std::vector<int> dims(eA.begin(), eA.end());
+    contract_transpose<value_type>::call(a, abuf.get(), dims.size(), dims.data(), plan->permA.data());
+    a = abuf.get();
+  }
+  if (!plan->permB.empty()) {
+    bbuf = std::unique_ptr<value_type[]>(new value_type[B.size()]);
+    std::vector<int> dims(eB.begin(), eB.end());
+    contract_transpose<value_type>::call(b, bbuf.get(), dims.size(), dims.data(), plan->permB.data());
+    b = bbuf.get();
+  }
+
+  // the product is formed in a buffer when C is not in the GEMM layout
+  std::unique_ptr<value_type[]> cbuf;
+  value_type* cgemm = c;
+  value_type cbeta = beta;
+  if (!plan->permC.empty()) {
+    cbuf = std::unique_ptr<value_type[]>(new value_type[C.size()]);
+    cgemm = cbuf.get();
+    cbeta = 0.0;
+  }
+
+  const bool conjA = cmplx && conjgA;
+  const bool conjB = cmplx && conjgB;
+  const value_type valpha = alpha;
+  const auto opA = plan->transA ? (conjA ? CblasConjTrans : CblasTrans) : CblasNoTrans;
+  const auto opB = plan->transB ? (conjB ? CblasConjTrans : CblasTrans) : CblasNoTrans;
+  const auto& m = plan->m;
+  const auto& n = plan->n;
+  const auto& k = plan->k;
+  for (size_t ib = 0; ib != plan->nbatch; ++ib) {
+    const value_type* ab = plan->peelA ? a + ib*plan->strideX : a;
+    const value_type* bb = plan->peelA ? b : b + ib*plan->strideX;
+    value_type* cb = cgemm + ib*plan->strideC;
+    if (!plan->swap)
+      gemm_impl<true>::call(CblasColMajor, opA, opB, m, n, k, valpha, ab, plan->transA ? k : m, bb, plan->transB ? n : k, cbeta, cb, m);
+    else
+      gemm_impl<true>::call(CblasColMajor, opB, opA, m, n, k, valpha, bb, plan->transB ? k : m, ab, plan->transA ? n : k, cbeta, cb, m);
+  }
+
+  if (!plan->permC.empty())
+    contract_transpose<value_type>::call(cbuf.get(), c, plan->dimsC.size(), plan->dimsC.data(), plan->permC.data(), value_type(1.0), value_type(beta));
+}
+
+
 template<
   typename _T,
   class _TensorA, class _TensorB, class _TensorC,
@@ -214,21 +518,41 @@ void contract(
   assert(B.rank() == aB.size());
   assert(C.rank() == aC.size());
 
+  // the hand-written cases below handle their (unconjugated) annotations without copies; anything else goes through TTGT
+  const btas::varray<_UA> vA(aA);
+  const btas::varray<_UB> vB(aB);
+  const btas::varray<_UC> vC(aC);
+  auto single_rotation = [](const btas::varray<_UA>& a, const btas::varray<_UC>& c) {
+    // contract_323 replaces one index of A in place
+    int n = 0;
+    for (int i = 0; i != a.size(); ++i)
+      n += a[i] != c[i];
+    return n == 1;
+  };
+  auto gemm_layout = [&]() {
+    // contract_222 applies conjugation only through ConjTrans
+    const bool front = std::find(vA.begin(), vA.end(), vC.front()) != vA.end();
+    const btas::varray<_UC> x = front ? btas::varray<_UC>(aA) : btas::varray<_UC>(aB);
+    const btas::varray<_UC> y = front ? btas::varray<_UC>(aB) : btas::varray<_UC>(aA);
+    const bool conjx = front ? conjgA : conjgB;
+    const bool conjy = front ? conjgB : conjgA;
+    return !(x.front() == vC.front() && conjx) && !(y.front() != vC.back() && conjy);
+  };
+
   if (A.rank() == 2 && B.rank() == 1 && C.rank() == 1) {
-    contract_211(alpha, A, btas::varray<_UA>(aA), B, btas::varray<_UB>(aB), beta, C, btas::varray<_UC>(aC), conjgA, conjgB);
+    contract_211(alpha, A, vA, B, vB, beta, C, vC, conjgA, conjgB);
   } else if (A.rank() == 1 && B.rank() == 2 && C.rank() == 1) {
-    contract_211(alpha, B, btas::varray<_UA>(aB), A, btas::varray<_UB>(aA), beta, C, btas::varray<_UC>(aC), conjgB, conjgA);
-  } else if (A.rank() == 2 && B.rank() == 2 && C.rank() == 2) {
-    contract_222(alpha, A, btas::varray<_UA>(aA), B, btas::varray<_UB>(aB), beta, C, btas::varray<_UC>(aC), conjgA, conjgB);
-  } else if (A.rank() == 3 && B.rank() == 2 && C.rank() == 3) {
-    contract_323(alpha, A, btas::varray<_UA>(aA), B, btas::varray<_UB>(aB), beta, C, btas::varray<_UC>(aC), conjgA, conjgB);
-  } else if (A.rank() == 2 && B.rank() == 3 && C.rank() == 3) {
-    contract_323(alpha, B, btas::varray<_UA>(aB), A, btas::varray<_UB>(aA), beta, C, btas::varray<_UC>(aC), conjgB, conjgA);
-  } else if (A.rank() == 3 && B.rank() == 3 && C.rank() == 2) {
-    contract_332(alpha, A, btas::varray<_UA>(aA), B, btas::varray<_UB>(aB), beta, C, btas::varray<_UC>(aC), conjgA, conjgB);
+    contract_211(alpha, B, btas::varray<_UA>(aB), A, btas::varray<_UB>(aA), beta, C, vC, conjgB, conjgA);
+  } else if (A.rank() == 2 && B.rank() == 2 && C.rank() == 2 && gemm_layout()) {
+    contract_222(alpha, A, vA, B, vB, beta, C, vC, conjgA, conjgB);
+  } else if (A.rank() == 3 && B.rank() == 2 && C.rank() == 3 && !conjgA && !conjgB && single_rotation(vA, vC)) {
+    contract_323(alpha, A, vA, B, vB, beta, C, vC, conjgA, conjgB);
+  } else if (A.rank() == 2 && B.rank() == 3 && C.rank() == 3 && !conjgA && !conjgB && single_rotation(btas::varray<_UA>(aB), vC)) {
+    contract_323(alpha, B, btas::varray<_UA>(aB), A, btas::varray<_UB>(aA), beta, C, vC, conjgB, conjgA);
+  } else if (A.rank() == 3 && B.rank() == 3 && C.rank() == 2 && !conjgA && !conjgB && ((vA[0] == vB[0]) + (vA[1] == vB[1]) + (vA[2] == vB[2]) == 2)) {
+    contract_332(alpha, A, vA, B, vB, beta, C, vC, conjgA, conjgB);
   } else {
-    std::stringstream ss; ss << "not yet implemented: rank(A): " << A.rank() << " rank(B): " << B.rank() << " rank(C): " << C.rank();
-    throw std::logic_error(ss.str());
+    contract_ttgt(alpha, A, vA, B, vB, beta, C, vC, conjgA, conjgB);
   }
 }
 
@@ -184,7 +184,9 @@ shared_ptr<Matrix> ASD_base::compute_offdiagonal_1e<true>(const array<MonomerKey
 
   auto gamma_A = gammatensor_[0]->get_block_as_matview(A, Ap, {operatorA});
   auto gamma_B = gammatensor_[1]->get_block_as_matview(B, Bp, {operatorB});
-  Matrix tmp = gamma_A * (*hAB) ^ gamma_B;
+  Matrix h(*hAB);
+  h.localize();
+  Matrix tmp = gamma_A * h ^ gamma_B;
 
   if ((neleA % 2) == 1) {
     // sort: (A,A',B,B') --> -1.0 * (A,B,A',B')
@@ -89,6 +89,10 @@ class ASD_base {
     std::vector<std::vector<ModelBlock>> models_to_form_; ///< Contains specifications to construct model spaces
     std::vector<std::pair<std::shared_ptr<Matrix>, std::shared_ptr<Matrix>>> models_; ///< models that have been built
 
+    /// Coupled pairs of subspaces (i,j) with j <= i assigned to this process, most expensive first
+    std::vector<std::pair<int,int>> distribute_blocks(const std::vector<DimerSubspace_base>& subspaces, const bool offdiagonal) const;
+    /// Computes the diagonal blocks (and the off-diagonal blocks if store_matrix_) in parallel and sets up denom_ and hamiltonian_
+    void compute_hamiltonian(const std::vector<DimerSubspace_base>& subspaces);
     std::shared_ptr<Matrix> apply_hamiltonian(const Matrix& o, const std::vector<DimerSubspace_base>& subspaces);
     std::vector<double> diagonalize(std::shared_ptr<Matrix>& cc, const std::vector<DimerSubspace_base>& subspace, const bool mute = false);
 
@@ -54,43 +54,29 @@ void ASD<VecType>::compute() {
   std::cout << "  o Preparing Gamma trees and building spin operator - " << std::setw(9) << std::fixed << std::setprecision(2) << asdtime.tick() << std::endl;
   std::cout << "    - spin elements: " << spin_->size() << std::endl;
 
+  {
+    size_t nbranch, nbranch_all, ngamma, nused;
+    std::tie(nbranch, nbranch_all, ngamma, nused) = gammaforest->statistics();
+    std::cout << "    - gamma branches: " << nbranch << " (" << nbranch_all << " if all were created)" << std::endl;
+    std::cout << "    - gammas requested: " << ngamma << " (" << std::setprecision(2) << nused*sizeof(double)*1.0e-6 << " MB)" << std::endl;
+  }
+
   gammaforest->compute();
   gammatensor_ = { std::make_shared<GammaTensor>(asd::Wrap<GammaForest<VecType,2>,0>(gammaforest), subspaces_),
                    std::make_shared<GammaTensor>(asd::Wrap<GammaForest<VecType,2>,1>(gammaforest), subspaces_) };
 
   std::cout << "  o Computing Gamma trees - " << std::setw(9) << std::fixed << std::setprecision(2) << asdtime.tick() << std::endl;
 
-  if (store_matrix_) hamiltonian_ = std::make_shared<Matrix>(dimerstates_, dimerstates_);
-
-  denom_ = std::unique_ptr<double[]>(new double[dimerstates_]);
-
-  for (auto& subspace : subspaces_) {
+  // the monomer sigma vectors may be distributed, so these are computed by all the processes together
+  for (auto& subspace : subspaces_)
     compute_pure_terms(subspace, jop_);
-    std::shared_ptr<Matrix> block = compute_diagonal_block<true>(subspace);
-    if (store_matrix_)
-      hamiltonian_->add_block(1.0, subspace.offset(), subspace.offset(), block->ndim(), block->mdim(), block);
-    const int n = block->ndim();
-    for ( int i = 0; i < n; ++i ) denom_[subspace.offset() + i] = block->element(i,i);
-  }
-  std::cout << "  o Computing diagonal blocks and building denominator - time " << std::setw(9) << std::fixed << std::setprecision(2) << asdtime.tick() << std::endl;
+  std::cout << "  o Computing monomer Hamiltonians - time " << std::setw(9) << std::fixed << std::setprecision(2) << asdtime.tick() << std::endl;
 
-  if (store_matrix_) {
-    for (auto iAB = subspaces_.begin(); iAB != subspaces_.end(); ++iAB) {
-      const int ioff = iAB->offset();
-      for (auto jAB = subspaces_.begin(); jAB != iAB; ++jAB) {
-        const int joff = jAB->offset();
-
-// TODO remove this comment once the gammaforst issue has been fixed (bra and ket have been exchanged)
-        std::shared_ptr<Matrix> block = couple_blocks<true>(*jAB, *iAB);
-
-        if (block) {
-          hamiltonian_->add_block(1.0, joff, ioff, block->ndim(), block->mdim(), block);
-          hamiltonian_->add_block(1.0, ioff, joff, block->mdim(), block->ndim(), block->transpose());
-        }
-      }
-    }
-    std::cout << "  o Computing off-diagonal blocks - time " << std::setw(9) << std::fixed << std::setprecision(2) << asdtime.tick() << std::endl;
-  }
+  compute_hamiltonian(subspaces_base());
+  if (store_matrix_)
+    std::cout << "  o Computing diagonal and off-diagonal blocks - time " << std::setw(9) << std::fixed << std::setprecision(2) << asdtime.tick() << std::endl;
+  else
+    std::cout << "  o Computing diagonal blocks and building denominator - time " << std::setw(9) << std::fixed << std::setprecision(2) << asdtime.tick() << std::endl;
 
   std::cout << "  o Diagonalizing ME Hamiltonian with a Davidson procedure" << std::endl;
   auto cc = std::make_shared<Matrix>(dimerstates_, nstates_);
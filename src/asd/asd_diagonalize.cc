@@ -92,40 +92,141 @@ void ASD_base::generate_initial_guess(shared_ptr<Matrix> cc, const vector<DimerS
 }
 
 
+vector<pair<int,int>> ASD_base::distribute_blocks(const vector<DimerSubspace_base>& subspaces, const bool offdiagonal) const {
+  const double nactA = dimer_->active_refs().first->nact();
+  const double nactB = dimer_->active_refs().second->nact();
+
+  // the cost of a block is estimated by its size times the orbital dimension of its most expensive gamma contraction
+  vector<pair<int,int>> blocks;
+  vector<double> cost;
+  for (int i = 0; i != subspaces.size(); ++i) {
+    for (int j = 0; j <= i; ++j) {
+      if (i != j && (!offdiagonal || coupling_type(subspaces[j], subspaces[i]) == Coupling::none)) continue;
+      const int type = abs(static_cast<int>(i == j ? Coupling::diagonal : coupling_type(subspaces[j], subspaces[i])));
+      const bool single_transfer = type == static_cast<int>(Coupling::aET) || type == static_cast<int>(Coupling::bET);
+      const double norb = single_transfer ? nactA*nactB*(nactA*nactA + nactB*nactB) : nactA*nactA*nactB*nactB;
+      blocks.emplace_back(i, j);
+      cost.push_back(static_cast<double>(subspaces[i].dimerstates()) * subspaces[j].dimerstates() * norb);
+    }
+  }
+
+  // most expensive block first, each to the least-loaded process. Every process arrives at the same assignment.
+  vector<int> order(blocks.size());
+  iota(order.begin(), order.end(), 0);
+  stable_sort(order.begin(), order.end(), [&cost](const int a, const int b) { return cost[a] > cost[b]; });
+
+  vector<pair<int,int>> out;
+  vector<double> load(mpi__->size(), 0.0);
+  for (auto& i : order) {
+    const int owner = min_element(load.begin(), load.end()) - load.begin();
+    load[owner] += cost[i];
+    if (owner == mpi__->rank())
+      out.push_back(blocks[i]);
+  }
+  return out;
+}
+
+
+void ASD_base::compute_hamiltonian(const vector<DimerSubspace_base>& subspaces) {
+  if (store_matrix_) hamiltonian_ = make_shared<Matrix>(dimerstates_, dimerstates_);
+
+  denom_ = unique_ptr<double[]>(new double[dimerstates_]);
+  fill_n(denom_.get(), dimerstates_, 0.0);
+
+  // every task writes to its own blocks of hamiltonian_ and denom_, so no locking is needed
+  const vector<pair<int,int>> blocks = distribute_blocks(subspaces, store_matrix_);
+  TaskQueue<function<void(void)>> tasks(blocks.size());
+  for (auto& b : blocks) {
+    const DimerSubspace_base& iAB = subspaces[b.first];
+    const DimerSubspace_base& jAB = subspaces[b.second];
+    if (b.first == b.second) {
+      tasks.emplace_back(
+        [this, &iAB] () {
+          shared_ptr<Matrix> block = compute_diagonal_block<true>(iAB);
+          if (store_matrix_)
+            hamiltonian_->add_block(1.0, iAB.offset(), iAB.offset(), block->ndim(), block->mdim(), block);
+          for (int i = 0; i != block->ndim(); ++i)
+            denom_[iAB.offset() + i] = block->element(i,i);
+        }
+      );
+    } else {
+      tasks.emplace_back(
+        [this, &iAB, &jAB] () {
+// TODO remove this comment once the gammaforst issue has been fixed (bra and ket have been exchanged)
+          shared_ptr<Matrix> block = couple_blocks<true>(jAB, iAB);
+          if (block) {
+            hamiltonian_->add_block(1.0, jAB.offset(), iAB.offset(), block->ndim(), block->mdim(), block);
+            hamiltonian_->add_block(1.0, iAB.offset(), jAB.offset(), block->mdim(), block->ndim(), block->transpose());
+          }
+        }
+      );
+    }
+  }
+  tasks.compute();
+
+  if (store_matrix_)
+    hamiltonian_->allreduce();
+  mpi__->allreduce(denom_.get(), dimerstates_);
+}
+
+
 shared_ptr<Matrix> ASD_base::apply_hamiltonian(const Matrix& o, const vector<DimerSubspace_base>& subspaces) {
   const int nstates = o.mdim();
 
   shared_ptr<Matrix> out = o.clone();
-  for (auto iAB = subspaces.begin(); iAB != subspaces.end(); ++iAB) {
-    const int ioff = iAB->offset();
-    for (auto jAB = subspaces.begin(); jAB != iAB; ++jAB) {
-      const int joff = jAB->offset();
-
-      if (store_matrix_) {
+  if (store_matrix_) {
+    for (auto iAB = subspaces.begin(); iAB != subspaces.end(); ++iAB) {
+      const int ioff = iAB->offset();
+      for (auto jAB = subspaces.begin(); jAB != iAB; ++jAB) {
+        const int joff = jAB->offset();
         dgemm_("N", "N", iAB->dimerstates(), nstates, jAB->dimerstates(), 1.0, hamiltonian_->element_ptr(ioff, joff), hamiltonian_->ndim(),
                                                                                o.element_ptr(joff, 0), o.ndim(),
                                                                           1.0, out->element_ptr(ioff, 0), out->ndim());
         dgemm_("T", "N", jAB->dimerstates(), nstates, iAB->dimerstates(), 1.0, hamiltonian_->element_ptr(ioff, joff), hamiltonian_->ndim(),
                                                                                o.element_ptr(ioff, 0), o.ndim(),
                                                                           1.0, out->element_ptr(joff, 0), out->ndim());
-      } else {
-        shared_ptr<const Matrix> block = couple_blocks<true>(*jAB, *iAB);
-
-        if (block) {
-          dgemm_("N", "N", block->ndim(), nstates, block->mdim(), 1.0, block->data(), block->ndim(), o.element_ptr(ioff, 0), dimerstates_, 1.0, out->element_ptr(joff, 0), o.ndim());
-          dgemm_("T", "N", block->mdim(), nstates, block->ndim(), 1.0, block->data(), block->ndim(), o.element_ptr(joff, 0), dimerstates_, 1.0, out->element_ptr(ioff, 0), o.ndim());
-        }
       }
-    }
-
-    if (store_matrix_) {
       dgemm_("N", "N", iAB->dimerstates(), nstates, iAB->dimerstates(), 1.0, hamiltonian_->element_ptr(ioff, ioff), hamiltonian_->ndim(),
                                                                              o.element_ptr(ioff, 0), o.ndim(),
                                                                         1.0, out->element_ptr(ioff, 0), out->ndim());
-    } else {
-      shared_ptr<const Matrix> block = compute_diagonal_block<true>(*iAB);
-      dgemm_("N", "N", block->ndim(), nstates, block->mdim(), 1.0, block->data(), block->ndim(), o.element_ptr(ioff, 0), dimerstates_, 1.0, out->element_ptr(ioff, 0), out->ndim());
     }
+  } else {
+    // blocks are recomputed, distributed as in compute_hamiltonian; contributions to the rows of a subspace are added under its lock
+    vector<mutex> mutexes(subspaces.size());
+    const vector<pair<int,int>> blocks = distribute_blocks(subspaces, true);
+    TaskQueue<function<void(void)>> tasks(blocks.size());
+    for (auto& b : blocks) {
+      tasks.emplace_back(
+        [this, &o, &out, &subspaces, &mutexes, &nstates, b] () {
+          const DimerSubspace_base& iAB = subspaces[b.first];
+          const DimerSubspace_base& jAB = subspaces[b.second];
+          const int ioff = iAB.offset();
+          const int joff = jAB.offset();
+          if (b.first == b.second) {
+            shared_ptr<const Matrix> block = compute_diagonal_block<true>(iAB);
+            Matrix sigma(block->ndim(), nstates, /*localized*/true);
+            dgemm_("N", "N", block->ndim(), nstates, block->mdim(), 1.0, block->data(), block->ndim(), o.element_ptr(ioff, 0), o.ndim(), 0.0, sigma.data(), sigma.ndim());
+            lock_guard<mutex> lock(mutexes[b.first]);
+            out->add_block(1.0, ioff, 0, sigma.ndim(), nstates, sigma.data());
+          } else {
+            shared_ptr<const Matrix> block = couple_blocks<true>(jAB, iAB);
+            if (!block) return;
+            Matrix sigmaj(block->ndim(), nstates, /*localized*/true);
+            Matrix sigmai(block->mdim(), nstates, /*localized*/true);
+            dgemm_("N", "N", block->ndim(), nstates, block->mdim(), 1.0, block->data(), block->ndim(), o.element_ptr(ioff, 0), o.ndim(), 0.0, sigmaj.data(), sigmaj.ndim());
+            dgemm_("T", "N", block->mdim(), nstates, block->ndim(), 1.0, block->data(), block->ndim(), o.element_ptr(joff, 0), o.ndim(), 0.0, sigmai.data(), sigmai.ndim());
+            {
+              lock_guard<mutex> lock(mutexes[b.second]);
+              out->add_block(1.0, joff, 0, sigmaj.ndim(), nstates, sigmaj.data());
+            }
+            lock_guard<mutex> lock(mutexes[b.first]);
+            out->add_block(1.0, ioff, 0, sigmai.ndim(), nstates, sigmai.data());
+          }
+        }
+      );
+    }
+    tasks.compute();
+    out->allreduce();
   }
 
   return out;
@@ -28,6 +28,7 @@
 #ifndef __BAGEL_DIMER_JOP_H
 #define __BAGEL_DIMER_JOP_H
 
+#include <mutex>
 #include <src/ci/fci/mofile.h>
 
 namespace bagel {
@@ -38,6 +39,8 @@ class DimerJop : public Jop {
 
     // Array is big enough to store all possible coulomb matrices just for simplicity
     std::array<std::shared_ptr<const Matrix>, 16> matrices_;
+    // coulomb matrices are formed on demand from concurrently computed Hamiltonian blocks
+    std::mutex matrices_mutex_;
     std::shared_ptr<const Matrix> cross_mo1e_;
 
     std::pair<int, int> nact_;
@@ -82,6 +85,7 @@ template<int A, int B, int C, int D>
 std::shared_ptr<const Matrix> DimerJop::coulomb_matrix() {
   // First check to see if it's already stored
   const int cindex = A + 2*B + 4*C + 8*D;
+  std::lock_guard<std::mutex> lock(matrices_mutex_);
   if (matrices_[cindex]) {
     return matrices_[cindex];
   }
@@ -97,7 +101,7 @@ std::shared_ptr<const Matrix> DimerJop::coulomb_matrix() {
     int unitB = A + B + C + D;
     for ( int i = 0; i < unitB; ++i ) ijB *= nactB;
 
-    auto out = std::make_shared<Matrix>(ijA, ijB);
+    auto out = std::make_shared<Matrix>(ijA, ijB, /*localized*/true);
 
     for(int d = 0; d < nact<D>(); ++d) {
       for(int c = 0; c < nact<C>(); ++c) {
@@ -29,6 +29,7 @@
 #include <src/asd/dmrg/form_sigma.h>
 #include <src/ci/ras/form_sigma.h>
 #include <src/ci/ras/apply_operator.h>
+#include <src/util/taskqueue.h>
 
 using namespace std;
 using namespace bagel;
@@ -94,8 +95,6 @@ vector<shared_ptr<ProductRASCivec>> FormSigmaProdRAS::diagonal(const vector<shar
 }
 
 void FormSigmaProdRAS::pure_block_and_ras(shared_ptr<const ProductRASCivec> cc, shared_ptr<ProductRASCivec> sigma, shared_ptr<const BlockOperators> blockops, shared_ptr<DimerJop> jop) const {
-  Timer ptime(2);
-
   const int norb = cc->space()->norb();
 
   // first, prepare g and mo2e arrays
@@ -137,45 +136,90 @@ void FormSigmaProdRAS::pure_block_and_ras(shared_ptr<const ProductRASCivec> cc,
   // convenient access to space object
   shared_ptr<RASSpace> space = sigma->space();
 
+  // every sector only writes to itself, so the sectors are processed concurrently without locks
+  // (the timings are printed per task; print_mutex only keeps the lines intact)
+  mutex print_mutex;
+  TaskQueue<function<void(void)>> tasks(sigma->sectors().size());
   for (auto& sector : sigma->sectors()) {
-    // first prepare pure block part which will be a nsecstates x nsecstates matrix
-    const Matrix pure_block = *blockops->ham(sector.first);
-
     shared_ptr<RASBlockVectors> sigma_sector = sector.second;
     shared_ptr<const RASBlockVectors> cc_sector = cc->sector(sector.first);
-    // TODO: would this benefit from being blocksparse?
-    if (mpi__->rank() == 0) {
-      dgemm_("N","T", sigma_sector->ndim(), sigma_sector->mdim(), sigma_sector->mdim(), 1.0, cc_sector->data(), cc_sector->ndim(), pure_block.data(), pure_block.ndim(),
-                                                                                        0.0, sigma_sector->data(), sigma_sector->ndim());
-    }
-    ptime.tick_print("pure_block");
-
-    // now do individual form_sigmas for the RAS parts
-    shared_ptr<const MOFile> monomerjop = jop->monomer_jop<0>();
-    resolve_H_aa(*cc_sector, *sigma_sector, g.data(), mo2e->data());
-
     shared_ptr<const RASDeterminants> trans_det = space->det(cc_sector->det()->neleb(), cc_sector->det()->nelea());
-    resolve_H_bb(*cc_sector, *sigma_sector, trans_det, g.data(), mo2e->data());
-    resolve_H_ab(*cc_sector, *sigma_sector, *sparse_map.at(cc_sector->det()->stringspaceb()->key()), mo2e->data());
-    ptime.tick_print("pure_ras");
+    shared_ptr<const Sparse_IJ> sparseij = sparse_map.at(cc_sector->det()->stringspaceb()->key());
+    const BlockKey key = sector.first;
+
+    tasks.emplace_back(
+      [this, key, sigma_sector, cc_sector, trans_det, sparseij, &blockops, &g, &mo2e, &print_mutex] () {
+        Timer ptime(2);
+        // first prepare pure block part which will be a nsecstates x nsecstates matrix
+        // TODO: would this benefit from being blocksparse?
+        if (mpi__->rank() == 0) {
+          const Matrix pure_block = *blockops->ham(key);
+          dgemm_("N","T", sigma_sector->ndim(), sigma_sector->mdim(), sigma_sector->mdim(), 1.0, cc_sector->data(), cc_sector->ndim(), pure_block.data(), pure_block.ndim(),
+                                                                                            0.0, sigma_sector->data(), sigma_sector->ndim());
+        }
+        {
+          lock_guard<mutex> lock(print_mutex);
+          ptime.tick_print("pure_block");
+        }
+
+        // now do individual form_sigmas for the RAS parts
+        resolve_H_aa(*cc_sector, *sigma_sector, g.data(), mo2e->data());
+        resolve_H_bb(*cc_sector, *sigma_sector, trans_det, g.data(), mo2e->data());
+        resolve_H_ab(*cc_sector, *sigma_sector, *sparseij, mo2e->data());
+        lock_guard<mutex> lock(print_mutex);
+        ptime.tick_print("pure_ras");
+      }
+    );
   }
+  tasks.compute();
 }
 
 
 void FormSigmaProdRAS::diagonal_terms(shared_ptr<const ProductRASCivec> cc, shared_ptr<ProductRASCivec> sigma, shared_ptr<const BlockOperators> blockops, shared_ptr<DimerJop> jop) const {
-  Timer ptime(2);
+  map<BlockKey, mutex> locks;
+  for (auto& isec : sigma->sectors())
+    locks[isec.first];
 
+  mutex print_mutex;
+  TaskQueue<function<void(void)>> tasks(cc->sectors().size());
   for (auto& isec : cc->sectors()) {
     shared_ptr<const RASBlockVectors> cc_sector = isec.second;
-
-    aexc_branch(cc_sector, sigma, blockops);
-    bexc_branch(cc_sector, sigma, blockops);
+    tasks.emplace_back(
+      [this, cc_sector, sigma, blockops, &locks, &print_mutex] () {
+        Timer ptime(2);
+        SigmaAccumulator acc(sigma, locks);
+        aexc_branch(cc_sector, acc, blockops);
+        bexc_branch(cc_sector, acc, blockops);
+        acc.flush();
+        lock_guard<mutex> lock(print_mutex);
+        ptime.tick_print("exc-branches");
+      }
+    );
   }
+  tasks.compute();
 }
 
 
 void FormSigmaProdRAS::interaction_terms(shared_ptr<const ProductRASCivec> cc, shared_ptr<ProductRASCivec> sigma, shared_ptr<const BlockOperators> blockops, shared_ptr<DimerJop> jop) const {
-  Timer ptime(2);
+  // every (sector, branch) pair is a task. Tasks accumulate into private buffers that are added to sigma under per-sector locks
+  map<BlockKey, mutex> locks;
+  for (auto& isec : sigma->sectors())
+    locks[isec.first];
+
+  mutex print_mutex;
+  TaskQueue<function<void(void)>> tasks;
+  auto add_task = [&tasks, &sigma, &locks, &print_mutex] (const string label, function<void(SigmaAccumulator&)> branch) {
+    tasks.emplace_back(
+      [label, branch, sigma, &locks, &print_mutex] () {
+        Timer ptime(2);
+        SigmaAccumulator acc(sigma, locks);
+        branch(acc);
+        acc.flush();
+        lock_guard<mutex> lock(print_mutex);
+        ptime.tick_print(label);
+      }
+    );
+  };
 
   for (auto& isec : cc->sectors()) {
     shared_ptr<const RASBlockVectors> cc_sector = isec.second;
@@ -195,64 +239,44 @@ void FormSigmaProdRAS::interaction_terms(shared_ptr<const ProductRASCivec> cc, s
     const bool do_flipup = cc->contains_block(BlockKey(cc_key.nelea-1, cc_key.neleb+1));
     const bool do_flipdn = cc->contains_block(BlockKey(cc_key.nelea+1, cc_key.neleb-1));
 
-    if (do_aET || do_aaET) {
-      aET_branch(cc_sector, sigma, blockops);
-      ptime.tick_print("aET-branch");
-    }
+    if (do_aET || do_aaET)
+      add_task("aET-branch", [this, cc_sector, blockops] (SigmaAccumulator& acc) { aET_branch(cc_sector, acc, blockops); });
 
-    if (do_bET || do_bbET || do_abET) {
-      bET_branch(cc_sector, sigma, blockops);
-      ptime.tick_print("bET-branch");
-    }
+    if (do_bET || do_bbET || do_abET)
+      add_task("bET-branch", [this, cc_sector, blockops] (SigmaAccumulator& acc) { bET_branch(cc_sector, acc, blockops); });
 
-    if (do_aHT || do_aaHT) {
-      aHT_branch(cc_sector, sigma, blockops);
-      ptime.tick_print("aHT-branch");
-    }
+    if (do_aHT || do_aaHT)
+      add_task("aHT-branch", [this, cc_sector, blockops] (SigmaAccumulator& acc) { aHT_branch(cc_sector, acc, blockops); });
 
-    if (do_bHT || do_bbHT || do_abHT) {
-      bHT_branch(cc_sector, sigma, blockops);
-      ptime.tick_print("bHT-branch");
-    }
+    if (do_bHT || do_bbHT || do_abHT)
+      add_task("bHT-branch", [this, cc_sector, blockops] (SigmaAccumulator& acc) { bHT_branch(cc_sector, acc, blockops); });
 
     // always compute these
-    aexc_branch(cc_sector, sigma, blockops);
-    bexc_branch(cc_sector, sigma, blockops);
-    ptime.tick_print("exc-branches");
+    add_task("exc-branches", [this, cc_sector, blockops] (SigmaAccumulator& acc) { aexc_branch(cc_sector, acc, blockops); bexc_branch(cc_sector, acc, blockops); });
 
-    if (do_flipup) {
-      abflip_branch(cc_sector, sigma, blockops);
-      ptime.tick_print("abflip-branch");
-    }
+    if (do_flipup)
+      add_task("abflip-branch", [this, cc_sector, blockops] (SigmaAccumulator& acc) { abflip_branch(cc_sector, acc, blockops); });
 
-    if (do_flipdn) {
-      baflip_branch(cc_sector, sigma, blockops);
-      ptime.tick_print("baflip-branch");
-    }
+    if (do_flipdn)
+      add_task("baflip-branch", [this, cc_sector, blockops] (SigmaAccumulator& acc) { baflip_branch(cc_sector, acc, blockops); });
 
-    if (do_aET) {
-      compute_sigma_3aET(cc_sector, sigma, blockops, jop);
-      ptime.tick_print("sigma-3aET");
-    }
+    if (do_aET)
+      add_task("sigma-3aET", [this, cc_sector, blockops, jop] (SigmaAccumulator& acc) { compute_sigma_3aET(cc_sector, acc, blockops, jop); });
 
-    if (do_aHT) {
-      compute_sigma_3aHT(cc_sector, sigma, blockops, jop);
-      ptime.tick_print("sigma-3aHT");
-    }
+    if (do_aHT)
+      add_task("sigma-3aHT", [this, cc_sector, blockops, jop] (SigmaAccumulator& acc) { compute_sigma_3aHT(cc_sector, acc, blockops, jop); });
 
-    if (do_bET) {
-      compute_sigma_3bET(cc_sector, sigma, blockops, jop);
-      ptime.tick_print("sigma-3bET");
-    }
+    if (do_bET)
+      add_task("sigma-3bET", [this, cc_sector, blockops, jop] (SigmaAccumulator& acc) { compute_sigma_3bET(cc_sector, acc, blockops, jop); });
 
-    if (do_bHT) {
-      compute_sigma_3bHT(cc_sector, sigma, blockops, jop);
-      ptime.tick_print("sigma-3bHT");
-    }
+    if (do_bHT)
+      add_task("sigma-3bHT", [this, cc_sector, blockops, jop] (SigmaAccumulator& acc) { compute_sigma_3bHT(cc_sector, acc, blockops, jop); });
   }
+
+  tasks.compute();
 }
 
-void FormSigmaProdRAS::aET_branch(shared_ptr<const RASBlockVectors> cc_sector, shared_ptr<ProductRASCivec> sigma, shared_ptr<const BlockOperators> blockops) const {
+void FormSigmaProdRAS::aET_branch(shared_ptr<const RASBlockVectors> cc_sector, SigmaAccumulator& sigma, shared_ptr<const BlockOperators> blockops) const {
   ApplyOperator apply;
   const int rnorb = cc_sector->det()->norb();
   // S_alpha^+
@@ -261,17 +285,17 @@ void FormSigmaProdRAS::aET_branch(shared_ptr<const RASBlockVectors> cc_sector, s
   const BlockKey singleETkey(cckey.nelea-1, cckey.neleb);
   const BlockKey doubleETkey(cckey.nelea-2, cckey.neleb);
 
-  const bool do_single = sigma->contains_block(singleETkey);
-  const bool do_double = sigma->contains_block(doubleETkey);
+  const bool do_single = sigma.contains_block(singleETkey);
+  const bool do_double = sigma.contains_block(doubleETkey);
   // not sure how you could do a double but not a single, but that's a different problem
   assert(do_single || do_double);
 
   const int nccstates = cc_sector->nstates();
 
-  shared_ptr<RASBlockVectors> single_sector = do_single ? sigma->sector(singleETkey) : nullptr;
-  shared_ptr<const RASDeterminants> single_det = do_single ? single_sector->det() : sigma->space()->det(singleETkey.nelea, singleETkey.neleb);
+  shared_ptr<RASBlockVectors> single_sector = do_single ? sigma.sector(singleETkey) : nullptr;
+  shared_ptr<const RASDeterminants> single_det = do_single ? single_sector->det() : sigma.space()->det(singleETkey.nelea, singleETkey.neleb);
 
-  shared_ptr<RASBlockVectors> double_sector = do_double ? sigma->sector(doubleETkey) : nullptr;
+  shared_ptr<RASBlockVectors> double_sector = do_double ? sigma.sector(doubleETkey) : nullptr;
   shared_ptr<RASBlockVectors> tmp_double = do_double ? make_shared<RASBlockVectors>(double_sector->det(), BlockInfo(doubleETkey.nelea, doubleETkey.neleb, nccstates))
                                                      : nullptr;
 
@@ -315,7 +339,7 @@ void FormSigmaProdRAS::aET_branch(shared_ptr<const RASBlockVectors> cc_sector, s
   }
 }
 
-void FormSigmaProdRAS::bET_branch(shared_ptr<const RASBlockVectors> cc_sector, shared_ptr<ProductRASCivec> sigma, shared_ptr<const BlockOperators> blockops) const {
+void FormSigmaProdRAS::bET_branch(shared_ptr<const RASBlockVectors> cc_sector, SigmaAccumulator& sigma, shared_ptr<const BlockOperators> blockops) const {
   ApplyOperator apply;
   const int rnorb = cc_sector->det()->norb();
 
@@ -326,20 +350,20 @@ void FormSigmaProdRAS::bET_branch(shared_ptr<const RASBlockVectors> cc_sector, s
   const BlockKey bbETkey(cckey.nelea, cckey.neleb-2);
   const BlockKey abETkey(cckey.nelea-1, cckey.neleb-1);
 
-  const bool do_b  = sigma->contains_block(bETkey);
-  const bool do_bb = sigma->contains_block(bbETkey);
-  const bool do_ab = sigma->contains_block(abETkey);
+  const bool do_b  = sigma.contains_block(bETkey);
+  const bool do_bb = sigma.contains_block(bbETkey);
+  const bool do_ab = sigma.contains_block(abETkey);
   assert(do_b || do_bb || do_ab);
 
   const int nccstates = cc_sector->nstates();
 
-  shared_ptr<RASBlockVectors> b_sector = do_b ? sigma->sector(bETkey) : nullptr;
-  shared_ptr<const RASDeterminants> b_det = do_b ? b_sector->det() : sigma->space()->det(cc_sector->det()->nelea(), cc_sector->det()->neleb()+1);
+  shared_ptr<RASBlockVectors> b_sector = do_b ? sigma.sector(bETkey) : nullptr;
+  shared_ptr<const RASDeterminants> b_det = do_b ? b_sector->det() : sigma.space()->det(cc_sector->det()->nelea(), cc_sector->det()->neleb()+1);
 
-  shared_ptr<RASBlockVectors> bb_sector = do_bb ? sigma->sector(bbETkey) : nullptr;
+  shared_ptr<RASBlockVectors> bb_sector = do_bb ? sigma.sector(bbETkey) : nullptr;
   shared_ptr<RASBlockVectors> tmp_bb = do_bb ? make_shared<RASBlockVectors>(bb_sector->det(), BlockInfo(bbETkey.nelea, bbETkey.neleb, nccstates)) : nullptr;
 
-  shared_ptr<RASBlockVectors> ab_sector = do_ab ? sigma->sector(abETkey) : nullptr;
+  shared_ptr<RASBlockVectors> ab_sector = do_ab ? sigma.sector(abETkey) : nullptr;
   shared_ptr<RASBlockVectors> tmp_ab = do_ab ? make_shared<RASBlockVectors>(ab_sector->det(), BlockInfo(abETkey.nelea, abETkey.neleb, nccstates)) : nullptr;
 
   const BlockInfo bstate(bETkey.nelea, bETkey.neleb, nccstates);
@@ -399,7 +423,7 @@ void FormSigmaProdRAS::bET_branch(shared_ptr<const RASBlockVectors> cc_sector, s
   }
 }
 
-void FormSigmaProdRAS::aHT_branch(shared_ptr<const RASBlockVectors> cc_sector, shared_ptr<ProductRASCivec> sigma, shared_ptr<const BlockOperators> blockops) const {
+void FormSigmaProdRAS::aHT_branch(shared_ptr<const RASBlockVectors> cc_sector, SigmaAccumulator& sigma, shared_ptr<const BlockOperators> blockops) const {
   ApplyOperator apply;
   const int rnorb = cc_sector->det()->norb();
 
@@ -409,17 +433,17 @@ void FormSigmaProdRAS::aHT_branch(shared_ptr<const RASBlockVectors> cc_sector, s
   const BlockKey aHTkey(cckey.nelea+1, cckey.neleb);
   const BlockKey aaHTkey(cckey.nelea+2, cckey.neleb);
 
-  const bool do_aHT  = sigma->contains_block(aHTkey);
-  const bool do_aaHT = sigma->contains_block(aaHTkey);
+  const bool do_aHT  = sigma.contains_block(aHTkey);
+  const bool do_aaHT = sigma.contains_block(aaHTkey);
   // not sure how you could do a aa but not a a, but that's a different problem
   assert(do_aHT || do_aaHT);
 
   const int nccstates = cc_sector->nstates();
 
-  shared_ptr<RASBlockVectors> a_sector = do_aHT ? sigma->sector(aHTkey) : nullptr;
-  shared_ptr<const RASDeterminants> a_det = do_aHT ? a_sector->det() : sigma->space()->det(cc_sector->det()->nelea()-1,cc_sector->det()->neleb());
+  shared_ptr<RASBlockVectors> a_sector = do_aHT ? sigma.sector(aHTkey) : nullptr;
+  shared_ptr<const RASDeterminants> a_det = do_aHT ? a_sector->det() : sigma.space()->det(cc_sector->det()->nelea()-1,cc_sector->det()->neleb());
 
-  shared_ptr<RASBlockVectors> aa_sector = do_aaHT ? sigma->sector(aaHTkey) : nullptr;
+  shared_ptr<RASBlockVectors> aa_sector = do_aaHT ? sigma.sector(aaHTkey) : nullptr;
   shared_ptr<RASBlockVectors> tmp_aa = do_aaHT ? make_shared<RASBlockVectors>(aa_sector->det(), BlockInfo(aaHTkey.nelea, aaHTkey.neleb, nccstates)) : nullptr;
 
   RASBlockVectors sector_r(a_det, BlockInfo(aHTkey.nelea, aHTkey.neleb, nccstates));
@@ -462,7 +486,7 @@ void FormSigmaProdRAS::aHT_branch(shared_ptr<const RASBlockVectors> cc_sector, s
   }
 }
 
-void FormSigmaProdRAS::bHT_branch(shared_ptr<const RASBlockVectors> cc_sector, shared_ptr<ProductRASCivec> sigma, shared_ptr<const BlockOperators> blockops) const {
+void FormSigmaProdRAS::bHT_branch(shared_ptr<const RASBlockVectors> cc_sector, SigmaAccumulator& sigma, shared_ptr<const BlockOperators> blockops) const {
   ApplyOperator apply;
   const int rnorb = cc_sector->det()->norb();
 
@@ -473,22 +497,22 @@ void FormSigmaProdRAS::bHT_branch(shared_ptr<const RASBlockVectors> cc_sector, s
   const BlockKey bbHTkey(cckey.nelea, cckey.neleb+2);
   const BlockKey abHTkey(cckey.nelea+1, cckey.neleb+1);
 
-  const bool do_bHT  = sigma->contains_block(bHTkey);
-  const bool do_bbHT = sigma->contains_block(bbHTkey);
-  const bool do_abHT = sigma->contains_block(abHTkey);
+  const bool do_bHT  = sigma.contains_block(bHTkey);
+  const bool do_bbHT = sigma.contains_block(bbHTkey);
+  const bool do_abHT = sigma.contains_block(abHTkey);
   assert(do_bHT || do_bbHT || do_abHT);
 
   const int nccstates = cc_sector->nstates();
 
-  shared_ptr<RASBlockVectors> b_sector = do_bHT ? sigma->sector(bHTkey) : nullptr;
-  shared_ptr<const RASDeterminants> b_det = do_bHT ? b_sector->det() : sigma->space()->det(cc_sector->det()->nelea(), cc_sector->det()->neleb()-1);
+  shared_ptr<RASBlockVectors> b_sector = do_bHT ? sigma.sector(bHTkey) : nullptr;
+  shared_ptr<const RASDeterminants> b_det = do_bHT ? b_sector->det() : sigma.space()->det(cc_sector->det()->nelea(), cc_sector->det()->neleb()-1);
 
   RASBlockVectors sector_r(b_det, BlockInfo(bHTkey.nelea, bHTkey.neleb, nccstates));
 
-  shared_ptr<RASBlockVectors> bb_sector = do_bbHT ? sigma->sector(bbHTkey) : nullptr;
+  shared_ptr<RASBlockVectors> bb_sector = do_bbHT ? sigma.sector(bbHTkey) : nullptr;
   shared_ptr<RASBlockVectors> tmp_bb = do_bbHT ? make_shared<RASBlockVectors>(bb_sector->det(), BlockInfo(bbHTkey.nelea, bbHTkey.neleb, nccstates)) : nullptr;
 
-  shared_ptr<RASBlockVectors> ab_sector = do_abHT ? sigma->sector(abHTkey) : nullptr;
+  shared_ptr<RASBlockVectors> ab_sector = do_abHT ? sigma.sector(abHTkey) : nullptr;
   shared_ptr<RASBlockVectors> tmp_ab = do_abHT ? make_shared<RASBlockVectors>(ab_sector->det(), BlockInfo(abHTkey.nelea, abHTkey.neleb, nccstates)) : nullptr;
 
   const int phase = (1 - (((sector_r.det()->nelea()+sector_r.det()->neleb())%2) << 1));
@@ -546,14 +570,14 @@ void FormSigmaProdRAS::bHT_branch(shared_ptr<const RASBlockVectors> cc_sector, s
 }
 
 
-void FormSigmaProdRAS::aexc_branch(shared_ptr<const RASBlockVectors> cc_sector, shared_ptr<ProductRASCivec> sigma, shared_ptr<const BlockOperators> blockops) const {
+void FormSigmaProdRAS::aexc_branch(shared_ptr<const RASBlockVectors> cc_sector, SigmaAccumulator& sigma, shared_ptr<const BlockOperators> blockops) const {
   ApplyOperator apply;
   const int rnorb = cc_sector->det()->norb();
 
   const BlockKey cckey = cc_sector->left_state().key();
   RASBlockVectors sector_rs(cc_sector->det(), cc_sector->left_state());
 
-  shared_ptr<RASBlockVectors> sigma_sector = sigma->sector(cckey);
+  shared_ptr<RASBlockVectors> sigma_sector = sigma.sector(cckey);
 
   for (int r = 0; r < rnorb; ++r) {
     for (int s = 0; s < rnorb; ++s) {
@@ -573,14 +597,14 @@ void FormSigmaProdRAS::aexc_branch(shared_ptr<const RASBlockVectors> cc_sector,
   }
 }
 
-void FormSigmaProdRAS::bexc_branch(shared_ptr<const RASBlockVectors> cc_sector, shared_ptr<ProductRASCivec> sigma, shared_ptr<const BlockOperators> blockops) const {
+void FormSigmaProdRAS::bexc_branch(shared_ptr<const RASBlockVectors> cc_sector, SigmaAccumulator& sigma, shared_ptr<const BlockOperators> blockops) const {
   ApplyOperator apply;
   const int rnorb = cc_sector->det()->norb();
 
   const BlockKey cckey = cc_sector->left_state().key();
   RASBlockVectors sector_rs(cc_sector->det(), cc_sector->left_state());
 
-  shared_ptr<RASBlockVectors> sigma_sector = sigma->sector(cckey);
+  shared_ptr<RASBlockVectors> sigma_sector = sigma.sector(cckey);
 
   for (int r = 0; r < rnorb; ++r) {
     for (int s = 0; s < rnorb; ++s) {
@@ -601,7 +625,7 @@ void FormSigmaProdRAS::bexc_branch(shared_ptr<const RASBlockVectors> cc_sector,
 
 }
 
-void FormSigmaProdRAS::abflip_branch(shared_ptr<const RASBlockVectors> cc_sector, shared_ptr<ProductRASCivec> sigma, shared_ptr<const BlockOperators> blockops) const {
+void FormSigmaProdRAS::abflip_branch(shared_ptr<const RASBlockVectors> cc_sector, SigmaAccumulator& sigma, shared_ptr<const BlockOperators> blockops) const {
   ApplyOperator apply;
   const int rnorb = cc_sector->det()->norb();
 
@@ -609,10 +633,10 @@ void FormSigmaProdRAS::abflip_branch(shared_ptr<const RASBlockVectors> cc_sector
   const BlockKey cckey = cc_sector->left_state().key();
   const BlockKey flipkey(cckey.nelea-1, cckey.neleb+1);
 
-  assert(sigma->contains_block(flipkey));
+  assert(sigma.contains_block(flipkey));
 
-  shared_ptr<const RASDeterminants> flipdet = sigma->sector(flipkey)->det();
-  shared_ptr<RASBlockVectors> sigma_sector = sigma->sector(flipkey);
+  shared_ptr<const RASDeterminants> flipdet = sigma.sector(flipkey)->det();
+  shared_ptr<RASBlockVectors> sigma_sector = sigma.sector(flipkey);
 
   RASBlockVectors sector_rs(flipdet, BlockInfo(flipkey.nelea, flipkey.neleb, nccstates));
   for (int r = 0; r < rnorb; ++r) {
@@ -633,17 +657,17 @@ void FormSigmaProdRAS::abflip_branch(shared_ptr<const RASBlockVectors> cc_sector
   }
 }
 
-void FormSigmaProdRAS::baflip_branch(shared_ptr<const RASBlockVectors> cc_sector, shared_ptr<ProductRASCivec> sigma, shared_ptr<const BlockOperators> blockops) const {
+void FormSigmaProdRAS::baflip_branch(shared_ptr<const RASBlockVectors> cc_sector, SigmaAccumulator& sigma, shared_ptr<const BlockOperators> blockops) const {
   ApplyOperator apply;
   const int rnorb = cc_sector->det()->norb();
 
   const int nccstates = cc_sector->mdim();
   const BlockKey cckey = cc_sector->left_state().key();
   const BlockKey flipkey(cckey.nelea+1, cckey.neleb-1);
-  assert(sigma->contains_block(flipkey));
+  assert(sigma.contains_block(flipkey));
 
-  shared_ptr<const RASDeterminants> flipdet = sigma->sector(flipkey)->det();
-  shared_ptr<RASBlockVectors> sigma_sector = sigma->sector(flipkey);
+  shared_ptr<const RASDeterminants> flipdet = sigma.sector(flipkey)->det();
+  shared_ptr<RASBlockVectors> sigma_sector = sigma.sector(flipkey);
 
   RASBlockVectors sector_rs(flipdet, BlockInfo(flipkey.nelea, flipkey.neleb, nccstates));
   for (int r = 0; r < rnorb; ++r) {
@@ -664,10 +688,10 @@ void FormSigmaProdRAS::baflip_branch(shared_ptr<const RASBlockVectors> cc_sector
   }
 }
 
-void FormSigmaProdRAS::compute_sigma_3aET(shared_ptr<const RASBlockVectors> cc_sector, shared_ptr<ProductRASCivec> sigma, shared_ptr<const BlockOperators> blockops, shared_ptr<DimerJop> jop) const {
+void FormSigmaProdRAS::compute_sigma_3aET(shared_ptr<const RASBlockVectors> cc_sector, SigmaAccumulator& sigma, shared_ptr<const BlockOperators> blockops, shared_ptr<DimerJop> jop) const {
   const BlockKey aETkey(cc_sector->left_state().nelea-1, cc_sector->left_state().neleb);
-  assert(sigma->contains_block(aETkey));
-  shared_ptr<RASBlockVectors> sigma_sector = sigma->sector(aETkey);
+  assert(sigma.contains_block(aETkey));
+  shared_ptr<RASBlockVectors> sigma_sector = sigma.sector(aETkey);
   const int nccstates = cc_sector->mdim();
   const BlockInfo tmpinfo(aETkey.nelea, aETkey.neleb, nccstates);
   RASBlockVectors tmp_sector(sigma_sector->det(), tmpinfo);
@@ -699,10 +723,10 @@ void FormSigmaProdRAS::compute_sigma_3aET(shared_ptr<const RASBlockVectors> cc_s
   }
 }
 
-void FormSigmaProdRAS::compute_sigma_3aHT(shared_ptr<const RASBlockVectors> cc_sector, shared_ptr<ProductRASCivec> sigma, shared_ptr<const BlockOperators> blockops, shared_ptr<DimerJop> jop) const {
+void FormSigmaProdRAS::compute_sigma_3aHT(shared_ptr<const RASBlockVectors> cc_sector, SigmaAccumulator& sigma, shared_ptr<const BlockOperators> blockops, shared_ptr<DimerJop> jop) const {
   const BlockKey aHTkey(cc_sector->left_state().nelea+1, cc_sector->left_state().neleb);
-  assert(sigma->contains_block(aHTkey));
-  shared_ptr<RASBlockVectors> sigma_sector = sigma->sector(aHTkey);
+  assert(sigma.contains_block(aHTkey));
+  shared_ptr<RASBlockVectors> sigma_sector = sigma.sector(aHTkey);
   const int nccstates = cc_sector->mdim();
   const BlockInfo tmpinfo(aHTkey.nelea, aHTkey.neleb, nccstates);
   RASBlockVectors tmp_sector(sigma_sector->det(), tmpinfo);
@@ -735,17 +759,17 @@ void FormSigmaProdRAS::compute_sigma_3aHT(shared_ptr<const RASBlockVectors> cc_s
   }
 }
 
-void FormSigmaProdRAS::compute_sigma_3bET(shared_ptr<const RASBlockVectors> cc_sector, shared_ptr<ProductRASCivec> sigma, shared_ptr<const BlockOperators> blockops,  shared_ptr<DimerJop> jop) const {
+void FormSigmaProdRAS::compute_sigma_3bET(shared_ptr<const RASBlockVectors> cc_sector, SigmaAccumulator& sigma, shared_ptr<const BlockOperators> blockops,  shared_ptr<DimerJop> jop) const {
   const BlockKey bETkey(cc_sector->left_state().nelea, cc_sector->left_state().neleb-1);
-  assert(sigma->contains_block(bETkey));
-  shared_ptr<RASBlockVectors> sigma_sector = sigma->sector(bETkey);
+  assert(sigma.contains_block(bETkey));
+  shared_ptr<RASBlockVectors> sigma_sector = sigma.sector(bETkey);
   const int nccstates = cc_sector->mdim();
   const BlockInfo tmpinfo(bETkey.nelea, bETkey.neleb, nccstates);
 
   shared_ptr<const RASDeterminants> ccdet = cc_sector->det();
   shared_ptr<const RASDeterminants> sigmadet = sigma_sector->det();
 
-  shared_ptr<RASSpace> space = sigma->space();
+  shared_ptr<RASSpace> space = sigma.space();
 
   RASBlockVectors cc_trans = cc_sector->transpose_civecs(space->det(ccdet->neleb(), ccdet->nelea()));
   RASBlockVectors sigma_trans(space->det(sigmadet->neleb(), sigmadet->nelea()), sigma_sector->left_state());
@@ -782,17 +806,17 @@ void FormSigmaProdRAS::compute_sigma_3bET(shared_ptr<const RASBlockVectors> cc_s
 }
 
 
-void FormSigmaProdRAS::compute_sigma_3bHT(shared_ptr<const RASBlockVectors> cc_sector, shared_ptr<ProductRASCivec> sigma, shared_ptr<const BlockOperators> blockops, shared_ptr<DimerJop> jop) const {
+void FormSigmaProdRAS::compute_sigma_3bHT(shared_ptr<const RASBlockVectors> cc_sector, SigmaAccumulator& sigma, shared_ptr<const BlockOperators> blockops, shared_ptr<DimerJop> jop) const {
   const BlockKey bHTkey(cc_sector->left_state().nelea, cc_sector->left_state().neleb+1);
-  assert(sigma->contains_block(bHTkey));
-  shared_ptr<RASBlockVectors> sigma_sector = sigma->sector(bHTkey);
+  assert(sigma.contains_block(bHTkey));
+  shared_ptr<RASBlockVectors> sigma_sector = sigma.sector(bHTkey);
   const int nccstates = cc_sector->mdim();
   const BlockInfo tmpinfo(bHTkey.nelea, bHTkey.neleb, nccstates);
 
   shared_ptr<const RASDeterminants> ccdet = cc_sector->det();
   shared_ptr<const RASDeterminants> sigmadet = sigma_sector->det();
 
-  shared_ptr<RASSpace> space = sigma->space();
+  shared_ptr<RASSpace> space = sigma.space();
 
   RASBlockVectors cc_trans = cc_sector->transpose_civecs(space->det(ccdet->neleb(), ccdet->nelea()));
   RASBlockVectors sigma_trans(space->det(sigmadet->neleb(), sigmadet->nelea()), sigma_sector->left_state());
@@ -26,6 +26,7 @@
 #ifndef __BAGEL_ASD_DMRG_FORM_SIGMA_H
 #define __BAGEL_ASD_DMRG_FORM_SIGMA_H
 
+#include <mutex>
 #include <src/asd/dimer/dimer_jop.h>
 #include <src/asd/dmrg/product_civec.h>
 #include <src/asd/dmrg/block_operators.h>
@@ -35,6 +36,38 @@
 
 namespace bagel {
 
+/// Private buffers for the sigma sectors written by one task. They are added to sigma under per-sector locks in flush().
+class SigmaAccumulator {
+  protected:
+    std::shared_ptr<ProductRASCivec> sigma_;
+    std::map<BlockKey, std::mutex>& locks_;
+    std::map<BlockKey, std::shared_ptr<RASBlockVectors>> buffers_;
+
+  public:
+    SigmaAccumulator(std::shared_ptr<ProductRASCivec> sigma, std::map<BlockKey, std::mutex>& locks) : sigma_(sigma), locks_(locks) { }
+
+    /// Returns a zero-initialized buffer with the shape of the sigma sector bk
+    std::shared_ptr<RASBlockVectors> sector(const BlockKey& bk) {
+      auto iter = buffers_.find(bk);
+      if (iter == buffers_.end()) {
+        std::shared_ptr<const RASBlockVectors> target = sigma_->sector(bk);
+        iter = buffers_.emplace(bk, std::make_shared<RASBlockVectors>(target->det(), target->left_state())).first;
+      }
+      return iter->second;
+    }
+
+    bool contains_block(const BlockKey& bk) const { return sigma_->contains_block(bk); }
+    std::shared_ptr<RASSpace> space() { return sigma_->space(); }
+
+    void flush() {
+      for (auto& buf : buffers_) {
+        std::lock_guard<std::mutex> lock(locks_.at(buf.first));
+        sigma_->sector(buf.first)->ax_plus_y(1.0, *buf.second);
+      }
+      buffers_.clear();
+    }
+};
+
 class FormSigmaProdRAS {
   protected:
     int batchsize_; ///< batchsize used in \f$\alpha\alpha\f$ and \f$\beta\beta\f$ parts of pure RAS
@@ -53,33 +86,33 @@ class FormSigmaProdRAS {
     void diagonal_terms(std::shared_ptr<const ProductRASCivec> cc, std::shared_ptr<ProductRASCivec> sigma, std::shared_ptr<const BlockOperators> blockops, std::shared_ptr<DimerJop> jop) const;
 
     /// Branch 1: \f$\alpha^\dagger, \alpha^\dagger\alpha^\dagger\f$
-    void aET_branch(std::shared_ptr<const RASBlockVectors> cc, std::shared_ptr<ProductRASCivec> sigma_sector, std::shared_ptr<const BlockOperators> blocksops) const;
+    void aET_branch(std::shared_ptr<const RASBlockVectors> cc, SigmaAccumulator& sigma, std::shared_ptr<const BlockOperators> blocksops) const;
     /// Branch 2: \f$\beta^\dagger, \alpha^\dagger\beta^\dagger\f$
-    void bET_branch(std::shared_ptr<const RASBlockVectors> cc, std::shared_ptr<ProductRASCivec> sigma_sector, std::shared_ptr<const BlockOperators> blocksops) const;
+    void bET_branch(std::shared_ptr<const RASBlockVectors> cc, SigmaAccumulator& sigma, std::shared_ptr<const BlockOperators> blocksops) const;
     /// Branch 3: \f$\alpha, \alpha\alpha \f$
-    void aHT_branch(std::shared_ptr<const RASBlockVectors> cc, std::shared_ptr<ProductRASCivec> sigma_sector, std::shared_ptr<const BlockOperators> blocksops) const;
+    void aHT_branch(std::shared_ptr<const RASBlockVectors> cc, SigmaAccumulator& sigma, std::shared_ptr<const BlockOperators> blocksops) const;
     /// Branch 4: \f$\beta, \alpha\beta, \beta\beta\f$
-    void bHT_branch(std::shared_ptr<const RASBlockVectors> cc, std::shared_ptr<ProductRASCivec> sigma_sector, std::shared_ptr<const BlockOperators> blocksops) const;
+    void bHT_branch(std::shared_ptr<const RASBlockVectors> cc, SigmaAccumulator& sigma, std::shared_ptr<const BlockOperators> blocksops) const;
     /// Branch 5: \f$\alpha^\dagger\alpha\f$
-    void aexc_branch(std::shared_ptr<const RASBlockVectors> cc, std::shared_ptr<ProductRASCivec> sigma_sector, std::shared_ptr<const BlockOperators> blocksops) const;
+    void aexc_branch(std::shared_ptr<const RASBlockVectors> cc, SigmaAccumulator& sigma, std::shared_ptr<const BlockOperators> blocksops) const;
     /// Branch 6: \f$\beta^\dagger\beta\f$
-    void bexc_branch(std::shared_ptr<const RASBlockVectors> cc, std::shared_ptr<ProductRASCivec> sigma_sector, std::shared_ptr<const BlockOperators> blocksops) const;
+    void bexc_branch(std::shared_ptr<const RASBlockVectors> cc, SigmaAccumulator& sigma, std::shared_ptr<const BlockOperators> blocksops) const;
     /// Branch 7: \f$\alpha^\dagger\beta\f$
-    void abflip_branch(std::shared_ptr<const RASBlockVectors> cc, std::shared_ptr<ProductRASCivec> sigma_sector, std::shared_ptr<const BlockOperators> blocksops) const;
+    void abflip_branch(std::shared_ptr<const RASBlockVectors> cc, SigmaAccumulator& sigma, std::shared_ptr<const BlockOperators> blocksops) const;
     /// Branch 8: \f$\beta^\dagger\alpha\f$
-    void baflip_branch(std::shared_ptr<const RASBlockVectors> cc, std::shared_ptr<ProductRASCivec> sigma_sector, std::shared_ptr<const BlockOperators> blocksops) const;
+    void baflip_branch(std::shared_ptr<const RASBlockVectors> cc, SigmaAccumulator& sigma, std::shared_ptr<const BlockOperators> blocksops) const;
 
     /// Computes 3-operator aET terms
-    void compute_sigma_3aET(std::shared_ptr<const RASBlockVectors> cc, std::shared_ptr<ProductRASCivec> sigma_sector, std::shared_ptr<const BlockOperators> blockops,  std::shared_ptr<DimerJop> jop) const;
+    void compute_sigma_3aET(std::shared_ptr<const RASBlockVectors> cc, SigmaAccumulator& sigma, std::shared_ptr<const BlockOperators> blockops,  std::shared_ptr<DimerJop> jop) const;
 
     /// Computes 3-operator aHT terms
-    void compute_sigma_3aHT(std::shared_ptr<const RASBlockVectors> cc, std::shared_ptr<ProductRASCivec> sigma_sector, std::shared_ptr<const BlockOperators> blockops,  std::shared_ptr<DimerJop> jop) const;
+    void compute_sigma_3aHT(std::shared_ptr<const RASBlockVectors> cc, SigmaAccumulator& sigma, std::shared_ptr<const BlockOperators> blockops,  std::shared_ptr<DimerJop> jop) const;
 
     /// Computes 3-operator bET terms
-    void compute_sigma_3bET(std::shared_ptr<const RASBlockVectors> cc, std::shared_ptr<ProductRASCivec> sigma_sector, std::shared_ptr<const BlockOperators> blockops,  std::shared_ptr<DimerJop> jop) const;
+    void compute_sigma_3bET(std::shared_ptr<const RASBlockVectors> cc, SigmaAccumulator& sigma, std::shared_ptr<const BlockOperators> blockops,  std::shared_ptr<DimerJop> jop) const;
 
     /// Computes 3-operator bHT terms
-    void compute_sigma_3bHT(std::shared_ptr<const RASBlockVectors> cc, std::shared_ptr<ProductRASCivec> sigma_sector, std::shared_ptr<const BlockOperators> blockops,  std::shared_ptr<DimerJop> jop) const;
+    void compute_sigma_3bHT(std::shared_ptr<const RASBlockVectors> cc, SigmaAccumulator& sigma, std::shared_ptr<const BlockOperators> blockops,  std::shared_ptr<DimerJop> jop) const;
 
     /// Computes \f$\hat H = \sum_{ij} i^\dagger_\alpha j_\alpha h_{ij} + \frac{1}{2} \sum_{ijkl} i^\dagger_\alpha j^\dagger_\alpha k_\alpha l_\alpha (jk|li)\f$
     void resolve_H_aa(const RASBlockVectors& cc, RASBlockVectors& sigma, const double* g, const double* mo2e) const;
@@ -63,12 +63,23 @@ void bagel::kronecker_product(const double fac, const bool atrans, const int ndi
   const int astride = atrans ? ldA : 1;
   const int bstride = btrans ? ldB : 1;
 
+  // the blocks are typically tiny, so the rank-1 updates are written out rather than calling dger for every column of C
   for (int ja = 0; ja < m; ++ja) {
     const double* Adata = atrans ? A + ja : A + ldA * ja;
     for (int jb = 0; jb < q; ++jb) {
       const double* Bdata = btrans ? B + jb : B + ldB * jb;
       double* Cdata = C + ldC * (jb + ja*q);
-      dger_(p, n, fac, Bdata, bstride, Adata, astride, Cdata, p);
+      for (int i = 0; i < n; ++i, Cdata += p) {
+        const double fa = fac * Adata[i*astride];
+        if (fa == 0.0) continue;
+        if (bstride == 1) {
+          for (int k = 0; k < p; ++k)
+            Cdata[k] += fa * Bdata[k];
+        } else {
+          for (int k = 0; k < p; ++k)
+            Cdata[k] += fa * Bdata[k*bstride];
+        }
+      }
     }
   }
 }
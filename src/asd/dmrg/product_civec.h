@@ -57,6 +57,8 @@ class RASBlockVectors : public Matrix {
     std::vector<RASCivecView> civecs() {
       std::vector<RASCivecView> out;
       const int nst = nstates();
+      // views copied from const ones are read-only, so out must not reallocate
+      out.reserve(nst);
       for (int i = 0; i < nst; ++i)
         out.emplace_back(det_, element_ptr(0,i));
       return out;
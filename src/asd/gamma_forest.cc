@@ -54,7 +54,7 @@ void GammaForest<DistDvec, 2>::compute() {
       const int norb = itree->ket()->det()->norb();
       for (int i = 0; i < nops; ++i) {
         shared_ptr<DistBranch> first = itree->base()->branch(i);
-        if (!first->active()) continue;
+        if (!first || !first->active()) continue;
         for (int a = 0; a < norb; ++a) {
           GammaTask<DistDvec> task(itree, GammaSQ(i), a);
           task.compute();
@@ -102,7 +102,7 @@ class GammaDistRASTask : public RASTask<GammaBranch<DistRASDvec>> {
 
         for (int j = 0; j < nops; ++j) {
           auto second = first->branch(j);
-          if (!second->active()) continue;
+          if (!second || !second->active()) continue;
 
           for (int b = 0; b < norb; ++b) {
             if (b==a_ && j==operation_) continue;
@@ -114,7 +114,7 @@ class GammaDistRASTask : public RASTask<GammaBranch<DistRASDvec>> {
 
             for (int k = 0; k < nops; ++k) {
               shared_ptr<GammaBranch<DistRASDvec>> third = second->branch(k);
-              if (!third->active()) continue;
+              if (!third || !third->active()) continue;
 
               for (int c = 0; c < norb; ++c) {
                 if (b==c && k==j) continue;
@@ -192,7 +192,7 @@ void GammaForest<DistRASDvec, 2>::compute() {
       for(int istate = 0; istate < nstates; ++istate) {
         for (int i = 0; i < nops; ++i) {
           shared_ptr<DistBranch> first = itree->base()->branch(i);
-          if (first->active()) {
+          if (first && first->active()) {
             for (int a = 0; a < norb; ++a) {
               for (auto& block : localvecs[istate]->blocks()) {
                 if (block) tasks.emplace_back(itree, block, istate, GammaSQ(i), a, &mutexes[istate + nstates*(a + i*norb)], &ssmap, &ssmut);
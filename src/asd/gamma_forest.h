@@ -27,6 +27,8 @@
 #define __asd_gamma_forest_h
 
 #include <set>
+#include <tuple>
+#include <functional>
 #include <src/ci/fci/dvec.h>
 #include <src/ci/ras/civector.h>
 #include <src/util/math/matrix.h>
@@ -55,7 +57,10 @@ class GammaBranch {
       } else {
         auto first = gsq.back();
         auto rest = gsq; rest.pop_back();
-        std::shared_ptr<GammaBranch<VecType>> target = branches_[static_cast<int>(first)];
+        // branches are only created along the operator strings that have been requested
+        std::shared_ptr<GammaBranch<VecType>>& target = branches_[static_cast<int>(first)];
+        if (!target)
+          target = std::make_shared<GammaBranch<VecType>>();
 
         target->activate();
         target->insert(bra, bra_tag, rest);
@@ -146,22 +151,10 @@ class GammaTree {
     std::shared_ptr<GammaBranch<VecType>> base_;
 
   public:
-    GammaTree(std::shared_ptr<const VecType> ket) : ket_(ket) {
-      base_ = std::make_shared<GammaBranch<VecType>>();
-      constexpr int nops = 4;
-
-      for (int i = 0; i < nops; ++i) {
-        base_->branch(i) = std::make_shared<GammaBranch<VecType>>();
-        for (int j = 0; j < nops; ++j) {
-          base_->branch(i)->branch(j) = std::make_shared<GammaBranch<VecType>>();
-          for (int k = 0; k < nops; ++k) {
-            base_->branch(i)->branch(j)->branch(k) = std::make_shared<GammaBranch<VecType>>();
-          }
-        }
-      }
-    }
+    GammaTree(std::shared_ptr<const VecType> ket) : ket_(ket), base_(std::make_shared<GammaBranch<VecType>>()) { }
 
     std::shared_ptr<GammaBranch<VecType>> base() { return base_; }
+    std::shared_ptr<const GammaBranch<VecType>> base() const { return base_; }
 
     void insert(std::shared_ptr<const VecType> bra, const size_t tag, const std::list<GammaSQ>& ops) { base_->insert(bra, tag, ops); }
     std::shared_ptr<      Matrix> search(const size_t tag, const std::list<GammaSQ>& address)       { return base_->search(tag, address); }
@@ -199,7 +192,7 @@ class GammaTask {
 
       for (int j = 0; j < nops; ++j) {
         auto second = first->branch(j);
-        if (!second->active()) continue;
+        if (!second || !second->active()) continue;
 
         for (int b = 0; b < norb; ++b) {
           if (b==a_ && j==static_cast<int>(operation_)) continue;
@@ -209,7 +202,7 @@ class GammaTask {
 
           for (int k = 0; k < nops; ++k) {
             std::shared_ptr<GammaBranch<VecType>> third = second->branch(k);
-            if (!third->active()) continue;
+            if (!third || !third->active()) continue;
 
             for (int c = 0; c < norb; ++c) {
               if (b==c && k==j) continue;
@@ -281,15 +274,17 @@ class GammaForest {
           // Allocation sweep
           for (int i = 0; i < nops; ++i) {
             std::shared_ptr<GammaBranch<VecType>> first = itree->base()->branch(i);
+            if (!first) continue;
             if (first->active()) func(first);
 
             for (int j = 0; j < nops; ++j) {
               std::shared_ptr<GammaBranch<VecType>> second = first->branch(j);
+              if (!second) continue;
               if (second->active()) func(second);
 
               for (int k = 0; k < nops; ++k) {
                 std::shared_ptr<GammaBranch<VecType>> third = second->branch(k);
-                if (third->active()) func(third);
+                if (third && third->active()) func(third);
               }
             }
           }
@@ -313,7 +308,7 @@ class GammaForest {
           // Allocation sweep
           for (int i = 0; i < nops; ++i) {
             std::shared_ptr<GammaBranch<VecType>> first = itree->base()->branch(i);
-            if (!first->active()) continue;
+            if (!first || !first->active()) continue;
             ++ntasks;
             for (auto& ibra : first->bras()) {
               const int nAp = ibra.second->ij();
@@ -323,7 +318,7 @@ class GammaForest {
 
             for (int j = 0; j < nops; ++j) {
               std::shared_ptr<GammaBranch<VecType>> second = first->branch(j);
-              if (!second->active()) continue;
+              if (!second || !second->active()) continue;
               for (auto& jbra : second->bras()) {
                 const int nAp = jbra.second->ij();
                 const int nstates = nA * nAp;
@@ -332,7 +327,7 @@ class GammaForest {
 
               for (int k = 0; k < nops; ++k) {
                 std::shared_ptr<GammaBranch<VecType>> third = second->branch(k);
-                if (!third->active()) continue;
+                if (!third || !third->active()) continue;
                 for (auto& kbra : third->bras()) {
                   const int nAp = kbra.second->ij();
                   const int nstates = nA * nAp;
@@ -347,6 +342,37 @@ class GammaForest {
       return ntasks;
     }
 
+    // Diagnostics only: returns the number of branch objects allocated, the number that pre-creating all 4+16+64 branches
+    // of every tree (the former scheme) allocated, the number of requested gammas, and the number of elements they occupy.
+    // Only the empty branches are created on demand; which gammas are computed, when, and for how long they are kept is
+    // unchanged (there is no lazy evaluation, memoization, or eviction of gammas), so the last two are the same in both schemes.
+    std::tuple<size_t, size_t, size_t, size_t> statistics() const {
+      constexpr int nops = 4;
+      size_t nbranch = 0, nbranch_all = 0, ngamma = 0, nused = 0;
+
+      for (auto& iforest : forests_) {
+        for (auto& itreemap : iforest) {
+          std::shared_ptr<const GammaTree<VecType>> itree = itreemap.second;
+          const size_t nA = itree->ket()->ij();
+          const size_t norb = itree->norb();
+
+          std::function<void(const GammaBranch<VecType>&, const size_t)> walk = [&](const GammaBranch<VecType>& branch, const size_t len) {
+            ++nbranch;
+            for (auto& ibra : branch.bras()) {
+              ++ngamma;
+              nused += nA * ibra.second->ij() * len;
+            }
+            for (int i = 0; i < nops; ++i)
+              if (branch.branch(i))
+                walk(*branch.branch(i), len * norb);
+          };
+          walk(*itree->base(), 1);
+          nbranch_all += 1 + nops + nops*nops + nops*nops*nops;
+        }
+      }
+      return std::make_tuple(nbranch, nbranch_all, ngamma, nused);
+    }
+
     void compute() {
       constexpr int nops = 4;
 
@@ -369,7 +395,7 @@ class GammaForest {
           const int norb = itree->norb();
           for (int i = 0; i < nops; ++i) {
             std::shared_ptr<GammaBranch<VecType>> first = itree->base()->branch(i);
-            if (!first->active()) continue;
+            if (!first || !first->active()) continue;
             for (int a = 0; a < norb; ++a) tasks.emplace_back(itree, GammaSQ(i), a);
           }
         }
@@ -531,7 +557,7 @@ class GammaTask<RASDvec> : public RASTask<GammaBranch<RASDvec>> {
 
           for (int j = 0; j < nops; ++j) {
             auto second = first->branch(j);
-            if (!second->active()) continue;
+            if (!second || !second->active()) continue;
 
             for (int b = 0; b < norb; ++b) {
               if (b==a_ && j==static_cast<int>(operation_)) continue;
@@ -543,7 +569,7 @@ class GammaTask<RASDvec> : public RASTask<GammaBranch<RASDvec>> {
 
               for (int k = 0; k < nops; ++k) {
                 std::shared_ptr<GammaBranch<RASDvec>> third = second->branch(k);
-                if (!third->active()) continue;
+                if (!third || !third->active()) continue;
 
                 for (int c = 0; c < norb; ++c) {
                   if (b==c && k==j) continue;
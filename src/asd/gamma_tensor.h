@@ -140,7 +140,8 @@ class GammaTensor {
     MatView get_block_as_matview(const MonomerKey& i, const MonomerKey& j, const std::initializer_list<GammaSQ>& o) const {
       auto tensor = sparse_.at(std::make_tuple(std::list<GammaSQ>(o), i, j));
       btas::CRange<2> range(tensor->extent(0)*tensor->extent(1), tensor->extent(2));
-      return MatView(btas::make_view(range, tensor->storage()), /*localized*/false);
+      // Hamiltonian blocks are distributed over processes, so products of these views must not be collective
+      return MatView(btas::make_view(range, tensor->storage()), /*localized*/true);
     }
 };
 
@@ -27,6 +27,7 @@
 #include <src/ci/fci/space.h>
 #include <src/ci/fci/modelci.h>
 #include <src/util/combination.hpp>
+#include <src/util/math/mixedprecision.h>
 
 using namespace std;
 using namespace bagel;
@@ -50,6 +51,8 @@ void FCI::common_init() {
   thresh_ = idata_->get<double>("thresh_fci", thresh_);
   print_thresh_ = idata_->get<double>("print_thresh", 0.05);
   restart_ = idata_->get<bool>("restart", false);
+  mixed_precision_ = idata_->get<bool>("mixed_precision", false);
+  mixed_precision_thresh_ = idata_->get<double>("mixed_precision_thresh", 1.0e-5);
 
   if (nstate_ < 0) nstate_ = idata_->get<int>("nstate", 1);
   nguess_ = idata_->get<int>("nguess", nstate_);
@@ -264,6 +267,8 @@ void FCI::compute() {
   cout << "  === FCI iteration ===" << endl << endl;
   // 0 means not converged
   vector<int> conv(nstate_, 0);
+  MixedPrecision mixed(mixed_precision_, mixed_precision_thresh_);
+  single_sigma_ = mixed.active();
 
   for (int iter = 0; iter != max_iter_; ++iter) {
     Timer fcitime;
@@ -325,8 +330,19 @@ void FCI::compute() {
                               << fcitime.tick() << endl;
       energy_[i] = energies[i]+nuc_core;
     }
+
+    // the Davidson subspace holds single-precision sigma vectors, so it is restarted from the current eigenvectors
+    if (mixed.update(*max_element(errors.begin(), errors.end())) && iter != max_iter_-1) {
+      cout << "      switching to double precision" << endl;
+      single_sigma_ = false;
+      cc_ = make_shared<Dvec>(CASDvec(davidson_->civec()));
+      davidson_ = make_shared<DavidsonDiag<Civec>>(nstate_, davidson_subspace_);
+      fill(conv.begin(), conv.end(), 0);
+      continue;
+    }
     if (*min_element(conv.begin(), conv.end())) break;
   }
+  single_sigma_ = false;
   // main iteration ends here
 
   auto cc = make_shared<CASDvec>(davidson_->civec());
@@ -87,6 +87,12 @@ class FCI : public Method {
     bool restart_;
     bool restarted_;
 
+    // single-precision sigma GEMMs while the residual is above mixed_precision_thresh_ (see MixedPrecision); not serialized
+    bool mixed_precision_ = false;
+    double mixed_precision_thresh_ = 1.0e-5;
+    // true while the alpha-beta sigma GEMM is performed in single precision
+    bool single_sigma_ = false;
+
   private:
     // serialization
     friend class boost::serialization::access;
@@ -28,6 +28,7 @@
 #include <src/util/math/davidson.h>
 #include <src/util/taskqueue.h>
 #include <src/util/prim_op.h>
+#include <src/util/math/mixedprecision.h>
 
 BOOST_CLASS_EXPORT_IMPLEMENT(bagel::HarrisonZarrabian)
 
@@ -149,7 +150,14 @@ void HarrisonZarrabian::sigma_2ab_1(shared_ptr<const Civec> cc, shared_ptr<Dvec>
 void HarrisonZarrabian::sigma_2ab_2(shared_ptr<Dvec> d, shared_ptr<Dvec> e, shared_ptr<const MOFile> jop) const {
   const int ij = d->ij();
   const int lenab = d->lena() * d->lenb();
-  dgemm_("n", "n", lenab, ij, ij, 1.0, d->data(), lenab, jop->mo2e_ptr(), ij, 0.0, e->data(), lenab);
+  if (single_sigma_) {
+    // each operand is converted once per sigma vector
+    const vector<float> fd = blas::to_single(d->data(), static_cast<size_t>(lenab)*ij);
+    const vector<float> fj = blas::to_single(jop->mo2e_ptr(), static_cast<size_t>(ij)*ij);
+    blas::mixed_gemm("n", "n", lenab, ij, ij, 1.0, fd.data(), lenab, fj.data(), ij, 0.0, e->data(), lenab);
+  } else {
+    dgemm_("n", "n", lenab, ij, ij, 1.0, d->data(), lenab, jop->mo2e_ptr(), ij, 0.0, e->data(), lenab);
+  }
 }
 
 
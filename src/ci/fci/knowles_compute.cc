@@ -25,6 +25,7 @@
 
 #include <src/ci/fci/knowles.h>
 #include <src/util/math/davidson.h>
+#include <src/util/math/mixedprecision.h>
 
 // toggle for timing print out.
 static const bool tprint = false;
@@ -186,7 +187,14 @@ void KnowlesHandy::sigma_2b(shared_ptr<Dvec> d, shared_ptr<Dvec> e, shared_ptr<c
   const int lb = d->lenb();
   const int ij = d->ij();
   const int lenab = la*lb;
-  dgemm_("n", "n", lenab, ij, ij, 0.5, d->data(), lenab, jop->mo2e_ptr(), ij,
-                                  0.0, e->data(), lenab);
+  if (single_sigma_) {
+    // each operand is converted once per sigma vector
+    const vector<float> fd = blas::to_single(d->data(), static_cast<size_t>(lenab)*ij);
+    const vector<float> fj = blas::to_single(jop->mo2e_ptr(), static_cast<size_t>(ij)*ij);
+    blas::mixed_gemm("n", "n", lenab, ij, ij, 0.5, fd.data(), lenab, fj.data(), ij, 0.0, e->data(), lenab);
+  } else {
+    dgemm_("n", "n", lenab, ij, ij, 0.5, d->data(), lenab, jop->mo2e_ptr(), ij,
+                                    0.0, e->data(), lenab);
+  }
 }
 
@@ -29,6 +29,7 @@
 
 #include <src/util/combination.hpp>
 #include <src/ci/ras/determinants.h>
+#include <src/ci/ras/sparse_ij.h>
 
 using namespace std;
 using namespace bagel;
@@ -166,3 +167,10 @@ pair<vector<tuple<bitset<nbit__>, bitset<nbit__>, int>>, double> RASDeterminants
   const double factor = 1.0/sqrt(static_cast<double>(icnt));
   return {out, factor};
 }
+
+
+shared_ptr<const Flat_IJ> RASDeterminants::flat_ij_b() const {
+  if (!flat_ij_b_)
+    flat_ij_b_ = make_shared<const Flat_IJ>(stringspaceb(), stringspaceb());
+  return flat_ij_b_;
+}
@@ -32,6 +32,7 @@
 namespace bagel {
 
 using DetMapBlock = DetMapBlock_base<RASString>;
+class Flat_IJ;
 
 class RASDeterminants : public Determinants_base<RASString>,
                         public std::enable_shared_from_this<RASDeterminants> {
@@ -48,6 +49,9 @@ class RASDeterminants : public Determinants_base<RASString>,
     std::vector<std::vector<DetMapBlock>> phia_ij_;
     std::vector<std::vector<DetMapBlock>> phib_ij_;
 
+    // flattened beta excitation lists used in the alpha-beta part of sigma; constructed on demand
+    mutable std::shared_ptr<const Flat_IJ> flat_ij_b_;
+
   public:
     RASDeterminants(const int norb1, const int norb2, const int norb3, const int nelea, const int neleb, const int max_holes, const int max_particles, const bool mute = false);
     RASDeterminants(std::array<int, 3> ras, const int nelea, const int neleb, const int max_holes, const int max_particles, const bool mute = false) :
@@ -129,6 +133,8 @@ class RASDeterminants : public Determinants_base<RASString>,
     const std::vector<DetMapBlock>& phia_ij(const size_t ij) const { return phia_ij_[ij]; }
     const std::vector<DetMapBlock>& phib_ij(const size_t ij) const { return phib_ij_[ij]; }
 
+    std::shared_ptr<const Flat_IJ> flat_ij_b() const;
+
     std::shared_ptr<const RASDeterminants> addalpha() const { return addalpha_.lock();}
     std::shared_ptr<const RASDeterminants> remalpha() const { return remalpha_.lock();}
     std::shared_ptr<const RASDeterminants> addbeta() const { return addbeta_.lock();}
@@ -27,6 +27,7 @@
 #include <src/util/math/sparsematrix.h>
 #include <src/ci/ras/form_sigma.h>
 #include <src/ci/ras/sparse_ij.h>
+#include <src/util/taskqueue.h>
 
 // toggle for timing print out.
 static const bool tprint = false;
@@ -124,6 +125,8 @@ shared_ptr<RASDvec> FormSigmaRAS::operator()(shared_ptr<const RASDvec> ccvec, sh
   // Bit of a temporary hack to make life easier if no mo2e is provided
   shared_ptr<const Matrix> twoelectron = ( !mo2e ? make_shared<Matrix>(norb*norb, norb*norb) : mo2e );
 
+  vector<const double*> ccs;
+  vector<double*> sigmas;
   for (int istate = 0; istate != nstate; ++istate) {
     if (conv[istate]) continue;
 #ifdef HAVE_MPI_H
@@ -141,15 +144,20 @@ shared_ptr<RASDvec> FormSigmaRAS::operator()(shared_ptr<const RASDvec> ccvec, sh
       sigma_bb(cc, sigma, g.data(), twoelectron->data());
       pdebug.tick_print("taskbb");
 
-      // (taskab) alpha-beta contributions
-      if (mo2e)
-        sigma_ab(cc, sigma, twoelectron->data());
-      pdebug.tick_print("taskab");
+      ccs.push_back(cc.data());
+      sigmas.push_back(sigma.data());
 #ifdef HAVE_MPI_H
     }
 #endif
   }
 
+  // (taskab) alpha-beta contributions for all the local states at once
+  if (mo2e && !ccs.empty()) {
+    Timer pdebug(2);
+    sigma_ab(det, ccs, sigmas, twoelectron->data());
+    pdebug.tick_print("taskab (" + to_string(ccs.size()) + " states)");
+  }
+
 #ifdef HAVE_MPI_H
   for (int istate = 0; istate != nstate; ++istate) {
     if (!conv[istate])
@@ -225,78 +233,99 @@ void FormSigmaRAS::sigma_bb(const RASCivecView cc, RASCivecView sigma, const dou
 
 void FormSigmaRAS::sigma_ab(const RASCivecView cc, RASCivecView sigma, const double* mo2e) const {
   assert(*cc.det() == *sigma.det());
-  shared_ptr<const RASDeterminants> det = cc.det();
+  sigma_ab(cc.det(), {cc.data()}, {sigma.data()}, mo2e);
+}
+
+void FormSigmaRAS::sigma_ab(shared_ptr<const RASDeterminants> det, const vector<const double*>& ccs, const vector<double*>& sigmas, const double* mo2e) const {
+  assert(!ccs.empty() && ccs.size() == sigmas.size());
 
   const int norb = det->norb();
+  const size_t nvec = ccs.size();
+
+  // flattened excitation lists; owned by the determinants and reused in subsequent calls
+  shared_ptr<const Flat_IJ> flatij = det->flat_ij_b();
+  // values of the sparse F matrices. Each task only touches the rows of its own target space.
+  unique_ptr<double[]> values(new double[max(flatij->size(), static_cast<size_t>(1))]);
+
+  // tasks are the row ranges of the target beta spaces, so that the sigma elements updated by different tasks never overlap
+  const size_t nthreads = resources__->max_num_threads();
+  vector<tuple<shared_ptr<const RASString>, size_t, size_t, size_t>> ranges;
+  for (auto& target_bspace : *det->stringspaceb()) {
+    const size_t tlb = target_bspace->size();
+    const size_t rowblock = max(static_cast<size_t>(64), (tlb-1)/nthreads+1);
+    for (size_t r0 = 0; r0 < tlb; r0 += rowblock)
+      ranges.emplace_back(target_bspace, flatij->target_index(*target_bspace), r0, min(r0+rowblock, tlb));
+  }
 
-  // pre-compute all sparse F matrices
-  Sparse_IJ sparseij(det->stringspaceb(), det->stringspaceb());
-
-  // figure out maximum block size
-  const size_t max_ccblock_size = (*max_element(cc.blocks().begin(), cc.blocks().end(),
-          [] (shared_ptr<const RASBlock<double>> a, shared_ptr<const RASBlock<double>> b) {
-            return ( a ? a->size() : 0) < ( b ? b->size() : 0);
-          }))->size();
-
-  // allocate some scratch space. these upperbounds may be overkill
-  unique_ptr<double[]> cprime(new double[2*max_ccblock_size]);
-  unique_ptr<double[]> V(new double[2*max_ccblock_size]);
-
-  for (int i = 0, ij = 0; i < norb; ++i) {
-    for (int j = 0; j <= i; ++j, ++ij) {
-      const double* mo2e_ij = mo2e + i + norb*norb*j;
-      for (auto& target_bspace : *det->stringspaceb()) {
-        const size_t tlb = target_bspace->size();
-        // looping over source_aspace
-        for (auto& phiblock : det->phia_ij(ij) ) {
-          const shared_ptr<const RASString>& source_aspace = phiblock.source_space();
-
-          // make a reduced list of only those excitations that will contribute to the sigma vector
-          vector<tuple</*source*/size_t,/*sign*/int, /*offset_of_target*/size_t>> reduced_phi;
-          for (auto& phi : phiblock) {
-            auto target_aspace = det->space<0>(det->string_bits_a(phi.target));
-            if (det->allowed(target_aspace, target_bspace)) {
-              const shared_ptr<const RASBlock<double>>& tblock = cc.block(target_bspace, target_aspace);
-              const size_t o = tblock->offset() + (phi.target - target_aspace->offset()) * tblock->lenb();
-              reduced_phi.emplace_back(phi.source, phi.sign, o);
+  TaskQueue<function<void(void)>> tasks(ranges.size());
+  for (auto& range : ranges) {
+    tasks.emplace_back([&, range]() {
+      shared_ptr<const RASString> target_bspace;
+      size_t itarget, rstart, rend;
+      tie(target_bspace, itarget, rstart, rend) = range;
+      const size_t nrow = rend - rstart;
+
+      vector<double> cprime;
+      vector<double> V;
+
+      for (int i = 0, ij = 0; i < norb; ++i) {
+        for (int j = 0; j <= i; ++j, ++ij) {
+          const double* mo2e_ij = mo2e + i + norb*norb*j;
+          // looping over source_aspace
+          for (auto& phiblock : det->phia_ij(ij) ) {
+            const shared_ptr<const RASString>& source_aspace = phiblock.source_space();
+
+            // make a reduced list of only those excitations that will contribute to the sigma vector
+            vector<tuple</*source*/size_t,/*sign*/int, /*offset_of_target*/size_t>> reduced_phi;
+            for (auto& phi : phiblock) {
+              auto target_aspace = det->space<0>(det->string_bits_a(phi.target));
+              if (det->allowed(target_aspace, target_bspace)) {
+                shared_ptr<const CIBlockInfo<RASString>> tblock = det->blockinfo(target_bspace, target_aspace);
+                const size_t o = tblock->offset() + (phi.target - target_aspace->offset()) * tblock->lenb();
+                reduced_phi.emplace_back(phi.source, phi.sign, o);
+              }
             }
-          }
 
-          if (reduced_phi.empty()) continue;
-
-          for (auto& source_block : cc.allowed_blocks<0>(source_aspace)) {
-            const shared_ptr<const RASString>& source_bspace = source_block->stringsb();
-            const size_t slb = source_bspace->size();
-
-            // F matrix in sparse format
-            const shared_ptr<SparseMatrix>& sparseF = sparseij.sparse_matrix(target_bspace->tag(), source_bspace->tag());
-
-            // if this assert fails, max_ccblock_size is not a good enough upper bound
-            assert(max_ccblock_size >= max(slb, tlb) * reduced_phi.size());
-
-            if (sparseF) {
-              // fill in sparse matrix
-              sparseF->zero();
-              for (auto& iter : sparseij.sparse_data(target_bspace->tag(), source_bspace->tag()))
-                *iter.ptr += static_cast<double>(iter.sign) * mo2e_ij[norb*(iter.i + norb*norb*iter.j)];
-
-              // gather to fill in C'
-              fill_n(cprime.get(), slb * reduced_phi.size(), 0.0);
-              int current = 0;
-              for (auto& i : reduced_phi)
-                blas::ax_plus_y_n(get<1>(i), source_block->data() + slb*get<0>(i), slb, cprime.get() + current++*slb);
+            if (reduced_phi.empty()) continue;
+            const size_t nphi = reduced_phi.size();
+
+            for (auto& source_block : det->matching_blocks<0>(source_aspace)) {
+              const shared_ptr<const RASString>& source_bspace = source_block->stringsb();
+              const size_t slb = source_bspace->size();
+
+              // F matrix in flattened sparse format
+              const Flat_IJ::Block& fblock = flatij->block(itarget, flatij->source_index(*source_bspace));
+              if (fblock.nnz == 0) continue;
+              flatij->fill(fblock, rstart, rend, mo2e_ij, values.get());
+
+              // gather to fill in C' for all the vectors
+              cprime.assign(slb * nphi * nvec, 0.0);
+              V.resize(nrow * nphi * nvec);
+              double* cp = cprime.data();
+              for (auto& c : ccs) {
+                const double* source_data = c + source_block->offset();
+                for (auto& i : reduced_phi) {
+                  blas::ax_plus_y_n(get<1>(i), source_data + slb*get<0>(i), slb, cp);
+                  cp += slb;
+                }
+              }
 
               // compute V = F * C'
-              dcsrmm_("N", tlb, reduced_phi.size(), slb, 1.0, sparseF->data(), sparseF->cols(), sparseF->rind(), cprime.get(), slb, 0.0, V.get(), tlb);
+              flatij->multiply(fblock, rstart, rend, values.get(), nphi * nvec, cprime.data(), slb, V.data(), nrow);
 
               // scatter to add V to sigma
-              current = 0;
-              for (auto& i : reduced_phi)
-                blas::ax_plus_y_n(1.0, V.get() + tlb*current++, tlb, sigma.data() + get<2>(i));
+              const double* v = V.data();
+              for (auto& s : sigmas) {
+                for (auto& i : reduced_phi) {
+                  blas::ax_plus_y_n(1.0, v, nrow, s + get<2>(i) + rstart);
+                  v += nrow;
+                }
+              }
             }
           }
         }
       }
-    }
+    });
   }
+  tasks.compute();
 }
@@ -49,6 +49,8 @@ class FormSigmaRAS {
     void sigma_aa(const RASCivecView cc, RASCivecView sigma, const double* g, const double* mo2e) const;
     void sigma_bb(const RASCivecView cc, RASCivecView sigma, const double* g, const double* mo2e) const;
     void sigma_ab(const RASCivecView cc, RASCivecView sigma, const double* mo2e) const;
+    // alpha-beta part for several vectors at once, sharing the excitation lists and the sparse F matrices
+    void sigma_ab(std::shared_ptr<const RASDeterminants> det, const std::vector<const double*>& cc, const std::vector<double*>& sigma, const double* mo2e) const;
 };
 
 }
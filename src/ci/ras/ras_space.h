@@ -27,6 +27,7 @@
 #ifndef __SRC_RAS_RAS_SPACE_H
 #define __SRC_RAS_RAS_SPACE_H
 
+#include <mutex>
 #include <src/ci/ras/determinants.h>
 
 namespace bagel {
@@ -35,6 +36,7 @@ namespace bagel {
 class RASSpace {
   protected:
     std::map<std::pair<int, int>, std::shared_ptr<RASDeterminants>> detmap_; ///< Map to retrieve desired determinants
+    mutable std::mutex detmap_mutex_; ///< Guards detmap_, which is filled from threaded sigma builds (e.g., ASD-DMRG)
 
     std::array<int, 3> ras_;
     int max_holes_;
@@ -66,6 +68,7 @@ class RASSpace {
     /// If such a determinant already exists, then it is returned from the map,
     /// if no such determinant already exists, then it is created and returned.
     std::shared_ptr<RASDeterminants> det(const int na, const int nb) {
+      std::lock_guard<std::mutex> lock(detmap_mutex_);
       auto iter = detmap_.find({na,nb});
       std::shared_ptr<RASDeterminants> out;
       if (iter != detmap_.end()) {
@@ -78,7 +81,10 @@ class RASSpace {
       return out;
     }
     /// Const version of det() function only returns a RASDeterminants object if it's already in the detmap_
-    std::shared_ptr<const RASDeterminants> det(const int na, const int nb) const { return detmap_.at({na,nb}); }
+    std::shared_ptr<const RASDeterminants> det(const int na, const int nb) const {
+      std::lock_guard<std::mutex> lock(detmap_mutex_);
+      return detmap_.at({na,nb});
+    }
 
     const std::map<std::pair<int,int>, std::shared_ptr<RASDeterminants>>& detmap() const { return detmap_; }
 
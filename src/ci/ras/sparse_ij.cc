@@ -102,3 +102,121 @@ Sparse_IJ::Sparse_IJ(shared_ptr<const CIStringSet<RASString>> source_stringspace
     }
   }
 }
+
+
+Flat_IJ::Flat_IJ(shared_ptr<const CIStringSet<RASString>> source_stringspace, shared_ptr<const CIStringSet<RASString>> target_stringspace)
+ : ntarget_(target_stringspace->nspaces()), nsource_(source_stringspace->nspaces()), size_(0ull) {
+  assert(source_stringspace->nele()==target_stringspace->nele());
+  assert(source_stringspace->norb()==target_stringspace->norb());
+
+  const int norb = source_stringspace->norb();
+  // the offsets into the MO integrals are stored in 32 bits
+  assert(static_cast<uint64_t>(norb)*norb*norb*norb < numeric_limits<uint32_t>::max());
+
+  for (auto& target_space : *target_stringspace)
+    target_tags_.push_back(target_space->tag());
+  for (auto& source_space : *source_stringspace)
+    source_tags_.push_back(source_space->tag());
+
+  // string -> (index of the source space, position within the space)
+  unordered_map<bitset<nbit__>, pair<uint32_t, uint32_t>> lexmap;
+  vector<size_t> source_sizes;
+  for (auto& source_space : *source_stringspace) {
+    for (size_t i = 0; i < source_space->size(); ++i)
+      lexmap[source_space->strings(i)] = {source_sizes.size(), i};
+    source_sizes.push_back(source_space->size());
+  }
+
+  blocks_.resize(ntarget_*nsource_);
+  size_t itarget_space = 0;
+  for (auto& target_space : *target_stringspace) {
+    const size_t tlen = target_space->size();
+    assert(tlen < numeric_limits<uint32_t>::max());
+    // (column, offset, sign) for each source space, generated row by row
+    vector<vector<tuple<uint32_t, uint32_t, int>>> row_keys(nsource_);
+    vector<vector<uint32_t>> nkeys(nsource_, vector<uint32_t>(tlen+1, 0));
+    for (size_t itar = 0; itar < tlen; ++itar) {
+      const bitset<nbit__> tbit = target_space->strings(itar);
+      for (int i = 0; i < norb; ++i) {
+        if (!tbit[i]) continue;
+        bitset<nbit__> tmpbit = tbit; tmpbit.reset(i);
+        for (int j = 0; j < norb; ++j) {
+          if (tmpbit[j]) continue;
+          bitset<nbit__> sbit = tmpbit; sbit.set(j);
+          auto iter = lexmap.find(sbit);
+          if (iter != lexmap.end()) {
+            const uint32_t is = iter->second.first;
+            row_keys[is].emplace_back(iter->second.second, norb*(i + norb*norb*j), sign(sbit, i, j));
+            ++nkeys[is][itar+1];
+          }
+        }
+      }
+    }
+
+    for (size_t is = 0; is != nsource_; ++is) {
+      Block& b = blocks_[is + nsource_*itarget_space];
+      b.nrow = tlen;
+      b.ncol = source_sizes[is];
+      b.data_offset = size_;
+      b.row_offset = rowptr_.size();
+      b.key_offset = keys_.size();
+
+      // sort the keys within each row by column and compress
+      vector<tuple<uint32_t, uint32_t, int>>& rk = row_keys[is];
+      uint32_t nnz = 0;
+      size_t kstart = 0;
+      rowptr_.push_back(0);
+      keyptr_.push_back(0);
+      for (size_t itar = 0; itar < tlen; ++itar) {
+        const size_t kend = kstart + nkeys[is][itar+1];
+        sort(rk.begin()+kstart, rk.begin()+kend, [](const tuple<uint32_t, uint32_t, int>& a, const tuple<uint32_t, uint32_t, int>& b) { return get<0>(a) < get<0>(b); });
+        for (size_t k = kstart; k != kend; ++k) {
+          if (k == kstart || get<0>(rk[k]) != get<0>(rk[k-1])) {
+            colind_.push_back(get<0>(rk[k]));
+            ++nnz;
+          }
+          keys_.emplace_back(nnz-1, get<1>(rk[k]), get<2>(rk[k]));
+        }
+        rowptr_.push_back(nnz);
+        keyptr_.push_back(kend);
+        kstart = kend;
+      }
+      b.nnz = nnz;
+      size_ += nnz;
+    }
+    ++itarget_space;
+  }
+}
+
+
+void Flat_IJ::fill(const Block& b, const size_t rstart, const size_t rend, const double* mo2e_ij, double* values) const {
+  const uint32_t* rowptr = rowptr_.data() + b.row_offset;
+  const uint32_t* keyptr = keyptr_.data() + b.row_offset;
+  double* const data = values + b.data_offset;
+  std::fill(data + rowptr[rstart], data + rowptr[rend], 0.0);
+  for (const Key* k = keys_.data() + b.key_offset + keyptr[rstart], *kend = keys_.data() + b.key_offset + keyptr[rend]; k != kend; ++k)
+    data[k->pos] += static_cast<double>(k->sign) * mo2e_ij[k->offset];
+}
+
+
+void Flat_IJ::multiply(const Block& b, const size_t rstart, const size_t rend, const double* values, const size_t n,
+                       const double* bmat, const size_t ldb, double* cmat, const size_t ldc) const {
+  const uint32_t* rowptr = rowptr_.data() + b.row_offset;
+  const uint32_t* colind = colind_.data() + b.data_offset;
+  const double* data = values + b.data_offset;
+  // rows are processed in tiles so that the nonzero elements of a tile stay in cache while looping over the vectors
+  const size_t tile = 32;
+  for (size_t r0 = rstart; r0 < rend; r0 += tile) {
+    const size_t r1 = min(r0 + tile, rend);
+    for (size_t k = 0; k != n; ++k) {
+      const double* source = bmat + k*ldb;
+      double* target = cmat + k*ldc - rstart;
+      for (size_t r = r0; r != r1; ++r) {
+        double sum = 0.0;
+        for (uint32_t e = rowptr[r]; e != rowptr[r+1]; ++e)
+          sum += data[e] * source[colind[e]];
+        target[r] = sum;
+      }
+    }
+  }
+}
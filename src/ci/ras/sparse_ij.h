@@ -29,6 +29,7 @@
 #include <src/ci/ciutil/citraits.h>
 #include <src/ci/ras/civector.h>
 #include <src/util/math/sparsematrix.h>
+#include <cstdint>
 
 namespace bagel {
 
@@ -53,6 +54,61 @@ class Sparse_IJ {
     const std::vector<SparseIJKey>& sparse_data(const int target_tag, const int source_tag) const { return std::get<1>(data_.at({target_tag, source_tag})); }
 };
 
+/// Flattened version of Sparse_IJ. The sparsity patterns of all (target, source) blocks are stored in contiguous CSR arrays
+/// with 32-bit row pointers and column indices, and the blocks are addressed by the position of the string spaces in their
+/// CIStringSet. Only the pattern is stored, so that one object can be shared by all the sigma builds with the same determinants;
+/// the values are provided by the caller (see FormSigmaRAS::sigma_ab).
+class Flat_IJ {
+  public:
+    struct Block {
+      size_t data_offset; // offset of the first nonzero element of this block in the value array
+      size_t row_offset;  // offset of this block in rowptr_ and keyptr_ (nrow+1 entries each)
+      size_t key_offset;  // offset of this block in keys_
+      uint32_t nrow;
+      uint32_t ncol;
+      uint32_t nnz;
+    };
+
+    struct Key {
+      uint32_t pos;    // position of the element relative to data_offset
+      uint32_t offset; // offset of (ij|kl) relative to the (i0j0|00) element, i.e., norb*(k + norb*norb*l)
+      int sign;
+      Key(const uint32_t p, const uint32_t o, const int s) : pos(p), offset(o), sign(s) { }
+    };
+
+  protected:
+    size_t ntarget_;
+    size_t nsource_;
+    size_t size_;
+
+    std::vector<Block> blocks_;       // ntarget_*nsource_ blocks
+    std::vector<uint32_t> rowptr_;    // row pointers relative to the block
+    std::vector<uint32_t> colind_;    // column indices within the source space
+    std::vector<uint32_t> keyptr_;    // rows of keys_ relative to the block
+    std::vector<Key> keys_;
+
+    std::vector<size_t> target_tags_;
+    std::vector<size_t> source_tags_;
+
+  public:
+    Flat_IJ(std::shared_ptr<const CIStringSet<RASString>> source_stringspace, std::shared_ptr<const CIStringSet<RASString>> target_stringspace);
+
+    /// total number of nonzero elements, i.e., the length of the value array to be supplied
+    size_t size() const { return size_; }
+    size_t ntarget() const { return ntarget_; }
+    size_t nsource() const { return nsource_; }
+
+    size_t target_index(const RASString& space) const { return std::find(target_tags_.begin(), target_tags_.end(), space.tag()) - target_tags_.begin(); }
+    size_t source_index(const RASString& space) const { return std::find(source_tags_.begin(), source_tags_.end(), space.tag()) - source_tags_.begin(); }
+
+    const Block& block(const size_t itarget, const size_t isource) const { return blocks_[isource + nsource_*itarget]; }
+
+    /// fills rows [rstart, rend) of a block with F(beta',beta) = sum_kl sign (ij|kl)
+    void fill(const Block& b, const size_t rstart, const size_t rend, const double* mo2e_ij, double* values) const;
+    /// c(r-rstart, k) = sum_s F(r, s) b(s, k) for the rows [rstart, rend) of a block and k < n. Processes all the vectors at once.
+    void multiply(const Block& b, const size_t rstart, const size_t rend, const double* values, const size_t n, const double* bmat, const size_t ldb, double* cmat, const size_t ldc) const;
+};
+
 }
 
 #endif
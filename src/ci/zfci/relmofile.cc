@@ -352,7 +352,7 @@ unordered_map<bitset<4>, shared_ptr<const ZMatrix>> RelJop::compute_mo2e(const a
       half_complex[k] = DFock::make_half_complex(dfdists, rocoeff[k], iocoeff[k]);
 
     // (3) split and factorize
-    array<list<shared_ptr<RelDFHalf>>,2> half_complex_exch, half_complex_exch2;
+    array<list<shared_ptr<RelDFHalf>>,2> half_complex_exch;
     for (size_t k = 0; k != 2; ++k) {
       for (auto& i : half_complex[k]) {
         list<shared_ptr<RelDFHalf>> tmp = i->split(/*docopy=*/false);
@@ -369,8 +369,12 @@ unordered_map<bitset<4>, shared_ptr<const ZMatrix>> RelJop::compute_mo2e(const a
       half_complex_gaunt_ = half_complex_exch;
     }
 
-    if (breit) {
-      // TODO Not the best implementation -- one could avoid apply_J to half-transformed objects
+    // (4) compute (gamma|ii)
+    unordered_map<bitset<2>, shared_ptr<const RelDFFull>> full, full2;
+    if (!breit) {
+      full = compute_full(rocoeff, iocoeff, half_complex_exch, true);
+      full2 = full;
+    } else {
       auto breitint = make_shared<BreitInt>(geom_);
       list<shared_ptr<Breit2Index>> breit_2index;
       for (int i = 0; i != breitint->Nblocks(); ++i) {
@@ -378,23 +382,9 @@ unordered_map<bitset<4>, shared_ptr<const ZMatrix>> RelJop::compute_mo2e(const a
         if (breitint->not_diagonal(i))
           breit_2index.push_back(breit_2index.back()->cross());
       }
-      for (size_t k = 0; k != 2; ++k) {
-        for (auto& i : half_complex_exch[k])
-          half_complex_exch2[k].push_back(i->apply_J());
-
-        for (auto& i : half_complex_exch[k])
-          for (auto& j : breit_2index)
-            if (i->alpha_matches(j)) {
-              half_complex_exch2[k].push_back(i->apply_J()->multiply_breit2index(j));
-              DFock::factorize(half_complex_exch2[k]);
-            }
-      }
+      tie(full, full2) = compute_full_breit(rocoeff, iocoeff, half_complex_exch, breit_2index);
     }
 
-    // (4) compute (gamma|ii)
-    unordered_map<bitset<2>, shared_ptr<const RelDFFull>> full = compute_full(rocoeff, iocoeff, half_complex_exch, true);
-    unordered_map<bitset<2>, shared_ptr<const RelDFFull>> full2 = !breit ? full : compute_full(rocoeff, iocoeff, half_complex_exch2, false);
-
     // (5) compute 4-index quantities (16 of them - we are not using symmetry... and this is a very cheap step)
     const double gscale = gaunt ? (breit ? -0.5 : -1.0) : 1.0;
     for (size_t i = 0; i != 16; ++i) {
@@ -527,6 +517,51 @@ unordered_map<bitset<2>, shared_ptr<const RelDFFull>>
 }
 
 
+pair<unordered_map<bitset<2>, shared_ptr<const RelDFFull>>, unordered_map<bitset<2>, shared_ptr<const RelDFFull>>>
+  RelMOFile::compute_full_breit(array<array<shared_ptr<const Matrix>,4>,2> rocoeff, array<array<shared_ptr<const Matrix>,4>,2> iocoeff,
+                                array<list<shared_ptr<RelDFHalf>>,2> half, list<shared_ptr<Breit2Index>> breit_2index) {
+  unordered_map<bitset<2>, shared_ptr<const RelDFFull>> out, outb;
+
+  // see compute_full; otherwise the metric is applied to the half-transformed integrals
+  const bool transform_with_full = !(half[0].front()->nocc()*rocoeff[0][0]->mdim() <= mpi__->size());
+
+  auto merge = [](list<shared_ptr<RelDFFull>>& dffull) {
+    DFock::factorize(dffull);
+    assert(dffull.size() == 1);
+    dffull.front()->scale(dffull.front()->fac()); // take care of the factor
+    return dffull.front();
+  };
+
+  for (size_t t = 0; t != 4; ++t) {
+    list<shared_ptr<RelDFFull>> dffull, dffullb;
+    for (auto& i : half[t/2]) {
+      shared_ptr<RelDFFull> full;
+      if (transform_with_full) {
+        full = make_shared<RelDFFull>(i, rocoeff[t%2], iocoeff[t%2])->apply_J();
+        for (auto& j : breit_2index)
+          if (full->alpha_matches(j))
+            dffullb.push_back(full->multiply_breit2index(j));
+      } else {
+        shared_ptr<const RelDFHalf> h = i->apply_J();
+        full = make_shared<RelDFFull>(h, rocoeff[t%2], iocoeff[t%2]);
+        for (auto& j : breit_2index)
+          if (h->alpha_matches(j))
+            dffullb.push_back(make_shared<RelDFFull>(h->multiply_breit2index(j), rocoeff[t%2], iocoeff[t%2]));
+      }
+      dffull.push_back(move(full));
+    }
+    // the Breit-side integrals also contain the Coulomb-metric ones. They are added before dffull is merged,
+    // because factorize accumulates into its first element.
+    shared_ptr<RelDFFull> breit = merge(dffullb);
+    for (auto& i : dffull)
+      breit->ax_plus_y(i->fac(), i);
+    outb[bitset<2>(t)] = breit;
+    out[bitset<2>(t)] = merge(dffull);
+  }
+  return make_pair(out, outb);
+}
+
+
 void RelMOFile::rearrange_eig(VectorB& eig, shared_ptr<ZMatrix> coeff, const bool includes_neg) {
   const int n = coeff->ndim()/2;
   assert(2*n == coeff->ndim());  // could be triggered if Kramers + and - sets had different sizes or linear dependencies
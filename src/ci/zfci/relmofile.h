@@ -110,6 +110,11 @@ class RelMOFile {
     static std::unordered_map<std::bitset<2>, std::shared_ptr<const RelDFFull>>
         compute_full(std::array<std::array<std::shared_ptr<const Matrix>,4>,2> rocoeff, std::array<std::array<std::shared_ptr<const Matrix>,4>,2> iocoeff,
                      std::array<std::list<std::shared_ptr<RelDFHalf>>,2> half, const bool appj, const bool appjj = false);
+    // returns the same as compute_full(.., appj = true) together with its Breit counterpart. The metric and Breit 2-index integrals
+    // are applied after the second transformation, so that no copies of the half-transformed integrals are made.
+    static std::pair<std::unordered_map<std::bitset<2>, std::shared_ptr<const RelDFFull>>, std::unordered_map<std::bitset<2>, std::shared_ptr<const RelDFFull>>>
+        compute_full_breit(std::array<std::array<std::shared_ptr<const Matrix>,4>,2> rocoeff, std::array<std::array<std::shared_ptr<const Matrix>,4>,2> iocoeff,
+                           std::array<std::list<std::shared_ptr<RelDFHalf>>,2> half, std::list<std::shared_ptr<Breit2Index>> breit_2index);
 };
 
 
@@ -0,0 +1,266 @@
+//
+// BAGEL - Parallel electron correlation program.
+// Filename: cholesky.cc
+// Copyright (C) 2026 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// The BAGEL package is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 3, or (at your option)
+// any later version.
+//
+// The BAGEL package is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the BAGEL package; see COPYING.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+
+
+#include <src/df/cholesky.h>
+#include <src/util/f77.h>
+#include <src/util/taskqueue.h>
+#include <src/integral/rys/eribatch.h>
+#include <src/integral/libint/libint.h>
+
+using namespace std;
+using namespace bagel;
+
+namespace {
+  // once a shell pair is chosen, its functions are taken as pivots as long as
+  // their residual diagonal is larger than this fraction of the current maximum
+  const double span__ = 1.0e-2;
+
+  shared_ptr<RysInt> eri(array<shared_ptr<const Shell>,4>&& input) {
+#ifdef LIBINT_INTERFACE
+    shared_ptr<RysInt> eribatch = make_shared<Libint>(input);
+#else
+    shared_ptr<RysInt> eribatch = make_shared<ERIBatch>(input, 2.0);
+#endif
+    eribatch->compute();
+    return eribatch;
+  }
+}
+
+
+CholeskyERI::CholeskyERI(const vector<shared_ptr<const Atom>>& atoms, const double thresh) : thresh_(thresh), nbasis_(0), nrow_(0), nvec_(0) {
+  for (auto& i : atoms)
+    for (auto& j : i->shells()) {
+      shells_.push_back(j);
+      offsets_.push_back(nbasis_);
+      nbasis_ += j->nbasis();
+    }
+
+  Timer time;
+  compute_diagonal();
+  time.tick_print("Cholesky diagonal");
+
+  decompose();
+  time.tick_print("Cholesky vectors");
+
+  cout << "    o Cholesky decomposition of ERIs (threshold " << setprecision(1) << scientific << thresh_ << fixed << "): "
+       << nvec_ << " vectors for " << nrow_ << " significant basis function pairs" << endl;
+}
+
+
+void CholeskyERI::compute_diagonal() {
+  const int nshell = shells_.size();
+  for (int m = 0; m != nshell; ++m)
+    for (int n = 0; n <= m; ++n)
+      pairs_.emplace_back(m, n);
+
+  rowoffsets_.push_back(0);
+  for (auto& p : pairs_)
+    rowoffsets_.push_back(rowoffsets_.back() + pair_size(p.first, p.second));
+
+  // (mn|mn) for all the shell pairs, distributed over the nodes
+  vector<double> diagonal(rowoffsets_.back());
+  TaskQueue<function<void(void)>> tasks(pairs_.size());
+  for (size_t ip = 0; ip != pairs_.size(); ++ip) {
+    if (ip % mpi__->size() != mpi__->rank()) continue;
+    tasks.emplace_back(
+      [this, ip, &diagonal]() {
+        const int m = pairs_[ip].first;
+        const int n = pairs_[ip].second;
+        shared_ptr<RysInt> batch = eri({{shells_[m], shells_[n], shells_[m], shells_[n]}});
+        const double* data = batch->data();
+        const int nm = shells_[m]->nbasis();
+        const int nn = shells_[n]->nbasis();
+        for (int in = 0; in != nn; ++in)
+          for (int im = 0; im != nm; ++im) {
+            const long r = local_index(m, n, im, in);
+            if (r >= 0)
+              diagonal[rowoffsets_[ip] + r] = data[(im + nm*in) * (1 + nm*nn)];
+          }
+      }
+    );
+  }
+  tasks.compute();
+  if (mpi__->size() > 1)
+    mpi__->allreduce(diagonal.data(), diagonal.size());
+
+  // shell pairs whose (mn|ls) cannot exceed the threshold for any ls are discarded from the outset
+  vector<double> pairmax(pairs_.size());
+  for (size_t ip = 0; ip != pairs_.size(); ++ip)
+    pairmax[ip] = *max_element(diagonal.begin()+rowoffsets_[ip], diagonal.begin()+rowoffsets_[ip+1]);
+  const double dmax = *max_element(pairmax.begin(), pairmax.end());
+
+  vector<pair<int,int>> pairs;
+  vector<size_t> rowoffsets(1, 0);
+  for (size_t ip = 0; ip != pairs_.size(); ++ip) {
+    if (pairmax[ip]*dmax < thresh_*thresh_) continue;
+    pairs.push_back(pairs_[ip]);
+    rowoffsets.push_back(rowoffsets.back() + pair_size(pairs_[ip].first, pairs_[ip].second));
+    diagonal_.insert(diagonal_.end(), diagonal.begin()+rowoffsets_[ip], diagonal.begin()+rowoffsets_[ip+1]);
+  }
+  pairs_ = move(pairs);
+  rowoffsets_ = move(rowoffsets);
+  nrow_ = rowoffsets_.back();
+}
+
+
+vector<double> CholeskyERI::compute_columns(const size_t pq) const {
+  const int p = pairs_[pq].first;
+  const int q = pairs_[pq].second;
+  const int np = shells_[p]->nbasis();
+  const int nq = shells_[q]->nbasis();
+  const size_t ncol = rowoffsets_[pq+1] - rowoffsets_[pq];
+
+  vector<double> out(nrow_*ncol, 0.0);
+  TaskQueue<function<void(void)>> tasks(pairs_.size());
+  for (size_t mn = 0; mn != pairs_.size(); ++mn) {
+    if (mn % mpi__->size() != mpi__->rank()) continue;
+    tasks.emplace_back(
+      [this, mn, p, q, np, nq, &out]() {
+        const int m = pairs_[mn].first;
+        const int n = pairs_[mn].second;
+        const int nm = shells_[m]->nbasis();
+        const int nn = shells_[n]->nbasis();
+        shared_ptr<RysInt> batch = eri({{shells_[m], shells_[n], shells_[p], shells_[q]}});
+        const double* data = batch->data();
+        for (int iq = 0; iq != nq; ++iq)
+          for (int ip = 0; ip != np; ++ip) {
+            const long c = local_index(p, q, ip, iq);
+            if (c < 0) {
+              data += nm*nn;
+              continue;
+            }
+            double* const target = out.data() + rowoffsets_[mn] + nrow_*c;
+            for (int in = 0; in != nn; ++in)
+              for (int im = 0; im != nm; ++im, ++data) {
+                const long r = local_index(m, n, im, in);
+                if (r >= 0)
+                  target[r] = *data;
+              }
+          }
+      }
+    );
+  }
+  tasks.compute();
+  if (mpi__->size() > 1)
+    mpi__->allreduce(out.data(), out.size());
+  return out;
+}
+
+
+void CholeskyERI::decompose() {
+  while (true) {
+    // shell pair that has the largest residual diagonal
+    size_t ip = 0;
+    double dmax = 0.0;
+    for (size_t i = 0; i != pairs_.size(); ++i) {
+      const double d = *max_element(diagonal_.begin()+rowoffsets_[i], diagonal_.begin()+rowoffsets_[i+1]);
+      if (d > dmax) {
+        dmax = d;
+        ip = i;
+      }
+    }
+    if (dmax < thresh_)
+      break;
+
+    const size_t offset = rowoffsets_[ip];
+    const size_t ncol = rowoffsets_[ip+1] - offset;
+    vector<double> columns = compute_columns(ip);
+
+    // subtract the contribution of the vectors obtained so far
+    if (nvec_) {
+      vector<double> lpq(ncol*nvec_);
+      for (size_t k = 0; k != nvec_; ++k)
+        copy_n(vectors_.data()+offset+nrow_*k, ncol, lpq.data()+ncol*k);
+      dgemm_("N", "T", nrow_, ncol, nvec_, -1.0, vectors_.data(), nrow_, lpq.data(), ncol, 1.0, columns.data(), nrow_);
+    }
+
+    // pivots within this shell pair
+    const double dmin = max(thresh_, span__*dmax);
+    vector<bool> done(ncol, false);
+    while (true) {
+      size_t c = 0;
+      double dc = 0.0;
+      for (size_t i = 0; i != ncol; ++i)
+        if (!done[i] && diagonal_[offset+i] > dc) {
+          dc = diagonal_[offset+i];
+          c = i;
+        }
+      if (dc < dmin)
+        break;
+      done[c] = true;
+
+      vectors_.resize(nrow_*(nvec_+1));
+      double* const lk = vectors_.data() + nrow_*nvec_++;
+      const double* const column = columns.data() + nrow_*c;
+      const double fac = 1.0 / sqrt(dc);
+      for (size_t r = 0; r != nrow_; ++r) {
+        lk[r] = column[r] * fac;
+        diagonal_[r] = max(0.0, diagonal_[r] - lk[r]*lk[r]);
+      }
+      for (size_t i = 0; i != ncol; ++i)
+        if (!done[i])
+          blas::ax_plus_y_n(-lk[offset+i], lk, nrow_, columns.data()+nrow_*i);
+    }
+  }
+}
+
+
+shared_ptr<DFDist> CholeskyERI::df() const {
+  // Cholesky vectors are distributed in contiguous ranges, as auxiliary functions are
+  auto adist = make_shared<const StaticDist>(nvec_, mpi__->size());
+  const size_t astart = adist->start(mpi__->rank());
+  const size_t asize = adist->size(mpi__->rank());
+
+  auto block = make_shared<DFBlock>(adist, adist, asize, nbasis_, nbasis_, astart, 0, 0);
+  block->zero();
+
+  TaskQueue<function<void(void)>> tasks(pairs_.size());
+  for (size_t ip = 0; ip != pairs_.size(); ++ip) {
+    tasks.emplace_back(
+      [this, ip, astart, asize, &block]() {
+        const int m = pairs_[ip].first;
+        const int n = pairs_[ip].second;
+        for (int in = 0; in != shells_[n]->nbasis(); ++in)
+          for (int im = 0; im != shells_[m]->nbasis(); ++im) {
+            const long r = local_index(m, n, im, in);
+            if (r < 0) continue;
+            const size_t mu = offsets_[m] + im;
+            const size_t nu = offsets_[n] + in;
+            double* const mn = block->data() + asize*(mu + nbasis_*nu);
+            double* const nm = block->data() + asize*(nu + nbasis_*mu);
+            for (size_t k = 0; k != asize; ++k)
+              mn[k] = nm[k] = vectors_[rowoffsets_[ip] + r + nrow_*(astart+k)];
+          }
+      }
+    );
+  }
+  tasks.compute();
+
+  // the metric is the unit matrix
+  auto data2 = make_shared<Matrix>(nvec_, nvec_, true);
+  data2->unit();
+  return make_shared<DFDist>(nbasis_, nvec_, block, nullptr, data2);
+}
@@ -0,0 +1,86 @@
+//
+// BAGEL - Parallel electron correlation program.
+// Filename: cholesky.h
+// Copyright (C) 2026 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// The BAGEL package is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 3, or (at your option)
+// any later version.
+//
+// The BAGEL package is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the BAGEL package; see COPYING.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+
+#ifndef __SRC_DF_CHOLESKY_H
+#define __SRC_DF_CHOLESKY_H
+
+#include <src/df/df.h>
+
+namespace bagel {
+
+// Pivoted Cholesky decomposition of the AO two-electron integrals, (mn|ls) = sum_K L^K_mn L^K_ls,
+// carried out shell pair by shell pair until the largest residual diagonal falls below the threshold.
+// The Cholesky vectors take the place of the fitted three-index integrals; df() returns them as a DFDist
+// whose two-index metric is the unit matrix, so that all DF-based methods run unchanged without an auxiliary basis.
+class CholeskyERI {
+  protected:
+    const double thresh_;
+    size_t nbasis_;
+
+    std::vector<std::shared_ptr<const Shell>> shells_;
+    std::vector<int> offsets_;
+
+    // shell pairs (M >= N) that survive the initial screening, and the offset of their rows.
+    // Within a pair, basis function pairs are ordered as local_index() below.
+    std::vector<std::pair<int,int>> pairs_;
+    std::vector<size_t> rowoffsets_;
+    size_t nrow_;
+
+    // residual diagonal and the Cholesky vectors (nrow_ x nvec_, column major).
+    // Every pivot updates all rows, so vectors_ is replicated on each rank during the decomposition:
+    // the peak memory per rank is 8*nrow_*nvec_ bytes (roughly 4*nbasis^2*nvec), i.e. about twice the
+    // fully distributed DFDist returned by df(). This limits the decomposition to systems whose
+    // Cholesky vectors fit on a single node; the object is discarded once df() has been formed.
+    std::vector<double> diagonal_;
+    std::vector<double> vectors_;
+    size_t nvec_;
+
+    size_t pair_size(const int m, const int n) const {
+      const size_t nm = shells_[m]->nbasis();
+      return m == n ? nm*(nm+1)/2 : nm*shells_[n]->nbasis();
+    }
+    // returns -1 for the redundant half of a diagonal shell pair
+    long local_index(const int m, const int n, const int im, const int in) const {
+      if (m != n) return im + shells_[m]->nbasis()*in;
+      return im >= in ? im*(im+1)/2 + in : -1;
+    }
+
+    void compute_diagonal();
+    // (mn|pq) for every surviving pair mn and every unique function pair in shell pair pq; rows x columns, column major
+    std::vector<double> compute_columns(const size_t pq) const;
+    void decompose();
+
+  public:
+    CholeskyERI(const std::vector<std::shared_ptr<const Atom>>& atoms, const double thresh);
+
+    size_t nvec() const { return nvec_; }
+    size_t nbasis() const { return nbasis_; }
+
+    std::shared_ptr<DFDist> df() const;
+};
+
+}
+
+#endif
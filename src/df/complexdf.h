@@ -123,7 +123,7 @@ class ComplexDFDist_ints : public ComplexDFDist {
       // distribute auxiliary shells to each nodes
       int astart;
       std::vector<std::shared_ptr<const Shell>> myashell;
-      std::tie(astart, myashell) = get_ashell(ashell);
+      std::tie(astart, myashell) = get_ashell(ashell, b1shell, b2shell);
 
       std::shared_ptr<const StaticDist> adist_shell = make_table(astart);
       std::shared_ptr<const StaticDist> adist_averaged = std::make_shared<const StaticDist>(naux_, mpi__->size());
@@ -25,6 +25,7 @@
 
 
 #include <src/df/df.h>
+#include <src/df/dfcost.h>
 #include <src/df/dfdistt.h>
 #include <src/integral/rys/eribatch.h>
 #include <src/integral/libint/libint.h>
@@ -63,22 +64,24 @@ void DFDist::add_direct_product(const vector<shared_ptr<const VectorB>> cd, cons
 }
 
 
-tuple<int, vector<shared_ptr<const Shell>>> DFDist::get_ashell(const vector<shared_ptr<const Shell>>& all) {
+tuple<int, vector<shared_ptr<const Shell>>> DFDist::get_ashell(const vector<shared_ptr<const Shell>>& all,
+                                                               const vector<shared_ptr<const Shell>>& b1shell, const vector<shared_ptr<const Shell>>& b2shell) {
   int out1;
   vector<shared_ptr<const Shell>> out2;
   // TODO without *2, H does not work. Perhaps need to think a bit more
   if (mpi__->size()*2 < all.size()) {
-    int start, end;
-    StaticDist d(naux_, mpi__->size());
-    tie(start, end) = d.range(mpi__->rank());
-    int num = 0;
-    for (auto& s : all) {
-      if (num >= start && num < end) {
-        if (out2.empty()) out1 = num;
-        out2.push_back(s);
-      }
-      num += s->nbasis();
-    }
+    // shells with high angular momenta or deep contractions are much more expensive than their size suggests
+    const DFCostModel model(b1shell, b2shell);
+    vector<double> cost;
+    cost.reserve(all.size());
+    for (auto& s : all)
+      cost.push_back(model.aux_cost(*s));
+    const vector<size_t> bound = DFCostModel::partition(cost, mpi__->size());
+
+    out1 = 0;
+    for (size_t i = 0; i != bound[mpi__->rank()]; ++i)
+      out1 += all[i]->nbasis();
+    out2.insert(out2.end(), all.begin()+bound[mpi__->rank()], all.begin()+bound[mpi__->rank()+1]);
   } else {
     cout << endl << "   *** Warning *** Since the number of auxiliary shells is too small, we do not parallelize the Fock builder." << endl << endl;
     out1 = 0;
@@ -99,18 +102,24 @@ void DFDist::compute_2index(const vector<shared_ptr<const Shell>>& ashell, const
   data2_ = make_shared<Matrix>(naux_, naux_, serial_);
   auto b3 = make_shared<const Shell>(ashell.front()->spherical());
 
-  // naive static distribution
-  int u = 0;
+  // shell pairs are distributed according to their estimated cost, most expensive first
+  vector<tuple<size_t, size_t, int, int>> pairs;
+  vector<double> cost;
+  pairs.reserve(ashell.size()*(ashell.size()+1)/2);
+  cost.reserve(ashell.size()*(ashell.size()+1)/2);
   int o0 = 0;
-  for (auto& b0 : ashell) {
-    int o1 = 0;
-    for (auto& b1 : ashell) {
-      if (o0 <= o1 && ((u++ % mpi__->size() == mpi__->rank()) || serial_))
-        tasks.emplace_back(array<shared_ptr<const Shell>,4>{{b1, b3, b0, b3}}, array<int,2>{{o0, o1}}, this);
-      o1 += b1->nbasis();
+  for (size_t i0 = 0; i0 != ashell.size(); o0 += ashell[i0++]->nbasis()) {
+    int o1 = o0;
+    for (size_t i1 = i0; i1 != ashell.size(); o1 += ashell[i1++]->nbasis()) {
+      pairs.emplace_back(i0, i1, o0, o1);
+      cost.push_back(DFCostModel::estimate(*ashell[i1], *ashell[i0]));
     }
-    o0 += b0->nbasis();
   }
+  const vector<int> owner = serial_ ? vector<int>(cost.size(), mpi__->rank()) : DFCostModel::assign(cost, mpi__->size());
+  for (auto& i : DFCostModel::order(cost))
+    if (owner[i] == mpi__->rank())
+      tasks.emplace_back(array<shared_ptr<const Shell>,4>{{ashell[get<1>(pairs[i])], b3, ashell[get<0>(pairs[i])], b3}},
+                         array<int,2>{{get<2>(pairs[i]), get<3>(pairs[i])}}, this);
 
   // these shell loops will be distributed across threads
   tasks.compute();
@@ -263,6 +272,15 @@ shared_ptr<DFHalfDist> DFFullDist::back_transform(const MatView c) const {
 }
 
 
+shared_ptr<DFFullDist> DFFullDist::back_transform_first(const vector<MatView>& c) const {
+  assert(!c.empty() && c.front().extent(0) == df_->nindex1());
+  auto out = make_shared<DFFullDist>(df_, c.front().extent(0), nindex2_*c.size());
+  for (auto& i : block_)
+    out->add_block(i->transform_second(c, true));
+  return out;
+}
+
+
 // 2RDM contractions
 shared_ptr<DFFullDist> DFFullDist::apply_closed_2RDM(const double scale_exch) const {
   auto out = make_shared<DFFullDist>(df_, nindex1_, nindex2_);
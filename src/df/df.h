@@ -43,7 +43,10 @@ class DFDist : public ParallelDF {
     // compute 2-index integrals ERI
     void compute_2index(const std::vector<std::shared_ptr<const Shell>>&, const double thresh, const bool compute_inv);
 
-    std::tuple<int, std::vector<std::shared_ptr<const Shell>>> get_ashell(const std::vector<std::shared_ptr<const Shell>>& all);
+    // auxiliary shells are assigned in contiguous ranges of nearly equal integral cost
+    std::tuple<int, std::vector<std::shared_ptr<const Shell>>> get_ashell(const std::vector<std::shared_ptr<const Shell>>& all,
+                                                                          const std::vector<std::shared_ptr<const Shell>>& b1shell,
+                                                                          const std::vector<std::shared_ptr<const Shell>>& b2shell);
 
   public:
     DFDist(const int nbas, const int naux, const std::shared_ptr<DFBlock> block = nullptr, std::shared_ptr<const ParallelDF> df = nullptr, std::shared_ptr<Matrix> data2 = nullptr)
@@ -141,7 +144,7 @@ class DFDist_ints : public DFDist {
       // distribute auxiliary shells to each nodes
       int astart;
       std::vector<std::shared_ptr<const Shell>> myashell;
-      std::tie(astart, myashell) = get_ashell(ashell);
+      std::tie(astart, myashell) = get_ashell(ashell, b1shell, b2shell);
 
       std::shared_ptr<const StaticDist> adist_shell = make_table(astart);
       std::shared_ptr<const StaticDist> adist_averaged = std::make_shared<const StaticDist>(naux_, mpi__->size());
@@ -205,9 +208,6 @@ class DFHalfDist : public ParallelDF {
 
 
 class DFFullDist : public ParallelDF {
-  protected:
-    std::shared_ptr<DFFullDist> apply_J(const std::shared_ptr<const Matrix> o) const;
-
   public:
     DFFullDist(const std::shared_ptr<const ParallelDF> df, const int nocc1, const int nocc2) : ParallelDF(df->naux(), nocc1, nocc2, df) { }
 
@@ -220,6 +220,8 @@ class DFFullDist : public ParallelDF {
     std::shared_ptr<DFHalfDist> back_transform(const MatView c) const;
     template<typename T, class = typename std::enable_if<btas::is_boxtensor<T>::value>::type>
     std::shared_ptr<DFHalfDist> back_transform(std::shared_ptr<T> c) const { return back_transform(*c); }
+    // back transforms the first index with each of c; results are stacked along the second index, i.e., (D|r,j c)
+    std::shared_ptr<DFFullDist> back_transform_first(const std::vector<MatView>& c) const;
 
     void rotate_occ1(const std::shared_ptr<const Matrix> d);
 
@@ -242,6 +244,7 @@ class DFFullDist : public ParallelDF {
     std::shared_ptr<DFFullDist> apply_JJ() const { return apply_J(std::make_shared<Matrix>(*df_->data2()**df_->data2())); }
     std::shared_ptr<DFFullDist> apply_J(const std::shared_ptr<const ParallelDF> d) const { return apply_J(d->data2()); }
     std::shared_ptr<DFFullDist> apply_JJ(const std::shared_ptr<const ParallelDF> d) const { return apply_J(std::make_shared<Matrix>(*d->data2()**d->data2())); }
+    std::shared_ptr<DFFullDist> apply_J(const std::shared_ptr<const Matrix> o) const;
 
     std::shared_ptr<DFFullDist> swap() const;
 };
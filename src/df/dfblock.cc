@@ -91,6 +91,22 @@ shared_ptr<DFBlock> DFBlock::transform_third(const MatView cmat, const bool tran
 }
 
 
+shared_ptr<DFBlock> DFBlock::transform_second(const vector<MatView>& cmat, const bool trans) const {
+  assert(!cmat.empty());
+  const int nocc = trans ? cmat.front().extent(0) : cmat.front().extent(1);
+  auto out = make_shared<DFBlock>(adist_shell_, adist_, asize(), nocc, b2size()*cmat.size(), astart_, 0, b2start_, averaged_);
+
+  // b2 runs slowest, so each transformed block is a contiguous slice of out
+  double* target = out->data();
+  for (auto& c : cmat) {
+    shared_ptr<const DFBlock> tmp = transform_second(c, trans);
+    assert(tmp->b1size() == nocc);
+    target = copy_n(tmp->data(), tmp->size(), target);
+  }
+  return out;
+}
+
+
 shared_ptr<DFBlock> DFBlock::clone() const {
   auto out = make_shared<DFBlock>(adist_shell_, adist_, asize(), b1size(), b2size(), astart_, b1start_, b2start_, averaged_);
   out->zero();
@@ -232,12 +248,24 @@ shared_ptr<DFBlock> DFBlock::apply_2RDM(const Tensor4<double>& rdm, const Tensor
         daxpy_(asize(), -rdm1(i, i), data()+asize()*(i+nclosed+b1size()*j), 1, out->data()+asize()*(i+nclosed+b1size()*j), 1);
       }
   } else {
-    for (int i0 = 0; i0 != nact; ++i0)
-      for (int i1 = 0; i1 != nact; ++i1)
-        for (int j = 0; j != nclosed; ++j) { // TODO be careful when rdm1 is not symmetric (e.g., transition density matrices)
-          daxpy_(asize(), -rdm1(i1, i0), data()+asize()*(j+b1size()*(i0+nclosed)), 1, out->data()+asize()*(j+b1size()*(i1+nclosed)), 1);
-          daxpy_(asize(), -rdm1(i1, i0), data()+asize()*(i0+nclosed+b1size()*j), 1, out->data()+asize()*(i1+nclosed+b1size()*j), 1);
-        }
+    // TODO be careful when rdm1 is not symmetric (e.g., transition density matrices)
+    // closed-act and act-closed blocks are compressed and rotated by rdm1 with one GEMM each
+    auto clow = {0, 0, nclosed};
+    auto cup  = {static_cast<int>(asize()), nclosed, nclosed+nact};
+    auto alow = {0, nclosed, 0};
+    auto aup  = {static_cast<int>(asize()), nclosed+nact, nclosed};
+    const Tensor3<double> ca = make_view(range().slice(clow, cup), storage());
+    const Tensor3<double> ac = make_view(range().slice(alow, aup), storage());
+    Tensor3<double> ca2(asize(), nclosed, nact);
+    Tensor3<double> ac2(asize(), nact, nclosed);
+    contract(-1.0, ca, {0,1,2}, rdm1, {3,2}, 0.0, ca2, {0,1,3});
+    contract(-1.0, ac, {0,1,2}, rdm1, {3,1}, 0.0, ac2, {0,3,2});
+    // slot in
+    for (int i = 0; i != nact; ++i)
+      for (int j = 0; j != nclosed; ++j) {
+        daxpy_(asize(), 1.0, ca2.data()+asize()*(j+nclosed*i), 1, out->data()+asize()*(j+b1size()*(i+nclosed)), 1);
+        daxpy_(asize(), 1.0, ac2.data()+asize()*(i+nact*j), 1, out->data()+asize()*(i+nclosed+b1size()*j), 1);
+      }
   }
   return out;
 }
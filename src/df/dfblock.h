@@ -163,6 +163,8 @@ class DFBlock : public btas::Tensor3<double> {
 
     std::shared_ptr<DFBlock> transform_second(const MatView c, const bool trans = false) const;
     std::shared_ptr<DFBlock> transform_third(const MatView c, const bool trans = false) const;
+    // transforms the second index with each of c and stacks the results along the third index
+    std::shared_ptr<DFBlock> transform_second(const std::vector<MatView>& c, const bool trans = false) const;
 
     // add ab^+  to this.
     void add_direct_product(const std::shared_ptr<const VectorB> a, const std::shared_ptr<const Matrix> b, const double fac);
@@ -0,0 +1,117 @@
+//
+// BAGEL - Parallel electron correlation program.
+// Filename: dfcost.cc
+// Copyright (C) 2026 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// The BAGEL package is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 3, or (at your option)
+// any later version.
+//
+// The BAGEL package is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the BAGEL package; see COPYING.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+
+
+#include <cassert>
+#include <numeric>
+#include <algorithm>
+#include <src/df/dfcost.h>
+
+using namespace std;
+using namespace bagel;
+
+
+DFCostModel::DFCostModel(const vector<shared_ptr<const Shell>>& b1shell, const vector<shared_ptr<const Shell>>& b2shell) {
+  // shells with the same angular number and contraction depth cost the same; count them instead of looping over pairs
+  map<array<int,2>, size_t> c1, c2;
+  for (auto& i : b1shell)
+    if (!i->dummy()) ++c1[array<int,2>{{i->angular_number(), i->num_primitive()}}];
+  for (auto& i : b2shell)
+    if (!i->dummy()) ++c2[array<int,2>{{i->angular_number(), i->num_primitive()}}];
+
+  for (auto& i : c1)
+    for (auto& j : c2)
+      pairs_[array<int,4>{{i.first[0], i.first[1], j.first[0], j.first[1]}}] += i.second * j.second;
+}
+
+
+double DFCostModel::estimate(const int la, const int pa, const int lb, const int pb, const int lc, const int pc) {
+  auto ncart = [](const int l) { return (l+1)*(l+2)/2; };
+  // number of Rys roots times the size of the Cartesian batch, plus a fixed cost per primitive set (screening, root evaluation)
+  const int rank = (la + lb + lc)/2 + 1;
+  const double prim = static_cast<double>(pa) * pb * pc;
+  return prim * (rank * ncart(la) * ncart(lb) * ncart(lc) + 20.0);
+}
+
+
+double DFCostModel::estimate(const Shell& a, const Shell& b, const Shell& c) {
+  return estimate(a.angular_number(), a.num_primitive(), b.angular_number(), b.num_primitive(), c.angular_number(), c.num_primitive());
+}
+
+
+double DFCostModel::estimate(const Shell& a, const Shell& c) {
+  return estimate(a.angular_number(), a.num_primitive(), 0, 1, c.angular_number(), c.num_primitive());
+}
+
+
+double DFCostModel::aux_cost(const Shell& c) const {
+  double out = 0.0;
+  for (auto& i : pairs_)
+    out += i.second * estimate(i.first[0], i.first[1], i.first[2], i.first[3], c.angular_number(), c.num_primitive());
+  return out;
+}
+
+
+vector<size_t> DFCostModel::partition(const vector<double>& cost, const size_t np) {
+  const size_t n = cost.size();
+  assert(n >= np && np > 0);
+  vector<double> accum(n+1, 0.0);
+  partial_sum(cost.begin(), cost.end(), accum.begin()+1);
+
+  vector<size_t> out(np+1, 0);
+  out[np] = n;
+  for (size_t i = 1; i != np; ++i) {
+    // first item whose preceding cost reaches the i-th target
+    const double target = accum[n] * i / np;
+    size_t bound = lower_bound(accum.begin(), accum.end(), target) - accum.begin();
+    // pick the nearer side of the target
+    if (bound > 0 && target - accum[bound-1] < accum[bound] - target)
+      --bound;
+    // every process gets at least one item
+    out[i] = min(max(bound, out[i-1]+1), n-(np-i));
+  }
+  return out;
+}
+
+
+vector<int> DFCostModel::assign(const vector<double>& cost, const size_t np) {
+  vector<int> out(cost.size());
+  vector<double> load(np, 0.0);
+  for (auto& i : order(cost)) {
+    const int p = min_element(load.begin(), load.end()) - load.begin();
+    out[i] = p;
+    load[p] += cost[i];
+  }
+  return out;
+}
+
+
+vector<size_t> DFCostModel::order(const vector<double>& cost) {
+  vector<size_t> out(cost.size());
+  iota(out.begin(), out.end(), 0);
+  // stable so that every process arrives at the same order
+  stable_sort(out.begin(), out.end(), [&cost](const size_t& i, const size_t& j) { return cost[i] > cost[j]; });
+  return out;
+}
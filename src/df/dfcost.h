@@ -0,0 +1,67 @@
+//
+// BAGEL - Parallel electron correlation program.
+// Filename: dfcost.h
+// Copyright (C) 2026 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// The BAGEL package is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 3, or (at your option)
+// any later version.
+//
+// The BAGEL package is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the BAGEL package; see COPYING.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+
+#ifndef __SRC_DF_DFCOST_H
+#define __SRC_DF_DFCOST_H
+
+#include <map>
+#include <array>
+#include <vector>
+#include <memory>
+#include <src/molecule/shell.h>
+
+namespace bagel {
+
+// Relative cost of integral batches, used to balance the distribution of shells among processes.
+// Estimates are in arbitrary units and only meaningful relative to each other. Since they depend
+// on the basis sets alone, every process arrives at the same distribution without communication.
+class DFCostModel {
+  protected:
+    // basis-function shell pairs grouped by (angular number, number of primitives) of the two shells
+    std::map<std::array<int,4>, size_t> pairs_;
+
+    static double estimate(const int la, const int pa, const int lb, const int pb, const int lc, const int pc);
+
+  public:
+    DFCostModel(const std::vector<std::shared_ptr<const Shell>>& b1shell, const std::vector<std::shared_ptr<const Shell>>& b2shell);
+
+    // cost of a 3-index batch (a b|c) and of a 2-index batch (a|c)
+    static double estimate(const Shell& a, const Shell& b, const Shell& c);
+    static double estimate(const Shell& a, const Shell& c);
+
+    // cost of all the 3-index integrals that involve an auxiliary shell
+    double aux_cost(const Shell& c) const;
+
+    // contiguous partition of a list of costs into np ranges with nearly equal sums. Returns np+1 boundaries.
+    static std::vector<size_t> partition(const std::vector<double>& cost, const size_t np);
+    // assigns each item to one of np processes (largest first onto the least loaded process).
+    static std::vector<int> assign(const std::vector<double>& cost, const size_t np);
+    // permutation that orders items by descending cost; used to feed TaskQueue the expensive tasks first
+    static std::vector<size_t> order(const std::vector<double>& cost);
+};
+
+}
+
+#endif
@@ -0,0 +1,76 @@
+//
+// BAGEL - Parallel electron correlation program.
+// Filename: floatdf.cc
+// Copyright (C) 2026 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// The BAGEL package is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 3, or (at your option)
+// any later version.
+//
+// The BAGEL package is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the BAGEL package; see COPYING.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+
+#include <src/df/floatdf.h>
+#include <src/util/math/mixedprecision.h>
+
+using namespace std;
+using namespace bagel;
+
+FloatDF::FloatDF(shared_ptr<const DFDist> df) : naux_(df->naux()), nbasis_(df->nbasis0()) {
+  if (!supported(df))
+    throw logic_error("FloatDF requires DF integrals held by one process");
+  shared_ptr<const DFBlock> block = df->block(0);
+  data_ = blas::to_single(block->data(), block->size());
+  data2_ = blas::to_single(df->data2()->data(), df->data2()->size());
+}
+
+
+bool FloatDF::supported(shared_ptr<const DFDist> df) {
+  return df->serial() && df->block().size() == 1 && df->has_2index() && df->nbasis0() == df->nbasis1()
+      && df->block(0)->asize() == df->naux();
+}
+
+
+shared_ptr<Matrix> FloatDF::compute_exchange(const MatView c, const double a) const {
+  assert(c.extent(0) == nbasis_);
+  const int nocc = c.extent(1);
+  auto out = make_shared<Matrix>(nbasis_, nbasis_);
+  if (nocc == 0) return out;
+
+  const vector<float> fc = blas::to_single(c.data(), c.size());
+
+  // (a|m i) = sum_n (a|mn) c_ni. The integrals are symmetric in m and n, so the slowest index is transformed in one GEMM.
+  const int am = naux_*nbasis_;
+  vector<float> half(static_cast<size_t>(am)*nocc);
+  sgemm_("N", "N", am, nocc, nbasis_, 1.0f, data_.data(), am, fc.data(), nbasis_, 0.0f, half.data(), am);
+
+  // metric multiply
+  vector<float> halfj(half.size());
+  sgemm_("N", "N", naux_, nbasis_*nocc, naux_, 1.0f, data2_.data(), naux_, half.data(), naux_, 0.0f, halfj.data(), naux_);
+  half.clear();
+  half.shrink_to_fit();
+
+  // K_mn = sum_i sum_a (a|mi)(a|ni); the sum over i is accumulated in double precision
+  vector<float> work(nbasis_*nbasis_);
+  for (int i = 0; i != nocc; ++i) {
+    const float* hi = halfj.data() + static_cast<size_t>(i)*am;
+    sgemm_("T", "N", nbasis_, nbasis_, naux_, 1.0f, hi, naux_, hi, naux_, 0.0f, work.data(), nbasis_);
+    double* target = out->data();
+    for (auto& w : work)
+      *target++ += a * w;
+  }
+  return out;
+}
@@ -0,0 +1,60 @@
+//
+// BAGEL - Parallel electron correlation program.
+// Filename: floatdf.h
+// Copyright (C) 2026 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// The BAGEL package is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 3, or (at your option)
+// any later version.
+//
+// The BAGEL package is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the BAGEL package; see COPYING.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+
+#ifndef __SRC_DF_FLOATDF_H
+#define __SRC_DF_FLOATDF_H
+
+#include <src/df/df.h>
+
+namespace bagel {
+
+// Single-precision copy of the three-index DF integrals and of the metric J^-1/2, used for the exchange builds
+// of mixed-precision SCF (see MixedPrecision). The integrals are converted once on construction; in each exchange
+// build the orbitals are converted once and the half-transformed intermediates are kept in single precision.
+// Only DF integrals that are held by one process (DFDist::serial()) are supported.
+class FloatDF {
+  protected:
+    const size_t naux_;
+    const size_t nbasis_;
+    // (naux, nbasis, nbasis); aux runs fastest
+    std::vector<float> data_;
+    // (naux, naux)
+    std::vector<float> data2_;
+
+  public:
+    FloatDF(std::shared_ptr<const DFDist> df);
+
+    // returns true if df can be converted
+    static bool supported(std::shared_ptr<const DFDist> df);
+
+    // a * K, where K_mn = sum_i (mi|ni) and i runs over the columns of c. Each orbital contributes in double precision.
+    std::shared_ptr<Matrix> compute_exchange(const MatView c, const double a) const;
+
+    size_t size() const { return data_.size() + data2_.size(); }
+};
+
+}
+
+#endif
@@ -86,6 +86,16 @@ void ParallelDF::scale(const double a) {
 }
 
 
+double ParallelDF::norm() const {
+  double out = 0.0;
+  for (auto& i : block_)
+    out += blas::dot_product(i->data(), i->size(), i->data());
+  if (!serial_)
+    mpi__->allreduce(&out, 1);
+  return sqrt(out);
+}
+
+
 void ParallelDF::symmetrize() {
   for (auto& i : block_)
     i->symmetrize();
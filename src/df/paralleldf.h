@@ -77,6 +77,8 @@ class ParallelDF : public std::enable_shared_from_this<ParallelDF> {
     void ax_plus_y(const double a, const std::shared_ptr<const ParallelDF> o);
     void scale(const double a);
     void symmetrize();
+    // Frobenius norm of the three-index quantity
+    double norm() const;
 
     std::shared_ptr<btas::Tensor3<double>> get_block(const int i, const int id, const int j, const int jd, const int k, const int kd) const;
 
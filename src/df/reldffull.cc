@@ -80,6 +80,20 @@ shared_ptr<RelDFFull> RelDFFull::apply_JJ() const {
 }
 
 
+bool RelDFFull::alpha_matches(shared_ptr<const Breit2Index> o) const {
+  assert(basis_.size() == 1);
+  return basis_[0]->alpha_comp() == o->index().second;
+}
+
+
+shared_ptr<RelDFFull> RelDFFull::multiply_breit2index(shared_ptr<const Breit2Index> bt) const {
+  assert(basis_.size() == 1);
+  array<shared_ptr<DFFullDist>,2> a{{dffull_[0]->apply_J(bt->data()), dffull_[1]->apply_J(bt->data())}};
+  vector<shared_ptr<const SpinorInfo>> spinor = { make_shared<const SpinorInfo>(basis_[0]->basis(), bt->index().first, bt->index().second) };
+  return make_shared<RelDFFull>(a, cartesian_, spinor);
+}
+
+
 shared_ptr<RelDFFull> RelDFFull::clone() const {
   array<shared_ptr<DFFullDist>,2> a{{dffull_[0]->clone(), dffull_[1]->clone()}};
   return make_shared<RelDFFull>(a, cartesian_, basis_);
@@ -54,6 +54,10 @@ class RelDFFull : public RelDFBase {
     std::shared_ptr<RelDFFull> apply_J() const;
     std::shared_ptr<RelDFFull> apply_JJ() const;
 
+    // the same as in RelDFHalf; the Breit 2-index integrals act on the auxiliary index alone
+    bool alpha_matches(std::shared_ptr<const Breit2Index>) const;
+    std::shared_ptr<RelDFFull> multiply_breit2index(std::shared_ptr<const Breit2Index>) const;
+
     // zaxpy
     void ax_plus_y(std::complex<double> a, std::shared_ptr<const RelDFFull> o) { ax_plus_y(a, *o); }
     void ax_plus_y(std::complex<double> a, const RelDFFull& o);
@@ -0,0 +1,195 @@
+//
+// BAGEL - Parallel electron correlation program.
+// Filename: batcheval.cc
+// Copyright (C) 2026 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// The BAGEL package is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 3, or (at your option)
+// any later version.
+//
+// The BAGEL package is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the BAGEL package; see COPYING.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+
+#include <fstream>
+#include <src/grad/batcheval.h>
+#include <src/grad/force.h>
+#include <src/wfn/construct_method.h>
+#include <src/util/timer.h>
+#include <src/util/parallel/mpi_interface.h>
+
+using namespace std;
+using namespace bagel;
+
+BatchEval::BatchEval(shared_ptr<const PTree> idata, shared_ptr<const Geometry> g, shared_ptr<const Reference> r)
+ : idata_(idata), geom_(g), ref_(r), gradient_(idata->get<bool>("gradient", false)) {
+
+  auto geometries = idata_->get_child_optional("geometries");
+  auto jobs = idata_->get_child_optional("jobs");
+  if (!geometries == !jobs)
+    throw runtime_error("batch requires either \"geometries\" or \"jobs\"");
+
+  if (geometries) {
+    // the same method blocks at each geometry
+    vector<shared_ptr<const PTree>> methods;
+    auto method = idata_->get_child("method");
+    for (auto& m : *method)
+      methods.push_back(m);
+    const bool angstrom = idata_->get<bool>("angstrom", false);
+    for (auto& g : *geometries) {
+      auto mol = make_shared<PTree>();
+      mol->put("title", "molecule");
+      mol->put("angstrom", angstrom);
+      mol->add_child("geometry", make_shared<PTree>(*g));
+      jobs_.push_back(vector<shared_ptr<const PTree>>{mol});
+      jobs_.back().insert(jobs_.back().end(), methods.begin(), methods.end());
+    }
+  } else {
+    for (auto& j : *jobs) {
+      jobs_.push_back({});
+      for (auto& b : *j)
+        jobs_.back().push_back(b);
+    }
+  }
+
+  for (auto& j : jobs_) {
+    if (j.empty() || to_lower(j.back()->get<string>("title", "")) == "molecule")
+      throw runtime_error("each job in batch should end with a method block");
+  }
+}
+
+
+pair<double, shared_ptr<const GradFile>> BatchEval::run(const vector<shared_ptr<const PTree>>& job) const {
+  shared_ptr<const Geometry> geom = geom_;
+  shared_ptr<const Reference> ref = ref_;
+  double energy = 0.0;
+
+  // in gradient runs the last block is handed to Force
+  auto last = gradient_ ? --job.end() : job.end();
+  for (auto i = job.begin(); i != last; ++i) {
+    const string title = to_lower((*i)->get<string>("title", ""));
+    if (title == "molecule") {
+      geom = make_shared<const Geometry>(*geom, *i);
+      if (ref) ref = ref->project_coeff(geom);
+    } else {
+      shared_ptr<Method> m = construct_method(title, *i, geom, ref);
+      if (!m) throw runtime_error("unknown method in batch: " + title);
+      m->compute();
+      ref = m->conv_to_ref();
+      if (ref) energy = ref->energy();
+    }
+  }
+
+  shared_ptr<const GradFile> grad;
+  if (gradient_) {
+    auto methods = make_shared<PTree>();
+    methods->push_back(make_shared<PTree>(**last));
+    auto input = make_shared<PTree>();
+    input->add_child("method", methods);
+    Force force(input, geom, ref);
+    grad = force.compute();
+    energy = force.energy();
+  }
+  return {energy, grad};
+}
+
+
+void BatchEval::compute() {
+  const int njob = jobs_.size();
+  const int ngroup = max(1, min({idata_->get<int>("ngroup", mpi__->size()), njob, mpi__->size()}));
+  cout << "  *** Batch evaluation of " << njob << " jobs in " << ngroup << " process groups" << endl << endl;
+
+  Timer timer;
+  // results are stored on the first process of each group and summed over all processes afterwards
+  vector<double> energy(njob, 0.0);
+  vector<int> status(njob, 0);
+  vector<int> gsize(njob, 0);
+  vector<vector<double>> grad(njob);
+
+  const int group = mpi__->split(ngroup);
+  for (int i = group; i < njob; i += ngroup) {
+    int failed = 0;
+    pair<double, shared_ptr<const GradFile>> result;
+    try {
+      result = run(jobs_[i]);
+    } catch (const exception& e) {
+      failed = 1;
+      cout << "  * job " << i << " failed: " << e.what() << endl;
+    }
+    // A failed job does not stop the others. The processes of a group agree on the outcome before moving on,
+    // which covers exceptions raised on some of the processes after their last collective operation in the job.
+    mpi__->allreduce(&failed, 1);
+    if (mpi__->rank() == 0) {
+      status[i] = failed ? -1 : 1;
+      if (!failed) {
+        energy[i] = result.first;
+        if (result.second) {
+          grad[i] = vector<double>(result.second->data(), result.second->data()+result.second->size());
+          gsize[i] = grad[i].size();
+        }
+      }
+    }
+  }
+  mpi__->merge();
+
+  mpi__->allreduce(energy.data(), njob);
+  mpi__->allreduce(status.data(), njob);
+  mpi__->allreduce(gsize.data(), njob);
+  vector<size_t> goffset(njob+1, 0);
+  for (int i = 0; i != njob; ++i)
+    goffset[i+1] = goffset[i] + gsize[i];
+  vector<double> gall(goffset.back(), 0.0);
+  for (int i = 0; i != njob; ++i)
+    copy(grad[i].begin(), grad[i].end(), gall.begin()+goffset[i]);
+  if (!gall.empty())
+    mpi__->allreduce(gall.data(), gall.size());
+
+  energy_ = energy;
+  status_ = vector<bool>(njob);
+  gradients_ = vector<shared_ptr<const GradFile>>(njob);
+  for (int i = 0; i != njob; ++i) {
+    status_[i] = status[i] == 1;
+    if (gsize[i]) {
+      auto g = make_shared<GradFile>(gsize[i]/3);
+      copy_n(gall.begin()+goffset[i], gsize[i], g->data());
+      gradients_[i] = g;
+    }
+  }
+  timer.tick_print("Batch evaluation");
+
+  cout << endl << "    job          energy      status" << endl;
+  for (int i = 0; i != njob; ++i)
+    cout << setw(7) << i << setw(20) << setprecision(10) << fixed << energy[i] << "      " << (status[i] == 1 ? "ok" : "failed") << endl;
+  cout << endl;
+
+  if (mpi__->rank() == 0) {
+    ofstream fs(idata_->get<string>("output", "batch.json"));
+    fs << "{" << endl << "  \"jobs\" : [" << endl;
+    for (int i = 0; i != njob; ++i) {
+      fs << "    { \"index\" : " << i << ", \"status\" : \"" << (status[i] == 1 ? "ok" : "failed") << "\"";
+      if (status[i] == 1) {
+        fs << ", \"energy\" : " << setprecision(12) << fixed << energy[i];
+        if (gsize[i]) {
+          fs << "," << endl << "      \"gradient\" : [";
+          for (int j = 0; j != gsize[i]/3; ++j)
+            fs << (j ? ", " : "") << "[" << gall[goffset[i]+3*j] << ", " << gall[goffset[i]+3*j+1] << ", " << gall[goffset[i]+3*j+2] << "]";
+          fs << "]";
+        }
+      }
+      fs << " }" << (i+1 != njob ? "," : "") << endl;
+    }
+    fs << "  ]" << endl << "}" << endl;
+  }
+}
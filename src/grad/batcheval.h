@@ -0,0 +1,73 @@
+//
+// BAGEL - Parallel electron correlation program.
+// Filename: batcheval.h
+// Copyright (C) 2026 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// The BAGEL package is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 3, or (at your option)
+// any later version.
+//
+// The BAGEL package is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the BAGEL package; see COPYING.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+
+#ifndef __SRC_GRAD_BATCHEVAL_H
+#define __SRC_GRAD_BATCHEVAL_H
+
+#include <src/wfn/reference.h>
+#include <src/util/math/xyzfile.h>
+
+namespace bagel {
+
+// Evaluates a list of independent jobs within one run. A job is either a geometry ("geometries"), for which the
+// blocks in "method" are run, or a list of input blocks ("jobs"). The processes are split into "ngroup" groups;
+// the jobs are assigned to the groups round robin and the groups run concurrently. Energies (and gradients if
+// "gradient" is true) are collected on all processes and written to "output" in JSON.
+// A job that fails on some processes of a group after its last collective operation is marked as failed for
+// the whole group. An exception raised on a subset of the processes in the middle of a job, while the others are
+// in a collective operation (e.g., in the SCF iterations), cannot be recovered from and leaves the group waiting.
+class BatchEval {
+  protected:
+    const std::shared_ptr<const PTree> idata_;
+    std::shared_ptr<const Geometry> geom_;
+    std::shared_ptr<const Reference> ref_;
+
+    // each job is a list of input blocks
+    std::vector<std::vector<std::shared_ptr<const PTree>>> jobs_;
+    bool gradient_;
+
+    // results of compute()
+    std::vector<double> energy_;
+    std::vector<bool> status_;
+    std::vector<std::shared_ptr<const GradFile>> gradients_;
+
+    // runs a job in the current process group; returns the energy and the gradient (nullptr unless gradient_)
+    std::pair<double, std::shared_ptr<const GradFile>> run(const std::vector<std::shared_ptr<const PTree>>& job) const;
+
+  public:
+    BatchEval(std::shared_ptr<const PTree>, std::shared_ptr<const Geometry>, std::shared_ptr<const Reference>);
+
+    void compute();
+
+    // false for jobs that failed
+    const std::vector<bool>& status() const { return status_; }
+    const std::vector<double>& energies() const { return energy_; }
+    // nullptr unless "gradient" is true
+    const std::vector<std::shared_ptr<const GradFile>>& gradients() const { return gradients_; }
+};
+
+}
+
+#endif
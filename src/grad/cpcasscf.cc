@@ -36,6 +36,12 @@ using namespace btas;
 
 CPCASSCF::CPCASSCF(shared_ptr<const PairFile<Matrix, Dvec>> grad, shared_ptr<const Dvec> civ, shared_ptr<const DFHalfDist> h,
                    shared_ptr<const DFHalfDist> h2, shared_ptr<const Reference> r, shared_ptr<FCI> f, const int ncore, shared_ptr<const Matrix> coeff)
+: CPCASSCF(vector<shared_ptr<const PairFile<Matrix, Dvec>>>{grad}, civ, h, h2, r, f, ncore, coeff) {
+}
+
+
+CPCASSCF::CPCASSCF(const vector<shared_ptr<const PairFile<Matrix, Dvec>>>& grad, shared_ptr<const Dvec> civ, shared_ptr<const DFHalfDist> h,
+                   shared_ptr<const DFHalfDist> h2, shared_ptr<const Reference> r, shared_ptr<FCI> f, const int ncore, shared_ptr<const Matrix> coeff)
 : grad_(grad), civector_(civ), half_(h), halfjj_(h2), ref_(r), geom_(r->geom()), fci_(f), ncore_(ncore), coeff_(coeff ? coeff : ref_->coeff()) {
 
   if (ref_->nact() && coeff_ != ref_->coeff())
@@ -99,11 +105,19 @@ tuple<shared_ptr<Matrix>,shared_ptr<Matrix>> CPCASSCF::compute_orb_denom_and_foc
 
 tuple<shared_ptr<const Matrix>, shared_ptr<const Dvec>, shared_ptr<const Matrix>, shared_ptr<const Matrix>>
   CPCASSCF::solve(const double zthresh, const int zmaxiter) {
+  assert(grad_.size() == 1);
+  return solve_block(zthresh, zmaxiter).front();
+}
+
+
+vector<tuple<shared_ptr<const Matrix>, shared_ptr<const Dvec>, shared_ptr<const Matrix>, shared_ptr<const Matrix>>>
+  CPCASSCF::solve_block(const double zthresh, const int zmaxiter) {
 
   const size_t nocca = ref_->nocc();
   const int nmobasis = coeff_->mdim();
   const int nclosed = ref_->nclosed();
   const int nact = ref_->nact();
+  const int nrhs = grad_.size();
   assert(nact + nclosed == nocca);
 
   // RI determinant space
@@ -117,6 +131,16 @@ tuple<shared_ptr<const Matrix>, shared_ptr<const Dvec>, shared_ptr<const Matrix>
   shared_ptr<const DFHalfDist> half = geom_->df()->compute_half_transform(ocoeff)->apply_J();
   shared_ptr<const DFFullDist> fullb = half->compute_second_transform(ocoeff);
 
+  // z-independent parts of the orbital Hessian, shared by all the iterations and right-hand sides
+  shared_ptr<const Matrix> hfulld;
+  shared_ptr<const DFFullDist> fulldj;
+  {
+    shared_ptr<const DFFullDist> fulld = nact ? fullb->apply_2rdm(*ref_->rdm2_av(), *ref_->rdm1_av(), nclosed, nact)
+                                              : fullb->apply_closed_2RDM();
+    hfulld = half->form_2index(fulld, 2.0); // Factor of 2
+    fulldj = fulld->apply_J();
+  }
+
   // making denominator...
   shared_ptr<PairFile<Matrix, Dvec>> denom;
   shared_ptr<const Matrix> fock;
@@ -140,214 +164,278 @@ tuple<shared_ptr<const Matrix>, shared_ptr<const Dvec>, shared_ptr<const Matrix>
   }
 
   // frozen core contributions
-  shared_ptr<Matrix> zcore, gzcore;
+  vector<shared_ptr<Matrix>> zcore(nrhs), gzcore(nrhs);
   if (ncore_) {
     assert(ncore_ < nclosed);
-    zcore = make_shared<Matrix>(nocca, nocca);
-    for (int i = 0; i != ncore_; ++i)
-      for (int j = ncore_; j != nclosed; ++j) {
-        zcore->element(j, i) = - (grad_->first()->element(j, i) - grad_->first()->element(i, j)) / (fock->element(j,j) - fock->element(i,i));
-        assert(abs(fock->element(i, j)) < 1.0e-8);
+    for (int k = 0; k != nrhs; ++k) {
+      zcore[k] = make_shared<Matrix>(nocca, nocca);
+      for (int i = 0; i != ncore_; ++i)
+        for (int j = ncore_; j != nclosed; ++j) {
+          zcore[k]->element(j, i) = - (grad_[k]->first()->element(j, i) - grad_[k]->first()->element(i, j)) / (fock->element(j,j) - fock->element(i,i));
+          assert(abs(fock->element(i, j)) < 1.0e-8);
+        }
+      zcore[k]->symmetrize();
+      shared_ptr<Matrix> rot;
+      if (nact) {
+        rot = make_shared<Matrix>(*zcore[k] + *ref_->rdm1_mat()); // trick to make it positive definite
+      } else {
+        rot = make_shared<Matrix>(*zcore[k]);
+        for (int i = 0; i != nclosed; ++i)
+          rot->element(i,i) += 2.0;
       }
-    zcore->symmetrize();
-    shared_ptr<Matrix> rot;
-    if (nact) {
-      rot = make_shared<Matrix>(*zcore + *ref_->rdm1_mat()); // trick to make it positive definite
-    } else {
-      rot = make_shared<Matrix>(*zcore);
-      for (int i = 0; i != nclosed; ++i)
-        rot->element(i,i) += 2.0;
+      rot->sqrt();
+      rot->scale(1.0/sqrt(2.0));
+      auto gzcoreao = make_shared<Fock<1>>(geom_, ref_->hcore(), nullptr, ocoeff * *rot, false, true);
+      gzcore[k] = make_shared<Matrix>(*coeff_ % *gzcoreao * *coeff_ - *fock); // compensate
     }
-    rot->sqrt();
-    rot->scale(1.0/sqrt(2.0));
-    auto gzcoreao = make_shared<Fock<1>>(geom_, ref_->hcore(), nullptr, ocoeff * *rot, false, true);
-    gzcore = make_shared<Matrix>(*coeff_ % *gzcoreao * *coeff_ - *fock); // compensate
   }
 
-  // BFGS update of the denominator above
-  auto bfgs = make_shared<BFGS<PairFile<Matrix, Dvec>>>(denom, /*debug*/true);
+  vector<shared_ptr<const PairFile<Matrix, Dvec>>> sources;
+  for (int k = 0; k != nrhs; ++k) {
+    // gradient Y and y
+    auto source = make_shared<PairFile<Matrix, Dvec>>(*grad_[k]);
+    // divide by weight
+    if (source->second()->ij() > 1) {
+      for (int ij = 0; ij != source->second()->ij(); ++ij)
+        source->second()->data(ij)->scale(1.0/fci_->weight(ij));
+    }
+    // patch frozen core contributions
+    if (zcore[k]) {
+      // contributions to Y
+      source->first()->ax_plus_y(2.0, *fock * *zcore[k]->resize(nmobasis, nmobasis) + *gzcore[k] * *ref_->rdm1_mat()->resize(nmobasis, nmobasis));
+      // contributions to y
+      for (int istate = 0; istate != ref_->nstate(); ++istate) {
+        shared_ptr<const Dvec> rdm1deriv = fci_->rdm1deriv(istate);
+        for (int i = 0; i != nact; ++i)
+          for (int j = 0; j != nact; ++j)
+            source->second()->data(istate)->ax_plus_y(gzcore[k]->element(j+nclosed, i+nclosed), rdm1deriv->data(j+nact*i));
+      }
+    }
+    // antisymmetrize
+    source->first()->antisymmetrize();
+    source->first()->purify_redrotation(ref_->nclosed(), ref_->nact(), ref_->nvirt());
 
-  // gradient Y and y
-  auto source = make_shared<PairFile<Matrix, Dvec>>(*grad_);
-  // divide by weight
-  if (source->second()->ij() > 1) {
-    for (int ij = 0; ij != source->second()->ij(); ++ij)
-      source->second()->data(ij)->scale(1.0/fci_->weight(ij));
+    // project out Civector from the gradient
+    source->second()->project_out(civector_);
+    sources.push_back(source);
   }
-  // patch frozen core contributions
-  if (zcore) {
-    // contributions to Y
-    source->first()->ax_plus_y(2.0, *fock * *zcore->resize(nmobasis, nmobasis) + *gzcore * *ref_->rdm1_mat()->resize(nmobasis, nmobasis));
-    // contributions to y
-    for (int istate = 0; istate != ref_->nstate(); ++istate) {
-      shared_ptr<const Dvec> rdm1deriv = fci_->rdm1deriv(istate);
-      for (int i = 0; i != nact; ++i)
-        for (int j = 0; j != nact; ++j)
-          source->second()->data(istate)->ax_plus_y(gzcore->element(j+nclosed, i+nclosed), rdm1deriv->data(j+nact*i));
-    }
+  auto solver = make_shared<BlockLinearRM<PairFile<Matrix, Dvec>>>(zmaxiter*nrhs, sources);
+
+  // initial guess; BFGS update of the denominator above for each right-hand side
+  vector<shared_ptr<BFGS<PairFile<Matrix, Dvec>>>> bfgs;
+  vector<shared_ptr<PairFile<Matrix, Dvec>>> z;
+  for (auto& source : sources) {
+    bfgs.push_back(make_shared<BFGS<PairFile<Matrix, Dvec>>>(denom, /*debug*/true));
+    shared_ptr<PairFile<Matrix, Dvec>> zk = source->clone();
+    zk->zero();
+    zk = bfgs.back()->extrapolate(source, zk);
+    zk->second()->project_out(civector_);
+    z.push_back(zk);
   }
-  // antisymmetrize
-  source->first()->antisymmetrize();
-  source->first()->purify_redrotation(ref_->nclosed(), ref_->nact(), ref_->nvirt());
-
-  // project out Civector from the gradient
-  source->second()->project_out(civector_);
-  auto solver = make_shared<LinearRM<PairFile<Matrix, Dvec>>>(zmaxiter, source);
-
-  // initial guess
-  shared_ptr<PairFile<Matrix, Dvec>> z = source->clone();
-  z->zero();
-
-  z = bfgs->extrapolate(source, z);
-  z->second()->project_out(civector_);
+  vector<bool> conv(nrhs, false);
 
   // inverse matrix of C
   auto ovl = make_shared<const Overlap>(geom_);
   auto cinv = make_shared<const Matrix>(*coeff_ % *ovl);
 
   cout << "  === CASSCF Z-vector iteration ===" << endl << endl;
+  if (nrhs > 1)
+    cout << "      solving for " << nrhs << " right-hand sides simultaneously" << endl << endl;
 
   Timer timer;
+  int nsigma = 0;
+  double ztime = 0.0;
   for (int iter = 0; iter != zmaxiter; ++iter) {
-    solver->orthog(z);
+    // new trial vectors from the unconverged right-hand sides
+    vector<shared_ptr<const PairFile<Matrix, Dvec>>> trial;
+    for (int k = 0; k != nrhs; ++k) {
+      if (conv[k]) continue;
+      const double norm = z[k]->norm();
+      const double onorm = solver->orthog(z[k], trial);
+      // skip directions that are already spanned by the subspace
+      if (onorm > 1.0e-8*norm)
+        trial.push_back(z[k]);
+    }
+    if (trial.empty()) break;
 
     // given z, computes sigma (before anti-symmetrization)
-    shared_ptr<PairFile<Matrix, Dvec>> sigma = form_sigma(z, half, fullb, detex, cinv);
-    sigma->first()->antisymmetrize();
-    sigma->first()->purify_redrotation(ref_->nclosed(), ref_->nact(), ref_->nvirt());
-    sigma->second()->project_out(civector_);
-
-    z = solver->compute_residual(z, sigma);
-
-    z = bfgs->extrapolate(z, solver->civec());
-    z->second()->project_out(civector_);
+    vector<shared_ptr<PairFile<Matrix, Dvec>>> sigma = form_sigma_block(trial, half, fullb, hfulld, fulldj, detex, cinv);
+    vector<shared_ptr<const PairFile<Matrix, Dvec>>> csigma;
+    for (auto& s : sigma) {
+      s->first()->antisymmetrize();
+      s->first()->purify_redrotation(ref_->nclosed(), ref_->nact(), ref_->nvirt());
+      s->second()->project_out(civector_);
+      csigma.push_back(s);
+    }
+    nsigma += sigma.size();
+
+    vector<shared_ptr<PairFile<Matrix, Dvec>>> residual = solver->compute_residual(trial, csigma);
+
+    double rms = 0.0;
+    for (int k = 0; k != nrhs; ++k) {
+      if (conv[k]) continue;
+      z[k] = bfgs[k]->extrapolate(residual[k], solver->civec(k));
+      z[k]->second()->project_out(civector_);
+      const double rmsk = z[k]->rms();
+      rms = max(rms, rmsk);
+      conv[k] = rmsk < zthresh;
+    }
 
-    cout << setw(10) <<  iter << " " << setw(17) << setprecision(10) << z->rms() << setw(10) << setprecision(2) << timer.tick() << endl;
-    if (z->rms() < zthresh) break;
+    const double tick = timer.tick();
+    ztime += tick;
+    cout << setw(10) <<  iter << " " << setw(17) << setprecision(10) << rms << setw(10) << setprecision(2) << tick << endl;
+    if (all_of(conv.begin(), conv.end(), [](const bool i) { return i; })) break;
   }
-
-  shared_ptr<PairFile<Matrix, Dvec>> result = solver->civec();
-  shared_ptr<Matrix> xmat = form_sigma_sym(result, half, fullb, detex, cinv);
-
-  *xmat += *grad_->first();
-  if (zcore)
-    xmat->ax_plus_y(2.0, *fock * *zcore->resize(nmobasis, nmobasis) + *gzcore * *ref_->rdm1_mat()->resize(nmobasis, nmobasis));
-  xmat->symmetrize();
-  xmat->scale(0.5); // due to convention
-  return make_tuple(result->first(), result->second(), xmat, zcore);
+  if (nrhs > 1)
+    cout << endl << "      " << nsigma << " sigma vectors for " << nrhs << " right-hand sides ("
+         << setprecision(2) << static_cast<double>(nsigma)/nrhs << " per right-hand side, " << ztime/nrhs << " sec each)" << endl;
+
+  vector<tuple<shared_ptr<const Matrix>, shared_ptr<const Dvec>, shared_ptr<const Matrix>, shared_ptr<const Matrix>>> out;
+  for (int k = 0; k != nrhs; ++k) {
+    shared_ptr<PairFile<Matrix, Dvec>> result = solver->civec(k);
+    shared_ptr<Matrix> xmat = form_sigma_sym(result, half, fullb, detex, cinv);
+
+    *xmat += *grad_[k]->first();
+    if (zcore[k])
+      xmat->ax_plus_y(2.0, *fock * *zcore[k]->resize(nmobasis, nmobasis) + *gzcore[k] * *ref_->rdm1_mat()->resize(nmobasis, nmobasis));
+    xmat->symmetrize();
+    xmat->scale(0.5); // due to convention
+    out.emplace_back(result->first(), result->second(), xmat, zcore[k]);
+  }
+  return out;
 }
 
 
-shared_ptr<PairFile<Matrix,Dvec>>
-  CPCASSCF::form_sigma(shared_ptr<const PairFile<Matrix,Dvec>> z, shared_ptr<const DFHalfDist> half,
-                       shared_ptr<const DFFullDist> fullb, shared_ptr<const Determinants> detex, shared_ptr<const Matrix> cinv) const {
+vector<shared_ptr<PairFile<Matrix,Dvec>>>
+  CPCASSCF::form_sigma_block(const vector<shared_ptr<const PairFile<Matrix,Dvec>>>& zs, shared_ptr<const DFHalfDist> half, shared_ptr<const DFFullDist> fullb,
+                       shared_ptr<const Matrix> hfulld, shared_ptr<const DFFullDist> fulldj, shared_ptr<const Determinants> detex, shared_ptr<const Matrix> cinv) const {
   const size_t nmobasis = coeff_->mdim();
   const size_t nocca = ref_->nocc();
   const int nclosed = ref_->nclosed();
   const int nact = ref_->nact();
+  const int nz = zs.size();
 
-  shared_ptr<const Matrix> z0 = z->first();
-  shared_ptr<const Dvec>   z1 = z->second();
   shared_ptr<RDM<1>> rdm1_av = nact ? ref_->rdm1_av()->copy() : nullptr;
   shared_ptr<RDM<2>> rdm2_av = nact ? ref_->rdm2_av()->copy() : nullptr;
 
-  // TODO duplicated operation of <I|H|z>. Should be resolved at the end.
-  // only here we need to have det_ instead of detex
-  shared_ptr<Matrix> sigmaorb = nact ? compute_amat(z1, civector_, detex) : make_shared<Matrix>(nmobasis,nmobasis);
-
-  // computation of Atilde.
-  auto cz0 = make_shared<Matrix>(*coeff_ * *z0);
-  auto cz0cinv = make_shared<Matrix>(*coeff_ * *z0 * *cinv);
-  const MatView ocz0 = cz0->slice(0, nocca);
+  vector<shared_ptr<const Matrix>> cz0(nz), cz0cinv(nz);
+  vector<MatView> ocz0;
+  for (int k = 0; k != nz; ++k) {
+    cz0[k] = make_shared<Matrix>(*coeff_ * *zs[k]->first());
+    cz0cinv[k] = make_shared<Matrix>(*cz0[k] * *cinv);
+    ocz0.push_back(cz0[k]->slice(0, nocca));
+  }
 //assert((*cz0 - *cz0cinv * *coeff_).rms() < 1.0e-8);
 
   // [G_ij,kl (kl|D)] [(D|jS)+(D|Js)]   (capital denotes a Z transformed index)
-  // (D|jx) -> (D|jS)
-  {
-    shared_ptr<DFFullDist> tmp0 = half->compute_second_transform(cz0cinv);
-    shared_ptr<const DFHalfDist> tmp1 = geom_->df()->compute_half_transform(ocz0)->apply_J();
-    tmp0->ax_plus_y(1.0, tmp1);
-    shared_ptr<const DFFullDist> fulld = nact ? fullb->apply_2rdm(*rdm2_av, *rdm1_av, nclosed, nact)
-                                              : fullb->apply_closed_2RDM();
-    shared_ptr<const Matrix> buf = tmp0->form_2index(fulld, 2.0); // Factor of 2
-    const Matrix cbuf(*coeff_ % *buf);
-    sigmaorb->add_block(1.0, 0, 0, nmobasis, nocca, cbuf);
-  }
-  // [G_ij,kl (Kl|D)+(kL|D)] (D|sj)
-  shared_ptr<DFFullDist> fullz = half->compute_second_transform(ocz0);
-  fullz->symmetrize();
-  {
-    shared_ptr<const DFFullDist> tmp = nact ? fullz->apply_2rdm(*rdm2_av, *rdm1_av, nclosed, nact)
-                                            : fullz->apply_closed_2RDM();
-    shared_ptr<const Matrix> buf = half->form_2index(tmp, 2.0); // Factor of 2
-    // mo transformation of s
-    sigmaorb->add_block(1.0, 0, 0, nmobasis, nocca, *coeff_ % *buf);
+  // (D|jx) -> (D|jS) is hfulld rotated by Z. The (D|Js) part is formed for all the trial vectors in one contraction
+  // with the 3-index integrals: (D|Js)(D|jk)G = (D|rs) [Z_rJ (D|jk)G]
+  shared_ptr<const Matrix> jsbuf = geom_->df()->form_2index(fulldj->back_transform_first(ocz0), 2.0); // Factor of 2
+
+  // CI sigma with the unmodified operator for all the trial vectors at once
+  shared_ptr<Dvec> sigmaci_all;
+  const int nij = zs.front()->second()->ij();
+  if (nact) {
+    auto zall = make_shared<Dvec>(zs.front()->second()->det(), nij*nz);
+    for (int k = 0; k != nz; ++k)
+      for (int i = 0; i != nij; ++i)
+        copy_n(zs[k]->second()->data(i)->data(), zs[k]->second()->data(i)->size(), zall->data(i+nij*k)->data());
+    sigmaci_all = fci_->form_sigma(zall, fci_->jop(), vector<int>(nij*nz, 0));
   }
 
-  // one electron part...
-  auto htilde = make_shared<Matrix>(*coeff_ % *ref_->hcore() * *cz0);
-  htilde->symmetrize();
-  htilde->scale(2.0);
-  const Matrix cbuf(htilde->slice(0, nocca) * *ref_->rdm1_mat());
-  sigmaorb->add_block(2.0, 0, 0, nmobasis, nocca, cbuf);
-
-  // At this point
-  // htilde = Z^daggerh + hZ
-  // fullb  = (D|ij)
-  // fullz  = (D|ir)Z_rj + (D|rj)Z_ri
-
-  // internal core fock operator...
-  // [htilde + (kl|D)(D|ij) (2delta_ij - delta_ik)]_active
-
-  // first form 4 index
-  shared_ptr<Matrix> buf = fullz->form_4index(fullb, 1.0);
-  // TODO Awful code. To be updated. making the code that works in the quickest possible way
-  // index swap
-  unique_ptr<double[]> buf2(new double[nocca*nocca*nocca*nocca]);
-
-  // bra ket symmetrization
-  for (int i = 0; i != nocca*nocca; ++i)
-    for (int j = 0; j != nocca*nocca; ++j)
-      buf2[j+nocca*nocca*i] = buf->element(j, i) + buf->element(i, j);
-
-  auto Htilde2 = make_shared<Matrix>(nact*nact, nact*nact);
-  for (int i = nclosed, ii = 0; i != nocca; ++i, ++ii)
-    for (int j = nclosed, jj = 0; j != nocca; ++j, ++jj)
-      for (int k = nclosed, kk = 0; k != nocca; ++k, ++kk)
-        for (int l = nclosed, ll = 0; l != nocca; ++l, ++ll)
-          Htilde2->element(ll+nact*kk, jj+nact*ii) = buf2[l+nocca*(k+nocca*(j+nocca*i))];
-
-  auto Htilde1 = make_shared<Matrix>(nact,nact, true);
-  for (int i = nclosed, ii = 0; i != nocca; ++i, ++ii) {
-    for (int j = nclosed, jj = 0; j != nocca; ++j, ++jj) {
-      (*Htilde1)(jj, ii) = htilde->element(j,i);
-      for (int k = 0; k != nclosed; ++k)
-        (*Htilde1)(jj, ii) += 2.0*buf2[k+nocca*(k+nocca*(j+nocca*i))] - buf2[k+nocca*(i+nocca*(j+nocca*k))];
+  vector<shared_ptr<PairFile<Matrix,Dvec>>> out;
+  for (int iz = 0; iz != nz; ++iz) {
+    shared_ptr<const Dvec>   z1 = zs[iz]->second();
+    const MatView& ocz0k = ocz0[iz];
+
+    // TODO duplicated operation of <I|H|z>. Should be resolved at the end.
+    // only here we need to have det_ instead of detex
+    shared_ptr<Matrix> sigmaorb = nact ? compute_amat(z1, civector_, detex) : make_shared<Matrix>(nmobasis,nmobasis);
+
+    // computation of Atilde.
+    {
+      Matrix buf(*cz0cinv[iz] % *hfulld);
+      buf += *jsbuf->get_submatrix(0, iz*nocca, jsbuf->ndim(), nocca);
+      sigmaorb->add_block(1.0, 0, 0, nmobasis, nocca, *coeff_ % buf);
+    }
+    // [G_ij,kl (Kl|D)+(kL|D)] (D|sj)
+    shared_ptr<DFFullDist> fullz = half->compute_second_transform(ocz0k);
+    fullz->symmetrize();
+    {
+      shared_ptr<const DFFullDist> tmp = nact ? fullz->apply_2rdm(*rdm2_av, *rdm1_av, nclosed, nact)
+                                              : fullz->apply_closed_2RDM();
+      shared_ptr<const Matrix> buf = half->form_2index(tmp, 2.0); // Factor of 2
+      // mo transformation of s
+      sigmaorb->add_block(1.0, 0, 0, nmobasis, nocca, *coeff_ % *buf);
+    }
+
+    // one electron part...
+    auto htilde = make_shared<Matrix>(*coeff_ % *ref_->hcore() * *cz0[iz]);
+    htilde->symmetrize();
+    htilde->scale(2.0);
+    const Matrix cbuf(htilde->slice(0, nocca) * *ref_->rdm1_mat());
+    sigmaorb->add_block(2.0, 0, 0, nmobasis, nocca, cbuf);
+
+    // At this point
+    // htilde = Z^daggerh + hZ
+    // fullb  = (D|ij)
+    // fullz  = (D|ir)Z_rj + (D|rj)Z_ri
+
+    // internal core fock operator...
+    // [htilde + (kl|D)(D|ij) (2delta_ij - delta_ik)]_active
+
+    // first form 4 index
+    shared_ptr<Matrix> buf = fullz->form_4index(fullb, 1.0);
+    // TODO Awful code. To be updated. making the code that works in the quickest possible way
+    // index swap
+    unique_ptr<double[]> buf2(new double[nocca*nocca*nocca*nocca]);
+
+    // bra ket symmetrization
+    for (int i = 0; i != nocca*nocca; ++i)
+      for (int j = 0; j != nocca*nocca; ++j)
+        buf2[j+nocca*nocca*i] = buf->element(j, i) + buf->element(i, j);
+
+    auto Htilde2 = make_shared<Matrix>(nact*nact, nact*nact);
+    for (int i = nclosed, ii = 0; i != nocca; ++i, ++ii)
+      for (int j = nclosed, jj = 0; j != nocca; ++j, ++jj)
+        for (int k = nclosed, kk = 0; k != nocca; ++k, ++kk)
+          for (int l = nclosed, ll = 0; l != nocca; ++l, ++ll)
+            Htilde2->element(ll+nact*kk, jj+nact*ii) = buf2[l+nocca*(k+nocca*(j+nocca*i))];
+
+    auto Htilde1 = make_shared<Matrix>(nact,nact, true);
+    for (int i = nclosed, ii = 0; i != nocca; ++i, ++ii) {
+      for (int j = nclosed, jj = 0; j != nocca; ++j, ++jj) {
+        (*Htilde1)(jj, ii) = htilde->element(j,i);
+        for (int k = 0; k != nclosed; ++k)
+          (*Htilde1)(jj, ii) += 2.0*buf2[k+nocca*(k+nocca*(j+nocca*i))] - buf2[k+nocca*(i+nocca*(j+nocca*k))];
+      }
     }
-  }
-  // factor of 2 in the equation
-  *Htilde1 *= 2.0;
-  *Htilde2 *= 2.0;
+    // factor of 2 in the equation
+    *Htilde1 *= 2.0;
+    *Htilde2 *= 2.0;
 
-  auto top = make_shared<Htilde>(ref_, 0, nact, Htilde1, Htilde2);
-  vector<int> tmp(z1->ij(), 0);
+    auto top = make_shared<Htilde>(ref_, 0, nact, Htilde1, Htilde2);
+    vector<int> tmp(z1->ij(), 0);
 
-  shared_ptr<Dvec> sigmaci;
-  if (nact) {
-    sigmaci = fci_->form_sigma(civector_, top, tmp);
-    *sigmaci += *fci_->form_sigma(z1, fci_->jop(), tmp);
+    shared_ptr<Dvec> sigmaci;
+    if (nact) {
+      sigmaci = fci_->form_sigma(civector_, top, tmp);
+      for (int i = 0; i != nij; ++i)
+        sigmaci->data(i)->ax_plus_y(1.0, *sigmaci_all->data(i+nij*iz));
 
-    const double core_energy = geom_->nuclear_repulsion() + fci_->core_energy();
-    for (int i = 0; i != z1->ij(); ++i)
-      for (int j = 0; j != z1->data(i)->size(); ++j)
-        sigmaci->data(i)->data(j) -= (fci_->energy(i) - core_energy) * z1->data(i)->data(j);
+      const double core_energy = geom_->nuclear_repulsion() + fci_->core_energy();
+      for (int i = 0; i != z1->ij(); ++i)
+        for (int j = 0; j != z1->data(i)->size(); ++j)
+          sigmaci->data(i)->data(j) -= (fci_->energy(i) - core_energy) * z1->data(i)->data(j);
 
-    sigmaci->project_out(civector_);
-  } else {
-    sigmaci = civector_->clone(); // always zero when nact=0
-  }
+      sigmaci->project_out(civector_);
+    } else {
+      sigmaci = civector_->clone(); // always zero when nact=0
+    }
 
-  return make_shared<PairFile<Matrix, Dvec>>(sigmaorb, sigmaci);
+    out.push_back(make_shared<PairFile<Matrix, Dvec>>(sigmaorb, sigmaci));
+  }
+  return out;
 }
 
 
@@ -37,7 +37,8 @@ namespace bagel {
 
 class CPCASSCF {
   protected:
-    std::shared_ptr<const PairFile<Matrix, Dvec>> grad_;
+    // right-hand sides (one per state or coupling) that share the orbital and CI Hessian
+    std::vector<std::shared_ptr<const PairFile<Matrix, Dvec>>> grad_;
     std::shared_ptr<const Dvec> civector_;
     std::shared_ptr<const DFHalfDist> half_;
     std::shared_ptr<const DFHalfDist> halfjj_;
@@ -48,8 +49,10 @@ class CPCASSCF {
     int ncore_;
     std::shared_ptr<const Matrix> coeff_;
 
-    std::shared_ptr<PairFile<Matrix,Dvec>> form_sigma(std::shared_ptr<const PairFile<Matrix,Dvec>> z, std::shared_ptr<const DFHalfDist>,
-                                                      std::shared_ptr<const DFFullDist>, std::shared_ptr<const Determinants> det, std::shared_ptr<const Matrix>) const;
+    // sigma vectors for a batch of trial vectors. hfulld and fulldj are z-independent intermediates computed once in solve_block.
+    std::vector<std::shared_ptr<PairFile<Matrix,Dvec>>> form_sigma_block(const std::vector<std::shared_ptr<const PairFile<Matrix,Dvec>>>& z, std::shared_ptr<const DFHalfDist>,
+                                                                   std::shared_ptr<const DFFullDist>, std::shared_ptr<const Matrix> hfulld, std::shared_ptr<const DFFullDist> fulldj,
+                                                                   std::shared_ptr<const Determinants> det, std::shared_ptr<const Matrix>) const;
     std::shared_ptr<Matrix> form_sigma_sym(std::shared_ptr<const PairFile<Matrix,Dvec>> z, std::shared_ptr<const DFHalfDist>,
                                            std::shared_ptr<const DFFullDist>, std::shared_ptr<const Determinants> det, std::shared_ptr<const Matrix>) const;
     std::shared_ptr<Matrix> compute_amat(std::shared_ptr<const Dvec> z1, std::shared_ptr<const Dvec> c1, std::shared_ptr<const Determinants>) const;
@@ -59,11 +62,18 @@ class CPCASSCF {
     CPCASSCF(std::shared_ptr<const PairFile<Matrix, Dvec>> grad, std::shared_ptr<const Dvec> c,
              std::shared_ptr<const DFHalfDist> half, std::shared_ptr<const DFHalfDist> halfjj,
              std::shared_ptr<const Reference> g, std::shared_ptr<FCI> f, const int ncore = 0, std::shared_ptr<const Matrix> coeff = nullptr);
+    CPCASSCF(const std::vector<std::shared_ptr<const PairFile<Matrix, Dvec>>>& grad, std::shared_ptr<const Dvec> c,
+             std::shared_ptr<const DFHalfDist> half, std::shared_ptr<const DFHalfDist> halfjj,
+             std::shared_ptr<const Reference> g, std::shared_ptr<FCI> f, const int ncore = 0, std::shared_ptr<const Matrix> coeff = nullptr);
 
-    // tuple of Z, z, and X.
+    // tuple of Z, z, X, and the frozen-core Z for a single right-hand side.
     std::tuple<std::shared_ptr<const Matrix>, std::shared_ptr<const Dvec>, std::shared_ptr<const Matrix>, std::shared_ptr<const Matrix>>
       solve(const double thresh, const int maxiter = 100);
 
+    // solves for all the right-hand sides simultaneously in a common subspace
+    std::vector<std::tuple<std::shared_ptr<const Matrix>, std::shared_ptr<const Dvec>, std::shared_ptr<const Matrix>, std::shared_ptr<const Matrix>>>
+      solve_block(const double thresh, const int maxiter = 100);
+
 };
 
 }
@@ -31,12 +31,12 @@
 using namespace std;
 using namespace bagel;
 
-Force::Force(shared_ptr<const PTree> idata, shared_ptr<const Geometry> g, shared_ptr<const Reference> r) : idata_(idata), geom_(g), ref_(r) {
+Force::Force(shared_ptr<const PTree> idata, shared_ptr<const Geometry> g, shared_ptr<const Reference> r) : idata_(idata), geom_(g), ref_(r), energy_(0.0) {
 
 }
 
 
-void Force::compute() {
+shared_ptr<GradFile> Force::compute() {
   auto input = idata_->get_child("method");
 
   std::shared_ptr<const Reference> ref = ref_;
@@ -57,41 +57,49 @@ void Force::compute() {
   cinput->put("gradient", true);
 
   const string method = to_lower(cinput->get<string>("title", ""));
+  shared_ptr<GradFile> out;
 
   if (method == "uhf") {
 
     auto force = make_shared<GradEval<UHF>>(cinput, geom_, ref_);
-    force->compute();
+    out = force->compute();
+    energy_ = force->energy();
 
   } else if (method == "rohf") {
 
     auto force = make_shared<GradEval<ROHF>>(cinput, geom_, ref_);
-    force->compute();
+    out = force->compute();
+    energy_ = force->energy();
 
   } else if (method == "hf") {
 
     auto force = make_shared<GradEval<RHF>>(cinput, geom_, ref_);
-    force->compute();
+    out = force->compute();
+    energy_ = force->energy();
 
   } else if (method == "ks") {
 
     auto force = make_shared<GradEval<KS>>(cinput, geom_, ref_);
-    force->compute();
+    out = force->compute();
+    energy_ = force->energy();
 
   } else if (method == "dhf") {
 
     auto force = make_shared<GradEval<Dirac>>(cinput, geom_, ref_);
-    force->compute();
+    out = force->compute();
+    energy_ = force->energy();
 
   } else if (method == "mp2") {
 
     auto force = make_shared<GradEval<MP2Grad>>(cinput, geom_, ref_);
-    force->compute();
+    out = force->compute();
+    energy_ = force->energy();
 
   } else if (method == "dmp2") {
 
     auto force = make_shared<GradEval<DMP2Grad>>(cinput, geom_, ref_);
-    force->compute();
+    out = force->compute();
+    energy_ = force->energy();
 
   } else if (method == "casscf") {
     string algorithm = cinput->get<string>("algorithm", "");
@@ -99,7 +107,8 @@ void Force::compute() {
     if (cinput->get<int>("nstate", 1) == 1) {
       if (algorithm == "superci" || algorithm == "") {
         auto force = make_shared<GradEval<SuperCI>>(cinput, geom_, ref_);
-        force->compute();
+        out = force->compute();
+        energy_ = force->energy();
       } else {
         throw runtime_error("unknown CASSCF algorithm specified.");
       }
@@ -107,7 +116,8 @@ void Force::compute() {
     } else {
       if (algorithm == "superci" || algorithm == "") {
         auto force = make_shared<GradEval<SuperCIGrad>>(cinput, geom_, ref_);
-        force->compute();
+        out = force->compute();
+        energy_ = force->energy();
       } else {
         throw runtime_error("unknown CASSCF algorithm specified.");
       }
@@ -115,8 +125,12 @@ void Force::compute() {
   } else if (method == "caspt2") {
 
     auto force = make_shared<GradEval<CASPT2Grad>>(cinput, geom_, ref_);
-    force->compute();
+    out = force->compute();
+    energy_ = force->energy();
 
   }
 
+  if (!out)
+    throw runtime_error("nuclear gradient is not available for " + method);
+  return out;
 }
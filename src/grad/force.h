@@ -27,6 +27,7 @@
 #define __SRC_GRAD_FORCE_H
 
 #include <src/wfn/reference.h>
+#include <src/util/math/xyzfile.h>
 
 namespace bagel {
 
@@ -35,11 +36,15 @@ class Force {
     const std::shared_ptr<const PTree> idata_;
     std::shared_ptr<const Geometry> geom_;
     std::shared_ptr<const Reference> ref_;
+    double energy_;
 
   public:
     Force(std::shared_ptr<const PTree>, std::shared_ptr<const Geometry>, std::shared_ptr<const Reference>);
 
-    void compute();
+    std::shared_ptr<GradFile> compute();
+
+    // energy at the geometry of the last compute() call
+    double energy() const { return energy_; }
 
 };
 
@@ -52,6 +52,9 @@ class GradEval : public GradEval_base {
 
     double energy_;
 
+    // gradients of all the target states when several are requested (SA-CASSCF "targets"); compute() returns the first
+    std::vector<std::shared_ptr<const GradFile>> gradients_;
+
   public:
     // Constructor performs energy calculation
     GradEval(std::shared_ptr<const PTree> idata, std::shared_ptr<const Geometry> geom, std::shared_ptr<const Reference> ref) : GradEval_base(geom) {
@@ -67,6 +70,7 @@ class GradEval : public GradEval_base {
     std::shared_ptr<GradFile> compute() { throw std::logic_error("Nuclear gradient for this method has not been implemented"); }
 
     double energy() const { return energy_; }
+    const std::vector<std::shared_ptr<const GradFile>>& gradients() const { return gradients_; }
 
     std::shared_ptr<const Reference> ref() const { return ref_; }
 };
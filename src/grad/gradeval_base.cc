@@ -25,14 +25,116 @@
 
 
 #include <src/grad/gradeval_base.h>
+#include <src/df/dfcost.h>
 #include <src/util/taskqueue.h>
 #include <src/util/parallel/resources.h>
 #include <src/util/parallel/mpi_interface.h>
+#include <map>
 #include <array>
+#include <functional>
 
 using namespace std;
 using namespace bagel;
 
+namespace {
+  // products of primitives (including the contraction coefficients) below this are neglected in the 3-index gradient
+  const double pair_thresh__ = 1.0e-14;
+
+  struct ShellInfo {
+    shared_ptr<const Shell> shell;
+    int atom;
+    int offset;
+  };
+
+  // shells in the order of the atom and shell loops
+  vector<ShellInfo> flatten(const vector<shared_ptr<const Atom>>& atoms, const vector<vector<int>>& offsets, const bool skip_dummy = false) {
+    vector<ShellInfo> out;
+    for (int iatom = 0; iatom != atoms.size(); ++iatom) {
+      if (skip_dummy && atoms[iatom]->dummy()) continue;
+      for (int i = 0; i != atoms[iatom]->shells().size(); ++i)
+        out.push_back({atoms[iatom]->shells()[i], iatom, offsets[iatom][i]});
+    }
+    return out;
+  }
+
+  // flags of the shell pairs (nshell x nshell) that have at least one non-negligible primitive product at this geometry
+  vector<char> significant_pairs(const vector<ShellInfo>& shells) {
+    const size_t nshell = shells.size();
+    vector<vector<double>> cmax(nshell);
+    for (size_t i = 0; i != nshell; ++i) {
+      const Shell& s = *shells[i].shell;
+      cmax[i].resize(s.num_primitive(), 0.0);
+      for (int k = 0; k != s.num_contracted(); ++k)
+        for (int j = s.contraction_ranges(k).first; j != s.contraction_ranges(k).second; ++j)
+          cmax[i][j] = max(cmax[i][j], fabs(s.contractions()[k][j]));
+    }
+
+    vector<char> out(nshell*nshell, 0);
+    for (size_t i = 0; i != nshell; ++i)
+      for (size_t j = 0; j <= i; ++j) {
+        const Shell& a = *shells[i].shell;
+        const Shell& b = *shells[j].shell;
+        const double rsq = pow(a.position(0)-b.position(0), 2) + pow(a.position(1)-b.position(1), 2) + pow(a.position(2)-b.position(2), 2);
+        bool found = false;
+        for (int ia = 0; ia != a.num_primitive() && !found; ++ia)
+          for (int ib = 0; ib != b.num_primitive() && !found; ++ib) {
+            const double ea = a.exponents(ia);
+            const double eb = b.exponents(ib);
+            found = cmax[i][ia] * cmax[j][ib] * exp(-rsq * ea * eb / (ea + eb)) > pair_thresh__;
+          }
+        out[i*nshell+j] = out[j*nshell+i] = found;
+      }
+    return out;
+  }
+
+  // Shell triples (b0, b1, b2) whose auxiliary shell b2 is local to this process, in the order of decreasing cost.
+  // They depend only on the shape of the basis sets and on the distribution of the auxiliary index, and are therefore
+  // cached and reused by subsequent gradient evaluations (e.g., in geometry optimizations).
+  shared_ptr<const vector<array<int,3>>> shell_triples(const vector<ShellInfo>& shells, const vector<ShellInfo>& aux,
+                                                       shared_ptr<const StaticDist> adist, const bool symmetric) {
+    vector<int> key = {symmetric, mpi__->rank(), mpi__->size()};
+    for (auto& list : {&shells, &aux}) {
+      key.push_back(list->size());
+      for (auto& i : *list)
+        key.insert(key.end(), {i.atom, i.offset, i.shell->angular_number(), i.shell->num_primitive(), i.shell->nbasis()});
+    }
+    for (auto& i : adist->atable())
+      key.push_back(i.first);
+
+    static mutex mtx;
+    static map<vector<int>, shared_ptr<const vector<array<int,3>>>> cache;
+    {
+      lock_guard<mutex> lock(mtx);
+      auto iter = cache.find(key);
+      if (iter != cache.end())
+        return iter->second;
+    }
+
+    vector<array<int,3>> triples;
+    vector<double> cost;
+    for (int i0 = 0; i0 != shells.size(); ++i0)
+      for (int i1 = symmetric ? i0 : 0; i1 != shells.size(); ++i1)
+        for (int i2 = 0; i2 != aux.size(); ++i2) {
+          if (get<0>(adist->locate(aux[i2].offset)) != mpi__->rank()) continue;
+          triples.push_back({{i0, i1, i2}});
+          cost.push_back(DFCostModel::estimate(*shells[i0].shell, *shells[i1].shell, *aux[i2].shell));
+        }
+
+    // expensive batches first so that the threads finish at about the same time
+    auto out = make_shared<vector<array<int,3>>>();
+    out->reserve(triples.size());
+    for (auto& i : DFCostModel::order(cost))
+      out->push_back(triples[i]);
+
+    lock_guard<mutex> lock(mtx);
+    // entries of previous calculations are not kept around indefinitely
+    if (cache.size() > 8)
+      cache.clear();
+    cache.emplace(key, out);
+    return out;
+  }
+}
+
 shared_ptr<GradFile> GradEval_base::contract_gradient(const shared_ptr<const Matrix> d, const shared_ptr<const Matrix> w,
                                                       const shared_ptr<const DFDist> o, const shared_ptr<const Matrix> o2,
                                                       const shared_ptr<const Geometry> g2, const shared_ptr<const DFDist> g2o, const shared_ptr<const Matrix> g2o2) {
@@ -149,47 +251,24 @@ vector<shared_ptr<GradTask>> GradEval_base::contract_gradsmall1e(array<shared_pt
 
 vector<shared_ptr<GradTask>> GradEval_base::contract_grad2e(const array<shared_ptr<const DFDist>,6> o, const shared_ptr<const Geometry> geom) {
   shared_ptr<const Geometry> cgeom = geom ? geom : geom_;
-  vector<shared_ptr<GradTask>> out;
-  const size_t nshell  = std::accumulate(cgeom->atoms().begin(), cgeom->atoms().end(), 0,
-                                          [](const int& i, const std::shared_ptr<const Atom>& o) { return i+o->shells().size(); });
-  const size_t nshell2  = std::accumulate(cgeom->aux_atoms().begin(), cgeom->aux_atoms().end(), 0,
-                                          [](const int& i, const std::shared_ptr<const Atom>& o) { return i+o->shells().size(); });
-
-  out.reserve(nshell*nshell*nshell2);
-
-  int iatom0 = 0;
-  auto oa0 = cgeom->offsets().begin();
-  for (auto a0 = cgeom->atoms().begin(); a0 != cgeom->atoms().end(); ++a0, ++oa0, ++iatom0) {
-    int iatom1 = 0;
-    auto oa1 = cgeom->offsets().begin();
-    for (auto a1 = cgeom->atoms().begin(); a1 != cgeom->atoms().end(); ++a1, ++oa1, ++iatom1) {
-      int iatom2 = 0;
-      auto oa2 = cgeom->aux_offsets().begin();
-      for (auto a2 = cgeom->aux_atoms().begin(); a2 != cgeom->aux_atoms().end(); ++a2, ++oa2, ++iatom2) {
-        if ((*a2)->dummy()) continue;
-        // dummy shell
-        auto b3 = make_shared<const Shell>((*a2)->shells().front()->spherical());
-
-        auto o0 = oa0->begin();
-        for (auto b0 = (*a0)->shells().begin(); b0 != (*a0)->shells().end(); ++b0, ++o0) {
-          auto o1 = oa1->begin();
-          for (auto b1 = (*a1)->shells().begin(); b1 != (*a1)->shells().end(); ++b1, ++o1) {
-            auto o2 = oa2->begin();
-            for (auto b2 = (*a2)->shells().begin(); b2 != (*a2)->shells().end(); ++b2, ++o2) {
-              tuple<size_t, size_t> info = o[0]->adist_now()->locate(*o2);
-              if (get<0>(info) != mpi__->rank()) continue;
+  const vector<ShellInfo> shells = flatten(cgeom->atoms(), cgeom->offsets());
+  const vector<ShellInfo> aux = flatten(cgeom->aux_atoms(), cgeom->aux_offsets(), true);
+  // dummy shell
+  auto b3 = make_shared<const Shell>(cgeom->spherical());
 
-              array<shared_ptr<const Shell>,4> input = {{b3, *b2, *b1, *b0}};
-              vector<int> atoms = {iatom0, iatom1, iatom2};
-              vector<int> offs = {*o0, *o1, *o2};
-
-              out.push_back(make_shared<GradTask3r>(input, atoms, offs, o, this));
-            }
-          }
-        }
-
-      }
-    }
+  // the small-component integrals are not screened, as kinetic balance enlarges the coefficients
+  vector<shared_ptr<GradTask>> out;
+  shared_ptr<const vector<array<int,3>>> triples = shell_triples(shells, aux, o[0]->adist_now(), false);
+  out.reserve(triples->size());
+  for (auto& t : *triples) {
+    const ShellInfo& b0 = shells[t[0]];
+    const ShellInfo& b1 = shells[t[1]];
+    const ShellInfo& b2 = aux[t[2]];
+
+    array<shared_ptr<const Shell>,4> input = {{b3, b2.shell, b1.shell, b0.shell}};
+    vector<int> atoms = {b0.atom, b1.atom, b2.atom};
+    vector<int> offs = {b0.offset, b1.offset, b2.offset};
+    out.push_back(make_shared<GradTask3r>(input, atoms, offs, o, this));
   }
   return out;
 }
@@ -246,48 +325,26 @@ vector<shared_ptr<GradTask>> GradEval_base::contract_grad1e_fnai(const array<sha
 
 vector<shared_ptr<GradTask>> GradEval_base::contract_grad2e(const shared_ptr<const DFDist> o, const shared_ptr<const Geometry> geom) {
   shared_ptr<const Geometry> cgeom = geom ? geom : geom_;
-  vector<shared_ptr<GradTask>> out;
-  const size_t nshell  = std::accumulate(cgeom->atoms().begin(), cgeom->atoms().end(), 0,
-                                          [](const int& i, const std::shared_ptr<const Atom>& o) { return i+o->shells().size(); });
-  const size_t nshell2  = std::accumulate(cgeom->aux_atoms().begin(), cgeom->aux_atoms().end(), 0,
-                                          [](const int& i, const std::shared_ptr<const Atom>& o) { return i+o->shells().size(); });
-
-  out.reserve(nshell*(nshell+1)*nshell2/2);
-
-  // loop over atoms (using symmetry b0 <-> b1)
-  int iatom0 = 0;
-  auto oa0 = cgeom->offsets().begin();
-  for (auto a0 = cgeom->atoms().begin(); a0 != cgeom->atoms().end(); ++a0, ++oa0, ++iatom0) {
-    int iatom1 = iatom0;
-    auto oa1 = oa0;
-    for (auto a1 = a0; a1 != cgeom->atoms().end(); ++a1, ++oa1, ++iatom1) {
-      int iatom2 = 0;
-      auto oa2 = cgeom->aux_offsets().begin();
-      for (auto a2 = cgeom->aux_atoms().begin(); a2 != cgeom->aux_atoms().end(); ++a2, ++oa2, ++iatom2) {
-        if ((*a2)->dummy()) continue;
-        // dummy shell
-        auto b3 = make_shared<const Shell>((*a2)->shells().front()->spherical());
+  const vector<ShellInfo> shells = flatten(cgeom->atoms(), cgeom->offsets());
+  const vector<ShellInfo> aux = flatten(cgeom->aux_atoms(), cgeom->aux_offsets(), true);
+  const vector<char> significant = significant_pairs(shells);
+  // dummy shell
+  auto b3 = make_shared<const Shell>(cgeom->spherical());
 
-        auto o0 = oa0->begin();
-        for (auto b0 = (*a0)->shells().begin(); b0 != (*a0)->shells().end(); ++b0, ++o0) {
-          auto o1 = a0!=a1 ? oa1->begin() : o0;
-          for (auto b1 = (a0!=a1 ? (*a1)->shells().begin() : b0); b1 != (*a1)->shells().end(); ++b1, ++o1) {
-            auto o2 = oa2->begin();
-            for (auto b2 = (*a2)->shells().begin(); b2 != (*a2)->shells().end(); ++b2, ++o2) {
-              tuple<size_t, size_t> info = o->adist_now()->locate(*o2);
-              if (get<0>(info) != mpi__->rank()) continue;
-
-              array<shared_ptr<const Shell>,4> input = {{b3, *b2, *b1, *b0}};
-              vector<int> atoms = {iatom0, iatom1, iatom2};
-              vector<int> offs = {*o0, *o1, *o2};
-
-              out.push_back(make_shared<GradTask3>(input, atoms, offs, o, this));
-            }
-          }
-        }
-
-      }
-    }
+  // using symmetry b0 <-> b1
+  vector<shared_ptr<GradTask>> out;
+  shared_ptr<const vector<array<int,3>>> triples = shell_triples(shells, aux, o->adist_now(), true);
+  out.reserve(triples->size());
+  for (auto& t : *triples) {
+    const ShellInfo& b0 = shells[t[0]];
+    const ShellInfo& b1 = shells[t[1]];
+    const ShellInfo& b2 = aux[t[2]];
+    if (!significant[t[0]*shells.size()+t[1]]) continue;
+
+    array<shared_ptr<const Shell>,4> input = {{b3, b2.shell, b1.shell, b0.shell}};
+    vector<int> atoms = {b0.atom, b1.atom, b2.atom};
+    vector<int> offs = {b0.offset, b1.offset, b2.offset};
+    out.push_back(make_shared<GradTask3>(input, atoms, offs, o, this));
   }
   return out;
 }
@@ -295,42 +352,59 @@ vector<shared_ptr<GradTask>> GradEval_base::contract_grad2e(const shared_ptr<con
 
 vector<shared_ptr<GradTask>> GradEval_base::contract_grad2e_2index(const shared_ptr<const Matrix> den, const shared_ptr<const Geometry> geom) {
   shared_ptr<const Geometry> cgeom = geom ? geom : geom_;
-  vector<shared_ptr<GradTask>> out;
   const size_t nshell2  = std::accumulate(cgeom->aux_atoms().begin(), cgeom->aux_atoms().end(), 0,
                                           [](const int& i, const std::shared_ptr<const Atom>& o) { return i+o->shells().size(); });
-  out.reserve(nshell2*(nshell2+1)/2);
 
   // using symmetry (b0 <-> b1)
-  int cnt = 0;
-  int iatom0 = 0;
-  auto oa0 = cgeom->aux_offsets().begin();
-  for (auto a0 = cgeom->aux_atoms().begin(); a0 != cgeom->aux_atoms().end(); ++a0, ++oa0, ++iatom0) {
-    int iatom1 = iatom0;
-    auto oa1 = oa0;
-    for (auto a1 = a0; a1 != cgeom->aux_atoms().end(); ++a1, ++oa1, ++iatom1) {
-      if ((*a0)->dummy() || (*a1)->dummy()) continue;
-
-      // dummy shell
-      auto b3 = make_shared<const Shell>((*a0)->shells().front()->spherical());
-
-      auto o0 = oa0->begin();
-      for (auto b0 = (*a0)->shells().begin(); b0 != (*a0)->shells().end(); ++b0, ++o0) {
-        auto o1 = a0!=a1 ? oa1->begin() : o0;
-        for (auto b1 = (a0!=a1 ? (*a1)->shells().begin() : b0); b1 != (*a1)->shells().end(); ++b1, ++o1) {
-
-          // static distribution since this is cheap
-          if (cnt++ % mpi__->size() != mpi__->rank()) continue;
+  auto loop = [&](function<void(shared_ptr<const Shell>, shared_ptr<const Shell>, shared_ptr<const Shell>, const int, const int, const int, const int)> f) {
+    int iatom0 = 0;
+    auto oa0 = cgeom->aux_offsets().begin();
+    for (auto a0 = cgeom->aux_atoms().begin(); a0 != cgeom->aux_atoms().end(); ++a0, ++oa0, ++iatom0) {
+      int iatom1 = iatom0;
+      auto oa1 = oa0;
+      for (auto a1 = a0; a1 != cgeom->aux_atoms().end(); ++a1, ++oa1, ++iatom1) {
+        if ((*a0)->dummy() || (*a1)->dummy()) continue;
 
-          array<shared_ptr<const Shell>,4> input = {{*b1, b3, *b0, b3}};
-          vector<int> atoms = {iatom0, iatom1};
-          vector<int> offs = {*o0, *o1};
+        // dummy shell
+        auto b3 = make_shared<const Shell>((*a0)->shells().front()->spherical());
 
-          out.push_back(make_shared<GradTask2>(input, atoms, offs, den, this));
+        auto o0 = oa0->begin();
+        for (auto b0 = (*a0)->shells().begin(); b0 != (*a0)->shells().end(); ++b0, ++o0) {
+          auto o1 = a0!=a1 ? oa1->begin() : o0;
+          for (auto b1 = (a0!=a1 ? (*a1)->shells().begin() : b0); b1 != (*a1)->shells().end(); ++b1, ++o1)
+            f(*b0, *b1, b3, iatom0, iatom1, *o0, *o1);
         }
       }
     }
-  }
-  return out;
+  };
+
+  // distributed according to the estimated cost; every process arrives at the same assignment
+  vector<double> cost;
+  cost.reserve(nshell2*(nshell2+1)/2);
+  loop([&](shared_ptr<const Shell> b0, shared_ptr<const Shell> b1, shared_ptr<const Shell>, const int, const int, const int, const int) {
+    cost.push_back(DFCostModel::estimate(*b1, *b0));
+  });
+  const vector<int> owner = DFCostModel::assign(cost, mpi__->size());
+
+  vector<shared_ptr<GradTask>> out(cost.size());
+  size_t cnt = 0;
+  loop([&](shared_ptr<const Shell> b0, shared_ptr<const Shell> b1, shared_ptr<const Shell> b3, const int iatom0, const int iatom1, const int o0, const int o1) {
+    if (owner[cnt] == mpi__->rank()) {
+      array<shared_ptr<const Shell>,4> input = {{b1, b3, b0, b3}};
+      vector<int> atoms = {iatom0, iatom1};
+      vector<int> offs = {o0, o1};
+
+      out[cnt] = make_shared<GradTask2>(input, atoms, offs, den, this);
+    }
+    ++cnt;
+  });
+
+  // expensive batches first
+  vector<shared_ptr<GradTask>> mine;
+  for (auto& i : DFCostModel::order(cost))
+    if (out[i])
+      mine.push_back(out[i]);
+  return mine;
 }
 
 
@@ -66,7 +66,10 @@ class GradEval_base {
     std::vector<std::mutex> mutex_;
 
   public:
-    GradEval_base(const std::shared_ptr<const Geometry> g) : geom_(g), grad_(std::make_shared<GradFile>(g->natom())), mutex_(g->natom()) { }
+    GradEval_base(const std::shared_ptr<const Geometry> g) : geom_(g), grad_(std::make_shared<GradFile>(g->natom())), mutex_(g->natom()) {
+      if (g->cholesky())
+        throw std::runtime_error("Analytical gradients require an auxiliary basis and are not available with Cholesky-decomposed ERIs");
+    }
 
     /// compute gradient given density matrices
     std::shared_ptr<GradFile> contract_gradient(const std::shared_ptr<const Matrix> d, const std::shared_ptr<const Matrix> w,
@@ -60,16 +60,16 @@ void GradTask3::compute() {
   shared_ptr<btas::Tensor3<double>> db2 = den_->get_block(offset_[2], shell_[1]->nbasis(), offset_[0], shell_[3]->nbasis(), offset_[1], shell_[2]->nbasis());
   sort_indices<0,2,1,1,1,1,1>(db2->data(), db1->data(), shell_[1]->nbasis(), shell_[3]->nbasis(), shell_[2]->nbasis());
 
+  // all 12 derivatives contracted with the density in one pass over the batch
+  assert(gradbatch.data(11) - gradbatch.data(0) == 11*gradbatch.size_block());
+  array<double,12> sum;
+  dgemv_("T", sblock, 12, 1.0, gradbatch.data(0), gradbatch.size_block(), db1->data(), 1, 0.0, sum.data(), 1);
+
   for (int iatom = 0; iatom != 4; ++iatom) {
     if (jatom[iatom] < 0) continue;
-    array<double,3> sum = {{0.0, 0.0, 0.0}};
-    for (int icart = 0; icart != 3; ++icart) {
-      const double* ppt = gradbatch.data(icart+iatom*3);
-      sum[icart] += blas::dot_product(ppt, sblock, db1->data());
-    }
     lock_guard<mutex> lock(ge_->mutex_[jatom[iatom]]);
     for (int icart = 0; icart != 3; ++icart)
-      ge_->grad_->element(icart, jatom[iatom]) += 0.5 * sum[icart] * (shell_[2] == shell_[3] ? 1.0 : 2.0);
+      ge_->grad_->element(icart, jatom[iatom]) += 0.5 * sum[icart+iatom*3] * (shell_[2] == shell_[3] ? 1.0 : 2.0);
   }
 }
 
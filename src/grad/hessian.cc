@@ -0,0 +1,299 @@
+//
+// BAGEL - Parallel electron correlation program.
+// Filename: hessian.cc
+// Copyright (C) 2026 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// The BAGEL package is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 3, or (at your option)
+// any later version.
+//
+// The BAGEL package is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the BAGEL package; see COPYING.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+
+
+#include <src/grad/hessian.h>
+#include <src/grad/force.h>
+#include <src/wfn/construct_method.h>
+#include <src/util/atommap.h>
+#include <src/util/timer.h>
+#include <src/util/parallel/mpi_interface.h>
+
+using namespace std;
+using namespace bagel;
+
+Hessian::Hessian(shared_ptr<const PTree> idata, shared_ptr<const Geometry> g, shared_ptr<const Reference> r)
+ : idata_(idata), geom_(g), ref_(r), dx_(idata->get<double>("dx", 1.0e-3)) {
+
+  auto method = idata_->get_child("method");
+  for (auto& m : *method)
+    if (to_lower(m->get<string>("title", "")) == "molecule")
+      throw runtime_error("molecule blocks cannot be used in hessian; place them before the hessian block");
+  if (dx_ <= 0.0)
+    throw runtime_error("dx in hessian should be positive");
+
+  // external point charges are neither displaced nor part of the vibrational analysis
+  for (int a = 0; a != geom_->natom(); ++a)
+    if (!geom_->atoms(a)->dummy())
+      nuclei_.push_back(a);
+
+  // masses are checked here so that a missing one does not surface after all the gradients have been computed
+  if (idata_->get_child_optional("masses")) {
+    mass_ = idata_->get_vector<double>("masses", nuclei_.size());
+  } else {
+    AtomMap atommap;
+    for (auto& a : nuclei_)
+      mass_.push_back(atommap.mass(geom_->atoms(a)->name()));
+  }
+}
+
+
+shared_ptr<const GradFile> Hessian::gradient(const Displacement& d, shared_ptr<const Geometry> c1geom, shared_ptr<const Reference> ref) const {
+  auto displ = make_shared<Matrix>(3, c1geom->natom(), true);
+  displ->element(d.xyz, nuclei_[d.atom]) = d.sign * dx_;
+  auto geominfo = make_shared<PTree>();
+  geominfo->put("thresh_overlap", c1geom->overlap_thresh());
+  auto geom = make_shared<const Geometry>(*c1geom, displ, geominfo, /*rotate*/false);
+
+  // only the last block is run; the preceding ones have provided the orbitals at the reference geometry
+  shared_ptr<const PTree> last;
+  auto method = idata_->get_child("method");
+  for (auto& m : *method)
+    last = m;
+  auto methods = make_shared<PTree>();
+  methods->push_back(make_shared<PTree>(*last));
+  auto input = make_shared<PTree>();
+  input->add_child("method", methods);
+  Force force(input, geom, ref ? ref->project_coeff(geom) : nullptr);
+  return force.compute();
+}
+
+
+void Hessian::compute() {
+  const int natom = nuclei_.size();
+  const int n = natom*3;
+  Timer timer;
+
+  // calculation at the reference geometry, which provides the starting orbitals for all the displacements
+  shared_ptr<const Reference> ref = ref_;
+  double energy = 0.0;
+  auto method = idata_->get_child("method");
+  for (auto& m : *method) {
+    const string title = to_lower(m->get<string>("title", ""));
+    shared_ptr<Method> c = construct_method(title, m, geom_, ref);
+    if (!c) throw runtime_error("unknown method in hessian: " + title);
+    c->compute();
+    if (shared_ptr<const Reference> r = c->conv_to_ref()) {
+      ref = r;
+      energy = r->energy();
+    }
+  }
+  timer.tick_print("Reference calculation");
+
+  // Symmetry operations of the groups in Petite are diagonal; sign[op][i] is the sign of the i-th Cartesian
+  // coordinate under op and amap[atom][op] is the image of atom. Point charges are only allowed in C1, so
+  // with symmetry the atoms in the Hessian are those of the geometry.
+  shared_ptr<const Petite> plist = geom_->plist();
+  bool symmetry = idata_->get<bool>("symmetry", true) && plist->nirrep() > 1 && natom == geom_->natom();
+  vector<array<int,3>> sign;
+  vector<vector<int>> amap;
+  if (symmetry) {
+    for (int op = 0; op != plist->nsymop(); ++op) {
+      const vector<double> s = plist->symop(op);
+      for (int i = 0; i != 9; ++i)
+        if (i % 4 != 0 && s[i] != 0.0)
+          symmetry = false;
+      sign.push_back({{s[0] > 0.0 ? 1 : -1, s[4] > 0.0 ? 1 : -1, s[8] > 0.0 ? 1 : -1}});
+    }
+    for (int a = 0; a != natom; ++a)
+      amap.push_back(plist->sym_atommap(a));
+  }
+  if (!symmetry) {
+    sign = {{{1, 1, 1}}};
+    amap.clear();
+    for (int a = 0; a != natom; ++a)
+      amap.push_back({a});
+  }
+  const int nop = sign.size();
+
+  // An atom is unique if it is the first of its equivalents. The negative displacement of a unique atom is not computed
+  // if an operation that leaves the atom in place flips the direction: its gradient is the image of the positive one.
+  vector<Displacement> jobs;
+  vector<int> plus(n, -1), minus(n, -1), mirror(n, -1);
+  for (int a = 0; a != natom; ++a) {
+    if (*min_element(amap[a].begin(), amap[a].end()) < a)
+      continue;
+    for (int x = 0; x != 3; ++x) {
+      plus[3*a+x] = jobs.size();
+      jobs.push_back({a, x, 1});
+      for (int op = 0; op != nop; ++op)
+        if (amap[a][op] == a && sign[op][x] < 0) {
+          mirror[3*a+x] = op;
+          break;
+        }
+      if (mirror[3*a+x] < 0) {
+        minus[3*a+x] = jobs.size();
+        jobs.push_back({a, x, -1});
+      }
+    }
+  }
+  const int njob = jobs.size();
+  const int ngroup = max(1, min({idata_->get<int>("ngroup", mpi__->size()), njob, mpi__->size()}));
+  cout << "  *** Numerical Hessian: " << njob << " of " << 2*n << " displaced gradients in " << ngroup << " process groups" << endl << endl;
+
+  // displaced geometries carry no symmetry
+  auto c1info = make_shared<PTree>();
+  c1info->put("symmetry", "c1");
+  auto c1geom = make_shared<const Geometry>(*geom_, c1info, /*discard_prev_df*/false);
+
+  // results are stored on the first process of each group and summed over all processes afterwards
+  vector<double> grad(njob*n, 0.0);
+  vector<int> status(njob, 0);
+  const int group = mpi__->split(ngroup);
+  for (int i = group; i < njob; i += ngroup) {
+    int failed = 0;
+    try {
+      shared_ptr<const GradFile> g = gradient(jobs[i], c1geom, ref);
+      if (mpi__->rank() == 0)
+        for (int a = 0; a != natom; ++a)
+          for (int x = 0; x != 3; ++x)
+            grad[i*n+3*a+x] = g->element(x, nuclei_[a]);
+    } catch (const exception& e) {
+      failed = 1;
+      cout << "  * displacement " << i << " failed: " << e.what() << endl;
+    }
+    // the processes of a group agree on the outcome before moving on to the next displacement
+    mpi__->allreduce(&failed, 1);
+    if (mpi__->rank() == 0)
+      status[i] = failed ? -1 : 1;
+  }
+  mpi__->merge();
+  mpi__->allreduce(status.data(), njob);
+  mpi__->allreduce(grad.data(), grad.size());
+  // raised only after all the groups are done so that no process is left waiting in a collective operation
+  if (count(status.begin(), status.end(), 1) != njob)
+    throw runtime_error("some of the displaced gradients in hessian failed");
+  timer.tick_print("Displaced gradients");
+
+  // central differences for the unique atoms, then the other columns by the symmetry operations
+  hess_ = make_shared<Matrix>(n, n, true);
+  vector<double> gm(n), col(n);
+  for (int k = 0; k != n; ++k) {
+    if (plus[k] < 0) continue;
+    const int a = k/3;
+    const int x = k%3;
+    const double* gp = grad.data() + plus[k]*n;
+    if (minus[k] >= 0) {
+      copy_n(grad.data() + minus[k]*n, n, gm.begin());
+    } else {
+      const int op = mirror[k];
+      for (int b = 0; b != natom; ++b)
+        for (int i = 0; i != 3; ++i)
+          gm[3*amap[b][op]+i] = sign[op][i] * gp[3*b+i];
+    }
+    for (int l = 0; l != n; ++l)
+      col[l] = (gp[l] - gm[l]) / (2.0*dx_);
+    for (int op = 0; op != nop; ++op)
+      for (int b = 0; b != natom; ++b)
+        for (int i = 0; i != 3; ++i)
+          hess_->element(3*amap[b][op]+i, 3*amap[a][op]+x) = sign[op][i] * sign[op][x] * col[3*b+i];
+  }
+  // removes the asymmetry from finite differences
+  hess_->symmetrize();
+
+  cout << endl << "    * Energy at the reference geometry: " << setprecision(10) << fixed << energy << endl << endl;
+  hess_->print("Hessian");
+  compute_frequencies();
+}
+
+
+void Hessian::compute_frequencies() {
+  const int natom = nuclei_.size();
+  const int n = natom*3;
+
+  vector<double> mass(natom);
+  vector<array<double,3>> position(natom);
+  array<double,3> com{{0.0, 0.0, 0.0}};
+  double total = 0.0;
+  for (int a = 0; a != natom; ++a) {
+    mass[a] = mass_[a] * amu2au__;
+    position[a] = geom_->atoms(nuclei_[a])->position();
+    total += mass[a];
+    for (int i = 0; i != 3; ++i)
+      com[i] += mass[a] * position[a][i];
+  }
+  for (auto& i : com)
+    i /= total;
+
+  // mass-weighted Hessian
+  auto hm = hess_->copy();
+  for (int k = 0; k != n; ++k)
+    for (int l = 0; l != n; ++l)
+      hm->element(l, k) /= std::sqrt(mass[l/3] * mass[k/3]);
+
+  // translations and infinitesimal rotations in mass-weighted coordinates, orthonormalized (five for linear molecules)
+  auto tr = make_shared<Matrix>(n, 6, true);
+  for (int a = 0; a != natom; ++a) {
+    const double sm = std::sqrt(mass[a]);
+    const array<double,3> r{{position[a][0]-com[0], position[a][1]-com[1], position[a][2]-com[2]}};
+    for (int i = 0; i != 3; ++i) {
+      tr->element(3*a+i, i) = sm;
+      // e_i x r
+      tr->element(3*a+(i+2)%3, 3+i) =  sm * r[(i+1)%3];
+      tr->element(3*a+(i+1)%3, 3+i) = -sm * r[(i+2)%3];
+    }
+  }
+  int nproj = 0;
+  for (int j = 0; j != 6; ++j) {
+    double* v = tr->element_ptr(0, j);
+    for (int k = 0; k != nproj; ++k) {
+      const double* u = tr->element_ptr(0, k);
+      const double d = inner_product(u, u+n, v, 0.0);
+      transform(v, v+n, u, v, [&d](double a, double b) { return a - d*b; });
+    }
+    const double norm = std::sqrt(inner_product(v, v+n, v, 0.0));
+    if (norm > 1.0e-6) {
+      transform(v, v+n, tr->element_ptr(0, nproj++), [&norm](double a) { return a/norm; });
+    }
+  }
+  auto proj = make_shared<Matrix>(n, n, true);
+  proj->unit();
+  for (int k = 0; k != nproj; ++k)
+    for (int l = 0; l != n; ++l)
+      for (int m = 0; m != n; ++m)
+        proj->element(m, l) -= tr->element(m, k) * tr->element(l, k);
+  *hm = *proj * *hm * *proj;
+
+  VectorB eig(n);
+  hm->diagonalize(eig);
+
+  // the nproj eigenvalues closest to zero belong to the projected modes
+  vector<int> order(n);
+  iota(order.begin(), order.end(), 0);
+  sort(order.begin(), order.end(), [&eig](const int i, const int j) { return fabs(eig(i)) < fabs(eig(j)); });
+  vector<bool> vib(n, true);
+  for (int k = 0; k != min(nproj, n); ++k)
+    vib[order[k]] = false;
+
+  freq_.clear();
+  for (int k = 0; k != n; ++k)
+    if (vib[k])
+      freq_.push_back((eig(k) < 0.0 ? -1.0 : 1.0) * std::sqrt(fabs(eig(k))) * au2wavenumber__);
+
+  cout << endl << "    * Harmonic frequencies (cm-1; imaginary ones are shown as negative)" << endl << endl;
+  for (int k = 0; k != static_cast<int>(freq_.size()); ++k)
+    cout << setw(9) << k << setw(16) << setprecision(2) << fixed << freq_[k] << endl;
+  cout << endl;
+}
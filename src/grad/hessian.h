@@ -0,0 +1,79 @@
+//
+// BAGEL - Parallel electron correlation program.
+// Filename: hessian.h
+// Copyright (C) 2026 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// The BAGEL package is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 3, or (at your option)
+// any later version.
+//
+// The BAGEL package is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the BAGEL package; see COPYING.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+
+
+#ifndef __SRC_GRAD_HESSIAN_H
+#define __SRC_GRAD_HESSIAN_H
+
+#include <src/wfn/reference.h>
+#include <src/util/math/xyzfile.h>
+
+namespace bagel {
+
+// Nuclear Hessian by central differences of analytical gradients, and harmonic frequencies.
+// The method blocks in "method" are first run at the input geometry; every displaced calculation starts from these
+// orbitals projected onto the displaced geometry. The displaced gradients are computed concurrently in "ngroup"
+// process groups. When the molecule has symmetry, displacements of symmetry-equivalent atoms, and negative displacements
+// that are images of positive ones, are not computed; the corresponding Hessian elements are generated by the symmetry operations.
+// The Hessian covers the atoms that are not point charges. Masses are those of the most abundant isotopes unless given in "masses" (amu).
+class Hessian {
+  protected:
+    const std::shared_ptr<const PTree> idata_;
+    std::shared_ptr<const Geometry> geom_;
+    std::shared_ptr<const Reference> ref_;
+
+    // step size in bohr
+    double dx_;
+    // indices of the atoms in the geometry that are not point charges, and their masses in amu
+    std::vector<int> nuclei_;
+    std::vector<double> mass_;
+
+    std::shared_ptr<Matrix> hess_;
+    // harmonic frequencies in cm-1 (imaginary ones are negative)
+    std::vector<double> freq_;
+
+    struct Displacement {
+      int atom;
+      int xyz;
+      int sign;
+    };
+
+    // runs the method blocks at the displaced geometry in the current process group
+    std::shared_ptr<const GradFile> gradient(const Displacement& d, std::shared_ptr<const Geometry> c1geom, std::shared_ptr<const Reference> ref) const;
+
+    void compute_frequencies();
+
+  public:
+    Hessian(std::shared_ptr<const PTree>, std::shared_ptr<const Geometry>, std::shared_ptr<const Reference>);
+
+    void compute();
+
+    std::shared_ptr<const Matrix> hessian() const { return hess_; }
+    const std::vector<double>& frequencies() const { return freq_; }
+};
+
+}
+
+#endif
@@ -26,19 +26,20 @@
 #include <algorithm>
 #include <cassert>
 #include <src/integral/rys/breitrootlist.h>
+#include <src/integral/rys/rootinterpolation.h>
 
 using namespace std;
 using namespace bagel;
 
 void BreitRootList::breitroot13(const double* ta, double* rr, double* ww, const int n) {
 
-  constexpr double ax[13] = {7.208202589466973e-01,1.796131365633884e-01,1.630899655950554e+00,2.922597921220351e+00,4.615178476472022e+00,
+  static constexpr double ax[13] = {7.208202589466973e-01,1.796131365633884e-01,1.630899655950554e+00,2.922597921220351e+00,4.615178476472022e+00,
     6.736185972285235e+00,9.324365594647540e+00,1.243461777443965e+01,1.614688493695546e+01,2.058352207215326e+01,2.594791911981656e+01,3.262986350068336e+01,
     4.162753157986593e+01};
-  constexpr double aw[13] = {1.494768436328437e-01,6.367596495535342e-02,1.372778489802784e-01,6.843535893685798e-02,2.022038839755062e-02,
+  static constexpr double aw[13] = {1.494768436328437e-01,6.367596495535342e-02,1.372778489802784e-01,6.843535893685798e-02,2.022038839755062e-02,
     3.615779955547196e-03,3.866588766540874e-04,2.381578592958704e-05,7.904546713574322e-07,1.266922283453344e-08,8.132383035028306e-11,1.458806950273524e-13,
     2.953797767717638e-17};
-  constexpr double x[4992] = {  2.508282882833451e-02, -4.424877074139207e-04,  5.781441055729038e-06, -6.601030133076684e-08,  6.907825890279364e-10,
+  static constexpr double x[4992] = {  2.508282882833451e-02, -4.424877074139207e-04,  5.781441055729038e-06, -6.601030133076684e-08,  6.907825890279364e-10,
  -6.738826304772121e-12,  6.146298673460683e-14, -5.202500484468878e-16,  3.996142229164310e-18, -2.631256442088735e-20,  1.218844613690991e-22,  1.278932969233528e-25,
   9.915491252753597e-02, -1.685785490186414e-03,  2.039795858187348e-05, -2.028045984772987e-07,  1.667770689872272e-09, -1.034673234090061e-11,  2.602811621508794e-14,
   4.859619847574185e-16, -1.031693975402992e-17,  1.242462791227185e-19, -1.061768007227518e-21,  5.343334261285823e-24,  2.187254734474121e-01, -3.492107140854285e-03,
@@ -752,7 +753,7 @@ void BreitRootList::breitroot13(const double* ta, double* rr, double* ww, const
   5.263482612342911e-14,  1.387687072146717e-15, -7.314084619638154e-17,  1.295190388583023e-18,  7.463017355529250e-21,  1.321551905663069e+00, -1.046033638743049e-02,
   7.975001482449082e-05, -3.990142807933586e-07, -8.380181376866899e-09,  4.689122488315291e-10, -1.305030637845748e-11,  1.987121383533973e-13,  9.463747657437986e-16,
  -1.513769210483442e-16,  4.371462710123245e-18, -5.103184175802390e-20  };
-  constexpr double w[4992] = {  2.765327088534714e-03, -8.928815873649829e-05,  2.036889978751625e-06, -4.007002497264451e-08,  7.221209327302503e-10,
+  static constexpr double w[4992] = {  2.765327088534714e-03, -8.928815873649829e-05,  2.036889978751625e-06, -4.007002497264451e-08,  7.221209327302503e-10,
  -1.223732429557379e-11,  1.977775211779937e-13, -3.075585765343573e-15,  4.630068207263094e-17, -6.777843951418066e-19,  9.680792419159142e-21, -1.352433163143365e-22,
   1.036832505194435e-02, -5.035311399056498e-04,  1.725475774330004e-05, -4.940105534366876e-07,  1.254697974212633e-08, -2.916227576118295e-10,  6.320429754407179e-12,
  -1.293334454927732e-13,  2.520635037595037e-15, -4.709132497650492e-17,  8.474986485987981e-19, -1.474553336685229e-20,  2.098687101885048e-02, -1.570902622881603e-03,
@@ -1466,51 +1467,5 @@ void BreitRootList::breitroot13(const double* ta, double* rr, double* ww, const
  -1.984016212673028e-27,  1.137018223282905e-29,  2.283903718235553e-31,  3.437038468801703e-33, -6.137501937060980e-34,  1.185936057094637e-19, -1.510684389301915e-21,
   2.638554220877842e-23, -1.076237930457874e-24,  5.204472384031319e-26, -2.029713362448632e-27,  6.025986753301793e-29, -1.350062453543268e-30,  2.386593140352401e-32,
  -4.638986639765353e-34,  1.573015594711805e-35, -6.092273884207810e-37  };
-  int offset = -13;
-  for (int i = 1; i <= n; ++i) {
-    double t = ta[i-1];
-    offset += 13;
-    if (std::isnan(t)) {
-      fill_n(rr+offset, 13, 0.5);
-      fill_n(ww+offset, 13, 0.0);
-    } else if (t >= 64.0) {
-      t = 1.0/sqrt(t);
-      for (int r = 0; r != 13; ++r) {
-        rr[offset+r] = ax[r]*t*t;
-        ww[offset+r] = aw[r]*t*t*t;
-      }
-    } else {
-      assert(t >= 0);
-      int it = static_cast<int>(t*   0.500000000000000);
-      t = (t-it*2.000000000000000-   1.000000000000000) *   1.000000000000000;
-      const double t2 = t * 2.0;
-      for (int j=1; j <=13; ++j) {
-        const int boxof = it*156+12*(j-1);
-        double d = x[boxof+11];
-        double e = w[boxof+11];
-        double f = t2*d + x[boxof+10];
-        double g = t2*e + w[boxof+10];
-        d = t2*f - d + x[boxof+9];
-        e = t2*g - e + w[boxof+9];
-        f = t2*d - f + x[boxof+8];
-        g = t2*e - g + w[boxof+8];
-        d = t2*f - d + x[boxof+7];
-        e = t2*g - e + w[boxof+7];
-        f = t2*d - f + x[boxof+6];
-        g = t2*e - g + w[boxof+6];
-        d = t2*f - d + x[boxof+5];
-        e = t2*g - e + w[boxof+5];
-        f = t2*d - f + x[boxof+4];
-        g = t2*e - g + w[boxof+4];
-        d = t2*f - d + x[boxof+3];
-        e = t2*g - e + w[boxof+3];
-        f = t2*d - f + x[boxof+2];
-        g = t2*e - g + w[boxof+2];
-        d = t2*f - d + x[boxof+1];
-        e = t2*g - e + w[boxof+1];
-        rr[offset+j-1] = t*d - f + x[boxof+0]*0.5;
-        ww[offset+j-1] = t*e - g + w[boxof+0]*0.5;
-      }
-    }
-  }
+  rys::interpolate_root<13,3>(ta, rr, ww, n, ax, aw, x, w);
 }
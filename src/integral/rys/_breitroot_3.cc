@@ -26,15 +26,16 @@
 #include <algorithm>
 #include <cassert>
 #include <src/integral/rys/breitrootlist.h>
+#include <src/integral/rys/rootinterpolation.h>
 
 using namespace std;
 using namespace bagel;
 
 void BreitRootList::breitroot3(const double* ta, double* rr, double* ww, const int n) {
 
-  constexpr double ax[3] = {6.663259077023708e-01,2.800775054150257e+00,7.032899038147373e+00};
-  constexpr double aw[3] = {2.835931389201556e-01,1.526858844222733e-01,6.834439383950065e-03};
-  constexpr double x[1152] = {  2.961907909809220e-01, -1.605735324243221e-02,  5.461601556202310e-04, -1.140146882676054e-05, -1.040579594989508e-08,
+  static constexpr double ax[3] = {6.663259077023708e-01,2.800775054150257e+00,7.032899038147373e+00};
+  static constexpr double aw[3] = {2.835931389201556e-01,1.526858844222733e-01,6.834439383950065e-03};
+  static constexpr double x[1152] = {  2.961907909809220e-01, -1.605735324243221e-02,  5.461601556202310e-04, -1.140146882676054e-05, -1.040579594989508e-08,
   1.248027584222446e-08, -5.648281579040981e-10,  1.024513777740748e-11,  3.199855763279449e-13, -2.662139053215769e-14,  6.791712157990545e-16,  2.656489444335588e-18,
   1.033212514316183e+00, -3.330848168086409e-02, -2.177347755717356e-05,  2.450383067515595e-05,  4.794432242539291e-09, -3.294334927233414e-08,  2.359572985965940e-13,
   5.240455914487461e-11,  2.524360743714605e-14, -8.204630353665457e-14, -3.781729656888576e-17,  1.274562553931474e-16,  1.774618490056192e+00, -1.404938734747934e-02,
@@ -199,7 +200,7 @@ void BreitRootList::breitroot3(const double* ta, double* rr, double* ww, const i
   3.528983640199541e-10, -2.800957105067988e-12,  2.223121868588059e-14, -1.764493584562106e-16,  1.400479952833826e-18, -1.111562044943990e-20,  8.822476668869614e-23,
  -7.001965471992198e-25,  2.232947677560585e-01, -1.772292336939267e-03,  1.406669828916502e-05, -1.116474955255525e-07,  8.861470546168907e-10, -7.033356177938709e-12,
   5.582380358646146e-14, -4.430739703738887e-16,  3.516681605159077e-18, -2.791192968021100e-20,  2.215372047101777e-22, -1.758231745438604e-24  };
-  constexpr double w[1152] = {  9.635330367414144e-02, -1.332486870619447e-02,  1.281086487731431e-03, -1.013035815763469e-04,  6.971267803053211e-06,
+  static constexpr double w[1152] = {  9.635330367414144e-02, -1.332486870619447e-02,  1.281086487731431e-03, -1.013035815763469e-04,  6.971267803053211e-06,
  -4.298124459409203e-07,  2.415656381799390e-08, -1.251888479818373e-09,  6.031044953007774e-11, -2.715334480561679e-12,  1.146501077150796e-13, -4.544520420286692e-15,
   1.936961199690184e-01, -4.863548349212126e-02,  7.398866872637872e-03, -8.360928406697557e-04,  7.636203905274582e-05, -5.897570271150017e-06,  3.961280281626444e-07,
  -2.358692555936739e-08,  1.262491758407869e-09, -6.139621658413616e-11,  2.735759301457305e-12, -1.123071727246165e-13,  1.235159348326596e-01, -4.468361826092352e-02,
@@ -364,51 +365,5 @@ void BreitRootList::breitroot3(const double* ta, double* rr, double* ww, const i
   5.965297077020351e-12, -5.208118903855980e-14,  4.478157061037076e-16, -3.808193357860442e-18,  3.211474351262570e-20, -2.690556638029095e-22,  2.242270806786319e-24,
  -1.860459774382405e-26,  2.734164647497666e-05, -3.255086065673756e-07,  3.229430048660795e-09, -2.990389605414107e-11,  2.670152610008024e-13, -2.331228789583521e-15,
   2.004487389347175e-17, -1.704602017787610e-19,  1.437502024111518e-21, -1.204331778463877e-23,  1.003672609854751e-25, -8.327685310446617e-28  };
-  int offset = -3;
-  for (int i = 1; i <= n; ++i) {
-    double t = ta[i-1];
-    offset += 3;
-    if (std::isnan(t)) {
-      fill_n(rr+offset, 3, 0.5);
-      fill_n(ww+offset, 3, 0.0);
-    } else if (t >= 64.0) {
-      t = 1.0/sqrt(t);
-      for (int r = 0; r != 3; ++r) {
-        rr[offset+r] = ax[r]*t*t;
-        ww[offset+r] = aw[r]*t*t*t;
-      }
-    } else {
-      assert(t >= 0);
-      int it = static_cast<int>(t*   0.500000000000000);
-      t = (t-it*2.000000000000000-   1.000000000000000) *   1.000000000000000;
-      const double t2 = t * 2.0;
-      for (int j=1; j <=3; ++j) {
-        const int boxof = it*36+12*(j-1);
-        double d = x[boxof+11];
-        double e = w[boxof+11];
-        double f = t2*d + x[boxof+10];
-        double g = t2*e + w[boxof+10];
-        d = t2*f - d + x[boxof+9];
-        e = t2*g - e + w[boxof+9];
-        f = t2*d - f + x[boxof+8];
-        g = t2*e - g + w[boxof+8];
-        d = t2*f - d + x[boxof+7];
-        e = t2*g - e + w[boxof+7];
-        f = t2*d - f + x[boxof+6];
-        g = t2*e - g + w[boxof+6];
-        d = t2*f - d + x[boxof+5];
-        e = t2*g - e + w[boxof+5];
-        f = t2*d - f + x[boxof+4];
-        g = t2*e - g + w[boxof+4];
-        d = t2*f - d + x[boxof+3];
-        e = t2*g - e + w[boxof+3];
-        f = t2*d - f + x[boxof+2];
-        g = t2*e - g + w[boxof+2];
-        d = t2*f - d + x[boxof+1];
-        e = t2*g - e + w[boxof+1];
-        rr[offset+j-1] = t*d - f + x[boxof+0]*0.5;
-        ww[offset+j-1] = t*e - g + w[boxof+0]*0.5;
-      }
-    }
-  }
+  rys::interpolate_root<3,3>(ta, rr, ww, n, ax, aw, x, w);
 }
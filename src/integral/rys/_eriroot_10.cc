@@ -26,17 +26,18 @@
 #include <algorithm>
 #include <cassert>
 #include <src/integral/rys/erirootlist.h>
+#include <src/integral/rys/rootinterpolation.h>
 
 using namespace std;
 using namespace bagel;
 
 void ERIRootList::eriroot10(const double* ta, double* rr, double* ww, const int n) {
 
-  constexpr double ax[10] = {6.019206314958798e-02,5.438675002946463e-01,1.522944105404443e+00,3.022513376451572e+00,5.084907750098527e+00,
+  static constexpr double ax[10] = {6.019206314958798e-02,5.438675002946463e-01,1.522944105404443e+00,3.022513376451572e+00,5.084907750098527e+00,
     7.777439231525445e+00,1.120813020434867e+01,1.556116333218935e+01,2.119389209630153e+01,2.902495034023622e+01};
-  constexpr double aw[10] = {4.622436696006099e-01,2.866755053628348e-01,1.090172060200231e-01,2.481052088746362e-02,3.243773342237849e-03,
+  static constexpr double aw[10] = {4.622436696006099e-01,2.866755053628348e-01,1.090172060200231e-01,2.481052088746362e-02,3.243773342237849e-03,
     2.283386360163547e-04,7.802556478532124e-06,1.086069370769281e-07,4.399340992273179e-10,2.229393645534142e-13};
-  constexpr double x[3840] = {  1.117385932489869e-02, -2.646305914233087e-04,  4.674253484103585e-06, -7.286013822367724e-08,  1.054622561867043e-09,
+  static constexpr double x[3840] = {  1.117385932489869e-02, -2.646305914233087e-04,  4.674253484103585e-06, -7.286013822367724e-08,  1.054622561867043e-09,
  -1.448499439613784e-11,  1.906334634578126e-13, -2.414645107190344e-15,  2.944572258899868e-17, -3.448320369367669e-19,  3.850746241593759e-21, -4.047000013499268e-23,
   9.919921792121178e-02, -2.249966504965895e-03,  3.633081582117316e-05, -4.823525755147673e-07,  5.302107710432267e-09, -4.409866476747967e-11,  1.525301300038303e-13,
   3.585026809558283e-15, -1.030304163273396e-16,  1.666357113281941e-18, -1.916225725833902e-20,  1.317232803425318e-22,  2.680412851579292e-01, -5.561473348664786e-03,
@@ -585,7 +586,7 @@ void ERIRootList::eriroot10(const double* ta, double* rr, double* ww, const int
   2.666243047217616e-09, -2.093387590181153e-11,  1.549402168408934e-13, -7.711828440230394e-16, -9.708643192971695e-18,  5.412069118444714e-19, -1.583268066204921e-20,
   3.649923233366241e-22,  9.215430788057122e-01, -7.314289705511035e-03,  5.805277892400688e-05, -4.606813727583003e-07,  3.649883769841017e-09, -2.856841285904177e-11,
   2.067667356301349e-13, -8.098568168351730e-16, -2.286793190364717e-17,  1.063388449881318e-18, -3.114387122798283e-20,  7.427254655368164e-22  };
-  constexpr double w[3840] = {  2.968302283923635e-01, -4.268115239376112e-03,  6.897417044285957e-05, -1.163497796936555e-06,  1.969204541656956e-08,
+  static constexpr double w[3840] = {  2.968302283923635e-01, -4.268115239376112e-03,  6.897417044285957e-05, -1.163497796936555e-06,  1.969204541656956e-08,
  -3.293748207725426e-10,  5.418882291917955e-12, -8.766592515998998e-14,  1.395723303150878e-15, -2.189745156138463e-17,  3.389053631164636e-19, -5.178906807153212e-21,
   2.787909973404095e-01, -9.449569591071991e-03,  3.181393735225450e-04, -9.511830056578094e-06,  2.601934051724836e-07, -6.649735159186712e-09,  1.608122265872734e-10,
  -3.711300075509768e-12,  8.223719860557596e-14, -1.757646454027380e-15,  3.636270351370752e-17, -7.299696942592916e-19,  2.469142742404652e-01, -1.764297590752233e-02,
@@ -1134,51 +1135,5 @@ void ERIRootList::eriroot10(const double* ta, double* rr, double* ww, const int
   1.334874385762789e-19, -1.668173523350636e-21,  4.663111016722306e-23, -1.726199935240981e-24,  5.947277255512909e-26, -1.775903264422544e-27,  4.533054555065173e-29,
  -9.753273461627139e-31,  5.617812079749433e-14, -2.229532717109797e-16,  1.328513863263566e-18, -8.924672887728282e-21,  7.254478433673686e-23, -1.153856592233471e-24,
   3.950211567106821e-26, -1.558558605202162e-27,  5.521482215241335e-29, -1.690669430786902e-30,  4.450478335344989e-32, -9.994797055144197e-34  };
-  int offset = -10;
-  for (int i = 1; i <= n; ++i) {
-    double t = ta[i-1];
-    offset += 10;
-    if (std::isnan(t)) {
-      fill_n(rr+offset, 10, 0.5);
-      fill_n(ww+offset, 10, 0.0);
-    } else if (t >= 64.0) {
-      t = 1.0/sqrt(t);
-      for (int r = 0; r != 10; ++r) {
-        rr[offset+r] = ax[r]*t*t;
-        ww[offset+r] = aw[r]*t;
-      }
-    } else {
-      assert(t >= 0);
-      int it = static_cast<int>(t*   0.500000000000000);
-      t = (t-it*2.000000000000000-   1.000000000000000) *   1.000000000000000;
-      const double t2 = t * 2.0;
-      for (int j=1; j <=10; ++j) {
-        const int boxof = it*120+12*(j-1);
-        double d = x[boxof+11];
-        double e = w[boxof+11];
-        double f = t2*d + x[boxof+10];
-        double g = t2*e + w[boxof+10];
-        d = t2*f - d + x[boxof+9];
-        e = t2*g - e + w[boxof+9];
-        f = t2*d - f + x[boxof+8];
-        g = t2*e - g + w[boxof+8];
-        d = t2*f - d + x[boxof+7];
-        e = t2*g - e + w[boxof+7];
-        f = t2*d - f + x[boxof+6];
-        g = t2*e - g + w[boxof+6];
-        d = t2*f - d + x[boxof+5];
-        e = t2*g - e + w[boxof+5];
-        f = t2*d - f + x[boxof+4];
-        g = t2*e - g + w[boxof+4];
-        d = t2*f - d + x[boxof+3];
-        e = t2*g - e + w[boxof+3];
-        f = t2*d - f + x[boxof+2];
-        g = t2*e - g + w[boxof+2];
-        d = t2*f - d + x[boxof+1];
-        e = t2*g - e + w[boxof+1];
-        rr[offset+j-1] = t*d - f + x[boxof+0]*0.5;
-        ww[offset+j-1] = t*e - g + w[boxof+0]*0.5;
-      }
-    }
-  }
+  rys::interpolate_root<10,1>(ta, rr, ww, n, ax, aw, x, w);
 }
@@ -26,19 +26,20 @@
 #include <algorithm>
 #include <cassert>
 #include <src/integral/rys/erirootlist.h>
+#include <src/integral/rys/rootinterpolation.h>
 
 using namespace std;
 using namespace bagel;
 
 void ERIRootList::eriroot12(const double* ta, double* rr, double* ww, const int n) {
 
-  constexpr double ax[12] = {5.036188911729393e-02,4.545066815637803e-01,1.269589940103960e+00,2.509848097232131e+00,4.198415644878412e+00,
+  static constexpr double ax[12] = {5.036188911729393e-02,4.545066815637803e-01,1.269589940103960e+00,2.509848097232131e+00,4.198415644878412e+00,
     6.369975388030638e+00,9.075434230961196e+00,1.239044796380947e+01,1.643219508767532e+01,2.139675593616611e+01,2.766110877984608e+01,3.619136036061554e+01
     };
-  constexpr double aw[12] = {4.269311638686991e-01,2.861795353464431e-01,1.277396217845591e-01,3.744547050323081e-02,7.048355810072694e-03,
+  static constexpr double aw[12] = {4.269311638686991e-01,2.861795353464431e-01,1.277396217845591e-01,3.744547050323081e-02,7.048355810072694e-03,
     8.236924826884174e-04,5.688691636404396e-05,2.158245704902338e-06,4.018971174941392e-08,3.046254269987585e-10,6.584620243078147e-13,1.664368496489123e-16
     };
-  constexpr double x[4608] = {  7.887522449637157e-03, -1.571539836577658e-04,  2.339142202190098e-06, -3.079063210893806e-08,  3.774445513368981e-10,
+  static constexpr double x[4608] = {  7.887522449637157e-03, -1.571539836577658e-04,  2.339142202190098e-06, -3.079063210893806e-08,  3.774445513368981e-10,
  -4.406083378307222e-12,  4.951308025311900e-14, -5.386621026088275e-16,  5.686664908621152e-18, -5.827680842405324e-20,  5.786336246997091e-22, -5.543825606929964e-24,
   7.029757867252290e-02, -1.358419322164850e-03,  1.898665202054120e-05, -2.238818861471628e-07,  2.291999841217998e-09, -1.993221450023352e-11,  1.323423440341534e-13,
  -3.347816474773429e-16, -8.364710375633505e-18,  1.970025739572160e-19, -2.789045221285068e-21,  3.008470945183432e-23,  1.914664806212864e-01, -3.475837063148429e-03,
@@ -697,7 +698,7 @@ void ERIRootList::eriroot12(const double* ta, double* rr, double* ww, const int
  -7.674417776893685e-13,  2.797998818414601e-14, -6.666452789346288e-16,  1.030830654338118e-17, -3.388059567055476e-20, -3.754140585340873e-21,  1.149072688901044e+00,
  -9.119078347289882e-03,  7.222683397300517e-05, -5.599866317043049e-07,  3.602432522982944e-09,  1.216311592916257e-11, -1.640661623719154e-12,  5.896584621434040e-14,
  -1.510024683630778e-15,  2.790568921957669e-17, -2.800570017412337e-19, -3.244705144606503e-21  };
-  constexpr double w[4608] = {  2.499094135756334e-01, -2.944297664936297e-03,  3.865186983078175e-05, -5.315407877929951e-07,  7.380177041335190e-09,
+  static constexpr double w[4608] = {  2.499094135756334e-01, -2.944297664936297e-03,  3.865186983078175e-05, -5.315407877929951e-07,  7.380177041335190e-09,
  -1.017981418940126e-10,  1.386548301793393e-12, -1.862493368396003e-14,  2.467846770671005e-16, -3.228614149487320e-18,  4.174239487224210e-20, -5.337602257999374e-22,
   2.389650306104160e-01, -6.185879342045644e-03,  1.649983091123670e-04, -3.973229922995252e-06,  8.827884658214563e-08, -1.844319904526888e-09,  3.666092072091243e-11,
  -6.988175751706649e-13,  1.284560258635129e-14, -2.286694949852879e-16,  3.955035964569597e-18, -6.661968107556212e-20,  2.189614244630325e-01, -1.167774399025376e-02,
@@ -1356,51 +1357,5 @@ void ERIRootList::eriroot12(const double* ta, double* rr, double* ww, const int
   4.358537092788980e-24, -1.263140257476921e-25,  2.744057177633063e-27, -3.814621740193403e-29,  3.003115600067231e-32,  1.516800304784057e-32,  4.194532840557138e-17,
  -1.678653980675763e-19,  1.185654487342566e-21, -2.388599126376620e-23,  1.161875142912580e-24, -5.531772178372815e-26,  2.132180010575235e-27, -6.535368814510164e-29,
   1.561385788983837e-30, -2.716641615183736e-32,  2.603875693528699e-34,  1.927139436830545e-36  };
-  int offset = -12;
-  for (int i = 1; i <= n; ++i) {
-    double t = ta[i-1];
-    offset += 12;
-    if (std::isnan(t)) {
-      fill_n(rr+offset, 12, 0.5);
-      fill_n(ww+offset, 12, 0.0);
-    } else if (t >= 64.0) {
-      t = 1.0/sqrt(t);
-      for (int r = 0; r != 12; ++r) {
-        rr[offset+r] = ax[r]*t*t;
-        ww[offset+r] = aw[r]*t;
-      }
-    } else {
-      assert(t >= 0);
-      int it = static_cast<int>(t*   0.500000000000000);
-      t = (t-it*2.000000000000000-   1.000000000000000) *   1.000000000000000;
-      const double t2 = t * 2.0;
-      for (int j=1; j <=12; ++j) {
-        const int boxof = it*144+12*(j-1);
-        double d = x[boxof+11];
-        double e = w[boxof+11];
-        double f = t2*d + x[boxof+10];
-        double g = t2*e + w[boxof+10];
-        d = t2*f - d + x[boxof+9];
-        e = t2*g - e + w[boxof+9];
-        f = t2*d - f + x[boxof+8];
-        g = t2*e - g + w[boxof+8];
-        d = t2*f - d + x[boxof+7];
-        e = t2*g - e + w[boxof+7];
-        f = t2*d - f + x[boxof+6];
-        g = t2*e - g + w[boxof+6];
-        d = t2*f - d + x[boxof+5];
-        e = t2*g - e + w[boxof+5];
-        f = t2*d - f + x[boxof+4];
-        g = t2*e - g + w[boxof+4];
-        d = t2*f - d + x[boxof+3];
-        e = t2*g - e + w[boxof+3];
-        f = t2*d - f + x[boxof+2];
-        g = t2*e - g + w[boxof+2];
-        d = t2*f - d + x[boxof+1];
-        e = t2*g - e + w[boxof+1];
-        rr[offset+j-1] = t*d - f + x[boxof+0]*0.5;
-        ww[offset+j-1] = t*e - g + w[boxof+0]*0.5;
-      }
-    }
-  }
+  rys::interpolate_root<12,1>(ta, rr, ww, n, ax, aw, x, w);
 }
@@ -26,15 +26,16 @@
 #include <algorithm>
 #include <cassert>
 #include <src/integral/rys/erirootlist.h>
+#include <src/integral/rys/rootinterpolation.h>
 
 using namespace std;
 using namespace bagel;
 
 void ERIRootList::eriroot2(const double* ta, double* rr, double* ww, const int n) {
 
-  constexpr double ax[2] = {2.752551286084111e-01,2.724744871391588e+00};
-  constexpr double aw[2] = {8.049140900055123e-01,8.131283544724531e-02};
-  constexpr double x[768] = {  1.932488560368105e-01, -1.780410264696489e-02,  1.104952643536104e-03, -5.209086926321668e-05,  1.557077571175864e-06,
+  static constexpr double ax[2] = {2.752551286084111e-01,2.724744871391588e+00};
+  static constexpr double aw[2] = {8.049140900055123e-01,8.131283544724531e-02};
+  static constexpr double x[768] = {  1.932488560368105e-01, -1.780410264696489e-02,  1.104952643536104e-03, -5.209086926321668e-05,  1.557077571175864e-06,
   1.602449123030568e-08, -4.927153298770279e-09,  2.975911263113046e-10, -9.559437574356920e-12, -6.920509303563687e-14,  3.122108790148673e-14, -1.930986828735923e-15,
   1.388011268456905e+00, -4.914458058909676e-02, -1.550226343010855e-03,  5.058551001364932e-05,  6.415273721174869e-06,  5.167111238522261e-08, -2.032819531271784e-08,
  -8.692662249696952e-10,  4.214069230765610e-11,  4.555527177584852e-12,  4.066648720865206e-15, -1.625766004015951e-14,  1.363444667880911e-01, -1.104708305829675e-02,
@@ -145,7 +146,7 @@ void ERIRootList::eriroot2(const double* ta, double* rr, double* ww, const int n
   8.670571233397532e-24, -6.881405740759285e-26,  8.651073617746238e-02, -6.866363969521683e-04,  5.449838510821527e-06, -4.325541134415335e-08,  3.433185417947118e-10,
  -2.724921980333425e-12,  2.162772729980937e-14, -1.716594425568408e-16,  1.362462352629370e-18, -1.081387446377723e-20,  8.582980676753968e-23, -6.811889425961560e-25
   };
-  constexpr double w[768] = {  1.114730883302197e+00, -8.666854230455823e-02,  7.463109340274397e-03, -6.009650759222781e-04,  4.397003731169806e-05,
+  static constexpr double w[768] = {  1.114730883302197e+00, -8.666854230455823e-02,  7.463109340274397e-03, -6.009650759222781e-04,  4.397003731169806e-05,
  -2.933649212339785e-06,  1.817049815028525e-07, -1.050127540210960e-08,  5.675970686803894e-10, -2.887272331169160e-11,  1.378170808509073e-12, -6.118239130607376e-14,
   4.306311079182445e-01, -1.113534030291854e-01,  1.865937449751453e-02, -2.283884895051518e-03,  2.230976393329356e-04, -1.817936711010214e-05,  1.269705826576588e-06,
  -7.761172866006901e-08,  4.217060695276920e-09, -2.059981296551100e-10,  9.137294442437935e-12, -3.708593522630232e-13,  8.542716376142342e-01, -4.714985036665221e-02,
@@ -256,51 +257,5 @@ void ERIRootList::eriroot2(const double* ta, double* rr, double* ww, const int n
   3.545706249945471e-23, -2.686154705947692e-25,  2.048987671815775e-02, -8.131479707694760e-05,  4.840484110161172e-07, -3.201584256052115e-09,  2.223464211608164e-11,
  -1.588289606102284e-13,  1.155574922989642e-15, -8.516680601667526e-18,  6.337216504766265e-20, -4.750418261619280e-22,  3.581890694049104e-24, -2.713567302642395e-26
   };
-  int offset = -2;
-  for (int i = 1; i <= n; ++i) {
-    double t = ta[i-1];
-    offset += 2;
-    if (std::isnan(t)) {
-      fill_n(rr+offset, 2, 0.5);
-      fill_n(ww+offset, 2, 0.0);
-    } else if (t >= 64.0) {
-      t = 1.0/sqrt(t);
-      for (int r = 0; r != 2; ++r) {
-        rr[offset+r] = ax[r]*t*t;
-        ww[offset+r] = aw[r]*t;
-      }
-    } else {
-      assert(t >= 0);
-      int it = static_cast<int>(t*   0.500000000000000);
-      t = (t-it*2.000000000000000-   1.000000000000000) *   1.000000000000000;
-      const double t2 = t * 2.0;
-      for (int j=1; j <=2; ++j) {
-        const int boxof = it*24+12*(j-1);
-        double d = x[boxof+11];
-        double e = w[boxof+11];
-        double f = t2*d + x[boxof+10];
-        double g = t2*e + w[boxof+10];
-        d = t2*f - d + x[boxof+9];
-        e = t2*g - e + w[boxof+9];
-        f = t2*d - f + x[boxof+8];
-        g = t2*e - g + w[boxof+8];
-        d = t2*f - d + x[boxof+7];
-        e = t2*g - e + w[boxof+7];
-        f = t2*d - f + x[boxof+6];
-        g = t2*e - g + w[boxof+6];
-        d = t2*f - d + x[boxof+5];
-        e = t2*g - e + w[boxof+5];
-        f = t2*d - f + x[boxof+4];
-        g = t2*e - g + w[boxof+4];
-        d = t2*f - d + x[boxof+3];
-        e = t2*g - e + w[boxof+3];
-        f = t2*d - f + x[boxof+2];
-        g = t2*e - g + w[boxof+2];
-        d = t2*f - d + x[boxof+1];
-        e = t2*g - e + w[boxof+1];
-        rr[offset+j-1] = t*d - f + x[boxof+0]*0.5;
-        ww[offset+j-1] = t*e - g + w[boxof+0]*0.5;
-      }
-    }
-  }
+  rys::interpolate_root<2,1>(ta, rr, ww, n, ax, aw, x, w);
 }
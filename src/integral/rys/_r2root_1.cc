@@ -27,15 +27,16 @@
 #include <iostream>
 #include <cassert>
 #include <src/integral/rys/r2rootlist.h>
+#include <src/integral/rys/rootinterpolation.h>
 
 using namespace std;
 using namespace bagel;
 
 void R2RootList::r2root1(const double* ta, double* rr, double* ww, const int n) {
 
-  constexpr double ax[1] = {1.000003814770027e+00};
-  constexpr double aw[1] = {5.000019073704611e-01};
-  constexpr double x[527] = {  8.615672004782865e-01,  9.950266140631300e-02,  1.533912849818139e-03, -5.409850309586831e-04, -1.877246401351007e-05,
+  static constexpr double ax[1] = {1.000003814770027e+00};
+  static constexpr double aw[1] = {5.000019073704611e-01};
+  static constexpr double x[527] = {  8.615672004782865e-01,  9.950266140631300e-02,  1.533912849818139e-03, -5.409850309586831e-04, -1.877246401351007e-05,
   3.964916382485603e-06,  2.069710271328521e-07, -2.932418810913451e-08, -2.106101188554058e-09,  2.104829382795059e-10,  2.024247003558271e-11, -1.450167874470594e-12,
   1.244049918873936e+00,  8.692405629975766e-02, -4.119616468424005e-03, -2.428182428139501e-04,  4.052454820413477e-05, -2.365367018816754e-07, -2.939755999823473e-07,
   1.600261460738115e-08,  1.478838484787080e-09, -1.931394874416050e-10, -2.109349871930735e-12,  1.588439313333967e-12,  1.520420312449508e+00,  5.137973194761360e-02,
@@ -111,7 +112,7 @@ void R2RootList::r2root1(const double* ta, double* rr, double* ww, const int n)
   1.604418142504548e-09, -2.752820597864828e-10,  4.723220766508474e-11, -8.103978388823747e-12,  1.390425953804121e-12, -2.383651441975656e-13,  3.972853453881276e-14,
      0.992156368473227,      0.99608604500229,     0.998044958270205,     0.999022959494462,     0.999511599394928,     0.999755829554471,     0.999877922234645,
      0.999938962980821,     0.999969481956178,     0.999984741094518,     0.999992370576364  };
-  constexpr double w[527] = {  1.196288013322608e+00, -3.316232965592209e-01,  6.095273008599551e-02, -8.299712742284355e-03,  8.942329876147542e-04,
+  static constexpr double w[527] = {  1.196288013322608e+00, -3.316232965592209e-01,  6.095273008599551e-02, -8.299712742284355e-03,  8.942329876147542e-04,
  -7.957392659079802e-05,  6.025721136803708e-06, -3.969201067849495e-07,  2.312804303434212e-08, -1.207969269035796e-09,  5.715934179077561e-11, -2.468396282128691e-12,
   4.452346579238068e-01, -8.311524084419178e-02,  1.255931437636079e-02, -1.533468636928158e-03,  1.545039956678314e-04, -1.314963796895761e-05,  9.649744437714886e-07,
  -6.210782928571568e-08,  3.555342099219166e-09, -1.831184057722567e-10,  8.567810109678186e-12, -3.665902120277015e-13,  2.377429903237309e-01, -2.824427177117255e-02,
@@ -187,18 +188,15 @@ void R2RootList::r2root1(const double* ta, double* rr, double* ww, const int n)
  -1.604313221265530e-09,  2.752610872821633e-10, -4.722809960219372e-11,  8.103186093245888e-12, -1.390275015902755e-12,  2.383367048730390e-13, -3.972339035483204e-14,
    0.00392169119446278,   0.00195696227032404,  0.000977518982020638,  0.000488520018680646,  0.000244200273353903,  0.000122085219121496,  6.10388822226277e-05,
   3.05185095328528e-05,  1.52590219038026e-05,  7.62945274024323e-06,  3.81471181770676e-06  };
-  int offset = -1;
   const int ibox0 = static_cast<int>(log(64.0) / log(2.0));
-  for (int i = 1; i <= n; ++i) {
-    double t = ta[i-1];
-    offset += 1;
+  rys::interpolate<1>(ta, rr, ww, n, x, w, [&](double t, double* rt, double* wt) {
     if (std::isnan(t)) {
-      fill_n(rr+offset, 1, 0.5);
-      fill_n(ww+offset, 1, 0.0);
+      fill_n(rt, 1, 0.5);
+      fill_n(wt, 1, 0.0);
     } else if (t >= 131072.0) {
       for (int r = 0; r != 1; ++r) {
-        ww[offset+r] = aw[1-r-1] / t;
-        rr[offset+r] = 1.0 - ax[1-r-1] / t;
+        wt[r] = aw[1-r-1] / t;
+        rt[r] = 1.0 - ax[1-r-1] / t;
       }
     } else {
       assert(t >= 0);
@@ -237,17 +235,17 @@ void R2RootList::r2root1(const double* ta, double* rr, double* ww, const int n)
         g = t2*e - g + w[boxof+2];
         d = t2*f - d + x[boxof+1];
         e = t2*g - e + w[boxof+1];
-        rr[offset+j-1] = t*d - f + x[boxof+0]*0.5;
-        ww[offset+j-1] = t*e - g + w[boxof+0]*0.5;
+        rt[j-1] = t*d - f + x[boxof+0]*0.5;
+        wt[j-1] = t*e - g + w[boxof+0]*0.5;
         if (64.0 <= bigT && bigT < 131072.0) {
           const int iref = 516 + (it - 32) * 1 + 1 - j;
           double rr_infty = x[iref];
           double ww_infty = w[iref];
           double Tref = pow(2.0, it + ibox0 + 1 - 32);
-          ww[offset+j-1] = ww[offset+j-1] * ww_infty * Tref / bigT;
-          rr[offset+j-1] = 1.0 + rr[offset+j-1] * (1.0 - rr_infty) * Tref /bigT;
+          wt[j-1] = wt[j-1] * ww_infty * Tref / bigT;
+          rt[j-1] = 1.0 + rt[j-1] * (1.0 - rr_infty) * Tref /bigT;
         }
       }
     }
-  }
+  });
 }
@@ -27,15 +27,16 @@
 #include <iostream>
 #include <cassert>
 #include <src/integral/rys/r2rootlist.h>
+#include <src/integral/rys/rootinterpolation.h>
 
 using namespace std;
 using namespace bagel;
 
 void R2RootList::r2root2(const double* ta, double* rr, double* ww, const int n) {
 
-  constexpr double ax[2] = {5.857886722809685e-01,3.414226587031987e+00};
-  constexpr double aw[2] = {4.267783233468789e-01,7.322358402358216e-02};
-  constexpr double x[1054] = {  2.865970157019227e-01,  2.948538308279342e-02,  1.839200647449686e-03,  6.471114065040126e-05, -7.433248473661826e-07,
+  static constexpr double ax[2] = {5.857886722809685e-01,3.414226587031987e+00};
+  static constexpr double aw[2] = {4.267783233468789e-01,7.322358402358216e-02};
+  static constexpr double x[1054] = {  2.865970157019227e-01,  2.948538308279342e-02,  1.839200647449686e-03,  6.471114065040126e-05, -7.433248473661826e-07,
  -2.532292036268259e-07, -1.435146717713722e-08, -1.341625397864645e-10,  3.792432445017854e-11,  2.970150893412537e-12,  7.030802574470450e-14, -5.144820370255235e-15,
   1.558140610836833e+00,  3.585494641340562e-02, -1.635966445788037e-03,  2.657352694985419e-05,  2.703192407300337e-06, -2.217234382145987e-07,  3.670494072077213e-09,
   4.376281229381440e-10, -3.471473040693733e-11,  5.446340386596916e-13,  7.830819906557541e-14, -5.668567479273047e-15,  4.379472684263130e-01,  4.660469424521846e-02,
@@ -186,7 +187,7 @@ void R2RootList::r2root2(const double* ta, double* rr, double* ww, const int n)
      0.997707243768449,     0.986636689148782,     0.998854761300549,     0.993325041445136,     0.999427662704154,     0.996664171515387,     0.999713901522235,
       0.99833249558976,     0.999856968261151,     0.999166349898398,     0.999928488500296,     0.999583200430999,     0.999964245341919,     0.999791606580454,
       0.99998212294382,     0.999895804880779,     0.999991061540115,     0.999947902837942,     0.999995530787107,     0.999973951518348  };
-  constexpr double w[1054] = {  6.909961894068787e-01, -2.481362049085455e-01,  5.043662894988601e-02, -7.201020518528624e-03,  7.955855187884865e-04,
+  static constexpr double w[1054] = {  6.909961894068787e-01, -2.481362049085455e-01,  5.043662894988601e-02, -7.201020518528624e-03,  7.955855187884865e-04,
  -7.176467142124536e-05,  5.471953806106182e-06, -3.614252066191177e-07,  2.106041352952890e-08, -1.098311538978220e-09,  5.186645382208816e-11, -2.236589924860402e-12,
   5.052918239157295e-01, -8.348709165067535e-02,  1.051610113610950e-02, -1.098692223755731e-03,  9.864746882626769e-05, -7.809255169552660e-06,  5.537673306975264e-07,
  -3.549490016583173e-08,  2.067629504813216e-09, -1.096577300575763e-10,  5.292887968687449e-12, -2.318063572682894e-13,  1.625379942553103e-01, -4.941478747795010e-02,
@@ -337,18 +338,15 @@ void R2RootList::r2root2(const double* ta, double* rr, double* ww, const int n)
    0.00167037998722564,  0.000286582283098398,  0.000834365647935441,  0.000143153334085197,  0.000416978042950007,  7.15419757306386e-05,  0.000208437986811567,
   3.57622865423363e-05,  0.000104206254656289,  1.78789644652063e-05,  5.20999451205936e-05,  8.93893710203416e-06,  2.60491773177829e-05,  4.46933221506987e-06,
   1.30243898868971e-05,  2.23463201690555e-06,  6.51214525527685e-06,  1.11730748496638e-06,  3.25606020619872e-06,  5.58651611508043e-07  };
-  int offset = -2;
   const int ibox0 = static_cast<int>(log(64.0) / log(2.0));
-  for (int i = 1; i <= n; ++i) {
-    double t = ta[i-1];
-    offset += 2;
+  rys::interpolate<2>(ta, rr, ww, n, x, w, [&](double t, double* rt, double* wt) {
     if (std::isnan(t)) {
-      fill_n(rr+offset, 2, 0.5);
-      fill_n(ww+offset, 2, 0.0);
+      fill_n(rt, 2, 0.5);
+      fill_n(wt, 2, 0.0);
     } else if (t >= 131072.0) {
       for (int r = 0; r != 2; ++r) {
-        ww[offset+r] = aw[2-r-1] / t;
-        rr[offset+r] = 1.0 - ax[2-r-1] / t;
+        wt[r] = aw[2-r-1] / t;
+        rt[r] = 1.0 - ax[2-r-1] / t;
       }
     } else {
       assert(t >= 0);
@@ -387,17 +385,17 @@ void R2RootList::r2root2(const double* ta, double* rr, double* ww, const int n)
         g = t2*e - g + w[boxof+2];
         d = t2*f - d + x[boxof+1];
         e = t2*g - e + w[boxof+1];
-        rr[offset+j-1] = t*d - f + x[boxof+0]*0.5;
-        ww[offset+j-1] = t*e - g + w[boxof+0]*0.5;
+        rt[j-1] = t*d - f + x[boxof+0]*0.5;
+        wt[j-1] = t*e - g + w[boxof+0]*0.5;
         if (64.0 <= bigT && bigT < 131072.0) {
           const int iref = 1032 + (it - 32) * 2 + 2 - j;
           double rr_infty = x[iref];
           double ww_infty = w[iref];
           double Tref = pow(2.0, it + ibox0 + 1 - 32);
-          ww[offset+j-1] = ww[offset+j-1] * ww_infty * Tref / bigT;
-          rr[offset+j-1] = 1.0 + rr[offset+j-1] * (1.0 - rr_infty) * Tref /bigT;
+          wt[j-1] = wt[j-1] * ww_infty * Tref / bigT;
+          rt[j-1] = 1.0 + rt[j-1] * (1.0 - rr_infty) * Tref /bigT;
         }
       }
     }
-  }
+  });
 }
@@ -27,15 +27,16 @@
 #include <iostream>
 #include <cassert>
 #include <src/integral/rys/r2rootlist.h>
+#include <src/integral/rys/rootinterpolation.h>
 
 using namespace std;
 using namespace bagel;
 
 void R2RootList::r2root3(const double* ta, double* rr, double* ww, const int n) {
 
-  constexpr double ax[3] = {4.157761428884650e-01,2.294289112607765e+00,6.289969078481845e+00};
-  constexpr double aw[3] = {3.555478612975036e-01,1.392593980080030e-01,5.194648064954447e-03};
-  constexpr double x[1581] = {  1.333193785481400e-01,  1.024188639094186e-02,  5.431298990068923e-04,  2.249201605887059e-05,  6.850432718250695e-07,
+  static constexpr double ax[3] = {4.157761428884650e-01,2.294289112607765e+00,6.289969078481845e+00};
+  static constexpr double aw[3] = {3.555478612975036e-01,1.392593980080030e-01,5.194648064954447e-03};
+  static constexpr double x[1581] = {  1.333193785481400e-01,  1.024188639094186e-02,  5.431298990068923e-04,  2.249201605887059e-05,  6.850432718250695e-07,
   9.355887612572497e-09, -5.327864432448729e-10, -4.830469613796645e-11, -2.016116740493461e-12, -4.443689564743550e-14,  4.896458076066169e-16,  1.038395244921571e-16,
   9.509945329775856e-01,  3.838562921326436e-02,  4.870372628813179e-05, -3.764652912285678e-05, -6.746330023569673e-08,  6.766313339813510e-08,  2.141016721466713e-10,
  -1.332860264344839e-10, -5.414554859775406e-13,  2.598111841081563e-13,  1.162321614891007e-15, -5.203344808143994e-16,  1.769835207445001e+00,  1.477117416176882e-02,
@@ -262,7 +263,7 @@ void R2RootList::r2root3(const double* ta, double* rr, double* ww, const int n)
      0.999949243170569,     0.999719919374987,     0.999232137533457,     0.999974622360322,     0.999859963964956,     0.999616080498011,     0.999987311373846,
      0.999929983051339,     0.999808043179907,     0.999993655735335,     0.999964991792822,     0.999904022322439,     0.999996827879769,     0.999982495963191,
      0.999952011344311  };
-  constexpr double w[1581] = {  4.707327092437820e-01, -1.859525121674241e-01,  3.994101738983569e-02, -5.916683143742439e-03,  6.706185144024396e-04,
+  static constexpr double w[1581] = {  4.707327092437820e-01, -1.859525121674241e-01,  3.994101738983569e-02, -5.916683143742439e-03,  6.706185144024396e-04,
  -6.164122604377144e-05,  4.769024938595575e-06, -3.187006758945725e-07,  1.874951650635223e-08, -9.853204811662779e-10,  4.678958671360583e-11, -2.023674307440859e-12,
   4.500058099754604e-01, -1.150481594983527e-01,  1.830665060702680e-02, -2.176056329714640e-03,  2.094644520374816e-04, -1.705114537604383e-05,  1.206049449789403e-06,
  -7.550917908787676e-08,  4.242512294243124e-09, -2.162248122757214e-10,  1.008351155709234e-11, -4.326898942677031e-13,  2.755494941033658e-01, -3.062262489344410e-02,
@@ -489,18 +490,15 @@ void R2RootList::r2root3(const double* ta, double* rr, double* ww, const int n)
   4.34043229553444e-05,  1.70004107258845e-05,  6.34148541398809e-07,  2.17014988613461e-05,   8.4999460557402e-06,  3.17064615766484e-07,  1.08505838215324e-05,
   4.24990819072497e-06,   1.5852989154527e-07,  5.42525051409455e-06,  2.12493788478562e-06,  7.92643413630588e-08,  2.71261490858081e-06,  1.06246488958743e-06,
   3.96320195385319e-08  };
-  int offset = -3;
   const int ibox0 = static_cast<int>(log(64.0) / log(2.0));
-  for (int i = 1; i <= n; ++i) {
-    double t = ta[i-1];
-    offset += 3;
+  rys::interpolate<3>(ta, rr, ww, n, x, w, [&](double t, double* rt, double* wt) {
     if (std::isnan(t)) {
-      fill_n(rr+offset, 3, 0.5);
-      fill_n(ww+offset, 3, 0.0);
+      fill_n(rt, 3, 0.5);
+      fill_n(wt, 3, 0.0);
     } else if (t >= 131072.0) {
       for (int r = 0; r != 3; ++r) {
-        ww[offset+r] = aw[3-r-1] / t;
-        rr[offset+r] = 1.0 - ax[3-r-1] / t;
+        wt[r] = aw[3-r-1] / t;
+        rt[r] = 1.0 - ax[3-r-1] / t;
       }
     } else {
       assert(t >= 0);
@@ -539,17 +537,17 @@ void R2RootList::r2root3(const double* ta, double* rr, double* ww, const int n)
         g = t2*e - g + w[boxof+2];
         d = t2*f - d + x[boxof+1];
         e = t2*g - e + w[boxof+1];
-        rr[offset+j-1] = t*d - f + x[boxof+0]*0.5;
-        ww[offset+j-1] = t*e - g + w[boxof+0]*0.5;
+        rt[j-1] = t*d - f + x[boxof+0]*0.5;
+        wt[j-1] = t*e - g + w[boxof+0]*0.5;
         if (64.0 <= bigT && bigT < 131072.0) {
           const int iref = 1548 + (it - 32) * 3 + 3 - j;
           double rr_infty = x[iref];
           double ww_infty = w[iref];
           double Tref = pow(2.0, it + ibox0 + 1 - 32);
-          ww[offset+j-1] = ww[offset+j-1] * ww_infty * Tref / bigT;
-          rr[offset+j-1] = 1.0 + rr[offset+j-1] * (1.0 - rr_infty) * Tref /bigT;
+          wt[j-1] = wt[j-1] * ww_infty * Tref / bigT;
+          rt[j-1] = 1.0 + rt[j-1] * (1.0 - rr_infty) * Tref /bigT;
         }
       }
     }
-  }
+  });
 }
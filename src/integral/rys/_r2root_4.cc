@@ -27,15 +27,16 @@
 #include <iostream>
 #include <cassert>
 #include <src/integral/rys/r2rootlist.h>
+#include <src/integral/rys/rootinterpolation.h>
 
 using namespace std;
 using namespace bagel;
 
 void R2RootList::r2root4(const double* ta, double* rr, double* ww, const int n) {
 
-  constexpr double ax[4] = {3.225489200896363e-01,1.745767761006858e+00,4.536637603713899e+00,9.395106754304308e+00};
-  constexpr double aw[4] = {3.015782026299521e-01,1.787100279351790e-01,1.944402842414519e-02,2.696483811848355e-04};
-  constexpr double x[2108] = {  7.601256641479044e-02,  4.546381581422715e-03,  1.951491134091766e-04,  6.990687229315335e-06,  2.132350139706016e-07,
+  static constexpr double ax[4] = {3.225489200896363e-01,1.745767761006858e+00,4.536637603713899e+00,9.395106754304308e+00};
+  static constexpr double aw[4] = {3.015782026299521e-01,1.787100279351790e-01,1.944402842414519e-02,2.696483811848355e-04};
+  static constexpr double x[2108] = {  7.601256641479044e-02,  4.546381581422715e-03,  1.951491134091766e-04,  6.990687229315335e-06,  2.132350139706016e-07,
   5.307633605231819e-09,  8.762169228918273e-11, -4.611392846504380e-13, -1.139853179645842e-13, -5.432035368835123e-15, -1.608596597729978e-16, -3.125337895135037e-18,
   6.020979833989247e-01,  2.530448660516902e-02,  4.337475365069487e-04, -6.563242055871253e-06, -5.061905713701103e-07, -3.691607958055575e-09,  5.152169499142259e-10,
   1.637557356023271e-11, -2.971253104424491e-13, -2.768251601871755e-14, -2.025094456026240e-16,  3.059940703840931e-17,  1.321766986273446e+00,  2.583442797220917e-02,
@@ -337,7 +338,7 @@ void R2RootList::r2root4(const double* ta, double* rr, double* ww, const int n)
      0.998853070676062,     0.999980312650385,     0.999893443945516,     0.999723098217466,     0.999426552868839,     0.999990156475461,     0.999946722786129,
      0.999861551222668,     0.999713280813228,     0.999995078275289,     0.999973361596352,     0.999930776139642,      0.99985664150083,     0.999997539147033,
      0.999986680848991,     0.999965388201876,     0.999928321023908  };
-  constexpr double w[2108] = {  3.562355386973560e-01, -1.465520881142391e-01,  3.246538908825118e-02, -4.922956066845695e-03,  5.681601018144121e-04,
+  static constexpr double w[2108] = {  3.562355386973560e-01, -1.465520881142391e-01,  3.246538908825118e-02, -4.922956066845695e-03,  5.681601018144121e-04,
  -5.297686924127099e-05,  4.146505322999440e-06, -2.797690899672378e-07,  1.659290692243123e-08, -8.781106073796920e-10,  4.195813793543483e-11, -1.824922069594051e-12,
   3.542461576230532e-01, -1.131525382199826e-01,  2.048633512895393e-02, -2.650367678347351e-03,  2.697978834283717e-04, -2.277104659824228e-05,  1.646578913740803e-06,
  -1.043280136840156e-07,  5.887901473938260e-09, -2.997085120628064e-10,  1.389685694679775e-11, -5.908678870677720e-13,  3.135603061900189e-01, -5.780642147246056e-02,
@@ -639,18 +640,15 @@ void R2RootList::r2root4(const double* ta, double* rr, double* ww, const int n)
   3.29179387949113e-08,  1.84073643644874e-05,  1.09078857193128e-05,   1.1868009793416e-06,  1.64584697110011e-08,  9.20354169968314e-06,   5.4538596501056e-06,
   5.93391444401758e-07,  8.22910961211336e-09,  4.60173573542869e-06,  2.72690902160497e-06,  2.96693459754507e-07,  4.11452345506579e-09,  2.30085908988916e-06,
   1.36344930980819e-06,  1.48346164124643e-07,    2.057253884772e-09  };
-  int offset = -4;
   const int ibox0 = static_cast<int>(log(64.0) / log(2.0));
-  for (int i = 1; i <= n; ++i) {
-    double t = ta[i-1];
-    offset += 4;
+  rys::interpolate<4>(ta, rr, ww, n, x, w, [&](double t, double* rt, double* wt) {
     if (std::isnan(t)) {
-      fill_n(rr+offset, 4, 0.5);
-      fill_n(ww+offset, 4, 0.0);
+      fill_n(rt, 4, 0.5);
+      fill_n(wt, 4, 0.0);
     } else if (t >= 131072.0) {
       for (int r = 0; r != 4; ++r) {
-        ww[offset+r] = aw[4-r-1] / t;
-        rr[offset+r] = 1.0 - ax[4-r-1] / t;
+        wt[r] = aw[4-r-1] / t;
+        rt[r] = 1.0 - ax[4-r-1] / t;
       }
     } else {
       assert(t >= 0);
@@ -689,17 +687,17 @@ void R2RootList::r2root4(const double* ta, double* rr, double* ww, const int n)
         g = t2*e - g + w[boxof+2];
         d = t2*f - d + x[boxof+1];
         e = t2*g - e + w[boxof+1];
-        rr[offset+j-1] = t*d - f + x[boxof+0]*0.5;
-        ww[offset+j-1] = t*e - g + w[boxof+0]*0.5;
+        rt[j-1] = t*d - f + x[boxof+0]*0.5;
+        wt[j-1] = t*e - g + w[boxof+0]*0.5;
         if (64.0 <= bigT && bigT < 131072.0) {
           const int iref = 2064 + (it - 32) * 4 + 4 - j;
           double rr_infty = x[iref];
           double ww_infty = w[iref];
           double Tref = pow(2.0, it + ibox0 + 1 - 32);
-          ww[offset+j-1] = ww[offset+j-1] * ww_infty * Tref / bigT;
-          rr[offset+j-1] = 1.0 + rr[offset+j-1] * (1.0 - rr_infty) * Tref /bigT;
+          wt[j-1] = wt[j-1] * ww_infty * Tref / bigT;
+          rt[j-1] = 1.0 + rt[j-1] * (1.0 - rr_infty) * Tref /bigT;
         }
       }
     }
-  }
+  });
 }
@@ -27,17 +27,18 @@
 #include <iostream>
 #include <cassert>
 #include <src/integral/rys/r2rootlist.h>
+#include <src/integral/rys/rootinterpolation.h>
 
 using namespace std;
 using namespace bagel;
 
 void R2RootList::r2root6(const double* ta, double* rr, double* ww, const int n) {
 
-  constexpr double ax[6] = {2.228474543177195e-01,1.188936637351474e+00,2.992747743182503e+00,5.775165601190957e+00,9.837504948755466e+00,
+  static constexpr double ax[6] = {2.228474543177195e-01,1.188936637351474e+00,2.992747743182503e+00,5.775165601190957e+00,9.837504948755466e+00,
     1.598293495740176e+01};
-  constexpr double aw[6] = {2.294832124191948e-01,2.085012107548211e-01,5.668690726397824e-02,5.199618557721616e-03,1.305090990793173e-04,
+  static constexpr double aw[6] = {2.294832124191948e-01,2.085012107548211e-01,5.668690726397824e-02,5.199618557721616e-03,1.305090990793173e-04,
     4.492756660008302e-07};
-  constexpr double x[3162] = {  3.407170545114071e-02,  1.393320830998468e-03,  4.194378854416057e-05,  1.094389417815603e-06,  2.586300455966133e-08,
+  static constexpr double x[3162] = {  3.407170545114071e-02,  1.393320830998468e-03,  4.194378854416057e-05,  1.094389417815603e-06,  2.586300455966133e-08,
   5.601498338894908e-10,  1.103686194232192e-11,  1.920394077931276e-13,  2.697159592447926e-15,  1.983645008572856e-17, -4.709078035081051e-19, -2.842870425103341e-20,
   2.906031560639235e-01,  1.022025159210538e-02,  2.214768373282344e-04,  2.783424478251130e-06, -9.658155444057694e-09, -1.497774593366058e-09, -3.736284764229384e-11,
  -2.728366859158720e-13,  1.328386068681561e-14,  5.632197509925072e-16,  8.981656103106990e-18, -7.817455484401733e-20,  7.269791046474797e-01,  1.869819633593263e-02,
@@ -490,7 +491,7 @@ void R2RootList::r2root6(const double* ta, double* rr, double* ww, const int n)
      0.999699779736913,     0.999512233948622,     0.999996599604728,     0.999981858197425,     0.999954334119235,     0.999911877630057,     0.999849891014313,
       0.99975611883624,     0.999998299808851,     0.999990929133321,     0.999977167146735,     0.999955938983145,     0.999924945793543,     0.999878059883443
   };
-  constexpr double w[3162] = {  2.395553675671111e-01, -1.019821045288983e-01,  2.329234552891411e-02, -3.623591080035322e-03,  4.272865034927560e-04,
+  static constexpr double w[3162] = {  2.395553675671111e-01, -1.019821045288983e-01,  2.329234552891411e-02, -3.623591080035322e-03,  4.272865034927560e-04,
  -4.057406681527675e-05,  3.225729234857562e-06, -2.206086800200795e-07,  1.324002268905698e-08, -7.080421865970154e-10,  3.414885502442298e-11, -1.497744247843008e-12,
   2.403516487641265e-01, -9.148040477543919e-02,  1.883583699577774e-02, -2.679594270524030e-03,  2.927382820154860e-04, -2.604391086347973e-05,  1.958449422996717e-06,
  -1.277144393040904e-07,  7.359141169395744e-09, -3.800810446083796e-10,  1.779388143247152e-11, -7.609091846633365e-13,  2.376863355798457e-01, -7.093480253067533e-02,
@@ -943,18 +944,15 @@ void R2RootList::r2root6(const double* ta, double* rr, double* ww, const int n)
   3.98286712481558e-09,  1.37109616592894e-11,  3.50164929108524e-06,  3.18148813063312e-06,  8.64976859431541e-07,  7.93401852626105e-08,  1.99141840199492e-09,
   6.85542872115795e-12,  1.75081796584469e-06,  1.59073799709184e-06,  4.32486780273271e-07,  3.96699413888673e-08,  9.95705406794108e-10,  3.42770130921044e-12
   };
-  int offset = -6;
   const int ibox0 = static_cast<int>(log(64.0) / log(2.0));
-  for (int i = 1; i <= n; ++i) {
-    double t = ta[i-1];
-    offset += 6;
+  rys::interpolate<6>(ta, rr, ww, n, x, w, [&](double t, double* rt, double* wt) {
     if (std::isnan(t)) {
-      fill_n(rr+offset, 6, 0.5);
-      fill_n(ww+offset, 6, 0.0);
+      fill_n(rt, 6, 0.5);
+      fill_n(wt, 6, 0.0);
     } else if (t >= 131072.0) {
       for (int r = 0; r != 6; ++r) {
-        ww[offset+r] = aw[6-r-1] / t;
-        rr[offset+r] = 1.0 - ax[6-r-1] / t;
+        wt[r] = aw[6-r-1] / t;
+        rt[r] = 1.0 - ax[6-r-1] / t;
       }
     } else {
       assert(t >= 0);
@@ -993,17 +991,17 @@ void R2RootList::r2root6(const double* ta, double* rr, double* ww, const int n)
         g = t2*e - g + w[boxof+2];
         d = t2*f - d + x[boxof+1];
         e = t2*g - e + w[boxof+1];
-        rr[offset+j-1] = t*d - f + x[boxof+0]*0.5;
-        ww[offset+j-1] = t*e - g + w[boxof+0]*0.5;
+        rt[j-1] = t*d - f + x[boxof+0]*0.5;
+        wt[j-1] = t*e - g + w[boxof+0]*0.5;
         if (64.0 <= bigT && bigT < 131072.0) {
           const int iref = 3096 + (it - 32) * 6 + 6 - j;
           double rr_infty = x[iref];
           double ww_infty = w[iref];
           double Tref = pow(2.0, it + ibox0 + 1 - 32);
-          ww[offset+j-1] = ww[offset+j-1] * ww_infty * Tref / bigT;
-          rr[offset+j-1] = 1.0 + rr[offset+j-1] * (1.0 - rr_infty) * Tref /bigT;
+          wt[j-1] = wt[j-1] * ww_infty * Tref / bigT;
+          rt[j-1] = 1.0 + rt[j-1] * (1.0 - rr_infty) * Tref /bigT;
         }
       }
     }
-  }
+  });
 }
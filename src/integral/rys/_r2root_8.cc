@@ -27,17 +27,18 @@
 #include <iostream>
 #include <cassert>
 #include <src/integral/rys/r2rootlist.h>
+#include <src/integral/rys/rootinterpolation.h>
 
 using namespace std;
 using namespace bagel;
 
 void R2RootList::r2root8(const double* ta, double* rr, double* ww, const int n) {
 
-  constexpr double ax[8] = {1.702802819153788e-01,9.037052243967045e-01,2.251095217743607e+00,4.266716447839822e+00,7.045932282957874e+00,
+  static constexpr double ax[8] = {1.702802819153788e-01,9.037052243967045e-01,2.251095217743607e+00,4.266716447839822e+00,7.045932282957874e+00,
     1.075855705516558e+01,1.574073869493151e+01,2.286321896641308e+01};
-  constexpr double aw[8] = {1.845949988836659e-01,2.093941891931090e-01,8.789782860074327e-02,1.667180971711020e-02,1.397273445984399e-03,
+  static constexpr double aw[8] = {1.845949988836659e-01,2.093941891931090e-01,8.789782860074327e-02,1.667180971711020e-02,1.397273445984399e-03,
     4.538271689275045e-05,4.242889529944034e-07,5.240025838609234e-10};
-  constexpr double x[4216] = {  1.921673699556425e-02,  5.943685183164107e-04,  1.364678518116933e-05,  2.747447886201551e-07,  5.092939108547573e-09,
+  static constexpr double x[4216] = {  1.921673699556425e-02,  5.943685183164107e-04,  1.364678518116933e-05,  2.747447886201551e-07,  5.092939108547573e-09,
   8.858221978408888e-11,  1.454169716771688e-12,  2.248963128538644e-14,  3.242315109285809e-16,  4.251338472413684e-18,  4.764590619094435e-20,  3.663404966506208e-22,
   1.679842638942367e-01,  4.782625359212809e-03,  9.238231637043146e-05,  1.341862330695208e-06,  1.276601206259359e-08, -6.966382311758092e-12, -3.524178773749721e-12,
  -8.839201720269046e-14, -1.258046508994691e-15, -5.796247860325171e-18,  2.519771426680815e-19,  8.833166832506411e-21,  4.404563110982569e-01,  1.058347658051355e-02,
@@ -640,7 +641,7 @@ void R2RootList::r2root8(const double* ta, double* rr, double* ww, const int n)
      0.999519625276224,     0.999302261937919,     0.999997401719183,     0.999986210499993,     0.999965650881852,     0.999934894825315,     0.999892487195302,
      0.999835836820844,     0.999759814471984,      0.99965113363307,     0.999998700864548,     0.999993105276303,     0.999982825506456,     0.999967447536866,
      0.999946243802773,     0.999917918723639,     0.999879907694283,     0.999825567482251  };
-  constexpr double w[4216] = {  1.804494514912904e-01, -7.794430043891473e-02,  1.806012176877307e-02, -2.846479502189604e-03,  3.395906407867665e-04,
+  static constexpr double w[4216] = {  1.804494514912904e-01, -7.794430043891473e-02,  1.806012176877307e-02, -2.846479502189604e-03,  3.395906407867665e-04,
  -3.258540619885706e-05,  2.615058736301478e-06, -1.803679655563800e-07,  1.090856105247259e-08, -5.874680634511675e-10,  2.851613342244419e-11, -1.258085428316933e-12,
   1.809713949656040e-01, -7.343992825186842e-02,  1.599650973465341e-02, -2.383858206408770e-03,  2.705375970563656e-04, -2.483240642861412e-05,  1.915872724762085e-06,
  -1.276005733162801e-07,  7.481097877954522e-09, -3.919120122139388e-10,  1.856236235984833e-11, -8.013057450605954e-13,  1.811369387104399e-01, -6.439204200923559e-02,
@@ -1243,18 +1244,15 @@ void R2RootList::r2root8(const double* ta, double* rr, double* ww, const int n)
   1.29484188341784e-11,  1.59914716602756e-14,  2.81670689666026e-06,  3.19511395273038e-06,  1.34121954105447e-06,  2.54392597675789e-07,  2.13207820249633e-08,
   6.92487941424842e-10,  6.47416027038604e-12,  7.99567528269363e-15,  1.40834807497914e-06,  1.59755088190543e-06,  6.70607212835261e-07,  1.27195813881761e-07,
   1.06603503874542e-08,  3.46242652074817e-10,  3.23706781764529e-12,   3.9978224476694e-15  };
-  int offset = -8;
   const int ibox0 = static_cast<int>(log(64.0) / log(2.0));
-  for (int i = 1; i <= n; ++i) {
-    double t = ta[i-1];
-    offset += 8;
+  rys::interpolate<8>(ta, rr, ww, n, x, w, [&](double t, double* rt, double* wt) {
     if (std::isnan(t)) {
-      fill_n(rr+offset, 8, 0.5);
-      fill_n(ww+offset, 8, 0.0);
+      fill_n(rt, 8, 0.5);
+      fill_n(wt, 8, 0.0);
     } else if (t >= 131072.0) {
       for (int r = 0; r != 8; ++r) {
-        ww[offset+r] = aw[8-r-1] / t;
-        rr[offset+r] = 1.0 - ax[8-r-1] / t;
+        wt[r] = aw[8-r-1] / t;
+        rt[r] = 1.0 - ax[8-r-1] / t;
       }
     } else {
       assert(t >= 0);
@@ -1293,17 +1291,17 @@ void R2RootList::r2root8(const double* ta, double* rr, double* ww, const int n)
         g = t2*e - g + w[boxof+2];
         d = t2*f - d + x[boxof+1];
         e = t2*g - e + w[boxof+1];
-        rr[offset+j-1] = t*d - f + x[boxof+0]*0.5;
-        ww[offset+j-1] = t*e - g + w[boxof+0]*0.5;
+        rt[j-1] = t*d - f + x[boxof+0]*0.5;
+        wt[j-1] = t*e - g + w[boxof+0]*0.5;
         if (64.0 <= bigT && bigT < 131072.0) {
           const int iref = 4128 + (it - 32) * 8 + 8 - j;
           double rr_infty = x[iref];
           double ww_infty = w[iref];
           double Tref = pow(2.0, it + ibox0 + 1 - 32);
-          ww[offset+j-1] = ww[offset+j-1] * ww_infty * Tref / bigT;
-          rr[offset+j-1] = 1.0 + rr[offset+j-1] * (1.0 - rr_infty) * Tref /bigT;
+          wt[j-1] = wt[j-1] * ww_infty * Tref / bigT;
+          rt[j-1] = 1.0 + rt[j-1] * (1.0 - rr_infty) * Tref /bigT;
         }
       }
     }
-  }
+  });
 }
@@ -26,15 +26,16 @@
 #include <algorithm>
 #include <cassert>
 #include <src/integral/rys/spin2rootlist.h>
+#include <src/integral/rys/rootinterpolation.h>
 
 using namespace std;
 using namespace bagel;
 
 void Spin2RootList::spin2root1(const double* ta, double* rr, double* ww, const int n) {
 
-  constexpr double ax[1] = {2.500000000000000e+00};
-  constexpr double aw[1] = {6.646701940895685e-01};
-  constexpr double x[384] = {  1.328131665580148e+00, -5.174757555994045e-02, -1.461325278278165e-03,  7.301731444313293e-05,  6.622090874809514e-06,
+  static constexpr double ax[1] = {2.500000000000000e+00};
+  static constexpr double aw[1] = {6.646701940895685e-01};
+  static constexpr double x[384] = {  1.328131665580148e+00, -5.174757555994045e-02, -1.461325278278165e-03,  7.301731444313293e-05,  6.622090874809514e-06,
  -5.082132221841281e-08, -2.501061248784544e-08, -5.559707324692380e-10,  7.526801887971758e-11,  4.269755730235632e-12, -1.524875246446046e-13, -2.037498725953055e-14,
   1.105480184926600e+00, -5.842345371367089e-02, -8.869243792959951e-05,  1.389382374217188e-04,  8.036404955207344e-08, -5.010039455139302e-07,  1.031249952147384e-10,
   1.930411914904706e-09, -1.228663909124681e-12, -7.556243329728993e-12,  6.862084621446923e-15,  2.981885892876370e-14,  8.800538084414160e-01, -5.312173960832696e-02,
@@ -90,7 +91,7 @@ void Spin2RootList::spin2root1(const double* ta, double* rr, double* ww, const i
  -1.370006703907739e-20,  1.123031766956561e-22, -9.205178417503374e-25,  7.937507937511906e-02, -6.300006325009500e-04,  5.000320000637501e-06, -3.968757937514883e-08,
   3.150006312511850e-10, -2.500162500481876e-12,  1.984380953138890e-14, -1.575004731261046e-16,  1.250082500323724e-18, -9.921914687607708e-21,  7.875031500079676e-23,
  -6.250025000038161e-25  };
-  constexpr double w[384] = {  2.263881670308705e-01, -7.179973691078170e-02,  1.310022611239201e-02, -1.713865677452399e-03,  1.760154638907506e-04,
+  static constexpr double w[384] = {  2.263881670308705e-01, -7.179973691078170e-02,  1.310022611239201e-02, -1.713865677452399e-03,  1.760154638907506e-04,
  -1.492181753600646e-05,  1.078514626015634e-06, -6.798635444904323e-08,  3.801412732599497e-09, -1.910223000848757e-10,  8.717376670083458e-12, -3.638952638029034e-13,
   6.474999092672383e-02, -1.736445538953048e-02,  2.826030162475050e-03, -3.413642964458648e-04,  3.308461918751246e-05, -2.685105063451345e-06,  1.876212098765901e-07,
  -1.151331049912998e-08,  6.298510508311076e-10, -3.108367007046949e-11,  1.397161487259340e-12, -5.757639499532383e-14,  2.338243266075153e-02, -5.048879851827366e-03,
@@ -146,51 +147,5 @@ void Spin2RootList::spin2root1(const double* ta, double* rr, double* ww, const i
  -1.886337073984245e-22,  1.778220012790854e-24, -1.656283694782421e-26,  4.222058176840047e-05, -8.376637870948888e-07,  1.163449409036652e-08, -1.385118805033477e-10,
   1.511615744059951e-12, -1.559689512113930e-14,  1.547399794515246e-16, -1.491345957307605e-18,  1.405618315424668e-20, -1.301577012929481e-22,  1.188019550788592e-24,
  -1.071427089101464e-26  };
-  int offset = -1;
-  for (int i = 1; i <= n; ++i) {
-    double t = ta[i-1];
-    offset += 1;
-    if (std::isnan(t)) {
-      fill_n(rr+offset, 1, 0.5);
-      fill_n(ww+offset, 1, 0.0);
-    } else if (t >= 64.0) {
-      t = 1.0/sqrt(t);
-      for (int r = 0; r != 1; ++r) {
-        rr[offset+r] = ax[r]*t*t;
-        ww[offset+r] = aw[r]*t*t*t*t*t;
-      }
-    } else {
-      assert(t >= 0);
-      int it = static_cast<int>(t*   0.500000000000000);
-      t = (t-it*2.000000000000000-   1.000000000000000) *   1.000000000000000;
-      const double t2 = t * 2.0;
-      for (int j=1; j <=1; ++j) {
-        const int boxof = it*12+12*(j-1);
-        double d = x[boxof+11];
-        double e = w[boxof+11];
-        double f = t2*d + x[boxof+10];
-        double g = t2*e + w[boxof+10];
-        d = t2*f - d + x[boxof+9];
-        e = t2*g - e + w[boxof+9];
-        f = t2*d - f + x[boxof+8];
-        g = t2*e - g + w[boxof+8];
-        d = t2*f - d + x[boxof+7];
-        e = t2*g - e + w[boxof+7];
-        f = t2*d - f + x[boxof+6];
-        g = t2*e - g + w[boxof+6];
-        d = t2*f - d + x[boxof+5];
-        e = t2*g - e + w[boxof+5];
-        f = t2*d - f + x[boxof+4];
-        g = t2*e - g + w[boxof+4];
-        d = t2*f - d + x[boxof+3];
-        e = t2*g - e + w[boxof+3];
-        f = t2*d - f + x[boxof+2];
-        g = t2*e - g + w[boxof+2];
-        d = t2*f - d + x[boxof+1];
-        e = t2*g - e + w[boxof+1];
-        rr[offset+j-1] = t*d - f + x[boxof+0]*0.5;
-        ww[offset+j-1] = t*e - g + w[boxof+0]*0.5;
-      }
-    }
-  }
+  rys::interpolate_root<1,5>(ta, rr, ww, n, ax, aw, x, w);
 }
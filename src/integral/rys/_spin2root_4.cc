@@ -26,15 +26,16 @@
 #include <algorithm>
 #include <cassert>
 #include <src/integral/rys/spin2rootlist.h>
+#include <src/integral/rys/rootinterpolation.h>
 
 using namespace std;
 using namespace bagel;
 
 void Spin2RootList::spin2root4(const double* ta, double* rr, double* ww, const int n) {
 
-  constexpr double ax[4] = {9.785072681047292e-01,2.990377340190600e+00,6.319300497896596e+00,1.171181489380808e+01};
-  constexpr double aw[4] = {2.654349482046309e-01,3.386032767788276e-01,5.947439028776936e-02,1.157578818340595e-03};
-  constexpr double x[1536] = {  3.202378272141573e-01, -1.240976711498785e-02,  2.929162055594082e-04, -3.787509113602267e-06, -3.177964001284512e-08,
+  static constexpr double ax[4] = {9.785072681047292e-01,2.990377340190600e+00,6.319300497896596e+00,1.171181489380808e+01};
+  static constexpr double aw[4] = {2.654349482046309e-01,3.386032767788276e-01,5.947439028776936e-02,1.157578818340595e-03};
+  static constexpr double x[1536] = {  3.202378272141573e-01, -1.240976711498785e-02,  2.929162055594082e-04, -3.787509113602267e-06, -3.177964001284512e-08,
   3.187488554319952e-09, -8.212232355915388e-11,  4.838898822559775e-13,  4.324021201314503e-14, -1.847970511161891e-15,  2.862870749094820e-17,  6.089437129186683e-19,
   8.568485701435435e-01, -2.315910087647661e-02,  1.253082622604639e-04,  7.890726458676046e-06, -1.299008407137669e-07, -4.258510721823683e-09,  1.315314730759253e-10,
   2.375099532782046e-12, -1.365943490416382e-13, -9.772397395254163e-16,  1.357936562830839e-16, -1.270022188792806e-19,  1.449219960043999e+00, -1.941972709418471e-02,
@@ -254,7 +255,7 @@ void Spin2RootList::spin2root4(const double* ta, double* rr, double* ww, const i
  -6.319711251634665e-12,  5.015959803734531e-14, -3.981171185608305e-16,  3.159858322354986e-18, -2.507980231379361e-20,  1.990578396662140e-22, -1.579796258940352e-24,
   3.718504947290870e-01, -2.951380316333239e-03,  2.342512890290591e-05, -1.859254332895719e-07,  1.475691633810181e-09, -1.171257615987348e-11,  9.296280931061920e-14,
  -7.378465366176627e-16,  5.856292970500032e-18, -4.648140558965118e-20,  3.689217103833495e-22, -2.927891377556246e-24  };
-  constexpr double w[1536] = {  1.256761886958427e-02, -2.040276584147877e-03,  2.043813771615751e-04, -1.589874102088116e-05,  1.043791073371789e-06,
+  static constexpr double w[1536] = {  1.256761886958427e-02, -2.040276584147877e-03,  2.043813771615751e-04, -1.589874102088116e-05,  1.043791073371789e-06,
  -6.029131198298835e-08,  3.139700776010411e-09, -1.497514013328309e-10,  6.613307829046749e-12, -2.725325577887418e-13,  1.054069746622352e-14, -3.838428563104486e-16,
   5.874669695259668e-02, -1.436704353277752e-02,  2.047103471165938e-03, -2.148369535999931e-04,  1.821418170564284e-05, -1.309828888448682e-06,  8.231245185435172e-08,
  -4.611365413000598e-09,  2.336074595201230e-10, -1.081562288998475e-11,  4.614157620689579e-13, -1.823454773622134e-14,  9.355720415297419e-02, -3.113510223953505e-02,
@@ -474,51 +475,5 @@ void Spin2RootList::spin2root4(const double* ta, double* rr, double* ww, const i
  -1.395603166906068e-15,  1.384606383849024e-17, -1.334449668465402e-19,  1.257740993136019e-21, -1.164645460900388e-23,  1.063035421611520e-25, -9.587115638946532e-28,
   7.353067970809518e-08, -1.458861651168548e-09,  2.026244600838259e-11, -2.412300421856613e-13,  2.632605437129173e-15, -2.716329931792827e-17,  2.694926364564880e-19,
  -2.597303944910709e-21,  2.448002252849144e-23, -2.266806448805761e-25,  2.069040179993827e-27, -1.865998318013640e-29  };
-  int offset = -4;
-  for (int i = 1; i <= n; ++i) {
-    double t = ta[i-1];
-    offset += 4;
-    if (std::isnan(t)) {
-      fill_n(rr+offset, 4, 0.5);
-      fill_n(ww+offset, 4, 0.0);
-    } else if (t >= 64.0) {
-      t = 1.0/sqrt(t);
-      for (int r = 0; r != 4; ++r) {
-        rr[offset+r] = ax[r]*t*t;
-        ww[offset+r] = aw[r]*t*t*t*t*t;
-      }
-    } else {
-      assert(t >= 0);
-      int it = static_cast<int>(t*   0.500000000000000);
-      t = (t-it*2.000000000000000-   1.000000000000000) *   1.000000000000000;
-      const double t2 = t * 2.0;
-      for (int j=1; j <=4; ++j) {
-        const int boxof = it*48+12*(j-1);
-        double d = x[boxof+11];
-        double e = w[boxof+11];
-        double f = t2*d + x[boxof+10];
-        double g = t2*e + w[boxof+10];
-        d = t2*f - d + x[boxof+9];
-        e = t2*g - e + w[boxof+9];
-        f = t2*d - f + x[boxof+8];
-        g = t2*e - g + w[boxof+8];
-        d = t2*f - d + x[boxof+7];
-        e = t2*g - e + w[boxof+7];
-        f = t2*d - f + x[boxof+6];
-        g = t2*e - g + w[boxof+6];
-        d = t2*f - d + x[boxof+5];
-        e = t2*g - e + w[boxof+5];
-        f = t2*d - f + x[boxof+4];
-        g = t2*e - g + w[boxof+4];
-        d = t2*f - d + x[boxof+3];
-        e = t2*g - e + w[boxof+3];
-        f = t2*d - f + x[boxof+2];
-        g = t2*e - g + w[boxof+2];
-        d = t2*f - d + x[boxof+1];
-        e = t2*g - e + w[boxof+1];
-        rr[offset+j-1] = t*d - f + x[boxof+0]*0.5;
-        ww[offset+j-1] = t*e - g + w[boxof+0]*0.5;
-      }
-    }
-  }
+  rys::interpolate_root<4,5>(ta, rr, ww, n, ax, aw, x, w);
 }
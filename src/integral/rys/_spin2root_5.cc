@@ -26,17 +26,18 @@
 #include <algorithm>
 #include <cassert>
 #include <src/integral/rys/spin2rootlist.h>
+#include <src/integral/rys/rootinterpolation.h>
 
 using namespace std;
 using namespace bagel;
 
 void Spin2RootList::spin2root5(const double* ta, double* rr, double* ww, const int n) {
 
-  constexpr double ax[5] = {8.176317629750606e-01,2.472333925728521e+00,5.116006122967180e+00,9.044146511367595e+00,1.504988167696164e+01
+  static constexpr double ax[5] = {8.176317629750606e-01,2.472333925728521e+00,5.116006122967180e+00,9.044146511367595e+00,1.504988167696164e+01
     };
-  constexpr double aw[5] = {1.980155433947152e-01,3.473439742008963e-01,1.116138000341106e-01,7.631466765335309e-03,6.540969451109020e-05
+  static constexpr double aw[5] = {1.980155433947152e-01,3.473439742008963e-01,1.116138000341106e-01,7.631466765335309e-03,6.540969451109020e-05
     };
-  constexpr double x[1920] = {  2.318489066085380e-01, -7.956139295629345e-03,  1.781679569032828e-04, -2.729509001451717e-06,  1.620284387840667e-08,
+  static constexpr double x[1920] = {  2.318489066085380e-01, -7.956139295629345e-03,  1.781679569032828e-04, -2.729509001451717e-06,  1.620284387840667e-08,
   6.055094346081009e-10, -2.530906011018285e-11,  4.940866718769280e-13, -3.007620128849770e-15, -1.590013036545961e-16,  6.645813036702878e-18, -1.296681788792768e-19,
   6.383091318994880e-01, -1.713324488949626e-02,  1.868258066042386e-04,  2.027636229899657e-06, -9.918014265040615e-08,  5.317646032726502e-10,  4.234701747216910e-11,
  -9.521165512027909e-13, -9.850671353436585e-15,  7.457239172233309e-16, -6.229744112533893e-18, -3.872559306115114e-19,  1.135675815056198e+00, -1.973398304552693e-02,
@@ -311,7 +312,7 @@ void Spin2RootList::spin2root5(const double* ta, double* rr, double* ww, const i
   7.178811410629207e-14, -5.697821208330048e-16,  4.522330369643148e-18, -3.589225997316595e-20,  2.848185163585983e-22, -2.258416624494855e-24,  4.778342210779877e-01,
  -3.792573990218411e-03,  3.010168974226966e-05, -2.389173494091567e-07,  1.896288886553919e-09, -1.505085952532998e-11,  1.194587671912205e-13, -9.481438263408442e-16,
   7.525358234323943e-18, -5.972591450372105e-20,  4.739315280394704e-22, -3.757375669786233e-24  };
-  constexpr double w[1920] = {  5.882472092450335e-03, -7.924183300918967e-04,  6.626389929822969e-05, -4.341003566479913e-06,  2.421840042200989e-07,
+  static constexpr double w[1920] = {  5.882472092450335e-03, -7.924183300918967e-04,  6.626389929822969e-05, -4.341003566479913e-06,  2.421840042200989e-07,
  -1.199189056920721e-08,  5.398766472761845e-10, -2.244542397083054e-11,  8.710531789492477e-13, -3.179818825138298e-14,  1.098242723376196e-15, -3.601044671596979e-17,
   3.234404387643113e-02, -6.556605917747259e-03,  7.871137508950322e-04, -7.072200061993132e-05,  5.206765244557325e-06, -3.293139840016583e-07,  1.841307273186421e-08,
  -9.276532333428012e-10,  4.268135228038136e-11, -1.811401593161571e-12,  7.145524497933710e-14, -2.632808728376595e-15,  6.730053519041732e-02, -1.913540858364763e-02,
@@ -586,51 +587,5 @@ void Spin2RootList::spin2root5(const double* ta, double* rr, double* ww, const i
   1.776660278086705e-18, -1.712302502154773e-20,  1.613878182400804e-22, -1.494442801160827e-24,  1.364142775682916e-26, -1.230571069040643e-28,  4.154895736425556e-09,
  -8.243386404900345e-11,  1.144941823832358e-12, -1.363085011798427e-14,  1.487569704513515e-16, -1.534878781628631e-18,  1.522784857067091e-20, -1.467624411258098e-22,
   1.383269180122630e-24, -1.280921919136856e-26,  1.169327326660909e-28, -1.055155410559418e-30  };
-  int offset = -5;
-  for (int i = 1; i <= n; ++i) {
-    double t = ta[i-1];
-    offset += 5;
-    if (std::isnan(t)) {
-      fill_n(rr+offset, 5, 0.5);
-      fill_n(ww+offset, 5, 0.0);
-    } else if (t >= 64.0) {
-      t = 1.0/sqrt(t);
-      for (int r = 0; r != 5; ++r) {
-        rr[offset+r] = ax[r]*t*t;
-        ww[offset+r] = aw[r]*t*t*t*t*t;
-      }
-    } else {
-      assert(t >= 0);
-      int it = static_cast<int>(t*   0.500000000000000);
-      t = (t-it*2.000000000000000-   1.000000000000000) *   1.000000000000000;
-      const double t2 = t * 2.0;
-      for (int j=1; j <=5; ++j) {
-        const int boxof = it*60+12*(j-1);
-        double d = x[boxof+11];
-        double e = w[boxof+11];
-        double f = t2*d + x[boxof+10];
-        double g = t2*e + w[boxof+10];
-        d = t2*f - d + x[boxof+9];
-        e = t2*g - e + w[boxof+9];
-        f = t2*d - f + x[boxof+8];
-        g = t2*e - g + w[boxof+8];
-        d = t2*f - d + x[boxof+7];
-        e = t2*g - e + w[boxof+7];
-        f = t2*d - f + x[boxof+6];
-        g = t2*e - g + w[boxof+6];
-        d = t2*f - d + x[boxof+5];
-        e = t2*g - e + w[boxof+5];
-        f = t2*d - f + x[boxof+4];
-        g = t2*e - g + w[boxof+4];
-        d = t2*f - d + x[boxof+3];
-        e = t2*g - e + w[boxof+3];
-        f = t2*d - f + x[boxof+2];
-        g = t2*e - g + w[boxof+2];
-        d = t2*f - d + x[boxof+1];
-        e = t2*g - e + w[boxof+1];
-        rr[offset+j-1] = t*d - f + x[boxof+0]*0.5;
-        ww[offset+j-1] = t*e - g + w[boxof+0]*0.5;
-      }
-    }
-  }
+  rys::interpolate_root<5,5>(ta, rr, ww, n, ax, aw, x, w);
 }
@@ -26,17 +26,18 @@
 #include <algorithm>
 #include <cassert>
 #include <src/integral/rys/spin2rootlist.h>
+#include <src/integral/rys/rootinterpolation.h>
 
 using namespace std;
 using namespace bagel;
 
 void Spin2RootList::spin2root6(const double* ta, double* rr, double* ww, const int n) {
 
-  constexpr double ax[6] = {2.111413585358230e+00,7.026018149250148e-01,4.320708798707306e+00,7.485045658702520e+00,1.192096697299598e+01,
+  static constexpr double ax[6] = {2.111413585358230e+00,7.026018149250148e-01,4.320708798707306e+00,7.485045658702520e+00,1.192096697299598e+01,
     1.845926316931095e+01};
-  constexpr double aw[6] = {3.326244946046376e-01,1.516227523450486e-01,1.582847754169486e-01,2.141478108631498e-02,7.202345275522768e-04,
+  static constexpr double aw[6] = {3.326244946046376e-01,1.516227523450486e-01,1.582847754169486e-01,2.141478108631498e-02,7.202345275522768e-04,
     3.156109066429148e-06};
-  constexpr double x[2304] = {  1.753898249821826e-01, -5.365834224456515e-03,  1.113427896072529e-04, -1.731775036470972e-06,  1.730171126324275e-08,
+  static constexpr double x[2304] = {  1.753898249821826e-01, -5.365834224456515e-03,  1.113427896072529e-04, -1.731775036470972e-06,  1.730171126324275e-08,
   3.017429896035392e-11, -6.275733462428301e-12,  1.668833097305327e-13, -2.575509806094628e-15,  1.351975006434887e-17,  5.782990154822236e-19, -2.252071285565989e-20,
   4.914236793575537e-01, -1.256057032026019e-02,  1.639841753579186e-04, -1.367281777645388e-07, -4.243923673365225e-08,  7.739192541789510e-10,  1.693643771833336e-12,
  -3.362627650613017e-13,  5.536482788550405e-15,  4.259976716738348e-17, -3.355773022403107e-18,  4.572868374744003e-20,  9.005312641672009e-01, -1.700841233570506e-02,
@@ -366,7 +367,7 @@ void Spin2RootList::spin2root6(const double* ta, double* rr, double* ww, const i
  -7.509773991586883e-16,  5.958709330216508e-18, -4.722110450492406e-20,  3.721505248872252e-22, -2.867990060344033e-24,  5.860821917077740e-01, -4.651738988743282e-03,
   3.692088910504514e-05, -2.930413857763603e-07,  2.325871516168021e-09, -1.846043939413207e-11,  1.465193193645123e-13, -1.162853647515725e-15,  9.226268541571613e-18,
  -7.309378485352651e-20,  5.752305923184486e-22, -4.404958248475963e-24  };
-  constexpr double w[2304] = {  3.020381505541043e-03, -3.454170970985592e-04,  2.460936878710723e-05, -1.381657743919550e-06,  6.647116766247480e-08,
+  static constexpr double w[2304] = {  3.020381505541043e-03, -3.454170970985592e-04,  2.460936878710723e-05, -1.381657743919550e-06,  6.647116766247480e-08,
  -2.855485743760081e-09,  1.121827454358694e-10, -4.093123635419386e-12,  1.401742291051554e-13, -4.540349381268162e-15,  1.398948702253739e-16, -4.115082656531725e-18,
   1.839286325568009e-02, -3.137370803041570e-03,  3.209046581443735e-04, -2.486172054625294e-05,  1.594936287007786e-06, -8.872983539918665e-08,  4.401537678087741e-09,
  -1.983123146511580e-10,  8.221378517353337e-12, -3.166277389689851e-13,  1.141138235636970e-14, -3.867058647710886e-16,  4.471100426920558e-02, -1.083783880912454e-02,
@@ -696,51 +697,5 @@ void Spin2RootList::spin2root6(const double* ta, double* rr, double* ww, const i
  -1.616081399204948e-21,  1.523436061493713e-23, -1.411739232201425e-25,  1.292576071665399e-27, -1.179257514684243e-29,  2.004795191589323e-10, -3.977549011570920e-12,
   5.524504137322111e-14, -6.577075635850093e-16,  7.177733275487313e-18, -7.406018801865881e-20,  7.347745446132095e-22, -7.082036692435645e-24,  6.677149529654069e-26,
  -6.192303988226858e-28,  5.687561744581998e-30, -5.250198860343794e-32  };
-  int offset = -6;
-  for (int i = 1; i <= n; ++i) {
-    double t = ta[i-1];
-    offset += 6;
-    if (std::isnan(t)) {
-      fill_n(rr+offset, 6, 0.5);
-      fill_n(ww+offset, 6, 0.0);
-    } else if (t >= 64.0) {
-      t = 1.0/sqrt(t);
-      for (int r = 0; r != 6; ++r) {
-        rr[offset+r] = ax[r]*t*t;
-        ww[offset+r] = aw[r]*t*t*t*t*t;
-      }
-    } else {
-      assert(t >= 0);
-      int it = static_cast<int>(t*   0.500000000000000);
-      t = (t-it*2.000000000000000-   1.000000000000000) *   1.000000000000000;
-      const double t2 = t * 2.0;
-      for (int j=1; j <=6; ++j) {
-        const int boxof = it*72+12*(j-1);
-        double d = x[boxof+11];
-        double e = w[boxof+11];
-        double f = t2*d + x[boxof+10];
-        double g = t2*e + w[boxof+10];
-        d = t2*f - d + x[boxof+9];
-        e = t2*g - e + w[boxof+9];
-        f = t2*d - f + x[boxof+8];
-        g = t2*e - g + w[boxof+8];
-        d = t2*f - d + x[boxof+7];
-        e = t2*g - e + w[boxof+7];
-        f = t2*d - f + x[boxof+6];
-        g = t2*e - g + w[boxof+6];
-        d = t2*f - d + x[boxof+5];
-        e = t2*g - e + w[boxof+5];
-        f = t2*d - f + x[boxof+4];
-        g = t2*e - g + w[boxof+4];
-        d = t2*f - d + x[boxof+3];
-        e = t2*g - e + w[boxof+3];
-        f = t2*d - f + x[boxof+2];
-        g = t2*e - g + w[boxof+2];
-        d = t2*f - d + x[boxof+1];
-        e = t2*g - e + w[boxof+1];
-        rr[offset+j-1] = t*d - f + x[boxof+0]*0.5;
-        ww[offset+j-1] = t*e - g + w[boxof+0]*0.5;
-      }
-    }
-  }
+  rys::interpolate_root<6,5>(ta, rr, ww, n, ax, aw, x, w);
 }
@@ -26,17 +26,18 @@
 #include <algorithm>
 #include <cassert>
 #include <src/integral/rys/spin2rootlist.h>
+#include <src/integral/rys/rootinterpolation.h>
 
 using namespace std;
 using namespace bagel;
 
 void Spin2RootList::spin2root7(const double* ta, double* rr, double* ww, const int n) {
 
-  constexpr double ax[7] = {1.844325111398341e+00,6.161461916539803e-01,3.748770568452880e+00,6.422473300474675e+00,1.003266860073090e+01,
+  static constexpr double ax[7] = {1.844325111398341e+00,6.161461916539803e-01,3.748770568452880e+00,6.422473300474675e+00,1.003266860073090e+01,
     1.491198196210708e+01,2.192363426518214e+01};
-  constexpr double aw[7] = {3.079292426410160e-01,1.188289213436162e-01,1.938946542956340e-01,4.105323155280411e-02,2.909059203692048e-03,
+  static constexpr double aw[7] = {3.079292426410160e-01,1.188289213436162e-01,1.938946542956340e-01,4.105323155280411e-02,2.909059203692048e-03,
     5.494928613124585e-05,1.357666749797257e-07};
-  constexpr double x[2688] = {  1.372133197197556e-01, -3.774487191838195e-03,  7.214155893379237e-05, -1.084975520681669e-06,  1.220075030578213e-08,
+  static constexpr double x[2688] = {  1.372133197197556e-01, -3.774487191838195e-03,  7.214155893379237e-05, -1.084975520681669e-06,  1.220075030578213e-08,
  -6.586842230286832e-11, -1.222621641578356e-12,  4.816744963694561e-14, -9.406877160330040e-16,  1.174739547973289e-17, -4.876123243888516e-20, -2.109433222218614e-21,
   3.889672902073204e-01, -9.321521165744301e-03,  1.278593724530334e-04, -7.059775530095501e-07, -1.409898014873923e-08,  4.239865694769343e-10, -3.997876839047430e-12,
  -4.902725386623082e-14,  2.192277272435060e-15, -2.711238039571499e-17, -2.026746201783898e-19,  1.358205391343160e-20,  7.264354381041465e-01, -1.389985120436126e-02,
@@ -421,7 +422,7 @@ void Spin2RootList::spin2root7(const double* ta, double* rr, double* ww, const i
   7.385595283086410e-18, -5.644429887715802e-20,  3.760344865920325e-22, -8.665455773917204e-25,  6.960760839789989e-01, -5.524761375490211e-03,  4.385007365095915e-05,
  -3.480382531120975e-07,  2.762370835567902e-09, -2.192413548663493e-11,  1.739634885963469e-13, -1.378324887509953e-15,  1.083518627796766e-17, -8.204750834188512e-20,
   5.190843830011831e-22, -1.832765346068367e-25  };
-  constexpr double w[2688] = {  1.670205300060603e-03, -1.652419799988172e-04,  1.020567956119498e-05, -4.987376379332512e-07,  2.097836682521255e-08,
+  static constexpr double w[2688] = {  1.670205300060603e-03, -1.652419799988172e-04,  1.020567956119498e-05, -4.987376379332512e-07,  2.097836682521255e-08,
  -7.914031193197632e-10,  2.742013592470350e-11, -8.859440345982044e-13,  2.697484980252943e-14, -7.798576494342290e-16,  2.152965077760976e-17, -5.697012909825583e-19,
   1.089895584212271e-02, -1.588794898779405e-03,  1.402479921207832e-04, -9.464107542717225e-06,  5.331113696571569e-07, -2.622939686200559e-08,  1.158269895894816e-09,
  -4.673903189349210e-11,  1.745341606574079e-12, -6.087630050931001e-14,  1.997375539779985e-15, -6.193918162264215e-17,  2.934051270581383e-02, -6.103070382278904e-03,
@@ -806,51 +807,5 @@ void Spin2RootList::spin2root7(const double* ta, double* rr, double* ww, const i
   1.170421060649548e-24, -1.109803838176574e-26,  1.103156613571978e-28, -1.274001963012074e-30,  8.624048522169209e-12, -1.711026447498388e-13,  2.376482014656930e-15,
  -2.829270978722126e-17,  3.087685861217523e-19, -3.186103114963327e-21,  3.162341443930440e-23, -3.054755899910403e-25,  2.910441730325416e-27, -2.818315852456182e-29,
   3.003761949112402e-31, -4.057872604153547e-33  };
-  int offset = -7;
-  for (int i = 1; i <= n; ++i) {
-    double t = ta[i-1];
-    offset += 7;
-    if (std::isnan(t)) {
-      fill_n(rr+offset, 7, 0.5);
-      fill_n(ww+offset, 7, 0.0);
-    } else if (t >= 64.0) {
-      t = 1.0/sqrt(t);
-      for (int r = 0; r != 7; ++r) {
-        rr[offset+r] = ax[r]*t*t;
-        ww[offset+r] = aw[r]*t*t*t*t*t;
-      }
-    } else {
-      assert(t >= 0);
-      int it = static_cast<int>(t*   0.500000000000000);
-      t = (t-it*2.000000000000000-   1.000000000000000) *   1.000000000000000;
-      const double t2 = t * 2.0;
-      for (int j=1; j <=7; ++j) {
-        const int boxof = it*84+12*(j-1);
-        double d = x[boxof+11];
-        double e = w[boxof+11];
-        double f = t2*d + x[boxof+10];
-        double g = t2*e + w[boxof+10];
-        d = t2*f - d + x[boxof+9];
-        e = t2*g - e + w[boxof+9];
-        f = t2*d - f + x[boxof+8];
-        g = t2*e - g + w[boxof+8];
-        d = t2*f - d + x[boxof+7];
-        e = t2*g - e + w[boxof+7];
-        f = t2*d - f + x[boxof+6];
-        g = t2*e - g + w[boxof+6];
-        d = t2*f - d + x[boxof+5];
-        e = t2*g - e + w[boxof+5];
-        f = t2*d - f + x[boxof+4];
-        g = t2*e - g + w[boxof+4];
-        d = t2*f - d + x[boxof+3];
-        e = t2*g - e + w[boxof+3];
-        f = t2*d - f + x[boxof+2];
-        g = t2*e - g + w[boxof+2];
-        d = t2*f - d + x[boxof+1];
-        e = t2*g - e + w[boxof+1];
-        rr[offset+j-1] = t*d - f + x[boxof+0]*0.5;
-        ww[offset+j-1] = t*e - g + w[boxof+0]*0.5;
-      }
-    }
-  }
+  rys::interpolate_root<7,5>(ta, rr, ww, n, ax, aw, x, w);
 }
@@ -26,17 +26,18 @@
 #include <algorithm>
 #include <cassert>
 #include <src/integral/rys/spin2rootlist.h>
+#include <src/integral/rys/rootinterpolation.h>
 
 using namespace std;
 using namespace bagel;
 
 void Spin2RootList::spin2root8(const double* ta, double* rr, double* ww, const int n) {
 
-  constexpr double ax[8] = {1.638181097086517e+00,5.487420203051165e-01,3.315036043679075e+00,5.640313098679648e+00,8.715661629230398e+00,
+  static constexpr double ax[8] = {1.638181097086517e+00,5.487420203051165e-01,3.315036043679075e+00,5.640313098679648e+00,8.715661629230398e+00,
     1.271773901227562e+01,1.799242472404181e+01,2.543190237470182e+01};
-  constexpr double aw[8] = {2.802190264084516e-01,9.502528014008031e-02,2.180034910767602e-01,6.372428458829667e-02,7.384734624342899e-03,
+  static constexpr double aw[8] = {2.802190264084516e-01,9.502528014008031e-02,2.180034910767602e-01,6.372428458829667e-02,7.384734624342899e-03,
     3.097897070242660e-04,3.582194458958683e-06,5.350153581677309e-09};
-  constexpr double x[3072] = {  1.102271273123242e-01, -2.749069960333320e-03,  4.841546244464399e-05, -6.910866941131087e-07,  7.920427451020146e-09,
+  static constexpr double x[3072] = {  1.102271273123242e-01, -2.749069960333320e-03,  4.841546244464399e-05, -6.910866941131087e-07,  7.920427451020146e-09,
  -6.212316167716514e-11, -2.057159952330138e-14,  1.267271620916242e-14, -3.005475583837377e-16,  4.613010127875826e-18, -4.744380023372131e-20,  1.364196080293415e-22,
   3.150331026324857e-01, -7.042724106217383e-03,  9.638205114153620e-05, -7.382465664909713e-07, -2.808894254150959e-09,  1.889632489341102e-10, -2.866799576350930e-12,
   1.087197853738361e-14,  4.803715405377412e-16, -1.207876269268649e-17,  1.130069498517191e-19,  9.861531949343199e-22,  5.960706075260608e-01, -1.118508212004153e-02,
@@ -476,7 +477,7 @@ void Spin2RootList::spin2root8(const double* ta, double* rr, double* ww, const i
  -1.938538860312342e-20, -1.033981875046357e-21,  3.888169814401199e-23,  8.074637072558327e-01, -6.408845628232296e-03,  5.086702441674167e-05, -4.037281216934987e-07,
   3.204068686386126e-09, -2.540911022686878e-11,  2.004913017223481e-13, -1.536920557457157e-15,  1.005083645979279e-17, -6.107011269583135e-21, -2.164063621679383e-21,
   7.557455288260731e-23  };
-  constexpr double w[3072] = {  9.808305001404527e-04, -8.525743404185991e-05,  4.631499868303499e-06, -1.996482652114272e-07,  7.432193517616773e-09,
+  static constexpr double w[3072] = {  9.808305001404527e-04, -8.525743404185991e-05,  4.631499868303499e-06, -1.996482652114272e-07,  7.432193517616773e-09,
  -2.489660184887804e-10,  7.684388694814938e-12, -2.218669654822303e-13,  6.054763500102830e-15, -1.573534673195986e-16,  3.916224737011773e-18, -9.369717439073596e-20,
   6.723353627528778e-03, -8.495905026384545e-04,  6.551889577844250e-05, -3.891050077391200e-06,  1.941296044106437e-07, -8.507539060237068e-09,  3.363535121904978e-10,
  -1.220950350737673e-11,  4.119699354442858e-13, -1.303876290165898e-14,  3.897709812953880e-16, -1.105677255086257e-17,  1.944557177544501e-02, -3.503239884730586e-03,
@@ -916,51 +917,5 @@ void Spin2RootList::spin2root8(const double* ta, double* rr, double* ww, const i
  -1.148480089006950e-27,  2.093928118187873e-29, -4.768010408524727e-31,  3.398476456097979e-13, -6.742639087617155e-15,  9.365030680257139e-17, -1.114971514506914e-18,
   1.217134154407617e-20, -1.258171536429394e-22,  1.261498154084790e-24, -1.279379599740325e-26,  1.468496625991024e-28, -2.305779606333571e-30,  5.102299271576300e-32,
  -1.300215643505454e-33  };
-  int offset = -8;
-  for (int i = 1; i <= n; ++i) {
-    double t = ta[i-1];
-    offset += 8;
-    if (std::isnan(t)) {
-      fill_n(rr+offset, 8, 0.5);
-      fill_n(ww+offset, 8, 0.0);
-    } else if (t >= 64.0) {
-      t = 1.0/sqrt(t);
-      for (int r = 0; r != 8; ++r) {
-        rr[offset+r] = ax[r]*t*t;
-        ww[offset+r] = aw[r]*t*t*t*t*t;
-      }
-    } else {
-      assert(t >= 0);
-      int it = static_cast<int>(t*   0.500000000000000);
-      t = (t-it*2.000000000000000-   1.000000000000000) *   1.000000000000000;
-      const double t2 = t * 2.0;
-      for (int j=1; j <=8; ++j) {
-        const int boxof = it*96+12*(j-1);
-        double d = x[boxof+11];
-        double e = w[boxof+11];
-        double f = t2*d + x[boxof+10];
-        double g = t2*e + w[boxof+10];
-        d = t2*f - d + x[boxof+9];
-        e = t2*g - e + w[boxof+9];
-        f = t2*d - f + x[boxof+8];
-        g = t2*e - g + w[boxof+8];
-        d = t2*f - d + x[boxof+7];
-        e = t2*g - e + w[boxof+7];
-        f = t2*d - f + x[boxof+6];
-        g = t2*e - g + w[boxof+6];
-        d = t2*f - d + x[boxof+5];
-        e = t2*g - e + w[boxof+5];
-        f = t2*d - f + x[boxof+4];
-        g = t2*e - g + w[boxof+4];
-        d = t2*f - d + x[boxof+3];
-        e = t2*g - e + w[boxof+3];
-        f = t2*d - f + x[boxof+2];
-        g = t2*e - g + w[boxof+2];
-        d = t2*f - d + x[boxof+1];
-        e = t2*g - e + w[boxof+1];
-        rr[offset+j-1] = t*d - f + x[boxof+0]*0.5;
-        ww[offset+j-1] = t*e - g + w[boxof+0]*0.5;
-      }
-    }
-  }
+  rys::interpolate_root<8,5>(ta, rr, ww, n, ax, aw, x, w);
 }
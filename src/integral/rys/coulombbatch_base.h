@@ -28,6 +28,7 @@
 #define __SRC_RYSINT_COULOMBBATCH_BASE_H
 
 #include <src/integral/rys/rysintegral.h>
+#include <src/integral/rys/shellpair.h>
 #include <src/molecule/molecule.h>
 #include <src/util/constants.h>
 #include <src/integral/rys/inline.h>
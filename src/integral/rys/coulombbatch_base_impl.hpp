@@ -69,16 +69,36 @@ void CoulombBatch_Base<DataType, IntType>::compute_ssss(const double integral_th
   int index = 0;
   std::vector<std::shared_ptr<const Atom>> atoms = mol_->atoms();
 
+  // precomputed primitive-pair data (see shellpair.h); computed here for London orbitals
+  std::shared_ptr<const ShellPair> pair01;
+  if (IntType == Int_t::Standard)
+    pair01 = ShellPair::get(basisinfo_[0], basisinfo_[1]);
+
   const double onepi2 = 1.0 / (pi__ * pi__);
   const double sqrtpi = std::sqrt(pi__);
+  int index01 = 0;
   for (auto expi0 = exp0.begin(); expi0 != exp0.end(); ++expi0) {
-    for (auto expi1 = exp1.begin(); expi1 != exp1.end(); ++expi1) {
-      const double cxp = *expi0 + *expi1;
-      const double ab = *expi0 * *expi1;
-      const double cxp_inv = 1.0 / cxp;
-      const DataType px = get_PQ(basisinfo_[0]->position(0), basisinfo_[1]->position(0), *expi0, *expi1, cxp_inv, 0, 0, swap01_);
-      const DataType py = get_PQ(basisinfo_[0]->position(1), basisinfo_[1]->position(1), *expi0, *expi1, cxp_inv, 0, 1, swap01_);
-      const DataType pz = get_PQ(basisinfo_[0]->position(2), basisinfo_[1]->position(2), *expi0, *expi1, cxp_inv, 0, 2, swap01_);
+    for (auto expi1 = exp1.begin(); expi1 != exp1.end(); ++expi1, ++index01) {
+      double cxp, ab, cxp_inv, Eab;
+      DataType px, py, pz;
+      if (pair01) {
+        const PrimitivePair& p = pair01->prim(index01);
+        cxp = p.xp;
+        ab = p.ab;
+        cxp_inv = p.xp_inv;
+        Eab = p.eab;
+        px = p.center[0];
+        py = p.center[1];
+        pz = p.center[2];
+      } else {
+        cxp = *expi0 + *expi1;
+        ab = *expi0 * *expi1;
+        cxp_inv = 1.0 / cxp;
+        Eab = exp(-(AB_[0] * AB_[0] + AB_[1] * AB_[1] + AB_[2] * AB_[2]) * (ab * cxp_inv) );
+        px = get_PQ(basisinfo_[0]->position(0), basisinfo_[1]->position(0), *expi0, *expi1, cxp_inv, 0, 0, swap01_);
+        py = get_PQ(basisinfo_[0]->position(1), basisinfo_[1]->position(1), *expi0, *expi1, cxp_inv, 0, 1, swap01_);
+        pz = get_PQ(basisinfo_[0]->position(2), basisinfo_[1]->position(2), *expi0, *expi1, cxp_inv, 0, 2, swap01_);
+      }
       // For London orbitals, calculate the correction needed for the pre-integral coefficient
       DataType factor_ab;
       if (IntType == Int_t::London) {
@@ -98,7 +118,6 @@ void CoulombBatch_Base<DataType, IntType>::compute_ssss(const double integral_th
         P_[index * 3    ] = px;
         P_[index * 3 + 1] = py;
         P_[index * 3 + 2] = pz;
-        const double Eab = exp(-(AB_[0] * AB_[0] + AB_[1] * AB_[1] + AB_[2] * AB_[2]) * (ab * cxp_inv) );
         const double coeff_real = - 2 * Z * pi__ * cxp_inv * Eab;
         coeff_[index] = coeff_real;
         if (IntType == Int_t::London) coeff_[index] *= std::exp(factor_ab);
@@ -35,11 +35,18 @@ const static HRRList hrr;
 const static CarSphList carsphlist;
 
 void CoulombBatch_energy::compute() {
-  const double zero = 0.0;
-
   double* const stack_save = stack_->template get<double>(size_alloc_);
   bkup_ = stack_save;
 
+  fill_n(data_, size_alloc_, 0.0);
+  perform_vrr(data_, false);
+  perform_transform(data_);
+
+  stack_->release(size_alloc_, stack_save);
+}
+
+
+void CoulombBatch_energy::perform_vrr(double* const prim, const bool separate) {
   const int worksize = rank_ * amax1_;
 
   double* const workx = stack_->template get<double>(worksize);
@@ -55,11 +62,6 @@ void CoulombBatch_energy::compute() {
   double r1z[20];
   double r2[20];
 
-  const int alc = size_alloc_;
-  fill_n(data_, alc, zero);
-
-  const SortList sort(spherical1_);
-
   // perform VRR
   const int natom_unit = natom_ / (2 * L_ + 1);
   assert(natom_ % (2 * L_ + 1) == 0);
@@ -73,8 +75,8 @@ void CoulombBatch_energy::compute() {
     double disp[3];
     disp[0] = disp[1] = 0.0;
     disp[2] = A_ * cell;
-    const int offset_iprim = iprim * asize_;
-    double* current_data = &data_[offset_iprim];
+    const size_t offset_iprim = separate ? (static_cast<size_t>(resid) * primsize_ + iprim) * asize_ : iprim * asize_;
+    double* current_data = &prim[offset_iprim];
 
     const double* croots = roots_ + i * rank_;
     const double* cweights = weights_ + i * rank_;
@@ -121,11 +123,20 @@ void CoulombBatch_energy::compute() {
     }
   }
 
+  stack_->release(worksize, workz);
+  stack_->release(worksize, worky);
+  stack_->release(worksize, workx);
+}
+
+
+void CoulombBatch_energy::perform_transform(const double* prim) {
+  const SortList sort(spherical1_);
+
   // contract indices 01
   // data will be stored in bkup_: cont01{ xyz{ } }
   {
     const int m = asize_;
-    this->perform_contraction(m, data_, prim0size_, prim1size_, bkup_,
+    this->perform_contraction(m, prim, prim0size_, prim1size_, bkup_,
                         basisinfo_[0]->contractions(), basisinfo_[0]->contraction_ranges(), cont0size_,
                         basisinfo_[1]->contractions(), basisinfo_[1]->contraction_ranges(), cont1size_);
   }
@@ -159,11 +170,6 @@ void CoulombBatch_energy::compute() {
     sort.sortfunc_call(index, bkup_, data_, cont1size_, cont0size_, 1, swap01_);
     copy(bkup_, bkup_+size_final_, data_);
   }
-
-  stack_->release(worksize, workz);
-  stack_->release(worksize, worky);
-  stack_->release(worksize, workx);
-  stack_->release(size_alloc_, stack_save);
 }
 
 void CoulombBatch_energy::root_weight(const int ps) {
@@ -40,6 +40,13 @@ class CoulombBatch_energy : public CoulombBatch_Base<double> {
     std::vector<int> indexecp_;
     int max_rterms_;
 
+    // VRR for all the screened primitive pairs and nuclei. The contributions of the nuclei are summed into prim,
+    // or, with separate, stored in a block per nucleus, prim[nucleus][primitive pair][xyz]. prim should be zeroed.
+    void perform_vrr(double* const prim, const bool separate);
+    // contraction, HRR, and Cartesian-to-spherical transformation of one block of primitive integrals into data_.
+    // Uses bkup_ as a work area.
+    void perform_transform(const double* prim);
+
   public:
 
     CoulombBatch_energy(const std::array<std::shared_ptr<const Shell>,2>& _info, const std::shared_ptr<const Molecule> mol, std::shared_ptr<StackMem> stack = nullptr)
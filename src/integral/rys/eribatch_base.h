@@ -29,6 +29,7 @@
 
 #include <src/integral/rys/inline.h>
 #include <src/integral/rys/rysintegral.h>
+#include <src/integral/rys/shellpair.h>
 
 
 namespace bagel {
@@ -98,6 +98,13 @@ void ERIBatch_Base<DataType, IntType>::compute_ssss(const double integral_thresh
   const double r01_sq = AB_[0] * AB_[0] + AB_[1] * AB_[1] + AB_[2] * AB_[2];
   const double r23_sq = CD_[0] * CD_[0] + CD_[1] * CD_[1] + CD_[2] * CD_[2];
 
+  // precomputed primitive-pair data (see shellpair.h); the pairs are computed here for London orbitals and dummy shells
+  std::shared_ptr<const ShellPair> pair01, pair23;
+  if (IntType == Int_t::Standard) {
+    pair01 = ShellPair::get(basisinfo_[0], basisinfo_[1]);
+    pair23 = ShellPair::get(basisinfo_[2], basisinfo_[3]);
+  }
+
   unsigned int tuple_length = 0u;
   double* const tuple_field = stack_->template get<double>(nexp2*nexp3*3);
   int* tuple_index = (int*)(tuple_field+nexp2*nexp3*2);
@@ -110,14 +117,27 @@ void ERIBatch_Base<DataType, IntType>::compute_ssss(const double integral_thresh
     int index23 = 0;
     for (const double* expi2 = exp2; expi2 != exp2+nexp2; ++expi2) {
       for (const double* expi3 = exp3; expi3 != exp3+nexp3; ++expi3, ++index23) {
-        const double cxq = *expi2 + *expi3;
-        const double cdp = *expi2 * *expi3;
-        const double cd = rnd(*expi2) * rnd(*expi3);
-        const double cxq_inv = 1.0 / cxq;
-        Ecd_save[index23] = exp(-r23_sq * (cdp * cxq_inv) );
-        qx_save[index23] = get_PQ(cx, dx, *expi2, *expi3, cxq_inv, 2, 0, swap23_);
-        qy_save[index23] = get_PQ(cy, dy, *expi2, *expi3, cxq_inv, 2, 1, swap23_);
-        qz_save[index23] = get_PQ(cz, dz, *expi2, *expi3, cxq_inv, 2, 2, swap23_);
+        double cxq, cd, cxq_inv;
+        if (pair23) {
+          const PrimitivePair& q = pair23->prim(index23);
+          if (integral_thresh != 0.0 && !q.significant) continue;
+          cxq = q.xp;
+          cd = q.ab;
+          cxq_inv = q.xp_inv;
+          Ecd_save[index23] = q.eab;
+          qx_save[index23] = q.center[0];
+          qy_save[index23] = q.center[1];
+          qz_save[index23] = q.center[2];
+        } else {
+          cxq = *expi2 + *expi3;
+          const double cdp = *expi2 * *expi3;
+          cd = rnd(*expi2) * rnd(*expi3);
+          cxq_inv = 1.0 / cxq;
+          Ecd_save[index23] = exp(-r23_sq * (cdp * cxq_inv) );
+          qx_save[index23] = get_PQ(cx, dx, *expi2, *expi3, cxq_inv, 2, 0, swap23_);
+          qy_save[index23] = get_PQ(cy, dy, *expi2, *expi3, cxq_inv, 2, 1, swap23_);
+          qz_save[index23] = get_PQ(cz, dz, *expi2, *expi3, cxq_inv, 2, 2, swap23_);
+        }
 
         if (IntType == Int_t::London) {
           const double A_DC_x = (basisinfo_[3]->vector_potential(0) - basisinfo_[2]->vector_potential(0));
@@ -167,15 +187,29 @@ void ERIBatch_Base<DataType, IntType>::compute_ssss(const double integral_thresh
   const double min_Ecd = exp(-r23_sq * min_cdp * cxq_inv_min);
   for (const double* expi0 = exp0; expi0 != exp0+nexp0; ++expi0) {
     for (const double* expi1 = exp1; expi1 != exp1+nexp1; ++expi1, ++index01) {
-      const double cxp = *expi0 + *expi1;
-      const double abp = *expi0 * *expi1;
-      const double ab = rnd(*expi0) * rnd(*expi1);
-      const double cxp_inv = 1.0 / cxp;
-      const double Eab = std::exp(-r01_sq * (abp * cxp_inv) );
+      double cxp, ab, cxp_inv, Eab;
+      DataType px, py, pz;
+      if (pair01) {
+        const PrimitivePair& p = pair01->prim(index01);
+        if (integral_thresh != 0.0 && !p.significant) continue;
+        cxp = p.xp;
+        ab = p.ab;
+        cxp_inv = p.xp_inv;
+        Eab = p.eab;
+        px = p.center[0];
+        py = p.center[1];
+        pz = p.center[2];
+      } else {
+        cxp = *expi0 + *expi1;
+        const double abp = *expi0 * *expi1;
+        ab = rnd(*expi0) * rnd(*expi1);
+        cxp_inv = 1.0 / cxp;
+        Eab = std::exp(-r01_sq * (abp * cxp_inv) );
+        px = get_PQ(ax, bx, *expi0, *expi1, cxp_inv, 0, 0, swap01_);
+        py = get_PQ(ay, by, *expi0, *expi1, cxp_inv, 0, 1, swap01_);
+        pz = get_PQ(az, bz, *expi0, *expi1, cxp_inv, 0, 2, swap01_);
+      }
       const double coeff_half = 2 * Eab * std::pow(std::atan(1.0)*4.0, 2.5);
-      const DataType px = get_PQ(ax, bx, *expi0, *expi1, cxp_inv, 0, 0, swap01_);
-      const DataType py = get_PQ(ay, by, *expi0, *expi1, cxp_inv, 0, 1, swap01_);
-      const DataType pz = get_PQ(az, bz, *expi0, *expi1, cxp_inv, 0, 2, swap01_);
 
       // integral screening using P
       if (integral_thresh != 0.0) {
@@ -27,14 +27,14 @@
 #ifndef __SRC_INTEGRAL_RYS_ERIROOTLIST_H
 #define __SRC_INTEGRAL_RYS_ERIROOTLIST_H
 
-#include <functional>
 #include <src/util/constants.h>
 
 namespace bagel {
 
 struct ERIRootList  {
   private:
-    std::function<void (const double*, double*, double*, const int)> rfunc[RYS_MAX + 1];
+    // plain function pointers; the evaluators are instantiated for each rank at compile time (see rootinterpolation.h)
+    void (*rfunc[RYS_MAX + 1])(const double*, double*, double*, const int);
 
     static void eriroot1(const double*, double*, double*, const int);
     static void eriroot2(const double*, double*, double*, const int);
@@ -21,7 +21,12 @@
 #include "gmp_macros.h"
 #include <boost/lexical_cast.hpp>
 
+#include <chrono>
+#include <random>
 #include "../r2rootlist.h"
+#include "../erirootlist.h"
+#include "../breitrootlist.h"
+#include "../spin2rootlist.h"
 
 extern "C" {
   void dsyev_(const char*, const char*, const int*, double*, const int*, double*, double*, const int*, int*);
@@ -162,7 +167,30 @@ bool test(const int nrank, const double tin) {
   cout << "----------" << endl;
 }
 
-#include <boost/lexical_cast.hpp>
+// timing of the generated root evaluators for each rank, for T in the interpolated range [0, MAXT) and for T spread up to 4*MAXT
+template<class RootList>
+void benchmark(const RootList& list, const string name) {
+  const int nsize = 4096;
+  const int nrepeat = 200;
+  mt19937 gen(1);
+  vector<double> tin(nsize), tall(nsize);
+  for (auto& i : tin) i = uniform_real_distribution<double>(0.0, MAXT)(gen);
+  for (auto& i : tall) i = uniform_real_distribution<double>(0.0, 4*MAXT)(gen);
+  vector<double> rr(nsize*RYS_MAX), ww(nsize*RYS_MAX);
+
+  cout << "  " << name << " (ns per T)" << endl;
+  for (int nrank = 1; nrank <= RYS_MAX; ++nrank) {
+    cout << "    rank" << setw(3) << nrank;
+    for (auto& t : {tin, tall}) {
+      auto start = chrono::high_resolution_clock::now();
+      for (int i = 0; i != nrepeat; ++i)
+        list.root(nrank, t.data(), rr.data(), ww.data(), nsize);
+      const chrono::duration<double, nano> time = chrono::high_resolution_clock::now() - start;
+      cout << setw(12) << setprecision(2) << fixed << time.count() / (nrepeat*nsize);
+    }
+    cout << endl;
+  }
+}
 
 int main(int argc, char** argv) {
 
@@ -174,6 +202,13 @@ int main(int argc, char** argv) {
   if (argc > 1) {
     cout << "--- TEST---" << endl;
     const string toggle = argv[1];
+    if (toggle == "b") {
+      benchmark(eriroot__, "eriroot");
+      benchmark(breitroot__, "breitroot");
+      benchmark(spin2root__, "spin2root");
+      benchmark(r2root__, "r2root");
+      return 0;
+    }
     if (toggle == "t") {
 #if 0
       if (argc <= 3) assert(false);
@@ -360,6 +395,7 @@ int main(int argc, char** argv) {
 #ifndef SPIN2
 #ifdef BREIT
 ofs << "#include <src/integral/rys/breitrootlist.h>\n\
+#include <src/integral/rys/rootinterpolation.h>\n\
 \n\
 using namespace std;\n\
 using namespace bagel;\n\
@@ -368,6 +404,7 @@ void BreitRootList::" << func << nroot << "(const double* ta, double* rr, double
 #else
 #ifndef DAWSON
 ofs << "#include <src/integral/rys/erirootlist.h>\n\
+#include <src/integral/rys/rootinterpolation.h>\n\
 \n\
 using namespace std;\n\
 using namespace bagel;\n\
@@ -375,6 +412,7 @@ using namespace bagel;\n\
 void ERIRootList::" << func << nroot << "(const double* ta, double* rr, double* ww, const int n) {\n" << endl;
 #else
 ofs << "#include <src/integral/rys/r2rootlist.h>\n\
+#include <src/integral/rys/rootinterpolation.h>\n\
 \n\
 using namespace std;\n\
 using namespace bagel;\n\
@@ -384,6 +422,7 @@ void R2RootList::" << func << nroot << "(const double* ta, double* rr, double* w
 #endif
 #else
 ofs << "#include <src/integral/rys/spin2rootlist.h>\n\
+#include <src/integral/rys/rootinterpolation.h>\n\
 \n\
 using namespace std;\n\
 using namespace bagel;\n\
@@ -391,7 +430,7 @@ using namespace bagel;\n\
 void Spin2RootList::" << func << nroot << "(const double* ta, double* rr, double* ww, const int n) {\n" << endl;
 #endif
   ofs << "\
-  constexpr double ax["<<nroot<<"] = {";
+  static constexpr double ax["<<nroot<<"] = {";
     for (int j=0; j!= nroot; ++j) {
       ofs << scientific << setprecision(15) << setw(20) << aroot[j];
       if (j != nroot-1) ofs << ",";
@@ -399,7 +438,7 @@ void Spin2RootList::" << func << nroot << "(const double* ta, double* rr, double
     }
     ofs << "};" << endl;
     ofs << "\
-  constexpr double aw["<<nroot<<"] = {";
+  static constexpr double aw["<<nroot<<"] = {";
     for (int j=0; j!= nroot; ++j) {
       ofs << scientific << setprecision(15) << setw(20) << aweight[j];
       if (j != nroot-1) ofs << ",";
@@ -492,12 +531,12 @@ void Spin2RootList::" << func << nroot << "(const double* ta, double* rr, double
 #endif
 #ifndef SPIN2
 #ifndef BREIT
-    string tafactor = "t";
+    const int wpower = 1;
 #else
-    string tafactor = "t*t*t";
+    const int wpower = 3;
 #endif
 #else
-    string tafactor = "t*t*t*t*t";
+    const int wpower = 5;
 #endif
 
     int nbox2 = 0;
@@ -513,44 +552,30 @@ void Spin2RootList::" << func << nroot << "(const double* ta, double* rr, double
     }
 #endif
   ofs << "\
-  constexpr double x[" << nroot*nbox1*ndeg + nroot*nbox2 <<"] = {";
+  static constexpr double x[" << nroot*nbox1*ndeg + nroot*nbox2 <<"] = {";
   ofs << listx.str() << "\
   };" << endl;
   ofs << "\
-  constexpr double w[" << nroot*nbox1*ndeg + nroot*nbox2 <<"] = {";
+  static constexpr double w[" << nroot*nbox1*ndeg + nroot*nbox2 <<"] = {";
   ofs << listw.str() << "\
   };" << endl;
 
+#ifndef DAWSON
   ofs << "\
-  int offset = -" << nroot << ";\n";
-#ifdef DAWSON
-  ofs << "\
-  const int ibox0 = static_cast<int>(log(" << MAXT << ".0) / log(2.0)); \n";
-#endif
+  rys::interpolate_root<" << nroot << "," << wpower << ">(ta, rr, ww, n, ax, aw, x, w);\n\
+}" << endl;
+#else
+  // the SIMD lanes in rootinterpolation.h take care of T < MAXT; the remaining region is evaluated one by one
   ofs << "\
-  for (int i = 1; i <= n; ++i) {\n\
-    double t = ta[i-1];\n\
-    offset += " << nroot << ";\n\
+  const int ibox0 = static_cast<int>(log(" << MAXT << ".0) / log(2.0));\n\
+  rys::interpolate<" << nroot << ">(ta, rr, ww, n, x, w, [&](double t, double* rt, double* wt) {\n\
     if (std::isnan(t)) {\n\
-      fill_n(rr+offset, " << nroot << ", 0.5);\n\
-      fill_n(ww+offset, " << nroot << ", 0.0);\n";
-#ifndef DAWSON
-      ofs << "\
-    } else if (t >= " << MAXT << ".0) {\n\
-      t = 1.0/sqrt(t);\n\
-      for (int r = 0; r != " << nroot << "; ++r) {\n\
-        rr[offset+r] = ax[r]*t*t;\n\
-        ww[offset+r] = aw[r]*" + tafactor + ";\n\
-      }\n\
-    } else {\n\
-      assert(t >= 0);\n\
-      int it = static_cast<int>(t*" << setw(20) << setprecision(15) << fixed << 1.0/stride<< ");\n";
-#else
-      ofs << "\
+      fill_n(rt, " << nroot << ", 0.5);\n\
+      fill_n(wt, " << nroot << ", 0.0);\n\
     } else if (t >= " << infty << ".0) {\n\
       for (int r = 0; r != " << nroot << "; ++r) {\n\
-        ww[offset+r] = aw[" << nroot << "-r-1] / t;\n\
-        rr[offset+r] = 1.0 - ax[" << nroot << "-r-1] / t;\n\
+        wt[r] = aw[" << nroot << "-r-1] / t;\n\
+        rt[r] = 1.0 - ax[" << nroot << "-r-1] / t;\n\
       }\n\
     } else {\n\
       assert(t >= 0);\n";
@@ -599,7 +624,6 @@ void Spin2RootList::" << func << nroot << "(const double* ta, double* rr, double
         it = static_cast<int>(t*" << setw(20) << setprecision(15) << fixed << 1.0/stride<< ");\n\
         t = (t - it *" << stride << "-" << setw(20) << setprecision(15) << fixed << stride/2.0 << ") *" << setw(20) << setprecision(15) << fixed << 2.0/stride << ";\n\
       } \n";
-#endif
       ofs << "\
       const double t2 = t * 2.0;\n\
       for (int j=1; j <=" << nroot << "; ++j) {\n\
@@ -624,14 +648,14 @@ void Spin2RootList::" << func << nroot << "(const double* ta, double* rr, double
         g = t2*e - g + w[boxof+" << i-1 << "];\n";
           } else {
         ofs << "\
-        rr[offset+j-1] = t*d - f + x[boxof+" << i-1 << "]*0.5;\n\
-        ww[offset+j-1] = t*e - g + w[boxof+" << i-1 << "]*0.5;\n";
+        rt[j-1] = t*d - f + x[boxof+" << i-1 << "]*0.5;\n\
+        wt[j-1] = t*e - g + w[boxof+" << i-1 << "]*0.5;\n";
 #ifdef DAWSON
             if (MAXT < T_INFTY) {
         ofs << "\
         if (" << T_ASYM << ".0 <= bigT && bigT < " << infty << ".0) { \n\
-          ww[offset+j-1] = ww[offset+j-1] * ww_infty[" << nroot << "-j] * " << infty << ".0 / bigT;\n\
-          rr[offset+j-1] = 1.0 + rr[offset+j-1] * (1.0 - rr_infty[" << nroot << "-j]) * " << infty << ".0 /bigT; \n\
+          wt[j-1] = wt[j-1] * ww_infty[" << nroot << "-j] * " << infty << ".0 / bigT;\n\
+          rt[j-1] = 1.0 + rt[j-1] * (1.0 - rr_infty[" << nroot << "-j]) * " << infty << ".0 /bigT; \n\
         }\n";
             } else {
           ofs << "\
@@ -640,8 +664,8 @@ void Spin2RootList::" << func << nroot << "(const double* ta, double* rr, double
           double rr_infty = x[iref];\n\
           double ww_infty = w[iref];\n\
           double Tref = pow(2.0, it + ibox0 + 1 - " << NBOX << ");\n\
-          ww[offset+j-1] = ww[offset+j-1] * ww_infty * Tref / bigT;\n\
-          rr[offset+j-1] = 1.0 + rr[offset+j-1] * (1.0 - rr_infty) * Tref /bigT;\n\
+          wt[j-1] = wt[j-1] * ww_infty * Tref / bigT;\n\
+          rt[j-1] = 1.0 + rt[j-1] * (1.0 - rr_infty) * Tref /bigT;\n\
         }\n";
             }
 #endif
@@ -650,8 +674,10 @@ void Spin2RootList::" << func << nroot << "(const double* ta, double* rr, double
       ofs << "\
       }\n\
     }\n\
-  }\n\
-}";
+  });\n\
+}" << endl;
+#endif
+
 
 ofs.close();
   }
@@ -48,3 +48,30 @@ NAIBatch::NAIBatch(const array<shared_ptr<const Shell>,2>& _info, const shared_p
   root_weight(primsize_*natom_);
 }
 
+
+PointNAIBatch::PointNAIBatch(const array<shared_ptr<const Shell>,2>& _info, const shared_ptr<const Molecule> mol, shared_ptr<StackMem> stack)
+  : CoulombBatch_energy(_info, mol, stack) {
+  const double integral_thresh = PRIM_SCREEN_THRESH;
+
+  this->allocate_arrays(primsize_*natom_);
+  compute_ssss(integral_thresh);
+  root_weight(primsize_*natom_);
+}
+
+
+void PointNAIBatch::compute() {
+  double* const stack_save = stack_->get<double>(size_alloc_);
+  bkup_ = stack_save;
+
+  const size_t block = static_cast<size_t>(primsize_) * asize_;
+  vector<double> prim(natom_ * block, 0.0);
+  perform_vrr(prim.data(), true);
+
+  points_.resize(static_cast<size_t>(natom_) * size_final_);
+  for (int i = 0; i != natom_; ++i) {
+    perform_transform(prim.data() + i * block);
+    copy_n(data_, size_final_, points_.data() + static_cast<size_t>(i) * size_final_);
+  }
+
+  stack_->release(size_alloc_, stack_save);
+}
@@ -36,6 +36,22 @@ class NAIBatch : public CoulombBatch_energy {
     NAIBatch(const std::array<std::shared_ptr<const Shell>,2>& _info, const std::shared_ptr<const Molecule> mol, const int L, const double A = 0.0);
 };
 
+
+// Attraction integrals of each point charge in mol separately, i.e., a block of integrals per point in the layout of data().
+// The primitive-pair data and the Rys roots are set up once for all the points.
+class PointNAIBatch : public CoulombBatch_energy {
+  protected:
+    std::vector<double> points_;
+
+  public:
+    PointNAIBatch(const std::array<std::shared_ptr<const Shell>,2>& _info, const std::shared_ptr<const Molecule> mol, std::shared_ptr<StackMem> stack = nullptr);
+
+    void compute() override;
+
+    int npoint() const { return natom_; }
+    const double* point(const int i) const { return points_.data() + static_cast<size_t>(i)*size_final_; }
+};
+
 }
 
 #endif
@@ -0,0 +1,203 @@
+//
+// BAGEL - Parallel electron correlation program.
+// Filename: rootinterpolation.h
+// Copyright (C) 2026 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// The BAGEL package is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 3, or (at your option)
+// any later version.
+//
+// The BAGEL package is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the BAGEL package; see COPYING.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+
+
+#ifndef __SRC_RYSINT_ROOTINTERPOLATION_H
+#define __SRC_RYSINT_ROOTINTERPOLATION_H
+
+#include <cmath>
+#include <cassert>
+#include <algorithm>
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+// Evaluation of the Chebyshev-interpolated Rys roots and weights generated by interpolate/main.cc.
+// Below maxt__ the tables hold, for every box of width 2 and every root, ngrid__ coefficients of roots and of weights.
+// The interpolation is carried out for several T values at once in SIMD lanes; the remaining T values
+// (NaN, the asymptotic region, and the remainder of the batch) are handed to a family-specific scalar function.
+
+namespace bagel {
+namespace rys {
+
+constexpr int ngrid__ = 12;
+constexpr int maxt__ = 64;
+
+// each provides vec (lanes doubles), idx (lanes ints) and the few operations used below
+struct ScalarLanes {
+  static constexpr int lanes = 1;
+  using vec = double;
+  using idx = int;
+  static vec load(const double* a) { return *a; }
+  static void store(double* a, const vec b) { *a = b; }
+  static vec set1(const double a) { return a; }
+  static vec add(const vec a, const vec b) { return a + b; }
+  static vec sub(const vec a, const vec b) { return a - b; }
+  static vec mul(const vec a, const vec b) { return a * b; }
+  static idx truncate(const vec a) { return static_cast<int>(a); }
+  static vec convert(const idx a) { return a; }
+  static idx set1i(const int a) { return a; }
+  static idx addi(const idx a, const idx b) { return a + b; }
+  static idx muli(const idx a, const idx b) { return a * b; }
+  static vec gather(const double* base, const idx i) { return base[i]; }
+  // true if 0 <= a < maxt__ (false for NaN)
+  static bool interior(const vec a) { return a >= 0.0 && a < maxt__; }
+};
+
+#ifdef __AVX2__
+struct AVX2Lanes {
+  static constexpr int lanes = 4;
+  using vec = __m256d;
+  using idx = __m128i;
+  static vec load(const double* a) { return _mm256_loadu_pd(a); }
+  static void store(double* a, const vec b) { _mm256_storeu_pd(a, b); }
+  static vec set1(const double a) { return _mm256_set1_pd(a); }
+  static vec add(const vec a, const vec b) { return _mm256_add_pd(a, b); }
+  static vec sub(const vec a, const vec b) { return _mm256_sub_pd(a, b); }
+  static vec mul(const vec a, const vec b) { return _mm256_mul_pd(a, b); }
+  static idx truncate(const vec a) { return _mm256_cvttpd_epi32(a); }
+  static vec convert(const idx a) { return _mm256_cvtepi32_pd(a); }
+  static idx set1i(const int a) { return _mm_set1_epi32(a); }
+  static idx addi(const idx a, const idx b) { return _mm_add_epi32(a, b); }
+  static idx muli(const idx a, const idx b) { return _mm_mullo_epi32(a, b); }
+  static vec gather(const double* base, const idx i) { return _mm256_i32gather_pd(base, i, 8); }
+  static bool interior(const vec a) {
+    const vec in = _mm256_and_pd(_mm256_cmp_pd(a, set1(0.0), _CMP_GE_OQ), _mm256_cmp_pd(a, set1(maxt__), _CMP_LT_OQ));
+    return _mm256_movemask_pd(in) == 0xf;
+  }
+};
+#endif
+
+#ifdef __AVX512F__
+struct AVX512Lanes {
+  static constexpr int lanes = 8;
+  using vec = __m512d;
+  using idx = __m256i;
+  static vec load(const double* a) { return _mm512_loadu_pd(a); }
+  static void store(double* a, const vec b) { _mm512_storeu_pd(a, b); }
+  static vec set1(const double a) { return _mm512_set1_pd(a); }
+  static vec add(const vec a, const vec b) { return _mm512_add_pd(a, b); }
+  static vec sub(const vec a, const vec b) { return _mm512_sub_pd(a, b); }
+  static vec mul(const vec a, const vec b) { return _mm512_mul_pd(a, b); }
+  static idx truncate(const vec a) { return _mm512_cvttpd_epi32(a); }
+  static vec convert(const idx a) { return _mm512_cvtepi32_pd(a); }
+  static idx set1i(const int a) { return _mm256_set1_epi32(a); }
+  static idx addi(const idx a, const idx b) { return _mm256_add_epi32(a, b); }
+  static idx muli(const idx a, const idx b) { return _mm256_mullo_epi32(a, b); }
+  static vec gather(const double* base, const idx i) { return _mm512_i32gather_pd(i, base, 8); }
+  static bool interior(const vec a) {
+    return (_mm512_cmp_pd_mask(a, set1(0.0), _CMP_GE_OQ) & _mm512_cmp_pd_mask(a, set1(maxt__), _CMP_LT_OQ)) == 0xff;
+  }
+};
+using Lanes = AVX512Lanes;
+#elif defined(__AVX2__)
+using Lanes = AVX2Lanes;
+#else
+using Lanes = ScalarLanes;
+#endif
+
+
+// Clenshaw recurrence for Lanes::lanes values of T in [0, maxt__); rr and ww are laid out as in the root lists (root index runs fastest).
+// The order of floating-point operations is that of the scalar code the generator used to emit.
+template<int nroot, class L>
+inline void interpolate_interior(const typename L::vec tin, const double* x, const double* w, double* rr, double* ww) {
+  using vec = typename L::vec;
+  using idx = typename L::idx;
+  const idx it = L::truncate(L::mul(tin, L::set1(0.5)));
+  const vec t = L::sub(L::sub(tin, L::mul(L::convert(it), L::set1(2.0))), L::set1(1.0));
+  const vec t2 = L::mul(t, L::set1(2.0));
+  const vec half = L::set1(0.5);
+
+  idx boxof = L::muli(it, L::set1i(ngrid__*nroot));
+  for (int j = 0; j != nroot; ++j, boxof = L::addi(boxof, L::set1i(ngrid__))) {
+    vec d = L::gather(x+ngrid__-1, boxof);
+    vec e = L::gather(w+ngrid__-1, boxof);
+    vec f = L::add(L::mul(t2, d), L::gather(x+ngrid__-2, boxof));
+    vec g = L::add(L::mul(t2, e), L::gather(w+ngrid__-2, boxof));
+    for (int k = ngrid__-3; k >= 2; k -= 2) {
+      d = L::add(L::sub(L::mul(t2, f), d), L::gather(x+k, boxof));
+      e = L::add(L::sub(L::mul(t2, g), e), L::gather(w+k, boxof));
+      f = L::add(L::sub(L::mul(t2, d), f), L::gather(x+k-1, boxof));
+      g = L::add(L::sub(L::mul(t2, e), g), L::gather(w+k-1, boxof));
+    }
+    d = L::add(L::sub(L::mul(t2, f), d), L::gather(x+1, boxof));
+    e = L::add(L::sub(L::mul(t2, g), e), L::gather(w+1, boxof));
+
+    double r[L::lanes], s[L::lanes];
+    L::store(r, L::add(L::sub(L::mul(t, d), f), L::mul(L::gather(x, boxof), half)));
+    L::store(s, L::add(L::sub(L::mul(t, e), g), L::mul(L::gather(w, boxof), half)));
+    for (int l = 0; l != L::lanes; ++l) {
+      rr[l*nroot+j] = r[l];
+      ww[l*nroot+j] = s[l];
+    }
+  }
+}
+
+
+// Driver for a family. scalar(t, rr, ww) computes nroot roots and weights for a single T of any value.
+template<int nroot, class ScalarFunc>
+void interpolate(const double* ta, double* rr, double* ww, const int n, const double* x, const double* w, ScalarFunc scalar) {
+  int i = 0;
+  for ( ; i+Lanes::lanes <= n; i += Lanes::lanes) {
+    const Lanes::vec t = Lanes::load(ta+i);
+    if (Lanes::interior(t)) {
+      interpolate_interior<nroot, Lanes>(t, x, w, rr+i*nroot, ww+i*nroot);
+    } else {
+      for (int l = i; l != i+Lanes::lanes; ++l)
+        scalar(ta[l], rr+l*nroot, ww+l*nroot);
+    }
+  }
+  for ( ; i != n; ++i)
+    scalar(ta[i], rr+i*nroot, ww+i*nroot);
+}
+
+
+// Roots and weights of the ERI, Breit and spin-spin families. They differ only in the asymptotic weights, aw/T^(wpower/2).
+template<int nroot, int wpower>
+void interpolate_root(const double* ta, double* rr, double* ww, const int n, const double* ax, const double* aw, const double* x, const double* w) {
+  interpolate<nroot>(ta, rr, ww, n, x, w,
+    [&](double t, double* r, double* s) {
+      if (std::isnan(t)) {
+        std::fill_n(r, nroot, 0.5);
+        std::fill_n(s, nroot, 0.0);
+      } else if (t >= maxt__) {
+        t = 1.0/std::sqrt(t);
+        for (int k = 0; k != nroot; ++k) {
+          r[k] = ax[k]*t*t;
+          s[k] = aw[k];
+          for (int p = 0; p != wpower; ++p)
+            s[k] *= t;
+        }
+      } else {
+        assert(t >= 0);
+        interpolate_interior<nroot, ScalarLanes>(t, x, w, r, s);
+      }
+    });
+}
+
+}
+}
+
+#endif
@@ -0,0 +1,145 @@
+//
+// BAGEL - Parallel electron correlation program.
+// Filename: shellpair.cc
+// Copyright (C) 2026 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// The BAGEL package is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 3, or (at your option)
+// any later version.
+//
+// The BAGEL package is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the BAGEL package; see COPYING.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+
+
+#include <map>
+#include <mutex>
+#include <src/integral/rys/shellpair.h>
+
+using namespace std;
+using namespace bagel;
+
+constexpr double ShellPair::thresh__;
+
+namespace {
+  // The store is keyed by the addresses of the two shells. Shells are immutable, and the weak pointers
+  // detect an address that has been reused by a new shell (e.g., after the geometry is updated).
+  struct Entry {
+    weak_ptr<const Shell> a;
+    weak_ptr<const Shell> b;
+    shared_ptr<const ShellPair> pair;
+  };
+
+  // sharded so that threads computing different quartets rarely wait for each other
+  struct Shard {
+    mutex mtx;
+    map<pair<const Shell*, const Shell*>, Entry> entries;
+    size_t inserted = 0;
+    // number of primitive pairs held by the entries
+    size_t nprim = 0;
+  };
+
+  const int nshard__ = 64;
+  // entries of destroyed shells are purged after this many insertions into a shard
+  const size_t purge__ = 1024;
+  // at most 2^16 primitive pairs (4 MB) per shard, 256 MB in total; a full shard is emptied
+  const size_t maxprim__ = 1 << 16;
+  Shard shards__[nshard__];
+
+  size_t nprim(const Entry& e) { return e.pair->nprim0() * e.pair->nprim1(); }
+
+  // shells are heap allocated, so the low bits of their addresses are the same for all of them;
+  // those are shifted out, and the product is folded so that the high bits reach the shard index
+  size_t shard_index(const Shell* a, const Shell* b) {
+    const size_t h = (reinterpret_cast<size_t>(a) >> 4) * 0x9E3779B97F4A7C15ull ^ (reinterpret_cast<size_t>(b) >> 4);
+    return (h ^ (h >> 32)) % nshard__;
+  }
+}
+
+
+ShellPair::ShellPair(const Shell& a, const Shell& b) : nprim0_(a.num_primitive()), nprim1_(b.num_primitive()), prim_(nprim0_*nprim1_) {
+  const double ab_x = a.position(0) - b.position(0);
+  const double ab_y = a.position(1) - b.position(1);
+  const double ab_z = a.position(2) - b.position(2);
+  const double r01_sq = ab_x * ab_x + ab_y * ab_y + ab_z * ab_z;
+
+  auto iter = prim_.begin();
+  for (auto& expi0 : a.exponents()) {
+    for (auto& expi1 : b.exponents()) {
+      iter->xp = expi0 + expi1;
+      iter->ab = expi0 * expi1;
+      iter->xp_inv = 1.0 / iter->xp;
+      iter->eab = exp(-r01_sq * (iter->ab * iter->xp_inv));
+      for (int i = 0; i != 3; ++i)
+        iter->center[i] = (a.position(i)*expi0 + b.position(i)*expi1) * iter->xp_inv;
+      iter->significant = iter->eab > thresh__;
+      ++iter;
+    }
+  }
+}
+
+
+shared_ptr<const ShellPair> ShellPair::get(const shared_ptr<const Shell>& a, const shared_ptr<const Shell>& b) {
+  if (a->dummy() || b->dummy())
+    return nullptr;
+
+  const auto key = make_pair(a.get(), b.get());
+  Shard& shard = shards__[shard_index(a.get(), b.get())];
+  {
+    lock_guard<mutex> lock(shard.mtx);
+    auto iter = shard.entries.find(key);
+    if (iter != shard.entries.end() && iter->second.a.lock() == a && iter->second.b.lock() == b)
+      return iter->second.pair;
+  }
+
+  // computed outside the lock; if another thread got there first, its result is kept
+  auto out = make_shared<const ShellPair>(*a, *b);
+
+  lock_guard<mutex> lock(shard.mtx);
+  auto iter = shard.entries.find(key);
+  if (iter != shard.entries.end() && iter->second.a.lock() == a && iter->second.b.lock() == b)
+    return iter->second.pair;
+  if (iter != shard.entries.end())
+    shard.nprim -= nprim(iter->second);
+  Entry& entry = shard.entries[key];
+  entry = Entry{a, b, out};
+  shard.nprim += nprim(entry);
+
+  if (++shard.inserted % purge__ == 0 || shard.nprim > maxprim__) {
+    for (auto i = shard.entries.begin(); i != shard.entries.end(); ) {
+      if (i->second.a.expired() || i->second.b.expired()) {
+        shard.nprim -= nprim(i->second);
+        i = shard.entries.erase(i);
+      } else {
+        ++i;
+      }
+    }
+  }
+  // the batches that hold a pair keep it alive; the rest is recomputed on demand
+  if (shard.nprim > maxprim__) {
+    shard.entries.clear();
+    shard.nprim = 0;
+  }
+  return out;
+}
+
+
+void ShellPair::clear() {
+  for (auto& shard : shards__) {
+    lock_guard<mutex> lock(shard.mtx);
+    shard.entries.clear();
+    shard.nprim = 0;
+  }
+}
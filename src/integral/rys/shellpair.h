@@ -0,0 +1,75 @@
+//
+// BAGEL - Parallel electron correlation program.
+// Filename: shellpair.h
+// Copyright (C) 2026 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// The BAGEL package is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 3, or (at your option)
+// any later version.
+//
+// The BAGEL package is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the BAGEL package; see COPYING.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+
+
+#ifndef __SRC_INTEGRAL_RYS_SHELLPAIR_H
+#define __SRC_INTEGRAL_RYS_SHELLPAIR_H
+
+#include <src/molecule/shell.h>
+
+namespace bagel {
+
+// Quantities of a pair of primitives a (on A) and b (on B) that do not depend on the rest of an integral:
+// p = a + b, 1/p, the product center P = (aA + bB)/p, the prefactor exp(-ab/p |AB|^2), and ab.
+struct PrimitivePair {
+  double xp;
+  double xp_inv;
+  double eab;
+  double ab;
+  double center[3];
+  // false if the prefactor is so small that the pair is screened out of any integral
+  bool significant;
+};
+
+
+// Primitive-pair data of an ordered pair of shells. The data are computed once and shared through get(),
+// so that every batch built on the same pair of shells (ERI, gradient, and nuclear attraction batches) reuses them.
+class ShellPair {
+  protected:
+    int nprim0_;
+    int nprim1_;
+    // the exponent of the second shell runs fastest, as in the integral codes
+    std::vector<PrimitivePair> prim_;
+
+  public:
+    // pairs with the prefactor below this are negligible for any partner pair
+    static constexpr double thresh__ = 1.0e-30;
+
+    ShellPair(const Shell& a, const Shell& b);
+
+    int nprim0() const { return nprim0_; }
+    int nprim1() const { return nprim1_; }
+    const PrimitivePair& prim(const int i) const { return prim_[i]; }
+
+    // returns the data of (a, b), computing them on first use. Thread safe.
+    // Returns nullptr for dummy shells, which are constructed on the fly and are not worth caching.
+    static std::shared_ptr<const ShellPair> get(const std::shared_ptr<const Shell>& a, const std::shared_ptr<const Shell>& b);
+    // releases all the stored pairs (the store is also bounded in size; see shellpair.cc)
+    static void clear();
+};
+
+}
+
+#endif
@@ -27,14 +27,14 @@
 #ifndef __SRC_RYSINT_SPIN2ROOTLIST_H
 #define __SRC_RYSINT_SPIN2ROOTLIST_H
 
-#include <functional>
 #include <src/util/constants.h>
 
 namespace bagel {
 
 struct Spin2RootList  {
   private:
-    std::function<void (const double*, double*, double*, const int)> rfunc[RYS_MAX + 1];
+    // plain function pointers; the evaluators are instantiated for each rank at compile time (see rootinterpolation.h)
+    void (*rfunc[RYS_MAX + 1])(const double*, double*, double*, const int);
 
     static void spin2root1(const double*, double*, double*, const int);
     static void spin2root2(const double*, double*, double*, const int);
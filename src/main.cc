@@ -26,13 +26,17 @@
 #include <src/global.h>
 #include <src/pt2/mp2/mp2grad.h>
 #include <src/grad/force.h>
+#include <src/grad/batcheval.h>
+#include <src/grad/hessian.h>
 #include <src/opt/optimize.h>
 #include <src/wfn/localization.h>
 #include <src/asd/construct_asd.h>
 #include <src/asd/dmrg/rasd.h>
 #include <src/asd/multisite/multisite.h>
+#include <src/integral/rys/shellpair.h>
 #include <src/util/archive.h>
 #include <src/util/io/moldenout.h>
+#include <src/util/io/orbitalcheckpoint.h>
 
 // debugging
 extern void test_solvers(std::shared_ptr<bagel::Geometry>);
@@ -78,6 +82,8 @@ int main(int argc, char** argv) {
       if (title.empty()) throw runtime_error("title is missing in one of the input blocks");
 
       if (title == "molecule") {
+        // pairs of the previous geometry are not used again
+        ShellPair::clear();
         geom = geom ? make_shared<Geometry>(*geom, itree) : make_shared<Geometry>(itree);
         if (itree->get<bool>("restart", false))
           ref.reset();
@@ -91,16 +97,25 @@ int main(int argc, char** argv) {
       if ((title == "smith" || title == "fci") && ref == nullptr)
         throw runtime_error(title + " needs a reference");
 
-#ifndef DISABLE_SERIALIZATION
+      // "checkpoint" only stores orbitals (see util/io/orbitalcheckpoint.h); "archive" serializes the entire Reference
+      const string ref_format = to_lower(itree->get<string>("ref_format", "archive"));
+      if (ref_format != "archive" && ref_format != "checkpoint")
+        throw runtime_error("ref_format should be either archive or checkpoint");
+
       if (itree->get<bool>("load_ref", false)) {
         const string name = itree->get<string>("ref_in", "");
         if (name == "") throw runtime_error("Please provide a filename for the Reference object to be read.");
-        IArchive archive(name);
-        shared_ptr<Reference> ptr;
-        archive >> ptr;
-        ref = shared_ptr<Reference>(ptr);
-      }
+        if (ref_format == "checkpoint") {
+          ref = OrbitalCheckpoint(name + ".orb").read(geom);
+        } else {
+#ifndef DISABLE_SERIALIZATION
+          IArchive archive(name);
+          shared_ptr<Reference> ptr;
+          archive >> ptr;
+          ref = shared_ptr<Reference>(ptr);
 #endif
+        }
+      }
 
       // most methods are constructed here
       method = construct_method(title, itree, geom, ref);
@@ -118,13 +133,18 @@ int main(int argc, char** argv) {
 
         method->compute();
         ref = method->conv_to_ref();
-#ifndef DISABLE_SERIALIZATION
         if (itree->get<bool>("save_ref", false)) {
           const string name = itree->get<string>("ref_out", "reference");
-          OArchive archive(name);
-          archive << ref;
-        }
+          if (ref_format == "checkpoint") {
+            if (mpi__->rank() == 0)
+              OrbitalCheckpoint(name + ".orb").write(ref);
+          } else {
+#ifndef DISABLE_SERIALIZATION
+            OArchive archive(name);
+            archive << ref;
 #endif
+          }
+        }
 
       } else if (title == "optimize") {
 
@@ -136,6 +156,16 @@ int main(int argc, char** argv) {
         auto opt = make_shared<Force>(itree, geom, ref);
         opt->compute();
 
+      } else if (title == "batch") {
+
+        auto batch = make_shared<BatchEval>(itree, geom, ref);
+        batch->compute();
+
+      } else if (title == "hessian") {
+
+        auto hess = make_shared<Hessian>(itree, geom, ref);
+        hess->compute();
+
       } else if (title == "dimerize") { // dimerize forms the dimer object, does a scf calculation, and then localizes
         const string form = itree->get<string>("form", "displace");
         if (form == "d" || form == "disp" || form == "displace") {
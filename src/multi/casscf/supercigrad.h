@@ -35,10 +35,16 @@ class SuperCIGrad : public SuperCI {
 
   protected:
      int target_state_;
+     // several target states ("targets") share one CP-CASSCF solve
+     std::vector<int> target_states_;
 
   public:
     SuperCIGrad(std::shared_ptr<const PTree> idat, std::shared_ptr<const Geometry> geom, std::shared_ptr<const Reference> ref)
-      : SuperCI(idat, geom, ref),  target_state_(idat->get<int>("target", 0)) { }
+      : SuperCI(idat, geom, ref),  target_state_(idat->get<int>("target", 0)) {
+      target_states_ = idat->get_child_optional("targets") ? idat->get_vector<int>("targets") : std::vector<int>{target_state_};
+      if (target_states_.empty()) throw std::runtime_error("targets should not be empty");
+      target_state_ = target_states_.front();
+    }
 
     void compute() {
       // compute CASSCF fist
@@ -52,6 +58,7 @@ class SuperCIGrad : public SuperCI {
     }
 
     int target_state() const { return target_state_; }
+    const std::vector<int>& target_states() const { return target_states_; }
 
 };
 
@@ -34,7 +34,7 @@
 #include <src/scf/dhf/dirac.h>
 #include <src/scf/dhf/dfock.h>
 #include <src/wfn/relreference.h>
-#include <src/util/prim_op.h>
+#include <src/util/taskqueue.h>
 #include <src/util/f77.h>
 #include <src/util/parallel/resources.h>
 
@@ -133,26 +133,24 @@ void DMP2::compute() {
   dffull.front()->scale(dffull.front()->fac()); // take care of the factor
   assert(dffull.size() == 1);
   shared_ptr<const RelDFFull> full = dffull.front();
+  half_complex_exch.clear();
 
   cout << "    * 3-index integral transformation done" << endl;
 
+  // virtual orbitals are processed in blocks, and the 4-index integrals (ia|jb) are formed for a pair of blocks at a time.
+  // By default the block is chosen such that the 4-index buffer, o^2 n^2, does not exceed the 3-index integrals held on each node.
+  size_t nblock = idata_->get<int>("virtual_block", 0);
+  if (nblock == 0) {
+    size_t memory_size = full->get_real()->block(0)->size();
+    mpi__->broadcast(&memory_size, 1, 0);
+    nblock = static_cast<size_t>(sqrt(static_cast<double>(memory_size) / (2*nocc*nocc)));
+  }
+  nblock = max(size_t(1), min(nblock, nvirt));
+  cout << "    * virtual orbitals are processed in blocks of " << nblock << " (" << (nvirt-1)/nblock+1 << " blocks)" << endl;
+
   // assemble
   vector<double> eig(ref_->eig().begin()+ncore_, ref_->eig().end());
-  auto buf = make_shared<ZMatrix>(nocc*nvirt, nocc); // it is implicitly assumed that o^2v can be kept in core in each node
-
-  energy_ = 0.0;
-  for (size_t i = 0; i != nvirt; ++i) {
-    shared_ptr<ZMatrix> data = full->form_4index_1fixed(full, 1.0, i);
-    *buf = *data;
-    // using a symmetrizer (src/util/prim_op.h)
-    sort_indices<2,1,0,1,1,-1,1>(data->data(), buf->data(), nocc, nvirt, nocc);
-    complex<double>* tdata = buf->data();
-    for (size_t j = 0; j != nocc; ++j)
-      for (size_t k = 0; k != nvirt; ++k)
-        for (size_t l = 0; l != nocc; ++l, ++tdata)
-          *tdata /= -eig[i+nocc]+eig[j]-eig[k+nocc]+eig[l]; // assumed that the denominator is positive
-    energy_ += data->dot_product(buf).real() * 0.5;
-  }
+  energy_ = compute_energy(full, eig, nocc, nvirt, nblock);
 
   cout << "    * assembly done" << endl << endl;
   cout << "      DMP2 correlation energy: " << fixed << setw(15) << setprecision(10) << energy_ << setw(10) << setprecision(2) << timer.tick() << endl << endl;
@@ -163,3 +161,77 @@ void DMP2::compute() {
 }
 
 
+double DMP2::compute_energy(shared_ptr<const RelDFFull> full, const vector<double>& eig, const size_t nocc, const size_t nvirt, const size_t nblock) const {
+  if (full->get_real()->block().size() != 1 || full->get_imag()->block().size() != 1)
+    throw logic_error("DMP2 assumes that the 3-index integrals are stored in a single block");
+  shared_ptr<const DFBlock> real = full->get_real()->block(0);
+  shared_ptr<const DFBlock> imag = full->get_imag()->block(0);
+  // auxiliary functions held by this node; (gamma|ia) is stored with i running fastest
+  const size_t naux = real->asize();
+  const bool serial = full->get_real()->serial();
+
+  // (gamma|ia) for a in [astart, astart+n) as a complex matrix
+  auto slice = [&](const size_t astart, const size_t n) {
+    auto out = make_shared<ZMatrix>(naux, nocc*n);
+    const double* r = real->data() + naux*nocc*astart;
+    const double* i = imag->data() + naux*nocc*astart;
+    for (complex<double>* o = out->data(); o != out->data()+out->size(); ++o, ++r, ++i)
+      *o = complex<double>(*r, *i);
+    return out;
+  };
+
+  // only the pairs of blocks with ib <= jb are needed, as the contributions from (ia|jb) and (jb|ia) are identical
+  const size_t nb = (nvirt-1)/nblock+1;
+  double energy = 0.0;
+  int itile = 0;
+  for (size_t ib = 0; ib != nb; ++ib) {
+    const size_t astart = ib*nblock;
+    const size_t na = min(nblock, nvirt-astart);
+    shared_ptr<const ZMatrix> la = slice(astart, na);
+
+    for (size_t jb = ib; jb != nb; ++jb, ++itile) {
+      // when the 3-index integrals are distributed, (ia|jb) is summed up on the node that evaluates the energy
+      const int owner = itile % mpi__->size();
+      if (serial && owner != mpi__->rank()) continue;
+
+      const size_t bstart = jb*nblock;
+      const size_t nbb = min(nblock, nvirt-bstart);
+      shared_ptr<const ZMatrix> lb = jb == ib ? la : slice(bstart, nbb);
+
+      ZMatrix v(nocc*na, nocc*nbb);
+      if (naux)
+        zgemm3m_("T", "N", nocc*na, nocc*nbb, naux, 1.0, la->data(), naux, lb->data(), naux, 0.0, v.data(), nocc*na);
+      if (!serial) {
+        mpi__->reduce(reinterpret_cast<double*>(v.data()), 2*v.size(), owner);
+        if (owner != mpi__->rank()) continue;
+      }
+
+      // E = 1/2 sum (ia|jb)^* [(ia|jb) - (ja|ib)] / (e_i + e_j - e_a - e_b), threaded over b
+      vector<double> en(nbb);
+      TaskQueue<function<void(void)>> tasks(nbb);
+      for (size_t b = 0; b != nbb; ++b)
+        tasks.emplace_back(
+          [&, b]() {
+            const double eb = eig[nocc+bstart+b];
+            double sum = 0.0;
+            for (size_t j = 0; j != nocc; ++j) {
+              const complex<double>* vj = v.element_ptr(0, j+nocc*b);
+              for (size_t a = 0; a != na; ++a) {
+                const double ejab = eig[j] - eig[nocc+astart+a] - eb;
+                for (size_t i = 0; i != nocc; ++i) {
+                  const complex<double> iajb = vj[i+nocc*a];
+                  const complex<double> jaib = v(j+nocc*a, i+nocc*b);
+                  sum += std::real(conj(iajb) * (iajb - jaib)) / (eig[i] + ejab);
+                }
+              }
+            }
+            en[b] = sum;
+          }
+        );
+      tasks.compute();
+      energy += accumulate(en.begin(), en.end(), 0.0) * (ib == jb ? 0.5 : 1.0);
+    }
+  }
+  mpi__->allreduce(&energy, 1);
+  return energy;
+}
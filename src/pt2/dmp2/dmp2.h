@@ -32,6 +32,8 @@
 
 namespace bagel {
 
+class RelDFFull;
+
 class DMP2 : public Method {
   protected:
     std::shared_ptr<Dirac> scf_;
@@ -41,6 +43,9 @@ class DMP2 : public Method {
 
     double energy_;
 
+    // correlation energy from the transformed 3-index integrals; virtual orbitals are processed in blocks of nblock
+    double compute_energy(std::shared_ptr<const RelDFFull> full, const std::vector<double>& eig, const size_t nocc, const size_t nvirt, const size_t nblock) const;
+
   public:
     DMP2(const std::shared_ptr<const PTree>, const std::shared_ptr<const Geometry>, const std::shared_ptr<const Reference> = nullptr);
 
@@ -44,9 +44,11 @@ AtomicDensities::AtomicDensities(std::shared_ptr<const Geometry> g) : Matrix(g->
   // read basis file
   shared_ptr<const PTree> bdata = PTree::read_basis(defbasis);
 
-  auto ai = geom_->aux_atoms().begin();
+  // aux_atoms() is empty when the ERIs are Cholesky decomposed; the orbital basis is then used for fitting
+  const vector<shared_ptr<const Atom>>& aux = geom_->aux_atoms();
+  auto ai = aux.begin();
   for (auto& i : geom_->atoms()) {
-    if (i->dummy()) { ++ai; continue; }
+    if (i->dummy()) { if (ai != aux.end()) ++ai; continue; }
     if (atoms.find({i->name(),i->basis()}) == atoms.end()) {
       // dummy buffer to suppress the output
       stringstream ss;
@@ -56,7 +58,7 @@ AtomicDensities::AtomicDensities(std::shared_ptr<const Geometry> g) : Matrix(g->
       shared_ptr<PTree> geomop = make_shared<PTree>();
       const string basis = i->basis();
       geomop->put("basis", basis);
-      const string dfbasis = (*ai)->basis();
+      const string dfbasis = ai != aux.end() ? (*ai)->basis() : "";
       geomop->put("df_basis", !dfbasis.empty() ? dfbasis : basis);
 
       auto atom = make_shared<const Atom>(i->spherical(), i->name(), array<double,3>{{0.0,0.0,0.0}}, basis, make_pair(defbasis, bdata), nullptr);
@@ -72,7 +74,7 @@ AtomicDensities::AtomicDensities(std::shared_ptr<const Geometry> g) : Matrix(g->
     copy_block(offset, offset, i->nbasis(), i->nbasis(), iter->second);
     offset += i->nbasis();
 
-    ++ai;
+    if (ai != aux.end()) ++ai;
   }
 
 }
@@ -24,6 +24,8 @@
 //
 
 #include <src/scf/dhf/dfock.h>
+#include <src/mat1e/rel/reloverlap.h>
+#include <src/util/muffle.h>
 
 using namespace std;
 using namespace bagel;
@@ -35,6 +37,32 @@ void DFock::two_electron_part(const shared_ptr<const ZMatrix> coeff, const doubl
 
   assert(geom_->nbasis()*4 == coeff->ndim());
 
+  // G[D] is linear in D and G[T D T^-1] = T G[D] T^-1 without a magnetic field, so that
+  // a Kramers-restricted density needs the half transform and exchange of only half of the spinors
+  if (kramers_ && !store_half_ && !geom_->magnetism()) {
+    shared_ptr<const ZMatrix> unbarred = kramers_coeff(coeff);
+    if (unbarred) {
+      const ZMatrix hc(*this);
+      zero();
+      two_electron_part_batch(unbarred, scale_exchange);
+      const ZMatrix g(*this);
+      add_time_reversal(g);
+      *this += hc;
+    } else {
+      cout << "  ** warning : occupied spinors are not closed under time reversal; the Fock matrix is built without Kramers symmetry" << endl;
+      two_electron_part_batch(coeff, scale_exchange);
+    }
+  } else {
+    two_electron_part_batch(coeff, scale_exchange);
+  }
+
+  if (ssss_ == "scc")
+    add_small_coulomb_correction(coeff, scale_exchange);
+}
+
+
+void DFock::two_electron_part_batch(const shared_ptr<const ZMatrix> coeff, const double scale_exchange) {
+
   auto ocoeffall = make_shared<ZMatrix>(*coeff);
   const int nocc = coeff->mdim();
   const int nbatch = (nocc-1) / batchsize+1;
@@ -64,6 +92,137 @@ void DFock::two_electron_part(const shared_ptr<const ZMatrix> coeff, const doubl
 }
 
 
+shared_ptr<const ZMatrix> DFock::kramers_coeff(const shared_ptr<const ZMatrix> coeff) const {
+  const int n = geom_->nbasis();
+  const int nocc = coeff->mdim();
+  if (nocc % 2 != 0) return nullptr;
+
+  // time reversal of the spinors: (a, b, c, d) -> (-b*, a*, -d*, c*)
+  shared_ptr<const ZMatrix> conjg = coeff->get_conjg();
+  ZMatrix tcoeff(4*n, nocc);
+  for (int i = 0; i != 4; ++i)
+    tcoeff.add_block(i%2 == 0 ? -1.0 : 1.0, i*n, 0, n, nocc, conjg->get_submatrix((i^1)*n, 0, n, nocc));
+
+  // time reversal within the occupied space, M = C^+ S T(C). The space is closed iff M is unitary (for orthonormal C).
+  const ZMatrix sc(*make_shared<RelOverlap>(geom_) * *coeff);
+  ZMatrix ovl(*coeff % sc);
+  const ZMatrix m(sc % tcoeff);
+  ovl.add_diag(-1.0);
+  const double thresh = 1.0e-8;
+  if (ovl.rms() > thresh || fabs(m.dot_product(m).real() - nocc) > thresh*nocc) return nullptr;
+
+  // Gram-Schmidt in the occupied space with pivoting, adding q and t(q) = M q* together.
+  // Unlike the columns of the identity, the residual norms are 1 - sum_k |q_k(j)|^2.
+  ZMatrix q(nocc, nocc);
+  vector<double> residual(nocc, 1.0);
+  for (int k = 0; k != nocc/2; ++k) {
+    const int j = max_element(residual.begin(), residual.end()) - residual.begin();
+    ZVectorB x(nocc);
+    x(j) = 1.0;
+    for (int iter = 0; iter != 2; ++iter)
+      for (int l = 0; l != 2*k; ++l) {
+        const complex<double> proj = blas::dot_product(q.element_ptr(0, l), nocc, x.data());
+        blas::ax_plus_y_n(-proj, q.element_ptr(0, l), nocc, x.data());
+      }
+    const double xnorm = sqrt(blas::dot_product(x.data(), nocc, x.data()).real());
+    blas::scale_n(1.0/xnorm, x.data(), nocc);
+    copy_n(x.data(), nocc, q.element_ptr(0, 2*k));
+
+    // t(q) is orthogonal to q and to all the previous pairs
+    for (int i = 0; i != nocc; ++i)
+      x(i) = conj(x(i));
+    zgemv_("N", nocc, nocc, 1.0, m.data(), nocc, x.data(), 1, 0.0, q.element_ptr(0, 2*k+1), 1);
+
+    for (int i = 0; i != nocc; ++i)
+      residual[i] -= std::norm(q.element(i, 2*k)) + std::norm(q.element(i, 2*k+1));
+  }
+
+  auto out = make_shared<ZMatrix>(4*n, nocc/2);
+  for (int k = 0; k != nocc/2; ++k)
+    zgemv_("N", 4*n, nocc, 1.0, coeff->data(), 4*n, q.element_ptr(0, 2*k), 1, 0.0, out->element_ptr(0, k), 1);
+  return out;
+}
+
+
+void DFock::add_time_reversal(const ZMatrix& g) {
+  // (T G T^-1)_{ij} = u_i u_j G*_{i'j'}, where i' is the Kramers partner of i and u = -1 for alpha and +1 for beta
+  const int n = geom_->nbasis();
+  for (int j = 0; j != 4; ++j)
+    for (int i = 0; i != 4; ++i)
+      add_block(i%2 == j%2 ? 1.0 : -1.0, i*n, j*n, n, n, g.get_submatrix((i^1)*n, (j^1)*n, n, n)->get_conjg());
+}
+
+
+vector<shared_ptr<const Geometry>> DFock::atomic_geometries(shared_ptr<const Geometry> geom) {
+  if (geom->magnetism()) throw runtime_error("The simple Coulomb correction has not been implemented with a GIAO basis set.");
+  Muffle hide_cout;
+  // the fitting functions of each atom are taken from the same auxiliary basis set (as in the SCF atomic densities)
+  auto geominfo = make_shared<PTree>();
+  geominfo->put("df_basis", geom->auxfile());
+  geominfo->put("schwarz_thresh", geom->schwarz_thresh());
+  geominfo->put("thresh_overlap", geom->overlap_thresh());
+
+  vector<shared_ptr<const Geometry>> out;
+  for (auto& i : geom->atoms()) {
+    if (i->nbasis() == 0) {
+      out.push_back(nullptr);
+      continue;
+    }
+    auto atom = make_shared<Geometry>(vector<shared_ptr<const Atom>>{i}, geominfo);
+    atom->compute_relativistic_integrals(false);
+    out.push_back(atom);
+  }
+  return out;
+}
+
+
+void DFock::add_small_coulomb_correction(const shared_ptr<const ZMatrix> coeff, const double scale_exch) {
+  if (geom_->magnetism()) throw runtime_error("The simple Coulomb correction has not been implemented with a GIAO basis set.");
+  const int n = geom_->nbasis();
+  const vector<shared_ptr<const Atom>>& atoms = geom_->atoms();
+  assert(atomic_geoms_.size() == atoms.size());
+
+  // one-centre (SS|SS) Coulomb and exchange, each atom with its own fit
+  int offset = 0;
+  for (int a = 0; a != atoms.size(); ++a) {
+    const int na = atoms[a]->nbasis();
+    if (na) {
+      auto acoeff = make_shared<ZMatrix>(4*na, coeff->mdim());
+      for (int i = 0; i != 4; ++i)
+        acoeff->copy_block(i*na, 0, na, coeff->mdim(), coeff->get_submatrix(i*n+offset, 0, na, coeff->mdim()));
+      const DFock afock(atomic_geoms_[a], make_shared<ZMatrix>(4*na, 4*na), acoeff, false, false, false, robust_, scale_exch, false, "only");
+      for (int j = 2; j != 4; ++j)
+        for (int i = 2; i != 4; ++i)
+          add_block(1.0, i*n+offset, j*n+offset, na, na, afock.get_submatrix(i*na, j*na, na, na));
+    }
+    offset += na;
+  }
+
+  vector<int> atom_of;
+  for (int a = 0; a != atoms.size(); ++a)
+    atom_of.insert(atom_of.end(), atoms[a]->nbasis(), a);
+
+  // Mulliken small-component charges q_A = sum_{m in A} (D S)_mm
+  shared_ptr<const ZMatrix> sovl = RelOverlap(geom_).get_submatrix(2*n, 2*n, 2*n, 2*n);
+  shared_ptr<const ZMatrix> csmall = coeff->get_submatrix(2*n, 0, 2*n, coeff->mdim());
+  const ZMatrix ds((*csmall ^ *csmall) * *sovl);
+  vector<double> charge(atoms.size(), 0.0);
+  for (int i = 0; i != 2*n; ++i)
+    charge[atom_of[i%n]] += ds.element(i, i).real();
+
+  // two-centre part: E = 1/2 sum_{A != B} q_A q_B / R_AB, so that F_mn = 1/2 (V_A(m) + V_A(n)) S_mn
+  vector<double> potential(atoms.size(), 0.0);
+  for (int a = 0; a != atoms.size(); ++a)
+    for (int b = 0; b != atoms.size(); ++b)
+      if (a != b && atoms[a]->nbasis() && atoms[b]->nbasis())
+        potential[a] += charge[b] / atoms[a]->distance(atoms[b]);
+
+  for (int j = 0; j != 2*n; ++j)
+    for (int i = 0; i != 2*n; ++i)
+      element(2*n+i, 2*n+j) += 0.5 * (potential[atom_of[i%n]] + potential[atom_of[j%n]]) * sovl->element(i, j);
+}
+
+
 void DFock::add_Jop_block(shared_ptr<const RelDF> dfdata, list<shared_ptr<const RelCDMatrix>> cd, const double scale) {
 
   const int n = geom_->nbasis();
@@ -186,6 +345,9 @@ void DFock::driver(array<shared_ptr<const Matrix>, 4> rocoeff, array<shared_ptr<
   }
 
   list<shared_ptr<RelDF>> dfdists = make_dfdists(dfs, gaunt);
+  // the (SS|SS) integrals alone need only the small-component distributions
+  if (ssss_ == "only")
+    dfdists.remove_if([](shared_ptr<const RelDF> i) { return i->cartesian().first == Comp::L; });
   // Note that we are NOT using dagger-ed coefficients! -1 factor for imaginary will be compensated by RelCDMatrix and Exop
   list<shared_ptr<RelDFHalf>> half_complex = make_half_complex(dfdists, rocoeff, iocoeff);
 
@@ -208,7 +370,7 @@ void DFock::driver(array<shared_ptr<const Matrix>, 4> rocoeff, array<shared_ptr<
 
   // before computing K operators, we factorize half_complex
   factorize(half_complex_exch);
-  assert(gaunt  || half_complex_exch.size() == 8);
+  assert(gaunt  || half_complex_exch.size() == (ssss_ == "only" ? 6 : 8));
   assert(!gaunt || half_complex_exch.size() == 24);
 
   if (breit) {
@@ -246,6 +408,17 @@ void DFock::driver(array<shared_ptr<const Matrix>, 4> rocoeff, array<shared_ptr<
   // this is a necessary condition if we use symmetry below (Exop)
   assert(half_complex_exch.size() == half_complex_exch2.size());
 
+  // (SS|SS) contributions are those between the half-transformed integrals of small components (only in the Coulomb term)
+  auto small = [&gaunt](shared_ptr<const RelDFHalf> h) { return !gaunt && h->cartesian().first != Comp::L; };
+  const bool neglect_ssss = ssss_ == "neglect" || ssss_ == "scc";
+  vector<double> norm1, norm2;
+  if (ss_thresh_ > 0.0) {
+    for (auto& i : half_complex_exch)
+      norm1.push_back(sqrt(pow(i->get_real()->norm(), 2) + pow(i->get_imag()->norm(), 2)));
+    for (auto& i : half_complex_exch2)
+      norm2.push_back(sqrt(pow(i->get_real()->norm(), 2) + pow(i->get_imag()->norm(), 2)));
+  }
+
   // will use the zgemm3m-like algorithm
   for (auto& i : half_complex_exch)
     i->set_sum_diff();
@@ -262,6 +435,11 @@ void DFock::driver(array<shared_ptr<const Matrix>, 4> rocoeff, array<shared_ptr<
     int jcnt = 0;
     for (auto j = half_complex_exch2.begin(); j != half_complex_exch2.end(); ++j, ++jcnt) {
       if ((*i)->alpha_matches(*j) && ((!robust_ && icnt <= jcnt) || robust_)) {
+        if (small(*i) && small(*j)) {
+          if (neglect_ssss) continue;
+          // |K| <= |(ri|P)| |(P|sj)| (Frobenius norms)
+          if (ss_thresh_ > 0.0 && norm1[icnt]*norm2[jcnt]*fabs(scale_exchange) < ss_thresh_) continue;
+        }
         add_Exop_block(*i, *j, gscale*scale_exchange, icnt == jcnt);
       }
     }
@@ -269,16 +447,19 @@ void DFock::driver(array<shared_ptr<const Matrix>, 4> rocoeff, array<shared_ptr<
 
   timer.tick_print(printtag + ": K operator");
 
-  list<shared_ptr<const RelCDMatrix>> cd;
+  list<shared_ptr<const RelCDMatrix>> cd, cdlarge;
   // compute J operators
   for (auto& j : half_complex_exch2) {
     for (auto& i : j->basis()) {
       cd.push_back(make_shared<RelCDMatrix>(j, i, trocoeff, tiocoeff, geom_->df()->data2()));
+      if (!small(j))
+        cdlarge.push_back(cd.back());
     }
   }
 
   for (auto& i : dfdists) {
-    add_Jop_block(i, cd, gscale);
+    const bool ssss = !gaunt && neglect_ssss && i->cartesian().first != Comp::L;
+    add_Jop_block(i, ssss ? cdlarge : cd, gscale);
   }
 
   // this is for gradient calculations
@@ -38,6 +38,14 @@ class DFock : public ZMatrix {
     const bool breit_;
 
     void two_electron_part(const std::shared_ptr<const ZMatrix> coeff, const double scale_ex);
+    void two_electron_part_batch(const std::shared_ptr<const ZMatrix> coeff, const double scale_ex);
+
+    // returns one spinor from each Kramers pair spanning the occupied space, or nullptr if the space is not closed under time reversal
+    std::shared_ptr<const ZMatrix> kramers_coeff(const std::shared_ptr<const ZMatrix> coeff) const;
+    // adds T G T^-1 to this, where T is time reversal acting on (La, Lb, Sa, Sb)
+    void add_time_reversal(const ZMatrix& g);
+    // replaces the neglected (SS|SS) integrals by their one-centre part and the Coulomb interaction of atomic small-component charges
+    void add_small_coulomb_correction(const std::shared_ptr<const ZMatrix> coeff, const double scale_exch);
 
 
     void add_Jop_block(std::shared_ptr<const RelDF>, std::list<std::shared_ptr<const RelCDMatrix>>, const double scale);
@@ -53,14 +61,32 @@ class DFock : public ZMatrix {
     // if true, do not use bra-ket symmetry in the exchange build (only useful for breit when accurate orbitals are needed).
     bool robust_;
 
+    // if true, only one spinor of each Kramers pair is transformed, and the rest of the Fock matrix is obtained by time reversal
+    bool kramers_;
+
+    // treatment of the (SS|SS) integrals: "full", "neglect", or "scc" (neglected, with the simple Coulomb correction).
+    // "only" computes the (SS|SS) contributions alone and is used internally for the one-centre part of "scc".
+    std::string ssss_;
+    // single-atom geometries with the relativistic fits, used by "scc"
+    std::vector<std::shared_ptr<const Geometry>> atomic_geoms_;
+    // exchange contributions from pairs of small-component half-transformed integrals are skipped when bounded by this
+    double ss_thresh_;
+
   public:
     DFock(const std::shared_ptr<const Geometry> a,
           const std::shared_ptr<const ZMatrix> hc,
           const std::shared_ptr<const ZMatrix> coeff, const bool gaunt, const bool breit,
-          const bool store_half, const bool robust = false, const double scale_exch = 1.0)
-     : ZMatrix(*hc), geom_(a), gaunt_(gaunt), breit_(breit), store_half_(store_half), robust_(robust) {
+          const bool store_half, const bool robust = false, const double scale_exch = 1.0, const bool kramers = false,
+          const std::string ssss = "full", const double ss_thresh = 0.0,
+          const std::vector<std::shared_ptr<const Geometry>> atomic_geoms = std::vector<std::shared_ptr<const Geometry>>())
+     : ZMatrix(*hc), geom_(a), gaunt_(gaunt), breit_(breit), store_half_(store_half), robust_(robust), kramers_(kramers), ssss_(ssss),
+       atomic_geoms_(atomic_geoms), ss_thresh_(ss_thresh) {
 
        assert(breit ? gaunt : true);
+       if (ssss_ != "full" && ssss_ != "neglect" && ssss_ != "scc" && ssss_ != "only")
+         throw std::runtime_error("unknown treatment of (SS|SS) integrals: " + ssss_);
+       if (ssss_ == "scc" && atomic_geoms_.empty())
+         atomic_geoms_ = atomic_geometries(geom_);
        two_electron_part(coeff, scale_exch);
     }
 
@@ -83,6 +109,9 @@ class DFock : public ZMatrix {
 
     std::list<std::shared_ptr<RelDFHalf>> half() const { assert(store_half_); return half_; }
 
+    // one Geometry per atom of a relativistic geom, with its own small-component fit (nullptr for atoms without basis functions)
+    static std::vector<std::shared_ptr<const Geometry>> atomic_geometries(std::shared_ptr<const Geometry> geom);
+
 };
 
 }
@@ -46,12 +46,22 @@ Dirac::Dirac(const shared_ptr<const PTree> idata, const shared_ptr<const Geometr
   gaunt_ = idata->get<bool>("gaunt", false);
   breit_ = idata->get<bool>("breit", gaunt_);
   robust_ = idata->get<bool>("robust", false);
+  // closed-shell Fock builds using time-reversal symmetry
+  kramers_ = idata->get<bool>("kramers", false);
+  ssss_ = to_lower(idata->get<string>("ssss", "full"));
+  if (ssss_ != "full" && ssss_ != "neglect" && ssss_ != "scc")
+    throw runtime_error("Unknown treatment of (SS|SS) integrals: " + ssss_ + " (should be full, neglect, or scc)");
+  ss_thresh_ = idata->get<double>("ss_thresh", 0.0);
+  lazy_gaunt_ = gaunt_ && idata->get<bool>("lazy_gaunt", false);
 
   // when computing gradient, we store half-transform integrals
   do_grad_ = idata->get<bool>("gradient", false);
   if (do_grad_ && geom_->magnetism()) throw runtime_error("Gradient integrals have not been implemented for a GIAO basis.");
+  if (do_grad_ && ssss_ != "full") throw runtime_error("Gradients are not available with approximate (SS|SS) integrals.");
 
-  geom_ = geom->relativistic(gaunt_);
+  geom_ = geom->relativistic(gaunt_ && !lazy_gaunt_);
+  if (ssss_ == "scc")
+    atomic_geoms_ = DFock::atomic_geometries(geom_);
   common_init(idata);
 }
 
@@ -108,12 +118,14 @@ void Dirac::compute() {
   cout << endl;
   cout << indent << "=== Dirac RHF iteration (" + geom_->basisfile() + ", " << (geom_->magnetism() ? "RMB" : "RKB") << ") ===" << endl << indent << endl;
 
-  DIIS<DistZMatrix, ZMatrix> diis(5);
+  auto diis = make_shared<DIIS<DistZMatrix, ZMatrix>>(5);
+  bool gaunt = gaunt_ && !lazy_gaunt_;
 
   for (int iter = 0; iter != max_iter_; ++iter) {
     Timer ptime(1);
 
-    auto fock = make_shared<DFock>(geom_, hcore_, coeff->matrix()->slice_copy(nneg_, nele_+nneg_), gaunt_, breit_, do_grad_, robust_);
+    auto fock = make_shared<DFock>(geom_, hcore_, coeff->matrix()->slice_copy(nneg_, nele_+nneg_), gaunt, breit_ && gaunt, do_grad_, robust_, 1.0, kramers_,
+                                   ssss_, ss_thresh_, atomic_geoms_);
 
 // TODO I have a feeling that the code should not need this, but sometimes there are slight errors. still looking on it.
 #if 0
@@ -139,7 +151,14 @@ void Dirac::compute() {
     cout << indent << setw(5) << iter << setw(20) << fixed << setprecision(8) << energy_
          << "   " << setw(17) << error << setw(15) << setprecision(2) << scftime.tick() << endl;
 
-    if (error < thresh_scf_ && iter > 0) {
+    const bool switch_gaunt = error < thresh_scf_ && iter > 0 && gaunt != gaunt_;
+    if (switch_gaunt) {
+      cout << indent << endl << indent << "  * Dirac-Coulomb SCF converged. Switching on the " << (breit_ ? "Breit" : "Gaunt") << " term." << endl << indent << endl;
+      geom_->compute_gaunt_integrals();
+      gaunt = true;
+      // the Dirac-Coulomb Fock matrix is not put in the new DIIS; with its small error it would dominate the extrapolation
+      diis = make_shared<DIIS<DistZMatrix, ZMatrix>>(5);
+    } else if (error < thresh_scf_ && iter > 0) {
       cout << indent << endl << indent << "  * SCF iteration converged." << endl << endl;
       // when computing gradient, we store half-transform integrals to avoid recomputation
       if (do_grad_) half_ = fock->half();
@@ -149,8 +168,8 @@ void Dirac::compute() {
       throw runtime_error("Max iteration reached in Dirac--Fock SCF");
     }
 
-    if (iter >= diis_start_) {
-      distfock = diis.extrapolate({distfock, error_vector});
+    if (iter >= diis_start_ && !switch_gaunt) {
+      distfock = diis->extrapolate({distfock, error_vector});
       ptime.tick_print("DIIS");
     }
 
@@ -211,7 +230,7 @@ shared_ptr<const DistZMatrix> Dirac::initial_guess(const shared_ptr<const DistZM
 
     if (relref->rel()) {
       // Relativistic (4-component) reference
-      shared_ptr<ZMatrix> fock = make_shared<DFock>(geom_, hcore_, relref->relcoeff()->slice_copy(0, nele_), gaunt_, breit_, /*store_half*/false, robust_);
+      shared_ptr<ZMatrix> fock = make_shared<DFock>(geom_, hcore_, relref->relcoeff()->slice_copy(0, nele_), gaunt_ && !lazy_gaunt_, breit_ && !lazy_gaunt_, /*store_half*/false, robust_);
       DistZMatrix interm = *s12 % *fock->distmatrix() * *s12;
       interm.diagonalize(eig);
       coeff = make_shared<const DistZMatrix>(*s12 * interm);
@@ -225,7 +244,7 @@ shared_ptr<const DistZMatrix> Dirac::initial_guess(const shared_ptr<const DistZM
       auto ocoeff = make_shared<ZMatrix>(n*4, 2*nocc);
       ocoeff->add_block(1.0, 0,    0, n, nocc, relref->relcoeff()->slice(0,nocc));
       ocoeff->add_block(1.0, n, nocc, n, nocc, relref->relcoeff()->slice(0,nocc));
-      fock = make_shared<DFock>(geom_, hcore_, ocoeff, gaunt_, breit_, /*store_half*/false, robust_);
+      fock = make_shared<DFock>(geom_, hcore_, ocoeff, gaunt_ && !lazy_gaunt_, breit_ && !lazy_gaunt_, /*store_half*/false, robust_);
       DistZMatrix interm = *s12 % *fock->distmatrix() * *s12;
       interm.diagonalize(eig);
       coeff = make_shared<const DistZMatrix>(*s12 * interm);
@@ -240,7 +259,7 @@ shared_ptr<const DistZMatrix> Dirac::initial_guess(const shared_ptr<const DistZM
       auto ocoeff = make_shared<ZMatrix>(n*4, 2*nocc);
       ocoeff->add_real_block(1.0, 0,    0, n, nocc, ref_->coeff()->slice(0,nocc));
       ocoeff->add_real_block(1.0, n, nocc, n, nocc, ref_->coeff()->slice(0,nocc));
-      fock = make_shared<DFock>(geom_, hcore_, ocoeff, gaunt_, breit_, /*store_half*/false, robust_);
+      fock = make_shared<DFock>(geom_, hcore_, ocoeff, gaunt_ && !lazy_gaunt_, breit_ && !lazy_gaunt_, /*store_half*/false, robust_);
     } else if (ref_->noccB() != 0) {
       // UHF & ROHF
       const int nocca = ref_->noccA();
@@ -249,13 +268,13 @@ shared_ptr<const DistZMatrix> Dirac::initial_guess(const shared_ptr<const DistZM
       auto ocoeff = make_shared<ZMatrix>(n*4, nocca+noccb);
       ocoeff->add_real_block(1.0, 0,     0, n, nocca, ref_->coeffA()->slice(0,nocca));
       ocoeff->add_real_block(1.0, n, nocca, n, noccb, ref_->coeffB()->slice(0,noccb));
-      fock = make_shared<DFock>(geom_, hcore_, ocoeff, gaunt_, breit_, /*store_half*/false, robust_);
+      fock = make_shared<DFock>(geom_, hcore_, ocoeff, gaunt_ && !lazy_gaunt_, breit_ && !lazy_gaunt_, /*store_half*/false, robust_);
     } else {
       // CASSCF
       auto ocoeff = make_shared<ZMatrix>(n*4, 2*nele_);
       ocoeff->add_real_block(1.0, 0,     0, n, nele_, ref_->coeff()->slice(0,nele_));
       ocoeff->add_real_block(1.0, n, nele_, n, nele_, ref_->coeff()->slice(0,nele_));
-      fock = make_shared<DFock>(geom_, hcore_, ocoeff, gaunt_, breit_, /*store_half*/false, robust_);
+      fock = make_shared<DFock>(geom_, hcore_, ocoeff, gaunt_ && !lazy_gaunt_, breit_ && !lazy_gaunt_, /*store_half*/false, robust_);
     }
     DistZMatrix interm = *s12 % *fock->distmatrix() * *s12;
     interm.diagonalize(eig);
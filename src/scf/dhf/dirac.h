@@ -50,6 +50,14 @@ class Dirac : public Method {
 
     // for Fock build
     bool robust_;
+    bool kramers_;
+    // approximations to the (SS|SS) integrals (see DFock)
+    std::string ssss_;
+    double ss_thresh_;
+    // single-atom geometries for the one-centre (SS|SS) term of "scc", built once for all the iterations
+    std::vector<std::shared_ptr<const Geometry>> atomic_geoms_;
+    // if true, the Gaunt (and Breit) terms are computed only after the Dirac-Coulomb SCF has converged
+    bool lazy_gaunt_;
 
     std::shared_ptr<const ZMatrix> hcore_;
     std::shared_ptr<const ZMatrix> overlap_;
@@ -24,6 +24,7 @@
 //
 
 #include <src/scf/giaohf/fock_london.h>
+#include <src/util/taskqueue.h>
 
 using namespace std;
 using namespace bagel;
@@ -31,134 +32,144 @@ using namespace bagel;
 
 // Non-DF Fock matrix, GIAO basis
 template <>
-void Fock_London<0>::fock_two_electron_part(std::shared_ptr<const ZMatrix> den_ex) {
-  const std::vector<std::shared_ptr<const Atom>> atoms = geom_->atoms();
-  std::vector<std::shared_ptr<const Shell>> basis;
-  std::vector<int> offset;
-  int cnt = 0;
-  for (auto aiter = atoms.begin(); aiter != atoms.end(); ++aiter, ++cnt) {
-    const std::vector<std::shared_ptr<const Shell>> tmp = (*aiter)->shells();
+void Fock_London<0>::fock_two_electron_part(shared_ptr<const ZMatrix> den_ex) {
+  vector<shared_ptr<const Shell>> basis;
+  vector<int> offset;
+  for (int iatom = 0; iatom != geom_->natom(); ++iatom) {
+    const vector<shared_ptr<const Shell>> tmp = geom_->atoms(iatom)->shells();
     basis.insert(basis.end(), tmp.begin(), tmp.end());
-    const std::vector<int> tmpoff = geom_->offset(cnt);
+    const vector<int> tmpoff = geom_->offset(iatom);
     offset.insert(offset.end(), tmpoff.begin(), tmpoff.end());
   }
   const int size = basis.size();
 
-  // first make max_density_change std::vector for each batch pair.
-  const std::complex<double>* density_data = density_->data();
+  // first make max_density_change vector for each batch pair.
+  const complex<double>* density_data = density_->data();
+  const int n = ndim();
 
-  std::vector<double> max_density_change(size * size);
+  vector<double> max_density_change(size * size);
   for (int i = 0; i != size; ++i) {
-    const int ioffset = offset[i];
-    const int isize = basis[i]->nbasis();
     for (int j = i; j != size; ++j) {
-      const int joffset = offset[j];
-      const int jsize = basis[j]->nbasis();
-
       double cmax = 0.0;
-      for (int ii = ioffset; ii != ioffset + isize; ++ii) {
-        const int iin = ii * ndim();
-        for (int jj = joffset; jj != joffset + jsize; ++jj) {
-          cmax = std::max(cmax, std::abs(density_data[iin + jj]));
-        }
-      }
-      const int ij = i * size + j;
-      const int ji = j * size + i;
-      max_density_change[ij] = cmax;
-      max_density_change[ji] = cmax;
+      for (int ii = offset[i]; ii != offset[i] + basis[i]->nbasis(); ++ii)
+        for (int jj = offset[j]; jj != offset[j] + basis[j]->nbasis(); ++jj)
+          cmax = max(cmax, abs(density_data[ii * n + jj]));
+      max_density_change[i * size + j] = cmax;
+      max_density_change[j * size + i] = cmax;
     }
   }
 
   ////////////////////////////////////////////
   // starting 2-e Fock matrix evaluation!
   ////////////////////////////////////////////
-  //////////////// ONLY FOR REFERENCES. //////////////////
-  for (int i0 = 0; i0 != size; ++i0) {
-
-    const std::shared_ptr<const Shell>  b0 = basis[i0];
-    const int b0offset = offset[i0];
-    const int b0size = b0->nbasis();
-    for (int i1 = 0; i1 != size; ++i1) {
-      const unsigned int i01 = i0 *size + i1;
-
-      const std::shared_ptr<const Shell>  b1 = basis[i1];
-      const int b1offset = offset[i1];
-      const int b1size = b1->nbasis();
-
-      const double density_change_01 = max_density_change[i01] * 4.0;
-
-      for (int i2 = 0; i2 != size; ++i2) {
-        const std::shared_ptr<const Shell>  b2 = basis[i2];
-        const int b2offset = offset[i2];
-        const int b2size = b2->nbasis();
-
-        const double density_change_02 = max_density_change[i0 * size + i2];
-        const double density_change_12 = max_density_change[i1 * size + i2];
-
-        for (int i3 = 0; i3 != size; ++i3) {
-          const unsigned int i23 = i2 * size + i3;
-
-          const double density_change_23 = max_density_change[i2 * size + i3] * 4.0;
-          const double density_change_03 = max_density_change[i0 * size + i2];
-          const double density_change_13 = max_density_change[i0 * size + i2];
-
-          const std::shared_ptr<const Shell>  b3 = basis[i3];
-          const int b3offset = offset[i3];
-          const int b3size = b3->nbasis();
-
-          if ((b0offset + b0size + b1offset + b1size) < (b2offset + b3offset)) continue;
-          if ((b0offset + b0size + b2offset + b2size) < (b1offset + b3offset)) continue;
-
-          const double mulfactor = std::max(std::max(std::max(density_change_01, density_change_02),
-                                           std::max(density_change_12, density_change_23)),
-                                           std::max(density_change_03, density_change_13));
-          const double integral_bound = mulfactor * schwarz_[i01] * schwarz_[i23];
-          const bool skip_schwarz = integral_bound < schwarz_thresh_;
-          if (skip_schwarz) continue;
-
-          std::array<std::shared_ptr<const Shell>,4> input = {{b3, b2, b1, b0}};
-          ComplexERIBatch eribatch(input, mulfactor);
-          eribatch.compute();
-          const std::complex<double>* eridata = eribatch.data();
-          for (int j0 = b0offset; j0 != b0offset + b0size; ++j0) {
-            const int j0n = j0 * ndim();
-
-            for (int j1 = b1offset; j1 != b1offset + b1size; ++j1) {
-              const int j1n = j1 * ndim();
-
-              for (int j2 = b2offset; j2 != b2offset + b2size; ++j2) {
-                const int j2n = j2 * ndim();
-
-                for (int j3 = b3offset; j3 != b3offset + b3size; ++j3, ++eridata) {
-                  const int j3n = j3 * ndim();
-                  std::complex<double> intval = *eridata * 0.5; // 1/2 in the Hamiltonian absorbed here
-
-                  if (j0 + j1 <  j2 + j3) continue;
-                  if (j0 + j2 <  j1 + j3) continue;
-                  if (j0 + j1 == j2 + j3) intval *= 0.5;
-                  if (j0 + j2 == j1 + j3) intval *= 0.5;
-                  const std::complex<double> intval2 = intval * 2.0;
-
-                  element(j1, j0) += density_data[j3n + j2] * intval2; // Coulomb  (ab|cd)
-                  element(j3, j0) -= density_data[j1n + j2] * intval;  // Exchange (ad|cb)
-
-                  element(j3, j2) += density_data[j1n + j0] * intval2; // Coulomb  (cd|ab)
-                  element(j1, j2) -= density_data[j3n + j0] * intval;  // Exchange (cb|ad)
-
-                  element(j0, j1) += density_data[j2n + j3] * std::conj(intval2); // Coulomb  (ba|dc)
-                  element(j0, j3) -= density_data[j2n + j1] * std::conj(intval);  // Exchange (da|bc)
-
-                  element(j2, j3) += density_data[j0n + j1] * std::conj(intval2); // Coulomb  (dc|ba)
-                  element(j2, j1) -= density_data[j0n + j3] * std::conj(intval);  // Exchange (bc|dz)
+  // Complex London integrals retain 4-fold permutational symmetry, (01|23) = (23|01) = (10|32)* = (32|10)*.
+  // Only the first of the four shell quartets in the order of the pair indices (p01, p23) is computed,
+  // and its integrals are scattered into the Fock matrix for all four, divided by the number of the quartets that coincide.
+  // Shell pairs (01) are distributed over the nodes and threads, each thread accumulating into its own matrix.
+  const int ntask = resources__->max_num_threads();
+  const int nproc = mpi__->size();
+  const int rank = mpi__->rank();
+
+  vector<shared_ptr<ZMatrix>> accum(ntask);
+  TaskQueue<function<void(void)>> tasks(ntask);
+  for (int itask = 0; itask != ntask; ++itask) {
+    accum[itask] = make_shared<ZMatrix>(n, n);
+    tasks.emplace_back(
+      [&, itask]() {
+        ZMatrix& out = *accum[itask];
+        int cnt = 0;
+        for (int i0 = 0; i0 != size; ++i0) {
+          const shared_ptr<const Shell> b0 = basis[i0];
+          const int b0offset = offset[i0];
+          const int b0size = b0->nbasis();
+
+          for (int i1 = i0; i1 != size; ++i1) {
+            if (cnt++ % (nproc * ntask) != rank * ntask + itask) continue;
+            const int p01 = i0 * size + i1;
+            const int p10 = i1 * size + i0;
+
+            const shared_ptr<const Shell> b1 = basis[i1];
+            const int b1offset = offset[i1];
+            const int b1size = b1->nbasis();
+
+            const double density_change_01 = max_density_change[p01] * 4.0;
+
+            for (int i2 = i0; i2 != size; ++i2) {
+              const shared_ptr<const Shell> b2 = basis[i2];
+              const int b2offset = offset[i2];
+              const int b2size = b2->nbasis();
+
+              const double density_change_02 = max_density_change[i0 * size + i2];
+              const double density_change_12 = max_density_change[i1 * size + i2];
+
+              for (int i3 = 0; i3 != size; ++i3) {
+                const int p23 = i2 * size + i3;
+                const int p32 = i3 * size + i2;
+                if (p23 < p01) continue;
+                if (p01 == p10 && p23 > p32) continue;
+                if (p01 > p32 || (p01 == p32 && p23 > p10)) continue;
+
+                const double density_change_23 = max_density_change[p23] * 4.0;
+                const double density_change_03 = max_density_change[i0 * size + i3];
+                const double density_change_13 = max_density_change[i1 * size + i3];
+
+                const double mulfactor = max(max(max(density_change_01, density_change_02),
+                                                 max(density_change_12, density_change_23)),
+                                                 max(density_change_03, density_change_13));
+                const double integral_bound = mulfactor * schwarz_[p01] * schwarz_[p23];
+                const bool skip_schwarz = integral_bound < schwarz_thresh_;
+                if (skip_schwarz) continue;
+
+                const int nequiv = 1 + (p01 == p23) + (p01 == p10 && p23 == p32) + (p01 == p32 && p23 == p10);
+
+                const shared_ptr<const Shell> b3 = basis[i3];
+                const int b3offset = offset[i3];
+                const int b3size = b3->nbasis();
+
+                array<shared_ptr<const Shell>,4> input = {{b3, b2, b1, b0}};
+                ComplexERIBatch eribatch(input, mulfactor);
+                eribatch.compute();
+                const complex<double>* eridata = eribatch.data();
+                for (int j0 = b0offset; j0 != b0offset + b0size; ++j0) {
+                  const int j0n = j0 * n;
+                  for (int j1 = b1offset; j1 != b1offset + b1size; ++j1) {
+                    const int j1n = j1 * n;
+                    for (int j2 = b2offset; j2 != b2offset + b2size; ++j2) {
+                      const int j2n = j2 * n;
+                      for (int j3 = b3offset; j3 != b3offset + b3size; ++j3, ++eridata) {
+                        const int j3n = j3 * n;
+                        const complex<double> intval = *eridata / static_cast<double>(nequiv);
+                        const complex<double> intvalc = conj(intval);
+
+                        out.element(j1, j0) += density_data[j3n + j2] * intval;        // Coulomb  (ab|cd)
+                        out.element(j3, j0) -= density_data[j1n + j2] * intval * 0.5;  // Exchange (ad|cb)
+
+                        out.element(j3, j2) += density_data[j1n + j0] * intval;        // Coulomb  (cd|ab)
+                        out.element(j1, j2) -= density_data[j3n + j0] * intval * 0.5;  // Exchange (cb|ad)
+
+                        out.element(j0, j1) += density_data[j2n + j3] * intvalc;       // Coulomb  (ba|dc)
+                        out.element(j2, j1) -= density_data[j0n + j3] * intvalc * 0.5; // Exchange (bc|da)
+
+                        out.element(j2, j3) += density_data[j0n + j1] * intvalc;       // Coulomb  (dc|ba)
+                        out.element(j0, j3) -= density_data[j2n + j1] * intvalc * 0.5; // Exchange (da|bc)
+                      }
+                    }
+                  }
                 }
               }
             }
           }
-
         }
       }
-    }
+    );
   }
+  tasks.compute();
+
+  for (int itask = 1; itask != ntask; ++itask)
+    *accum[0] += *accum[itask];
+  if (nproc > 1)
+    accum[0]->allreduce();
+  *this += *accum[0];
 }
 
 
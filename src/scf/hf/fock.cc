@@ -24,6 +24,9 @@
 //
 
 #include <src/scf/hf/fock.h>
+#include <src/scf/ks/cosx.h>
+#include <src/scf/hf/localexchange.h>
+#include <src/df/floatdf.h>
 
 using namespace std;
 using namespace bagel;
@@ -234,14 +237,30 @@ void Fock<DF>::fock_two_electron_part(shared_ptr<const Matrix> den_ex) {
 
 
 template<int DF>
-void Fock<DF>::fock_two_electron_part_with_coeff(const MatView ocoeff, const bool rhf, const double scale_exchange) {
+void Fock<DF>::fock_two_electron_part_with_coeff(const MatView ocoeff, const bool rhf, const double scale_exchange, shared_ptr<const COSX> cosx,
+                                                  shared_ptr<const LocalExchange> lx, shared_ptr<const FloatDF> fdf) {
   if (DF == 0) throw logic_error("Fock<DF>::fock_two_electron_part_with_coeff() is only for DF cases");
 
   Timer pdebug(3);
 
   shared_ptr<const DFDist> df = geom_->df();
 
-  if (scale_exchange != 0.0) {
+  if (scale_exchange != 0.0 && (cosx || lx || fdf) && !store_half_) {
+    Matrix oc(ocoeff);
+    auto pocc = make_shared<const Matrix>(oc ^ oc);
+    if (cosx) {
+      *this += *cosx->compute(pocc, -1.0*scale_exchange);
+      pdebug.tick_print("Exchange build (seminumerical)");
+    } else if (lx) {
+      *this += *lx->compute(ocoeff, -1.0*scale_exchange);
+      pdebug.tick_print("Exchange build (local)");
+    } else {
+      *this += *fdf->compute_exchange(ocoeff, -1.0*scale_exchange);
+      pdebug.tick_print("Exchange build (mixed precision)");
+    }
+
+    *this += *df->compute_Jop(rhf ? make_shared<const Matrix>(*pocc * 2.0) : density_);
+  } else if (scale_exchange != 0.0) {
     shared_ptr<DFHalfDist> halfbj = df->compute_half_transform(ocoeff);
     pdebug.tick_print("First index transform");
 
@@ -269,6 +288,61 @@ void Fock<DF>::fock_two_electron_part_with_coeff(const MatView ocoeff, const boo
 }
 
 
+template<int DF>
+void Fock<DF>::fock_two_electron_part_incremental(shared_ptr<const Matrix> dden_ex, const double thresh, const double scale_exchange, shared_ptr<const COSX> cosx,
+                                                   shared_ptr<const FloatDF> fdf) {
+  if (DF == 0) throw logic_error("Fock<DF>::fock_two_electron_part_incremental() is only for DF cases");
+
+  Timer pdebug(3);
+
+  shared_ptr<const DFDist> df = geom_->df();
+
+  *this += *df->compute_Jop(density_);
+  pdebug.tick_print("Coulomb build");
+
+  nexchange_ = 0;
+  if (scale_exchange == 0.0) return;
+
+  // seminumerical exchange is linear in the density and needs no decomposition
+  if (cosx) {
+    *this += *cosx->compute(dden_ex, -0.5*scale_exchange);
+    pdebug.tick_print("Exchange build (seminumerical)");
+    return;
+  }
+
+  // the density change is indefinite; positive and negative parts are contracted separately
+  Matrix vec(*dden_ex);
+  VectorB eig(ndim());
+  vec.diagonalize(eig);
+  vector<int> pos, neg;
+  for (int i = 0; i != ndim(); ++i) {
+    if (eig(i) > thresh)
+      pos.push_back(i);
+    else if (eig(i) < -thresh)
+      neg.push_back(i);
+  }
+  nexchange_ = pos.size() + neg.size();
+  pdebug.tick_print("Density change decomposition");
+
+  for (auto& part : {make_pair(&pos, -0.5), make_pair(&neg, 0.5)}) {
+    if (part.first->empty()) continue;
+    Matrix coeff(ndim(), part.first->size());
+    int n = 0;
+    for (auto& i : *part.first) {
+      const double fac = std::sqrt(std::fabs(eig(i)));
+      blas::ax_plus_y_n(fac, vec.element_ptr(0,i), ndim(), coeff.element_ptr(0,n++));
+    }
+    if (fdf) {
+      *this += *fdf->compute_exchange(coeff, part.second*scale_exchange);
+    } else {
+      shared_ptr<DFHalfDist> half = df->compute_half_transform(coeff)->apply_J();
+      *this += *half->form_2index(half, part.second*scale_exchange);
+    }
+  }
+  pdebug.tick_print("Exchange build");
+}
+
+
 template class bagel::Fock<0>;
 template class bagel::Fock<1>;
 
@@ -34,11 +34,21 @@
 
 namespace bagel {
 
+class COSX;
+class LocalExchange;
+class FloatDF;
+
 template<int DF>
 class Fock : public Fock_base {
   protected:
     void fock_two_electron_part(std::shared_ptr<const Matrix> den = nullptr);
-    void fock_two_electron_part_with_coeff(const MatView coeff, const bool rhf, const double scale_ex);
+    void fock_two_electron_part_with_coeff(const MatView coeff, const bool rhf, const double scale_ex, std::shared_ptr<const COSX> cosx = nullptr,
+                                          std::shared_ptr<const LocalExchange> lx = nullptr, std::shared_ptr<const FloatDF> fdf = nullptr);
+    void fock_two_electron_part_incremental(std::shared_ptr<const Matrix> dden_ex, const double thresh, const double scale_ex, std::shared_ptr<const COSX> cosx = nullptr,
+                                            std::shared_ptr<const FloatDF> fdf = nullptr);
+
+    // number of vectors used in the exchange build of incremental Fock operators
+    int nexchange_ = 0;
 
     // when DF gradients are requested
     bool store_half_;
@@ -54,18 +64,22 @@ class Fock : public Fock_base {
 
   public:
     Fock() { }
-    // Fock operator for DF cases
+    // Fock operator for DF cases. When cosx is given, exchange is computed seminumerically; when lx is given, from localized orbitals;
+    // when fdf is given, in mixed precision (none of them when half-transformed integrals are stored)
     template<int DF1 = DF, class = typename std::enable_if<DF1==1>::type>
     Fock(const std::shared_ptr<const Geometry> a, const std::shared_ptr<const Matrix> prev, const std::shared_ptr<const Matrix> den,
-         const MatView ocoeff, const bool store = false, const bool rhf = false, const double scale_ex = 1.0)
+         const MatView ocoeff, const bool store = false, const bool rhf = false, const double scale_ex = 1.0, std::shared_ptr<const COSX> cosx = nullptr,
+         std::shared_ptr<const LocalExchange> lx = nullptr, std::shared_ptr<const FloatDF> fdf = nullptr)
      : Fock_base(a,prev,den), store_half_(store) {
-      fock_two_electron_part_with_coeff(ocoeff, rhf, scale_ex);
+      fock_two_electron_part_with_coeff(ocoeff, rhf, scale_ex, cosx, lx, fdf);
       fock_one_electron_part();
     }
     // the same as above.
     template<typename T, class = typename std::enable_if<btas::is_boxtensor<T>::value>::type>
     Fock(const std::shared_ptr<const Geometry> a, const std::shared_ptr<const Matrix> prev, const std::shared_ptr<const Matrix> den,
-         std::shared_ptr<T> ocoeff, const bool store = false, const bool rhf = false, const double scale_ex = 1.0) : Fock(a,prev,den,*ocoeff,store,rhf,scale_ex) { }
+         std::shared_ptr<T> ocoeff, const bool store = false, const bool rhf = false, const double scale_ex = 1.0, std::shared_ptr<const COSX> cosx = nullptr,
+         std::shared_ptr<const LocalExchange> lx = nullptr, std::shared_ptr<const FloatDF> fdf = nullptr)
+     : Fock(a,prev,den,*ocoeff,store,rhf,scale_ex,cosx,lx,fdf) { }
 
     // Fock operator
     template<int DF1 = DF, class = typename std::enable_if<DF1==1 or DF1==0>::type>
@@ -80,7 +94,19 @@ class Fock : public Fock_base {
       fock_one_electron_part();
     }
 
+    // incremental Fock operator. prev is the Fock operator of the previous iteration; dden and dden_ex are the changes in the density
+    // matrices for Coulomb and exchange. Eigenvectors of dden_ex with eigenvalues smaller than thresh in magnitude are neglected.
+    template<int DF1 = DF, class = typename std::enable_if<DF1==1>::type>
+    Fock(const std::shared_ptr<const Geometry> a, const std::shared_ptr<const Matrix> prev, const std::shared_ptr<const Matrix> dden,
+         const std::shared_ptr<const Matrix> dden_ex, const double thresh, const double scale_ex = 1.0, std::shared_ptr<const COSX> cosx = nullptr,
+         std::shared_ptr<const FloatDF> fdf = nullptr)
+     : Fock_base(a,prev,dden), store_half_(false) {
+      fock_two_electron_part_incremental(dden_ex, thresh, scale_ex, cosx, fdf);
+      fock_one_electron_part();
+    }
+
     std::shared_ptr<DFHalfDist> half() const { return half_; }
+    int nexchange() const { return nexchange_; }
 };
 
 // specialized for non-DF cases
@@ -0,0 +1,208 @@
+//
+// BAGEL - Parallel electron correlation program.
+// Filename: localexchange.cc
+// Copyright (C) 2026 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// The BAGEL package is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 3, or (at your option)
+// any later version.
+//
+// The BAGEL package is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the BAGEL package; see COPYING.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+
+
+#include <mutex>
+#include <src/scf/hf/localexchange.h>
+#include <src/mat1e/overlap.h>
+#include <src/wfn/localization.h>
+#include <src/util/f77.h>
+#include <src/util/taskqueue.h>
+#include <src/util/parallel/mpi_interface.h>
+#include <src/util/muffle.h>
+
+using namespace std;
+using namespace bagel;
+
+
+LocalExchange::LocalExchange(shared_ptr<const Geometry> geom, const double thresh) : geom_(geom), thresh_(thresh) {
+  int offset = 0;
+  for (auto& i : geom_->atoms()) {
+    atoms_.emplace_back(offset, i->nbasis());
+    offset += i->nbasis();
+  }
+
+  const int natom = atoms_.size();
+  auto overlap = make_shared<const Overlap>(geom_);
+  overlap_ = overlap;
+  atommax_.resize(natom*natom);
+  for (int b = 0; b != natom; ++b)
+    for (int a = 0; a != natom; ++a) {
+      double smax = 0.0;
+      for (int j = atoms_[b].first; j != atoms_[b].first + atoms_[b].second; ++j)
+        for (int i = atoms_[a].first; i != atoms_[a].first + atoms_[a].second; ++i)
+          smax = max(smax, fabs(overlap->element(i, j)));
+      atommax_[a+natom*b] = smax;
+    }
+  cout << "    * Local exchange with localized occupied orbitals (threshold " << setprecision(1) << scientific << thresh_ << fixed << ")" << endl;
+}
+
+
+void LocalExchange::domains(const double* coeff, vector<int>& orbital, vector<int>& half) const {
+  const int natom = atoms_.size();
+  vector<double> cmax(natom, 0.0);
+  for (int a = 0; a != natom; ++a) {
+    for (int l = atoms_[a].first; l != atoms_[a].first + atoms_[a].second; ++l)
+      cmax[a] = max(cmax[a], fabs(coeff[l]));
+    if (cmax[a] > thresh_)
+      orbital.push_back(a);
+  }
+  for (int b = 0; b != natom; ++b)
+    for (auto& a : orbital)
+      if (cmax[a] * atommax_[b+natom*a] > thresh_) {
+        half.push_back(b);
+        break;
+      }
+}
+
+
+shared_ptr<Matrix> LocalExchange::compute(const MatView ocoeff, const double fac) const {
+  const int nbasis = geom_->nbasis();
+  const int nocc = ocoeff.mdim();
+  auto out = make_shared<Matrix>(nbasis, nbasis);
+  if (nocc == 0) return out;
+
+  // exchange is invariant to rotations among the occupied orbitals
+  auto guess = make_shared<Matrix>(ocoeff);
+  const bool first = !localized_;
+  if (localized_ && localized_->mdim() == nocc) {
+    // U (U^T U)^-1/2 with U = C^T S L is the rotation that brings the current orbitals closest to the previous localized ones
+    Matrix rot(*guess % *overlap_ * *localized_);
+    Matrix norm(rot % rot);
+    if (norm.inverse_half())
+      guess = make_shared<Matrix>(*guess * rot * norm);
+  }
+  {
+    Muffle hide_cout;
+    PMLocalization localization(make_shared<const PTree>(), geom_, guess, vector<pair<int,int>>{{0, nocc}});
+    localized_ = localization.localize();
+  }
+  shared_ptr<const Matrix> coeff = localized_;
+
+  shared_ptr<const DFDist> df = geom_->df();
+  if (df->block().size() != 1) throw logic_error("LocalExchange assumes that the DF integrals are in a single block");
+  shared_ptr<const DFBlock> block = df->block(0);
+  shared_ptr<const Matrix> data2 = df->data2();
+  const size_t naux = df->naux();
+  const size_t asize = block->asize();
+  const size_t astart = block->astart();
+
+  // basis functions m (over which the half-transformed integrals are significant) for each orbital
+  vector<vector<int>> orbital(nocc), half(nocc), functions(nocc);
+  size_t norbital = 0, nhalf = 0;
+  for (int i = 0; i != nocc; ++i) {
+    domains(coeff->element_ptr(0, i), orbital[i], half[i]);
+    for (auto& b : half[i])
+      for (int m = atoms_[b].first; m != atoms_[b].first + atoms_[b].second; ++m)
+        functions[i].push_back(m);
+    norbital += orbital[i].size();
+    nhalf += half[i].size();
+  }
+  if (first)
+    cout << "      average domain size: " << setprecision(1) << fixed << static_cast<double>(norbital)/nocc << " (orbital) and "
+         << static_cast<double>(nhalf)/nocc << " (exchange) of " << atoms_.size() << " atoms" << endl;
+
+  // orbitals are processed in batches so that the fitted integrals take no more memory than the three-index integrals
+  const size_t maxcol = max(static_cast<size_t>(nbasis), block->size() / naux);
+  mutex outmutex;
+  for (int istart = 0; istart != nocc; ) {
+    vector<size_t> offsets(1, 0);
+    int iend = istart;
+    do {
+      offsets.push_back(offsets.back() + naux*functions[iend].size());
+      ++iend;
+    } while (iend != nocc && offsets.back() + naux*functions[iend].size() <= naux*maxcol);
+
+    // y_i(P,m) = sum_Q J^-1/2_PQ (Q|mi); each node contributes its fitting functions
+    vector<double> fitted(offsets.back(), 0.0);
+    TaskQueue<function<void(void)>> tasks(iend - istart);
+    for (int i = istart; i != iend; ++i) {
+      tasks.emplace_back(
+        [&, i]() {
+          const int nh = functions[i].size();
+          const double* ci = coeff->element_ptr(0, i);
+          Matrix h(asize, nh, true);
+          int col = 0;
+          for (auto& b : half[i]) {
+            const int bstart = atoms_[b].first;
+            const int bsize = atoms_[b].second;
+            for (auto& a : orbital[i])
+              for (int l = atoms_[a].first; l != atoms_[a].first + atoms_[a].second; ++l)
+                blas::ax_plus_y_n(ci[l], block->data()+asize*(bstart+nbasis*l), asize*bsize, h.element_ptr(0, col));
+            col += bsize;
+          }
+
+          // fitting functions for which (P|mi) is significant
+          vector<double> rowmax(asize, 0.0);
+          for (int m = 0; m != nh; ++m)
+            for (size_t p = 0; p != asize; ++p)
+              rowmax[p] = max(rowmax[p], fabs(h.element(p, m)));
+          vector<int> aux;
+          for (size_t p = 0; p != asize; ++p)
+            if (rowmax[p] > thresh_)
+              aux.push_back(p);
+          if (aux.empty()) return;
+
+          const int np = aux.size();
+          Matrix jp(naux, np, true);
+          Matrix hp(np, nh, true);
+          for (int k = 0; k != np; ++k) {
+            copy_n(data2->element_ptr(0, astart+aux[k]), naux, jp.element_ptr(0, k));
+            for (int m = 0; m != nh; ++m)
+              hp.element(k, m) = h.element(aux[k], m);
+          }
+          dgemm_("N", "N", naux, nh, np, 1.0, jp.data(), naux, hp.data(), np, 0.0, fitted.data()+offsets[i-istart], naux);
+        }
+      );
+    }
+    tasks.compute();
+    if (!df->serial())
+      mpi__->allreduce(fitted.data(), fitted.size());
+
+    // K(m,n) += fac * sum_P y_i(P,m) y_i(P,n)
+    TaskQueue<function<void(void)>> contract(iend - istart);
+    for (int i = istart; i != iend; ++i) {
+      if (i % mpi__->size() != mpi__->rank()) continue;
+      contract.emplace_back(
+        [&, i]() {
+          const int nh = functions[i].size();
+          const double* y = fitted.data() + offsets[i-istart];
+          Matrix k(nh, nh, true);
+          dgemm_("T", "N", nh, nh, naux, fac, y, naux, y, naux, 0.0, k.data(), nh);
+          lock_guard<mutex> lock(outmutex);
+          for (int n = 0; n != nh; ++n)
+            for (int m = 0; m != nh; ++m)
+              out->element(functions[i][m], functions[i][n]) += k.element(m, n);
+        }
+      );
+    }
+    contract.compute();
+    istart = iend;
+  }
+
+  if (mpi__->size() > 1)
+    out->allreduce();
+  return out;
+}
@@ -0,0 +1,65 @@
+//
+// BAGEL - Parallel electron correlation program.
+// Filename: localexchange.h
+// Copyright (C) 2026 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// The BAGEL package is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 3, or (at your option)
+// any later version.
+//
+// The BAGEL package is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the BAGEL package; see COPYING.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+
+
+#ifndef __SRC_SCF_HF_LOCALEXCHANGE_H
+#define __SRC_SCF_HF_LOCALEXCHANGE_H
+
+#include <src/wfn/geometry.h>
+
+namespace bagel {
+
+// Density-fitted exchange from Pipek-Mezey localized occupied orbitals. For each orbital i,
+//   K_mn = sum_i sum_PQ (P|mi) [J^-1]_PQ (Q|ni),  (P|mi) = sum_l (P|ml) C_li,
+// the sum over l is restricted to the atoms on which the orbital is localized, m and n to the atoms that overlap with them,
+// and P to the fitting functions for which (P|mi) is significant. The cost of each orbital is then independent of the system size.
+class LocalExchange {
+  protected:
+    const std::shared_ptr<const Geometry> geom_;
+    const double thresh_;
+
+    // first basis function and number of basis functions of each atom
+    std::vector<std::pair<int,int>> atoms_;
+    // largest overlap element between the basis functions of two atoms (natom x natom)
+    std::vector<double> atommax_;
+
+    std::shared_ptr<const Matrix> overlap_;
+    // localized orbitals of the previous call. The current occupied orbitals are rotated onto them to start the
+    // localization, which then converges in a few sweeps as the SCF converges.
+    mutable std::shared_ptr<const Matrix> localized_;
+
+    // atoms on which the orbital has significant coefficients, and the atoms that overlap with them
+    void domains(const double* coeff, std::vector<int>& orbital, std::vector<int>& half) const;
+
+  public:
+    LocalExchange(std::shared_ptr<const Geometry> geom, const double thresh = 1.0e-4);
+
+    // returns fac * K built from the occupied orbitals ocoeff (which are localized internally; see localized_)
+    std::shared_ptr<Matrix> compute(const MatView ocoeff, const double fac = 1.0) const;
+};
+
+}
+
+#endif
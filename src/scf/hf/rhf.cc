@@ -26,6 +26,10 @@
 #include <src/scf/atomicdensities.h>
 #include <src/scf/hf/rhf.h>
 #include <src/scf/hf/fock.h>
+#include <src/scf/hf/localexchange.h>
+#include <src/scf/incrementalfock.h>
+#include <src/util/math/mixedprecision.h>
+#include <src/df/floatdf.h>
 #include <src/prop/multipole.h>
 
 using namespace bagel;
@@ -46,6 +50,9 @@ RHF::RHF(const shared_ptr<const PTree> idata, const shared_ptr<const Geometry> g
     cout << "  level shift : " << setprecision(3) << lshift_ << endl << endl;
     levelshift_ = make_shared<ShiftVirtual<DistMatrix>>(nocc_, lshift_);
   }
+
+  local_exchange_ = dodf_ && idata->get<bool>("local_exchange", false);
+  local_exchange_thresh_ = idata->get<double>("local_exchange_thresh", 1.0e-4);
 }
 
 
@@ -108,6 +115,18 @@ void RHF::compute() {
   // starting SCF iteration
   shared_ptr<const Matrix> densitychange = aodensity_;
 
+  // for incremental DF Fock builds
+  // local exchange needs the occupied orbitals, so it is not combined with incremental builds
+  IncrementalFock incfock(dodf_ && incremental_fock_ && !local_exchange_, incremental_reset_);
+  if (dodf_)
+    init_cosx();
+  shared_ptr<const LocalExchange> lx = local_exchange_ && !cosx_ ? make_shared<const LocalExchange>(geom_, local_exchange_thresh_) : nullptr;
+  // mixed-precision exchange builds from single-precision DF integrals (neither with COSX nor with local exchange)
+  shared_ptr<const FloatDF> fdf = dodf_ && !cosx_ && !lx ? init_floatdf() : nullptr;
+  MixedPrecision mixed(fdf != nullptr, mixed_precision_thresh_);
+  shared_ptr<const Matrix> fockdensity;
+  int nexchange = 0;
+
   for (int iter = 0; iter != max_iter_; ++iter) {
     Timer pdebug(1);
 
@@ -123,7 +142,16 @@ void RHF::compute() {
       previous_fock = make_shared<Fock<0>>(geom_, previous_fock, densitychange, schwarz_);
       mpi__->broadcast(const_pointer_cast<Matrix>(previous_fock)->data(), previous_fock->size(), 0);
     } else {
-      previous_fock = make_shared<Fock<1>>(geom_, hcore_, nullptr, coeff_->slice(0, nocc_), do_grad_, true/*rhf*/);
+      shared_ptr<const Matrix> density = incfock.active() ? aodensity->matrix() : nullptr;
+      if (incfock.incremental()) {
+        auto dden = make_shared<const Matrix>(*density - *fockdensity);
+        auto fock = make_shared<const Fock<1>>(geom_, previous_fock, dden, dden, incfock.thresh(), 1.0, cosx_, fdf);
+        nexchange = fock->nexchange();
+        previous_fock = fock;
+      } else {
+        previous_fock = make_shared<Fock<1>>(geom_, hcore_, nullptr, coeff_->slice(0, nocc_), do_grad_, true/*rhf*/, 1.0, cosx_, lx, fdf);
+      }
+      fockdensity = density;
     }
     shared_ptr<const DistMatrix> fock = previous_fock->distmatrix();
 
@@ -136,6 +164,23 @@ void RHF::compute() {
 
     cout << indent << setw(5) << iter << setw(20) << fixed << setprecision(8) << energy_ << "   "
                                       << setw(17) << error << setw(15) << setprecision(2) << scftime.tick() << endl;
+    if (incfock.last_incremental())
+      cout << indent << "        incremental Fock build with " << nexchange << " exchange vectors (" << nocc_ << " occupied)" << endl;
+    incfock.update(error);
+
+    // the Fock operators built in single precision are not reused once the error is small
+    const bool to_double = mixed.update(error);
+    if (to_double) {
+      cout << indent << "        switching to double precision" << endl;
+      fdf.reset();
+      incfock.reset();
+    }
+
+    // converged results have to come from a full Fock build in double precision
+    if (error < thresh_scf_ && (incfock.last_incremental() || to_double) && iter != max_iter_-1) {
+      incfock.reset();
+      continue;
+    }
 
     if (error < thresh_scf_) {
       cout << indent << endl << indent << "  * SCF iteration converged." << endl << endl;
@@ -41,6 +41,10 @@ class RHF : public SCF_base {
     bool dodf_;
     bool restarted_;
 
+    // exchange from localized occupied orbitals with sparse domains (DF only)
+    bool local_exchange_ = false;
+    double local_exchange_thresh_ = 1.0e-4;
+
     std::shared_ptr<DIIS<DistMatrix>> diis_;
 
   private:
@@ -26,6 +26,9 @@
 #include <src/scf/atomicdensities.h>
 #include <src/scf/hf/uhf.h>
 #include <src/scf/hf/fock.h>
+#include <src/scf/incrementalfock.h>
+#include <src/util/math/mixedprecision.h>
+#include <src/df/floatdf.h>
 #include <src/prop/multipole.h>
 #include <src/util/math/diis.h>
 
@@ -74,11 +77,34 @@ void UHF::compute() {
 
   DIIS<Matrix> diis(diis_size_);
   DIIS<Matrix> diisB(diis_size_);
+
+  // for incremental DF Fock builds
+  IncrementalFock incfock(incremental_fock_, incremental_reset_);
+  init_cosx();
+  // mixed-precision exchange builds from single-precision DF integrals (not with COSX)
+  shared_ptr<const FloatDF> fdf = cosx_ ? nullptr : init_floatdf();
+  MixedPrecision mixed(fdf != nullptr, mixed_precision_thresh_);
+  shared_ptr<const Matrix> prevA, prevB, prevden, prevdenA, prevdenB;
+  int nexchange = 0;
+
   Timer scftime;
   for (int iter = 0; iter != max_iter_; ++iter) {
 
-    std::shared_ptr<const Matrix> fockA = make_shared<const Fock<1>>(geom_, hcore_, aodensity_, coeff_->slice(0, nocc_));
-    std::shared_ptr<const Matrix> fockB = make_shared<const Fock<1>>(geom_, hcore_, aodensity_, coeffB_->slice(0, noccB_));
+    std::shared_ptr<const Matrix> fockA, fockB;
+    if (incfock.incremental()) {
+      auto dden  = make_shared<const Matrix>(*aodensity_ - *prevden);
+      auto ddenA = make_shared<const Matrix>(*aodensityA_ - *prevdenA);
+      auto ddenB = make_shared<const Matrix>(*aodensityB_ - *prevdenB);
+      auto fA = make_shared<const Fock<1>>(geom_, prevA, dden, ddenA, incfock.thresh(), 1.0, cosx_, fdf);
+      auto fB = make_shared<const Fock<1>>(geom_, prevB, dden, ddenB, incfock.thresh(), 1.0, cosx_, fdf);
+      nexchange = fA->nexchange() + fB->nexchange();
+      fockA = fA;
+      fockB = fB;
+    } else {
+      fockA = make_shared<const Fock<1>>(geom_, hcore_, aodensity_, coeff_->slice(0, nocc_), false, false, 1.0, cosx_, nullptr, fdf);
+      fockB = make_shared<const Fock<1>>(geom_, hcore_, aodensity_, coeffB_->slice(0, noccB_), false, false, 1.0, cosx_, nullptr, fdf);
+    }
+    tie(prevA, prevB, prevden, prevdenA, prevdenB) = make_tuple(fockA, fockB, aodensity_, aodensityA_, aodensityB_);
 
     energy_ = 0.25*((*hcore_+*fockA) * *aodensityA_ + (*hcore_+*fockB) * *aodensityB_).trace() + geom_->nuclear_repulsion();
 
@@ -89,6 +115,23 @@ void UHF::compute() {
 
     cout << indent << setw(5) << iter << setw(20) << fixed << setprecision(8) << energy_ << "   "
                                       << setw(17) << error << setw(15) << setprecision(2) << scftime.tick() << endl;
+    if (incfock.last_incremental())
+      cout << indent << "        incremental Fock build with " << nexchange << " exchange vectors (" << nocc_+noccB_ << " occupied)" << endl;
+    incfock.update(error);
+
+    // the Fock operators built in single precision are not reused once the error is small
+    const bool to_double = mixed.update(error);
+    if (to_double) {
+      cout << indent << "        switching to double precision" << endl;
+      fdf.reset();
+      incfock.reset();
+    }
+
+    // converged results have to come from a full Fock build in double precision
+    if (error < thresh_scf_ && (incfock.last_incremental() || to_double) && iter != max_iter_-1) {
+      incfock.reset();
+      continue;
+    }
 
     if (error < thresh_scf_) {
       cout << indent << endl << indent << "  * SCF iteration converged." << endl << endl;
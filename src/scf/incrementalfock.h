@@ -0,0 +1,79 @@
+//
+// BAGEL - Parallel electron correlation program.
+// Filename: incrementalfock.h
+// Copyright (C) 2026 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// The BAGEL package is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 3, or (at your option)
+// any later version.
+//
+// The BAGEL package is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the BAGEL package; see COPYING.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+
+#ifndef __BAGEL_SCF_INCREMENTALFOCK_H
+#define __BAGEL_SCF_INCREMENTALFOCK_H
+
+#include <algorithm>
+
+namespace bagel {
+
+// Bookkeeping for incremental DF Fock builds, F_n = F_{n-1} + G(D_n - D_{n-1}).
+// The truncation threshold for the density change follows the DIIS error. A full build is done every max_incremental
+// iterations and whenever the threshold has become much tighter than at the last full build, so that truncation errors
+// do not accumulate. Converged results must come from a full build.
+class IncrementalFock {
+  protected:
+    const bool active_;
+    const int max_incremental_;
+
+    int count_;
+    bool force_full_;
+    bool last_incremental_;
+
+    double thresh_;
+    double thresh_full_;
+
+  public:
+    IncrementalFock(const bool active, const int max_incremental = 8)
+      : active_(active), max_incremental_(max_incremental), count_(0), force_full_(true), last_incremental_(false), thresh_(1.0e-4), thresh_full_(1.0e-4) { }
+
+    // decides whether the Fock operator of this iteration is built from the density change
+    bool incremental() {
+      last_incremental_ = active_ && !force_full_ && count_ < max_incremental_ && thresh_ > 0.1*thresh_full_;
+      if (last_incremental_) {
+        ++count_;
+      } else {
+        count_ = 0;
+        thresh_full_ = thresh_;
+      }
+      force_full_ = false;
+      return last_incremental_;
+    }
+
+    // tightens the threshold with the DIIS error of this iteration
+    void update(const double error) { thresh_ = std::max(std::min(thresh_, 1.0e-3*error), 1.0e-12); }
+
+    // forces a full build in the next iteration
+    void reset() { force_full_ = true; }
+
+    bool active() const { return active_; }
+    bool last_incremental() const { return last_incremental_; }
+    double thresh() const { return thresh_; }
+};
+
+}
+
+#endif
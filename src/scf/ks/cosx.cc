@@ -0,0 +1,176 @@
+//
+// BAGEL - Parallel electron correlation program.
+// Filename: cosx.cc
+// Copyright (C) 2026 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// The BAGEL package is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 3, or (at your option)
+// any later version.
+//
+// The BAGEL package is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the BAGEL package; see COPYING.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+
+#include <mutex>
+#include <src/scf/ks/cosx.h>
+#include <src/integral/rys/naibatch.h>
+#include <src/util/f77.h>
+#include <src/util/constants.h>
+#include <src/util/taskqueue.h>
+#include <src/util/parallel/mpi_interface.h>
+
+using namespace std;
+using namespace bagel;
+
+namespace {
+  // grid points are processed in chunks so that the final contraction is a GEMM
+  const size_t chunk__ = 64;
+
+  double absmax(const double* p, const int n) {
+    double out = 0.0;
+    for (const double* i = p; i != p+n; ++i)
+      out = max(out, fabs(*i));
+    return out;
+  }
+}
+
+
+COSX::COSX(shared_ptr<const Geometry> geom, shared_ptr<const DFTGrid_base> grid, const double thresh) : geom_(geom), grid_(grid->grid()), thresh_(thresh) {
+  int offset = 0;
+  for (auto& i : geom_->atoms())
+    for (auto& j : i->shells()) {
+      shells_.push_back(j);
+      offsets_.push_back(offset);
+      offset += j->nbasis();
+    }
+
+  // |A_nl(g)| is bounded by the integral of |n l| times the largest value of its potential, 2 sqrt(p/pi) at the center of the product.
+  // The overlap itself is not a bound: one-center pairs with different angular momenta have zero overlap but finite potential integrals.
+  for (int n = 0; n != shells_.size(); ++n)
+    for (int l = 0; l <= n; ++l) {
+      const array<double,3>& a = shells_[n]->position();
+      const array<double,3>& b = shells_[l]->position();
+      const double rr = pow(a[0]-b[0], 2) + pow(a[1]-b[1], 2) + pow(a[2]-b[2], 2);
+      double smax = 0.0;
+      for (int i = 0; i != shells_[n]->num_primitive(); ++i)
+        for (int j = 0; j != shells_[l]->num_primitive(); ++j) {
+          double cmax = 0.0;
+          for (auto& ci : shells_[n]->contractions())
+            for (auto& cj : shells_[l]->contractions())
+              cmax = max(cmax, fabs(ci[i] * cj[j]));
+          const double ea = shells_[n]->exponents(i);
+          const double eb = shells_[l]->exponents(j);
+          const double p = ea + eb;
+          smax = max(smax, cmax * pow(pi__/p, 1.5) * exp(-ea*eb/p*rr) * max(1.0, 2.0*sqrt(p/pi__)));
+        }
+      if (smax > thresh_) {
+        pairs_.emplace_back(n, l);
+        pairmax_.push_back(smax);
+      }
+    }
+  cout << "    * Seminumerical exchange with " << grid_->size() << " grid points and " << pairs_.size() << " shell pairs" << endl;
+}
+
+
+shared_ptr<Matrix> COSX::compute(shared_ptr<const Matrix> den, const double fac) const {
+  const int nbasis = geom_->nbasis();
+  const size_t npoint = grid_->size();
+  const size_t nchunk = (npoint-1) / chunk__ + 1;
+  shared_ptr<const Matrix> basis = grid_->basis();
+
+  auto out = make_shared<Matrix>(nbasis, nbasis);
+  mutex outmutex;
+
+  TaskQueue<function<void(void)>> tasks(nchunk);
+  for (size_t ichunk = 0; ichunk != nchunk; ++ichunk) {
+    if (ichunk % mpi__->size() != mpi__->rank()) continue;
+    tasks.emplace_back(
+      [this, ichunk, npoint, nbasis, fac, &basis, &den, &out, &outmutex]() {
+        const size_t start = ichunk * chunk__;
+        const int n = min(chunk__, npoint - start);
+        const double* phi = basis->element_ptr(0, start);
+
+        // F = P phi on this chunk
+        Matrix f(nbasis, n, true);
+        dgemm_("N", "N", nbasis, n, nbasis, 1.0, den->data(), nbasis, phi, nbasis, 0.0, f.data(), nbasis);
+
+        // grid points that survive the screening, with max |F| in each shell
+        vector<int> active;
+        vector<double> prefac;
+        vector<double> fmax;
+        const double pairmax = *max_element(pairmax_.begin(), pairmax_.end());
+        for (int ig = 0; ig != n; ++ig) {
+          const double pf = fabs(grid_->weight(start + ig)) * absmax(phi+nbasis*ig, nbasis);
+          vector<double> fg(shells_.size());
+          for (int s = 0; s != shells_.size(); ++s)
+            fg[s] = absmax(f.element_ptr(offsets_[s], ig), shells_[s]->nbasis());
+          if (pf * *max_element(fg.begin(), fg.end()) * pairmax < thresh_)
+            continue;
+          active.push_back(ig);
+          prefac.push_back(pf);
+          fmax.insert(fmax.end(), fg.begin(), fg.end());
+        }
+
+        Matrix g(nbasis, n, true);
+        if (!active.empty()) {
+          // unit negative charges at the active points give +1/|r-g|; one batch per shell pair covers all the points
+          vector<shared_ptr<const Atom>> charges;
+          for (auto& ig : active) {
+            const array<double,3> position{{grid_->data()->element(0, start+ig), grid_->data()->element(1, start+ig), grid_->data()->element(2, start+ig)}};
+            charges.push_back(make_shared<const Atom>(geom_->spherical(), "q", position, -1.0));
+          }
+          auto points = make_shared<const Molecule>(charges, vector<shared_ptr<const Atom>>{});
+          const int nactive = active.size();
+
+          for (size_t ip = 0; ip != pairs_.size(); ++ip) {
+            const int s0 = pairs_[ip].first;
+            const int s1 = pairs_[ip].second;
+            vector<bool> needed(nactive);
+            for (int j = 0; j != nactive; ++j)
+              needed[j] = prefac[j] * pairmax_[ip] * max(fmax[j*shells_.size()+s0], fmax[j*shells_.size()+s1]) >= thresh_;
+            if (find(needed.begin(), needed.end(), true) == needed.end()) continue;
+
+            PointNAIBatch nai({{shells_[s0], shells_[s1]}}, points);
+            nai.compute();
+            const int n0 = shells_[s0]->nbasis();
+            const int n1 = shells_[s1]->nbasis();
+            for (int j = 0; j != nactive; ++j) {
+              if (!needed[j]) continue;
+              const int ig = active[j];
+              const double* a = nai.point(j);
+              // G_n += sum_l A_nl F_l (and its transpose for off-diagonal pairs)
+              dgemv_("N", n0, n1, 1.0, a, n0, f.element_ptr(offsets_[s1], ig), 1, 1.0, g.element_ptr(offsets_[s0], ig), 1);
+              if (s0 != s1)
+                dgemv_("T", n0, n1, 1.0, a, n0, f.element_ptr(offsets_[s0], ig), 1, 1.0, g.element_ptr(offsets_[s1], ig), 1);
+            }
+          }
+          for (auto& ig : active)
+            blas::scale_n(grid_->weight(start + ig), g.element_ptr(0, ig), nbasis);
+        }
+
+        // K_mn += sum_g phi_m(g) G_n(g)
+        lock_guard<mutex> lock(outmutex);
+        dgemm_("N", "T", nbasis, nbasis, n, fac, phi, nbasis, g.data(), nbasis, 1.0, out->data(), nbasis);
+      }
+    );
+  }
+  tasks.compute();
+
+  if (mpi__->size() > 1)
+    out->allreduce();
+  // K is symmetric; the quadrature is not
+  out->symmetrize();
+  return out;
+}
@@ -0,0 +1,59 @@
+//
+// BAGEL - Parallel electron correlation program.
+// Filename: cosx.h
+// Copyright (C) 2026 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// The BAGEL package is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 3, or (at your option)
+// any later version.
+//
+// The BAGEL package is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the BAGEL package; see COPYING.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+
+#ifndef __SRC_KS_COSX_H
+#define __SRC_KS_COSX_H
+
+#include <src/scf/ks/dftgrid.h>
+
+namespace bagel {
+
+// Seminumerical (chain-of-spheres) exchange. The first electron is integrated on the molecular grid,
+// and the second analytically through potential integrals A_nl(g) = (n|1/|r-g||l) at each grid point:
+//   K_mn = sum_lk (ml|nk) P_lk ~ sum_g w_g phi_m(g) sum_l A_nl(g) F_lg,  F_lg = sum_k P_lk phi_k(g).
+// Shell pairs nl are screened by a Gaussian-product bound on A_nl(g) and by the size of F on the grid point.
+// The grid is processed in chunks; A(g) of all the surviving points in a chunk come from one PointNAIBatch per shell pair.
+class COSX {
+  protected:
+    const std::shared_ptr<const Geometry> geom_;
+    const std::shared_ptr<const Grid> grid_;
+    const double thresh_;
+
+    std::vector<std::shared_ptr<const Shell>> shells_;
+    std::vector<int> offsets_;
+    // shell pairs (n >= l) with non-negligible potential integrals, and the bound on |A_nl(g)| for each
+    std::vector<std::pair<int,int>> pairs_;
+    std::vector<double> pairmax_;
+
+  public:
+    COSX(std::shared_ptr<const Geometry> geom, std::shared_ptr<const DFTGrid_base> grid, const double thresh = 1.0e-10);
+
+    // returns fac * K[den]
+    std::shared_ptr<Matrix> compute(std::shared_ptr<const Matrix> den, const double fac = 1.0) const;
+};
+
+}
+
+#endif
@@ -25,6 +25,9 @@
 
 #include <src/scf/ks/ks.h>
 #include <src/scf/hf/fock.h>
+#include <src/scf/incrementalfock.h>
+#include <src/util/math/mixedprecision.h>
+#include <src/df/floatdf.h>
 #include <src/prop/multipole.h>
 #include <src/util/math/diis.h>
 
@@ -48,11 +51,28 @@ void KS::compute() {
 
   shared_ptr<Matrix> fock;
 
+  // for incremental DF Fock builds; only the Coulomb and exact exchange parts are incremental
+  IncrementalFock incfock(incremental_fock_, incremental_reset_);
+  // mixed-precision exchange builds from single-precision DF integrals (not with COSX)
+  shared_ptr<const FloatDF> fdf = cosx_ ? nullptr : init_floatdf();
+  MixedPrecision mixed(fdf != nullptr, mixed_precision_thresh_);
+  shared_ptr<const Matrix> prevfock, prevden;
+  int nexchange = 0;
+
   Timer scftime;
   for (int iter = 0; iter != max_iter_; ++iter) {
 
     // fock operator without DFT xc
-    fock = make_shared<Fock<1>>(geom_, hcore_, aodensity_, coeff_->slice(0, nocc_), false /*store*/, true /*rhf*/, func_->scale_ex());
+    if (incfock.incremental()) {
+      auto dden = make_shared<const Matrix>(*aodensity_ - *prevden);
+      auto f = make_shared<Fock<1>>(geom_, prevfock, dden, dden, incfock.thresh(), func_->scale_ex(), cosx_, fdf);
+      nexchange = f->nexchange();
+      fock = f;
+    } else {
+      fock = make_shared<Fock<1>>(geom_, hcore_, aodensity_, coeff_->slice(0, nocc_), false /*store*/, true /*rhf*/, func_->scale_ex(), cosx_, nullptr, fdf);
+    }
+    prevfock = fock->copy();
+    prevden = aodensity_;
 
     // add xc
     shared_ptr<const Matrix> xc;
@@ -69,6 +89,23 @@ void KS::compute() {
 
     cout << indent << setw(5) << iter << setw(20) << fixed << setprecision(8) << energy_ << "   "
                                       << setw(17) << error << setw(15) << setprecision(2) << scftime.tick() << endl;
+    if (incfock.last_incremental() && func_->scale_ex() != 0.0)
+      cout << indent << "        incremental Fock build with " << nexchange << " exchange vectors (" << nocc_ << " occupied)" << endl;
+    incfock.update(error);
+
+    // the Fock operators built in single precision are not reused once the error is small
+    const bool to_double = mixed.update(error);
+    if (to_double) {
+      cout << indent << "        switching to double precision" << endl;
+      fdf.reset();
+      incfock.reset();
+    }
+
+    // converged results have to come from a full Fock build in double precision
+    if (error < thresh_scf_ && (incfock.last_incremental() || to_double) && iter != max_iter_-1) {
+      incfock.reset();
+      continue;
+    }
 
     if (error < thresh_scf_) {
       cout << indent << endl << indent << "  * SCF iteration converged." << endl << endl;
@@ -54,6 +54,9 @@ class KS : public SCF_base {
       Timer preptime;
       grid_ = std::make_shared<DefaultGrid>(geom);
       preptime.tick_print("DFT grid generation");
+      // seminumerical exact exchange shares the XC grid
+      if (func_->scale_ex() != 0.0)
+        init_cosx(grid_);
 
       std::cout << std::endl;
 
@@ -25,6 +25,8 @@
 
 
 #include <src/scf/scf_base.h>
+#include <src/scf/ks/cosx.h>
+#include <src/df/floatdf.h>
 #include <src/wfn/relreference.h>
 #include <src/util/timer.h>
 #include <src/util/math/diis.h>
@@ -60,6 +62,12 @@ SCF_base_<MatType, OvlType, HcType, Enable>::SCF_base_(const shared_ptr<const PT
   thresh_scf_ = idata_->get<double>("thresh", 1.0e-8);
   thresh_scf_ = idata_->get<double>("thresh_scf", thresh_scf_);
   string dd = idata_->get<string>("diis", "gradient");
+  incremental_fock_ = idata_->get<bool>("incremental_fock", false);
+  incremental_reset_ = idata_->get<int>("incremental_reset", 8);
+  mixed_precision_ = idata_->get<bool>("mixed_precision", false);
+  mixed_precision_thresh_ = idata_->get<double>("mixed_precision_thresh", 1.0e-4);
+  use_cosx_ = idata_->get<bool>("cosx", false);
+  cosx_thresh_ = idata_->get<double>("cosx_thresh", 1.0e-10);
 
   multipole_print_ = idata_->get<int>("multipole", 1);
 
@@ -93,6 +101,31 @@ void SCF_base_<MatType, OvlType, HcType, Enable>::init_schwarz() {
 }
 
 
+template <typename MatType, typename OvlType, typename HcType, class Enable>
+void SCF_base_<MatType, OvlType, HcType, Enable>::init_cosx(shared_ptr<const DFTGrid_base> grid) {
+  if (!use_cosx_ || cosx_) return;
+  Timer time;
+  if (!grid)
+    grid = make_shared<DefaultGrid>(geom_);
+  cosx_ = make_shared<const COSX>(geom_, grid, cosx_thresh_);
+  time.tick_print("COSX setup");
+}
+
+
+template <typename MatType, typename OvlType, typename HcType, class Enable>
+shared_ptr<const FloatDF> SCF_base_<MatType, OvlType, HcType, Enable>::init_floatdf() const {
+  if (!mixed_precision_) return nullptr;
+  if (!FloatDF::supported(geom_->df())) {
+    cout << indent << "    * mixed precision is not used since the DF integrals are distributed" << endl;
+    return nullptr;
+  }
+  Timer time;
+  auto out = make_shared<const FloatDF>(geom_->df());
+  time.tick_print("Single-precision DF integrals");
+  return out;
+}
+
+
 // Specialized for GIAO
 template <>
 void SCF_base_<ZMatrix, ZOverlap, ZHcore, enable_if<true>::type>::get_coeff(const shared_ptr<const Reference> ref) {
@@ -34,6 +34,10 @@
 
 namespace bagel {
 
+class COSX;
+class DFTGrid_base;
+class FloatDF;
+
 template <typename MatType = Matrix, typename OvlType = Overlap, typename HcType = Hcore,
           class Enable = typename std::enable_if<((std::is_same<MatType, Matrix>::value && std::is_same<OvlType, Overlap>::value && std::is_same<HcType, Hcore>::value)
                       || (std::is_same<MatType, ZMatrix>::value && std::is_same<OvlType, ZOverlap>::value && std::is_same<HcType, ZHcore>::value))>::type>
@@ -71,6 +75,21 @@ class SCF_base_ : public Method {
 
     bool restart_;
 
+    // incremental DF Fock builds (see IncrementalFock); not serialized
+    bool incremental_fock_ = false;
+    int incremental_reset_ = 8;
+    // single-precision DF exchange while the DIIS error is above mixed_precision_thresh_ (see MixedPrecision); not serialized
+    bool mixed_precision_ = false;
+    double mixed_precision_thresh_ = 1.0e-4;
+    // single-precision copy of the DF integrals when mixed_precision_ is set; nullptr if they are distributed
+    std::shared_ptr<const FloatDF> init_floatdf() const;
+    // seminumerical exchange (see COSX) in place of DF exchange; not serialized
+    bool use_cosx_ = false;
+    double cosx_thresh_ = 1.0e-10;
+    std::shared_ptr<const COSX> cosx_;
+    // sets up cosx_ on the given grid, or on the default DFT grid if none is given
+    void init_cosx(std::shared_ptr<const DFTGrid_base> grid = nullptr);
+
     void get_coeff(const std::shared_ptr<const Reference> ref) { coeff_ = ref->coeff(); }
 
   private:
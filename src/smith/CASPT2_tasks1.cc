@@ -43,9 +43,9 @@ void Task0::Task_local::compute() {
   // tensor label: Gamma0
   std::unique_ptr<double[]> odata = out()->move_block(x0, x5, x1, x4);
   // associated with merged
-  std::unique_ptr<double[]> fdata = in(3)->get_block(x3, x2);
+  const double* fdata = in(3)->get_block_view(x3, x2);
   if (x1 == x5 && x0 == x4) {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2);
+    const double* i0data = in(0)->get_block_view(x3, x2);
     for (int i2 = 0; i2 != x2.size(); ++i2) {
       for (int i3 = 0; i3 != x3.size(); ++i3) {
         for (int i5 = 0; i5 != x5.size(); ++i5) {
@@ -58,7 +58,7 @@ void Task0::Task_local::compute() {
     }
   }
   if (x0 == x5 && x1 == x4) {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2);
+    const double* i0data = in(0)->get_block_view(x3, x2);
     for (int i2 = 0; i2 != x2.size(); ++i2) {
       for (int i3 = 0; i3 != x3.size(); ++i3) {
         for (int i5 = 0; i5 != x5.size(); ++i5) {
@@ -81,7 +81,7 @@ void Task0::Task_local::compute() {
     }
   }
   if (x0 == x2 && x1 == x4) {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x5);
+    const double* i0data = in(0)->get_block_view(x3, x5);
     for (int i5 = 0; i5 != x5.size(); ++i5) {
       for (int i3 = 0; i3 != x3.size(); ++i3) {
         for (int i2 = 0; i2 != x2.size(); ++i2) {
@@ -104,7 +104,7 @@ void Task0::Task_local::compute() {
     }
   }
   if (x0 == x2 && x1 == x5) {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x4);
+    const double* i0data = in(0)->get_block_view(x3, x4);
     for (int i4 = 0; i4 != x4.size(); ++i4) {
       for (int i3 = 0; i3 != x3.size(); ++i3) {
         for (int i2 = 0; i2 != x2.size(); ++i2) {
@@ -117,7 +117,7 @@ void Task0::Task_local::compute() {
     }
   }
   if (x3 == x4 && x0 == x2) {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x5);
+    const double* i0data = in(0)->get_block_view(x1, x5);
     for (int i5 = 0; i5 != x5.size(); ++i5) {
       for (int i1 = 0; i1 != x1.size(); ++i1) {
         for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -130,7 +130,7 @@ void Task0::Task_local::compute() {
     }
   }
   if (x3 == x5 && x0 == x2) {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x4);
+    const double* i0data = in(0)->get_block_view(x1, x4);
     for (int i4 = 0; i4 != x4.size(); ++i4) {
       for (int i1 = 0; i1 != x1.size(); ++i1) {
         for (int i5 = 0; i5 != x5.size(); ++i5) {
@@ -143,7 +143,7 @@ void Task0::Task_local::compute() {
     }
   }
   if (x0 == x2) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(x3, x5, x1, x4);
+    const double* i0data = in(1)->get_block_view(x3, x5, x1, x4);
     for (int i4 = 0; i4 != x4.size(); ++i4) {
       for (int i1 = 0; i1 != x1.size(); ++i1) {
         for (int i5 = 0; i5 != x5.size(); ++i5) {
@@ -168,7 +168,7 @@ void Task0::Task_local::compute() {
     }
   }
   if (x0 == x4 && x1 == x2) {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x5);
+    const double* i0data = in(0)->get_block_view(x3, x5);
     for (int i5 = 0; i5 != x5.size(); ++i5) {
       for (int i3 = 0; i3 != x3.size(); ++i3) {
         for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -181,7 +181,7 @@ void Task0::Task_local::compute() {
     }
   }
   if (x3 == x5 && x0 == x4) {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x2);
+    const double* i0data = in(0)->get_block_view(x1, x2);
     for (int i2 = 0; i2 != x2.size(); ++i2) {
       for (int i1 = 0; i1 != x1.size(); ++i1) {
         for (int i5 = 0; i5 != x5.size(); ++i5) {
@@ -194,7 +194,7 @@ void Task0::Task_local::compute() {
     }
   }
   if (x0 == x4) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(x1, x5, x3, x2);
+    const double* i0data = in(1)->get_block_view(x1, x5, x3, x2);
     for (int i2 = 0; i2 != x2.size(); ++i2) {
       for (int i3 = 0; i3 != x3.size(); ++i3) {
         for (int i5 = 0; i5 != x5.size(); ++i5) {
@@ -219,7 +219,7 @@ void Task0::Task_local::compute() {
     }
   }
   if (x1 == x2 && x0 == x5) {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x4);
+    const double* i0data = in(0)->get_block_view(x3, x4);
     for (int i4 = 0; i4 != x4.size(); ++i4) {
       for (int i3 = 0; i3 != x3.size(); ++i3) {
         for (int i2 = 0; i2 != x2.size(); ++i2) {
@@ -232,7 +232,7 @@ void Task0::Task_local::compute() {
     }
   }
   if (x3 == x4 && x0 == x5) {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x2);
+    const double* i0data = in(0)->get_block_view(x1, x2);
     for (int i2 = 0; i2 != x2.size(); ++i2) {
       for (int i1 = 0; i1 != x1.size(); ++i1) {
         for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -245,7 +245,7 @@ void Task0::Task_local::compute() {
     }
   }
   if (x0 == x5) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(x1, x4, x3, x2);
+    const double* i0data = in(1)->get_block_view(x1, x4, x3, x2);
     for (int i2 = 0; i2 != x2.size(); ++i2) {
       for (int i3 = 0; i3 != x3.size(); ++i3) {
         for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -260,7 +260,7 @@ void Task0::Task_local::compute() {
     }
   }
   if (x3 == x4 && x1 == x2) {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x5);
+    const double* i0data = in(0)->get_block_view(x0, x5);
     for (int i5 = 0; i5 != x5.size(); ++i5) {
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -273,7 +273,7 @@ void Task0::Task_local::compute() {
     }
   }
   if (x3 == x5 && x1 == x2) {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x4);
+    const double* i0data = in(0)->get_block_view(x0, x4);
     for (int i4 = 0; i4 != x4.size(); ++i4) {
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i5 = 0; i5 != x5.size(); ++i5) {
@@ -286,7 +286,7 @@ void Task0::Task_local::compute() {
     }
   }
   if (x1 == x2) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(x0, x5, x3, x4);
+    const double* i0data = in(1)->get_block_view(x0, x5, x3, x4);
     for (int i4 = 0; i4 != x4.size(); ++i4) {
       for (int i3 = 0; i3 != x3.size(); ++i3) {
         for (int i5 = 0; i5 != x5.size(); ++i5) {
@@ -301,7 +301,7 @@ void Task0::Task_local::compute() {
     }
   }
   if (x3 == x5 && x1 == x4) {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x2);
+    const double* i0data = in(0)->get_block_view(x0, x2);
     for (int i2 = 0; i2 != x2.size(); ++i2) {
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i5 = 0; i5 != x5.size(); ++i5) {
@@ -314,7 +314,7 @@ void Task0::Task_local::compute() {
     }
   }
   if (x1 == x4) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(x0, x5, x3, x2);
+    const double* i0data = in(1)->get_block_view(x0, x5, x3, x2);
     for (int i2 = 0; i2 != x2.size(); ++i2) {
       for (int i3 = 0; i3 != x3.size(); ++i3) {
         for (int i5 = 0; i5 != x5.size(); ++i5) {
@@ -329,7 +329,7 @@ void Task0::Task_local::compute() {
     }
   }
   if (x3 == x4 && x1 == x5) {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x2);
+    const double* i0data = in(0)->get_block_view(x0, x2);
     for (int i2 = 0; i2 != x2.size(); ++i2) {
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -342,7 +342,7 @@ void Task0::Task_local::compute() {
     }
   }
   if (x1 == x5) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(x0, x4, x3, x2);
+    const double* i0data = in(1)->get_block_view(x0, x4, x3, x2);
     for (int i2 = 0; i2 != x2.size(); ++i2) {
       for (int i3 = 0; i3 != x3.size(); ++i3) {
         for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -357,7 +357,7 @@ void Task0::Task_local::compute() {
     }
   }
   if (x3 == x4) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(x0, x5, x1, x2);
+    const double* i0data = in(1)->get_block_view(x0, x5, x1, x2);
     for (int i2 = 0; i2 != x2.size(); ++i2) {
       for (int i1 = 0; i1 != x1.size(); ++i1) {
         for (int i5 = 0; i5 != x5.size(); ++i5) {
@@ -372,7 +372,7 @@ void Task0::Task_local::compute() {
     }
   }
   if (x3 == x5) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(x1, x4, x0, x2);
+    const double* i0data = in(1)->get_block_view(x1, x4, x0, x2);
     for (int i2 = 0; i2 != x2.size(); ++i2) {
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -387,7 +387,7 @@ void Task0::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(x0, x5, x1, x4, x3, x2);
+    const double* i0data = in(2)->get_block_view(x0, x5, x1, x4, x3, x2);
     for (int i2 = 0; i2 != x2.size(); ++i2) {
       for (int i3 = 0; i3 != x3.size(); ++i3) {
         for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -425,7 +425,7 @@ void Task1::Task_local::compute() {
   }
   {
     if (x0 == x2) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x3);
+      const double* i0data = in(0)->get_block_view(x1, x3);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i1 = 0; i1 != x1.size(); ++i1) {
           for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -448,7 +448,7 @@ void Task1::Task_local::compute() {
   }
   {
     if (x0 == x3) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x2);
+      const double* i0data = in(0)->get_block_view(x1, x2);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i1 = 0; i1 != x1.size(); ++i1) {
           for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -461,7 +461,7 @@ void Task1::Task_local::compute() {
   }
   {
     if (x1 == x2) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x3);
+      const double* i0data = in(0)->get_block_view(x0, x3);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i0 = 0; i0 != x0.size(); ++i0) {
@@ -474,7 +474,7 @@ void Task1::Task_local::compute() {
   }
   {
     if (x1 == x3) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x2);
+      const double* i0data = in(0)->get_block_view(x0, x2);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i0 = 0; i0 != x0.size(); ++i0) {
@@ -486,8 +486,8 @@ void Task1::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(x0, x3, x1, x2);
-    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata, x0.size(), x3.size(), x1.size(), x2.size());
+    const double* i0data = in(1)->get_block_view(x0, x3, x1, x2);
+    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata.get(), x0.size(), x3.size(), x1.size(), x2.size());
   }
   out()->put_block(odata, x0, x3, x1, x2);
 }
@@ -503,7 +503,7 @@ void Task2::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x5, x4, x0, x3, x1, x2);
   {
     if (x1 == x3 && x0 == x2) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4);
+      const double* i0data = in(0)->get_block_view(x5, x4);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -518,7 +518,7 @@ void Task2::Task_local::compute() {
   }
   {
     if (x1 == x4 && x0 == x2) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x3);
+      const double* i0data = in(0)->get_block_view(x5, x3);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -533,7 +533,7 @@ void Task2::Task_local::compute() {
   }
   {
     if (x0 == x2) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x5, x4, x1, x3);
+      const double* i0data = in(1)->get_block_view(x5, x4, x1, x3);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i1 = 0; i1 != x1.size(); ++i1) {
           for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -550,7 +550,7 @@ void Task2::Task_local::compute() {
   }
   {
     if (x1 == x2 && x0 == x3) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4);
+      const double* i0data = in(0)->get_block_view(x5, x4);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -565,7 +565,7 @@ void Task2::Task_local::compute() {
   }
   {
     if (x1 == x4 && x0 == x3) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x2);
+      const double* i0data = in(0)->get_block_view(x5, x2);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -580,7 +580,7 @@ void Task2::Task_local::compute() {
   }
   {
     if (x0 == x3) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x5, x4, x1, x2);
+      const double* i0data = in(1)->get_block_view(x5, x4, x1, x2);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i1 = 0; i1 != x1.size(); ++i1) {
           for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -597,7 +597,7 @@ void Task2::Task_local::compute() {
   }
   {
     if (x1 == x2 && x0 == x4) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x3);
+      const double* i0data = in(0)->get_block_view(x5, x3);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -612,7 +612,7 @@ void Task2::Task_local::compute() {
   }
   {
     if (x1 == x3 && x0 == x4) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x2);
+      const double* i0data = in(0)->get_block_view(x5, x2);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -627,7 +627,7 @@ void Task2::Task_local::compute() {
   }
   {
     if (x0 == x4) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x5, x3, x1, x2);
+      const double* i0data = in(1)->get_block_view(x5, x3, x1, x2);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i1 = 0; i1 != x1.size(); ++i1) {
           for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -644,7 +644,7 @@ void Task2::Task_local::compute() {
   }
   {
     if (x1 == x2) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x5, x4, x0, x3);
+      const double* i0data = in(1)->get_block_view(x5, x4, x0, x3);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i0 = 0; i0 != x0.size(); ++i0) {
@@ -661,7 +661,7 @@ void Task2::Task_local::compute() {
   }
   {
     if (x1 == x3) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x5, x4, x0, x2);
+      const double* i0data = in(1)->get_block_view(x5, x4, x0, x2);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i0 = 0; i0 != x0.size(); ++i0) {
@@ -678,7 +678,7 @@ void Task2::Task_local::compute() {
   }
   {
     if (x1 == x4) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x5, x2, x0, x3);
+      const double* i0data = in(1)->get_block_view(x5, x2, x0, x3);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i0 = 0; i0 != x0.size(); ++i0) {
@@ -694,8 +694,8 @@ void Task2::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(x5, x4, x0, x3, x1, x2);
-    sort_indices<0,1,2,3,4,5,1,1,1,1>(i0data, odata, x5.size(), x4.size(), x0.size(), x3.size(), x1.size(), x2.size());
+    const double* i0data = in(2)->get_block_view(x5, x4, x0, x3, x1, x2);
+    sort_indices<0,1,2,3,4,5,1,1,1,1>(i0data, odata.get(), x5.size(), x4.size(), x0.size(), x3.size(), x1.size(), x2.size());
   }
   out()->put_block(odata, x5, x4, x0, x3, x1, x2);
 }
@@ -719,7 +719,7 @@ void Task3::Task_local::compute() {
   }
   {
     if (x0 == x2) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x3);
+      const double* i0data = in(0)->get_block_view(x1, x3);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i1 = 0; i1 != x1.size(); ++i1) {
@@ -742,7 +742,7 @@ void Task3::Task_local::compute() {
   }
   {
     if (x0 == x3) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x2);
+      const double* i0data = in(0)->get_block_view(x1, x2);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i1 = 0; i1 != x1.size(); ++i1) {
@@ -755,7 +755,7 @@ void Task3::Task_local::compute() {
   }
   {
     if (x1 == x2) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x3);
+      const double* i0data = in(0)->get_block_view(x0, x3);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i0 = 0; i0 != x0.size(); ++i0) {
           for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -768,7 +768,7 @@ void Task3::Task_local::compute() {
   }
   {
     if (x1 == x3) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x2);
+      const double* i0data = in(0)->get_block_view(x0, x2);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i0 = 0; i0 != x0.size(); ++i0) {
           for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -780,8 +780,8 @@ void Task3::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(x1, x3, x0, x2);
-    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata, x1.size(), x3.size(), x0.size(), x2.size());
+    const double* i0data = in(1)->get_block_view(x1, x3, x0, x2);
+    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata.get(), x1.size(), x3.size(), x0.size(), x2.size());
   }
   out()->put_block(odata, x1, x3, x0, x2);
 }
@@ -797,7 +797,7 @@ void Task4::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x2, x5, x3, x4, x1, x0);
   {
     if (x2 == x5 && x1 == x4) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0);
+      const double* i0data = in(0)->get_block_view(x3, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i4 = 0; i4 != x4.size(); ++i4) {
           for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -812,7 +812,7 @@ void Task4::Task_local::compute() {
   }
   {
     if (x2 == x4 && x1 == x5) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0);
+      const double* i0data = in(0)->get_block_view(x3, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i4 = 0; i4 != x4.size(); ++i4) {
           for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -827,7 +827,7 @@ void Task4::Task_local::compute() {
   }
   {
     if (x3 == x5 && x1 == x4) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x0);
+      const double* i0data = in(0)->get_block_view(x2, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i4 = 0; i4 != x4.size(); ++i4) {
           for (int i5 = 0; i5 != x5.size(); ++i5) {
@@ -842,7 +842,7 @@ void Task4::Task_local::compute() {
   }
   {
     if (x1 == x4) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x2, x5, x3, x0);
+      const double* i0data = in(1)->get_block_view(x2, x5, x3, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i4 = 0; i4 != x4.size(); ++i4) {
           for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -859,7 +859,7 @@ void Task4::Task_local::compute() {
   }
   {
     if (x3 == x4 && x1 == x5) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x0);
+      const double* i0data = in(0)->get_block_view(x2, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i4 = 0; i4 != x4.size(); ++i4) {
           for (int i5 = 0; i5 != x5.size(); ++i5) {
@@ -874,7 +874,7 @@ void Task4::Task_local::compute() {
   }
   {
     if (x1 == x5) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x3, x4, x2, x0);
+      const double* i0data = in(1)->get_block_view(x3, x4, x2, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i4 = 0; i4 != x4.size(); ++i4) {
           for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -891,7 +891,7 @@ void Task4::Task_local::compute() {
   }
   {
     if (x3 == x5 && x2 == x4) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
+      const double* i0data = in(0)->get_block_view(x1, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i1 = 0; i1 != x1.size(); ++i1) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -906,7 +906,7 @@ void Task4::Task_local::compute() {
   }
   {
     if (x2 == x4) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x3, x5, x1, x0);
+      const double* i0data = in(1)->get_block_view(x3, x5, x1, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i1 = 0; i1 != x1.size(); ++i1) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -923,7 +923,7 @@ void Task4::Task_local::compute() {
   }
   {
     if (x3 == x4 && x2 == x5) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
+      const double* i0data = in(0)->get_block_view(x1, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i1 = 0; i1 != x1.size(); ++i1) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -938,7 +938,7 @@ void Task4::Task_local::compute() {
   }
   {
     if (x2 == x5) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x3, x4, x1, x0);
+      const double* i0data = in(1)->get_block_view(x3, x4, x1, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i1 = 0; i1 != x1.size(); ++i1) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -955,7 +955,7 @@ void Task4::Task_local::compute() {
   }
   {
     if (x3 == x4) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x2, x5, x1, x0);
+      const double* i0data = in(1)->get_block_view(x2, x5, x1, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i1 = 0; i1 != x1.size(); ++i1) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -972,7 +972,7 @@ void Task4::Task_local::compute() {
   }
   {
     if (x3 == x5) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x2, x4, x1, x0);
+      const double* i0data = in(1)->get_block_view(x2, x4, x1, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i1 = 0; i1 != x1.size(); ++i1) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -988,8 +988,8 @@ void Task4::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(x2, x5, x3, x4, x1, x0);
-    sort_indices<0,1,2,3,4,5,1,1,1,1>(i0data, odata, x2.size(), x5.size(), x3.size(), x4.size(), x1.size(), x0.size());
+    const double* i0data = in(2)->get_block_view(x2, x5, x3, x4, x1, x0);
+    sort_indices<0,1,2,3,4,5,1,1,1,1>(i0data, odata.get(), x2.size(), x5.size(), x3.size(), x4.size(), x1.size(), x0.size());
   }
   out()->put_block(odata, x2, x5, x3, x4, x1, x0);
 }
@@ -1006,9 +1006,9 @@ void Task5::Task_local::compute() {
   // tensor label: Gamma5
   std::unique_ptr<double[]> odata = out()->move_block(x7, x6, x2, x5, x1, x0);
   // associated with merged
-  std::unique_ptr<double[]> fdata = in(4)->get_block(x4, x3);
+  const double* fdata = in(4)->get_block_view(x4, x3);
   if (x2 == x6 && x1 == x5) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(x7, x0, x4, x3);
+    const double* i0data = in(1)->get_block_view(x7, x0, x4, x3);
     for (int i3 = 0; i3 != x3.size(); ++i3) {
       for (int i4 = 0; i4 != x4.size(); ++i4) {
         for (int i0 = 0; i0 != x0.size(); ++i0) {
@@ -1025,7 +1025,7 @@ void Task5::Task_local::compute() {
     }
   }
   if (x2 == x5 && x1 == x6) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(x7, x0, x4, x3);
+    const double* i0data = in(1)->get_block_view(x7, x0, x4, x3);
     for (int i3 = 0; i3 != x3.size(); ++i3) {
       for (int i4 = 0; i4 != x4.size(); ++i4) {
         for (int i0 = 0; i0 != x0.size(); ++i0) {
@@ -1042,7 +1042,7 @@ void Task5::Task_local::compute() {
     }
   }
   if (x2 == x5 && x1 == x3 && x4 == x6) {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x0);
+    const double* i0data = in(0)->get_block_view(x7, x0);
     for (int i0 = 0; i0 != x0.size(); ++i0) {
       for (int i7 = 0; i7 != x7.size(); ++i7) {
         for (int i5 = 0; i5 != x5.size(); ++i5) {
@@ -1057,7 +1057,7 @@ void Task5::Task_local::compute() {
     }
   }
   if (x2 == x5 && x1 == x3) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(x7, x6, x4, x0);
+    const double* i0data = in(1)->get_block_view(x7, x6, x4, x0);
     for (int i0 = 0; i0 != x0.size(); ++i0) {
       for (int i4 = 0; i4 != x4.size(); ++i4) {
         for (int i6 = 0; i6 != x6.size(); ++i6) {
@@ -1074,7 +1074,7 @@ void Task5::Task_local::compute() {
     }
   }
   if (x4 == x5 && x2 == x6 && x1 == x3) {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x0);
+    const double* i0data = in(0)->get_block_view(x7, x0);
     for (int i0 = 0; i0 != x0.size(); ++i0) {
       for (int i7 = 0; i7 != x7.size(); ++i7) {
         for (int i5 = 0; i5 != x5.size(); ++i5) {
@@ -1089,7 +1089,7 @@ void Task5::Task_local::compute() {
     }
   }
   if (x2 == x6 && x1 == x3) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(x7, x5, x4, x0);
+    const double* i0data = in(1)->get_block_view(x7, x5, x4, x0);
     for (int i0 = 0; i0 != x0.size(); ++i0) {
       for (int i4 = 0; i4 != x4.size(); ++i4) {
         for (int i5 = 0; i5 != x5.size(); ++i5) {
@@ -1106,7 +1106,7 @@ void Task5::Task_local::compute() {
     }
   }
   if (x4 == x5 && x1 == x3) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(x7, x6, x2, x0);
+    const double* i0data = in(1)->get_block_view(x7, x6, x2, x0);
     for (int i0 = 0; i0 != x0.size(); ++i0) {
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i6 = 0; i6 != x6.size(); ++i6) {
@@ -1123,7 +1123,7 @@ void Task5::Task_local::compute() {
     }
   }
   if (x4 == x6 && x1 == x3) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(x7, x0, x2, x5);
+    const double* i0data = in(1)->get_block_view(x7, x0, x2, x5);
     for (int i5 = 0; i5 != x5.size(); ++i5) {
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i0 = 0; i0 != x0.size(); ++i0) {
@@ -1140,7 +1140,7 @@ void Task5::Task_local::compute() {
     }
   }
   if (x1 == x3) {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(x7, x6, x2, x5, x4, x0);
+    const double* i0data = in(2)->get_block_view(x7, x6, x2, x5, x4, x0);
     for (int i0 = 0; i0 != x0.size(); ++i0) {
       for (int i4 = 0; i4 != x4.size(); ++i4) {
         for (int i5 = 0; i5 != x5.size(); ++i5) {
@@ -1159,7 +1159,7 @@ void Task5::Task_local::compute() {
     }
   }
   if (x4 == x6 && x2 == x3 && x1 == x5) {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x0);
+    const double* i0data = in(0)->get_block_view(x7, x0);
     for (int i0 = 0; i0 != x0.size(); ++i0) {
       for (int i7 = 0; i7 != x7.size(); ++i7) {
         for (int i6 = 0; i6 != x6.size(); ++i6) {
@@ -1174,7 +1174,7 @@ void Task5::Task_local::compute() {
     }
   }
   if (x2 == x3 && x1 == x5) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(x7, x6, x4, x0);
+    const double* i0data = in(1)->get_block_view(x7, x6, x4, x0);
     for (int i0 = 0; i0 != x0.size(); ++i0) {
       for (int i4 = 0; i4 != x4.size(); ++i4) {
         for (int i6 = 0; i6 != x6.size(); ++i6) {
@@ -1191,7 +1191,7 @@ void Task5::Task_local::compute() {
     }
   }
   if (x4 == x6 && x1 == x5) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(x7, x3, x2, x0);
+    const double* i0data = in(1)->get_block_view(x7, x3, x2, x0);
     for (int i0 = 0; i0 != x0.size(); ++i0) {
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -1208,7 +1208,7 @@ void Task5::Task_local::compute() {
     }
   }
   if (x1 == x5) {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(x7, x6, x4, x3, x2, x0);
+    const double* i0data = in(2)->get_block_view(x7, x6, x4, x3, x2, x0);
     for (int i0 = 0; i0 != x0.size(); ++i0) {
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -1227,7 +1227,7 @@ void Task5::Task_local::compute() {
     }
   }
   if (x4 == x5 && x2 == x3 && x1 == x6) {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x0);
+    const double* i0data = in(0)->get_block_view(x7, x0);
     for (int i0 = 0; i0 != x0.size(); ++i0) {
       for (int i7 = 0; i7 != x7.size(); ++i7) {
         for (int i5 = 0; i5 != x5.size(); ++i5) {
@@ -1242,7 +1242,7 @@ void Task5::Task_local::compute() {
     }
   }
   if (x2 == x3 && x1 == x6) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(x7, x0, x4, x5);
+    const double* i0data = in(1)->get_block_view(x7, x0, x4, x5);
     for (int i5 = 0; i5 != x5.size(); ++i5) {
       for (int i4 = 0; i4 != x4.size(); ++i4) {
         for (int i0 = 0; i0 != x0.size(); ++i0) {
@@ -1259,7 +1259,7 @@ void Task5::Task_local::compute() {
     }
   }
   if (x4 == x5 && x1 == x6) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(x7, x0, x2, x3);
+    const double* i0data = in(1)->get_block_view(x7, x0, x2, x3);
     for (int i3 = 0; i3 != x3.size(); ++i3) {
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i0 = 0; i0 != x0.size(); ++i0) {
@@ -1276,7 +1276,7 @@ void Task5::Task_local::compute() {
     }
   }
   if (x1 == x6) {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(x7, x0, x2, x5, x4, x3);
+    const double* i0data = in(2)->get_block_view(x7, x0, x2, x5, x4, x3);
     for (int i3 = 0; i3 != x3.size(); ++i3) {
       for (int i4 = 0; i4 != x4.size(); ++i4) {
         for (int i5 = 0; i5 != x5.size(); ++i5) {
@@ -1295,7 +1295,7 @@ void Task5::Task_local::compute() {
     }
   }
   if (x4 == x5 && x2 == x3) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(x7, x6, x1, x0);
+    const double* i0data = in(1)->get_block_view(x7, x6, x1, x0);
     for (int i0 = 0; i0 != x0.size(); ++i0) {
       for (int i1 = 0; i1 != x1.size(); ++i1) {
         for (int i6 = 0; i6 != x6.size(); ++i6) {
@@ -1312,7 +1312,7 @@ void Task5::Task_local::compute() {
     }
   }
   if (x4 == x6 && x2 == x3) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(x7, x5, x1, x0);
+    const double* i0data = in(1)->get_block_view(x7, x5, x1, x0);
     for (int i0 = 0; i0 != x0.size(); ++i0) {
       for (int i1 = 0; i1 != x1.size(); ++i1) {
         for (int i5 = 0; i5 != x5.size(); ++i5) {
@@ -1329,7 +1329,7 @@ void Task5::Task_local::compute() {
     }
   }
   if (x2 == x3) {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(x7, x6, x4, x5, x1, x0);
+    const double* i0data = in(2)->get_block_view(x7, x6, x4, x5, x1, x0);
     for (int i0 = 0; i0 != x0.size(); ++i0) {
       for (int i1 = 0; i1 != x1.size(); ++i1) {
         for (int i5 = 0; i5 != x5.size(); ++i5) {
@@ -1348,7 +1348,7 @@ void Task5::Task_local::compute() {
     }
   }
   if (x4 == x6 && x2 == x5) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(x7, x3, x1, x0);
+    const double* i0data = in(1)->get_block_view(x7, x3, x1, x0);
     for (int i0 = 0; i0 != x0.size(); ++i0) {
       for (int i1 = 0; i1 != x1.size(); ++i1) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -1365,7 +1365,7 @@ void Task5::Task_local::compute() {
     }
   }
   if (x2 == x5) {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(x7, x6, x4, x3, x1, x0);
+    const double* i0data = in(2)->get_block_view(x7, x6, x4, x3, x1, x0);
     for (int i0 = 0; i0 != x0.size(); ++i0) {
       for (int i1 = 0; i1 != x1.size(); ++i1) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -1384,7 +1384,7 @@ void Task5::Task_local::compute() {
     }
   }
   if (x4 == x5 && x2 == x6) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(x7, x3, x1, x0);
+    const double* i0data = in(1)->get_block_view(x7, x3, x1, x0);
     for (int i0 = 0; i0 != x0.size(); ++i0) {
       for (int i1 = 0; i1 != x1.size(); ++i1) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -1401,7 +1401,7 @@ void Task5::Task_local::compute() {
     }
   }
   if (x2 == x6) {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(x7, x5, x4, x3, x1, x0);
+    const double* i0data = in(2)->get_block_view(x7, x5, x4, x3, x1, x0);
     for (int i0 = 0; i0 != x0.size(); ++i0) {
       for (int i1 = 0; i1 != x1.size(); ++i1) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -1420,7 +1420,7 @@ void Task5::Task_local::compute() {
     }
   }
   if (x4 == x5) {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(x7, x6, x2, x3, x1, x0);
+    const double* i0data = in(2)->get_block_view(x7, x6, x2, x3, x1, x0);
     for (int i0 = 0; i0 != x0.size(); ++i0) {
       for (int i1 = 0; i1 != x1.size(); ++i1) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -1439,7 +1439,7 @@ void Task5::Task_local::compute() {
     }
   }
   if (x4 == x6) {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(x7, x3, x2, x5, x1, x0);
+    const double* i0data = in(2)->get_block_view(x7, x3, x2, x5, x1, x0);
     for (int i0 = 0; i0 != x0.size(); ++i0) {
       for (int i1 = 0; i1 != x1.size(); ++i1) {
         for (int i5 = 0; i5 != x5.size(); ++i5) {
@@ -1458,7 +1458,7 @@ void Task5::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(3)->get_block(x7, x6, x2, x5, x4, x3, x1, x0);
+    const double* i0data = in(3)->get_block_view(x7, x6, x2, x5, x4, x3, x1, x0);
     for (int i0 = 0; i0 != x0.size(); ++i0) {
       for (int i1 = 0; i1 != x1.size(); ++i1) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -1492,7 +1492,7 @@ void Task6::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x5, x4, x2, x3, x1, x0);
   {
     if (x2 == x4 && x1 == x3) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0);
+      const double* i0data = in(0)->get_block_view(x5, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -1507,7 +1507,7 @@ void Task6::Task_local::compute() {
   }
   {
     if (x1 == x3) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x5, x4, x2, x0);
+      const double* i0data = in(1)->get_block_view(x5, x4, x2, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i2 = 0; i2 != x2.size(); ++i2) {
@@ -1524,7 +1524,7 @@ void Task6::Task_local::compute() {
   }
   {
     if (x2 == x3 && x1 == x4) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0);
+      const double* i0data = in(0)->get_block_view(x5, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -1539,7 +1539,7 @@ void Task6::Task_local::compute() {
   }
   {
     if (x1 == x4) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x5, x0, x2, x3);
+      const double* i0data = in(1)->get_block_view(x5, x0, x2, x3);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i2 = 0; i2 != x2.size(); ++i2) {
@@ -1556,7 +1556,7 @@ void Task6::Task_local::compute() {
   }
   {
     if (x2 == x3) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x5, x4, x1, x0);
+      const double* i0data = in(1)->get_block_view(x5, x4, x1, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i1 = 0; i1 != x1.size(); ++i1) {
           for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -1573,7 +1573,7 @@ void Task6::Task_local::compute() {
   }
   {
     if (x2 == x4) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x5, x3, x1, x0);
+      const double* i0data = in(1)->get_block_view(x5, x3, x1, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i1 = 0; i1 != x1.size(); ++i1) {
           for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -1589,8 +1589,8 @@ void Task6::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(x5, x4, x2, x3, x1, x0);
-    sort_indices<0,1,2,3,4,5,1,1,-1,1>(i0data, odata, x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
+    const double* i0data = in(2)->get_block_view(x5, x4, x2, x3, x1, x0);
+    sort_indices<0,1,2,3,4,5,1,1,-1,1>(i0data, odata.get(), x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
   }
   out()->put_block(odata, x5, x4, x2, x3, x1, x0);
 }
@@ -1604,7 +1604,7 @@ void Task7::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x2, x3, x1, x0);
   {
     if (x1 == x3) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x0);
+      const double* i0data = in(0)->get_block_view(x2, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i2 = 0; i2 != x2.size(); ++i2) {
@@ -1617,7 +1617,7 @@ void Task7::Task_local::compute() {
   }
   {
     if (x2 == x3) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
+      const double* i0data = in(0)->get_block_view(x1, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i1 = 0; i1 != x1.size(); ++i1) {
           for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -1629,8 +1629,8 @@ void Task7::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(x2, x3, x1, x0);
-    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata, x2.size(), x3.size(), x1.size(), x0.size());
+    const double* i0data = in(1)->get_block_view(x2, x3, x1, x0);
+    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata.get(), x2.size(), x3.size(), x1.size(), x0.size());
   }
   out()->put_block(odata, x2, x3, x1, x0);
 }
@@ -1646,7 +1646,7 @@ void Task8::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x5, x3, x2, x4, x1, x0);
   {
     if (x2 == x4 && x1 == x3) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0);
+      const double* i0data = in(0)->get_block_view(x5, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i4 = 0; i4 != x4.size(); ++i4) {
           for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -1661,7 +1661,7 @@ void Task8::Task_local::compute() {
   }
   {
     if (x1 == x3) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x5, x0, x2, x4);
+      const double* i0data = in(1)->get_block_view(x5, x0, x2, x4);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i4 = 0; i4 != x4.size(); ++i4) {
           for (int i2 = 0; i2 != x2.size(); ++i2) {
@@ -1678,7 +1678,7 @@ void Task8::Task_local::compute() {
   }
   {
     if (x2 == x3 && x1 == x4) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0);
+      const double* i0data = in(0)->get_block_view(x5, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i4 = 0; i4 != x4.size(); ++i4) {
           for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -1693,7 +1693,7 @@ void Task8::Task_local::compute() {
   }
   {
     if (x1 == x4) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x5, x3, x2, x0);
+      const double* i0data = in(1)->get_block_view(x5, x3, x2, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i4 = 0; i4 != x4.size(); ++i4) {
           for (int i2 = 0; i2 != x2.size(); ++i2) {
@@ -1710,7 +1710,7 @@ void Task8::Task_local::compute() {
   }
   {
     if (x2 == x3) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x5, x4, x1, x0);
+      const double* i0data = in(1)->get_block_view(x5, x4, x1, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i1 = 0; i1 != x1.size(); ++i1) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -1727,7 +1727,7 @@ void Task8::Task_local::compute() {
   }
   {
     if (x2 == x4) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x5, x3, x1, x0);
+      const double* i0data = in(1)->get_block_view(x5, x3, x1, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i1 = 0; i1 != x1.size(); ++i1) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -1743,8 +1743,8 @@ void Task8::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(x5, x3, x2, x4, x1, x0);
-    sort_indices<0,1,2,3,4,5,1,1,1,1>(i0data, odata, x5.size(), x3.size(), x2.size(), x4.size(), x1.size(), x0.size());
+    const double* i0data = in(2)->get_block_view(x5, x3, x2, x4, x1, x0);
+    sort_indices<0,1,2,3,4,5,1,1,1,1>(i0data, odata.get(), x5.size(), x3.size(), x2.size(), x4.size(), x1.size(), x0.size());
   }
   out()->put_block(odata, x5, x3, x2, x4, x1, x0);
 }
@@ -1760,7 +1760,7 @@ void Task9::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x2, x5, x4, x3, x1, x0);
   {
     if (x2 == x5 && x1 == x3) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x4, x0);
+      const double* i0data = in(0)->get_block_view(x4, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -1775,7 +1775,7 @@ void Task9::Task_local::compute() {
   }
   {
     if (x2 == x3 && x1 == x5) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x4, x0);
+      const double* i0data = in(0)->get_block_view(x4, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -1790,7 +1790,7 @@ void Task9::Task_local::compute() {
   }
   {
     if (x1 == x5) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x4, x3, x2, x0);
+      const double* i0data = in(1)->get_block_view(x4, x3, x2, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -1807,7 +1807,7 @@ void Task9::Task_local::compute() {
   }
   {
     if (x2 == x5) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x4, x3, x1, x0);
+      const double* i0data = in(1)->get_block_view(x4, x3, x1, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i1 = 0; i1 != x1.size(); ++i1) {
           for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -1824,7 +1824,7 @@ void Task9::Task_local::compute() {
   }
   {
     if (x4 == x5 && x1 == x3) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x0);
+      const double* i0data = in(0)->get_block_view(x2, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i5 = 0; i5 != x5.size(); ++i5) {
@@ -1839,7 +1839,7 @@ void Task9::Task_local::compute() {
   }
   {
     if (x1 == x3) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x2, x5, x4, x0);
+      const double* i0data = in(1)->get_block_view(x2, x5, x4, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -1856,7 +1856,7 @@ void Task9::Task_local::compute() {
   }
   {
     if (x4 == x5 && x2 == x3) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
+      const double* i0data = in(0)->get_block_view(x1, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i1 = 0; i1 != x1.size(); ++i1) {
           for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -1871,7 +1871,7 @@ void Task9::Task_local::compute() {
   }
   {
     if (x2 == x3) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x4, x5, x1, x0);
+      const double* i0data = in(1)->get_block_view(x4, x5, x1, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i1 = 0; i1 != x1.size(); ++i1) {
           for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -1888,7 +1888,7 @@ void Task9::Task_local::compute() {
   }
   {
     if (x4 == x5) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x2, x3, x1, x0);
+      const double* i0data = in(1)->get_block_view(x2, x3, x1, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i1 = 0; i1 != x1.size(); ++i1) {
           for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -1904,8 +1904,8 @@ void Task9::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(x2, x5, x4, x3, x1, x0);
-    sort_indices<0,1,2,3,4,5,1,1,-1,1>(i0data, odata, x2.size(), x5.size(), x4.size(), x3.size(), x1.size(), x0.size());
+    const double* i0data = in(2)->get_block_view(x2, x5, x4, x3, x1, x0);
+    sort_indices<0,1,2,3,4,5,1,1,-1,1>(i0data, odata.get(), x2.size(), x5.size(), x4.size(), x3.size(), x1.size(), x0.size());
   }
   out()->put_block(odata, x2, x5, x4, x3, x1, x0);
 }
@@ -1919,7 +1919,7 @@ void Task10::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x3, x2, x0, x1);
   {
     if (x0 == x1) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2);
+      const double* i0data = in(0)->get_block_view(x3, x2);
       for (int i1 = 0; i1 != x1.size(); ++i1) {
         for (int i2 = 0; i2 != x2.size(); ++i2) {
           for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -1932,7 +1932,7 @@ void Task10::Task_local::compute() {
   }
   {
     if (x0 == x2) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x1);
+      const double* i0data = in(0)->get_block_view(x3, x1);
       for (int i1 = 0; i1 != x1.size(); ++i1) {
         for (int i2 = 0; i2 != x2.size(); ++i2) {
           for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -1944,8 +1944,8 @@ void Task10::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(x3, x2, x0, x1);
-    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata, x3.size(), x2.size(), x0.size(), x1.size());
+    const double* i0data = in(1)->get_block_view(x3, x2, x0, x1);
+    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata.get(), x3.size(), x2.size(), x0.size(), x1.size());
   }
   out()->put_block(odata, x3, x2, x0, x1);
 }
@@ -1958,9 +1958,9 @@ void Task11::Task_local::compute() {
   // tensor label: Gamma14
   std::unique_ptr<double[]> odata = out()->move_block(x0, x3);
   // associated with merged
-  std::unique_ptr<double[]> fdata = in(2)->get_block(x2, x1);
+  const double* fdata = in(2)->get_block_view(x2, x1);
   if (x0 == x3) {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x1);
+    const double* i0data = in(0)->get_block_view(x2, x1);
     for (int i1 = 0; i1 != x1.size(); ++i1) {
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -1979,7 +1979,7 @@ void Task11::Task_local::compute() {
     }
   }
   if (x0 == x1) {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x3);
+    const double* i0data = in(0)->get_block_view(x2, x3);
     for (int i3 = 0; i3 != x3.size(); ++i3) {
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i1 = 0; i1 != x1.size(); ++i1) {
@@ -1990,7 +1990,7 @@ void Task11::Task_local::compute() {
     }
   }
   if (x2 == x3) {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
+    const double* i0data = in(0)->get_block_view(x0, x1);
     for (int i1 = 0; i1 != x1.size(); ++i1) {
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -2001,7 +2001,7 @@ void Task11::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(x0, x3, x2, x1);
+    const double* i0data = in(1)->get_block_view(x0, x3, x2, x1);
     for (int i1 = 0; i1 != x1.size(); ++i1) {
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -2030,8 +2030,8 @@ void Task12::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    sort_indices<0,1,1,1,-1,1>(i0data, odata, x0.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x0, x1);
+    sort_indices<0,1,1,1,-1,1>(i0data, odata.get(), x0.size(), x1.size());
   }
   out()->put_block(odata, x0, x1);
 }
@@ -2045,7 +2045,7 @@ void Task13::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x3, x1, x0, x2);
   {
     if (x0 == x1) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2);
+      const double* i0data = in(0)->get_block_view(x3, x2);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i1 = 0; i1 != x1.size(); ++i1) {
           for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -2058,7 +2058,7 @@ void Task13::Task_local::compute() {
   }
   {
     if (x0 == x2) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x1);
+      const double* i0data = in(0)->get_block_view(x3, x1);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i1 = 0; i1 != x1.size(); ++i1) {
           for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -2070,8 +2070,8 @@ void Task13::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(x3, x1, x0, x2);
-    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata, x3.size(), x1.size(), x0.size(), x2.size());
+    const double* i0data = in(1)->get_block_view(x3, x1, x0, x2);
+    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata.get(), x3.size(), x1.size(), x0.size(), x2.size());
   }
   out()->put_block(odata, x3, x1, x0, x2);
 }
@@ -2087,7 +2087,7 @@ void Task14::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x5, x4, x1, x3, x2, x0);
   {
     if (x2 == x4 && x1 == x3) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0);
+      const double* i0data = in(0)->get_block_view(x5, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -2102,7 +2102,7 @@ void Task14::Task_local::compute() {
   }
   {
     if (x1 == x3) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x5, x4, x2, x0);
+      const double* i0data = in(1)->get_block_view(x5, x4, x2, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i2 = 0; i2 != x2.size(); ++i2) {
           for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -2119,7 +2119,7 @@ void Task14::Task_local::compute() {
   }
   {
     if (x2 == x3 && x1 == x4) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0);
+      const double* i0data = in(0)->get_block_view(x5, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -2134,7 +2134,7 @@ void Task14::Task_local::compute() {
   }
   {
     if (x1 == x4) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x5, x3, x2, x0);
+      const double* i0data = in(1)->get_block_view(x5, x3, x2, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i2 = 0; i2 != x2.size(); ++i2) {
           for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -2151,7 +2151,7 @@ void Task14::Task_local::compute() {
   }
   {
     if (x2 == x3) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x5, x4, x1, x0);
+      const double* i0data = in(1)->get_block_view(x5, x4, x1, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i1 = 0; i1 != x1.size(); ++i1) {
@@ -2168,7 +2168,7 @@ void Task14::Task_local::compute() {
   }
   {
     if (x2 == x4) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x5, x0, x1, x3);
+      const double* i0data = in(1)->get_block_view(x5, x0, x1, x3);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i1 = 0; i1 != x1.size(); ++i1) {
@@ -2184,8 +2184,8 @@ void Task14::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(x5, x4, x1, x3, x2, x0);
-    sort_indices<0,1,2,3,4,5,1,1,1,1>(i0data, odata, x5.size(), x4.size(), x1.size(), x3.size(), x2.size(), x0.size());
+    const double* i0data = in(2)->get_block_view(x5, x4, x1, x3, x2, x0);
+    sort_indices<0,1,2,3,4,5,1,1,1,1>(i0data, odata.get(), x5.size(), x4.size(), x1.size(), x3.size(), x2.size(), x0.size());
   }
   out()->put_block(odata, x5, x4, x1, x3, x2, x0);
 }
@@ -2199,7 +2199,7 @@ void Task15::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, x3, x2, x0);
   {
     if (x1 == x3) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x0);
+      const double* i0data = in(0)->get_block_view(x2, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i2 = 0; i2 != x2.size(); ++i2) {
           for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -2212,7 +2212,7 @@ void Task15::Task_local::compute() {
   }
   {
     if (x2 == x3) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
+      const double* i0data = in(0)->get_block_view(x1, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i1 = 0; i1 != x1.size(); ++i1) {
@@ -2224,8 +2224,8 @@ void Task15::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(x1, x3, x2, x0);
-    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata, x1.size(), x3.size(), x2.size(), x0.size());
+    const double* i0data = in(1)->get_block_view(x1, x3, x2, x0);
+    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata.get(), x1.size(), x3.size(), x2.size(), x0.size());
   }
   out()->put_block(odata, x1, x3, x2, x0);
 }
@@ -2240,9 +2240,9 @@ void Task16::Task_local::compute() {
   // tensor label: Gamma31
   std::unique_ptr<double[]> odata = out()->move_block(x5, x0, x1, x4);
   // associated with merged
-  std::unique_ptr<double[]> fdata = in(3)->get_block(x3, x2);
+  const double* fdata = in(3)->get_block_view(x3, x2);
   if (x1 == x4) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(x5, x0, x3, x2);
+    const double* i0data = in(1)->get_block_view(x5, x0, x3, x2);
     for (int i2 = 0; i2 != x2.size(); ++i2) {
       for (int i3 = 0; i3 != x3.size(); ++i3) {
         for (int i0 = 0; i0 != x0.size(); ++i0) {
@@ -2257,7 +2257,7 @@ void Task16::Task_local::compute() {
     }
   }
   if (x3 == x4 && x1 == x2) {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0);
+    const double* i0data = in(0)->get_block_view(x5, x0);
     for (int i0 = 0; i0 != x0.size(); ++i0) {
       for (int i5 = 0; i5 != x5.size(); ++i5) {
         for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -2270,7 +2270,7 @@ void Task16::Task_local::compute() {
     }
   }
   if (x1 == x2) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(x5, x0, x3, x4);
+    const double* i0data = in(1)->get_block_view(x5, x0, x3, x4);
     for (int i4 = 0; i4 != x4.size(); ++i4) {
       for (int i3 = 0; i3 != x3.size(); ++i3) {
         for (int i0 = 0; i0 != x0.size(); ++i0) {
@@ -2285,7 +2285,7 @@ void Task16::Task_local::compute() {
     }
   }
   if (x3 == x4) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(x5, x0, x1, x2);
+    const double* i0data = in(1)->get_block_view(x5, x0, x1, x2);
     for (int i2 = 0; i2 != x2.size(); ++i2) {
       for (int i1 = 0; i1 != x1.size(); ++i1) {
         for (int i0 = 0; i0 != x0.size(); ++i0) {
@@ -2300,7 +2300,7 @@ void Task16::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(x5, x0, x1, x4, x3, x2);
+    const double* i0data = in(2)->get_block_view(x5, x0, x1, x4, x3, x2);
     for (int i2 = 0; i2 != x2.size(); ++i2) {
       for (int i3 = 0; i3 != x3.size(); ++i3) {
         for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -2328,7 +2328,7 @@ void Task17::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x3, x0, x1, x2);
   {
     if (x1 == x2) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0);
+      const double* i0data = in(0)->get_block_view(x3, x0);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i0 = 0; i0 != x0.size(); ++i0) {
           for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -2340,8 +2340,8 @@ void Task17::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(x3, x0, x1, x2);
-    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata, x3.size(), x0.size(), x1.size(), x2.size());
+    const double* i0data = in(1)->get_block_view(x3, x0, x1, x2);
+    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata.get(), x3.size(), x0.size(), x1.size(), x2.size());
   }
   out()->put_block(odata, x3, x0, x1, x2);
 }
@@ -2356,9 +2356,9 @@ void Task18::Task_local::compute() {
   // tensor label: Gamma34
   std::unique_ptr<double[]> odata = out()->move_block(x5, x4, x1, x0);
   // associated with merged
-  std::unique_ptr<double[]> fdata = in(3)->get_block(x3, x2);
+  const double* fdata = in(3)->get_block_view(x3, x2);
   if (x1 == x4) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(x5, x0, x3, x2);
+    const double* i0data = in(1)->get_block_view(x5, x0, x3, x2);
     for (int i2 = 0; i2 != x2.size(); ++i2) {
       for (int i3 = 0; i3 != x3.size(); ++i3) {
         for (int i0 = 0; i0 != x0.size(); ++i0) {
@@ -2373,7 +2373,7 @@ void Task18::Task_local::compute() {
     }
   }
   if (x3 == x4 && x1 == x2) {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0);
+    const double* i0data = in(0)->get_block_view(x5, x0);
     for (int i0 = 0; i0 != x0.size(); ++i0) {
       for (int i5 = 0; i5 != x5.size(); ++i5) {
         for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -2386,7 +2386,7 @@ void Task18::Task_local::compute() {
     }
   }
   if (x1 == x2) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(x5, x4, x3, x0);
+    const double* i0data = in(1)->get_block_view(x5, x4, x3, x0);
     for (int i0 = 0; i0 != x0.size(); ++i0) {
       for (int i3 = 0; i3 != x3.size(); ++i3) {
         for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -2401,7 +2401,7 @@ void Task18::Task_local::compute() {
     }
   }
   if (x3 == x4) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(x5, x2, x1, x0);
+    const double* i0data = in(1)->get_block_view(x5, x2, x1, x0);
     for (int i0 = 0; i0 != x0.size(); ++i0) {
       for (int i1 = 0; i1 != x1.size(); ++i1) {
         for (int i2 = 0; i2 != x2.size(); ++i2) {
@@ -2416,7 +2416,7 @@ void Task18::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(x5, x4, x3, x2, x1, x0);
+    const double* i0data = in(2)->get_block_view(x5, x4, x3, x2, x1, x0);
     for (int i0 = 0; i0 != x0.size(); ++i0) {
       for (int i1 = 0; i1 != x1.size(); ++i1) {
         for (int i2 = 0; i2 != x2.size(); ++i2) {
@@ -2444,7 +2444,7 @@ void Task19::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x3, x2, x1, x0);
   {
     if (x1 == x2) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0);
+      const double* i0data = in(0)->get_block_view(x3, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i2 = 0; i2 != x2.size(); ++i2) {
           for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -2456,8 +2456,8 @@ void Task19::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(x3, x2, x1, x0);
-    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata, x3.size(), x2.size(), x1.size(), x0.size());
+    const double* i0data = in(1)->get_block_view(x3, x2, x1, x0);
+    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata.get(), x3.size(), x2.size(), x1.size(), x0.size());
   }
   out()->put_block(odata, x3, x2, x1, x0);
 }
@@ -2473,7 +2473,7 @@ void Task20::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x5, x0, x4, x3, x1, x2);
   {
     if (x1 == x2) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x3);
+      const double* i0data = in(0)->get_block_view(x5, x0, x4, x3);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -2490,7 +2490,7 @@ void Task20::Task_local::compute() {
   }
   {
     if (x1 == x3) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x2);
+      const double* i0data = in(0)->get_block_view(x5, x0, x4, x2);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -2506,8 +2506,8 @@ void Task20::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(x5, x0, x4, x3, x1, x2);
-    sort_indices<0,1,2,3,4,5,1,1,-1,1>(i0data, odata, x5.size(), x0.size(), x4.size(), x3.size(), x1.size(), x2.size());
+    const double* i0data = in(1)->get_block_view(x5, x0, x4, x3, x1, x2);
+    sort_indices<0,1,2,3,4,5,1,1,-1,1>(i0data, odata.get(), x5.size(), x0.size(), x4.size(), x3.size(), x1.size(), x2.size());
   }
   out()->put_block(odata, x5, x0, x4, x3, x1, x2);
 }
@@ -2518,8 +2518,8 @@ void Task21::Task_local::compute() {
   // tensor label: Gamma38
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0);
   {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    sort_indices<0,1,1,1,1,1>(i0data, odata, x1.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(x1, x0);
+    sort_indices<0,1,1,1,1,1>(i0data, odata.get(), x1.size(), x0.size());
   }
   out()->put_block(odata, x1, x0);
 }
@@ -2535,7 +2535,7 @@ void Task22::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x5, x2, x4, x3, x1, x0);
   {
     if (x1 == x2) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x3);
+      const double* i0data = in(0)->get_block_view(x5, x0, x4, x3);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -2552,7 +2552,7 @@ void Task22::Task_local::compute() {
   }
   {
     if (x1 == x3) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x2, x4, x0);
+      const double* i0data = in(0)->get_block_view(x5, x2, x4, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -2568,8 +2568,8 @@ void Task22::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(x5, x2, x4, x3, x1, x0);
-    sort_indices<0,1,2,3,4,5,1,1,1,1>(i0data, odata, x5.size(), x2.size(), x4.size(), x3.size(), x1.size(), x0.size());
+    const double* i0data = in(1)->get_block_view(x5, x2, x4, x3, x1, x0);
+    sort_indices<0,1,2,3,4,5,1,1,1,1>(i0data, odata.get(), x5.size(), x2.size(), x4.size(), x3.size(), x1.size(), x0.size());
   }
   out()->put_block(odata, x5, x2, x4, x3, x1, x0);
 }
@@ -2585,7 +2585,7 @@ void Task23::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x5, x0, x3, x4, x2, x1);
   {
     if (x2 == x4) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x3, x1);
+      const double* i0data = in(0)->get_block_view(x5, x0, x3, x1);
       for (int i1 = 0; i1 != x1.size(); ++i1) {
         for (int i4 = 0; i4 != x4.size(); ++i4) {
           for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -2602,7 +2602,7 @@ void Task23::Task_local::compute() {
   }
   {
     if (x3 == x4) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x2, x1);
+      const double* i0data = in(0)->get_block_view(x5, x0, x2, x1);
       for (int i1 = 0; i1 != x1.size(); ++i1) {
         for (int i2 = 0; i2 != x2.size(); ++i2) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -2618,8 +2618,8 @@ void Task23::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(x5, x0, x3, x4, x2, x1);
-    sort_indices<0,1,2,3,4,5,1,1,-1,1>(i0data, odata, x5.size(), x0.size(), x3.size(), x4.size(), x2.size(), x1.size());
+    const double* i0data = in(1)->get_block_view(x5, x0, x3, x4, x2, x1);
+    sort_indices<0,1,2,3,4,5,1,1,-1,1>(i0data, odata.get(), x5.size(), x0.size(), x3.size(), x4.size(), x2.size(), x1.size());
   }
   out()->put_block(odata, x5, x0, x3, x4, x2, x1);
 }
@@ -2635,7 +2635,7 @@ void Task24::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x5, x4, x3, x0, x2, x1);
   {
     if (x2 == x4) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x1, x3, x0);
+      const double* i0data = in(0)->get_block_view(x5, x1, x3, x0);
       for (int i1 = 0; i1 != x1.size(); ++i1) {
         for (int i0 = 0; i0 != x0.size(); ++i0) {
           for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -2652,7 +2652,7 @@ void Task24::Task_local::compute() {
   }
   {
     if (x3 == x4) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x2, x1);
+      const double* i0data = in(0)->get_block_view(x5, x0, x2, x1);
       for (int i1 = 0; i1 != x1.size(); ++i1) {
         for (int i2 = 0; i2 != x2.size(); ++i2) {
           for (int i0 = 0; i0 != x0.size(); ++i0) {
@@ -2668,8 +2668,8 @@ void Task24::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(x5, x4, x3, x0, x2, x1);
-    sort_indices<0,1,2,3,4,5,1,1,1,1>(i0data, odata, x5.size(), x4.size(), x3.size(), x0.size(), x2.size(), x1.size());
+    const double* i0data = in(1)->get_block_view(x5, x4, x3, x0, x2, x1);
+    sort_indices<0,1,2,3,4,5,1,1,1,1>(i0data, odata.get(), x5.size(), x4.size(), x3.size(), x0.size(), x2.size(), x1.size());
   }
   out()->put_block(odata, x5, x4, x3, x0, x2, x1);
 }
@@ -2686,9 +2686,9 @@ void Task25::Task_local::compute() {
   // tensor label: Gamma58
   std::unique_ptr<double[]> odata = out()->move_block(x7, x0, x6, x5, x2, x1);
   // associated with merged
-  std::unique_ptr<double[]> fdata = in(3)->get_block(x4, x3);
+  const double* fdata = in(3)->get_block_view(x4, x3);
   if (x2 == x5) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(x7, x0, x6, x1, x4, x3);
+    const double* i0data = in(1)->get_block_view(x7, x0, x6, x1, x4, x3);
     for (int i3 = 0; i3 != x3.size(); ++i3) {
       for (int i4 = 0; i4 != x4.size(); ++i4) {
         for (int i1 = 0; i1 != x1.size(); ++i1) {
@@ -2707,7 +2707,7 @@ void Task25::Task_local::compute() {
     }
   }
   if (x4 == x5 && x2 == x3) {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x0, x6, x1);
+    const double* i0data = in(0)->get_block_view(x7, x0, x6, x1);
     for (int i1 = 0; i1 != x1.size(); ++i1) {
       for (int i6 = 0; i6 != x6.size(); ++i6) {
         for (int i0 = 0; i0 != x0.size(); ++i0) {
@@ -2724,7 +2724,7 @@ void Task25::Task_local::compute() {
     }
   }
   if (x2 == x3) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(x7, x0, x6, x5, x4, x1);
+    const double* i0data = in(1)->get_block_view(x7, x0, x6, x5, x4, x1);
     for (int i1 = 0; i1 != x1.size(); ++i1) {
       for (int i4 = 0; i4 != x4.size(); ++i4) {
         for (int i5 = 0; i5 != x5.size(); ++i5) {
@@ -2743,7 +2743,7 @@ void Task25::Task_local::compute() {
     }
   }
   if (x4 == x5) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(x7, x0, x6, x3, x2, x1);
+    const double* i0data = in(1)->get_block_view(x7, x0, x6, x3, x2, x1);
     for (int i1 = 0; i1 != x1.size(); ++i1) {
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -2762,7 +2762,7 @@ void Task25::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(x7, x0, x6, x5, x4, x3, x2, x1);
+    const double* i0data = in(2)->get_block_view(x7, x0, x6, x5, x4, x3, x2, x1);
     for (int i1 = 0; i1 != x1.size(); ++i1) {
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -2796,7 +2796,7 @@ void Task26::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x5, x0, x4, x3, x2, x1);
   {
     if (x2 == x3) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x1);
+      const double* i0data = in(0)->get_block_view(x5, x0, x4, x1);
       for (int i1 = 0; i1 != x1.size(); ++i1) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -2812,8 +2812,8 @@ void Task26::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(x5, x0, x4, x3, x2, x1);
-    sort_indices<0,1,2,3,4,5,1,1,1,1>(i0data, odata, x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
+    const double* i0data = in(1)->get_block_view(x5, x0, x4, x3, x2, x1);
+    sort_indices<0,1,2,3,4,5,1,1,1,1>(i0data, odata.get(), x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
   }
   out()->put_block(odata, x5, x0, x4, x3, x2, x1);
 }
@@ -2826,8 +2826,8 @@ void Task27::Task_local::compute() {
   // tensor label: Gamma60
   std::unique_ptr<double[]> odata = out()->move_block(x3, x0, x2, x1);
   {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata, x3.size(), x0.size(), x2.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x3, x0, x2, x1);
+    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata.get(), x3.size(), x0.size(), x2.size(), x1.size());
   }
   out()->put_block(odata, x3, x0, x2, x1);
 }
@@ -2840,9 +2840,9 @@ void Task28::Task_local::compute() {
   // tensor label: Gamma79
   std::unique_ptr<double[]> odata = out()->move_block(x3, x0);
   // associated with merged
-  std::unique_ptr<double[]> fdata = in(1)->get_block(x2, x1);
+  const double* fdata = in(1)->get_block_view(x2, x1);
   {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
+    const double* i0data = in(0)->get_block_view(x3, x0, x2, x1);
     for (int i1 = 0; i1 != x1.size(); ++i1) {
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i0 = 0; i0 != x0.size(); ++i0) {
@@ -2867,9 +2867,9 @@ void Task29::Task_local::compute() {
   // tensor label: Gamma90
   std::unique_ptr<double[]> odata = out()->move_block(x5, x0, x4, x1);
   // associated with merged
-  std::unique_ptr<double[]> fdata = in(1)->get_block(x3, x2);
+  const double* fdata = in(1)->get_block_view(x3, x2);
   {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x1, x3, x2);
+    const double* i0data = in(0)->get_block_view(x5, x0, x4, x1, x3, x2);
     for (int i2 = 0; i2 != x2.size(); ++i2) {
       for (int i3 = 0; i3 != x3.size(); ++i3) {
         for (int i1 = 0; i1 != x1.size(); ++i1) {
@@ -2899,7 +2899,7 @@ void Task30::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x0, x5, x1, x4, x3, x2);
   {
     if (x1 == x5 && x0 == x4) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2);
+      const double* i0data = in(0)->get_block_view(x3, x2);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -2914,7 +2914,7 @@ void Task30::Task_local::compute() {
   }
   {
     if (x1 == x4 && x0 == x5) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2);
+      const double* i0data = in(0)->get_block_view(x3, x2);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -2941,7 +2941,7 @@ void Task30::Task_local::compute() {
   }
   {
     if (x0 == x2 && x1 == x4) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x5);
+      const double* i0data = in(0)->get_block_view(x3, x5);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -2968,7 +2968,7 @@ void Task30::Task_local::compute() {
   }
   {
     if (x1 == x5 && x0 == x2) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x4);
+      const double* i0data = in(0)->get_block_view(x3, x4);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -2983,7 +2983,7 @@ void Task30::Task_local::compute() {
   }
   {
     if (x3 == x4 && x0 == x2) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x5);
+      const double* i0data = in(0)->get_block_view(x1, x5);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i4 = 0; i4 != x4.size(); ++i4) {
           for (int i1 = 0; i1 != x1.size(); ++i1) {
@@ -2998,7 +2998,7 @@ void Task30::Task_local::compute() {
   }
   {
     if (x3 == x5 && x0 == x2) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x4);
+      const double* i0data = in(0)->get_block_view(x1, x4);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i4 = 0; i4 != x4.size(); ++i4) {
           for (int i1 = 0; i1 != x1.size(); ++i1) {
@@ -3013,7 +3013,7 @@ void Task30::Task_local::compute() {
   }
   {
     if (x0 == x2) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x3, x5, x1, x4);
+      const double* i0data = in(1)->get_block_view(x3, x5, x1, x4);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -3042,7 +3042,7 @@ void Task30::Task_local::compute() {
   }
   {
     if (x0 == x4 && x1 == x2) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x5);
+      const double* i0data = in(0)->get_block_view(x3, x5);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -3057,7 +3057,7 @@ void Task30::Task_local::compute() {
   }
   {
     if (x3 == x5 && x0 == x4) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x2);
+      const double* i0data = in(0)->get_block_view(x1, x2);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i4 = 0; i4 != x4.size(); ++i4) {
           for (int i1 = 0; i1 != x1.size(); ++i1) {
@@ -3072,7 +3072,7 @@ void Task30::Task_local::compute() {
   }
   {
     if (x0 == x4) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x1, x5, x3, x2);
+      const double* i0data = in(1)->get_block_view(x1, x5, x3, x2);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -3101,7 +3101,7 @@ void Task30::Task_local::compute() {
   }
   {
     if (x0 == x5 && x1 == x2) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x4);
+      const double* i0data = in(0)->get_block_view(x3, x4);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -3116,7 +3116,7 @@ void Task30::Task_local::compute() {
   }
   {
     if (x3 == x4 && x0 == x5) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x2);
+      const double* i0data = in(0)->get_block_view(x1, x2);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i4 = 0; i4 != x4.size(); ++i4) {
           for (int i1 = 0; i1 != x1.size(); ++i1) {
@@ -3131,7 +3131,7 @@ void Task30::Task_local::compute() {
   }
   {
     if (x0 == x5) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x1, x4, x3, x2);
+      const double* i0data = in(1)->get_block_view(x1, x4, x3, x2);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -3148,7 +3148,7 @@ void Task30::Task_local::compute() {
   }
   {
     if (x3 == x4 && x1 == x2) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x5);
+      const double* i0data = in(0)->get_block_view(x0, x5);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i4 = 0; i4 != x4.size(); ++i4) {
           for (int i5 = 0; i5 != x5.size(); ++i5) {
@@ -3163,7 +3163,7 @@ void Task30::Task_local::compute() {
   }
   {
     if (x3 == x5 && x1 == x2) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x4);
+      const double* i0data = in(0)->get_block_view(x0, x4);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i4 = 0; i4 != x4.size(); ++i4) {
           for (int i5 = 0; i5 != x5.size(); ++i5) {
@@ -3178,7 +3178,7 @@ void Task30::Task_local::compute() {
   }
   {
     if (x1 == x2) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x0, x5, x3, x4);
+      const double* i0data = in(1)->get_block_view(x0, x5, x3, x4);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -3195,7 +3195,7 @@ void Task30::Task_local::compute() {
   }
   {
     if (x3 == x5 && x1 == x4) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x2);
+      const double* i0data = in(0)->get_block_view(x0, x2);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i4 = 0; i4 != x4.size(); ++i4) {
           for (int i5 = 0; i5 != x5.size(); ++i5) {
@@ -3210,7 +3210,7 @@ void Task30::Task_local::compute() {
   }
   {
     if (x1 == x4) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x0, x5, x3, x2);
+      const double* i0data = in(1)->get_block_view(x0, x5, x3, x2);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -3227,7 +3227,7 @@ void Task30::Task_local::compute() {
   }
   {
     if (x3 == x4 && x1 == x5) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x2);
+      const double* i0data = in(0)->get_block_view(x0, x2);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i4 = 0; i4 != x4.size(); ++i4) {
           for (int i5 = 0; i5 != x5.size(); ++i5) {
@@ -3242,7 +3242,7 @@ void Task30::Task_local::compute() {
   }
   {
     if (x1 == x5) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x0, x4, x3, x2);
+      const double* i0data = in(1)->get_block_view(x0, x4, x3, x2);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -3259,7 +3259,7 @@ void Task30::Task_local::compute() {
   }
   {
     if (x3 == x4) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x0, x5, x1, x2);
+      const double* i0data = in(1)->get_block_view(x0, x5, x1, x2);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i4 = 0; i4 != x4.size(); ++i4) {
           for (int i1 = 0; i1 != x1.size(); ++i1) {
@@ -3276,7 +3276,7 @@ void Task30::Task_local::compute() {
   }
   {
     if (x3 == x5) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x1, x4, x0, x2);
+      const double* i0data = in(1)->get_block_view(x1, x4, x0, x2);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i4 = 0; i4 != x4.size(); ++i4) {
           for (int i1 = 0; i1 != x1.size(); ++i1) {
@@ -3292,8 +3292,8 @@ void Task30::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(x0, x5, x1, x4, x3, x2);
-    sort_indices<0,1,2,3,4,5,1,1,1,1>(i0data, odata, x0.size(), x5.size(), x1.size(), x4.size(), x3.size(), x2.size());
+    const double* i0data = in(2)->get_block_view(x0, x5, x1, x4, x3, x2);
+    sort_indices<0,1,2,3,4,5,1,1,1,1>(i0data, odata.get(), x0.size(), x5.size(), x1.size(), x4.size(), x3.size(), x2.size());
   }
   out()->put_block(odata, x0, x5, x1, x4, x3, x2);
 }
@@ -3309,7 +3309,7 @@ void Task31::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x5, x0, x1, x4, x3, x2);
   {
     if (x1 == x4) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x5, x0, x3, x2);
+      const double* i0data = in(1)->get_block_view(x5, x0, x3, x2);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -3326,7 +3326,7 @@ void Task31::Task_local::compute() {
   }
   {
     if (x3 == x4 && x1 == x2) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0);
+      const double* i0data = in(0)->get_block_view(x5, x0);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i4 = 0; i4 != x4.size(); ++i4) {
           for (int i0 = 0; i0 != x0.size(); ++i0) {
@@ -3341,7 +3341,7 @@ void Task31::Task_local::compute() {
   }
   {
     if (x1 == x2) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x5, x0, x3, x4);
+      const double* i0data = in(1)->get_block_view(x5, x0, x3, x4);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -3358,7 +3358,7 @@ void Task31::Task_local::compute() {
   }
   {
     if (x3 == x4) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x5, x0, x1, x2);
+      const double* i0data = in(1)->get_block_view(x5, x0, x1, x2);
       for (int i2 = 0; i2 != x2.size(); ++i2) {
         for (int i4 = 0; i4 != x4.size(); ++i4) {
           for (int i1 = 0; i1 != x1.size(); ++i1) {
@@ -3374,8 +3374,8 @@ void Task31::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(x5, x0, x1, x4, x3, x2);
-    sort_indices<0,1,2,3,4,5,1,1,-1,1>(i0data, odata, x5.size(), x0.size(), x1.size(), x4.size(), x3.size(), x2.size());
+    const double* i0data = in(2)->get_block_view(x5, x0, x1, x4, x3, x2);
+    sort_indices<0,1,2,3,4,5,1,1,-1,1>(i0data, odata.get(), x5.size(), x0.size(), x1.size(), x4.size(), x3.size(), x2.size());
   }
   out()->put_block(odata, x5, x0, x1, x4, x3, x2);
 }
@@ -3391,7 +3391,7 @@ void Task32::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x5, x4, x3, x2, x1, x0);
   {
     if (x1 == x4) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x5, x0, x3, x2);
+      const double* i0data = in(1)->get_block_view(x5, x0, x3, x2);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i2 = 0; i2 != x2.size(); ++i2) {
           for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -3408,7 +3408,7 @@ void Task32::Task_local::compute() {
   }
   {
     if (x3 == x4 && x1 == x2) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0);
+      const double* i0data = in(0)->get_block_view(x5, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i2 = 0; i2 != x2.size(); ++i2) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -3423,7 +3423,7 @@ void Task32::Task_local::compute() {
   }
   {
     if (x1 == x2) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x5, x4, x3, x0);
+      const double* i0data = in(1)->get_block_view(x5, x4, x3, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i2 = 0; i2 != x2.size(); ++i2) {
           for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -3440,7 +3440,7 @@ void Task32::Task_local::compute() {
   }
   {
     if (x3 == x4) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x5, x2, x1, x0);
+      const double* i0data = in(1)->get_block_view(x5, x2, x1, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i1 = 0; i1 != x1.size(); ++i1) {
           for (int i2 = 0; i2 != x2.size(); ++i2) {
@@ -3456,8 +3456,8 @@ void Task32::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(x5, x4, x3, x2, x1, x0);
-    sort_indices<0,1,2,3,4,5,1,1,1,1>(i0data, odata, x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
+    const double* i0data = in(2)->get_block_view(x5, x4, x3, x2, x1, x0);
+    sort_indices<0,1,2,3,4,5,1,1,1,1>(i0data, odata.get(), x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
   }
   out()->put_block(odata, x5, x4, x3, x2, x1, x0);
 }
@@ -3472,8 +3472,8 @@ void Task33::Task_local::compute() {
   // tensor label: Gamma252
   std::unique_ptr<double[]> odata = out()->move_block(x5, x0, x4, x1, x3, x2);
   {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x1, x3, x2);
-    sort_indices<0,1,2,3,4,5,1,1,1,1>(i0data, odata, x5.size(), x0.size(), x4.size(), x1.size(), x3.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x5, x0, x4, x1, x3, x2);
+    sort_indices<0,1,2,3,4,5,1,1,1,1>(i0data, odata.get(), x5.size(), x0.size(), x4.size(), x1.size(), x3.size(), x2.size());
   }
   out()->put_block(odata, x5, x0, x4, x1, x3, x2);
 }
@@ -3491,7 +3491,7 @@ void Task34::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x7, x6, x2, x5, x4, x3, x1, x0);
   {
     if (x2 == x6 && x1 == x5) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x7, x0, x4, x3);
+      const double* i0data = in(1)->get_block_view(x7, x0, x4, x3);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -3510,7 +3510,7 @@ void Task34::Task_local::compute() {
   }
   {
     if (x2 == x5 && x1 == x6) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x7, x0, x4, x3);
+      const double* i0data = in(1)->get_block_view(x7, x0, x4, x3);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -3529,7 +3529,7 @@ void Task34::Task_local::compute() {
   }
   {
     if (x2 == x5 && x1 == x3 && x4 == x6) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x0);
+      const double* i0data = in(0)->get_block_view(x7, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i5 = 0; i5 != x5.size(); ++i5) {
@@ -3546,7 +3546,7 @@ void Task34::Task_local::compute() {
   }
   {
     if (x2 == x5 && x1 == x3) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x7, x6, x4, x0);
+      const double* i0data = in(1)->get_block_view(x7, x6, x4, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -3565,7 +3565,7 @@ void Task34::Task_local::compute() {
   }
   {
     if (x4 == x5 && x2 == x6 && x1 == x3) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x0);
+      const double* i0data = in(0)->get_block_view(x7, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i5 = 0; i5 != x5.size(); ++i5) {
@@ -3582,7 +3582,7 @@ void Task34::Task_local::compute() {
   }
   {
     if (x2 == x6 && x1 == x3) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x7, x5, x4, x0);
+      const double* i0data = in(1)->get_block_view(x7, x5, x4, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -3601,7 +3601,7 @@ void Task34::Task_local::compute() {
   }
   {
     if (x4 == x5 && x1 == x3) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x7, x6, x2, x0);
+      const double* i0data = in(1)->get_block_view(x7, x6, x2, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i5 = 0; i5 != x5.size(); ++i5) {
@@ -3620,7 +3620,7 @@ void Task34::Task_local::compute() {
   }
   {
     if (x4 == x6 && x1 == x3) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x7, x0, x2, x5);
+      const double* i0data = in(1)->get_block_view(x7, x0, x2, x5);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i5 = 0; i5 != x5.size(); ++i5) {
@@ -3639,7 +3639,7 @@ void Task34::Task_local::compute() {
   }
   {
     if (x1 == x3) {
-      std::unique_ptr<double[]> i0data = in(2)->get_block(x7, x6, x2, x5, x4, x0);
+      const double* i0data = in(2)->get_block_view(x7, x6, x2, x5, x4, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -3660,7 +3660,7 @@ void Task34::Task_local::compute() {
   }
   {
     if (x4 == x6 && x2 == x3 && x1 == x5) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x0);
+      const double* i0data = in(0)->get_block_view(x7, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i5 = 0; i5 != x5.size(); ++i5) {
@@ -3677,7 +3677,7 @@ void Task34::Task_local::compute() {
   }
   {
     if (x2 == x3 && x1 == x5) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x7, x6, x4, x0);
+      const double* i0data = in(1)->get_block_view(x7, x6, x4, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -3696,7 +3696,7 @@ void Task34::Task_local::compute() {
   }
   {
     if (x4 == x6 && x1 == x5) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x7, x3, x2, x0);
+      const double* i0data = in(1)->get_block_view(x7, x3, x2, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i5 = 0; i5 != x5.size(); ++i5) {
@@ -3715,7 +3715,7 @@ void Task34::Task_local::compute() {
   }
   {
     if (x1 == x5) {
-      std::unique_ptr<double[]> i0data = in(2)->get_block(x7, x6, x4, x3, x2, x0);
+      const double* i0data = in(2)->get_block_view(x7, x6, x4, x3, x2, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -3736,7 +3736,7 @@ void Task34::Task_local::compute() {
   }
   {
     if (x4 == x5 && x2 == x3 && x1 == x6) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x0);
+      const double* i0data = in(0)->get_block_view(x7, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i5 = 0; i5 != x5.size(); ++i5) {
@@ -3753,7 +3753,7 @@ void Task34::Task_local::compute() {
   }
   {
     if (x2 == x3 && x1 == x6) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x7, x0, x4, x5);
+      const double* i0data = in(1)->get_block_view(x7, x0, x4, x5);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -3772,7 +3772,7 @@ void Task34::Task_local::compute() {
   }
   {
     if (x4 == x5 && x1 == x6) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x7, x0, x2, x3);
+      const double* i0data = in(1)->get_block_view(x7, x0, x2, x3);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i5 = 0; i5 != x5.size(); ++i5) {
@@ -3791,7 +3791,7 @@ void Task34::Task_local::compute() {
   }
   {
     if (x1 == x6) {
-      std::unique_ptr<double[]> i0data = in(2)->get_block(x7, x0, x2, x5, x4, x3);
+      const double* i0data = in(2)->get_block_view(x7, x0, x2, x5, x4, x3);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -3812,7 +3812,7 @@ void Task34::Task_local::compute() {
   }
   {
     if (x4 == x5 && x2 == x3) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x7, x6, x1, x0);
+      const double* i0data = in(1)->get_block_view(x7, x6, x1, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i1 = 0; i1 != x1.size(); ++i1) {
           for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -3831,7 +3831,7 @@ void Task34::Task_local::compute() {
   }
   {
     if (x4 == x6 && x2 == x3) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x7, x5, x1, x0);
+      const double* i0data = in(1)->get_block_view(x7, x5, x1, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i1 = 0; i1 != x1.size(); ++i1) {
           for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -3850,7 +3850,7 @@ void Task34::Task_local::compute() {
   }
   {
     if (x2 == x3) {
-      std::unique_ptr<double[]> i0data = in(2)->get_block(x7, x6, x4, x5, x1, x0);
+      const double* i0data = in(2)->get_block_view(x7, x6, x4, x5, x1, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i1 = 0; i1 != x1.size(); ++i1) {
           for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -3871,7 +3871,7 @@ void Task34::Task_local::compute() {
   }
   {
     if (x4 == x6 && x2 == x5) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x7, x3, x1, x0);
+      const double* i0data = in(1)->get_block_view(x7, x3, x1, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i1 = 0; i1 != x1.size(); ++i1) {
           for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -3890,7 +3890,7 @@ void Task34::Task_local::compute() {
   }
   {
     if (x2 == x5) {
-      std::unique_ptr<double[]> i0data = in(2)->get_block(x7, x6, x4, x3, x1, x0);
+      const double* i0data = in(2)->get_block_view(x7, x6, x4, x3, x1, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i1 = 0; i1 != x1.size(); ++i1) {
           for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -3911,7 +3911,7 @@ void Task34::Task_local::compute() {
   }
   {
     if (x4 == x5 && x2 == x6) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x7, x3, x1, x0);
+      const double* i0data = in(1)->get_block_view(x7, x3, x1, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i1 = 0; i1 != x1.size(); ++i1) {
           for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -3930,7 +3930,7 @@ void Task34::Task_local::compute() {
   }
   {
     if (x2 == x6) {
-      std::unique_ptr<double[]> i0data = in(2)->get_block(x7, x5, x4, x3, x1, x0);
+      const double* i0data = in(2)->get_block_view(x7, x5, x4, x3, x1, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i1 = 0; i1 != x1.size(); ++i1) {
           for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -3951,7 +3951,7 @@ void Task34::Task_local::compute() {
   }
   {
     if (x4 == x5) {
-      std::unique_ptr<double[]> i0data = in(2)->get_block(x7, x6, x2, x3, x1, x0);
+      const double* i0data = in(2)->get_block_view(x7, x6, x2, x3, x1, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i1 = 0; i1 != x1.size(); ++i1) {
           for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -3972,7 +3972,7 @@ void Task34::Task_local::compute() {
   }
   {
     if (x4 == x6) {
-      std::unique_ptr<double[]> i0data = in(2)->get_block(x7, x3, x2, x5, x1, x0);
+      const double* i0data = in(2)->get_block_view(x7, x3, x2, x5, x1, x0);
       for (int i0 = 0; i0 != x0.size(); ++i0) {
         for (int i1 = 0; i1 != x1.size(); ++i1) {
           for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -3992,8 +3992,8 @@ void Task34::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(3)->get_block(x7, x6, x2, x5, x4, x3, x1, x0);
-    sort_indices<0,1,2,3,4,5,6,7,1,1,-1,1>(i0data, odata, x7.size(), x6.size(), x2.size(), x5.size(), x4.size(), x3.size(), x1.size(), x0.size());
+    const double* i0data = in(3)->get_block_view(x7, x6, x2, x5, x4, x3, x1, x0);
+    sort_indices<0,1,2,3,4,5,6,7,1,1,-1,1>(i0data, odata.get(), x7.size(), x6.size(), x2.size(), x5.size(), x4.size(), x3.size(), x1.size(), x0.size());
   }
   out()->put_block(odata, x7, x6, x2, x5, x4, x3, x1, x0);
 }
@@ -4011,7 +4011,7 @@ void Task35::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x7, x0, x6, x5, x4, x3, x2, x1);
   {
     if (x2 == x5) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x7, x0, x6, x1, x4, x3);
+      const double* i0data = in(1)->get_block_view(x7, x0, x6, x1, x4, x3);
       for (int i1 = 0; i1 != x1.size(); ++i1) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -4032,7 +4032,7 @@ void Task35::Task_local::compute() {
   }
   {
     if (x4 == x5 && x2 == x3) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x0, x6, x1);
+      const double* i0data = in(0)->get_block_view(x7, x0, x6, x1);
       for (int i1 = 0; i1 != x1.size(); ++i1) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i5 = 0; i5 != x5.size(); ++i5) {
@@ -4051,7 +4051,7 @@ void Task35::Task_local::compute() {
   }
   {
     if (x2 == x3) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x7, x0, x6, x5, x4, x1);
+      const double* i0data = in(1)->get_block_view(x7, x0, x6, x5, x4, x1);
       for (int i1 = 0; i1 != x1.size(); ++i1) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -4072,7 +4072,7 @@ void Task35::Task_local::compute() {
   }
   {
     if (x4 == x5) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(x7, x0, x6, x3, x2, x1);
+      const double* i0data = in(1)->get_block_view(x7, x0, x6, x3, x2, x1);
       for (int i1 = 0; i1 != x1.size(); ++i1) {
         for (int i2 = 0; i2 != x2.size(); ++i2) {
           for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -4092,8 +4092,8 @@ void Task35::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(x7, x0, x6, x5, x4, x3, x2, x1);
-    sort_indices<0,1,2,3,4,5,6,7,1,1,1,1>(i0data, odata, x7.size(), x0.size(), x6.size(), x5.size(), x4.size(), x3.size(), x2.size(), x1.size());
+    const double* i0data = in(2)->get_block_view(x7, x0, x6, x5, x4, x3, x2, x1);
+    sort_indices<0,1,2,3,4,5,6,7,1,1,1,1>(i0data, odata.get(), x7.size(), x0.size(), x6.size(), x5.size(), x4.size(), x3.size(), x2.size(), x1.size());
   }
   out()->put_block(odata, x7, x0, x6, x5, x4, x3, x2, x1);
 }
@@ -4107,7 +4107,7 @@ void Task36::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x0, x3, x2, x1);
   {
     if (x0 == x3) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x1);
+      const double* i0data = in(0)->get_block_view(x2, x1);
       for (int i1 = 0; i1 != x1.size(); ++i1) {
         for (int i2 = 0; i2 != x2.size(); ++i2) {
           for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -4130,7 +4130,7 @@ void Task36::Task_local::compute() {
   }
   {
     if (x0 == x1) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x3);
+      const double* i0data = in(0)->get_block_view(x2, x3);
       for (int i1 = 0; i1 != x1.size(); ++i1) {
         for (int i2 = 0; i2 != x2.size(); ++i2) {
           for (int i3 = 0; i3 != x3.size(); ++i3) {
@@ -4143,7 +4143,7 @@ void Task36::Task_local::compute() {
   }
   {
     if (x2 == x3) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
+      const double* i0data = in(0)->get_block_view(x0, x1);
       for (int i1 = 0; i1 != x1.size(); ++i1) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i0 = 0; i0 != x0.size(); ++i0) {
@@ -4155,8 +4155,8 @@ void Task36::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(x0, x3, x2, x1);
-    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata, x0.size(), x3.size(), x2.size(), x1.size());
+    const double* i0data = in(1)->get_block_view(x0, x3, x2, x1);
+    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata.get(), x0.size(), x3.size(), x2.size(), x1.size());
   }
   out()->put_block(odata, x0, x3, x2, x1);
 }
@@ -4172,9 +4172,9 @@ void Task37::Task_local::compute() {
   // tensor label: Gamma270
   std::unique_ptr<double[]> odata = out()->move_block(ci0, x0, x5, x1, x4);
   // associated with merged
-  std::unique_ptr<double[]> fdata = in(4)->get_block(x3, x2);
+  const double* fdata = in(4)->get_block_view(x3, x2);
   if (x1 == x5 && x0 == x4) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x3, x2);
+    const double* i0data = in(1)->get_block_view(ci0, x3, x2);
     for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
       for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
         for (int ix5 = 0; ix5 != x5.size(); ++ix5) {
@@ -4189,7 +4189,7 @@ void Task37::Task_local::compute() {
     }
   }
   if (x0 == x5 && x1 == x4) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x3, x2);
+    const double* i0data = in(1)->get_block_view(ci0, x3, x2);
     for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
       for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
         for (int ix5 = 0; ix5 != x5.size(); ++ix5) {
@@ -4205,7 +4205,7 @@ void Task37::Task_local::compute() {
   }
   // rdm0 merged ci derivative case
   if (x1 == x4 && x0 == x2 && x3 == x5) {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(ci0);
+    const double* i0data = in(0)->get_block_view(ci0);
     for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
       for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
         for (int ix5 = 0; ix5 != x5.size(); ++ix5) {
@@ -4217,7 +4217,7 @@ void Task37::Task_local::compute() {
     }
   }
   if (x0 == x2 && x1 == x4) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x3, x5);
+    const double* i0data = in(1)->get_block_view(ci0, x3, x5);
     for (int ix5 = 0; ix5 != x5.size(); ++ix5) {
       for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
         for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
@@ -4233,7 +4233,7 @@ void Task37::Task_local::compute() {
   }
   // rdm0 merged ci derivative case
   if (x3 == x4 && x0 == x2 && x1 == x5) {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(ci0);
+    const double* i0data = in(0)->get_block_view(ci0);
     for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
       for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
         for (int ix5 = 0; ix5 != x5.size(); ++ix5) {
@@ -4245,7 +4245,7 @@ void Task37::Task_local::compute() {
     }
   }
   if (x0 == x2 && x1 == x5) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x3, x4);
+    const double* i0data = in(1)->get_block_view(ci0, x3, x4);
     for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
       for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
         for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
@@ -4260,7 +4260,7 @@ void Task37::Task_local::compute() {
     }
   }
   if (x3 == x4 && x0 == x2) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x1, x5);
+    const double* i0data = in(1)->get_block_view(ci0, x1, x5);
     for (int ix5 = 0; ix5 != x5.size(); ++ix5) {
       for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
         for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
@@ -4275,7 +4275,7 @@ void Task37::Task_local::compute() {
     }
   }
   if (x3 == x5 && x0 == x2) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x1, x4);
+    const double* i0data = in(1)->get_block_view(ci0, x1, x4);
     for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
       for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
         for (int ix5 = 0; ix5 != x5.size(); ++ix5) {
@@ -4290,7 +4290,7 @@ void Task37::Task_local::compute() {
     }
   }
   if (x0 == x2) {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(ci0, x3, x5, x1, x4);
+    const double* i0data = in(2)->get_block_view(ci0, x3, x5, x1, x4);
     for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
       for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
         for (int ix5 = 0; ix5 != x5.size(); ++ix5) {
@@ -4308,7 +4308,7 @@ void Task37::Task_local::compute() {
   }
   // rdm0 merged ci derivative case
   if (x3 == x5 && x0 == x4 && x1 == x2) {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(ci0);
+    const double* i0data = in(0)->get_block_view(ci0);
     for (int ix5 = 0; ix5 != x5.size(); ++ix5) {
       for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
         for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
@@ -4320,7 +4320,7 @@ void Task37::Task_local::compute() {
     }
   }
   if (x0 == x4 && x1 == x2) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x3, x5);
+    const double* i0data = in(1)->get_block_view(ci0, x3, x5);
     for (int ix5 = 0; ix5 != x5.size(); ++ix5) {
       for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
         for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
@@ -4335,7 +4335,7 @@ void Task37::Task_local::compute() {
     }
   }
   if (x3 == x5 && x0 == x4) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x1, x2);
+    const double* i0data = in(1)->get_block_view(ci0, x1, x2);
     for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
       for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
         for (int ix5 = 0; ix5 != x5.size(); ++ix5) {
@@ -4350,7 +4350,7 @@ void Task37::Task_local::compute() {
     }
   }
   if (x0 == x4) {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(ci0, x1, x5, x3, x2);
+    const double* i0data = in(2)->get_block_view(ci0, x1, x5, x3, x2);
     for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
       for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
         for (int ix5 = 0; ix5 != x5.size(); ++ix5) {
@@ -4368,7 +4368,7 @@ void Task37::Task_local::compute() {
   }
   // rdm0 merged ci derivative case
   if (x3 == x4 && x0 == x5 && x1 == x2) {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(ci0);
+    const double* i0data = in(0)->get_block_view(ci0);
     for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
       for (int ix5 = 0; ix5 != x5.size(); ++ix5) {
         for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
@@ -4380,7 +4380,7 @@ void Task37::Task_local::compute() {
     }
   }
   if (x0 == x5 && x1 == x2) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x3, x4);
+    const double* i0data = in(1)->get_block_view(ci0, x3, x4);
     for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
       for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
         for (int ix5 = 0; ix5 != x5.size(); ++ix5) {
@@ -4395,7 +4395,7 @@ void Task37::Task_local::compute() {
     }
   }
   if (x3 == x4 && x0 == x5) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x1, x2);
+    const double* i0data = in(1)->get_block_view(ci0, x1, x2);
     for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
       for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
         for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
@@ -4410,7 +4410,7 @@ void Task37::Task_local::compute() {
     }
   }
   if (x0 == x5) {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(ci0, x1, x4, x3, x2);
+    const double* i0data = in(2)->get_block_view(ci0, x1, x4, x3, x2);
     for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
       for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
         for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
@@ -4427,7 +4427,7 @@ void Task37::Task_local::compute() {
     }
   }
   if (x3 == x4 && x1 == x2) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x0, x5);
+    const double* i0data = in(1)->get_block_view(ci0, x0, x5);
     for (int ix5 = 0; ix5 != x5.size(); ++ix5) {
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
@@ -4442,7 +4442,7 @@ void Task37::Task_local::compute() {
     }
   }
   if (x3 == x5 && x1 == x2) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x0, x4);
+    const double* i0data = in(1)->get_block_view(ci0, x0, x4);
     for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix5 = 0; ix5 != x5.size(); ++ix5) {
@@ -4457,7 +4457,7 @@ void Task37::Task_local::compute() {
     }
   }
   if (x1 == x2) {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(ci0, x0, x5, x3, x4);
+    const double* i0data = in(2)->get_block_view(ci0, x0, x5, x3, x4);
     for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
       for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
         for (int ix5 = 0; ix5 != x5.size(); ++ix5) {
@@ -4474,7 +4474,7 @@ void Task37::Task_local::compute() {
     }
   }
   if (x3 == x5 && x1 == x4) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x0, x2);
+    const double* i0data = in(1)->get_block_view(ci0, x0, x2);
     for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix5 = 0; ix5 != x5.size(); ++ix5) {
@@ -4489,7 +4489,7 @@ void Task37::Task_local::compute() {
     }
   }
   if (x1 == x4) {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(ci0, x0, x5, x3, x2);
+    const double* i0data = in(2)->get_block_view(ci0, x0, x5, x3, x2);
     for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
       for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
         for (int ix5 = 0; ix5 != x5.size(); ++ix5) {
@@ -4506,7 +4506,7 @@ void Task37::Task_local::compute() {
     }
   }
   if (x3 == x4 && x1 == x5) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x0, x2);
+    const double* i0data = in(1)->get_block_view(ci0, x0, x2);
     for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
@@ -4521,7 +4521,7 @@ void Task37::Task_local::compute() {
     }
   }
   if (x1 == x5) {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(ci0, x0, x4, x3, x2);
+    const double* i0data = in(2)->get_block_view(ci0, x0, x4, x3, x2);
     for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
       for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
         for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
@@ -4538,7 +4538,7 @@ void Task37::Task_local::compute() {
     }
   }
   if (x3 == x4) {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(ci0, x0, x5, x1, x2);
+    const double* i0data = in(2)->get_block_view(ci0, x0, x5, x1, x2);
     for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
       for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
         for (int ix5 = 0; ix5 != x5.size(); ++ix5) {
@@ -4555,7 +4555,7 @@ void Task37::Task_local::compute() {
     }
   }
   if (x3 == x5) {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(ci0, x1, x4, x0, x2);
+    const double* i0data = in(2)->get_block_view(ci0, x1, x4, x0, x2);
     for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
@@ -4572,7 +4572,7 @@ void Task37::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(3)->get_block(ci0, x0, x5, x1, x4, x3, x2);
+    const double* i0data = in(3)->get_block_view(ci0, x0, x5, x1, x4, x3, x2);
     for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
       for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
         for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
@@ -4604,7 +4604,7 @@ void Task38::Task_local::compute() {
   {
     // rdm0 non-merged ci derivative case
     if (x1 == x3 && x0 == x2) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0);
+      const double* i0data = in(0)->get_block_view(ci0);
       for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
           for (int ici0 = 0; ici0 != ci0.size(); ++ici0) {
@@ -4616,7 +4616,7 @@ void Task38::Task_local::compute() {
   }
   {
     if (x0 == x2) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x1, x3);
+      const double* i0data = in(1)->get_block_view(ci0, x1, x3);
       for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
         for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
           for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
@@ -4632,7 +4632,7 @@ void Task38::Task_local::compute() {
   {
     // rdm0 non-merged ci derivative case
     if (x1 == x2 && x0 == x3) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0);
+      const double* i0data = in(0)->get_block_view(ci0);
       for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
           for (int ici0 = 0; ici0 != ci0.size(); ++ici0) {
@@ -4644,7 +4644,7 @@ void Task38::Task_local::compute() {
   }
   {
     if (x0 == x3) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x1, x2);
+      const double* i0data = in(1)->get_block_view(ci0, x1, x2);
       for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
         for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
           for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
@@ -4659,7 +4659,7 @@ void Task38::Task_local::compute() {
   }
   {
     if (x1 == x2) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x0, x3);
+      const double* i0data = in(1)->get_block_view(ci0, x0, x3);
       for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
           for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
@@ -4674,7 +4674,7 @@ void Task38::Task_local::compute() {
   }
   {
     if (x1 == x3) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x0, x2);
+      const double* i0data = in(1)->get_block_view(ci0, x0, x2);
       for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
           for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
@@ -4688,8 +4688,8 @@ void Task38::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(ci0, x0, x3, x1, x2);
-    sort_indices<0,1,2,3,4,1,1,1,1>(i0data, odata, ci0.size(), x0.size(), x3.size(), x1.size(), x2.size());
+    const double* i0data = in(2)->get_block_view(ci0, x0, x3, x1, x2);
+    sort_indices<0,1,2,3,4,1,1,1,1>(i0data, odata.get(), ci0.size(), x0.size(), x3.size(), x1.size(), x2.size());
   }
   out()->put_block(odata, ci0, x0, x3, x1, x2);
 }
@@ -4706,7 +4706,7 @@ void Task39::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(ci0, x5, x4, x0, x3, x1, x2);
   {
     if (x1 == x3 && x0 == x2) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x5, x4);
+      const double* i0data = in(0)->get_block_view(ci0, x5, x4);
       for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
           for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
@@ -4723,7 +4723,7 @@ void Task39::Task_local::compute() {
   }
   {
     if (x1 == x4 && x0 == x2) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x5, x3);
+      const double* i0data = in(0)->get_block_view(ci0, x5, x3);
       for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
           for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
@@ -4740,7 +4740,7 @@ void Task39::Task_local::compute() {
   }
   {
     if (x0 == x2) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x5, x4, x1, x3);
+      const double* i0data = in(1)->get_block_view(ci0, x5, x4, x1, x3);
       for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
         for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
           for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
@@ -4759,7 +4759,7 @@ void Task39::Task_local::compute() {
   }
   {
     if (x1 == x2 && x0 == x3) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x5, x4);
+      const double* i0data = in(0)->get_block_view(ci0, x5, x4);
       for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
           for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
@@ -4776,7 +4776,7 @@ void Task39::Task_local::compute() {
   }
   {
     if (x1 == x4 && x0 == x3) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x5, x2);
+      const double* i0data = in(0)->get_block_view(ci0, x5, x2);
       for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
           for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
@@ -4793,7 +4793,7 @@ void Task39::Task_local::compute() {
   }
   {
     if (x0 == x3) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x5, x4, x1, x2);
+      const double* i0data = in(1)->get_block_view(ci0, x5, x4, x1, x2);
       for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
         for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
           for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
@@ -4812,7 +4812,7 @@ void Task39::Task_local::compute() {
   }
   {
     if (x1 == x2 && x0 == x4) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x5, x3);
+      const double* i0data = in(0)->get_block_view(ci0, x5, x3);
       for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
           for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
@@ -4829,7 +4829,7 @@ void Task39::Task_local::compute() {
   }
   {
     if (x1 == x3 && x0 == x4) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x5, x2);
+      const double* i0data = in(0)->get_block_view(ci0, x5, x2);
       for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
           for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
@@ -4846,7 +4846,7 @@ void Task39::Task_local::compute() {
   }
   {
     if (x0 == x4) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x5, x3, x1, x2);
+      const double* i0data = in(1)->get_block_view(ci0, x5, x3, x1, x2);
       for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
         for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
           for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
@@ -4865,7 +4865,7 @@ void Task39::Task_local::compute() {
   }
   {
     if (x1 == x2) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x5, x4, x0, x3);
+      const double* i0data = in(1)->get_block_view(ci0, x5, x4, x0, x3);
       for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
           for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
@@ -4884,7 +4884,7 @@ void Task39::Task_local::compute() {
   }
   {
     if (x1 == x3) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x5, x4, x0, x2);
+      const double* i0data = in(1)->get_block_view(ci0, x5, x4, x0, x2);
       for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
           for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
@@ -4903,7 +4903,7 @@ void Task39::Task_local::compute() {
   }
   {
     if (x1 == x4) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x5, x2, x0, x3);
+      const double* i0data = in(1)->get_block_view(ci0, x5, x2, x0, x3);
       for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
           for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
@@ -4921,8 +4921,8 @@ void Task39::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(ci0, x5, x4, x0, x3, x1, x2);
-    sort_indices<0,1,2,3,4,5,6,1,1,1,1>(i0data, odata, ci0.size(), x5.size(), x4.size(), x0.size(), x3.size(), x1.size(), x2.size());
+    const double* i0data = in(2)->get_block_view(ci0, x5, x4, x0, x3, x1, x2);
+    sort_indices<0,1,2,3,4,5,6,1,1,1,1>(i0data, odata.get(), ci0.size(), x5.size(), x4.size(), x0.size(), x3.size(), x1.size(), x2.size());
   }
   out()->put_block(odata, ci0, x5, x4, x0, x3, x1, x2);
 }
@@ -4938,7 +4938,7 @@ void Task40::Task_local::compute() {
   {
     // rdm0 non-merged ci derivative case
     if (x1 == x3 && x0 == x2) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0);
+      const double* i0data = in(0)->get_block_view(ci0);
       for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
           for (int ici0 = 0; ici0 != ci0.size(); ++ici0) {
@@ -4950,7 +4950,7 @@ void Task40::Task_local::compute() {
   }
   {
     if (x0 == x2) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x1, x3);
+      const double* i0data = in(1)->get_block_view(ci0, x1, x3);
       for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
           for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
@@ -4966,7 +4966,7 @@ void Task40::Task_local::compute() {
   {
     // rdm0 non-merged ci derivative case
     if (x1 == x2 && x0 == x3) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0);
+      const double* i0data = in(0)->get_block_view(ci0);
       for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
           for (int ici0 = 0; ici0 != ci0.size(); ++ici0) {
@@ -4978,7 +4978,7 @@ void Task40::Task_local::compute() {
   }
   {
     if (x0 == x3) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x1, x2);
+      const double* i0data = in(1)->get_block_view(ci0, x1, x2);
       for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
           for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
@@ -4993,7 +4993,7 @@ void Task40::Task_local::compute() {
   }
   {
     if (x1 == x2) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x0, x3);
+      const double* i0data = in(1)->get_block_view(ci0, x0, x3);
       for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
         for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
           for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
@@ -5008,7 +5008,7 @@ void Task40::Task_local::compute() {
   }
   {
     if (x1 == x3) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x0, x2);
+      const double* i0data = in(1)->get_block_view(ci0, x0, x2);
       for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
         for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
           for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
@@ -5022,8 +5022,8 @@ void Task40::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(ci0, x1, x3, x0, x2);
-    sort_indices<0,1,2,3,4,1,1,-1,1>(i0data, odata, ci0.size(), x1.size(), x3.size(), x0.size(), x2.size());
+    const double* i0data = in(2)->get_block_view(ci0, x1, x3, x0, x2);
+    sort_indices<0,1,2,3,4,1,1,-1,1>(i0data, odata.get(), ci0.size(), x1.size(), x3.size(), x0.size(), x2.size());
   }
   out()->put_block(odata, ci0, x1, x3, x0, x2);
 }
@@ -5040,7 +5040,7 @@ void Task41::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(ci0, x2, x5, x3, x4, x1, x0);
   {
     if (x2 == x5 && x1 == x4) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x3, x0);
+      const double* i0data = in(0)->get_block_view(ci0, x3, x0);
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
           for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
@@ -5057,7 +5057,7 @@ void Task41::Task_local::compute() {
   }
   {
     if (x2 == x4 && x1 == x5) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x3, x0);
+      const double* i0data = in(0)->get_block_view(ci0, x3, x0);
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
           for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
@@ -5074,7 +5074,7 @@ void Task41::Task_local::compute() {
   }
   {
     if (x3 == x5 && x1 == x4) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x2, x0);
+      const double* i0data = in(0)->get_block_view(ci0, x2, x0);
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
           for (int ix5 = 0; ix5 != x5.size(); ++ix5) {
@@ -5091,7 +5091,7 @@ void Task41::Task_local::compute() {
   }
   {
     if (x1 == x4) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x2, x5, x3, x0);
+      const double* i0data = in(1)->get_block_view(ci0, x2, x5, x3, x0);
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
           for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
@@ -5110,7 +5110,7 @@ void Task41::Task_local::compute() {
   }
   {
     if (x3 == x4 && x1 == x5) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x2, x0);
+      const double* i0data = in(0)->get_block_view(ci0, x2, x0);
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
           for (int ix5 = 0; ix5 != x5.size(); ++ix5) {
@@ -5127,7 +5127,7 @@ void Task41::Task_local::compute() {
   }
   {
     if (x1 == x5) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x3, x4, x2, x0);
+      const double* i0data = in(1)->get_block_view(ci0, x3, x4, x2, x0);
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
           for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
@@ -5146,7 +5146,7 @@ void Task41::Task_local::compute() {
   }
   {
     if (x3 == x5 && x2 == x4) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x1, x0);
+      const double* i0data = in(0)->get_block_view(ci0, x1, x0);
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
           for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
@@ -5163,7 +5163,7 @@ void Task41::Task_local::compute() {
   }
   {
     if (x2 == x4) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x3, x5, x1, x0);
+      const double* i0data = in(1)->get_block_view(ci0, x3, x5, x1, x0);
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
           for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
@@ -5182,7 +5182,7 @@ void Task41::Task_local::compute() {
   }
   {
     if (x3 == x4 && x2 == x5) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x1, x0);
+      const double* i0data = in(0)->get_block_view(ci0, x1, x0);
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
           for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
@@ -5199,7 +5199,7 @@ void Task41::Task_local::compute() {
   }
   {
     if (x2 == x5) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x3, x4, x1, x0);
+      const double* i0data = in(1)->get_block_view(ci0, x3, x4, x1, x0);
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
           for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
@@ -5218,7 +5218,7 @@ void Task41::Task_local::compute() {
   }
   {
     if (x3 == x4) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x2, x5, x1, x0);
+      const double* i0data = in(1)->get_block_view(ci0, x2, x5, x1, x0);
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
           for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
@@ -5237,7 +5237,7 @@ void Task41::Task_local::compute() {
   }
   {
     if (x3 == x5) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x2, x4, x1, x0);
+      const double* i0data = in(1)->get_block_view(ci0, x2, x4, x1, x0);
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
           for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
@@ -5255,8 +5255,8 @@ void Task41::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(ci0, x2, x5, x3, x4, x1, x0);
-    sort_indices<0,1,2,3,4,5,6,1,1,1,1>(i0data, odata, ci0.size(), x2.size(), x5.size(), x3.size(), x4.size(), x1.size(), x0.size());
+    const double* i0data = in(2)->get_block_view(ci0, x2, x5, x3, x4, x1, x0);
+    sort_indices<0,1,2,3,4,5,6,1,1,1,1>(i0data, odata.get(), ci0.size(), x2.size(), x5.size(), x3.size(), x4.size(), x1.size(), x0.size());
   }
   out()->put_block(odata, ci0, x2, x5, x3, x4, x1, x0);
 }
@@ -5274,9 +5274,9 @@ void Task42::Task_local::compute() {
   // tensor label: Gamma275
   std::unique_ptr<double[]> odata = out()->move_block(ci0, x7, x6, x2, x5, x1, x0);
   // associated with merged
-  std::unique_ptr<double[]> fdata = in(4)->get_block(x4, x3);
+  const double* fdata = in(4)->get_block_view(x4, x3);
   if (x2 == x6 && x1 == x5) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x7, x0, x4, x3);
+    const double* i0data = in(1)->get_block_view(ci0, x7, x0, x4, x3);
     for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
       for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
         for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
@@ -5295,7 +5295,7 @@ void Task42::Task_local::compute() {
     }
   }
   if (x2 == x5 && x1 == x6) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x7, x0, x4, x3);
+    const double* i0data = in(1)->get_block_view(ci0, x7, x0, x4, x3);
     for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
       for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
         for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
@@ -5314,7 +5314,7 @@ void Task42::Task_local::compute() {
     }
   }
   if (x2 == x5 && x1 == x3 && x4 == x6) {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x7, x0);
+    const double* i0data = in(0)->get_block_view(ci0, x7, x0);
     for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
       for (int ix7 = 0; ix7 != x7.size(); ++ix7) {
         for (int ix5 = 0; ix5 != x5.size(); ++ix5) {
@@ -5331,7 +5331,7 @@ void Task42::Task_local::compute() {
     }
   }
   if (x2 == x5 && x1 == x3) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x7, x6, x4, x0);
+    const double* i0data = in(1)->get_block_view(ci0, x7, x6, x4, x0);
     for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
       for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
         for (int ix6 = 0; ix6 != x6.size(); ++ix6) {
@@ -5350,7 +5350,7 @@ void Task42::Task_local::compute() {
     }
   }
   if (x4 == x5 && x2 == x6 && x1 == x3) {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x7, x0);
+    const double* i0data = in(0)->get_block_view(ci0, x7, x0);
     for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
       for (int ix7 = 0; ix7 != x7.size(); ++ix7) {
         for (int ix5 = 0; ix5 != x5.size(); ++ix5) {
@@ -5367,7 +5367,7 @@ void Task42::Task_local::compute() {
     }
   }
   if (x2 == x6 && x1 == x3) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x7, x5, x4, x0);
+    const double* i0data = in(1)->get_block_view(ci0, x7, x5, x4, x0);
     for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
       for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
         for (int ix5 = 0; ix5 != x5.size(); ++ix5) {
@@ -5386,7 +5386,7 @@ void Task42::Task_local::compute() {
     }
   }
   if (x4 == x5 && x1 == x3) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x7, x6, x2, x0);
+    const double* i0data = in(1)->get_block_view(ci0, x7, x6, x2, x0);
     for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
       for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
         for (int ix6 = 0; ix6 != x6.size(); ++ix6) {
@@ -5405,7 +5405,7 @@ void Task42::Task_local::compute() {
     }
   }
   if (x4 == x6 && x1 == x3) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x7, x0, x2, x5);
+    const double* i0data = in(1)->get_block_view(ci0, x7, x0, x2, x5);
     for (int ix5 = 0; ix5 != x5.size(); ++ix5) {
       for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
         for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
@@ -5424,7 +5424,7 @@ void Task42::Task_local::compute() {
     }
   }
   if (x1 == x3) {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(ci0, x7, x6, x2, x5, x4, x0);
+    const double* i0data = in(2)->get_block_view(ci0, x7, x6, x2, x5, x4, x0);
     for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
       for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
         for (int ix5 = 0; ix5 != x5.size(); ++ix5) {
@@ -5445,7 +5445,7 @@ void Task42::Task_local::compute() {
     }
   }
   if (x4 == x6 && x2 == x3 && x1 == x5) {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x7, x0);
+    const double* i0data = in(0)->get_block_view(ci0, x7, x0);
     for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
       for (int ix7 = 0; ix7 != x7.size(); ++ix7) {
         for (int ix6 = 0; ix6 != x6.size(); ++ix6) {
@@ -5462,7 +5462,7 @@ void Task42::Task_local::compute() {
     }
   }
   if (x2 == x3 && x1 == x5) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x7, x6, x4, x0);
+    const double* i0data = in(1)->get_block_view(ci0, x7, x6, x4, x0);
     for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
       for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
         for (int ix6 = 0; ix6 != x6.size(); ++ix6) {
@@ -5481,7 +5481,7 @@ void Task42::Task_local::compute() {
     }
   }
   if (x4 == x6 && x1 == x5) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x7, x3, x2, x0);
+    const double* i0data = in(1)->get_block_view(ci0, x7, x3, x2, x0);
     for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
       for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
@@ -5500,7 +5500,7 @@ void Task42::Task_local::compute() {
     }
   }
   if (x1 == x5) {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(ci0, x7, x6, x4, x3, x2, x0);
+    const double* i0data = in(2)->get_block_view(ci0, x7, x6, x4, x3, x2, x0);
     for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
       for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
@@ -5521,7 +5521,7 @@ void Task42::Task_local::compute() {
     }
   }
   if (x4 == x5 && x2 == x3 && x1 == x6) {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x7, x0);
+    const double* i0data = in(0)->get_block_view(ci0, x7, x0);
     for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
       for (int ix7 = 0; ix7 != x7.size(); ++ix7) {
         for (int ix5 = 0; ix5 != x5.size(); ++ix5) {
@@ -5538,7 +5538,7 @@ void Task42::Task_local::compute() {
     }
   }
   if (x2 == x3 && x1 == x6) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x7, x0, x4, x5);
+    const double* i0data = in(1)->get_block_view(ci0, x7, x0, x4, x5);
     for (int ix5 = 0; ix5 != x5.size(); ++ix5) {
       for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
         for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
@@ -5557,7 +5557,7 @@ void Task42::Task_local::compute() {
     }
   }
   if (x4 == x5 && x1 == x6) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x7, x0, x2, x3);
+    const double* i0data = in(1)->get_block_view(ci0, x7, x0, x2, x3);
     for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
       for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
         for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
@@ -5576,7 +5576,7 @@ void Task42::Task_local::compute() {
     }
   }
   if (x1 == x6) {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(ci0, x7, x0, x2, x5, x4, x3);
+    const double* i0data = in(2)->get_block_view(ci0, x7, x0, x2, x5, x4, x3);
     for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
       for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
         for (int ix5 = 0; ix5 != x5.size(); ++ix5) {
@@ -5597,7 +5597,7 @@ void Task42::Task_local::compute() {
     }
   }
   if (x4 == x5 && x2 == x3) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x7, x6, x1, x0);
+    const double* i0data = in(1)->get_block_view(ci0, x7, x6, x1, x0);
     for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
       for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
         for (int ix6 = 0; ix6 != x6.size(); ++ix6) {
@@ -5616,7 +5616,7 @@ void Task42::Task_local::compute() {
     }
   }
   if (x4 == x6 && x2 == x3) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x7, x5, x1, x0);
+    const double* i0data = in(1)->get_block_view(ci0, x7, x5, x1, x0);
     for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
       for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
         for (int ix5 = 0; ix5 != x5.size(); ++ix5) {
@@ -5635,7 +5635,7 @@ void Task42::Task_local::compute() {
     }
   }
   if (x2 == x3) {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(ci0, x7, x6, x4, x5, x1, x0);
+    const double* i0data = in(2)->get_block_view(ci0, x7, x6, x4, x5, x1, x0);
     for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
       for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
         for (int ix5 = 0; ix5 != x5.size(); ++ix5) {
@@ -5656,7 +5656,7 @@ void Task42::Task_local::compute() {
     }
   }
   if (x4 == x6 && x2 == x5) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x7, x3, x1, x0);
+    const double* i0data = in(1)->get_block_view(ci0, x7, x3, x1, x0);
     for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
       for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
@@ -5675,7 +5675,7 @@ void Task42::Task_local::compute() {
     }
   }
   if (x2 == x5) {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(ci0, x7, x6, x4, x3, x1, x0);
+    const double* i0data = in(2)->get_block_view(ci0, x7, x6, x4, x3, x1, x0);
     for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
       for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
@@ -5696,7 +5696,7 @@ void Task42::Task_local::compute() {
     }
   }
   if (x4 == x5 && x2 == x6) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x7, x3, x1, x0);
+    const double* i0data = in(1)->get_block_view(ci0, x7, x3, x1, x0);
     for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
       for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
@@ -5715,7 +5715,7 @@ void Task42::Task_local::compute() {
     }
   }
   if (x2 == x6) {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(ci0, x7, x5, x4, x3, x1, x0);
+    const double* i0data = in(2)->get_block_view(ci0, x7, x5, x4, x3, x1, x0);
     for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
       for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
@@ -5736,7 +5736,7 @@ void Task42::Task_local::compute() {
     }
   }
   if (x4 == x5) {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(ci0, x7, x6, x2, x3, x1, x0);
+    const double* i0data = in(2)->get_block_view(ci0, x7, x6, x2, x3, x1, x0);
     for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
       for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
@@ -5757,7 +5757,7 @@ void Task42::Task_local::compute() {
     }
   }
   if (x4 == x6) {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(ci0, x7, x3, x2, x5, x1, x0);
+    const double* i0data = in(2)->get_block_view(ci0, x7, x3, x2, x5, x1, x0);
     for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
       for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
         for (int ix5 = 0; ix5 != x5.size(); ++ix5) {
@@ -5778,7 +5778,7 @@ void Task42::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(3)->get_block(ci0, x7, x6, x2, x5, x1, x0);
+    const double* i0data = in(3)->get_block_view(ci0, x7, x6, x2, x5, x1, x0);
     for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
       for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
         for (int ix5 = 0; ix5 != x5.size(); ++ix5) {
@@ -5811,7 +5811,7 @@ void Task43::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(ci0, x5, x4, x2, x3, x1, x0);
   {
     if (x2 == x4 && x1 == x3) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x5, x0);
+      const double* i0data = in(0)->get_block_view(ci0, x5, x0);
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
           for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
@@ -5828,7 +5828,7 @@ void Task43::Task_local::compute() {
   }
   {
     if (x1 == x3) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x5, x4, x2, x0);
+      const double* i0data = in(1)->get_block_view(ci0, x5, x4, x2, x0);
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
           for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
@@ -5847,7 +5847,7 @@ void Task43::Task_local::compute() {
   }
   {
     if (x2 == x3 && x1 == x4) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x5, x0);
+      const double* i0data = in(0)->get_block_view(ci0, x5, x0);
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
           for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
@@ -5864,7 +5864,7 @@ void Task43::Task_local::compute() {
   }
   {
     if (x1 == x4) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x5, x0, x2, x3);
+      const double* i0data = in(1)->get_block_view(ci0, x5, x0, x2, x3);
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
           for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
@@ -5883,7 +5883,7 @@ void Task43::Task_local::compute() {
   }
   {
     if (x2 == x3) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x5, x4, x1, x0);
+      const double* i0data = in(1)->get_block_view(ci0, x5, x4, x1, x0);
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
           for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
@@ -5902,7 +5902,7 @@ void Task43::Task_local::compute() {
   }
   {
     if (x2 == x4) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x5, x3, x1, x0);
+      const double* i0data = in(1)->get_block_view(ci0, x5, x3, x1, x0);
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
           for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
@@ -5920,8 +5920,8 @@ void Task43::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(ci0, x5, x4, x2, x3, x1, x0);
-    sort_indices<0,1,2,3,4,5,6,1,1,-1,1>(i0data, odata, ci0.size(), x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
+    const double* i0data = in(2)->get_block_view(ci0, x5, x4, x2, x3, x1, x0);
+    sort_indices<0,1,2,3,4,5,6,1,1,-1,1>(i0data, odata.get(), ci0.size(), x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
   }
   out()->put_block(odata, ci0, x5, x4, x2, x3, x1, x0);
 }
@@ -5936,7 +5936,7 @@ void Task44::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(ci0, x2, x3, x1, x0);
   {
     if (x1 == x3) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x2, x0);
+      const double* i0data = in(0)->get_block_view(ci0, x2, x0);
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
           for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
@@ -5951,7 +5951,7 @@ void Task44::Task_local::compute() {
   }
   {
     if (x2 == x3) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x1, x0);
+      const double* i0data = in(0)->get_block_view(ci0, x1, x0);
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
           for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
@@ -5965,8 +5965,8 @@ void Task44::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x2, x3, x1, x0);
-    sort_indices<0,1,2,3,4,1,1,-1,1>(i0data, odata, ci0.size(), x2.size(), x3.size(), x1.size(), x0.size());
+    const double* i0data = in(1)->get_block_view(ci0, x2, x3, x1, x0);
+    sort_indices<0,1,2,3,4,1,1,-1,1>(i0data, odata.get(), ci0.size(), x2.size(), x3.size(), x1.size(), x0.size());
   }
   out()->put_block(odata, ci0, x2, x3, x1, x0);
 }
@@ -5983,7 +5983,7 @@ void Task45::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(ci0, x5, x3, x2, x4, x1, x0);
   {
     if (x2 == x4 && x1 == x3) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x5, x0);
+      const double* i0data = in(0)->get_block_view(ci0, x5, x0);
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
           for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
@@ -6000,7 +6000,7 @@ void Task45::Task_local::compute() {
   }
   {
     if (x1 == x3) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x5, x0, x2, x4);
+      const double* i0data = in(1)->get_block_view(ci0, x5, x0, x2, x4);
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
           for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
@@ -6019,7 +6019,7 @@ void Task45::Task_local::compute() {
   }
   {
     if (x2 == x3 && x1 == x4) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x5, x0);
+      const double* i0data = in(0)->get_block_view(ci0, x5, x0);
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
           for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
@@ -6036,7 +6036,7 @@ void Task45::Task_local::compute() {
   }
   {
     if (x1 == x4) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x5, x3, x2, x0);
+      const double* i0data = in(1)->get_block_view(ci0, x5, x3, x2, x0);
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
           for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
@@ -6055,7 +6055,7 @@ void Task45::Task_local::compute() {
   }
   {
     if (x2 == x3) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x5, x4, x1, x0);
+      const double* i0data = in(1)->get_block_view(ci0, x5, x4, x1, x0);
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
           for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
@@ -6074,7 +6074,7 @@ void Task45::Task_local::compute() {
   }
   {
     if (x2 == x4) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x5, x3, x1, x0);
+      const double* i0data = in(1)->get_block_view(ci0, x5, x3, x1, x0);
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
           for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
@@ -6092,8 +6092,8 @@ void Task45::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(ci0, x5, x3, x2, x4, x1, x0);
-    sort_indices<0,1,2,3,4,5,6,1,1,1,1>(i0data, odata, ci0.size(), x5.size(), x3.size(), x2.size(), x4.size(), x1.size(), x0.size());
+    const double* i0data = in(2)->get_block_view(ci0, x5, x3, x2, x4, x1, x0);
+    sort_indices<0,1,2,3,4,5,6,1,1,1,1>(i0data, odata.get(), ci0.size(), x5.size(), x3.size(), x2.size(), x4.size(), x1.size(), x0.size());
   }
   out()->put_block(odata, ci0, x5, x3, x2, x4, x1, x0);
 }
@@ -6108,7 +6108,7 @@ void Task46::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(ci0, x3, x2, x0, x1);
   {
     if (x0 == x1) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x3, x2);
+      const double* i0data = in(0)->get_block_view(ci0, x3, x2);
       for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
         for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
           for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
@@ -6123,7 +6123,7 @@ void Task46::Task_local::compute() {
   }
   {
     if (x0 == x2) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x3, x1);
+      const double* i0data = in(0)->get_block_view(ci0, x3, x1);
       for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
         for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
           for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
@@ -6137,8 +6137,8 @@ void Task46::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x3, x2, x0, x1);
-    sort_indices<0,1,2,3,4,1,1,-1,1>(i0data, odata, ci0.size(), x3.size(), x2.size(), x0.size(), x1.size());
+    const double* i0data = in(1)->get_block_view(ci0, x3, x2, x0, x1);
+    sort_indices<0,1,2,3,4,1,1,-1,1>(i0data, odata.get(), ci0.size(), x3.size(), x2.size(), x0.size(), x1.size());
   }
   out()->put_block(odata, ci0, x3, x2, x0, x1);
 }
@@ -6152,9 +6152,9 @@ void Task47::Task_local::compute() {
   // tensor label: Gamma284
   std::unique_ptr<double[]> odata = out()->move_block(ci0, x0, x3);
   // associated with merged
-  std::unique_ptr<double[]> fdata = in(3)->get_block(x2, x1);
+  const double* fdata = in(3)->get_block_view(x2, x1);
   if (x0 == x3) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x2, x1);
+    const double* i0data = in(1)->get_block_view(ci0, x2, x1);
     for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
       for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
@@ -6168,7 +6168,7 @@ void Task47::Task_local::compute() {
   }
   // rdm0 merged ci derivative case
   if (x2 == x3 && x0 == x1) {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(ci0);
+    const double* i0data = in(0)->get_block_view(ci0);
     for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
       for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
         for (int ici0 = 0; ici0 != ci0.size(); ++ici0) {
@@ -6178,7 +6178,7 @@ void Task47::Task_local::compute() {
     }
   }
   if (x0 == x1) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x2, x3);
+    const double* i0data = in(1)->get_block_view(ci0, x2, x3);
     for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
       for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
         for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
@@ -6191,7 +6191,7 @@ void Task47::Task_local::compute() {
     }
   }
   if (x2 == x3) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x0, x1);
+    const double* i0data = in(1)->get_block_view(ci0, x0, x1);
     for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
@@ -6204,7 +6204,7 @@ void Task47::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(ci0, x0, x3, x2, x1);
+    const double* i0data = in(2)->get_block_view(ci0, x0, x3, x2, x1);
     for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
       for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
@@ -6230,7 +6230,7 @@ void Task48::Task_local::compute() {
   {
     // rdm0 non-merged ci derivative case
     if (x0 == x1) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0);
+      const double* i0data = in(0)->get_block_view(ci0);
       for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
         for (int ici0 = 0; ici0 != ci0.size(); ++ici0) {
           odata[ici0+ci0.size()*(ix1+x0.size()*(ix1))]  += (2.0) * i0data[ici0];
@@ -6239,8 +6239,8 @@ void Task48::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x0, x1);
-    sort_indices<0,1,2,1,1,-1,1>(i0data, odata, ci0.size(), x0.size(), x1.size());
+    const double* i0data = in(1)->get_block_view(ci0, x0, x1);
+    sort_indices<0,1,2,1,1,-1,1>(i0data, odata.get(), ci0.size(), x0.size(), x1.size());
   }
   out()->put_block(odata, ci0, x0, x1);
 }
@@ -6255,7 +6255,7 @@ void Task49::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(ci0, x3, x1, x0, x2);
   {
     if (x0 == x1) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x3, x2);
+      const double* i0data = in(0)->get_block_view(ci0, x3, x2);
       for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
         for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
           for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
@@ -6270,7 +6270,7 @@ void Task49::Task_local::compute() {
   }
   {
     if (x0 == x2) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x3, x1);
+      const double* i0data = in(0)->get_block_view(ci0, x3, x1);
       for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
         for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
           for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
@@ -6284,8 +6284,8 @@ void Task49::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x3, x1, x0, x2);
-    sort_indices<0,1,2,3,4,1,1,1,1>(i0data, odata, ci0.size(), x3.size(), x1.size(), x0.size(), x2.size());
+    const double* i0data = in(1)->get_block_view(ci0, x3, x1, x0, x2);
+    sort_indices<0,1,2,3,4,1,1,1,1>(i0data, odata.get(), ci0.size(), x3.size(), x1.size(), x0.size(), x2.size());
   }
   out()->put_block(odata, ci0, x3, x1, x0, x2);
 }
@@ -38,26 +38,26 @@ void Task500::Task_local::compute() {
   const Index x3 = b(1);
   // tensor label: I628
   std::unique_ptr<double[]> odata = out()->move_block(a1, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(a1, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x3), 0.0);
   for (auto& x0 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma60
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+        const double* i0data = in(0)->get_block_view(x3, x0, x2, x1);
+        BlockBuffer i0data_sorted(in(0)->get_size(x3, x0, x2, x1));
+        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x0.size(), x2.size(), x1.size());
         // tensor label: I629
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x2, x1, a1, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, x1, a1, x0)]);
-        sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, x2.size(), x1.size(), a1.size(), x0.size());
+        const double* i1data = in(1)->get_block_view(x2, x1, a1, x0);
+        BlockBuffer i1data_sorted(in(1)->get_size(x2, x1, a1, x0));
+        sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), x1.size(), a1.size(), x0.size());
         dgemm_("T", "N", x3.size(), a1.size(), x2.size()*x1.size()*x0.size(),
-               1.0, i0data_sorted, x2.size()*x1.size()*x0.size(), i1data_sorted, x2.size()*x1.size()*x0.size(),
-               1.0, odata_sorted, x3.size());
+               1.0, i0data_sorted.get(), x2.size()*x1.size()*x0.size(), i1data_sorted.get(), x2.size()*x1.size()*x0.size(),
+               1.0, odata_sorted.get(), x3.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x3.size(), a1.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), a1.size());
   out()->put_block(odata, a1, x3);
 }
 
@@ -70,8 +70,8 @@ void Task501::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x2, x1, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, x1, x2);
-    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata, x0.size(), a1.size(), x1.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, x1, x2);
+    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata.get(), x0.size(), a1.size(), x1.size(), x2.size());
   }
   out()->put_block(odata, x2, x1, a1, x0);
 }
@@ -83,8 +83,8 @@ void Task502::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x3, a2);
   {
     // tensor label: I471
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a2);
-    sort_indices<0,1,1,1,1,1>(i0data, odata, x3.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(x3, a2);
+    sort_indices<0,1,1,1,1,1>(i0data, odata.get(), x3.size(), a2.size());
   }
   out()->put_block(odata, x3, a2);
 }
@@ -94,26 +94,26 @@ void Task503::Task_local::compute() {
   const Index a2 = b(1);
   // tensor label: I471
   std::unique_ptr<double[]> odata = out()->move_block(x3, a2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, a2)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, a2));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, a2), 0.0);
   for (auto& x5 : *range_[1]) {
     for (auto& c1 : *range_[0]) {
       for (auto& x4 : *range_[1]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a2, c1, x4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a2, c1, x4)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x5.size(), a2.size(), c1.size(), x4.size());
+        const double* i0data = in(0)->get_block_view(x5, a2, c1, x4);
+        BlockBuffer i0data_sorted(in(0)->get_size(x5, a2, c1, x4));
+        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), a2.size(), c1.size(), x4.size());
         // tensor label: I472
-        std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x5, x3, x4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x5, x3, x4)]);
-        sort_indices<1,0,3,2,0,1,1,1>(i1data, i1data_sorted, c1.size(), x5.size(), x3.size(), x4.size());
+        const double* i1data = in(1)->get_block_view(c1, x5, x3, x4);
+        BlockBuffer i1data_sorted(in(1)->get_size(c1, x5, x3, x4));
+        sort_indices<1,0,3,2,0,1,1,1>(i1data, i1data_sorted.get(), c1.size(), x5.size(), x3.size(), x4.size());
         dgemm_("T", "N", a2.size(), x3.size(), c1.size()*x5.size()*x4.size(),
-               1.0, i0data_sorted, c1.size()*x5.size()*x4.size(), i1data_sorted, c1.size()*x5.size()*x4.size(),
-               1.0, odata_sorted, a2.size());
+               1.0, i0data_sorted.get(), c1.size()*x5.size()*x4.size(), i1data_sorted.get(), c1.size()*x5.size()*x4.size(),
+               1.0, odata_sorted.get(), a2.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a2.size(), x3.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), a2.size(), x3.size());
   out()->put_block(odata, x3, a2);
 }
 
@@ -124,26 +124,26 @@ void Task504::Task_local::compute() {
   const Index x4 = b(3);
   // tensor label: I472
   std::unique_ptr<double[]> odata = out()->move_block(c1, x5, x3, x4);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x5, x3, x4)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, x5, x3, x4));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x5, x3, x4), 0.0);
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       for (auto& x0 : *range_[1]) {
         // tensor label: Gamma9
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x3, x2, x4, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x3, x2, x4, x1, x0)]);
-        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x3.size(), x2.size(), x4.size(), x1.size(), x0.size());
+        const double* i0data = in(0)->get_block_view(x5, x3, x2, x4, x1, x0);
+        BlockBuffer i0data_sorted(in(0)->get_size(x5, x3, x2, x4, x1, x0));
+        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), x3.size(), x2.size(), x4.size(), x1.size(), x0.size());
         // tensor label: I473
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c1, x1, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c1, x1, x0)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted, x2.size(), c1.size(), x1.size(), x0.size());
+        const double* i1data = in(1)->get_block_view(x2, c1, x1, x0);
+        BlockBuffer i1data_sorted(in(1)->get_size(x2, c1, x1, x0));
+        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), c1.size(), x1.size(), x0.size());
         dgemm_("T", "N", x5.size()*x3.size()*x4.size(), c1.size(), x2.size()*x1.size()*x0.size(),
-               1.0, i0data_sorted, x2.size()*x1.size()*x0.size(), i1data_sorted, x2.size()*x1.size()*x0.size(),
-               1.0, odata_sorted, x5.size()*x3.size()*x4.size());
+               1.0, i0data_sorted.get(), x2.size()*x1.size()*x0.size(), i1data_sorted.get(), x2.size()*x1.size()*x0.size(),
+               1.0, odata_sorted.get(), x5.size()*x3.size()*x4.size());
       }
     }
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x3.size(), x4.size(), c1.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x5.size(), x3.size(), x4.size(), c1.size());
   out()->put_block(odata, c1, x5, x3, x4);
 }
 
@@ -156,8 +156,8 @@ void Task505::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x2, c1, x1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1, c1, x2);
-    sort_indices<3,2,1,0,1,1,-1,1>(i0data, odata, x0.size(), x1.size(), c1.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x0, x1, c1, x2);
+    sort_indices<3,2,1,0,1,1,-1,1>(i0data, odata.get(), x0.size(), x1.size(), c1.size(), x2.size());
   }
   out()->put_block(odata, x2, c1, x1, x0);
 }
@@ -167,26 +167,26 @@ void Task506::Task_local::compute() {
   const Index a2 = b(1);
   // tensor label: I471
   std::unique_ptr<double[]> odata = out()->move_block(x3, a2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, a2)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, a2));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, a2), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& x5 : *range_[1]) {
       for (auto& x4 : *range_[1]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x5, x4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, x5, x4)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), x5.size(), x4.size());
+        const double* i0data = in(0)->get_block_view(c1, a2, x5, x4);
+        BlockBuffer i0data_sorted(in(0)->get_size(c1, a2, x5, x4));
+        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size(), x5.size(), x4.size());
         // tensor label: I475
-        std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x5, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x5, x4, x3)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, c1.size(), x5.size(), x4.size(), x3.size());
+        const double* i1data = in(1)->get_block_view(c1, x5, x4, x3);
+        BlockBuffer i1data_sorted(in(1)->get_size(c1, x5, x4, x3));
+        sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted.get(), c1.size(), x5.size(), x4.size(), x3.size());
         dgemm_("T", "N", a2.size(), x3.size(), c1.size()*x5.size()*x4.size(),
-               1.0, i0data_sorted, c1.size()*x5.size()*x4.size(), i1data_sorted, c1.size()*x5.size()*x4.size(),
-               1.0, odata_sorted, a2.size());
+               1.0, i0data_sorted.get(), c1.size()*x5.size()*x4.size(), i1data_sorted.get(), c1.size()*x5.size()*x4.size(),
+               1.0, odata_sorted.get(), a2.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a2.size(), x3.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), a2.size(), x3.size());
   out()->put_block(odata, x3, a2);
 }
 
@@ -197,26 +197,26 @@ void Task507::Task_local::compute() {
   const Index x3 = b(3);
   // tensor label: I475
   std::unique_ptr<double[]> odata = out()->move_block(c1, x5, x4, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x5, x4, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, x5, x4, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x5, x4, x3), 0.0);
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       for (auto& x0 : *range_[1]) {
         // tensor label: Gamma6
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x2, x3, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x2, x3, x1, x0)]);
-        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
+        const double* i0data = in(0)->get_block_view(x5, x4, x2, x3, x1, x0);
+        BlockBuffer i0data_sorted(in(0)->get_size(x5, x4, x2, x3, x1, x0));
+        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
         // tensor label: I476
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c1, x1, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c1, x1, x0)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted, x2.size(), c1.size(), x1.size(), x0.size());
+        const double* i1data = in(1)->get_block_view(x2, c1, x1, x0);
+        BlockBuffer i1data_sorted(in(1)->get_size(x2, c1, x1, x0));
+        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), c1.size(), x1.size(), x0.size());
         dgemm_("T", "N", x5.size()*x4.size()*x3.size(), c1.size(), x2.size()*x1.size()*x0.size(),
-               1.0, i0data_sorted, x2.size()*x1.size()*x0.size(), i1data_sorted, x2.size()*x1.size()*x0.size(),
-               1.0, odata_sorted, x5.size()*x4.size()*x3.size());
+               1.0, i0data_sorted.get(), x2.size()*x1.size()*x0.size(), i1data_sorted.get(), x2.size()*x1.size()*x0.size(),
+               1.0, odata_sorted.get(), x5.size()*x4.size()*x3.size());
       }
     }
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), c1.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x5.size(), x4.size(), x3.size(), c1.size());
   out()->put_block(odata, c1, x5, x4, x3);
 }
 
@@ -229,8 +229,8 @@ void Task508::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x2, c1, x1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1, c1, x2);
-    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata, x0.size(), x1.size(), c1.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x0, x1, c1, x2);
+    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata.get(), x0.size(), x1.size(), c1.size(), x2.size());
   }
   out()->put_block(odata, x2, c1, x1, x0);
 }
@@ -240,26 +240,26 @@ void Task509::Task_local::compute() {
   const Index a2 = b(1);
   // tensor label: I471
   std::unique_ptr<double[]> odata = out()->move_block(x3, a2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, a2)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, a2));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, a2), 0.0);
   for (auto& x5 : *range_[1]) {
     for (auto& a1 : *range_[2]) {
       for (auto& x4 : *range_[1]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, x4, a2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a1, x4, a2)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), a1.size(), x4.size(), a2.size());
+        const double* i0data = in(0)->get_block_view(x5, a1, x4, a2);
+        BlockBuffer i0data_sorted(in(0)->get_size(x5, a1, x4, a2));
+        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), a1.size(), x4.size(), a2.size());
         // tensor label: I631
-        std::unique_ptr<double[]> i1data = in(1)->get_block(a1, x5, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, x5, x4, x3)]);
-        sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, a1.size(), x5.size(), x4.size(), x3.size());
+        const double* i1data = in(1)->get_block_view(a1, x5, x4, x3);
+        BlockBuffer i1data_sorted(in(1)->get_size(a1, x5, x4, x3));
+        sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted.get(), a1.size(), x5.size(), x4.size(), x3.size());
         dgemm_("T", "N", a2.size(), x3.size(), a1.size()*x5.size()*x4.size(),
-               1.0, i0data_sorted, a1.size()*x5.size()*x4.size(), i1data_sorted, a1.size()*x5.size()*x4.size(),
-               1.0, odata_sorted, a2.size());
+               1.0, i0data_sorted.get(), a1.size()*x5.size()*x4.size(), i1data_sorted.get(), a1.size()*x5.size()*x4.size(),
+               1.0, odata_sorted.get(), a2.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a2.size(), x3.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), a2.size(), x3.size());
   out()->put_block(odata, x3, a2);
 }
 
@@ -270,26 +270,26 @@ void Task510::Task_local::compute() {
   const Index x3 = b(3);
   // tensor label: I631
   std::unique_ptr<double[]> odata = out()->move_block(a1, x5, x4, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x5, x4, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(a1, x5, x4, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x5, x4, x3), 0.0);
   for (auto& x0 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma59
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x3, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x3, x2, x1)]);
-        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
+        const double* i0data = in(0)->get_block_view(x5, x0, x4, x3, x2, x1);
+        BlockBuffer i0data_sorted(in(0)->get_size(x5, x0, x4, x3, x2, x1));
+        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
         // tensor label: I632
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x2, x1, a1, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, x1, a1, x0)]);
-        sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, x2.size(), x1.size(), a1.size(), x0.size());
+        const double* i1data = in(1)->get_block_view(x2, x1, a1, x0);
+        BlockBuffer i1data_sorted(in(1)->get_size(x2, x1, a1, x0));
+        sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), x1.size(), a1.size(), x0.size());
         dgemm_("T", "N", x5.size()*x4.size()*x3.size(), a1.size(), x2.size()*x1.size()*x0.size(),
-               1.0, i0data_sorted, x2.size()*x1.size()*x0.size(), i1data_sorted, x2.size()*x1.size()*x0.size(),
-               1.0, odata_sorted, x5.size()*x4.size()*x3.size());
+               1.0, i0data_sorted.get(), x2.size()*x1.size()*x0.size(), i1data_sorted.get(), x2.size()*x1.size()*x0.size(),
+               1.0, odata_sorted.get(), x5.size()*x4.size()*x3.size());
       }
     }
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), a1.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x5.size(), x4.size(), x3.size(), a1.size());
   out()->put_block(odata, a1, x5, x4, x3);
 }
 
@@ -302,8 +302,8 @@ void Task511::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x2, x1, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, x1, x2);
-    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata, x0.size(), a1.size(), x1.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, x1, x2);
+    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata.get(), x0.size(), a1.size(), x1.size(), x2.size());
   }
   out()->put_block(odata, x2, x1, a1, x0);
 }
@@ -315,8 +315,8 @@ void Task512::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a2, x1);
   {
     // tensor label: I477
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a2);
-    sort_indices<1,0,1,1,1,1>(i0data, odata, x1.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(x1, a2);
+    sort_indices<1,0,1,1,1,1>(i0data, odata.get(), x1.size(), a2.size());
   }
   out()->put_block(odata, a2, x1);
 }
@@ -326,26 +326,26 @@ void Task513::Task_local::compute() {
   const Index a2 = b(1);
   // tensor label: I477
   std::unique_ptr<double[]> odata = out()->move_block(x1, a2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, a2)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, a2));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, a2), 0.0);
   for (auto& x0 : *range_[1]) {
     for (auto& c3 : *range_[0]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, x0)]);
-        sort_indices<3,2,0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
+        const double* i0data = in(0)->get_block_view(c1, a2, c3, x0);
+        BlockBuffer i0data_sorted(in(0)->get_size(c1, a2, c3, x0));
+        sort_indices<3,2,0,1,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size(), c3.size(), x0.size());
         // tensor label: I478
-        std::unique_ptr<double[]> i1data = in(1)->get_block(c1, c3, x1, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, c3, x1, x0)]);
-        sort_indices<3,1,0,2,0,1,1,1>(i1data, i1data_sorted, c1.size(), c3.size(), x1.size(), x0.size());
+        const double* i1data = in(1)->get_block_view(c1, c3, x1, x0);
+        BlockBuffer i1data_sorted(in(1)->get_size(c1, c3, x1, x0));
+        sort_indices<3,1,0,2,0,1,1,1>(i1data, i1data_sorted.get(), c1.size(), c3.size(), x1.size(), x0.size());
         dgemm_("T", "N", a2.size(), x1.size(), c1.size()*c3.size()*x0.size(),
-               1.0, i0data_sorted, c1.size()*c3.size()*x0.size(), i1data_sorted, c1.size()*c3.size()*x0.size(),
-               1.0, odata_sorted, a2.size());
+               1.0, i0data_sorted.get(), c1.size()*c3.size()*x0.size(), i1data_sorted.get(), c1.size()*c3.size()*x0.size(),
+               1.0, odata_sorted.get(), a2.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a2.size(), x1.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), a2.size(), x1.size());
   out()->put_block(odata, x1, a2);
 }
 
@@ -356,24 +356,24 @@ void Task514::Task_local::compute() {
   const Index x0 = b(3);
   // tensor label: I478
   std::unique_ptr<double[]> odata = out()->move_block(c1, c3, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, c3, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x1, x0), 0.0);
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma3
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x3, x0, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x3, x0, x2)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x1.size(), x3.size(), x0.size(), x2.size());
+      const double* i0data = in(0)->get_block_view(x1, x3, x0, x2);
+      BlockBuffer i0data_sorted(in(0)->get_size(x1, x3, x0, x2));
+      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), x3.size(), x0.size(), x2.size());
       // tensor label: I479
-      std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x3, c3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x3, c3, x2)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i1data, i1data_sorted, c1.size(), x3.size(), c3.size(), x2.size());
+      const double* i1data = in(1)->get_block_view(c1, x3, c3, x2);
+      BlockBuffer i1data_sorted(in(1)->get_size(c1, x3, c3, x2));
+      sort_indices<1,3,0,2,0,1,1,1>(i1data, i1data_sorted.get(), c1.size(), x3.size(), c3.size(), x2.size());
       dgemm_("T", "N", x1.size()*x0.size(), c1.size()*c3.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+             1.0, i0data_sorted.get(), x3.size()*x2.size(), i1data_sorted.get(), x3.size()*x2.size(),
+             1.0, odata_sorted.get(), x1.size()*x0.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c1.size(), c3.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size(), c1.size(), c3.size());
   out()->put_block(odata, c1, c3, x1, x0);
 }
 
@@ -386,8 +386,8 @@ void Task515::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c1, x3, c3, x2);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x3, c3, x2);
-    sort_indices<0,1,2,3,1,1,-2,1>(i0data, odata, c1.size(), x3.size(), c3.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(c1, x3, c3, x2);
+    sort_indices<0,1,2,3,1,1,-2,1>(i0data, odata.get(), c1.size(), x3.size(), c3.size(), x2.size());
   }
   out()->put_block(odata, c1, x3, c3, x2);
 }
@@ -399,8 +399,8 @@ void Task516::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a2, c1);
   {
     // tensor label: I480
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a2, c1);
-    sort_indices<0,1,1,1,1,1>(i0data, odata, a2.size(), c1.size());
+    const double* i0data = in(0)->get_block_view(a2, c1);
+    sort_indices<0,1,1,1,1,1>(i0data, odata.get(), a2.size(), c1.size());
   }
   out()->put_block(odata, a2, c1);
 }
@@ -410,24 +410,24 @@ void Task517::Task_local::compute() {
   const Index c1 = b(1);
   // tensor label: I480
   std::unique_ptr<double[]> odata = out()->move_block(a2, c1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1)]);
+  BlockBuffer odata_sorted(out()->get_size(a2, c1));
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1), 0.0);
   for (auto& x0 : *range_[1]) {
     for (auto& c3 : *range_[0]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, x0)]);
-      sort_indices<3,2,0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
+      const double* i0data = in(0)->get_block_view(c1, a2, c3, x0);
+      BlockBuffer i0data_sorted(in(0)->get_size(c1, a2, c3, x0));
+      sort_indices<3,2,0,1,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size(), c3.size(), x0.size());
       // tensor label: I481
-      std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x0)]);
-      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, c3.size(), x0.size());
+      const double* i1data = in(1)->get_block_view(c3, x0);
+      BlockBuffer i1data_sorted(in(1)->get_size(c3, x0));
+      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), c3.size(), x0.size());
       dgemm_("T", "N", a2.size()*c1.size(), 1, c3.size()*x0.size(),
-             1.0, i0data_sorted, c3.size()*x0.size(), i1data_sorted, c3.size()*x0.size(),
-             1.0, odata_sorted, a2.size()*c1.size());
+             1.0, i0data_sorted.get(), c3.size()*x0.size(), i1data_sorted.get(), c3.size()*x0.size(),
+             1.0, odata_sorted.get(), a2.size()*c1.size());
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), c1.size(), a2.size());
   out()->put_block(odata, a2, c1);
 }
 
@@ -436,26 +436,26 @@ void Task518::Task_local::compute() {
   const Index x0 = b(1);
   // tensor label: I481
   std::unique_ptr<double[]> odata = out()->move_block(c3, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(c3, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(c3, x0), 0.0);
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma12
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x0, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x0, x1)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x0.size(), x1.size());
+        const double* i0data = in(0)->get_block_view(x3, x2, x0, x1);
+        BlockBuffer i0data_sorted(in(0)->get_size(x3, x2, x0, x1));
+        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x2.size(), x0.size(), x1.size());
         // tensor label: I482
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, c3, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, c3, x1)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), x2.size(), c3.size(), x1.size());
+        const double* i1data = in(1)->get_block_view(x3, x2, c3, x1);
+        BlockBuffer i1data_sorted(in(1)->get_size(x3, x2, c3, x1));
+        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), x2.size(), c3.size(), x1.size());
         dgemm_("T", "N", x0.size(), c3.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x0.size());
+               1.0, i0data_sorted.get(), x3.size()*x2.size()*x1.size(), i1data_sorted.get(), x3.size()*x2.size()*x1.size(),
+               1.0, odata_sorted.get(), x0.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), c3.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), c3.size());
   out()->put_block(odata, c3, x0);
 }
 
@@ -468,8 +468,8 @@ void Task519::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x3, x2, c3, x1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, c3, x1);
-    sort_indices<0,1,2,3,1,1,2,1>(i0data, odata, x3.size(), x2.size(), c3.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x3, x2, c3, x1);
+    sort_indices<0,1,2,3,1,1,2,1>(i0data, odata.get(), x3.size(), x2.size(), c3.size(), x1.size());
   }
   out()->put_block(odata, x3, x2, c3, x1);
 }
@@ -481,8 +481,8 @@ void Task520::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a2, c3);
   {
     // tensor label: I483
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2);
-    sort_indices<1,0,1,1,1,1>(i0data, odata, c3.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(c3, a2);
+    sort_indices<1,0,1,1,1,1>(i0data, odata.get(), c3.size(), a2.size());
   }
   out()->put_block(odata, a2, c3);
 }
@@ -492,24 +492,24 @@ void Task521::Task_local::compute() {
   const Index a2 = b(1);
   // tensor label: I483
   std::unique_ptr<double[]> odata = out()->move_block(c3, a2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, a2)]);
+  BlockBuffer odata_sorted(out()->get_size(c3, a2));
   std::fill_n(odata_sorted.get(), out()->get_size(c3, a2), 0.0);
   for (auto& x0 : *range_[1]) {
     for (auto& c1 : *range_[0]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, x0)]);
-      sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
+      const double* i0data = in(0)->get_block_view(c1, a2, c3, x0);
+      BlockBuffer i0data_sorted(in(0)->get_size(c1, a2, c3, x0));
+      sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size(), c3.size(), x0.size());
       // tensor label: I484
-      std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x0)]);
-      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, c1.size(), x0.size());
+      const double* i1data = in(1)->get_block_view(c1, x0);
+      BlockBuffer i1data_sorted(in(1)->get_size(c1, x0));
+      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), c1.size(), x0.size());
       dgemm_("T", "N", c3.size()*a2.size(), 1, c1.size()*x0.size(),
-             1.0, i0data_sorted, c1.size()*x0.size(), i1data_sorted, c1.size()*x0.size(),
-             1.0, odata_sorted, c3.size()*a2.size());
+             1.0, i0data_sorted.get(), c1.size()*x0.size(), i1data_sorted.get(), c1.size()*x0.size(),
+             1.0, odata_sorted.get(), c3.size()*a2.size());
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a2.size(), c3.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), a2.size(), c3.size());
   out()->put_block(odata, c3, a2);
 }
 
@@ -518,26 +518,26 @@ void Task522::Task_local::compute() {
   const Index x0 = b(1);
   // tensor label: I484
   std::unique_ptr<double[]> odata = out()->move_block(c1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x0), 0.0);
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma12
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x0, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x0, x1)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x0.size(), x1.size());
+        const double* i0data = in(0)->get_block_view(x3, x2, x0, x1);
+        BlockBuffer i0data_sorted(in(0)->get_size(x3, x2, x0, x1));
+        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x2.size(), x0.size(), x1.size());
         // tensor label: I485
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, c1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, c1, x1)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), x2.size(), c1.size(), x1.size());
+        const double* i1data = in(1)->get_block_view(x3, x2, c1, x1);
+        BlockBuffer i1data_sorted(in(1)->get_size(x3, x2, c1, x1));
+        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), x2.size(), c1.size(), x1.size());
         dgemm_("T", "N", x0.size(), c1.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x0.size());
+               1.0, i0data_sorted.get(), x3.size()*x2.size()*x1.size(), i1data_sorted.get(), x3.size()*x2.size()*x1.size(),
+               1.0, odata_sorted.get(), x0.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), c1.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), c1.size());
   out()->put_block(odata, c1, x0);
 }
 
@@ -550,8 +550,8 @@ void Task523::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x3, x2, c1, x1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, c1, x1);
-    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata, x3.size(), x2.size(), c1.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x3, x2, c1, x1);
+    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata.get(), x3.size(), x2.size(), c1.size(), x1.size());
   }
   out()->put_block(odata, x3, x2, c1, x1);
 }
@@ -561,24 +561,24 @@ void Task524::Task_local::compute() {
   const Index a2 = b(1);
   // tensor label: I483
   std::unique_ptr<double[]> odata = out()->move_block(c3, a2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, a2)]);
+  BlockBuffer odata_sorted(out()->get_size(c3, a2));
   std::fill_n(odata_sorted.get(), out()->get_size(c3, a2), 0.0);
   for (auto& a4 : *range_[2]) {
     for (auto& c1 : *range_[0]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, a4)]);
-      sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
+      const double* i0data = in(0)->get_block_view(c1, a2, c3, a4);
+      BlockBuffer i0data_sorted(in(0)->get_size(c1, a2, c3, a4));
+      sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size(), c3.size(), a4.size());
       // tensor label: I640
-      std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c1)]);
-      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a4.size(), c1.size());
+      const double* i1data = in(1)->get_block_view(a4, c1);
+      BlockBuffer i1data_sorted(in(1)->get_size(a4, c1));
+      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), c1.size());
       dgemm_("T", "N", c3.size()*a2.size(), 1, a4.size()*c1.size(),
-             1.0, i0data_sorted, a4.size()*c1.size(), i1data_sorted, a4.size()*c1.size(),
-             1.0, odata_sorted, c3.size()*a2.size());
+             1.0, i0data_sorted.get(), a4.size()*c1.size(), i1data_sorted.get(), a4.size()*c1.size(),
+             1.0, odata_sorted.get(), c3.size()*a2.size());
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a2.size(), c3.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), a2.size(), c3.size());
   out()->put_block(odata, c3, a2);
 }
 
@@ -587,24 +587,24 @@ void Task525::Task_local::compute() {
   const Index c1 = b(1);
   // tensor label: I640
   std::unique_ptr<double[]> odata = out()->move_block(a4, c1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, c1)]);
+  BlockBuffer odata_sorted(out()->get_size(a4, c1));
   std::fill_n(odata_sorted.get(), out()->get_size(a4, c1), 0.0);
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma38
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+      const double* i0data = in(0)->get_block_view(x1, x0);
+      BlockBuffer i0data_sorted(in(0)->get_size(x1, x0));
+      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), x0.size());
       // tensor label: I641
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a4, c1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a4, c1, x0)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x1.size(), a4.size(), c1.size(), x0.size());
+      const double* i1data = in(1)->get_block_view(x1, a4, c1, x0);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, a4, c1, x0));
+      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), a4.size(), c1.size(), x0.size());
       dgemm_("T", "N", 1, a4.size()*c1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, 1);
+             1.0, i0data_sorted.get(), x1.size()*x0.size(), i1data_sorted.get(), x1.size()*x0.size(),
+             1.0, odata_sorted.get(), 1);
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, a4.size(), c1.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), a4.size(), c1.size());
   out()->put_block(odata, a4, c1);
 }
 
@@ -617,13 +617,13 @@ void Task526::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, a4, c1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a4, c1, x0);
-    sort_indices<0,1,2,3,1,1,2,1>(i0data, odata, x1.size(), a4.size(), c1.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(x1, a4, c1, x0);
+    sort_indices<0,1,2,3,1,1,2,1>(i0data, odata.get(), x1.size(), a4.size(), c1.size(), x0.size());
   }
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i1data = in(0)->get_block(c1, a4, x1, x0);
-    sort_indices<2,1,0,3,1,1,-4,1>(i1data, odata, c1.size(), a4.size(), x1.size(), x0.size());
+    const double* i1data = in(0)->get_block_view(c1, a4, x1, x0);
+    sort_indices<2,1,0,3,1,1,-4,1>(i1data, odata.get(), c1.size(), a4.size(), x1.size(), x0.size());
   }
   out()->put_block(odata, x1, a4, c1, x0);
 }
@@ -635,8 +635,8 @@ void Task527::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, x2);
   {
     // tensor label: I486
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x1);
-    sort_indices<1,0,1,1,1,1>(i0data, odata, x2.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x2, x1);
+    sort_indices<1,0,1,1,1,1>(i0data, odata.get(), x2.size(), x1.size());
   }
   out()->put_block(odata, x1, x2);
 }
@@ -646,24 +646,24 @@ void Task528::Task_local::compute() {
   const Index x1 = b(1);
   // tensor label: I486
   std::unique_ptr<double[]> odata = out()->move_block(x2, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(x2, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1), 0.0);
   for (auto& x0 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       // tensor label: Gamma174
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x3, x2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x3, x2, x1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), x3.size(), x2.size(), x1.size());
+      const double* i0data = in(0)->get_block_view(x0, x3, x2, x1);
+      BlockBuffer i0data_sorted(in(0)->get_size(x0, x3, x2, x1));
+      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), x3.size(), x2.size(), x1.size());
       // tensor label: I487
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x0, x3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, x3)]);
-      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, x0.size(), x3.size());
+      const double* i1data = in(1)->get_block_view(x0, x3);
+      BlockBuffer i1data_sorted(in(1)->get_size(x0, x3));
+      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), x3.size());
       dgemm_("T", "N", x2.size()*x1.size(), 1, x0.size()*x3.size(),
-             1.0, i0data_sorted, x0.size()*x3.size(), i1data_sorted, x0.size()*x3.size(),
-             1.0, odata_sorted, x2.size()*x1.size());
+             1.0, i0data_sorted.get(), x0.size()*x3.size(), i1data_sorted.get(), x0.size()*x3.size(),
+             1.0, odata_sorted.get(), x2.size()*x1.size());
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x2.size(), x1.size());
   out()->put_block(odata, x2, x1);
 }
 
@@ -672,26 +672,26 @@ void Task529::Task_local::compute() {
   const Index x3 = b(1);
   // tensor label: I487
   std::unique_ptr<double[]> odata = out()->move_block(x0, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x3), 0.0);
   for (auto& c3 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2, c1, x3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a2, c1, x3)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c3.size(), a2.size(), c1.size(), x3.size());
+        const double* i0data = in(0)->get_block_view(c3, a2, c1, x3);
+        BlockBuffer i0data_sorted(in(0)->get_size(c3, a2, c1, x3));
+        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c3.size(), a2.size(), c1.size(), x3.size());
         // tensor label: I488
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c3, a2, c1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c3, a2, c1)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted, x0.size(), c3.size(), a2.size(), c1.size());
+        const double* i1data = in(1)->get_block_view(x0, c3, a2, c1);
+        BlockBuffer i1data_sorted(in(1)->get_size(x0, c3, a2, c1));
+        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), c3.size(), a2.size(), c1.size());
         dgemm_("T", "N", x3.size(), x0.size(), c3.size()*a2.size()*c1.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*c1.size(), i1data_sorted, c3.size()*a2.size()*c1.size(),
-               1.0, odata_sorted, x3.size());
+               1.0, i0data_sorted.get(), c3.size()*a2.size()*c1.size(), i1data_sorted.get(), c3.size()*a2.size()*c1.size(),
+               1.0, odata_sorted.get(), x3.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x0.size());
   out()->put_block(odata, x0, x3);
 }
 
@@ -704,8 +704,8 @@ void Task530::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x0, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-    sort_indices<3,2,1,0,1,1,-1,1>(i0data, odata, c1.size(), a2.size(), c3.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, x0);
+    sort_indices<3,2,1,0,1,1,-1,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), x0.size());
   }
   out()->put_block(odata, x0, c3, a2, c1);
 }
@@ -715,26 +715,26 @@ void Task531::Task_local::compute() {
   const Index x3 = b(1);
   // tensor label: I487
   std::unique_ptr<double[]> odata = out()->move_block(x0, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x3), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c3 : *range_[0]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, x3)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), x3.size());
+        const double* i0data = in(0)->get_block_view(c1, a2, c3, x3);
+        BlockBuffer i0data_sorted(in(0)->get_size(c1, a2, c3, x3));
+        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size(), c3.size(), x3.size());
         // tensor label: I491
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c3, a2, c1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c3, a2, c1)]);
-        sort_indices<3,2,1,0,0,1,1,1>(i1data, i1data_sorted, x0.size(), c3.size(), a2.size(), c1.size());
+        const double* i1data = in(1)->get_block_view(x0, c3, a2, c1);
+        BlockBuffer i1data_sorted(in(1)->get_size(x0, c3, a2, c1));
+        sort_indices<3,2,1,0,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), c3.size(), a2.size(), c1.size());
         dgemm_("T", "N", x3.size(), x0.size(), c3.size()*a2.size()*c1.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*c1.size(), i1data_sorted, c3.size()*a2.size()*c1.size(),
-               1.0, odata_sorted, x3.size());
+               1.0, i0data_sorted.get(), c3.size()*a2.size()*c1.size(), i1data_sorted.get(), c3.size()*a2.size()*c1.size(),
+               1.0, odata_sorted.get(), x3.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x0.size());
   out()->put_block(odata, x0, x3);
 }
 
@@ -747,8 +747,8 @@ void Task532::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x0, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata, c1.size(), a2.size(), c3.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, x0);
+    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), x0.size());
   }
   out()->put_block(odata, x0, c3, a2, c1);
 }
@@ -758,24 +758,24 @@ void Task533::Task_local::compute() {
   const Index x1 = b(1);
   // tensor label: I486
   std::unique_ptr<double[]> odata = out()->move_block(x2, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(x2, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1), 0.0);
   for (auto& x3 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma60
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+      const double* i0data = in(0)->get_block_view(x3, x0, x2, x1);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, x0, x2, x1));
+      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x0.size(), x2.size(), x1.size());
       // tensor label: I696
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x0, x3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, x3)]);
-      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, x0.size(), x3.size());
+      const double* i1data = in(1)->get_block_view(x0, x3);
+      BlockBuffer i1data_sorted(in(1)->get_size(x0, x3));
+      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), x3.size());
       dgemm_("T", "N", x2.size()*x1.size(), 1, x0.size()*x3.size(),
-             1.0, i0data_sorted, x0.size()*x3.size(), i1data_sorted, x0.size()*x3.size(),
-             1.0, odata_sorted, x2.size()*x1.size());
+             1.0, i0data_sorted.get(), x0.size()*x3.size(), i1data_sorted.get(), x0.size()*x3.size(),
+             1.0, odata_sorted.get(), x2.size()*x1.size());
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x2.size(), x1.size());
   out()->put_block(odata, x2, x1);
 }
 
@@ -784,26 +784,26 @@ void Task534::Task_local::compute() {
   const Index x3 = b(1);
   // tensor label: I696
   std::unique_ptr<double[]> odata = out()->move_block(x0, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x3), 0.0);
   for (auto& a3 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a1 : *range_[2]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a3, c2, a1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a3, c2, a1)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, x3.size(), a3.size(), c2.size(), a1.size());
+        const double* i0data = in(0)->get_block_view(x3, a3, c2, a1);
+        BlockBuffer i0data_sorted(in(0)->get_size(x3, a3, c2, a1));
+        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a3.size(), c2.size(), a1.size());
         // tensor label: I697
-        std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, a1, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, a1, x0)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), a1.size(), x0.size());
+        const double* i1data = in(1)->get_block_view(a3, c2, a1, x0);
+        BlockBuffer i1data_sorted(in(1)->get_size(a3, c2, a1, x0));
+        sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), c2.size(), a1.size(), x0.size());
         dgemm_("T", "N", x3.size(), x0.size(), a3.size()*c2.size()*a1.size(),
-               1.0, i0data_sorted, a3.size()*c2.size()*a1.size(), i1data_sorted, a3.size()*c2.size()*a1.size(),
-               1.0, odata_sorted, x3.size());
+               1.0, i0data_sorted.get(), a3.size()*c2.size()*a1.size(), i1data_sorted.get(), a3.size()*c2.size()*a1.size(),
+               1.0, odata_sorted.get(), x3.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x0.size());
   out()->put_block(odata, x0, x3);
 }
 
@@ -816,8 +816,8 @@ void Task535::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-    sort_indices<3,2,1,0,1,1,-1,1>(i0data, odata, x0.size(), a1.size(), c2.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, a3);
+    sort_indices<3,2,1,0,1,1,-1,1>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), a3.size());
   }
   out()->put_block(odata, a3, c2, a1, x0);
 }
@@ -827,26 +827,26 @@ void Task536::Task_local::compute() {
   const Index x3 = b(1);
   // tensor label: I696
   std::unique_ptr<double[]> odata = out()->move_block(x0, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x3), 0.0);
   for (auto& a1 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a3 : *range_[2]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, c2, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, c2, a3)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), c2.size(), a3.size());
+        const double* i0data = in(0)->get_block_view(x3, a1, c2, a3);
+        BlockBuffer i0data_sorted(in(0)->get_size(x3, a1, c2, a3));
+        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a1.size(), c2.size(), a3.size());
         // tensor label: I700
-        std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, a1, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, a1, x0)]);
-        sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), a1.size(), x0.size());
+        const double* i1data = in(1)->get_block_view(a3, c2, a1, x0);
+        BlockBuffer i1data_sorted(in(1)->get_size(a3, c2, a1, x0));
+        sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), c2.size(), a1.size(), x0.size());
         dgemm_("T", "N", x3.size(), x0.size(), a3.size()*c2.size()*a1.size(),
-               1.0, i0data_sorted, a3.size()*c2.size()*a1.size(), i1data_sorted, a3.size()*c2.size()*a1.size(),
-               1.0, odata_sorted, x3.size());
+               1.0, i0data_sorted.get(), a3.size()*c2.size()*a1.size(), i1data_sorted.get(), a3.size()*c2.size()*a1.size(),
+               1.0, odata_sorted.get(), x3.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x0.size());
   out()->put_block(odata, x0, x3);
 }
 
@@ -859,8 +859,8 @@ void Task537::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata, x0.size(), a1.size(), c2.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, a3);
+    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), a3.size());
   }
   out()->put_block(odata, a3, c2, a1, x0);
 }
@@ -872,8 +872,8 @@ void Task538::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c4, c1);
   {
     // tensor label: I492
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, c4);
-    sort_indices<1,0,1,1,1,1>(i0data, odata, c1.size(), c4.size());
+    const double* i0data = in(0)->get_block_view(c1, c4);
+    sort_indices<1,0,1,1,1,1>(i0data, odata.get(), c1.size(), c4.size());
   }
   out()->put_block(odata, c4, c1);
 }
@@ -883,26 +883,26 @@ void Task539::Task_local::compute() {
   const Index c4 = b(1);
   // tensor label: I492
   std::unique_ptr<double[]> odata = out()->move_block(c1, c4);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c4)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, c4));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c4), 0.0);
   for (auto& a2 : *range_[2]) {
     for (auto& c3 : *range_[0]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(c4, a2, c3, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c4, a2, c3, x1)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, c4.size(), a2.size(), c3.size(), x1.size());
+        const double* i0data = in(0)->get_block_view(c4, a2, c3, x1);
+        BlockBuffer i0data_sorted(in(0)->get_size(c4, a2, c3, x1));
+        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted.get(), c4.size(), a2.size(), c3.size(), x1.size());
         // tensor label: I493
-        std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, c1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, c1, x1)]);
-        sort_indices<1,0,3,2,0,1,1,1>(i1data, i1data_sorted, c3.size(), a2.size(), c1.size(), x1.size());
+        const double* i1data = in(1)->get_block_view(c3, a2, c1, x1);
+        BlockBuffer i1data_sorted(in(1)->get_size(c3, a2, c1, x1));
+        sort_indices<1,0,3,2,0,1,1,1>(i1data, i1data_sorted.get(), c3.size(), a2.size(), c1.size(), x1.size());
         dgemm_("T", "N", c4.size(), c1.size(), c3.size()*a2.size()*x1.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*x1.size(), i1data_sorted, c3.size()*a2.size()*x1.size(),
-               1.0, odata_sorted, c4.size());
+               1.0, i0data_sorted.get(), c3.size()*a2.size()*x1.size(), i1data_sorted.get(), c3.size()*a2.size()*x1.size(),
+               1.0, odata_sorted.get(), c4.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c4.size(), c1.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), c4.size(), c1.size());
   out()->put_block(odata, c1, c4);
 }
 
@@ -913,22 +913,22 @@ void Task540::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I493
   std::unique_ptr<double[]> odata = out()->move_block(c3, a2, c1, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, a2, c1, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(c3, a2, c1, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(c3, a2, c1, x1), 0.0);
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma16
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x0, x1);
+    BlockBuffer i0data_sorted(in(0)->get_size(x0, x1));
+    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), x1.size());
     // tensor label: I494
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c3, a2, c1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c3, a2, c1)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, x0.size(), c3.size(), a2.size(), c1.size());
+    const double* i1data = in(1)->get_block_view(x0, c3, a2, c1);
+    BlockBuffer i1data_sorted(in(1)->get_size(x0, c3, a2, c1));
+    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), c3.size(), a2.size(), c1.size());
     dgemm_("T", "N", x1.size(), c3.size()*a2.size()*c1.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+           1.0, i0data_sorted.get(), x0.size(), i1data_sorted.get(), x0.size(),
+           1.0, odata_sorted.get(), x1.size());
   }
-  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x1.size(), c3.size(), a2.size(), c1.size());
+  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), c3.size(), a2.size(), c1.size());
   out()->put_block(odata, c3, a2, c1, x1);
 }
 
@@ -941,8 +941,8 @@ void Task541::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x0, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata, c1.size(), a2.size(), c3.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, x0);
+    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), x0.size());
   }
   out()->put_block(odata, x0, c3, a2, c1);
 }
@@ -952,26 +952,26 @@ void Task542::Task_local::compute() {
   const Index c4 = b(1);
   // tensor label: I492
   std::unique_ptr<double[]> odata = out()->move_block(c1, c4);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c4)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, c4));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c4), 0.0);
   for (auto& c3 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2, c4, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a2, c4, x1)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, c3.size(), a2.size(), c4.size(), x1.size());
+        const double* i0data = in(0)->get_block_view(c3, a2, c4, x1);
+        BlockBuffer i0data_sorted(in(0)->get_size(c3, a2, c4, x1));
+        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted.get(), c3.size(), a2.size(), c4.size(), x1.size());
         // tensor label: I496
-        std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, c1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, c1, x1)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted, c3.size(), a2.size(), c1.size(), x1.size());
+        const double* i1data = in(1)->get_block_view(c3, a2, c1, x1);
+        BlockBuffer i1data_sorted(in(1)->get_size(c3, a2, c1, x1));
+        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted.get(), c3.size(), a2.size(), c1.size(), x1.size());
         dgemm_("T", "N", c4.size(), c1.size(), c3.size()*a2.size()*x1.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*x1.size(), i1data_sorted, c3.size()*a2.size()*x1.size(),
-               1.0, odata_sorted, c4.size());
+               1.0, i0data_sorted.get(), c3.size()*a2.size()*x1.size(), i1data_sorted.get(), c3.size()*a2.size()*x1.size(),
+               1.0, odata_sorted.get(), c4.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c4.size(), c1.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), c4.size(), c1.size());
   out()->put_block(odata, c1, c4);
 }
 
@@ -982,22 +982,22 @@ void Task543::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I496
   std::unique_ptr<double[]> odata = out()->move_block(c3, a2, c1, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, a2, c1, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(c3, a2, c1, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(c3, a2, c1, x1), 0.0);
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma16
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x0, x1);
+    BlockBuffer i0data_sorted(in(0)->get_size(x0, x1));
+    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), x1.size());
     // tensor label: I497
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c3, a2, c1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c3, a2, c1)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, x0.size(), c3.size(), a2.size(), c1.size());
+    const double* i1data = in(1)->get_block_view(x0, c3, a2, c1);
+    BlockBuffer i1data_sorted(in(1)->get_size(x0, c3, a2, c1));
+    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), c3.size(), a2.size(), c1.size());
     dgemm_("T", "N", x1.size(), c3.size()*a2.size()*c1.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+           1.0, i0data_sorted.get(), x0.size(), i1data_sorted.get(), x0.size(),
+           1.0, odata_sorted.get(), x1.size());
   }
-  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x1.size(), c3.size(), a2.size(), c1.size());
+  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), c3.size(), a2.size(), c1.size());
   out()->put_block(odata, c3, a2, c1, x1);
 }
 
@@ -1010,8 +1010,8 @@ void Task544::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x0, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata, c1.size(), a2.size(), c3.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, x0);
+    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), x0.size());
   }
   out()->put_block(odata, x0, c3, a2, c1);
 }
@@ -1023,8 +1023,8 @@ void Task545::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c4, c3);
   {
     // tensor label: I498
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c3, c4);
-    sort_indices<1,0,1,1,1,1>(i0data, odata, c3.size(), c4.size());
+    const double* i0data = in(0)->get_block_view(c3, c4);
+    sort_indices<1,0,1,1,1,1>(i0data, odata.get(), c3.size(), c4.size());
   }
   out()->put_block(odata, c4, c3);
 }
@@ -1034,26 +1034,26 @@ void Task546::Task_local::compute() {
   const Index c4 = b(1);
   // tensor label: I498
   std::unique_ptr<double[]> odata = out()->move_block(c3, c4);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, c4)]);
+  BlockBuffer odata_sorted(out()->get_size(c3, c4));
   std::fill_n(odata_sorted.get(), out()->get_size(c3, c4), 0.0);
   for (auto& a2 : *range_[2]) {
     for (auto& c1 : *range_[0]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(c4, a2, c1, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c4, a2, c1, x1)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, c4.size(), a2.size(), c1.size(), x1.size());
+        const double* i0data = in(0)->get_block_view(c4, a2, c1, x1);
+        BlockBuffer i0data_sorted(in(0)->get_size(c4, a2, c1, x1));
+        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted.get(), c4.size(), a2.size(), c1.size(), x1.size());
         // tensor label: I499
-        std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, c1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, c1, x1)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted, c3.size(), a2.size(), c1.size(), x1.size());
+        const double* i1data = in(1)->get_block_view(c3, a2, c1, x1);
+        BlockBuffer i1data_sorted(in(1)->get_size(c3, a2, c1, x1));
+        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted.get(), c3.size(), a2.size(), c1.size(), x1.size());
         dgemm_("T", "N", c4.size(), c3.size(), a2.size()*c1.size()*x1.size(),
-               1.0, i0data_sorted, a2.size()*c1.size()*x1.size(), i1data_sorted, a2.size()*c1.size()*x1.size(),
-               1.0, odata_sorted, c4.size());
+               1.0, i0data_sorted.get(), a2.size()*c1.size()*x1.size(), i1data_sorted.get(), a2.size()*c1.size()*x1.size(),
+               1.0, odata_sorted.get(), c4.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c4.size(), c3.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), c4.size(), c3.size());
   out()->put_block(odata, c3, c4);
 }
 
@@ -1064,22 +1064,22 @@ void Task547::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I499
   std::unique_ptr<double[]> odata = out()->move_block(c3, a2, c1, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, a2, c1, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(c3, a2, c1, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(c3, a2, c1, x1), 0.0);
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma16
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x0, x1);
+    BlockBuffer i0data_sorted(in(0)->get_size(x0, x1));
+    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), x1.size());
     // tensor label: I500
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c3, a2, c1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c3, a2, c1)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, x0.size(), c3.size(), a2.size(), c1.size());
+    const double* i1data = in(1)->get_block_view(x0, c3, a2, c1);
+    BlockBuffer i1data_sorted(in(1)->get_size(x0, c3, a2, c1));
+    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), c3.size(), a2.size(), c1.size());
     dgemm_("T", "N", x1.size(), c3.size()*a2.size()*c1.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+           1.0, i0data_sorted.get(), x0.size(), i1data_sorted.get(), x0.size(),
+           1.0, odata_sorted.get(), x1.size());
   }
-  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x1.size(), c3.size(), a2.size(), c1.size());
+  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), c3.size(), a2.size(), c1.size());
   out()->put_block(odata, c3, a2, c1, x1);
 }
 
@@ -1092,8 +1092,8 @@ void Task548::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x0, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata, c1.size(), a2.size(), c3.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, x0);
+    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), x0.size());
   }
   out()->put_block(odata, x0, c3, a2, c1);
 }
@@ -1103,26 +1103,26 @@ void Task549::Task_local::compute() {
   const Index c4 = b(1);
   // tensor label: I498
   std::unique_ptr<double[]> odata = out()->move_block(c3, c4);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, c4)]);
+  BlockBuffer odata_sorted(out()->get_size(c3, c4));
   std::fill_n(odata_sorted.get(), out()->get_size(c3, c4), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c4, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c4, x1)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c4.size(), x1.size());
+        const double* i0data = in(0)->get_block_view(c1, a2, c4, x1);
+        BlockBuffer i0data_sorted(in(0)->get_size(c1, a2, c4, x1));
+        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size(), c4.size(), x1.size());
         // tensor label: I505
-        std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, c1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, c1, x1)]);
-        sort_indices<2,1,3,0,0,1,1,1>(i1data, i1data_sorted, c3.size(), a2.size(), c1.size(), x1.size());
+        const double* i1data = in(1)->get_block_view(c3, a2, c1, x1);
+        BlockBuffer i1data_sorted(in(1)->get_size(c3, a2, c1, x1));
+        sort_indices<2,1,3,0,0,1,1,1>(i1data, i1data_sorted.get(), c3.size(), a2.size(), c1.size(), x1.size());
         dgemm_("T", "N", c4.size(), c3.size(), a2.size()*c1.size()*x1.size(),
-               1.0, i0data_sorted, a2.size()*c1.size()*x1.size(), i1data_sorted, a2.size()*c1.size()*x1.size(),
-               1.0, odata_sorted, c4.size());
+               1.0, i0data_sorted.get(), a2.size()*c1.size()*x1.size(), i1data_sorted.get(), a2.size()*c1.size()*x1.size(),
+               1.0, odata_sorted.get(), c4.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c4.size(), c3.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), c4.size(), c3.size());
   out()->put_block(odata, c3, c4);
 }
 
@@ -40,24 +40,24 @@ void Task600::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I553
   std::unique_ptr<double[]> odata = out()->move_block(c2, a1, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(c2, a1, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1, x3, x2), 0.0);
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma35
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      const double* i0data = in(0)->get_block_view(x3, x2, x1, x0);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, x2, x1, x0));
+      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: I554
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c2, a1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c2, a1, x0)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x1.size(), c2.size(), a1.size(), x0.size());
+      const double* i1data = in(1)->get_block_view(x1, c2, a1, x0);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, c2, a1, x0));
+      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), c2.size(), a1.size(), x0.size());
       dgemm_("T", "N", x3.size()*x2.size(), c2.size()*a1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), x1.size()*x0.size(), i1data_sorted.get(), x1.size()*x0.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), c2.size(), a1.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), c2.size(), a1.size());
   out()->put_block(odata, c2, a1, x3, x2);
 }
 
@@ -70,8 +70,8 @@ void Task601::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-    sort_indices<3,2,1,0,1,1,-1,1>(i0data, odata, x0.size(), a1.size(), c2.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, x1);
+    sort_indices<3,2,1,0,1,1,-1,1>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), x1.size());
   }
   out()->put_block(odata, x1, c2, a1, x0);
 }
@@ -83,8 +83,8 @@ void Task602::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c3, a4);
   {
     // tensor label: I558
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a4, c3);
-    sort_indices<1,0,1,1,1,1>(i0data, odata, a4.size(), c3.size());
+    const double* i0data = in(0)->get_block_view(a4, c3);
+    sort_indices<1,0,1,1,1,1>(i0data, odata.get(), a4.size(), c3.size());
   }
   out()->put_block(odata, c3, a4);
 }
@@ -94,24 +94,24 @@ void Task603::Task_local::compute() {
   const Index c3 = b(1);
   // tensor label: I558
   std::unique_ptr<double[]> odata = out()->move_block(a4, c3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, c3)]);
+  BlockBuffer odata_sorted(out()->get_size(a4, c3));
   std::fill_n(odata_sorted.get(), out()->get_size(a4, c3), 0.0);
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a4, c3, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a4, c3, a1)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, c2.size(), a4.size(), c3.size(), a1.size());
+      const double* i0data = in(0)->get_block_view(c2, a4, c3, a1);
+      BlockBuffer i0data_sorted(in(0)->get_size(c2, a4, c3, a1));
+      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted.get(), c2.size(), a4.size(), c3.size(), a1.size());
       // tensor label: I559
-      std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1)]);
-      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size());
+      const double* i1data = in(1)->get_block_view(c2, a1);
+      BlockBuffer i1data_sorted(in(1)->get_size(c2, a1));
+      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), c2.size(), a1.size());
       dgemm_("T", "N", a4.size()*c3.size(), 1, c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, a4.size()*c3.size());
+             1.0, i0data_sorted.get(), c2.size()*a1.size(), i1data_sorted.get(), c2.size()*a1.size(),
+             1.0, odata_sorted.get(), a4.size()*c3.size());
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, a4.size(), c3.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), a4.size(), c3.size());
   out()->put_block(odata, a4, c3);
 }
 
@@ -120,24 +120,24 @@ void Task604::Task_local::compute() {
   const Index a1 = b(1);
   // tensor label: I559
   std::unique_ptr<double[]> odata = out()->move_block(c2, a1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1)]);
+  BlockBuffer odata_sorted(out()->get_size(c2, a1));
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1), 0.0);
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma38
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+      const double* i0data = in(0)->get_block_view(x1, x0);
+      BlockBuffer i0data_sorted(in(0)->get_size(x1, x0));
+      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), x0.size());
       // tensor label: I560
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c2, a1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c2, a1, x0)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x1.size(), c2.size(), a1.size(), x0.size());
+      const double* i1data = in(1)->get_block_view(x1, c2, a1, x0);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, c2, a1, x0));
+      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), c2.size(), a1.size(), x0.size());
       dgemm_("T", "N", 1, c2.size()*a1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, 1);
+             1.0, i0data_sorted.get(), x1.size()*x0.size(), i1data_sorted.get(), x1.size()*x0.size(),
+             1.0, odata_sorted.get(), 1);
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), c2.size(), a1.size());
   out()->put_block(odata, c2, a1);
 }
 
@@ -150,8 +150,8 @@ void Task605::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata, x0.size(), a1.size(), c2.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, x1);
+    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), x1.size());
   }
   out()->put_block(odata, x1, c2, a1, x0);
 }
@@ -161,24 +161,24 @@ void Task606::Task_local::compute() {
   const Index c3 = b(1);
   // tensor label: I558
   std::unique_ptr<double[]> odata = out()->move_block(a4, c3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, c3)]);
+  BlockBuffer odata_sorted(out()->get_size(a4, c3));
   std::fill_n(odata_sorted.get(), out()->get_size(a4, c3), 0.0);
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, c3, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1, c3, a4)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size(), c3.size(), a4.size());
+      const double* i0data = in(0)->get_block_view(c2, a1, c3, a4);
+      BlockBuffer i0data_sorted(in(0)->get_size(c2, a1, c3, a4));
+      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c2.size(), a1.size(), c3.size(), a4.size());
       // tensor label: I562
-      std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1)]);
-      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size());
+      const double* i1data = in(1)->get_block_view(c2, a1);
+      BlockBuffer i1data_sorted(in(1)->get_size(c2, a1));
+      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), c2.size(), a1.size());
       dgemm_("T", "N", c3.size()*a4.size(), 1, c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, c3.size()*a4.size());
+             1.0, i0data_sorted.get(), c2.size()*a1.size(), i1data_sorted.get(), c2.size()*a1.size(),
+             1.0, odata_sorted.get(), c3.size()*a4.size());
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c3.size(), a4.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), c3.size(), a4.size());
   out()->put_block(odata, a4, c3);
 }
 
@@ -187,24 +187,24 @@ void Task607::Task_local::compute() {
   const Index a1 = b(1);
   // tensor label: I562
   std::unique_ptr<double[]> odata = out()->move_block(c2, a1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1)]);
+  BlockBuffer odata_sorted(out()->get_size(c2, a1));
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1), 0.0);
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma38
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+      const double* i0data = in(0)->get_block_view(x1, x0);
+      BlockBuffer i0data_sorted(in(0)->get_size(x1, x0));
+      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), x0.size());
       // tensor label: I563
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c2, a1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c2, a1, x0)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x1.size(), c2.size(), a1.size(), x0.size());
+      const double* i1data = in(1)->get_block_view(x1, c2, a1, x0);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, c2, a1, x0));
+      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), c2.size(), a1.size(), x0.size());
       dgemm_("T", "N", 1, c2.size()*a1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, 1);
+             1.0, i0data_sorted.get(), x1.size()*x0.size(), i1data_sorted.get(), x1.size()*x0.size(),
+             1.0, odata_sorted.get(), 1);
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), c2.size(), a1.size());
   out()->put_block(odata, c2, a1);
 }
 
@@ -217,8 +217,8 @@ void Task608::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-    sort_indices<3,2,1,0,1,1,-4,1>(i0data, odata, x0.size(), a1.size(), c2.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, x1);
+    sort_indices<3,2,1,0,1,1,-4,1>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), x1.size());
   }
   out()->put_block(odata, x1, c2, a1, x0);
 }
@@ -228,24 +228,24 @@ void Task609::Task_local::compute() {
   const Index c3 = b(1);
   // tensor label: I558
   std::unique_ptr<double[]> odata = out()->move_block(a4, c3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, c3)]);
+  BlockBuffer odata_sorted(out()->get_size(a4, c3));
   std::fill_n(odata_sorted.get(), out()->get_size(a4, c3), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a4, c3, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a4, c3, a2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a4.size(), c3.size(), a2.size());
+      const double* i0data = in(0)->get_block_view(c1, a4, c3, a2);
+      BlockBuffer i0data_sorted(in(0)->get_size(c1, a4, c3, a2));
+      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a4.size(), c3.size(), a2.size());
       // tensor label: I601
-      std::unique_ptr<double[]> i1data = in(1)->get_block(a2, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, c1)]);
-      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, a2.size(), c1.size());
+      const double* i1data = in(1)->get_block_view(a2, c1);
+      BlockBuffer i1data_sorted(in(1)->get_size(a2, c1));
+      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), a2.size(), c1.size());
       dgemm_("T", "N", a4.size()*c3.size(), 1, a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, a4.size()*c3.size());
+             1.0, i0data_sorted.get(), a2.size()*c1.size(), i1data_sorted.get(), a2.size()*c1.size(),
+             1.0, odata_sorted.get(), a4.size()*c3.size());
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, a4.size(), c3.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), a4.size(), c3.size());
   out()->put_block(odata, a4, c3);
 }
 
@@ -254,24 +254,24 @@ void Task610::Task_local::compute() {
   const Index c1 = b(1);
   // tensor label: I601
   std::unique_ptr<double[]> odata = out()->move_block(a2, c1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1)]);
+  BlockBuffer odata_sorted(out()->get_size(a2, c1));
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1), 0.0);
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma38
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+      const double* i0data = in(0)->get_block_view(x1, x0);
+      BlockBuffer i0data_sorted(in(0)->get_size(x1, x0));
+      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), x0.size());
       // tensor label: I602
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, a2, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, a2, c1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), a2.size(), c1.size());
+      const double* i1data = in(1)->get_block_view(x1, x0, a2, c1);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, a2, c1));
+      sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), a2.size(), c1.size());
       dgemm_("T", "N", 1, a2.size()*c1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, 1);
+             1.0, i0data_sorted.get(), x1.size()*x0.size(), i1data_sorted.get(), x1.size()*x0.size(),
+             1.0, odata_sorted.get(), 1);
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, a2.size(), c1.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), a2.size(), c1.size());
   out()->put_block(odata, a2, c1);
 }
 
@@ -284,8 +284,8 @@ void Task611::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x0, x1);
-    sort_indices<3,2,1,0,1,1,-4,1>(i0data, odata, c1.size(), a2.size(), x0.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, x0, x1);
+    sort_indices<3,2,1,0,1,1,-4,1>(i0data, odata.get(), c1.size(), a2.size(), x0.size(), x1.size());
   }
   out()->put_block(odata, x1, x0, a2, c1);
 }
@@ -295,24 +295,24 @@ void Task612::Task_local::compute() {
   const Index c3 = b(1);
   // tensor label: I558
   std::unique_ptr<double[]> odata = out()->move_block(a4, c3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, c3)]);
+  BlockBuffer odata_sorted(out()->get_size(a4, c3));
   std::fill_n(odata_sorted.get(), out()->get_size(a4, c3), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, a4)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
+      const double* i0data = in(0)->get_block_view(c1, a2, c3, a4);
+      BlockBuffer i0data_sorted(in(0)->get_size(c1, a2, c3, a4));
+      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size(), c3.size(), a4.size());
       // tensor label: I604
-      std::unique_ptr<double[]> i1data = in(1)->get_block(a2, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, c1)]);
-      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, a2.size(), c1.size());
+      const double* i1data = in(1)->get_block_view(a2, c1);
+      BlockBuffer i1data_sorted(in(1)->get_size(a2, c1));
+      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), a2.size(), c1.size());
       dgemm_("T", "N", c3.size()*a4.size(), 1, a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, c3.size()*a4.size());
+             1.0, i0data_sorted.get(), a2.size()*c1.size(), i1data_sorted.get(), a2.size()*c1.size(),
+             1.0, odata_sorted.get(), c3.size()*a4.size());
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c3.size(), a4.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), c3.size(), a4.size());
   out()->put_block(odata, a4, c3);
 }
 
@@ -321,24 +321,24 @@ void Task613::Task_local::compute() {
   const Index c1 = b(1);
   // tensor label: I604
   std::unique_ptr<double[]> odata = out()->move_block(a2, c1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1)]);
+  BlockBuffer odata_sorted(out()->get_size(a2, c1));
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1), 0.0);
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma38
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+      const double* i0data = in(0)->get_block_view(x1, x0);
+      BlockBuffer i0data_sorted(in(0)->get_size(x1, x0));
+      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), x0.size());
       // tensor label: I605
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, a2, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, a2, c1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), a2.size(), c1.size());
+      const double* i1data = in(1)->get_block_view(x1, x0, a2, c1);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, a2, c1));
+      sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), a2.size(), c1.size());
       dgemm_("T", "N", 1, a2.size()*c1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, 1);
+             1.0, i0data_sorted.get(), x1.size()*x0.size(), i1data_sorted.get(), x1.size()*x0.size(),
+             1.0, odata_sorted.get(), 1);
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, a2.size(), c1.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), a2.size(), c1.size());
   out()->put_block(odata, a2, c1);
 }
 
@@ -351,8 +351,8 @@ void Task614::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x0, x1);
-    sort_indices<3,2,1,0,1,1,8,1>(i0data, odata, c1.size(), a2.size(), x0.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, x0, x1);
+    sort_indices<3,2,1,0,1,1,8,1>(i0data, odata.get(), c1.size(), a2.size(), x0.size(), x1.size());
   }
   out()->put_block(odata, x1, x0, a2, c1);
 }
@@ -364,8 +364,8 @@ void Task615::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a2, x2);
   {
     // tensor label: I570
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x2, a2);
-    sort_indices<1,0,1,1,1,1>(i0data, odata, x2.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(x2, a2);
+    sort_indices<1,0,1,1,1,1>(i0data, odata.get(), x2.size(), a2.size());
   }
   out()->put_block(odata, a2, x2);
 }
@@ -375,26 +375,26 @@ void Task616::Task_local::compute() {
   const Index a2 = b(1);
   // tensor label: I570
   std::unique_ptr<double[]> odata = out()->move_block(x2, a2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, a2)]);
+  BlockBuffer odata_sorted(out()->get_size(x2, a2));
   std::fill_n(odata_sorted.get(), out()->get_size(x2, a2), 0.0);
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x0, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, x0, x1)]);
-        sort_indices<3,2,0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), x0.size(), x1.size());
+        const double* i0data = in(0)->get_block_view(c1, a2, x0, x1);
+        BlockBuffer i0data_sorted(in(0)->get_size(c1, a2, x0, x1));
+        sort_indices<3,2,0,1,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size(), x0.size(), x1.size());
         // tensor label: I571
-        std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x2, x1, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x2, x1, x0)]);
-        sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c1.size(), x2.size(), x1.size(), x0.size());
+        const double* i1data = in(1)->get_block_view(c1, x2, x1, x0);
+        BlockBuffer i1data_sorted(in(1)->get_size(c1, x2, x1, x0));
+        sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted.get(), c1.size(), x2.size(), x1.size(), x0.size());
         dgemm_("T", "N", a2.size(), x2.size(), c1.size()*x1.size()*x0.size(),
-               1.0, i0data_sorted, c1.size()*x1.size()*x0.size(), i1data_sorted, c1.size()*x1.size()*x0.size(),
-               1.0, odata_sorted, a2.size());
+               1.0, i0data_sorted.get(), c1.size()*x1.size()*x0.size(), i1data_sorted.get(), c1.size()*x1.size()*x0.size(),
+               1.0, odata_sorted.get(), a2.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a2.size(), x2.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), a2.size(), x2.size());
   out()->put_block(odata, x2, a2);
 }
 
@@ -405,26 +405,26 @@ void Task617::Task_local::compute() {
   const Index x0 = b(3);
   // tensor label: I571
   std::unique_ptr<double[]> odata = out()->move_block(c1, x2, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x2, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, x2, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x2, x1, x0), 0.0);
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma6
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x2, x3, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x2, x3, x1, x0)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
+        const double* i0data = in(0)->get_block_view(x5, x4, x2, x3, x1, x0);
+        BlockBuffer i0data_sorted(in(0)->get_size(x5, x4, x2, x3, x1, x0));
+        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
         // tensor label: I572
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, c1, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, c1, x3)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted, x5.size(), x4.size(), c1.size(), x3.size());
+        const double* i1data = in(1)->get_block_view(x5, x4, c1, x3);
+        BlockBuffer i1data_sorted(in(1)->get_size(x5, x4, c1, x3));
+        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted.get(), x5.size(), x4.size(), c1.size(), x3.size());
         dgemm_("T", "N", x2.size()*x1.size()*x0.size(), c1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+               1.0, i0data_sorted.get(), x5.size()*x4.size()*x3.size(), i1data_sorted.get(), x5.size()*x4.size()*x3.size(),
+               1.0, odata_sorted.get(), x2.size()*x1.size()*x0.size());
       }
     }
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size(), x0.size(), c1.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x2.size(), x1.size(), x0.size(), c1.size());
   out()->put_block(odata, c1, x2, x1, x0);
 }
 
@@ -437,8 +437,8 @@ void Task618::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x5, x4, c1, x3);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, c1, x3);
-    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata, x5.size(), x4.size(), c1.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(x5, x4, c1, x3);
+    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata.get(), x5.size(), x4.size(), c1.size(), x3.size());
   }
   out()->put_block(odata, x5, x4, c1, x3);
 }
@@ -448,26 +448,26 @@ void Task619::Task_local::compute() {
   const Index a2 = b(1);
   // tensor label: I570
   std::unique_ptr<double[]> odata = out()->move_block(x2, a2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, a2)]);
+  BlockBuffer odata_sorted(out()->get_size(x2, a2));
   std::fill_n(odata_sorted.get(), out()->get_size(x2, a2), 0.0);
   for (auto& x1 : *range_[1]) {
     for (auto& a1 : *range_[2]) {
       for (auto& x0 : *range_[1]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, x1, a2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, x1, a2)]);
-        sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), x1.size(), a2.size());
+        const double* i0data = in(0)->get_block_view(x0, a1, x1, a2);
+        BlockBuffer i0data_sorted(in(0)->get_size(x0, a1, x1, a2));
+        sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), a1.size(), x1.size(), a2.size());
         // tensor label: I723
-        std::unique_ptr<double[]> i1data = in(1)->get_block(a1, x0, x2, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, x0, x2, x1)]);
-        sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, a1.size(), x0.size(), x2.size(), x1.size());
+        const double* i1data = in(1)->get_block_view(a1, x0, x2, x1);
+        BlockBuffer i1data_sorted(in(1)->get_size(a1, x0, x2, x1));
+        sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted.get(), a1.size(), x0.size(), x2.size(), x1.size());
         dgemm_("T", "N", a2.size(), x2.size(), a1.size()*x0.size()*x1.size(),
-               1.0, i0data_sorted, a1.size()*x0.size()*x1.size(), i1data_sorted, a1.size()*x0.size()*x1.size(),
-               1.0, odata_sorted, a2.size());
+               1.0, i0data_sorted.get(), a1.size()*x0.size()*x1.size(), i1data_sorted.get(), a1.size()*x0.size()*x1.size(),
+               1.0, odata_sorted.get(), a2.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a2.size(), x2.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), a2.size(), x2.size());
   out()->put_block(odata, x2, a2);
 }
 
@@ -478,26 +478,26 @@ void Task620::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I723
   std::unique_ptr<double[]> odata = out()->move_block(a1, x0, x2, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x2, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(a1, x0, x2, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x2, x1), 0.0);
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma59
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x3, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x3, x2, x1)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
+        const double* i0data = in(0)->get_block_view(x5, x0, x4, x3, x2, x1);
+        BlockBuffer i0data_sorted(in(0)->get_size(x5, x0, x4, x3, x2, x1));
+        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
         // tensor label: I724
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a1, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a1, x4, x3)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted, x5.size(), a1.size(), x4.size(), x3.size());
+        const double* i1data = in(1)->get_block_view(x5, a1, x4, x3);
+        BlockBuffer i1data_sorted(in(1)->get_size(x5, a1, x4, x3));
+        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted.get(), x5.size(), a1.size(), x4.size(), x3.size());
         dgemm_("T", "N", x0.size()*x2.size()*x1.size(), a1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x0.size()*x2.size()*x1.size());
+               1.0, i0data_sorted.get(), x5.size()*x4.size()*x3.size(), i1data_sorted.get(), x5.size()*x4.size()*x3.size(),
+               1.0, odata_sorted.get(), x0.size()*x2.size()*x1.size());
       }
     }
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x2.size(), x1.size(), a1.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x2.size(), x1.size(), a1.size());
   out()->put_block(odata, a1, x0, x2, x1);
 }
 
@@ -510,8 +510,8 @@ void Task621::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x5, a1, x4, x3);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, x4, x3);
-    sort_indices<0,1,2,3,1,1,2,1>(i0data, odata, x5.size(), a1.size(), x4.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(x5, a1, x4, x3);
+    sort_indices<0,1,2,3,1,1,2,1>(i0data, odata.get(), x5.size(), a1.size(), x4.size(), x3.size());
   }
   out()->put_block(odata, x5, a1, x4, x3);
 }
@@ -523,8 +523,8 @@ void Task622::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c3, c1);
   {
     // tensor label: I582
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, c3);
-    sort_indices<1,0,1,1,1,1>(i0data, odata, c1.size(), c3.size());
+    const double* i0data = in(0)->get_block_view(c1, c3);
+    sort_indices<1,0,1,1,1,1>(i0data, odata.get(), c1.size(), c3.size());
   }
   out()->put_block(odata, c3, c1);
 }
@@ -534,26 +534,26 @@ void Task623::Task_local::compute() {
   const Index c3 = b(1);
   // tensor label: I582
   std::unique_ptr<double[]> odata = out()->move_block(c1, c3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, c3));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3), 0.0);
   for (auto& x3 : *range_[1]) {
     for (auto& a2 : *range_[2]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a2, c3, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a2, c3, x2)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), a2.size(), c3.size(), x2.size());
+        const double* i0data = in(0)->get_block_view(x3, a2, c3, x2);
+        BlockBuffer i0data_sorted(in(0)->get_size(x3, a2, c3, x2));
+        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a2.size(), c3.size(), x2.size());
         // tensor label: I583
-        std::unique_ptr<double[]> i1data = in(1)->get_block(a2, c1, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, c1, x3, x2)]);
-        sort_indices<2,0,3,1,0,1,1,1>(i1data, i1data_sorted, a2.size(), c1.size(), x3.size(), x2.size());
+        const double* i1data = in(1)->get_block_view(a2, c1, x3, x2);
+        BlockBuffer i1data_sorted(in(1)->get_size(a2, c1, x3, x2));
+        sort_indices<2,0,3,1,0,1,1,1>(i1data, i1data_sorted.get(), a2.size(), c1.size(), x3.size(), x2.size());
         dgemm_("T", "N", c3.size(), c1.size(), a2.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, a2.size()*x3.size()*x2.size(), i1data_sorted, a2.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, c3.size());
+               1.0, i0data_sorted.get(), a2.size()*x3.size()*x2.size(), i1data_sorted.get(), a2.size()*x3.size()*x2.size(),
+               1.0, odata_sorted.get(), c3.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c3.size(), c1.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), c3.size(), c1.size());
   out()->put_block(odata, c1, c3);
 }
 
@@ -564,24 +564,24 @@ void Task624::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I583
   std::unique_ptr<double[]> odata = out()->move_block(a2, c1, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(a2, c1, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, x3, x2), 0.0);
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma35
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      const double* i0data = in(0)->get_block_view(x3, x2, x1, x0);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, x2, x1, x0));
+      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: I584
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, a2, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, a2, c1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), a2.size(), c1.size());
+      const double* i1data = in(1)->get_block_view(x1, x0, a2, c1);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, a2, c1));
+      sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), a2.size(), c1.size());
       dgemm_("T", "N", x3.size()*x2.size(), a2.size()*c1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), x1.size()*x0.size(), i1data_sorted.get(), x1.size()*x0.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), a2.size(), c1.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), a2.size(), c1.size());
   out()->put_block(odata, a2, c1, x3, x2);
 }
 
@@ -594,8 +594,8 @@ void Task625::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x0, x1);
-    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata, c1.size(), a2.size(), x0.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, x0, x1);
+    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata.get(), c1.size(), a2.size(), x0.size(), x1.size());
   }
   out()->put_block(odata, x1, x0, a2, c1);
 }
@@ -605,26 +605,26 @@ void Task626::Task_local::compute() {
   const Index c3 = b(1);
   // tensor label: I582
   std::unique_ptr<double[]> odata = out()->move_block(c1, c3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, c3));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3), 0.0);
   for (auto& a2 : *range_[2]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2, x3, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a2, x3, x2)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, c3.size(), a2.size(), x3.size(), x2.size());
+        const double* i0data = in(0)->get_block_view(c3, a2, x3, x2);
+        BlockBuffer i0data_sorted(in(0)->get_size(c3, a2, x3, x2));
+        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted.get(), c3.size(), a2.size(), x3.size(), x2.size());
         // tensor label: I592
-        std::unique_ptr<double[]> i1data = in(1)->get_block(a2, c1, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, c1, x3, x2)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted, a2.size(), c1.size(), x3.size(), x2.size());
+        const double* i1data = in(1)->get_block_view(a2, c1, x3, x2);
+        BlockBuffer i1data_sorted(in(1)->get_size(a2, c1, x3, x2));
+        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted.get(), a2.size(), c1.size(), x3.size(), x2.size());
         dgemm_("T", "N", c3.size(), c1.size(), a2.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, a2.size()*x3.size()*x2.size(), i1data_sorted, a2.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, c3.size());
+               1.0, i0data_sorted.get(), a2.size()*x3.size()*x2.size(), i1data_sorted.get(), a2.size()*x3.size()*x2.size(),
+               1.0, odata_sorted.get(), c3.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c3.size(), c1.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), c3.size(), c1.size());
   out()->put_block(odata, c1, c3);
 }
 
@@ -635,24 +635,24 @@ void Task627::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I592
   std::unique_ptr<double[]> odata = out()->move_block(a2, c1, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(a2, c1, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, x3, x2), 0.0);
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma35
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      const double* i0data = in(0)->get_block_view(x3, x2, x1, x0);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, x2, x1, x0));
+      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: I593
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, a2, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, a2, c1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), a2.size(), c1.size());
+      const double* i1data = in(1)->get_block_view(x1, x0, a2, c1);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, a2, c1));
+      sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), a2.size(), c1.size());
       dgemm_("T", "N", x3.size()*x2.size(), a2.size()*c1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), x1.size()*x0.size(), i1data_sorted.get(), x1.size()*x0.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), a2.size(), c1.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), a2.size(), c1.size());
   out()->put_block(odata, a2, c1, x3, x2);
 }
 
@@ -665,8 +665,8 @@ void Task628::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x0, x1);
-    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata, c1.size(), a2.size(), x0.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, x0, x1);
+    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata.get(), c1.size(), a2.size(), x0.size(), x1.size());
   }
   out()->put_block(odata, x1, x0, a2, c1);
 }
@@ -678,8 +678,8 @@ void Task629::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a2, a3);
   {
     // tensor label: I585
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a2, a3);
-    sort_indices<0,1,1,1,1,1>(i0data, odata, a2.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(a2, a3);
+    sort_indices<0,1,1,1,1,1>(i0data, odata.get(), a2.size(), a3.size());
   }
   out()->put_block(odata, a2, a3);
 }
@@ -689,26 +689,26 @@ void Task630::Task_local::compute() {
   const Index a3 = b(1);
   // tensor label: I585
   std::unique_ptr<double[]> odata = out()->move_block(a2, a3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, a3)]);
+  BlockBuffer odata_sorted(out()->get_size(a2, a3));
   std::fill_n(odata_sorted.get(), out()->get_size(a2, a3), 0.0);
   for (auto& x3 : *range_[1]) {
     for (auto& c1 : *range_[0]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a3, c1, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a3, c1, x2)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), a3.size(), c1.size(), x2.size());
+        const double* i0data = in(0)->get_block_view(x3, a3, c1, x2);
+        BlockBuffer i0data_sorted(in(0)->get_size(x3, a3, c1, x2));
+        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a3.size(), c1.size(), x2.size());
         // tensor label: I586
-        std::unique_ptr<double[]> i1data = in(1)->get_block(a2, c1, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, c1, x3, x2)]);
-        sort_indices<2,1,3,0,0,1,1,1>(i1data, i1data_sorted, a2.size(), c1.size(), x3.size(), x2.size());
+        const double* i1data = in(1)->get_block_view(a2, c1, x3, x2);
+        BlockBuffer i1data_sorted(in(1)->get_size(a2, c1, x3, x2));
+        sort_indices<2,1,3,0,0,1,1,1>(i1data, i1data_sorted.get(), a2.size(), c1.size(), x3.size(), x2.size());
         dgemm_("T", "N", a3.size(), a2.size(), c1.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, c1.size()*x3.size()*x2.size(), i1data_sorted, c1.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, a3.size());
+               1.0, i0data_sorted.get(), c1.size()*x3.size()*x2.size(), i1data_sorted.get(), c1.size()*x3.size()*x2.size(),
+               1.0, odata_sorted.get(), a3.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a3.size(), a2.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), a3.size(), a2.size());
   out()->put_block(odata, a2, a3);
 }
 
@@ -719,24 +719,24 @@ void Task631::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I586
   std::unique_ptr<double[]> odata = out()->move_block(a2, c1, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(a2, c1, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, x3, x2), 0.0);
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma35
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      const double* i0data = in(0)->get_block_view(x3, x2, x1, x0);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, x2, x1, x0));
+      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: I587
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, a2, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, a2, c1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), a2.size(), c1.size());
+      const double* i1data = in(1)->get_block_view(x1, x0, a2, c1);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, a2, c1));
+      sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), a2.size(), c1.size());
       dgemm_("T", "N", x3.size()*x2.size(), a2.size()*c1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), x1.size()*x0.size(), i1data_sorted.get(), x1.size()*x0.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), a2.size(), c1.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), a2.size(), c1.size());
   out()->put_block(odata, a2, c1, x3, x2);
 }
 
@@ -749,8 +749,8 @@ void Task632::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x0, x1);
-    sort_indices<3,2,1,0,1,1,-1,1>(i0data, odata, c1.size(), a2.size(), x0.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, x0, x1);
+    sort_indices<3,2,1,0,1,1,-1,1>(i0data, odata.get(), c1.size(), a2.size(), x0.size(), x1.size());
   }
   out()->put_block(odata, x1, x0, a2, c1);
 }
@@ -760,26 +760,26 @@ void Task633::Task_local::compute() {
   const Index a3 = b(1);
   // tensor label: I585
   std::unique_ptr<double[]> odata = out()->move_block(a2, a3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, a3)]);
+  BlockBuffer odata_sorted(out()->get_size(a2, a3));
   std::fill_n(odata_sorted.get(), out()->get_size(a2, a3), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a3, x3, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a3, x3, x2)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a3.size(), x3.size(), x2.size());
+        const double* i0data = in(0)->get_block_view(c1, a3, x3, x2);
+        BlockBuffer i0data_sorted(in(0)->get_size(c1, a3, x3, x2));
+        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a3.size(), x3.size(), x2.size());
         // tensor label: I595
-        std::unique_ptr<double[]> i1data = in(1)->get_block(a2, c1, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, c1, x3, x2)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted, a2.size(), c1.size(), x3.size(), x2.size());
+        const double* i1data = in(1)->get_block_view(a2, c1, x3, x2);
+        BlockBuffer i1data_sorted(in(1)->get_size(a2, c1, x3, x2));
+        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted.get(), a2.size(), c1.size(), x3.size(), x2.size());
         dgemm_("T", "N", a3.size(), a2.size(), c1.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, c1.size()*x3.size()*x2.size(), i1data_sorted, c1.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, a3.size());
+               1.0, i0data_sorted.get(), c1.size()*x3.size()*x2.size(), i1data_sorted.get(), c1.size()*x3.size()*x2.size(),
+               1.0, odata_sorted.get(), a3.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a3.size(), a2.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), a3.size(), a2.size());
   out()->put_block(odata, a2, a3);
 }
 
@@ -790,24 +790,24 @@ void Task634::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I595
   std::unique_ptr<double[]> odata = out()->move_block(a2, c1, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(a2, c1, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, x3, x2), 0.0);
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma35
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      const double* i0data = in(0)->get_block_view(x3, x2, x1, x0);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, x2, x1, x0));
+      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: I596
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, a2, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, a2, c1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), a2.size(), c1.size());
+      const double* i1data = in(1)->get_block_view(x1, x0, a2, c1);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, a2, c1));
+      sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), a2.size(), c1.size());
       dgemm_("T", "N", x3.size()*x2.size(), a2.size()*c1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), x1.size()*x0.size(), i1data_sorted.get(), x1.size()*x0.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), a2.size(), c1.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), a2.size(), c1.size());
   out()->put_block(odata, a2, c1, x3, x2);
 }
 
@@ -820,8 +820,8 @@ void Task635::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x0, x1);
-    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata, c1.size(), a2.size(), x0.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, x0, x1);
+    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata.get(), c1.size(), a2.size(), x0.size(), x1.size());
   }
   out()->put_block(odata, x1, x0, a2, c1);
 }
@@ -831,26 +831,26 @@ void Task636::Task_local::compute() {
   const Index a3 = b(1);
   // tensor label: I585
   std::unique_ptr<double[]> odata = out()->move_block(a2, a3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, a3)]);
+  BlockBuffer odata_sorted(out()->get_size(a2, a3));
   std::fill_n(odata_sorted.get(), out()->get_size(a2, a3), 0.0);
   for (auto& x3 : *range_[1]) {
     for (auto& a1 : *range_[2]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, x2, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, x2, a3)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), x2.size(), a3.size());
+        const double* i0data = in(0)->get_block_view(x3, a1, x2, a3);
+        BlockBuffer i0data_sorted(in(0)->get_size(x3, a1, x2, a3));
+        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a1.size(), x2.size(), a3.size());
         // tensor label: I732
-        std::unique_ptr<double[]> i1data = in(1)->get_block(a2, a1, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, a1, x3, x2)]);
-        sort_indices<2,1,3,0,0,1,1,1>(i1data, i1data_sorted, a2.size(), a1.size(), x3.size(), x2.size());
+        const double* i1data = in(1)->get_block_view(a2, a1, x3, x2);
+        BlockBuffer i1data_sorted(in(1)->get_size(a2, a1, x3, x2));
+        sort_indices<2,1,3,0,0,1,1,1>(i1data, i1data_sorted.get(), a2.size(), a1.size(), x3.size(), x2.size());
         dgemm_("T", "N", a3.size(), a2.size(), a1.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, a1.size()*x3.size()*x2.size(), i1data_sorted, a1.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, a3.size());
+               1.0, i0data_sorted.get(), a1.size()*x3.size()*x2.size(), i1data_sorted.get(), a1.size()*x3.size()*x2.size(),
+               1.0, odata_sorted.get(), a3.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a3.size(), a2.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), a3.size(), a2.size());
   out()->put_block(odata, a2, a3);
 }
 
@@ -861,24 +861,24 @@ void Task637::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I732
   std::unique_ptr<double[]> odata = out()->move_block(a2, a1, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, a1, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(a2, a1, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(a2, a1, x3, x2), 0.0);
   for (auto& x0 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: Gamma60
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+      const double* i0data = in(0)->get_block_view(x3, x0, x2, x1);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, x0, x2, x1));
+      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x0.size(), x2.size(), x1.size());
       // tensor label: I733
-      std::unique_ptr<double[]> i1data = in(1)->get_block(a2, x1, a1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, x1, a1, x0)]);
-      sort_indices<3,1,0,2,0,1,1,1>(i1data, i1data_sorted, a2.size(), x1.size(), a1.size(), x0.size());
+      const double* i1data = in(1)->get_block_view(a2, x1, a1, x0);
+      BlockBuffer i1data_sorted(in(1)->get_size(a2, x1, a1, x0));
+      sort_indices<3,1,0,2,0,1,1,1>(i1data, i1data_sorted.get(), a2.size(), x1.size(), a1.size(), x0.size());
       dgemm_("T", "N", x3.size()*x2.size(), a2.size()*a1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), x1.size()*x0.size(), i1data_sorted.get(), x1.size()*x0.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), a2.size(), a1.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), a2.size(), a1.size());
   out()->put_block(odata, a2, a1, x3, x2);
 }
 
@@ -891,8 +891,8 @@ void Task638::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a2, x1, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, x1, a2);
-    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata, x0.size(), a1.size(), x1.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, x1, a2);
+    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata.get(), x0.size(), a1.size(), x1.size(), a2.size());
   }
   out()->put_block(odata, a2, x1, a1, x0);
 }
@@ -904,8 +904,8 @@ void Task639::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x2, c1);
   {
     // tensor label: I597
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x2, c1);
-    sort_indices<0,1,1,1,1,1>(i0data, odata, x2.size(), c1.size());
+    const double* i0data = in(0)->get_block_view(x2, c1);
+    sort_indices<0,1,1,1,1,1>(i0data, odata.get(), x2.size(), c1.size());
   }
   out()->put_block(odata, x2, c1);
 }
@@ -915,26 +915,26 @@ void Task640::Task_local::compute() {
   const Index c1 = b(1);
   // tensor label: I597
   std::unique_ptr<double[]> odata = out()->move_block(x2, c1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, c1)]);
+  BlockBuffer odata_sorted(out()->get_size(x2, c1));
   std::fill_n(odata_sorted.get(), out()->get_size(x2, c1), 0.0);
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       for (auto& a2 : *range_[2]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x0, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, x0, x1)]);
-        sort_indices<3,2,1,0,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), x0.size(), x1.size());
+        const double* i0data = in(0)->get_block_view(c1, a2, x0, x1);
+        BlockBuffer i0data_sorted(in(0)->get_size(c1, a2, x0, x1));
+        sort_indices<3,2,1,0,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size(), x0.size(), x1.size());
         // tensor label: I598
-        std::unique_ptr<double[]> i1data = in(1)->get_block(a2, x2, x1, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, x2, x1, x0)]);
-        sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, a2.size(), x2.size(), x1.size(), x0.size());
+        const double* i1data = in(1)->get_block_view(a2, x2, x1, x0);
+        BlockBuffer i1data_sorted(in(1)->get_size(a2, x2, x1, x0));
+        sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted.get(), a2.size(), x2.size(), x1.size(), x0.size());
         dgemm_("T", "N", c1.size(), x2.size(), a2.size()*x1.size()*x0.size(),
-               1.0, i0data_sorted, a2.size()*x1.size()*x0.size(), i1data_sorted, a2.size()*x1.size()*x0.size(),
-               1.0, odata_sorted, c1.size());
+               1.0, i0data_sorted.get(), a2.size()*x1.size()*x0.size(), i1data_sorted.get(), a2.size()*x1.size()*x0.size(),
+               1.0, odata_sorted.get(), c1.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c1.size(), x2.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), c1.size(), x2.size());
   out()->put_block(odata, x2, c1);
 }
 
@@ -945,26 +945,26 @@ void Task641::Task_local::compute() {
   const Index x0 = b(3);
   // tensor label: I598
   std::unique_ptr<double[]> odata = out()->move_block(a2, x2, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, x2, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(a2, x2, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(a2, x2, x1, x0), 0.0);
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma51
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x2, x4, x3, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x2, x4, x3, x1, x0)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x2.size(), x4.size(), x3.size(), x1.size(), x0.size());
+        const double* i0data = in(0)->get_block_view(x5, x2, x4, x3, x1, x0);
+        BlockBuffer i0data_sorted(in(0)->get_size(x5, x2, x4, x3, x1, x0));
+        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), x2.size(), x4.size(), x3.size(), x1.size(), x0.size());
         // tensor label: I599
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a2, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a2, x4, x3)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted, x5.size(), a2.size(), x4.size(), x3.size());
+        const double* i1data = in(1)->get_block_view(x5, a2, x4, x3);
+        BlockBuffer i1data_sorted(in(1)->get_size(x5, a2, x4, x3));
+        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted.get(), x5.size(), a2.size(), x4.size(), x3.size());
         dgemm_("T", "N", x2.size()*x1.size()*x0.size(), a2.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+               1.0, i0data_sorted.get(), x5.size()*x4.size()*x3.size(), i1data_sorted.get(), x5.size()*x4.size()*x3.size(),
+               1.0, odata_sorted.get(), x2.size()*x1.size()*x0.size());
       }
     }
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size(), x0.size(), a2.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x2.size(), x1.size(), x0.size(), a2.size());
   out()->put_block(odata, a2, x2, x1, x0);
 }
 
@@ -977,8 +977,8 @@ void Task642::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x5, a2, x4, x3);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a2, x4, x3);
-    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata, x5.size(), a2.size(), x4.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(x5, a2, x4, x3);
+    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata.get(), x5.size(), a2.size(), x4.size(), x3.size());
   }
   out()->put_block(odata, x5, a2, x4, x3);
 }
@@ -990,8 +990,8 @@ void Task643::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a1, a2);
   {
     // tensor label: I621
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a1, a2);
-    sort_indices<0,1,1,1,1,1>(i0data, odata, a1.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(a1, a2);
+    sort_indices<0,1,1,1,1,1>(i0data, odata.get(), a1.size(), a2.size());
   }
   out()->put_block(odata, a1, a2);
 }
@@ -1001,26 +1001,26 @@ void Task644::Task_local::compute() {
   const Index a2 = b(1);
   // tensor label: I621
   std::unique_ptr<double[]> odata = out()->move_block(a1, a2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, a2)]);
+  BlockBuffer odata_sorted(out()->get_size(a1, a2));
   std::fill_n(odata_sorted.get(), out()->get_size(a1, a2), 0.0);
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a2, x4, x3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a2, x4, x3)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x5.size(), a2.size(), x4.size(), x3.size());
+        const double* i0data = in(0)->get_block_view(x5, a2, x4, x3);
+        BlockBuffer i0data_sorted(in(0)->get_size(x5, a2, x4, x3));
+        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), a2.size(), x4.size(), x3.size());
         // tensor label: I622
-        std::unique_ptr<double[]> i1data = in(1)->get_block(a1, x5, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, x5, x4, x3)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted, a1.size(), x5.size(), x4.size(), x3.size());
+        const double* i1data = in(1)->get_block_view(a1, x5, x4, x3);
+        BlockBuffer i1data_sorted(in(1)->get_size(a1, x5, x4, x3));
+        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted.get(), a1.size(), x5.size(), x4.size(), x3.size());
         dgemm_("T", "N", a2.size(), a1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, a2.size());
+               1.0, i0data_sorted.get(), x5.size()*x4.size()*x3.size(), i1data_sorted.get(), x5.size()*x4.size()*x3.size(),
+               1.0, odata_sorted.get(), a2.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a2.size(), a1.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), a2.size(), a1.size());
   out()->put_block(odata, a1, a2);
 }
 
@@ -1031,26 +1031,26 @@ void Task645::Task_local::compute() {
   const Index x3 = b(3);
   // tensor label: I622
   std::unique_ptr<double[]> odata = out()->move_block(a1, x5, x4, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x5, x4, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(a1, x5, x4, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x5, x4, x3), 0.0);
   for (auto& x0 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma59
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x3, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x3, x2, x1)]);
-        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
+        const double* i0data = in(0)->get_block_view(x5, x0, x4, x3, x2, x1);
+        BlockBuffer i0data_sorted(in(0)->get_size(x5, x0, x4, x3, x2, x1));
+        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
         // tensor label: I623
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x2, x1, a1, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, x1, a1, x0)]);
-        sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, x2.size(), x1.size(), a1.size(), x0.size());
+        const double* i1data = in(1)->get_block_view(x2, x1, a1, x0);
+        BlockBuffer i1data_sorted(in(1)->get_size(x2, x1, a1, x0));
+        sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), x1.size(), a1.size(), x0.size());
         dgemm_("T", "N", x5.size()*x4.size()*x3.size(), a1.size(), x2.size()*x1.size()*x0.size(),
-               1.0, i0data_sorted, x2.size()*x1.size()*x0.size(), i1data_sorted, x2.size()*x1.size()*x0.size(),
-               1.0, odata_sorted, x5.size()*x4.size()*x3.size());
+               1.0, i0data_sorted.get(), x2.size()*x1.size()*x0.size(), i1data_sorted.get(), x2.size()*x1.size()*x0.size(),
+               1.0, odata_sorted.get(), x5.size()*x4.size()*x3.size());
       }
     }
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), a1.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x5.size(), x4.size(), x3.size(), a1.size());
   out()->put_block(odata, a1, x5, x4, x3);
 }
 
@@ -1063,8 +1063,8 @@ void Task646::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x2, x1, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, x1, x2);
-    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata, x0.size(), a1.size(), x1.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, x1, x2);
+    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata.get(), x0.size(), a1.size(), x1.size(), x2.size());
   }
   out()->put_block(odata, x2, x1, a1, x0);
 }
@@ -1076,8 +1076,8 @@ void Task647::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a2, x0);
   {
     // tensor label: I633
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a2, x0);
-    sort_indices<0,1,1,1,1,1>(i0data, odata, a2.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(a2, x0);
+    sort_indices<0,1,1,1,1,1>(i0data, odata.get(), a2.size(), x0.size());
   }
   out()->put_block(odata, a2, x0);
 }
@@ -1087,22 +1087,22 @@ void Task648::Task_local::compute() {
   const Index x0 = b(1);
   // tensor label: I633
   std::unique_ptr<double[]> odata = out()->move_block(a2, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(a2, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(a2, x0), 0.0);
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma16
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x0, x1);
+    BlockBuffer i0data_sorted(in(0)->get_size(x0, x1));
+    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), x1.size());
     // tensor label: I634
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a2, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, x1)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, a2.size(), x1.size());
+    const double* i1data = in(1)->get_block_view(a2, x1);
+    BlockBuffer i1data_sorted(in(1)->get_size(a2, x1));
+    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), a2.size(), x1.size());
     dgemm_("T", "N", x0.size(), a2.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+           1.0, i0data_sorted.get(), x1.size(), i1data_sorted.get(), x1.size(),
+           1.0, odata_sorted.get(), x0.size());
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), a2.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), a2.size());
   out()->put_block(odata, a2, x0);
 }
 
@@ -1111,26 +1111,26 @@ void Task649::Task_local::compute() {
   const Index x1 = b(1);
   // tensor label: I634
   std::unique_ptr<double[]> odata = out()->move_block(a2, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(a2, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(a2, x1), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& a4 : *range_[2]) {
       for (auto& c3 : *range_[0]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a4, c3, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a4, c3, x1)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a4.size(), c3.size(), x1.size());
+        const double* i0data = in(0)->get_block_view(c1, a4, c3, x1);
+        BlockBuffer i0data_sorted(in(0)->get_size(c1, a4, c3, x1));
+        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a4.size(), c3.size(), x1.size());
         // tensor label: I635
-        std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c3, a2, c1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c3, a2, c1)]);
-        sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, a4.size(), c3.size(), a2.size(), c1.size());
+        const double* i1data = in(1)->get_block_view(a4, c3, a2, c1);
+        BlockBuffer i1data_sorted(in(1)->get_size(a4, c3, a2, c1));
+        sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), c3.size(), a2.size(), c1.size());
         dgemm_("T", "N", x1.size(), a2.size(), a4.size()*c3.size()*c1.size(),
-               1.0, i0data_sorted, a4.size()*c3.size()*c1.size(), i1data_sorted, a4.size()*c3.size()*c1.size(),
-               1.0, odata_sorted, x1.size());
+               1.0, i0data_sorted.get(), a4.size()*c3.size()*c1.size(), i1data_sorted.get(), a4.size()*c3.size()*c1.size(),
+               1.0, odata_sorted.get(), x1.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), a2.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), a2.size());
   out()->put_block(odata, a2, x1);
 }
 
@@ -42,8 +42,8 @@ void Task650::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a4, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata, c1.size(), a2.size(), c3.size(), a4.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, a4);
+    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), a4.size());
   }
   out()->put_block(odata, a4, c3, a2, c1);
 }
@@ -55,8 +55,8 @@ void Task651::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a4, x0);
   {
     // tensor label: I636
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a4, x0);
-    sort_indices<0,1,1,1,1,1>(i0data, odata, a4.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(a4, x0);
+    sort_indices<0,1,1,1,1,1>(i0data, odata.get(), a4.size(), x0.size());
   }
   out()->put_block(odata, a4, x0);
 }
@@ -66,22 +66,22 @@ void Task652::Task_local::compute() {
   const Index x0 = b(1);
   // tensor label: I636
   std::unique_ptr<double[]> odata = out()->move_block(a4, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(a4, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(a4, x0), 0.0);
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma16
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x0, x1);
+    BlockBuffer i0data_sorted(in(0)->get_size(x0, x1));
+    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), x1.size());
     // tensor label: I637
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a4, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, x1)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, a4.size(), x1.size());
+    const double* i1data = in(1)->get_block_view(a4, x1);
+    BlockBuffer i1data_sorted(in(1)->get_size(a4, x1));
+    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), x1.size());
     dgemm_("T", "N", x0.size(), a4.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+           1.0, i0data_sorted.get(), x1.size(), i1data_sorted.get(), x1.size(),
+           1.0, odata_sorted.get(), x0.size());
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), a4.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), a4.size());
   out()->put_block(odata, a4, x0);
 }
 
@@ -90,26 +90,26 @@ void Task653::Task_local::compute() {
   const Index x1 = b(1);
   // tensor label: I637
   std::unique_ptr<double[]> odata = out()->move_block(a4, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(a4, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(a4, x1), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c3 : *range_[0]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, x1)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), x1.size());
+        const double* i0data = in(0)->get_block_view(c1, a2, c3, x1);
+        BlockBuffer i0data_sorted(in(0)->get_size(c1, a2, c3, x1));
+        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size(), c3.size(), x1.size());
         // tensor label: I638
-        std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c3, a2, c1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c3, a2, c1)]);
-        sort_indices<3,2,1,0,0,1,1,1>(i1data, i1data_sorted, a4.size(), c3.size(), a2.size(), c1.size());
+        const double* i1data = in(1)->get_block_view(a4, c3, a2, c1);
+        BlockBuffer i1data_sorted(in(1)->get_size(a4, c3, a2, c1));
+        sort_indices<3,2,1,0,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), c3.size(), a2.size(), c1.size());
         dgemm_("T", "N", x1.size(), a4.size(), c3.size()*a2.size()*c1.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*c1.size(), i1data_sorted, c3.size()*a2.size()*c1.size(),
-               1.0, odata_sorted, x1.size());
+               1.0, i0data_sorted.get(), c3.size()*a2.size()*c1.size(), i1data_sorted.get(), c3.size()*a2.size()*c1.size(),
+               1.0, odata_sorted.get(), x1.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), a4.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), a4.size());
   out()->put_block(odata, a4, x1);
 }
 
@@ -122,8 +122,8 @@ void Task654::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a4, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata, c1.size(), a2.size(), c3.size(), a4.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, a4);
+    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), a4.size());
   }
   out()->put_block(odata, a4, c3, a2, c1);
 }
@@ -135,8 +135,8 @@ void Task655::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a4, c3);
   {
     // tensor label: I642
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a4, c3);
-    sort_indices<0,1,1,1,1,1>(i0data, odata, a4.size(), c3.size());
+    const double* i0data = in(0)->get_block_view(a4, c3);
+    sort_indices<0,1,1,1,1,1>(i0data, odata.get(), a4.size(), c3.size());
   }
   out()->put_block(odata, a4, c3);
 }
@@ -146,24 +146,24 @@ void Task656::Task_local::compute() {
   const Index c3 = b(1);
   // tensor label: I642
   std::unique_ptr<double[]> odata = out()->move_block(a4, c3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, c3)]);
+  BlockBuffer odata_sorted(out()->get_size(a4, c3));
   std::fill_n(odata_sorted.get(), out()->get_size(a4, c3), 0.0);
   for (auto& a2 : *range_[2]) {
     for (auto& c1 : *range_[0]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, a4)]);
-      sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
+      const double* i0data = in(0)->get_block_view(c1, a2, c3, a4);
+      BlockBuffer i0data_sorted(in(0)->get_size(c1, a2, c3, a4));
+      sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size(), c3.size(), a4.size());
       // tensor label: I643
-      std::unique_ptr<double[]> i1data = in(1)->get_block(a2, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, c1)]);
-      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a2.size(), c1.size());
+      const double* i1data = in(1)->get_block_view(a2, c1);
+      BlockBuffer i1data_sorted(in(1)->get_size(a2, c1));
+      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a2.size(), c1.size());
       dgemm_("T", "N", a4.size()*c3.size(), 1, a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, a4.size()*c3.size());
+             1.0, i0data_sorted.get(), a2.size()*c1.size(), i1data_sorted.get(), a2.size()*c1.size(),
+             1.0, odata_sorted.get(), a4.size()*c3.size());
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c3.size(), a4.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), c3.size(), a4.size());
   out()->put_block(odata, a4, c3);
 }
 
@@ -172,24 +172,24 @@ void Task657::Task_local::compute() {
   const Index c1 = b(1);
   // tensor label: I643
   std::unique_ptr<double[]> odata = out()->move_block(a2, c1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1)]);
+  BlockBuffer odata_sorted(out()->get_size(a2, c1));
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1), 0.0);
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma38
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+      const double* i0data = in(0)->get_block_view(x1, x0);
+      BlockBuffer i0data_sorted(in(0)->get_size(x1, x0));
+      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), x0.size());
       // tensor label: I644
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a2, c1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a2, c1, x0)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x1.size(), a2.size(), c1.size(), x0.size());
+      const double* i1data = in(1)->get_block_view(x1, a2, c1, x0);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, a2, c1, x0));
+      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), a2.size(), c1.size(), x0.size());
       dgemm_("T", "N", 1, a2.size()*c1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, 1);
+             1.0, i0data_sorted.get(), x1.size()*x0.size(), i1data_sorted.get(), x1.size()*x0.size(),
+             1.0, odata_sorted.get(), 1);
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, a2.size(), c1.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), a2.size(), c1.size());
   out()->put_block(odata, a2, c1);
 }
 
@@ -202,13 +202,13 @@ void Task658::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, a2, c1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a2, c1, x0);
-    sort_indices<0,1,2,3,1,1,-4,1>(i0data, odata, x1.size(), a2.size(), c1.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(x1, a2, c1, x0);
+    sort_indices<0,1,2,3,1,1,-4,1>(i0data, odata.get(), x1.size(), a2.size(), c1.size(), x0.size());
   }
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i1data = in(0)->get_block(c1, a2, x1, x0);
-    sort_indices<2,1,0,3,1,1,8,1>(i1data, odata, c1.size(), a2.size(), x1.size(), x0.size());
+    const double* i1data = in(0)->get_block_view(c1, a2, x1, x0);
+    sort_indices<2,1,0,3,1,1,8,1>(i1data, odata.get(), c1.size(), a2.size(), x1.size(), x0.size());
   }
   out()->put_block(odata, x1, a2, c1, x0);
 }
@@ -220,8 +220,8 @@ void Task659::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x0, x1);
   {
     // tensor label: I651
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    sort_indices<1,0,1,1,1,1>(i0data, odata, x1.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(x1, x0);
+    sort_indices<1,0,1,1,1,1>(i0data, odata.get(), x1.size(), x0.size());
   }
   out()->put_block(odata, x0, x1);
 }
@@ -231,42 +231,42 @@ void Task660::Task_local::compute() {
   const Index x0 = b(1);
   // tensor label: I651
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
   // tensor label: Gamma38
-  std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-  std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-  sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+  const double* i0data = in(0)->get_block_view(x1, x0);
+  BlockBuffer i0data_sorted(in(0)->get_size(x1, x0));
+  sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), x0.size());
   // tensor label: I652
-  std::unique_ptr<double[]> i1data = in(1)->get_block();
-  std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size()]);
-  sort_indices<0,1,1,1>(i1data, i1data_sorted);
+  const double* i1data = in(1)->get_block_view();
+  BlockBuffer i1data_sorted(in(1)->get_size());
+  sort_indices<0,1,1,1>(i1data, i1data_sorted.get());
   dgemm_("T", "N", x1.size()*x0.size(), 1, 1,
-         1.0, i0data_sorted, 1, i1data_sorted, 1,
-         1.0, odata_sorted, x1.size()*x0.size());
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
+         1.0, i0data_sorted.get(), 1, i1data_sorted.get(), 1,
+         1.0, odata_sorted.get(), x1.size()*x0.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0);
 }
 
 void Task661::Task_local::compute() {
   // tensor label: I652
   std::unique_ptr<double[]> odata = out()->move_block();
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size()]);
+  BlockBuffer odata_sorted(out()->get_size());
   std::fill_n(odata_sorted.get(), out()->get_size(), 0.0);
   const Index a2 = b(0);
   const Index c3 = b(1);
   const Index a4 = b(2);
   const Index c1 = b(3);
   // tensor label: t2
-  std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a4, c3, a2);
-  std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a4, c3, a2)]);
-  sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a4.size(), c3.size(), a2.size());
+  const double* i0data = in(0)->get_block_view(c1, a4, c3, a2);
+  BlockBuffer i0data_sorted(in(0)->get_size(c1, a4, c3, a2));
+  sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a4.size(), c3.size(), a2.size());
   // tensor label: I653
-  std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c3, a2, c1);
-  std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c3, a2, c1)]);
-  sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, a4.size(), c3.size(), a2.size(), c1.size());
-  odata_sorted[0] += ddot_(a4.size()*c3.size()*a2.size()*c1.size(), i0data_sorted, 1, i1data_sorted, 1);
-  sort_indices<1,1,1,1>(odata_sorted, odata);
+  const double* i1data = in(1)->get_block_view(a4, c3, a2, c1);
+  BlockBuffer i1data_sorted(in(1)->get_size(a4, c3, a2, c1));
+  sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), c3.size(), a2.size(), c1.size());
+  odata_sorted[0] += ddot_(a4.size()*c3.size()*a2.size()*c1.size(), i0data_sorted.get(), 1, i1data_sorted.get(), 1);
+  sort_indices<1,1,1,1>(odata_sorted.get(), odata.get());
   out()->put_block(odata);
 }
 
@@ -279,8 +279,8 @@ void Task662::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a4, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-    sort_indices<3,2,1,0,1,1,-4,1>(i0data, odata, c1.size(), a2.size(), c3.size(), a4.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, a4);
+    sort_indices<3,2,1,0,1,1,-4,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), a4.size());
   }
   out()->put_block(odata, a4, c3, a2, c1);
 }
@@ -288,22 +288,22 @@ void Task662::Task_local::compute() {
 void Task663::Task_local::compute() {
   // tensor label: I652
   std::unique_ptr<double[]> odata = out()->move_block();
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size()]);
+  BlockBuffer odata_sorted(out()->get_size());
   std::fill_n(odata_sorted.get(), out()->get_size(), 0.0);
   const Index a4 = b(0);
   const Index c3 = b(1);
   const Index a2 = b(2);
   const Index c1 = b(3);
   // tensor label: t2
-  std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-  std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, a4)]);
-  sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
+  const double* i0data = in(0)->get_block_view(c1, a2, c3, a4);
+  BlockBuffer i0data_sorted(in(0)->get_size(c1, a2, c3, a4));
+  sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size(), c3.size(), a4.size());
   // tensor label: I656
-  std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c3, a2, c1);
-  std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c3, a2, c1)]);
-  sort_indices<3,2,1,0,0,1,1,1>(i1data, i1data_sorted, a4.size(), c3.size(), a2.size(), c1.size());
-  odata_sorted[0] += ddot_(a4.size()*c3.size()*a2.size()*c1.size(), i0data_sorted, 1, i1data_sorted, 1);
-  sort_indices<1,1,1,1>(odata_sorted, odata);
+  const double* i1data = in(1)->get_block_view(a4, c3, a2, c1);
+  BlockBuffer i1data_sorted(in(1)->get_size(a4, c3, a2, c1));
+  sort_indices<3,2,1,0,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), c3.size(), a2.size(), c1.size());
+  odata_sorted[0] += ddot_(a4.size()*c3.size()*a2.size()*c1.size(), i0data_sorted.get(), 1, i1data_sorted.get(), 1);
+  sort_indices<1,1,1,1>(odata_sorted.get(), odata.get());
   out()->put_block(odata);
 }
 
@@ -316,8 +316,8 @@ void Task664::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a4, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-    sort_indices<3,2,1,0,1,1,8,1>(i0data, odata, c1.size(), a2.size(), c3.size(), a4.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, a4);
+    sort_indices<3,2,1,0,1,1,8,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), a4.size());
   }
   out()->put_block(odata, a4, c3, a2, c1);
 }
@@ -329,8 +329,8 @@ void Task665::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c5, c3);
   {
     // tensor label: I657
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c3, c5);
-    sort_indices<1,0,1,1,1,1>(i0data, odata, c3.size(), c5.size());
+    const double* i0data = in(0)->get_block_view(c3, c5);
+    sort_indices<1,0,1,1,1,1>(i0data, odata.get(), c3.size(), c5.size());
   }
   out()->put_block(odata, c5, c3);
 }
@@ -340,26 +340,26 @@ void Task666::Task_local::compute() {
   const Index c5 = b(1);
   // tensor label: I657
   std::unique_ptr<double[]> odata = out()->move_block(c3, c5);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, c5)]);
+  BlockBuffer odata_sorted(out()->get_size(c3, c5));
   std::fill_n(odata_sorted.get(), out()->get_size(c3, c5), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& a4 : *range_[2]) {
       for (auto& a2 : *range_[2]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a4, c5, a2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a4, c5, a2)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a4.size(), c5.size(), a2.size());
+        const double* i0data = in(0)->get_block_view(c1, a4, c5, a2);
+        BlockBuffer i0data_sorted(in(0)->get_size(c1, a4, c5, a2));
+        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a4.size(), c5.size(), a2.size());
         // tensor label: I658
-        std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c3, a2, c1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c3, a2, c1)]);
-        sort_indices<3,0,2,1,0,1,1,1>(i1data, i1data_sorted, a4.size(), c3.size(), a2.size(), c1.size());
+        const double* i1data = in(1)->get_block_view(a4, c3, a2, c1);
+        BlockBuffer i1data_sorted(in(1)->get_size(a4, c3, a2, c1));
+        sort_indices<3,0,2,1,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), c3.size(), a2.size(), c1.size());
         dgemm_("T", "N", c5.size(), c3.size(), a4.size()*a2.size()*c1.size(),
-               1.0, i0data_sorted, a4.size()*a2.size()*c1.size(), i1data_sorted, a4.size()*a2.size()*c1.size(),
-               1.0, odata_sorted, c5.size());
+               1.0, i0data_sorted.get(), a4.size()*a2.size()*c1.size(), i1data_sorted.get(), a4.size()*a2.size()*c1.size(),
+               1.0, odata_sorted.get(), c5.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c5.size(), c3.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), c5.size(), c3.size());
   out()->put_block(odata, c3, c5);
 }
 
@@ -372,8 +372,8 @@ void Task667::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a4, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-    sort_indices<3,2,1,0,1,1,8,1>(i0data, odata, c1.size(), a2.size(), c3.size(), a4.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, a4);
+    sort_indices<3,2,1,0,1,1,8,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), a4.size());
   }
   out()->put_block(odata, a4, c3, a2, c1);
 }
@@ -383,26 +383,26 @@ void Task668::Task_local::compute() {
   const Index c5 = b(1);
   // tensor label: I657
   std::unique_ptr<double[]> odata = out()->move_block(c3, c5);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, c5)]);
+  BlockBuffer odata_sorted(out()->get_size(c3, c5));
   std::fill_n(odata_sorted.get(), out()->get_size(c3, c5), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& a4 : *range_[2]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c5, a4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c5, a4)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c5.size(), a4.size());
+        const double* i0data = in(0)->get_block_view(c1, a2, c5, a4);
+        BlockBuffer i0data_sorted(in(0)->get_size(c1, a2, c5, a4));
+        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size(), c5.size(), a4.size());
         // tensor label: I660
-        std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c3, a2, c1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c3, a2, c1)]);
-        sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted, a4.size(), c3.size(), a2.size(), c1.size());
+        const double* i1data = in(1)->get_block_view(a4, c3, a2, c1);
+        BlockBuffer i1data_sorted(in(1)->get_size(a4, c3, a2, c1));
+        sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), c3.size(), a2.size(), c1.size());
         dgemm_("T", "N", c5.size(), c3.size(), a4.size()*a2.size()*c1.size(),
-               1.0, i0data_sorted, a4.size()*a2.size()*c1.size(), i1data_sorted, a4.size()*a2.size()*c1.size(),
-               1.0, odata_sorted, c5.size());
+               1.0, i0data_sorted.get(), a4.size()*a2.size()*c1.size(), i1data_sorted.get(), a4.size()*a2.size()*c1.size(),
+               1.0, odata_sorted.get(), c5.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c5.size(), c3.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), c5.size(), c3.size());
   out()->put_block(odata, c3, c5);
 }
 
@@ -415,8 +415,8 @@ void Task669::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a4, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-    sort_indices<3,2,1,0,1,1,-16,1>(i0data, odata, c1.size(), a2.size(), c3.size(), a4.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, a4);
+    sort_indices<3,2,1,0,1,1,-16,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), a4.size());
   }
   out()->put_block(odata, a4, c3, a2, c1);
 }
@@ -428,8 +428,8 @@ void Task670::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a4, a5);
   {
     // tensor label: I661
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a4, a5);
-    sort_indices<0,1,1,1,1,1>(i0data, odata, a4.size(), a5.size());
+    const double* i0data = in(0)->get_block_view(a4, a5);
+    sort_indices<0,1,1,1,1,1>(i0data, odata.get(), a4.size(), a5.size());
   }
   out()->put_block(odata, a4, a5);
 }
@@ -439,26 +439,26 @@ void Task671::Task_local::compute() {
   const Index a5 = b(1);
   // tensor label: I661
   std::unique_ptr<double[]> odata = out()->move_block(a4, a5);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, a5)]);
+  BlockBuffer odata_sorted(out()->get_size(a4, a5));
   std::fill_n(odata_sorted.get(), out()->get_size(a4, a5), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& c3 : *range_[0]) {
       for (auto& a2 : *range_[2]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a5, c3, a2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a5, c3, a2)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a5.size(), c3.size(), a2.size());
+        const double* i0data = in(0)->get_block_view(c1, a5, c3, a2);
+        BlockBuffer i0data_sorted(in(0)->get_size(c1, a5, c3, a2));
+        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a5.size(), c3.size(), a2.size());
         // tensor label: I662
-        std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c3, a2, c1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c3, a2, c1)]);
-        sort_indices<3,1,2,0,0,1,1,1>(i1data, i1data_sorted, a4.size(), c3.size(), a2.size(), c1.size());
+        const double* i1data = in(1)->get_block_view(a4, c3, a2, c1);
+        BlockBuffer i1data_sorted(in(1)->get_size(a4, c3, a2, c1));
+        sort_indices<3,1,2,0,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), c3.size(), a2.size(), c1.size());
         dgemm_("T", "N", a5.size(), a4.size(), c3.size()*a2.size()*c1.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*c1.size(), i1data_sorted, c3.size()*a2.size()*c1.size(),
-               1.0, odata_sorted, a5.size());
+               1.0, i0data_sorted.get(), c3.size()*a2.size()*c1.size(), i1data_sorted.get(), c3.size()*a2.size()*c1.size(),
+               1.0, odata_sorted.get(), a5.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a5.size(), a4.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), a5.size(), a4.size());
   out()->put_block(odata, a4, a5);
 }
 
@@ -471,8 +471,8 @@ void Task672::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a4, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-    sort_indices<3,2,1,0,1,1,-8,1>(i0data, odata, c1.size(), a2.size(), c3.size(), a4.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, a4);
+    sort_indices<3,2,1,0,1,1,-8,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), a4.size());
   }
   out()->put_block(odata, a4, c3, a2, c1);
 }
@@ -482,26 +482,26 @@ void Task673::Task_local::compute() {
   const Index a5 = b(1);
   // tensor label: I661
   std::unique_ptr<double[]> odata = out()->move_block(a4, a5);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, a5)]);
+  BlockBuffer odata_sorted(out()->get_size(a4, a5));
   std::fill_n(odata_sorted.get(), out()->get_size(a4, a5), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c3 : *range_[0]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a5);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, a5)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), a5.size());
+        const double* i0data = in(0)->get_block_view(c1, a2, c3, a5);
+        BlockBuffer i0data_sorted(in(0)->get_size(c1, a2, c3, a5));
+        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size(), c3.size(), a5.size());
         // tensor label: I664
-        std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c3, a2, c1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c3, a2, c1)]);
-        sort_indices<3,2,1,0,0,1,1,1>(i1data, i1data_sorted, a4.size(), c3.size(), a2.size(), c1.size());
+        const double* i1data = in(1)->get_block_view(a4, c3, a2, c1);
+        BlockBuffer i1data_sorted(in(1)->get_size(a4, c3, a2, c1));
+        sort_indices<3,2,1,0,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), c3.size(), a2.size(), c1.size());
         dgemm_("T", "N", a5.size(), a4.size(), c3.size()*a2.size()*c1.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*c1.size(), i1data_sorted, c3.size()*a2.size()*c1.size(),
-               1.0, odata_sorted, a5.size());
+               1.0, i0data_sorted.get(), c3.size()*a2.size()*c1.size(), i1data_sorted.get(), c3.size()*a2.size()*c1.size(),
+               1.0, odata_sorted.get(), a5.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a5.size(), a4.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), a5.size(), a4.size());
   out()->put_block(odata, a4, a5);
 }
 
@@ -514,8 +514,8 @@ void Task674::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a4, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-    sort_indices<3,2,1,0,1,1,16,1>(i0data, odata, c1.size(), a2.size(), c3.size(), a4.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, a4);
+    sort_indices<3,2,1,0,1,1,16,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), a4.size());
   }
   out()->put_block(odata, a4, c3, a2, c1);
 }
@@ -527,8 +527,8 @@ void Task675::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x0, c3);
   {
     // tensor label: I665
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c3, x0);
-    sort_indices<1,0,1,1,1,1>(i0data, odata, c3.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(c3, x0);
+    sort_indices<1,0,1,1,1,1>(i0data, odata.get(), c3.size(), x0.size());
   }
   out()->put_block(odata, x0, c3);
 }
@@ -538,22 +538,22 @@ void Task676::Task_local::compute() {
   const Index x0 = b(1);
   // tensor label: I665
   std::unique_ptr<double[]> odata = out()->move_block(c3, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(c3, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(c3, x0), 0.0);
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma38
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(x1, x0);
+    BlockBuffer i0data_sorted(in(0)->get_size(x1, x0));
+    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), x0.size());
     // tensor label: I666
-    std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x1)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, c3.size(), x1.size());
+    const double* i1data = in(1)->get_block_view(c3, x1);
+    BlockBuffer i1data_sorted(in(1)->get_size(c3, x1));
+    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), c3.size(), x1.size());
     dgemm_("T", "N", x0.size(), c3.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+           1.0, i0data_sorted.get(), x1.size(), i1data_sorted.get(), x1.size(),
+           1.0, odata_sorted.get(), x0.size());
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), c3.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), c3.size());
   out()->put_block(odata, c3, x0);
 }
 
@@ -562,26 +562,26 @@ void Task677::Task_local::compute() {
   const Index x1 = b(1);
   // tensor label: I666
   std::unique_ptr<double[]> odata = out()->move_block(c3, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(c3, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(c3, x1), 0.0);
   for (auto& a4 : *range_[2]) {
     for (auto& c1 : *range_[0]) {
       for (auto& a2 : *range_[2]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a4, c1, a2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a4, c1, a2)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), a4.size(), c1.size(), a2.size());
+        const double* i0data = in(0)->get_block_view(x1, a4, c1, a2);
+        BlockBuffer i0data_sorted(in(0)->get_size(x1, a4, c1, a2));
+        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), a4.size(), c1.size(), a2.size());
         // tensor label: I667
-        std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c3, a2, c1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c3, a2, c1)]);
-        sort_indices<0,3,2,1,0,1,1,1>(i1data, i1data_sorted, a4.size(), c3.size(), a2.size(), c1.size());
+        const double* i1data = in(1)->get_block_view(a4, c3, a2, c1);
+        BlockBuffer i1data_sorted(in(1)->get_size(a4, c3, a2, c1));
+        sort_indices<0,3,2,1,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), c3.size(), a2.size(), c1.size());
         dgemm_("T", "N", x1.size(), c3.size(), a4.size()*a2.size()*c1.size(),
-               1.0, i0data_sorted, a4.size()*a2.size()*c1.size(), i1data_sorted, a4.size()*a2.size()*c1.size(),
-               1.0, odata_sorted, x1.size());
+               1.0, i0data_sorted.get(), a4.size()*a2.size()*c1.size(), i1data_sorted.get(), a4.size()*a2.size()*c1.size(),
+               1.0, odata_sorted.get(), x1.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), c3.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), c3.size());
   out()->put_block(odata, c3, x1);
 }
 
@@ -594,8 +594,8 @@ void Task678::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a4, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-    sort_indices<3,2,1,0,1,1,-4,1>(i0data, odata, c1.size(), a2.size(), c3.size(), a4.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, a4);
+    sort_indices<3,2,1,0,1,1,-4,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), a4.size());
   }
   out()->put_block(odata, a4, c3, a2, c1);
 }
@@ -605,26 +605,26 @@ void Task679::Task_local::compute() {
   const Index x1 = b(1);
   // tensor label: I666
   std::unique_ptr<double[]> odata = out()->move_block(c3, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(c3, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(c3, x1), 0.0);
   for (auto& a2 : *range_[2]) {
     for (auto& c1 : *range_[0]) {
       for (auto& a4 : *range_[2]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a2, c1, a4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a2, c1, a4)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), a2.size(), c1.size(), a4.size());
+        const double* i0data = in(0)->get_block_view(x1, a2, c1, a4);
+        BlockBuffer i0data_sorted(in(0)->get_size(x1, a2, c1, a4));
+        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), a2.size(), c1.size(), a4.size());
         // tensor label: I670
-        std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c3, a2, c1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c3, a2, c1)]);
-        sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, a4.size(), c3.size(), a2.size(), c1.size());
+        const double* i1data = in(1)->get_block_view(a4, c3, a2, c1);
+        BlockBuffer i1data_sorted(in(1)->get_size(a4, c3, a2, c1));
+        sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), c3.size(), a2.size(), c1.size());
         dgemm_("T", "N", x1.size(), c3.size(), a4.size()*a2.size()*c1.size(),
-               1.0, i0data_sorted, a4.size()*a2.size()*c1.size(), i1data_sorted, a4.size()*a2.size()*c1.size(),
-               1.0, odata_sorted, x1.size());
+               1.0, i0data_sorted.get(), a4.size()*a2.size()*c1.size(), i1data_sorted.get(), a4.size()*a2.size()*c1.size(),
+               1.0, odata_sorted.get(), x1.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), c3.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), c3.size());
   out()->put_block(odata, c3, x1);
 }
 
@@ -637,8 +637,8 @@ void Task680::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a4, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata, c1.size(), a2.size(), c3.size(), a4.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, a4);
+    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), a4.size());
   }
   out()->put_block(odata, a4, c3, a2, c1);
 }
@@ -650,8 +650,8 @@ void Task681::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a1, x1);
   {
     // tensor label: I671
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a1);
-    sort_indices<1,0,1,1,1,1>(i0data, odata, x1.size(), a1.size());
+    const double* i0data = in(0)->get_block_view(x1, a1);
+    sort_indices<1,0,1,1,1,1>(i0data, odata.get(), x1.size(), a1.size());
   }
   out()->put_block(odata, a1, x1);
 }
@@ -661,26 +661,26 @@ void Task682::Task_local::compute() {
   const Index a1 = b(1);
   // tensor label: I671
   std::unique_ptr<double[]> odata = out()->move_block(x1, a1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, a1)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, a1));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, a1), 0.0);
   for (auto& a3 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& x0 : *range_[1]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, a3)]);
-        sort_indices<3,2,0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
+        const double* i0data = in(0)->get_block_view(x0, a1, c2, a3);
+        BlockBuffer i0data_sorted(in(0)->get_size(x0, a1, c2, a3));
+        sort_indices<3,2,0,1,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), a1.size(), c2.size(), a3.size());
         // tensor label: I672
-        std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, x1, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, x1, x0)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), x1.size(), x0.size());
+        const double* i1data = in(1)->get_block_view(a3, c2, x1, x0);
+        BlockBuffer i1data_sorted(in(1)->get_size(a3, c2, x1, x0));
+        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), c2.size(), x1.size(), x0.size());
         dgemm_("T", "N", a1.size(), x1.size(), a3.size()*c2.size()*x0.size(),
-               1.0, i0data_sorted, a3.size()*c2.size()*x0.size(), i1data_sorted, a3.size()*c2.size()*x0.size(),
-               1.0, odata_sorted, a1.size());
+               1.0, i0data_sorted.get(), a3.size()*c2.size()*x0.size(), i1data_sorted.get(), a3.size()*c2.size()*x0.size(),
+               1.0, odata_sorted.get(), a1.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a1.size(), x1.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), a1.size(), x1.size());
   out()->put_block(odata, x1, a1);
 }
 
@@ -691,24 +691,24 @@ void Task683::Task_local::compute() {
   const Index x0 = b(3);
   // tensor label: I672
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(a3, c2, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x1, x0), 0.0);
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma35
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      const double* i0data = in(0)->get_block_view(x3, x2, x1, x0);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, x2, x1, x0));
+      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: I673
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a3, c2, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a3, c2, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), a3.size(), c2.size(), x2.size());
+      const double* i1data = in(1)->get_block_view(x3, a3, c2, x2);
+      BlockBuffer i1data_sorted(in(1)->get_size(x3, a3, c2, x2));
+      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), a3.size(), c2.size(), x2.size());
       dgemm_("T", "N", x1.size()*x0.size(), a3.size()*c2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+             1.0, i0data_sorted.get(), x3.size()*x2.size(), i1data_sorted.get(), x3.size()*x2.size(),
+             1.0, odata_sorted.get(), x1.size()*x0.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a3.size(), c2.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size(), a3.size(), c2.size());
   out()->put_block(odata, a3, c2, x1, x0);
 }
 
@@ -721,13 +721,13 @@ void Task684::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x3, a3, c2, x2);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a3, c2, x2);
-    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata, x3.size(), a3.size(), c2.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x3, a3, c2, x2);
+    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata.get(), x3.size(), a3.size(), c2.size(), x2.size());
   }
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i1data = in(0)->get_block(c2, a3, x3, x2);
-    sort_indices<2,1,0,3,1,1,2,1>(i1data, odata, c2.size(), a3.size(), x3.size(), x2.size());
+    const double* i1data = in(0)->get_block_view(c2, a3, x3, x2);
+    sort_indices<2,1,0,3,1,1,2,1>(i1data, odata.get(), c2.size(), a3.size(), x3.size(), x2.size());
   }
   out()->put_block(odata, x3, a3, c2, x2);
 }
@@ -739,8 +739,8 @@ void Task685::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, x1);
   {
     // tensor label: I674
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a3);
-    sort_indices<1,0,1,1,1,1>(i0data, odata, x1.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(x1, a3);
+    sort_indices<1,0,1,1,1,1>(i0data, odata.get(), x1.size(), a3.size());
   }
   out()->put_block(odata, a3, x1);
 }
@@ -750,26 +750,26 @@ void Task686::Task_local::compute() {
   const Index a3 = b(1);
   // tensor label: I674
   std::unique_ptr<double[]> odata = out()->move_block(x1, a3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, a3)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, a3));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, a3), 0.0);
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       for (auto& x0 : *range_[1]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, a3)]);
-        sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
+        const double* i0data = in(0)->get_block_view(x0, a1, c2, a3);
+        BlockBuffer i0data_sorted(in(0)->get_size(x0, a1, c2, a3));
+        sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), a1.size(), c2.size(), a3.size());
         // tensor label: I675
-        std::unique_ptr<double[]> i1data = in(1)->get_block(a1, c2, x0, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, c2, x0, x1)]);
-        sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, a1.size(), c2.size(), x0.size(), x1.size());
+        const double* i1data = in(1)->get_block_view(a1, c2, x0, x1);
+        BlockBuffer i1data_sorted(in(1)->get_size(a1, c2, x0, x1));
+        sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted.get(), a1.size(), c2.size(), x0.size(), x1.size());
         dgemm_("T", "N", a3.size(), x1.size(), a1.size()*c2.size()*x0.size(),
-               1.0, i0data_sorted, a1.size()*c2.size()*x0.size(), i1data_sorted, a1.size()*c2.size()*x0.size(),
-               1.0, odata_sorted, a3.size());
+               1.0, i0data_sorted.get(), a1.size()*c2.size()*x0.size(), i1data_sorted.get(), a1.size()*c2.size()*x0.size(),
+               1.0, odata_sorted.get(), a3.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a3.size(), x1.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), a3.size(), x1.size());
   out()->put_block(odata, x1, a3);
 }
 
@@ -780,24 +780,24 @@ void Task687::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I675
   std::unique_ptr<double[]> odata = out()->move_block(a1, c2, x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, c2, x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(a1, c2, x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(a1, c2, x0, x1), 0.0);
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma32
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x1, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x1.size(), x2.size());
+      const double* i0data = in(0)->get_block_view(x3, x0, x1, x2);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, x0, x1, x2));
+      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x0.size(), x1.size(), x2.size());
       // tensor label: I676
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, c2, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, c2, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), a1.size(), c2.size(), x2.size());
+      const double* i1data = in(1)->get_block_view(x3, a1, c2, x2);
+      BlockBuffer i1data_sorted(in(1)->get_size(x3, a1, c2, x2));
+      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), a1.size(), c2.size(), x2.size());
       dgemm_("T", "N", x0.size()*x1.size(), a1.size()*c2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+             1.0, i0data_sorted.get(), x3.size()*x2.size(), i1data_sorted.get(), x3.size()*x2.size(),
+             1.0, odata_sorted.get(), x0.size()*x1.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a1.size(), c2.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), a1.size(), c2.size());
   out()->put_block(odata, a1, c2, x0, x1);
 }
 
@@ -810,8 +810,8 @@ void Task688::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x3, a1, c2, x2);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, c2, x2);
-    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata, x3.size(), a1.size(), c2.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x3, a1, c2, x2);
+    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata.get(), x3.size(), a1.size(), c2.size(), x2.size());
   }
   out()->put_block(odata, x3, a1, c2, x2);
 }
@@ -823,24 +823,24 @@ void Task689::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I675
   std::unique_ptr<double[]> odata = out()->move_block(a1, c2, x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, c2, x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(a1, c2, x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(a1, c2, x0, x1), 0.0);
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma35
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      const double* i0data = in(0)->get_block_view(x3, x2, x1, x0);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, x2, x1, x0));
+      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: I682
-      std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x3.size(), x2.size());
+      const double* i1data = in(1)->get_block_view(c2, a1, x3, x2);
+      BlockBuffer i1data_sorted(in(1)->get_size(c2, a1, x3, x2));
+      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted.get(), c2.size(), a1.size(), x3.size(), x2.size());
       dgemm_("T", "N", x1.size()*x0.size(), c2.size()*a1.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+             1.0, i0data_sorted.get(), x3.size()*x2.size(), i1data_sorted.get(), x3.size()*x2.size(),
+             1.0, odata_sorted.get(), x1.size()*x0.size());
     }
   }
-  sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c2.size(), a1.size());
+  sort_indices<3,2,1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size(), c2.size(), a1.size());
   out()->put_block(odata, a1, c2, x0, x1);
 }
 
@@ -853,8 +853,8 @@ void Task690::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c2, a1, x3, x2);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, x3, x2);
-    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata, c2.size(), a1.size(), x3.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(c2, a1, x3, x2);
+    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata.get(), c2.size(), a1.size(), x3.size(), x2.size());
   }
   out()->put_block(odata, c2, a1, x3, x2);
 }
@@ -866,8 +866,8 @@ void Task691::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a1, c2);
   {
     // tensor label: I683
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1);
-    sort_indices<1,0,1,1,1,1>(i0data, odata, c2.size(), a1.size());
+    const double* i0data = in(0)->get_block_view(c2, a1);
+    sort_indices<1,0,1,1,1,1>(i0data, odata.get(), c2.size(), a1.size());
   }
   out()->put_block(odata, a1, c2);
 }
@@ -877,24 +877,24 @@ void Task692::Task_local::compute() {
   const Index a1 = b(1);
   // tensor label: I683
   std::unique_ptr<double[]> odata = out()->move_block(c2, a1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1)]);
+  BlockBuffer odata_sorted(out()->get_size(c2, a1));
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1), 0.0);
   for (auto& a3 : *range_[2]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, a3)]);
-      sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
+      const double* i0data = in(0)->get_block_view(x0, a1, c2, a3);
+      BlockBuffer i0data_sorted(in(0)->get_size(x0, a1, c2, a3));
+      sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), a1.size(), c2.size(), a3.size());
       // tensor label: I684
-      std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x0)]);
-      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a3.size(), x0.size());
+      const double* i1data = in(1)->get_block_view(a3, x0);
+      BlockBuffer i1data_sorted(in(1)->get_size(a3, x0));
+      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), x0.size());
       dgemm_("T", "N", c2.size()*a1.size(), 1, a3.size()*x0.size(),
-             1.0, i0data_sorted, a3.size()*x0.size(), i1data_sorted, a3.size()*x0.size(),
-             1.0, odata_sorted, c2.size()*a1.size());
+             1.0, i0data_sorted.get(), a3.size()*x0.size(), i1data_sorted.get(), a3.size()*x0.size(),
+             1.0, odata_sorted.get(), c2.size()*a1.size());
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a1.size(), c2.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), a1.size(), c2.size());
   out()->put_block(odata, c2, a1);
 }
 
@@ -903,26 +903,26 @@ void Task693::Task_local::compute() {
   const Index x0 = b(1);
   // tensor label: I684
   std::unique_ptr<double[]> odata = out()->move_block(a3, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(a3, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(a3, x0), 0.0);
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma60
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+        const double* i0data = in(0)->get_block_view(x3, x0, x2, x1);
+        BlockBuffer i0data_sorted(in(0)->get_size(x3, x0, x2, x1));
+        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x0.size(), x2.size(), x1.size());
         // tensor label: I685
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a3, x2, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a3, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted, x3.size(), a3.size(), x2.size(), x1.size());
+        const double* i1data = in(1)->get_block_view(x3, a3, x2, x1);
+        BlockBuffer i1data_sorted(in(1)->get_size(x3, a3, x2, x1));
+        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), a3.size(), x2.size(), x1.size());
         dgemm_("T", "N", x0.size(), a3.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x0.size());
+               1.0, i0data_sorted.get(), x3.size()*x2.size()*x1.size(), i1data_sorted.get(), x3.size()*x2.size()*x1.size(),
+               1.0, odata_sorted.get(), x0.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), a3.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), a3.size());
   out()->put_block(odata, a3, x0);
 }
 
@@ -935,8 +935,8 @@ void Task694::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x3, a3, x2, x1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a3, x2, x1);
-    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata, x3.size(), a3.size(), x2.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x3, a3, x2, x1);
+    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata.get(), x3.size(), a3.size(), x2.size(), x1.size());
   }
   out()->put_block(odata, x3, a3, x2, x1);
 }
@@ -948,8 +948,8 @@ void Task695::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2);
   {
     // tensor label: I686
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a3, c2);
-    sort_indices<0,1,1,1,1,1>(i0data, odata, a3.size(), c2.size());
+    const double* i0data = in(0)->get_block_view(a3, c2);
+    sort_indices<0,1,1,1,1,1>(i0data, odata.get(), a3.size(), c2.size());
   }
   out()->put_block(odata, a3, c2);
 }
@@ -959,24 +959,24 @@ void Task696::Task_local::compute() {
   const Index c2 = b(1);
   // tensor label: I686
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2)]);
+  BlockBuffer odata_sorted(out()->get_size(a3, c2));
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2), 0.0);
   for (auto& a1 : *range_[2]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, a3)]);
-      sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
+      const double* i0data = in(0)->get_block_view(x0, a1, c2, a3);
+      BlockBuffer i0data_sorted(in(0)->get_size(x0, a1, c2, a3));
+      sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), a1.size(), c2.size(), a3.size());
       // tensor label: I687
-      std::unique_ptr<double[]> i1data = in(1)->get_block(a1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, x0)]);
-      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a1.size(), x0.size());
+      const double* i1data = in(1)->get_block_view(a1, x0);
+      BlockBuffer i1data_sorted(in(1)->get_size(a1, x0));
+      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a1.size(), x0.size());
       dgemm_("T", "N", a3.size()*c2.size(), 1, a1.size()*x0.size(),
-             1.0, i0data_sorted, a1.size()*x0.size(), i1data_sorted, a1.size()*x0.size(),
-             1.0, odata_sorted, a3.size()*c2.size());
+             1.0, i0data_sorted.get(), a1.size()*x0.size(), i1data_sorted.get(), a1.size()*x0.size(),
+             1.0, odata_sorted.get(), a3.size()*c2.size());
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c2.size(), a3.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), c2.size(), a3.size());
   out()->put_block(odata, a3, c2);
 }
 
@@ -985,26 +985,26 @@ void Task697::Task_local::compute() {
   const Index x0 = b(1);
   // tensor label: I687
   std::unique_ptr<double[]> odata = out()->move_block(a1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(a1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0), 0.0);
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma60
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+        const double* i0data = in(0)->get_block_view(x3, x0, x2, x1);
+        BlockBuffer i0data_sorted(in(0)->get_size(x3, x0, x2, x1));
+        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x0.size(), x2.size(), x1.size());
         // tensor label: I688
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, x2, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted, x3.size(), a1.size(), x2.size(), x1.size());
+        const double* i1data = in(1)->get_block_view(x3, a1, x2, x1);
+        BlockBuffer i1data_sorted(in(1)->get_size(x3, a1, x2, x1));
+        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), a1.size(), x2.size(), x1.size());
         dgemm_("T", "N", x0.size(), a1.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x0.size());
+               1.0, i0data_sorted.get(), x3.size()*x2.size()*x1.size(), i1data_sorted.get(), x3.size()*x2.size()*x1.size(),
+               1.0, odata_sorted.get(), x0.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), a1.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), a1.size());
   out()->put_block(odata, a1, x0);
 }
 
@@ -1017,8 +1017,8 @@ void Task698::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x3, a1, x2, x1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, x2, x1);
-    sort_indices<0,1,2,3,1,1,2,1>(i0data, odata, x3.size(), a1.size(), x2.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x3, a1, x2, x1);
+    sort_indices<0,1,2,3,1,1,2,1>(i0data, odata.get(), x3.size(), a1.size(), x2.size(), x1.size());
   }
   out()->put_block(odata, x3, a1, x2, x1);
 }
@@ -1030,8 +1030,8 @@ void Task699::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c4, x1);
   {
     // tensor label: I689
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c4, x1);
-    sort_indices<0,1,1,1,1,1>(i0data, odata, c4.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c4, x1);
+    sort_indices<0,1,1,1,1,1>(i0data, odata.get(), c4.size(), x1.size());
   }
   out()->put_block(odata, c4, x1);
 }
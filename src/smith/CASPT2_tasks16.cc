@@ -40,22 +40,22 @@ void Task750::Task_local::compute() {
   const Index x0 = b(3);
   // tensor label: I746
   std::unique_ptr<double[]> odata = out()->move_block(c3, a2, c1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, a2, c1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(c3, a2, c1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(c3, a2, c1, x0), 0.0);
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma16
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x0, x1);
+    BlockBuffer i0data_sorted(in(0)->get_size(x0, x1));
+    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), x1.size());
     // tensor label: I747
-    std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, c1, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, c1, x1)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, c3.size(), a2.size(), c1.size(), x1.size());
+    const double* i1data = in(1)->get_block_view(c3, a2, c1, x1);
+    BlockBuffer i1data_sorted(in(1)->get_size(c3, a2, c1, x1));
+    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted.get(), c3.size(), a2.size(), c1.size(), x1.size());
     dgemm_("T", "N", x0.size(), c3.size()*a2.size()*c1.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+           1.0, i0data_sorted.get(), x1.size(), i1data_sorted.get(), x1.size(),
+           1.0, odata_sorted.get(), x0.size());
   }
-  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x0.size(), c3.size(), a2.size(), c1.size());
+  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), c3.size(), a2.size(), c1.size());
   out()->put_block(odata, c3, a2, c1, x0);
 }
 
@@ -68,13 +68,13 @@ void Task751::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c3, a2, c1, x1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2, c1, x1);
-    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata, c3.size(), a2.size(), c1.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c3, a2, c1, x1);
+    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata.get(), c3.size(), a2.size(), c1.size(), x1.size());
   }
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i1data = in(0)->get_block(c1, a2, c3, x1);
-    sort_indices<2,1,0,3,1,1,2,1>(i1data, odata, c1.size(), a2.size(), c3.size(), x1.size());
+    const double* i1data = in(0)->get_block_view(c1, a2, c3, x1);
+    sort_indices<2,1,0,3,1,1,2,1>(i1data, odata.get(), c1.size(), a2.size(), c3.size(), x1.size());
   }
   out()->put_block(odata, c3, a2, c1, x1);
 }
@@ -88,8 +88,8 @@ void Task752::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c2, x1, x0, a1);
   {
     // tensor label: I750
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a1, c2, x0, x1);
-    sort_indices<1,3,2,0,1,1,1,1>(i0data, odata, a1.size(), c2.size(), x0.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(a1, c2, x0, x1);
+    sort_indices<1,3,2,0,1,1,1,1>(i0data, odata.get(), a1.size(), c2.size(), x0.size(), x1.size());
   }
   out()->put_block(odata, c2, x1, x0, a1);
 }
@@ -101,24 +101,24 @@ void Task753::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I750
   std::unique_ptr<double[]> odata = out()->move_block(a1, c2, x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, c2, x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(a1, c2, x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(a1, c2, x0, x1), 0.0);
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma32
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x1, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x1.size(), x2.size());
+      const double* i0data = in(0)->get_block_view(x3, x0, x1, x2);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, x0, x1, x2));
+      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x0.size(), x1.size(), x2.size());
       // tensor label: I751
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, c2, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, c2, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), a1.size(), c2.size(), x2.size());
+      const double* i1data = in(1)->get_block_view(x3, a1, c2, x2);
+      BlockBuffer i1data_sorted(in(1)->get_size(x3, a1, c2, x2));
+      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), a1.size(), c2.size(), x2.size());
       dgemm_("T", "N", x0.size()*x1.size(), a1.size()*c2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+             1.0, i0data_sorted.get(), x3.size()*x2.size(), i1data_sorted.get(), x3.size()*x2.size(),
+             1.0, odata_sorted.get(), x0.size()*x1.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a1.size(), c2.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), a1.size(), c2.size());
   out()->put_block(odata, a1, c2, x0, x1);
 }
 
@@ -131,8 +131,8 @@ void Task754::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x3, a1, c2, x2);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, c2, x2);
-    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata, x3.size(), a1.size(), c2.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x3, a1, c2, x2);
+    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata.get(), x3.size(), a1.size(), c2.size(), x2.size());
   }
   out()->put_block(odata, x3, a1, c2, x2);
 }
@@ -144,24 +144,24 @@ void Task755::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I750
   std::unique_ptr<double[]> odata = out()->move_block(a1, c2, x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, c2, x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(a1, c2, x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(a1, c2, x0, x1), 0.0);
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma35
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      const double* i0data = in(0)->get_block_view(x3, x2, x1, x0);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, x2, x1, x0));
+      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: I753
-      std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x3.size(), x2.size());
+      const double* i1data = in(1)->get_block_view(c2, a1, x3, x2);
+      BlockBuffer i1data_sorted(in(1)->get_size(c2, a1, x3, x2));
+      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted.get(), c2.size(), a1.size(), x3.size(), x2.size());
       dgemm_("T", "N", x1.size()*x0.size(), c2.size()*a1.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+             1.0, i0data_sorted.get(), x3.size()*x2.size(), i1data_sorted.get(), x3.size()*x2.size(),
+             1.0, odata_sorted.get(), x1.size()*x0.size());
     }
   }
-  sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c2.size(), a1.size());
+  sort_indices<3,2,1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size(), c2.size(), a1.size());
   out()->put_block(odata, a1, c2, x0, x1);
 }
 
@@ -174,8 +174,8 @@ void Task756::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c2, a1, x3, x2);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, x3, x2);
-    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata, c2.size(), a1.size(), x3.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(c2, a1, x3, x2);
+    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata.get(), c2.size(), a1.size(), x3.size(), x2.size());
   }
   out()->put_block(odata, c2, a1, x3, x2);
 }
@@ -189,8 +189,8 @@ void Task757::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x0, x1, c1, a2);
   {
     // tensor label: I754
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a2, c1, x1, x0);
-    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata, a2.size(), c1.size(), x1.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(a2, c1, x1, x0);
+    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata.get(), a2.size(), c1.size(), x1.size(), x0.size());
   }
   out()->put_block(odata, x0, x1, c1, a2);
 }
@@ -202,24 +202,24 @@ void Task758::Task_local::compute() {
   const Index x0 = b(3);
   // tensor label: I754
   std::unique_ptr<double[]> odata = out()->move_block(a2, c1, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(a2, c1, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, x1, x0), 0.0);
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma35
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      const double* i0data = in(0)->get_block_view(x3, x2, x1, x0);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, x2, x1, x0));
+      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: I755
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a2, c1, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a2, c1, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), a2.size(), c1.size(), x2.size());
+      const double* i1data = in(1)->get_block_view(x3, a2, c1, x2);
+      BlockBuffer i1data_sorted(in(1)->get_size(x3, a2, c1, x2));
+      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), a2.size(), c1.size(), x2.size());
       dgemm_("T", "N", x1.size()*x0.size(), a2.size()*c1.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+             1.0, i0data_sorted.get(), x3.size()*x2.size(), i1data_sorted.get(), x3.size()*x2.size(),
+             1.0, odata_sorted.get(), x1.size()*x0.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a2.size(), c1.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size(), a2.size(), c1.size());
   out()->put_block(odata, a2, c1, x1, x0);
 }
 
@@ -232,13 +232,13 @@ void Task759::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x3, a2, c1, x2);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a2, c1, x2);
-    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata, x3.size(), a2.size(), c1.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x3, a2, c1, x2);
+    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata.get(), x3.size(), a2.size(), c1.size(), x2.size());
   }
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i1data = in(0)->get_block(c1, a2, x3, x2);
-    sort_indices<2,1,0,3,1,1,2,1>(i1data, odata, c1.size(), a2.size(), x3.size(), x2.size());
+    const double* i1data = in(0)->get_block_view(c1, a2, x3, x2);
+    sort_indices<2,1,0,3,1,1,2,1>(i1data, odata.get(), c1.size(), a2.size(), x3.size(), x2.size());
   }
   out()->put_block(odata, x3, a2, c1, x2);
 }
@@ -252,8 +252,8 @@ void Task760::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, x2, x0, a1);
   {
     // tensor label: I758
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a1, x0, x2, x1);
-    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata, a1.size(), x0.size(), x2.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(a1, x0, x2, x1);
+    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata.get(), a1.size(), x0.size(), x2.size(), x1.size());
   }
   out()->put_block(odata, x1, x2, x0, a1);
 }
@@ -265,26 +265,26 @@ void Task761::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I758
   std::unique_ptr<double[]> odata = out()->move_block(a1, x0, x2, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x2, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(a1, x0, x2, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x2, x1), 0.0);
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma59
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x3, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x3, x2, x1)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
+        const double* i0data = in(0)->get_block_view(x5, x0, x4, x3, x2, x1);
+        BlockBuffer i0data_sorted(in(0)->get_size(x5, x0, x4, x3, x2, x1));
+        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
         // tensor label: I759
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a1, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a1, x4, x3)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted, x5.size(), a1.size(), x4.size(), x3.size());
+        const double* i1data = in(1)->get_block_view(x5, a1, x4, x3);
+        BlockBuffer i1data_sorted(in(1)->get_size(x5, a1, x4, x3));
+        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted.get(), x5.size(), a1.size(), x4.size(), x3.size());
         dgemm_("T", "N", x0.size()*x2.size()*x1.size(), a1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x0.size()*x2.size()*x1.size());
+               1.0, i0data_sorted.get(), x5.size()*x4.size()*x3.size(), i1data_sorted.get(), x5.size()*x4.size()*x3.size(),
+               1.0, odata_sorted.get(), x0.size()*x2.size()*x1.size());
       }
     }
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x2.size(), x1.size(), a1.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x2.size(), x1.size(), a1.size());
   out()->put_block(odata, a1, x0, x2, x1);
 }
 
@@ -297,8 +297,8 @@ void Task762::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x5, a1, x4, x3);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, x4, x3);
-    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata, x5.size(), a1.size(), x4.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(x5, a1, x4, x3);
+    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata.get(), x5.size(), a1.size(), x4.size(), x3.size());
   }
   out()->put_block(odata, x5, a1, x4, x3);
 }
@@ -312,8 +312,8 @@ void Task763::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c3, a4, c1, a2);
   {
     // tensor label: I760
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a4, c3, a2);
-    sort_indices<2,1,0,3,1,1,1,1>(i0data, odata, c1.size(), a4.size(), c3.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(c1, a4, c3, a2);
+    sort_indices<2,1,0,3,1,1,1,1>(i0data, odata.get(), c1.size(), a4.size(), c3.size(), a2.size());
   }
   out()->put_block(odata, c3, a4, c1, a2);
 }
@@ -327,13 +327,13 @@ void Task764::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c1, a4, c3, a2);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a4, c3, a2);
-    sort_indices<0,1,2,3,1,1,-4,1>(i0data, odata, c1.size(), a4.size(), c3.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(c1, a4, c3, a2);
+    sort_indices<0,1,2,3,1,1,-4,1>(i0data, odata.get(), c1.size(), a4.size(), c3.size(), a2.size());
   }
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i1data = in(0)->get_block(c1, a2, c3, a4);
-    sort_indices<0,3,2,1,1,1,8,1>(i1data, odata, c1.size(), a2.size(), c3.size(), a4.size());
+    const double* i1data = in(0)->get_block_view(c1, a2, c3, a4);
+    sort_indices<0,3,2,1,1,1,8,1>(i1data, odata.get(), c1.size(), a2.size(), c3.size(), a4.size());
   }
   out()->put_block(odata, c1, a4, c3, a2);
 }
@@ -347,8 +347,8 @@ void Task765::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c2, a3, x0, a1);
   {
     // tensor label: I762
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a3, c2, a1, x0);
-    sort_indices<1,0,3,2,1,1,1,1>(i0data, odata, a3.size(), c2.size(), a1.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(a3, c2, a1, x0);
+    sort_indices<1,0,3,2,1,1,1,1>(i0data, odata.get(), a3.size(), c2.size(), a1.size(), x0.size());
   }
   out()->put_block(odata, c2, a3, x0, a1);
 }
@@ -360,22 +360,22 @@ void Task766::Task_local::compute() {
   const Index x0 = b(3);
   // tensor label: I762
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2, a1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, a1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(a3, c2, a1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, a1, x0), 0.0);
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma38
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(x1, x0);
+    BlockBuffer i0data_sorted(in(0)->get_size(x1, x0));
+    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), x0.size());
     // tensor label: I763
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a3, c2, a1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a3, c2, a1)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), a3.size(), c2.size(), a1.size());
+    const double* i1data = in(1)->get_block_view(x1, a3, c2, a1);
+    BlockBuffer i1data_sorted(in(1)->get_size(x1, a3, c2, a1));
+    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), a3.size(), c2.size(), a1.size());
     dgemm_("T", "N", x0.size(), a3.size()*c2.size()*a1.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+           1.0, i0data_sorted.get(), x1.size(), i1data_sorted.get(), x1.size(),
+           1.0, odata_sorted.get(), x0.size());
   }
-  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x0.size(), a3.size(), c2.size(), a1.size());
+  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), a3.size(), c2.size(), a1.size());
   out()->put_block(odata, a3, c2, a1, x0);
 }
 
@@ -388,13 +388,13 @@ void Task767::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, a3, c2, a1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a3, c2, a1);
-    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata, x1.size(), a3.size(), c2.size(), a1.size());
+    const double* i0data = in(0)->get_block_view(x1, a3, c2, a1);
+    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata.get(), x1.size(), a3.size(), c2.size(), a1.size());
   }
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i1data = in(0)->get_block(x1, a1, c2, a3);
-    sort_indices<0,3,2,1,1,1,2,1>(i1data, odata, x1.size(), a1.size(), c2.size(), a3.size());
+    const double* i1data = in(0)->get_block_view(x1, a1, c2, a3);
+    sort_indices<0,3,2,1,1,1,2,1>(i1data, odata.get(), x1.size(), a1.size(), c2.size(), a3.size());
   }
   out()->put_block(odata, x1, a3, c2, a1);
 }
@@ -408,8 +408,8 @@ void Task768::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, a2, x0, a1);
   {
     // tensor label: I766
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a1, a2, x0, x1);
-    sort_indices<3,1,2,0,1,1,1,1>(i0data, odata, a1.size(), a2.size(), x0.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(a1, a2, x0, x1);
+    sort_indices<3,1,2,0,1,1,1,1>(i0data, odata.get(), a1.size(), a2.size(), x0.size(), x1.size());
   }
   out()->put_block(odata, x1, a2, x0, a1);
 }
@@ -421,24 +421,24 @@ void Task769::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I766
   std::unique_ptr<double[]> odata = out()->move_block(a1, a2, x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, a2, x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(a1, a2, x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(a1, a2, x0, x1), 0.0);
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma60
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+      const double* i0data = in(0)->get_block_view(x3, x0, x2, x1);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, x0, x2, x1));
+      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x0.size(), x2.size(), x1.size());
       // tensor label: I767
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, x2, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, x2, a2)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), a1.size(), x2.size(), a2.size());
+      const double* i1data = in(1)->get_block_view(x3, a1, x2, a2);
+      BlockBuffer i1data_sorted(in(1)->get_size(x3, a1, x2, a2));
+      sort_indices<0,2,1,3,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), a1.size(), x2.size(), a2.size());
       dgemm_("T", "N", x0.size()*x1.size(), a1.size()*a2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+             1.0, i0data_sorted.get(), x3.size()*x2.size(), i1data_sorted.get(), x3.size()*x2.size(),
+             1.0, odata_sorted.get(), x0.size()*x1.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a1.size(), a2.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), a1.size(), a2.size());
   out()->put_block(odata, a1, a2, x0, x1);
 }
 
@@ -451,8 +451,8 @@ void Task770::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x3, a1, x2, a2);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, x2, a2);
-    sort_indices<0,1,2,3,1,1,2,1>(i0data, odata, x3.size(), a1.size(), x2.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(x3, a1, x2, a2);
+    sort_indices<0,1,2,3,1,1,2,1>(i0data, odata.get(), x3.size(), a1.size(), x2.size(), a2.size());
   }
   out()->put_block(odata, x3, a1, x2, a2);
 }
@@ -463,8 +463,8 @@ void Task772::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(ci0);
   {
     // tensor label: I768
-    std::unique_ptr<double[]> i0data = in(0)->get_block(ci0);
-    sort_indices<0,1,1,1,1>(i0data, odata, ci0.size());
+    const double* i0data = in(0)->get_block_view(ci0);
+    sort_indices<0,1,1,1,1>(i0data, odata.get(), ci0.size());
   }
   out()->put_block(odata, ci0);
 }
@@ -473,28 +473,28 @@ void Task773::Task_local::compute() {
   const Index ci0 = b(0);
   // tensor label: I768
   std::unique_ptr<double[]> odata = out()->move_block(ci0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(ci0)]);
+  BlockBuffer odata_sorted(out()->get_size(ci0));
   std::fill_n(odata_sorted.get(), out()->get_size(ci0), 0.0);
   for (auto& x0 : *range_[1]) {
     for (auto& x5 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         for (auto& x4 : *range_[1]) {
           // tensor label: Gamma270
-          std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x0, x5, x1, x4);
-          std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(ci0, x0, x5, x1, x4)]);
-          sort_indices<1,2,3,4,0,0,1,1,1>(i0data, i0data_sorted, ci0.size(), x0.size(), x5.size(), x1.size(), x4.size());
+          const double* i0data = in(0)->get_block_view(ci0, x0, x5, x1, x4);
+          BlockBuffer i0data_sorted(in(0)->get_size(ci0, x0, x5, x1, x4));
+          sort_indices<1,2,3,4,0,0,1,1,1>(i0data, i0data_sorted.get(), ci0.size(), x0.size(), x5.size(), x1.size(), x4.size());
           // tensor label: I769
-          std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, x5, x4);
-          std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, x5, x4)]);
-          sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), x5.size(), x4.size());
+          const double* i1data = in(1)->get_block_view(x1, x0, x5, x4);
+          BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, x5, x4));
+          sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), x5.size(), x4.size());
           dgemm_("T", "N", ci0.size(), 1, x1.size()*x0.size()*x5.size()*x4.size(),
-                 1.0, i0data_sorted, x1.size()*x0.size()*x5.size()*x4.size(), i1data_sorted, x1.size()*x0.size()*x5.size()*x4.size(),
-                 1.0, odata_sorted, ci0.size());
+                 1.0, i0data_sorted.get(), x1.size()*x0.size()*x5.size()*x4.size(), i1data_sorted.get(), x1.size()*x0.size()*x5.size()*x4.size(),
+                 1.0, odata_sorted.get(), ci0.size());
         }
       }
     }
   }
-  sort_indices<0,1,1,1,1>(odata_sorted, odata, ci0.size());
+  sort_indices<0,1,1,1,1>(odata_sorted.get(), odata.get(), ci0.size());
   out()->put_block(odata, ci0);
 }
 
@@ -505,24 +505,24 @@ void Task774::Task_local::compute() {
   const Index x4 = b(3);
   // tensor label: I769
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x5, x4);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x5, x4)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x5, x4));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x5, x4), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& c2 : *range_[0]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x5, c2, x4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x5, c2, x4)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), x5.size(), c2.size(), x4.size());
+      const double* i0data = in(0)->get_block_view(c1, x5, c2, x4);
+      BlockBuffer i0data_sorted(in(0)->get_size(c1, x5, c2, x4));
+      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), x5.size(), c2.size(), x4.size());
       // tensor label: I770
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c2, x0, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c2, x0, c1)]);
-      sort_indices<3,1,0,2,0,1,1,1>(i1data, i1data_sorted, x1.size(), c2.size(), x0.size(), c1.size());
+      const double* i1data = in(1)->get_block_view(x1, c2, x0, c1);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, c2, x0, c1));
+      sort_indices<3,1,0,2,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), c2.size(), x0.size(), c1.size());
       dgemm_("T", "N", x5.size()*x4.size(), x1.size()*x0.size(), c2.size()*c1.size(),
-             1.0, i0data_sorted, c2.size()*c1.size(), i1data_sorted, c2.size()*c1.size(),
-             1.0, odata_sorted, x5.size()*x4.size());
+             1.0, i0data_sorted.get(), c2.size()*c1.size(), i1data_sorted.get(), c2.size()*c1.size(),
+             1.0, odata_sorted.get(), x5.size()*x4.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x1.size(), x0.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x5.size(), x4.size(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0, x5, x4);
 }
 
@@ -535,8 +535,8 @@ void Task775::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, c2, x0, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x0, c2, x1);
-    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata, c1.size(), x0.size(), c2.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c1, x0, c2, x1);
+    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata.get(), c1.size(), x0.size(), c2.size(), x1.size());
   }
   out()->put_block(odata, x1, c2, x0, c1);
 }
@@ -545,28 +545,28 @@ void Task776::Task_local::compute() {
   const Index ci0 = b(0);
   // tensor label: I768
   std::unique_ptr<double[]> odata = out()->move_block(ci0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(ci0)]);
+  BlockBuffer odata_sorted(out()->get_size(ci0));
   std::fill_n(odata_sorted.get(), out()->get_size(ci0), 0.0);
   for (auto& x0 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         for (auto& x2 : *range_[1]) {
           // tensor label: Gamma271
-          std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x0, x3, x1, x2);
-          std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(ci0, x0, x3, x1, x2)]);
-          sort_indices<1,2,3,4,0,0,1,1,1>(i0data, i0data_sorted, ci0.size(), x0.size(), x3.size(), x1.size(), x2.size());
+          const double* i0data = in(0)->get_block_view(ci0, x0, x3, x1, x2);
+          BlockBuffer i0data_sorted(in(0)->get_size(ci0, x0, x3, x1, x2));
+          sort_indices<1,2,3,4,0,0,1,1,1>(i0data, i0data_sorted.get(), ci0.size(), x0.size(), x3.size(), x1.size(), x2.size());
           // tensor label: I772
-          std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, x3, x2);
-          std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, x3, x2)]);
-          sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), x3.size(), x2.size());
+          const double* i1data = in(1)->get_block_view(x1, x0, x3, x2);
+          BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, x3, x2));
+          sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), x3.size(), x2.size());
           dgemm_("T", "N", ci0.size(), 1, x1.size()*x0.size()*x3.size()*x2.size(),
-                 1.0, i0data_sorted, x1.size()*x0.size()*x3.size()*x2.size(), i1data_sorted, x1.size()*x0.size()*x3.size()*x2.size(),
-                 1.0, odata_sorted, ci0.size());
+                 1.0, i0data_sorted.get(), x1.size()*x0.size()*x3.size()*x2.size(), i1data_sorted.get(), x1.size()*x0.size()*x3.size()*x2.size(),
+                 1.0, odata_sorted.get(), ci0.size());
         }
       }
     }
   }
-  sort_indices<0,1,1,1,1>(odata_sorted, odata, ci0.size());
+  sort_indices<0,1,1,1,1>(odata_sorted.get(), odata.get(), ci0.size());
   out()->put_block(odata, ci0);
 }
 
@@ -577,24 +577,24 @@ void Task777::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I772
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& c3 : *range_[0]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x3, c3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x3, c3, x2)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), x3.size(), c3.size(), x2.size());
+      const double* i0data = in(0)->get_block_view(c1, x3, c3, x2);
+      BlockBuffer i0data_sorted(in(0)->get_size(c1, x3, c3, x2));
+      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), x3.size(), c3.size(), x2.size());
       // tensor label: I773
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, c1, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, c1, c3)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), c1.size(), c3.size());
+      const double* i1data = in(1)->get_block_view(x1, x0, c1, c3);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, c1, c3));
+      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), c1.size(), c3.size());
       dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), c1.size()*c3.size(),
-             1.0, i0data_sorted, c1.size()*c3.size(), i1data_sorted, c1.size()*c3.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), c1.size()*c3.size(), i1data_sorted.get(), c1.size()*c3.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0, x3, x2);
 }
 
@@ -605,22 +605,22 @@ void Task778::Task_local::compute() {
   const Index c3 = b(3);
   // tensor label: I773
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, c1, c3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, c1, c3)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, c1, c3));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, c1, c3), 0.0);
   for (auto& c2 : *range_[0]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c2, c3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, c3)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), c3.size());
+    const double* i0data = in(0)->get_block_view(c2, c3);
+    BlockBuffer i0data_sorted(in(0)->get_size(c2, c3));
+    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), c2.size(), c3.size());
     // tensor label: I774
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c2, x0, c1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c2, x0, c1)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), c2.size(), x0.size(), c1.size());
+    const double* i1data = in(1)->get_block_view(x1, c2, x0, c1);
+    BlockBuffer i1data_sorted(in(1)->get_size(x1, c2, x0, c1));
+    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), c2.size(), x0.size(), c1.size());
     dgemm_("T", "N", c3.size(), x1.size()*x0.size()*c1.size(), c2.size(),
-           1.0, i0data_sorted, c2.size(), i1data_sorted, c2.size(),
-           1.0, odata_sorted, c3.size());
+           1.0, i0data_sorted.get(), c2.size(), i1data_sorted.get(), c2.size(),
+           1.0, odata_sorted.get(), c3.size());
   }
-  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, c3.size(), x1.size(), x0.size(), c1.size());
+  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted.get(), odata.get(), c3.size(), x1.size(), x0.size(), c1.size());
   out()->put_block(odata, x1, x0, c1, c3);
 }
 
@@ -633,8 +633,8 @@ void Task779::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, c2, x0, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x0, c2, x1);
-    sort_indices<3,2,1,0,1,1,-8,1>(i0data, odata, c1.size(), x0.size(), c2.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c1, x0, c2, x1);
+    sort_indices<3,2,1,0,1,1,-8,1>(i0data, odata.get(), c1.size(), x0.size(), c2.size(), x1.size());
   }
   out()->put_block(odata, x1, c2, x0, c1);
 }
@@ -646,24 +646,24 @@ void Task780::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I772
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& c2 : *range_[0]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x3, c2, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x3, c2, x2)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), x3.size(), c2.size(), x2.size());
+      const double* i0data = in(0)->get_block_view(c1, x3, c2, x2);
+      BlockBuffer i0data_sorted(in(0)->get_size(c1, x3, c2, x2));
+      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), x3.size(), c2.size(), x2.size());
       // tensor label: I1132
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c2, x0, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c2, x0, c1)]);
-      sort_indices<3,1,0,2,0,1,1,1>(i1data, i1data_sorted, x1.size(), c2.size(), x0.size(), c1.size());
+      const double* i1data = in(1)->get_block_view(x1, c2, x0, c1);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, c2, x0, c1));
+      sort_indices<3,1,0,2,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), c2.size(), x0.size(), c1.size());
       dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), c2.size()*c1.size(),
-             1.0, i0data_sorted, c2.size()*c1.size(), i1data_sorted, c2.size()*c1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), c2.size()*c1.size(), i1data_sorted.get(), c2.size()*c1.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0, x3, x2);
 }
 
@@ -678,7 +678,7 @@ void Task781::Task_local::compute() {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x0, c2, x1);
     dscal_(x1.size()*c2.size()*x0.size()*c1.size(), e0_, i0data.get(), 1);
-    sort_indices<3,2,1,0,1,1,-4,1>(i0data, odata, c1.size(), x0.size(), c2.size(), x1.size());
+    sort_indices<3,2,1,0,1,1,-4,1>(i0data.get(), odata.get(), c1.size(), x0.size(), c2.size(), x1.size());
   }
   out()->put_block(odata, x1, c2, x0, c1);
 }
@@ -690,24 +690,24 @@ void Task782::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I772
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& c2 : *range_[0]) {
       // tensor label: v2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x3, c2, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x3, c2, x2)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), x3.size(), c2.size(), x2.size());
+      const double* i0data = in(0)->get_block_view(c1, x3, c2, x2);
+      BlockBuffer i0data_sorted(in(0)->get_size(c1, x3, c2, x2));
+      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), x3.size(), c2.size(), x2.size());
       // tensor label: I1168
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c2, x0, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c2, x0, c1)]);
-      sort_indices<3,1,0,2,0,1,1,1>(i1data, i1data_sorted, x1.size(), c2.size(), x0.size(), c1.size());
+      const double* i1data = in(1)->get_block_view(x1, c2, x0, c1);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, c2, x0, c1));
+      sort_indices<3,1,0,2,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), c2.size(), x0.size(), c1.size());
       dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), c2.size()*c1.size(),
-             1.0, i0data_sorted, c2.size()*c1.size(), i1data_sorted, c2.size()*c1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), c2.size()*c1.size(), i1data_sorted.get(), c2.size()*c1.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0, x3, x2);
 }
 
@@ -720,8 +720,8 @@ void Task783::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, c2, x0, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x0, c2, x1);
-    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata, c1.size(), x0.size(), c2.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c1, x0, c2, x1);
+    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata.get(), c1.size(), x0.size(), c2.size(), x1.size());
   }
   out()->put_block(odata, x1, c2, x0, c1);
 }
@@ -733,24 +733,24 @@ void Task784::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I772
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& c2 : *range_[0]) {
       // tensor label: v2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x0, c2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x0, c2, x1)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), x0.size(), c2.size(), x1.size());
+      const double* i0data = in(0)->get_block_view(c1, x0, c2, x1);
+      BlockBuffer i0data_sorted(in(0)->get_size(c1, x0, c2, x1));
+      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), x0.size(), c2.size(), x1.size());
       // tensor label: I1222
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c2, x3, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c2, x3, c1)]);
-      sort_indices<3,1,0,2,0,1,1,1>(i1data, i1data_sorted, x2.size(), c2.size(), x3.size(), c1.size());
+      const double* i1data = in(1)->get_block_view(x2, c2, x3, c1);
+      BlockBuffer i1data_sorted(in(1)->get_size(x2, c2, x3, c1));
+      sort_indices<3,1,0,2,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), c2.size(), x3.size(), c1.size());
       dgemm_("T", "N", x0.size()*x1.size(), x2.size()*x3.size(), c2.size()*c1.size(),
-             1.0, i0data_sorted, c2.size()*c1.size(), i1data_sorted, c2.size()*c1.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+             1.0, i0data_sorted.get(), c2.size()*c1.size(), i1data_sorted.get(), c2.size()*c1.size(),
+             1.0, odata_sorted.get(), x0.size()*x1.size());
     }
   }
-  sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x3.size());
+  sort_indices<1,0,3,2,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), x2.size(), x3.size());
   out()->put_block(odata, x1, x0, x3, x2);
 }
 
@@ -763,8 +763,8 @@ void Task785::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x2, c2, x3, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x3, c2, x2);
-    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata, c1.size(), x3.size(), c2.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(c1, x3, c2, x2);
+    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata.get(), c1.size(), x3.size(), c2.size(), x2.size());
   }
   out()->put_block(odata, x2, c2, x3, c1);
 }
@@ -773,7 +773,7 @@ void Task786::Task_local::compute() {
   const Index ci0 = b(0);
   // tensor label: I768
   std::unique_ptr<double[]> odata = out()->move_block(ci0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(ci0)]);
+  BlockBuffer odata_sorted(out()->get_size(ci0));
   std::fill_n(odata_sorted.get(), out()->get_size(ci0), 0.0);
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
@@ -782,23 +782,23 @@ void Task786::Task_local::compute() {
           for (auto& x1 : *range_[1]) {
             for (auto& x2 : *range_[1]) {
               // tensor label: Gamma272
-              std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x5, x4, x0, x3, x1, x2);
-              std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(ci0, x5, x4, x0, x3, x1, x2)]);
-              sort_indices<1,2,3,4,5,6,0,0,1,1,1>(i0data, i0data_sorted, ci0.size(), x5.size(), x4.size(), x0.size(), x3.size(), x1.size(), x2.size());
+              const double* i0data = in(0)->get_block_view(ci0, x5, x4, x0, x3, x1, x2);
+              BlockBuffer i0data_sorted(in(0)->get_size(ci0, x5, x4, x0, x3, x1, x2));
+              sort_indices<1,2,3,4,5,6,0,0,1,1,1>(i0data, i0data_sorted.get(), ci0.size(), x5.size(), x4.size(), x0.size(), x3.size(), x1.size(), x2.size());
               // tensor label: I776
-              std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, x2, x5, x4, x3);
-              std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, x2, x5, x4, x3)]);
-              sort_indices<3,4,1,5,0,2,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), x2.size(), x5.size(), x4.size(), x3.size());
+              const double* i1data = in(1)->get_block_view(x1, x0, x2, x5, x4, x3);
+              BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, x2, x5, x4, x3));
+              sort_indices<3,4,1,5,0,2,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), x2.size(), x5.size(), x4.size(), x3.size());
               dgemm_("T", "N", ci0.size(), 1, x1.size()*x0.size()*x2.size()*x5.size()*x4.size()*x3.size(),
-                     1.0, i0data_sorted, x1.size()*x0.size()*x2.size()*x5.size()*x4.size()*x3.size(), i1data_sorted, x1.size()*x0.size()*x2.size()*x5.size()*x4.size()*x3.size(),
-                     1.0, odata_sorted, ci0.size());
+                     1.0, i0data_sorted.get(), x1.size()*x0.size()*x2.size()*x5.size()*x4.size()*x3.size(), i1data_sorted.get(), x1.size()*x0.size()*x2.size()*x5.size()*x4.size()*x3.size(),
+                     1.0, odata_sorted.get(), ci0.size());
             }
           }
         }
       }
     }
   }
-  sort_indices<0,1,1,1,1>(odata_sorted, odata, ci0.size());
+  sort_indices<0,1,1,1,1>(odata_sorted.get(), odata.get(), ci0.size());
   out()->put_block(odata, ci0);
 }
 
@@ -811,22 +811,22 @@ void Task787::Task_local::compute() {
   const Index x3 = b(5);
   // tensor label: I776
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x2, x5, x4, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x2, x5, x4, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x2, x5, x4, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x2, x5, x4, x3), 0.0);
   for (auto& c1 : *range_[0]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, c1, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, c1, x3)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), c1.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(x5, x4, c1, x3);
+    BlockBuffer i0data_sorted(in(0)->get_size(x5, x4, c1, x3));
+    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), x4.size(), c1.size(), x3.size());
     // tensor label: I777
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, c1, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, c1, x2)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), c1.size(), x2.size());
+    const double* i1data = in(1)->get_block_view(x1, x0, c1, x2);
+    BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, c1, x2));
+    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), c1.size(), x2.size());
     dgemm_("T", "N", x5.size()*x4.size()*x3.size(), x1.size()*x0.size()*x2.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, x5.size()*x4.size()*x3.size());
+           1.0, i0data_sorted.get(), c1.size(), i1data_sorted.get(), c1.size(),
+           1.0, odata_sorted.get(), x5.size()*x4.size()*x3.size());
   }
-  sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), x1.size(), x0.size(), x2.size());
+  sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x5.size(), x4.size(), x3.size(), x1.size(), x0.size(), x2.size());
   out()->put_block(odata, x1, x0, x2, x5, x4, x3);
 }
 
@@ -837,22 +837,22 @@ void Task788::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I777
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, c1, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, c1, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, c1, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, c1, x2), 0.0);
   for (auto& c2 : *range_[0]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c2, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, x2)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(c2, x2);
+    BlockBuffer i0data_sorted(in(0)->get_size(c2, x2));
+    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), c2.size(), x2.size());
     // tensor label: I778
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c2, x0, c1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c2, x0, c1)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), c2.size(), x0.size(), c1.size());
+    const double* i1data = in(1)->get_block_view(x1, c2, x0, c1);
+    BlockBuffer i1data_sorted(in(1)->get_size(x1, c2, x0, c1));
+    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), c2.size(), x0.size(), c1.size());
     dgemm_("T", "N", x2.size(), x1.size()*x0.size()*c1.size(), c2.size(),
-           1.0, i0data_sorted, c2.size(), i1data_sorted, c2.size(),
-           1.0, odata_sorted, x2.size());
+           1.0, i0data_sorted.get(), c2.size(), i1data_sorted.get(), c2.size(),
+           1.0, odata_sorted.get(), x2.size());
   }
-  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size(), x0.size(), c1.size());
+  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted.get(), odata.get(), x2.size(), x1.size(), x0.size(), c1.size());
   out()->put_block(odata, x1, x0, c1, x2);
 }
 
@@ -865,8 +865,8 @@ void Task789::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, c2, x0, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x0, c2, x1);
-    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata, c1.size(), x0.size(), c2.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c1, x0, c2, x1);
+    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata.get(), c1.size(), x0.size(), c2.size(), x1.size());
   }
   out()->put_block(odata, x1, c2, x0, c1);
 }
@@ -875,28 +875,28 @@ void Task790::Task_local::compute() {
   const Index ci0 = b(0);
   // tensor label: I768
   std::unique_ptr<double[]> odata = out()->move_block(ci0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(ci0)]);
+  BlockBuffer odata_sorted(out()->get_size(ci0));
   std::fill_n(odata_sorted.get(), out()->get_size(ci0), 0.0);
   for (auto& x1 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x0 : *range_[1]) {
         for (auto& x2 : *range_[1]) {
           // tensor label: Gamma273
-          std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x1, x3, x0, x2);
-          std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(ci0, x1, x3, x0, x2)]);
-          sort_indices<1,2,3,4,0,0,1,1,1>(i0data, i0data_sorted, ci0.size(), x1.size(), x3.size(), x0.size(), x2.size());
+          const double* i0data = in(0)->get_block_view(ci0, x1, x3, x0, x2);
+          BlockBuffer i0data_sorted(in(0)->get_size(ci0, x1, x3, x0, x2));
+          sort_indices<1,2,3,4,0,0,1,1,1>(i0data, i0data_sorted.get(), ci0.size(), x1.size(), x3.size(), x0.size(), x2.size());
           // tensor label: I780
-          std::unique_ptr<double[]> i1data = in(1)->get_block(x2, x3, x1, x0);
-          std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, x3, x1, x0)]);
-          sort_indices<2,1,3,0,0,1,1,1>(i1data, i1data_sorted, x2.size(), x3.size(), x1.size(), x0.size());
+          const double* i1data = in(1)->get_block_view(x2, x3, x1, x0);
+          BlockBuffer i1data_sorted(in(1)->get_size(x2, x3, x1, x0));
+          sort_indices<2,1,3,0,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), x3.size(), x1.size(), x0.size());
           dgemm_("T", "N", ci0.size(), 1, x2.size()*x3.size()*x1.size()*x0.size(),
-                 1.0, i0data_sorted, x2.size()*x3.size()*x1.size()*x0.size(), i1data_sorted, x2.size()*x3.size()*x1.size()*x0.size(),
-                 1.0, odata_sorted, ci0.size());
+                 1.0, i0data_sorted.get(), x2.size()*x3.size()*x1.size()*x0.size(), i1data_sorted.get(), x2.size()*x3.size()*x1.size()*x0.size(),
+                 1.0, odata_sorted.get(), ci0.size());
         }
       }
     }
   }
-  sort_indices<0,1,1,1,1>(odata_sorted, odata, ci0.size());
+  sort_indices<0,1,1,1,1>(odata_sorted.get(), odata.get(), ci0.size());
   out()->put_block(odata, ci0);
 }
 
@@ -907,24 +907,24 @@ void Task791::Task_local::compute() {
   const Index x0 = b(3);
   // tensor label: I780
   std::unique_ptr<double[]> odata = out()->move_block(x2, x3, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x3, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x2, x3, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x3, x1, x0), 0.0);
   for (auto& c2 : *range_[0]) {
     for (auto& c1 : *range_[0]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x0, c2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x0, c2, x1)]);
-      sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), x0.size(), c2.size(), x1.size());
+      const double* i0data = in(0)->get_block_view(c1, x0, c2, x1);
+      BlockBuffer i0data_sorted(in(0)->get_size(c1, x0, c2, x1));
+      sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), x0.size(), c2.size(), x1.size());
       // tensor label: I781
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c1, c2, x3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c1, c2, x3)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, x2.size(), c1.size(), c2.size(), x3.size());
+      const double* i1data = in(1)->get_block_view(x2, c1, c2, x3);
+      BlockBuffer i1data_sorted(in(1)->get_size(x2, c1, c2, x3));
+      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), c1.size(), c2.size(), x3.size());
       dgemm_("T", "N", x1.size()*x0.size(), x2.size()*x3.size(), c1.size()*c2.size(),
-             1.0, i0data_sorted, c1.size()*c2.size(), i1data_sorted, c1.size()*c2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+             1.0, i0data_sorted.get(), c1.size()*c2.size(), i1data_sorted.get(), c1.size()*c2.size(),
+             1.0, odata_sorted.get(), x1.size()*x0.size());
     }
   }
-  sort_indices<2,3,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x3.size());
+  sort_indices<2,3,1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), x2.size(), x3.size());
   out()->put_block(odata, x2, x3, x1, x0);
 }
 
@@ -935,22 +935,22 @@ void Task792::Task_local::compute() {
   const Index x3 = b(3);
   // tensor label: I781
   std::unique_ptr<double[]> odata = out()->move_block(x2, c1, c2, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, c1, c2, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(x2, c1, c2, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(x2, c1, c2, x3), 0.0);
   for (auto& a3 : *range_[2]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a3, c2, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a3, c2, x3)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a3.size(), c2.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(c1, a3, c2, x3);
+    BlockBuffer i0data_sorted(in(0)->get_size(c1, a3, c2, x3));
+    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a3.size(), c2.size(), x3.size());
     // tensor label: I782
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x2)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a3.size(), x2.size());
+    const double* i1data = in(1)->get_block_view(a3, x2);
+    BlockBuffer i1data_sorted(in(1)->get_size(a3, x2));
+    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), x2.size());
     dgemm_("T", "N", c1.size()*c2.size()*x3.size(), x2.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, c1.size()*c2.size()*x3.size());
+           1.0, i0data_sorted.get(), a3.size(), i1data_sorted.get(), a3.size(),
+           1.0, odata_sorted.get(), c1.size()*c2.size()*x3.size());
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, c1.size(), c2.size(), x3.size(), x2.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), c1.size(), c2.size(), x3.size(), x2.size());
   out()->put_block(odata, x2, c1, c2, x3);
 }
 
@@ -961,8 +961,8 @@ void Task793::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, x2);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a3, x2);
-    sort_indices<0,1,1,1,-4,1>(i0data, odata, a3.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(a3, x2);
+    sort_indices<0,1,1,1,-4,1>(i0data, odata.get(), a3.size(), x2.size());
   }
   out()->put_block(odata, a3, x2);
 }
@@ -974,24 +974,24 @@ void Task794::Task_local::compute() {
   const Index x0 = b(3);
   // tensor label: I780
   std::unique_ptr<double[]> odata = out()->move_block(x2, x3, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x3, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x2, x3, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x3, x1, x0), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& c3 : *range_[0]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x3, c3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x3, c3, x2)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), x3.size(), c3.size(), x2.size());
+      const double* i0data = in(0)->get_block_view(c1, x3, c3, x2);
+      BlockBuffer i0data_sorted(in(0)->get_size(c1, x3, c3, x2));
+      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), x3.size(), c3.size(), x2.size());
       // tensor label: I812
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c3, c1, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c3, c1, x1)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, x0.size(), c3.size(), c1.size(), x1.size());
+      const double* i1data = in(1)->get_block_view(x0, c3, c1, x1);
+      BlockBuffer i1data_sorted(in(1)->get_size(x0, c3, c1, x1));
+      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), c3.size(), c1.size(), x1.size());
       dgemm_("T", "N", x3.size()*x2.size(), x0.size()*x1.size(), c3.size()*c1.size(),
-             1.0, i0data_sorted, c3.size()*c1.size(), i1data_sorted, c3.size()*c1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), c3.size()*c1.size(), i1data_sorted.get(), c3.size()*c1.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x0.size(), x1.size());
+  sort_indices<1,0,3,2,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x0.size(), x1.size());
   out()->put_block(odata, x2, x3, x1, x0);
 }
 
@@ -1002,22 +1002,22 @@ void Task795::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I812
   std::unique_ptr<double[]> odata = out()->move_block(x0, c3, c1, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, c3, c1, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, c3, c1, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, c3, c1, x1), 0.0);
   for (auto& a2 : *range_[2]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a2)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(x1, a2);
+    BlockBuffer i0data_sorted(in(0)->get_size(x1, a2));
+    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), a2.size());
     // tensor label: I813
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c3, a2, c1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c3, a2, c1)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x0.size(), c3.size(), a2.size(), c1.size());
+    const double* i1data = in(1)->get_block_view(x0, c3, a2, c1);
+    BlockBuffer i1data_sorted(in(1)->get_size(x0, c3, a2, c1));
+    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), c3.size(), a2.size(), c1.size());
     dgemm_("T", "N", x1.size(), x0.size()*c3.size()*c1.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, x1.size());
+           1.0, i0data_sorted.get(), a2.size(), i1data_sorted.get(), a2.size(),
+           1.0, odata_sorted.get(), x1.size());
   }
-  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c3.size(), c1.size());
+  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size(), c3.size(), c1.size());
   out()->put_block(odata, x0, c3, c1, x1);
 }
 
@@ -1030,8 +1030,8 @@ void Task796::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x0, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-    sort_indices<3,2,1,0,1,1,-4,1>(i0data, odata, c1.size(), a2.size(), c3.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, x0);
+    sort_indices<3,2,1,0,1,1,-4,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), x0.size());
   }
   out()->put_block(odata, x0, c3, a2, c1);
 }
@@ -1040,7 +1040,7 @@ void Task797::Task_local::compute() {
   const Index ci0 = b(0);
   // tensor label: I768
   std::unique_ptr<double[]> odata = out()->move_block(ci0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(ci0)]);
+  BlockBuffer odata_sorted(out()->get_size(ci0));
   std::fill_n(odata_sorted.get(), out()->get_size(ci0), 0.0);
   for (auto& x2 : *range_[1]) {
     for (auto& x5 : *range_[1]) {
@@ -1049,23 +1049,23 @@ void Task797::Task_local::compute() {
           for (auto& x1 : *range_[1]) {
             for (auto& x0 : *range_[1]) {
               // tensor label: Gamma274
-              std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x2, x5, x3, x4, x1, x0);
-              std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(ci0, x2, x5, x3, x4, x1, x0)]);
-              sort_indices<1,2,3,4,5,6,0,0,1,1,1>(i0data, i0data_sorted, ci0.size(), x2.size(), x5.size(), x3.size(), x4.size(), x1.size(), x0.size());
+              const double* i0data = in(0)->get_block_view(ci0, x2, x5, x3, x4, x1, x0);
+              BlockBuffer i0data_sorted(in(0)->get_size(ci0, x2, x5, x3, x4, x1, x0));
+              sort_indices<1,2,3,4,5,6,0,0,1,1,1>(i0data, i0data_sorted.get(), ci0.size(), x2.size(), x5.size(), x3.size(), x4.size(), x1.size(), x0.size());
               // tensor label: I784
-              std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x5, x4, x2, x1, x0);
-              std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x5, x4, x2, x1, x0)]);
-              sort_indices<3,1,0,2,4,5,0,1,1,1>(i1data, i1data_sorted, x3.size(), x5.size(), x4.size(), x2.size(), x1.size(), x0.size());
+              const double* i1data = in(1)->get_block_view(x3, x5, x4, x2, x1, x0);
+              BlockBuffer i1data_sorted(in(1)->get_size(x3, x5, x4, x2, x1, x0));
+              sort_indices<3,1,0,2,4,5,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), x5.size(), x4.size(), x2.size(), x1.size(), x0.size());
               dgemm_("T", "N", ci0.size(), 1, x3.size()*x5.size()*x4.size()*x2.size()*x1.size()*x0.size(),
-                     1.0, i0data_sorted, x3.size()*x5.size()*x4.size()*x2.size()*x1.size()*x0.size(), i1data_sorted, x3.size()*x5.size()*x4.size()*x2.size()*x1.size()*x0.size(),
-                     1.0, odata_sorted, ci0.size());
+                     1.0, i0data_sorted.get(), x3.size()*x5.size()*x4.size()*x2.size()*x1.size()*x0.size(), i1data_sorted.get(), x3.size()*x5.size()*x4.size()*x2.size()*x1.size()*x0.size(),
+                     1.0, odata_sorted.get(), ci0.size());
             }
           }
         }
       }
     }
   }
-  sort_indices<0,1,1,1,1>(odata_sorted, odata, ci0.size());
+  sort_indices<0,1,1,1,1>(odata_sorted.get(), odata.get(), ci0.size());
   out()->put_block(odata, ci0);
 }
 
@@ -1078,22 +1078,22 @@ void Task798::Task_local::compute() {
   const Index x0 = b(5);
   // tensor label: I784
   std::unique_ptr<double[]> odata = out()->move_block(x3, x5, x4, x2, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x5, x4, x2, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, x5, x4, x2, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x5, x4, x2, x1, x0), 0.0);
   for (auto& c1 : *range_[0]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1, c1, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1, c1, x2)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size(), c1.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x0, x1, c1, x2);
+    BlockBuffer i0data_sorted(in(0)->get_size(x0, x1, c1, x2));
+    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), x1.size(), c1.size(), x2.size());
     // tensor label: I785
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x3, c1, x5, x4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, c1, x5, x4)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), c1.size(), x5.size(), x4.size());
+    const double* i1data = in(1)->get_block_view(x3, c1, x5, x4);
+    BlockBuffer i1data_sorted(in(1)->get_size(x3, c1, x5, x4));
+    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), c1.size(), x5.size(), x4.size());
     dgemm_("T", "N", x2.size()*x1.size()*x0.size(), x3.size()*x5.size()*x4.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+           1.0, i0data_sorted.get(), c1.size(), i1data_sorted.get(), c1.size(),
+           1.0, odata_sorted.get(), x2.size()*x1.size()*x0.size());
   }
-  sort_indices<3,4,5,2,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x3.size(), x5.size(), x4.size());
+  sort_indices<3,4,5,2,1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), x2.size(), x3.size(), x5.size(), x4.size());
   out()->put_block(odata, x3, x5, x4, x2, x1, x0);
 }
 
@@ -1104,22 +1104,22 @@ void Task799::Task_local::compute() {
   const Index x4 = b(3);
   // tensor label: I785
   std::unique_ptr<double[]> odata = out()->move_block(x3, c1, x5, x4);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, c1, x5, x4)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, c1, x5, x4));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, c1, x5, x4), 0.0);
   for (auto& c2 : *range_[0]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x5, c2, x4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x5, c2, x4)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), x5.size(), c2.size(), x4.size());
+    const double* i0data = in(0)->get_block_view(c1, x5, c2, x4);
+    BlockBuffer i0data_sorted(in(0)->get_size(c1, x5, c2, x4));
+    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), x5.size(), c2.size(), x4.size());
     // tensor label: I786
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x3, c2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, c2)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, x3.size(), c2.size());
+    const double* i1data = in(1)->get_block_view(x3, c2);
+    BlockBuffer i1data_sorted(in(1)->get_size(x3, c2));
+    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), c2.size());
     dgemm_("T", "N", c1.size()*x5.size()*x4.size(), x3.size(), c2.size(),
-           1.0, i0data_sorted, c2.size(), i1data_sorted, c2.size(),
-           1.0, odata_sorted, c1.size()*x5.size()*x4.size());
+           1.0, i0data_sorted.get(), c2.size(), i1data_sorted.get(), c2.size(),
+           1.0, odata_sorted.get(), c1.size()*x5.size()*x4.size());
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, c1.size(), x5.size(), x4.size(), x3.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), c1.size(), x5.size(), x4.size(), x3.size());
   out()->put_block(odata, x3, c1, x5, x4);
 }
 
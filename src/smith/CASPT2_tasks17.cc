@@ -40,8 +40,8 @@ void Task800::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x3, c2);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, c2);
-    sort_indices<0,1,1,1,4,1>(i0data, odata, x3.size(), c2.size());
+    const double* i0data = in(0)->get_block_view(x3, c2);
+    sort_indices<0,1,1,1,4,1>(i0data, odata.get(), x3.size(), c2.size());
   }
   out()->put_block(odata, x3, c2);
 }
@@ -50,7 +50,7 @@ void Task801::Task_local::compute() {
   const Index ci0 = b(0);
   // tensor label: I768
   std::unique_ptr<double[]> odata = out()->move_block(ci0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(ci0)]);
+  BlockBuffer odata_sorted(out()->get_size(ci0));
   std::fill_n(odata_sorted.get(), out()->get_size(ci0), 0.0);
   for (auto& x7 : *range_[1]) {
     for (auto& x6 : *range_[1]) {
@@ -59,23 +59,23 @@ void Task801::Task_local::compute() {
           for (auto& x1 : *range_[1]) {
             for (auto& x0 : *range_[1]) {
               // tensor label: Gamma275
-              std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x7, x6, x2, x5, x1, x0);
-              std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(ci0, x7, x6, x2, x5, x1, x0)]);
-              sort_indices<1,2,3,4,5,6,0,0,1,1,1>(i0data, i0data_sorted, ci0.size(), x7.size(), x6.size(), x2.size(), x5.size(), x1.size(), x0.size());
+              const double* i0data = in(0)->get_block_view(ci0, x7, x6, x2, x5, x1, x0);
+              BlockBuffer i0data_sorted(in(0)->get_size(ci0, x7, x6, x2, x5, x1, x0));
+              sort_indices<1,2,3,4,5,6,0,0,1,1,1>(i0data, i0data_sorted.get(), ci0.size(), x7.size(), x6.size(), x2.size(), x5.size(), x1.size(), x0.size());
               // tensor label: I788
-              std::unique_ptr<double[]> i1data = in(1)->get_block(x2, x1, x0, x7, x6, x5);
-              std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, x1, x0, x7, x6, x5)]);
-              sort_indices<3,4,0,5,1,2,0,1,1,1>(i1data, i1data_sorted, x2.size(), x1.size(), x0.size(), x7.size(), x6.size(), x5.size());
+              const double* i1data = in(1)->get_block_view(x2, x1, x0, x7, x6, x5);
+              BlockBuffer i1data_sorted(in(1)->get_size(x2, x1, x0, x7, x6, x5));
+              sort_indices<3,4,0,5,1,2,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), x1.size(), x0.size(), x7.size(), x6.size(), x5.size());
               dgemm_("T", "N", ci0.size(), 1, x2.size()*x1.size()*x0.size()*x7.size()*x6.size()*x5.size(),
-                     1.0, i0data_sorted, x2.size()*x1.size()*x0.size()*x7.size()*x6.size()*x5.size(), i1data_sorted, x2.size()*x1.size()*x0.size()*x7.size()*x6.size()*x5.size(),
-                     1.0, odata_sorted, ci0.size());
+                     1.0, i0data_sorted.get(), x2.size()*x1.size()*x0.size()*x7.size()*x6.size()*x5.size(), i1data_sorted.get(), x2.size()*x1.size()*x0.size()*x7.size()*x6.size()*x5.size(),
+                     1.0, odata_sorted.get(), ci0.size());
             }
           }
         }
       }
     }
   }
-  sort_indices<0,1,1,1,1>(odata_sorted, odata, ci0.size());
+  sort_indices<0,1,1,1,1>(odata_sorted.get(), odata.get(), ci0.size());
   out()->put_block(odata, ci0);
 }
 
@@ -88,22 +88,22 @@ void Task802::Task_local::compute() {
   const Index x5 = b(5);
   // tensor label: I788
   std::unique_ptr<double[]> odata = out()->move_block(x2, x1, x0, x7, x6, x5);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1, x0, x7, x6, x5)]);
+  BlockBuffer odata_sorted(out()->get_size(x2, x1, x0, x7, x6, x5));
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1, x0, x7, x6, x5), 0.0);
   for (auto& c1 : *range_[0]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x6, c1, x5);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, x6, c1, x5)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x7.size(), x6.size(), c1.size(), x5.size());
+    const double* i0data = in(0)->get_block_view(x7, x6, c1, x5);
+    BlockBuffer i0data_sorted(in(0)->get_size(x7, x6, c1, x5));
+    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted.get(), x7.size(), x6.size(), c1.size(), x5.size());
     // tensor label: I789
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c1, x1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c1, x1, x0)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, x2.size(), c1.size(), x1.size(), x0.size());
+    const double* i1data = in(1)->get_block_view(x2, c1, x1, x0);
+    BlockBuffer i1data_sorted(in(1)->get_size(x2, c1, x1, x0));
+    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), c1.size(), x1.size(), x0.size());
     dgemm_("T", "N", x7.size()*x6.size()*x5.size(), x2.size()*x1.size()*x0.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, x7.size()*x6.size()*x5.size());
+           1.0, i0data_sorted.get(), c1.size(), i1data_sorted.get(), c1.size(),
+           1.0, odata_sorted.get(), x7.size()*x6.size()*x5.size());
   }
-  sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted, odata, x7.size(), x6.size(), x5.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x7.size(), x6.size(), x5.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x2, x1, x0, x7, x6, x5);
 }
 
@@ -116,8 +116,8 @@ void Task803::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x2, c1, x1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1, c1, x2);
-    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata, x0.size(), x1.size(), c1.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x0, x1, c1, x2);
+    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata.get(), x0.size(), x1.size(), c1.size(), x2.size());
   }
   out()->put_block(odata, x2, c1, x1, x0);
 }
@@ -126,7 +126,7 @@ void Task804::Task_local::compute() {
   const Index ci0 = b(0);
   // tensor label: I768
   std::unique_ptr<double[]> odata = out()->move_block(ci0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(ci0)]);
+  BlockBuffer odata_sorted(out()->get_size(ci0));
   std::fill_n(odata_sorted.get(), out()->get_size(ci0), 0.0);
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
@@ -135,23 +135,23 @@ void Task804::Task_local::compute() {
           for (auto& x1 : *range_[1]) {
             for (auto& x0 : *range_[1]) {
               // tensor label: Gamma276
-              std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x5, x4, x2, x3, x1, x0);
-              std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(ci0, x5, x4, x2, x3, x1, x0)]);
-              sort_indices<1,2,3,4,5,6,0,0,1,1,1>(i0data, i0data_sorted, ci0.size(), x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
+              const double* i0data = in(0)->get_block_view(ci0, x5, x4, x2, x3, x1, x0);
+              BlockBuffer i0data_sorted(in(0)->get_size(ci0, x5, x4, x2, x3, x1, x0));
+              sort_indices<1,2,3,4,5,6,0,0,1,1,1>(i0data, i0data_sorted.get(), ci0.size(), x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
               // tensor label: I791
-              std::unique_ptr<double[]> i1data = in(1)->get_block(x2, x1, x0, x5, x4, x3);
-              std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, x1, x0, x5, x4, x3)]);
-              sort_indices<3,4,0,5,1,2,0,1,1,1>(i1data, i1data_sorted, x2.size(), x1.size(), x0.size(), x5.size(), x4.size(), x3.size());
+              const double* i1data = in(1)->get_block_view(x2, x1, x0, x5, x4, x3);
+              BlockBuffer i1data_sorted(in(1)->get_size(x2, x1, x0, x5, x4, x3));
+              sort_indices<3,4,0,5,1,2,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), x1.size(), x0.size(), x5.size(), x4.size(), x3.size());
               dgemm_("T", "N", ci0.size(), 1, x2.size()*x1.size()*x0.size()*x5.size()*x4.size()*x3.size(),
-                     1.0, i0data_sorted, x2.size()*x1.size()*x0.size()*x5.size()*x4.size()*x3.size(), i1data_sorted, x2.size()*x1.size()*x0.size()*x5.size()*x4.size()*x3.size(),
-                     1.0, odata_sorted, ci0.size());
+                     1.0, i0data_sorted.get(), x2.size()*x1.size()*x0.size()*x5.size()*x4.size()*x3.size(), i1data_sorted.get(), x2.size()*x1.size()*x0.size()*x5.size()*x4.size()*x3.size(),
+                     1.0, odata_sorted.get(), ci0.size());
             }
           }
         }
       }
     }
   }
-  sort_indices<0,1,1,1,1>(odata_sorted, odata, ci0.size());
+  sort_indices<0,1,1,1,1>(odata_sorted.get(), odata.get(), ci0.size());
   out()->put_block(odata, ci0);
 }
 
@@ -164,22 +164,22 @@ void Task805::Task_local::compute() {
   const Index x3 = b(5);
   // tensor label: I791
   std::unique_ptr<double[]> odata = out()->move_block(x2, x1, x0, x5, x4, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1, x0, x5, x4, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(x2, x1, x0, x5, x4, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1, x0, x5, x4, x3), 0.0);
   for (auto& c2 : *range_[0]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, c2, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, c2, x3)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), c2.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(x5, x4, c2, x3);
+    BlockBuffer i0data_sorted(in(0)->get_size(x5, x4, c2, x3));
+    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), x4.size(), c2.size(), x3.size());
     // tensor label: I792
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x2, x1, x0, c2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, x1, x0, c2)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, x2.size(), x1.size(), x0.size(), c2.size());
+    const double* i1data = in(1)->get_block_view(x2, x1, x0, c2);
+    BlockBuffer i1data_sorted(in(1)->get_size(x2, x1, x0, c2));
+    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), x1.size(), x0.size(), c2.size());
     dgemm_("T", "N", x5.size()*x4.size()*x3.size(), x2.size()*x1.size()*x0.size(), c2.size(),
-           1.0, i0data_sorted, c2.size(), i1data_sorted, c2.size(),
-           1.0, odata_sorted, x5.size()*x4.size()*x3.size());
+           1.0, i0data_sorted.get(), c2.size(), i1data_sorted.get(), c2.size(),
+           1.0, odata_sorted.get(), x5.size()*x4.size()*x3.size());
   }
-  sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x2, x1, x0, x5, x4, x3);
 }
 
@@ -190,22 +190,22 @@ void Task806::Task_local::compute() {
   const Index c2 = b(3);
   // tensor label: I792
   std::unique_ptr<double[]> odata = out()->move_block(x2, x1, x0, c2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1, x0, c2)]);
+  BlockBuffer odata_sorted(out()->get_size(x2, x1, x0, c2));
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1, x0, c2), 0.0);
   for (auto& c1 : *range_[0]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, c2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, c2)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), c2.size());
+    const double* i0data = in(0)->get_block_view(c1, c2);
+    BlockBuffer i0data_sorted(in(0)->get_size(c1, c2));
+    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), c2.size());
     // tensor label: I793
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c1, x1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c1, x1, x0)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, x2.size(), c1.size(), x1.size(), x0.size());
+    const double* i1data = in(1)->get_block_view(x2, c1, x1, x0);
+    BlockBuffer i1data_sorted(in(1)->get_size(x2, c1, x1, x0));
+    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), c1.size(), x1.size(), x0.size());
     dgemm_("T", "N", c2.size(), x2.size()*x1.size()*x0.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, c2.size());
+           1.0, i0data_sorted.get(), c1.size(), i1data_sorted.get(), c1.size(),
+           1.0, odata_sorted.get(), c2.size());
   }
-  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, c2.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted.get(), odata.get(), c2.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x2, x1, x0, c2);
 }
 
@@ -218,8 +218,8 @@ void Task807::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x2, c1, x1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1, c1, x2);
-    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata, x0.size(), x1.size(), c1.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x0, x1, c1, x2);
+    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata.get(), x0.size(), x1.size(), c1.size(), x2.size());
   }
   out()->put_block(odata, x2, c1, x1, x0);
 }
@@ -233,22 +233,22 @@ void Task808::Task_local::compute() {
   const Index x3 = b(5);
   // tensor label: I791
   std::unique_ptr<double[]> odata = out()->move_block(x2, x1, x0, x5, x4, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1, x0, x5, x4, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(x2, x1, x0, x5, x4, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1, x0, x5, x4, x3), 0.0);
   for (auto& c1 : *range_[0]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1, c1, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1, c1, x2)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size(), c1.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x0, x1, c1, x2);
+    BlockBuffer i0data_sorted(in(0)->get_size(x0, x1, c1, x2));
+    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), x1.size(), c1.size(), x2.size());
     // tensor label: I808
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x3, c1, x5, x4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, c1, x5, x4)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), c1.size(), x5.size(), x4.size());
+    const double* i1data = in(1)->get_block_view(x3, c1, x5, x4);
+    BlockBuffer i1data_sorted(in(1)->get_size(x3, c1, x5, x4));
+    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), c1.size(), x5.size(), x4.size());
     dgemm_("T", "N", x2.size()*x1.size()*x0.size(), x3.size()*x5.size()*x4.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+           1.0, i0data_sorted.get(), c1.size(), i1data_sorted.get(), c1.size(),
+           1.0, odata_sorted.get(), x2.size()*x1.size()*x0.size());
   }
-  sort_indices<2,1,0,4,5,3,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x3.size(), x5.size(), x4.size());
+  sort_indices<2,1,0,4,5,3,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), x2.size(), x3.size(), x5.size(), x4.size());
   out()->put_block(odata, x2, x1, x0, x5, x4, x3);
 }
 
@@ -259,22 +259,22 @@ void Task809::Task_local::compute() {
   const Index x4 = b(3);
   // tensor label: I808
   std::unique_ptr<double[]> odata = out()->move_block(x3, c1, x5, x4);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, c1, x5, x4)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, c1, x5, x4));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, c1, x5, x4), 0.0);
   for (auto& a2 : *range_[2]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x5, x4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, x5, x4)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), x5.size(), x4.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, x5, x4);
+    BlockBuffer i0data_sorted(in(0)->get_size(c1, a2, x5, x4));
+    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size(), x5.size(), x4.size());
     // tensor label: I809
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a2, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, x3)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a2.size(), x3.size());
+    const double* i1data = in(1)->get_block_view(a2, x3);
+    BlockBuffer i1data_sorted(in(1)->get_size(a2, x3));
+    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a2.size(), x3.size());
     dgemm_("T", "N", c1.size()*x5.size()*x4.size(), x3.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, c1.size()*x5.size()*x4.size());
+           1.0, i0data_sorted.get(), a2.size(), i1data_sorted.get(), a2.size(),
+           1.0, odata_sorted.get(), c1.size()*x5.size()*x4.size());
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, c1.size(), x5.size(), x4.size(), x3.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), c1.size(), x5.size(), x4.size(), x3.size());
   out()->put_block(odata, x3, c1, x5, x4);
 }
 
@@ -285,8 +285,8 @@ void Task810::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a2, x3);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a2, x3);
-    sort_indices<0,1,1,1,2,1>(i0data, odata, a2.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(a2, x3);
+    sort_indices<0,1,1,1,2,1>(i0data, odata.get(), a2.size(), x3.size());
   }
   out()->put_block(odata, a2, x3);
 }
@@ -300,22 +300,22 @@ void Task811::Task_local::compute() {
   const Index x3 = b(5);
   // tensor label: I791
   std::unique_ptr<double[]> odata = out()->move_block(x2, x1, x0, x5, x4, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1, x0, x5, x4, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(x2, x1, x0, x5, x4, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1, x0, x5, x4, x3), 0.0);
   for (auto& c1 : *range_[0]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, c1, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, c1, x3)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), c1.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(x5, x4, c1, x3);
+    BlockBuffer i0data_sorted(in(0)->get_size(x5, x4, c1, x3));
+    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), x4.size(), c1.size(), x3.size());
     // tensor label: I932
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, c1, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, c1, x2)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), c1.size(), x2.size());
+    const double* i1data = in(1)->get_block_view(x1, x0, c1, x2);
+    BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, c1, x2));
+    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), c1.size(), x2.size());
     dgemm_("T", "N", x5.size()*x4.size()*x3.size(), x1.size()*x0.size()*x2.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, x5.size()*x4.size()*x3.size());
+           1.0, i0data_sorted.get(), c1.size(), i1data_sorted.get(), c1.size(),
+           1.0, odata_sorted.get(), x5.size()*x4.size()*x3.size());
   }
-  sort_indices<5,3,4,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), x1.size(), x0.size(), x2.size());
+  sort_indices<5,3,4,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x5.size(), x4.size(), x3.size(), x1.size(), x0.size(), x2.size());
   out()->put_block(odata, x2, x1, x0, x5, x4, x3);
 }
 
@@ -330,7 +330,7 @@ void Task812::Task_local::compute() {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1, c1, x2);
     dscal_(x2.size()*c1.size()*x1.size()*x0.size(), e0_, i0data.get(), 1);
-    sort_indices<1,0,2,3,1,1,-2,1>(i0data, odata, x0.size(), x1.size(), c1.size(), x2.size());
+    sort_indices<1,0,2,3,1,1,-2,1>(i0data.get(), odata.get(), x0.size(), x1.size(), c1.size(), x2.size());
   }
   out()->put_block(odata, x1, x0, c1, x2);
 }
@@ -342,22 +342,22 @@ void Task813::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I932
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, c1, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, c1, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, c1, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, c1, x2), 0.0);
   for (auto& a2 : *range_[2]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x2, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, a2)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x2.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(x2, a2);
+    BlockBuffer i0data_sorted(in(0)->get_size(x2, a2));
+    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted.get(), x2.size(), a2.size());
     // tensor label: I933
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, a2, c1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, a2, c1)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), a2.size(), c1.size());
+    const double* i1data = in(1)->get_block_view(x1, x0, a2, c1);
+    BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, a2, c1));
+    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), a2.size(), c1.size());
     dgemm_("T", "N", x2.size(), x1.size()*x0.size()*c1.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, x2.size());
+           1.0, i0data_sorted.get(), a2.size(), i1data_sorted.get(), a2.size(),
+           1.0, odata_sorted.get(), x2.size());
   }
-  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size(), x0.size(), c1.size());
+  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted.get(), odata.get(), x2.size(), x1.size(), x0.size(), c1.size());
   out()->put_block(odata, x1, x0, c1, x2);
 }
 
@@ -370,8 +370,8 @@ void Task814::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x0, x1);
-    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata, c1.size(), a2.size(), x0.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, x0, x1);
+    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata.get(), c1.size(), a2.size(), x0.size(), x1.size());
   }
   out()->put_block(odata, x1, x0, a2, c1);
 }
@@ -385,22 +385,22 @@ void Task815::Task_local::compute() {
   const Index x3 = b(5);
   // tensor label: I791
   std::unique_ptr<double[]> odata = out()->move_block(x2, x1, x0, x5, x4, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1, x0, x5, x4, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(x2, x1, x0, x5, x4, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1, x0, x5, x4, x3), 0.0);
   for (auto& c1 : *range_[0]) {
     // tensor label: v2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, c1, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, c1, x3)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), c1.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(x5, x4, c1, x3);
+    BlockBuffer i0data_sorted(in(0)->get_size(x5, x4, c1, x3));
+    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), x4.size(), c1.size(), x3.size());
     // tensor label: I1174
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c1, x1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c1, x1, x0)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, x2.size(), c1.size(), x1.size(), x0.size());
+    const double* i1data = in(1)->get_block_view(x2, c1, x1, x0);
+    BlockBuffer i1data_sorted(in(1)->get_size(x2, c1, x1, x0));
+    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), c1.size(), x1.size(), x0.size());
     dgemm_("T", "N", x5.size()*x4.size()*x3.size(), x2.size()*x1.size()*x0.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, x5.size()*x4.size()*x3.size());
+           1.0, i0data_sorted.get(), c1.size(), i1data_sorted.get(), c1.size(),
+           1.0, odata_sorted.get(), x5.size()*x4.size()*x3.size());
   }
-  sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x2, x1, x0, x5, x4, x3);
 }
 
@@ -413,8 +413,8 @@ void Task816::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x2, c1, x1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1, c1, x2);
-    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata, x0.size(), x1.size(), c1.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x0, x1, c1, x2);
+    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata.get(), x0.size(), x1.size(), c1.size(), x2.size());
   }
   out()->put_block(odata, x2, c1, x1, x0);
 }
@@ -428,22 +428,22 @@ void Task817::Task_local::compute() {
   const Index x3 = b(5);
   // tensor label: I791
   std::unique_ptr<double[]> odata = out()->move_block(x2, x1, x0, x5, x4, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1, x0, x5, x4, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(x2, x1, x0, x5, x4, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1, x0, x5, x4, x3), 0.0);
   for (auto& c1 : *range_[0]) {
     // tensor label: v2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1, c1, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1, c1, x2)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size(), c1.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x0, x1, c1, x2);
+    BlockBuffer i0data_sorted(in(0)->get_size(x0, x1, c1, x2));
+    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), x1.size(), c1.size(), x2.size());
     // tensor label: I1228
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x3, c1, x4, x5);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, c1, x4, x5)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), c1.size(), x4.size(), x5.size());
+    const double* i1data = in(1)->get_block_view(x3, c1, x4, x5);
+    BlockBuffer i1data_sorted(in(1)->get_size(x3, c1, x4, x5));
+    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), c1.size(), x4.size(), x5.size());
     dgemm_("T", "N", x0.size()*x1.size()*x2.size(), x3.size()*x4.size()*x5.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, x0.size()*x1.size()*x2.size());
+           1.0, i0data_sorted.get(), c1.size(), i1data_sorted.get(), c1.size(),
+           1.0, odata_sorted.get(), x0.size()*x1.size()*x2.size());
   }
-  sort_indices<2,1,0,5,4,3,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x3.size(), x4.size(), x5.size());
+  sort_indices<2,1,0,5,4,3,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), x2.size(), x3.size(), x4.size(), x5.size());
   out()->put_block(odata, x2, x1, x0, x5, x4, x3);
 }
 
@@ -456,8 +456,8 @@ void Task818::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x3, c1, x4, x5);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, c1, x3);
-    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata, x5.size(), x4.size(), c1.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(x5, x4, c1, x3);
+    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata.get(), x5.size(), x4.size(), c1.size(), x3.size());
   }
   out()->put_block(odata, x3, c1, x4, x5);
 }
@@ -466,28 +466,28 @@ void Task819::Task_local::compute() {
   const Index ci0 = b(0);
   // tensor label: I768
   std::unique_ptr<double[]> odata = out()->move_block(ci0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(ci0)]);
+  BlockBuffer odata_sorted(out()->get_size(ci0));
   std::fill_n(odata_sorted.get(), out()->get_size(ci0), 0.0);
   for (auto& x2 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         for (auto& x0 : *range_[1]) {
           // tensor label: Gamma277
-          std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x2, x3, x1, x0);
-          std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(ci0, x2, x3, x1, x0)]);
-          sort_indices<1,2,3,4,0,0,1,1,1>(i0data, i0data_sorted, ci0.size(), x2.size(), x3.size(), x1.size(), x0.size());
+          const double* i0data = in(0)->get_block_view(ci0, x2, x3, x1, x0);
+          BlockBuffer i0data_sorted(in(0)->get_size(ci0, x2, x3, x1, x0));
+          sort_indices<1,2,3,4,0,0,1,1,1>(i0data, i0data_sorted.get(), ci0.size(), x2.size(), x3.size(), x1.size(), x0.size());
           // tensor label: I795
-          std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, x1, x0);
-          std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, x1, x0)]);
-          sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+          const double* i1data = in(1)->get_block_view(x3, x2, x1, x0);
+          BlockBuffer i1data_sorted(in(1)->get_size(x3, x2, x1, x0));
+          sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), x2.size(), x1.size(), x0.size());
           dgemm_("T", "N", ci0.size(), 1, x3.size()*x2.size()*x1.size()*x0.size(),
-                 1.0, i0data_sorted, x3.size()*x2.size()*x1.size()*x0.size(), i1data_sorted, x3.size()*x2.size()*x1.size()*x0.size(),
-                 1.0, odata_sorted, ci0.size());
+                 1.0, i0data_sorted.get(), x3.size()*x2.size()*x1.size()*x0.size(), i1data_sorted.get(), x3.size()*x2.size()*x1.size()*x0.size(),
+                 1.0, odata_sorted.get(), ci0.size());
         }
       }
     }
   }
-  sort_indices<0,1,1,1,1>(odata_sorted, odata, ci0.size());
+  sort_indices<0,1,1,1,1>(odata_sorted.get(), odata.get(), ci0.size());
   out()->put_block(odata, ci0);
 }
 
@@ -498,22 +498,22 @@ void Task820::Task_local::compute() {
   const Index x0 = b(3);
   // tensor label: I795
   std::unique_ptr<double[]> odata = out()->move_block(x3, x2, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, x2, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, x1, x0), 0.0);
   for (auto& c1 : *range_[0]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1, c1, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1, c1, x2)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size(), c1.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x0, x1, c1, x2);
+    BlockBuffer i0data_sorted(in(0)->get_size(x0, x1, c1, x2));
+    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), x1.size(), c1.size(), x2.size());
     // tensor label: I796
-    std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x3)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, c1.size(), x3.size());
+    const double* i1data = in(1)->get_block_view(c1, x3);
+    BlockBuffer i1data_sorted(in(1)->get_size(c1, x3));
+    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), c1.size(), x3.size());
     dgemm_("T", "N", x2.size()*x1.size()*x0.size(), x3.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+           1.0, i0data_sorted.get(), c1.size(), i1data_sorted.get(), c1.size(),
+           1.0, odata_sorted.get(), x2.size()*x1.size()*x0.size());
   }
-  sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x3.size());
+  sort_indices<3,2,1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), x2.size(), x3.size());
   out()->put_block(odata, x3, x2, x1, x0);
 }
 
@@ -522,24 +522,24 @@ void Task821::Task_local::compute() {
   const Index x3 = b(1);
   // tensor label: I796
   std::unique_ptr<double[]> odata = out()->move_block(c1, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x3), 0.0);
   for (auto& c2 : *range_[0]) {
     for (auto& a3 : *range_[2]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a3, c1, x3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a3, c1, x3)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a3.size(), c1.size(), x3.size());
+      const double* i0data = in(0)->get_block_view(c2, a3, c1, x3);
+      BlockBuffer i0data_sorted(in(0)->get_size(c2, a3, c1, x3));
+      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c2.size(), a3.size(), c1.size(), x3.size());
       // tensor label: I797
-      std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2)]);
-      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size());
+      const double* i1data = in(1)->get_block_view(a3, c2);
+      BlockBuffer i1data_sorted(in(1)->get_size(a3, c2));
+      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), c2.size());
       dgemm_("T", "N", c1.size()*x3.size(), 1, a3.size()*c2.size(),
-             1.0, i0data_sorted, a3.size()*c2.size(), i1data_sorted, a3.size()*c2.size(),
-             1.0, odata_sorted, c1.size()*x3.size());
+             1.0, i0data_sorted.get(), a3.size()*c2.size(), i1data_sorted.get(), a3.size()*c2.size(),
+             1.0, odata_sorted.get(), c1.size()*x3.size());
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, c1.size(), x3.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), c1.size(), x3.size());
   out()->put_block(odata, c1, x3);
 }
 
@@ -550,8 +550,8 @@ void Task822::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a3, c2);
-    sort_indices<0,1,1,1,4,1>(i0data, odata, a3.size(), c2.size());
+    const double* i0data = in(0)->get_block_view(a3, c2);
+    sort_indices<0,1,1,1,4,1>(i0data, odata.get(), a3.size(), c2.size());
   }
   out()->put_block(odata, a3, c2);
 }
@@ -561,24 +561,24 @@ void Task823::Task_local::compute() {
   const Index x3 = b(1);
   // tensor label: I796
   std::unique_ptr<double[]> odata = out()->move_block(c1, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x3), 0.0);
   for (auto& a3 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a3, c2, x3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a3, c2, x3)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a3.size(), c2.size(), x3.size());
+      const double* i0data = in(0)->get_block_view(c1, a3, c2, x3);
+      BlockBuffer i0data_sorted(in(0)->get_size(c1, a3, c2, x3));
+      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a3.size(), c2.size(), x3.size());
       // tensor label: I801
-      std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2)]);
-      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size());
+      const double* i1data = in(1)->get_block_view(a3, c2);
+      BlockBuffer i1data_sorted(in(1)->get_size(a3, c2));
+      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), c2.size());
       dgemm_("T", "N", c1.size()*x3.size(), 1, a3.size()*c2.size(),
-             1.0, i0data_sorted, a3.size()*c2.size(), i1data_sorted, a3.size()*c2.size(),
-             1.0, odata_sorted, c1.size()*x3.size());
+             1.0, i0data_sorted.get(), a3.size()*c2.size(), i1data_sorted.get(), a3.size()*c2.size(),
+             1.0, odata_sorted.get(), c1.size()*x3.size());
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, c1.size(), x3.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), c1.size(), x3.size());
   out()->put_block(odata, c1, x3);
 }
 
@@ -589,8 +589,8 @@ void Task824::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a3, c2);
-    sort_indices<0,1,1,1,-2,1>(i0data, odata, a3.size(), c2.size());
+    const double* i0data = in(0)->get_block_view(a3, c2);
+    sort_indices<0,1,1,1,-2,1>(i0data, odata.get(), a3.size(), c2.size());
   }
   out()->put_block(odata, a3, c2);
 }
@@ -602,24 +602,24 @@ void Task825::Task_local::compute() {
   const Index x0 = b(3);
   // tensor label: I795
   std::unique_ptr<double[]> odata = out()->move_block(x3, x2, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, x2, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, x1, x0), 0.0);
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, x1)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
+      const double* i0data = in(0)->get_block_view(x0, a1, c2, x1);
+      BlockBuffer i0data_sorted(in(0)->get_size(x0, a1, c2, x1));
+      sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), a1.size(), c2.size(), x1.size());
       // tensor label: I886
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c2, a1, x3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c2, a1, x3)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, x2.size(), c2.size(), a1.size(), x3.size());
+      const double* i1data = in(1)->get_block_view(x2, c2, a1, x3);
+      BlockBuffer i1data_sorted(in(1)->get_size(x2, c2, a1, x3));
+      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), c2.size(), a1.size(), x3.size());
       dgemm_("T", "N", x1.size()*x0.size(), x2.size()*x3.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+             1.0, i0data_sorted.get(), c2.size()*a1.size(), i1data_sorted.get(), c2.size()*a1.size(),
+             1.0, odata_sorted.get(), x1.size()*x0.size());
     }
   }
-  sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x3.size());
+  sort_indices<3,2,1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), x2.size(), x3.size());
   out()->put_block(odata, x3, x2, x1, x0);
 }
 
@@ -630,22 +630,22 @@ void Task826::Task_local::compute() {
   const Index x3 = b(3);
   // tensor label: I886
   std::unique_ptr<double[]> odata = out()->move_block(x2, c2, a1, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, c2, a1, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(x2, c2, a1, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(x2, c2, a1, x3), 0.0);
   for (auto& c3 : *range_[0]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, c3, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1, c3, x3)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size(), c3.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(c2, a1, c3, x3);
+    BlockBuffer i0data_sorted(in(0)->get_size(c2, a1, c3, x3));
+    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted.get(), c2.size(), a1.size(), c3.size(), x3.size());
     // tensor label: I887
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c3)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, x2.size(), c3.size());
+    const double* i1data = in(1)->get_block_view(x2, c3);
+    BlockBuffer i1data_sorted(in(1)->get_size(x2, c3));
+    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), c3.size());
     dgemm_("T", "N", c2.size()*a1.size()*x3.size(), x2.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, c2.size()*a1.size()*x3.size());
+           1.0, i0data_sorted.get(), c3.size(), i1data_sorted.get(), c3.size(),
+           1.0, odata_sorted.get(), c2.size()*a1.size()*x3.size());
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), x3.size(), x2.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), c2.size(), a1.size(), x3.size(), x2.size());
   out()->put_block(odata, x2, c2, a1, x3);
 }
 
@@ -656,8 +656,8 @@ void Task827::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x2, c3);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x2, c3);
-    sort_indices<0,1,1,1,-2,1>(i0data, odata, x2.size(), c3.size());
+    const double* i0data = in(0)->get_block_view(x2, c3);
+    sort_indices<0,1,1,1,-2,1>(i0data, odata.get(), x2.size(), c3.size());
   }
   out()->put_block(odata, x2, c3);
 }
@@ -669,24 +669,24 @@ void Task828::Task_local::compute() {
   const Index x0 = b(3);
   // tensor label: I795
   std::unique_ptr<double[]> odata = out()->move_block(x3, x2, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, x2, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, x1, x0), 0.0);
   for (auto& a2 : *range_[2]) {
     for (auto& c1 : *range_[0]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x0, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, x0, x1)]);
-      sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), x0.size(), x1.size());
+      const double* i0data = in(0)->get_block_view(c1, a2, x0, x1);
+      BlockBuffer i0data_sorted(in(0)->get_size(c1, a2, x0, x1));
+      sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size(), x0.size(), x1.size());
       // tensor label: I936
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x2, a2, c1, x3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, a2, c1, x3)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, x2.size(), a2.size(), c1.size(), x3.size());
+      const double* i1data = in(1)->get_block_view(x2, a2, c1, x3);
+      BlockBuffer i1data_sorted(in(1)->get_size(x2, a2, c1, x3));
+      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), a2.size(), c1.size(), x3.size());
       dgemm_("T", "N", x1.size()*x0.size(), x2.size()*x3.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+             1.0, i0data_sorted.get(), a2.size()*c1.size(), i1data_sorted.get(), a2.size()*c1.size(),
+             1.0, odata_sorted.get(), x1.size()*x0.size());
     }
   }
-  sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x3.size());
+  sort_indices<3,2,1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), x2.size(), x3.size());
   out()->put_block(odata, x3, x2, x1, x0);
 }
 
@@ -697,22 +697,22 @@ void Task829::Task_local::compute() {
   const Index x3 = b(3);
   // tensor label: I936
   std::unique_ptr<double[]> odata = out()->move_block(x2, a2, c1, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, a2, c1, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(x2, a2, c1, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(x2, a2, c1, x3), 0.0);
   for (auto& c3 : *range_[0]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2, c1, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a2, c1, x3)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c3.size(), a2.size(), c1.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(c3, a2, c1, x3);
+    BlockBuffer i0data_sorted(in(0)->get_size(c3, a2, c1, x3));
+    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c3.size(), a2.size(), c1.size(), x3.size());
     // tensor label: I937
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c3)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, x2.size(), c3.size());
+    const double* i1data = in(1)->get_block_view(x2, c3);
+    BlockBuffer i1data_sorted(in(1)->get_size(x2, c3));
+    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), c3.size());
     dgemm_("T", "N", a2.size()*c1.size()*x3.size(), x2.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, a2.size()*c1.size()*x3.size());
+           1.0, i0data_sorted.get(), c3.size(), i1data_sorted.get(), c3.size(),
+           1.0, odata_sorted.get(), a2.size()*c1.size()*x3.size());
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, a2.size(), c1.size(), x3.size(), x2.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), a2.size(), c1.size(), x3.size(), x2.size());
   out()->put_block(odata, x2, a2, c1, x3);
 }
 
@@ -723,8 +723,8 @@ void Task830::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x2, c3);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x2, c3);
-    sort_indices<0,1,1,1,-2,1>(i0data, odata, x2.size(), c3.size());
+    const double* i0data = in(0)->get_block_view(x2, c3);
+    sort_indices<0,1,1,1,-2,1>(i0data, odata.get(), x2.size(), c3.size());
   }
   out()->put_block(odata, x2, c3);
 }
@@ -736,22 +736,22 @@ void Task831::Task_local::compute() {
   const Index x3 = b(3);
   // tensor label: I936
   std::unique_ptr<double[]> odata = out()->move_block(x2, a2, c1, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, a2, c1, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(x2, a2, c1, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(x2, a2, c1, x3), 0.0);
   for (auto& c3 : *range_[0]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, x3)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, x3);
+    BlockBuffer i0data_sorted(in(0)->get_size(c1, a2, c3, x3));
+    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size(), c3.size(), x3.size());
     // tensor label: I941
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c3)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, x2.size(), c3.size());
+    const double* i1data = in(1)->get_block_view(x2, c3);
+    BlockBuffer i1data_sorted(in(1)->get_size(x2, c3));
+    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), c3.size());
     dgemm_("T", "N", c1.size()*a2.size()*x3.size(), x2.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, c1.size()*a2.size()*x3.size());
+           1.0, i0data_sorted.get(), c3.size(), i1data_sorted.get(), c3.size(),
+           1.0, odata_sorted.get(), c1.size()*a2.size()*x3.size());
   }
-  sort_indices<3,1,0,2,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), x3.size(), x2.size());
+  sort_indices<3,1,0,2,1,1,1,1>(odata_sorted.get(), odata.get(), c1.size(), a2.size(), x3.size(), x2.size());
   out()->put_block(odata, x2, a2, c1, x3);
 }
 
@@ -762,8 +762,8 @@ void Task832::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x2, c3);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x2, c3);
-    sort_indices<0,1,1,1,4,1>(i0data, odata, x2.size(), c3.size());
+    const double* i0data = in(0)->get_block_view(x2, c3);
+    sort_indices<0,1,1,1,4,1>(i0data, odata.get(), x2.size(), c3.size());
   }
   out()->put_block(odata, x2, c3);
 }
@@ -775,24 +775,24 @@ void Task833::Task_local::compute() {
   const Index x0 = b(3);
   // tensor label: I795
   std::unique_ptr<double[]> odata = out()->move_block(x3, x2, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, x2, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, x1, x0), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: v2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x3, x2, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x3, x2, a2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), x3.size(), x2.size(), a2.size());
+      const double* i0data = in(0)->get_block_view(c1, x3, x2, a2);
+      BlockBuffer i0data_sorted(in(0)->get_size(c1, x3, x2, a2));
+      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), x3.size(), x2.size(), a2.size());
       // tensor label: I1198
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, a2, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, a2, c1)]);
-      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), a2.size(), c1.size());
+      const double* i1data = in(1)->get_block_view(x1, x0, a2, c1);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, a2, c1));
+      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), a2.size(), c1.size());
       dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), a2.size()*c1.size(), i1data_sorted.get(), a2.size()*c1.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<0,1,2,3,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<0,1,2,3,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x3, x2, x1, x0);
 }
 
@@ -805,8 +805,8 @@ void Task834::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x0, x1);
-    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata, c1.size(), a2.size(), x0.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, x0, x1);
+    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata.get(), c1.size(), a2.size(), x0.size(), x1.size());
   }
   out()->put_block(odata, x1, x0, a2, c1);
 }
@@ -818,22 +818,22 @@ void Task835::Task_local::compute() {
   const Index x0 = b(3);
   // tensor label: I795
   std::unique_ptr<double[]> odata = out()->move_block(x3, x2, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, x2, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, x1, x0), 0.0);
   for (auto& c1 : *range_[0]) {
     // tensor label: h1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x3)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(c1, x3);
+    BlockBuffer i0data_sorted(in(0)->get_size(c1, x3));
+    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), x3.size());
     // tensor label: I1276
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c1, x1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c1, x1, x0)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, x2.size(), c1.size(), x1.size(), x0.size());
+    const double* i1data = in(1)->get_block_view(x2, c1, x1, x0);
+    BlockBuffer i1data_sorted(in(1)->get_size(x2, c1, x1, x0));
+    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), c1.size(), x1.size(), x0.size());
     dgemm_("T", "N", x3.size(), x2.size()*x1.size()*x0.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, x3.size());
+           1.0, i0data_sorted.get(), c1.size(), i1data_sorted.get(), c1.size(),
+           1.0, odata_sorted.get(), x3.size());
   }
-  sort_indices<0,1,2,3,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<0,1,2,3,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x3, x2, x1, x0);
 }
 
@@ -846,8 +846,8 @@ void Task836::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x2, c1, x1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1, c1, x2);
-    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata, x0.size(), x1.size(), c1.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x0, x1, c1, x2);
+    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata.get(), x0.size(), x1.size(), c1.size(), x2.size());
   }
   out()->put_block(odata, x2, c1, x1, x0);
 }
@@ -856,7 +856,7 @@ void Task837::Task_local::compute() {
   const Index ci0 = b(0);
   // tensor label: I768
   std::unique_ptr<double[]> odata = out()->move_block(ci0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(ci0)]);
+  BlockBuffer odata_sorted(out()->get_size(ci0));
   std::fill_n(odata_sorted.get(), out()->get_size(ci0), 0.0);
   for (auto& x5 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
@@ -865,23 +865,23 @@ void Task837::Task_local::compute() {
           for (auto& x1 : *range_[1]) {
             for (auto& x0 : *range_[1]) {
               // tensor label: Gamma279
-              std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x5, x3, x2, x4, x1, x0);
-              std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(ci0, x5, x3, x2, x4, x1, x0)]);
-              sort_indices<1,2,3,4,5,6,0,0,1,1,1>(i0data, i0data_sorted, ci0.size(), x5.size(), x3.size(), x2.size(), x4.size(), x1.size(), x0.size());
+              const double* i0data = in(0)->get_block_view(ci0, x5, x3, x2, x4, x1, x0);
+              BlockBuffer i0data_sorted(in(0)->get_size(ci0, x5, x3, x2, x4, x1, x0));
+              sort_indices<1,2,3,4,5,6,0,0,1,1,1>(i0data, i0data_sorted.get(), ci0.size(), x5.size(), x3.size(), x2.size(), x4.size(), x1.size(), x0.size());
               // tensor label: I803
-              std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x5, x4, x2, x1, x0);
-              std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x5, x4, x2, x1, x0)]);
-              sort_indices<1,0,3,2,4,5,0,1,1,1>(i1data, i1data_sorted, x3.size(), x5.size(), x4.size(), x2.size(), x1.size(), x0.size());
+              const double* i1data = in(1)->get_block_view(x3, x5, x4, x2, x1, x0);
+              BlockBuffer i1data_sorted(in(1)->get_size(x3, x5, x4, x2, x1, x0));
+              sort_indices<1,0,3,2,4,5,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), x5.size(), x4.size(), x2.size(), x1.size(), x0.size());
               dgemm_("T", "N", ci0.size(), 1, x3.size()*x5.size()*x4.size()*x2.size()*x1.size()*x0.size(),
-                     1.0, i0data_sorted, x3.size()*x5.size()*x4.size()*x2.size()*x1.size()*x0.size(), i1data_sorted, x3.size()*x5.size()*x4.size()*x2.size()*x1.size()*x0.size(),
-                     1.0, odata_sorted, ci0.size());
+                     1.0, i0data_sorted.get(), x3.size()*x5.size()*x4.size()*x2.size()*x1.size()*x0.size(), i1data_sorted.get(), x3.size()*x5.size()*x4.size()*x2.size()*x1.size()*x0.size(),
+                     1.0, odata_sorted.get(), ci0.size());
             }
           }
         }
       }
     }
   }
-  sort_indices<0,1,1,1,1>(odata_sorted, odata, ci0.size());
+  sort_indices<0,1,1,1,1>(odata_sorted.get(), odata.get(), ci0.size());
   out()->put_block(odata, ci0);
 }
 
@@ -894,22 +894,22 @@ void Task838::Task_local::compute() {
   const Index x0 = b(5);
   // tensor label: I803
   std::unique_ptr<double[]> odata = out()->move_block(x3, x5, x4, x2, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x5, x4, x2, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, x5, x4, x2, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x5, x4, x2, x1, x0), 0.0);
   for (auto& c1 : *range_[0]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1, c1, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1, c1, x2)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size(), c1.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x0, x1, c1, x2);
+    BlockBuffer i0data_sorted(in(0)->get_size(x0, x1, c1, x2));
+    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), x1.size(), c1.size(), x2.size());
     // tensor label: I804
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x5, c1, x4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x5, c1, x4)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), x5.size(), c1.size(), x4.size());
+    const double* i1data = in(1)->get_block_view(x3, x5, c1, x4);
+    BlockBuffer i1data_sorted(in(1)->get_size(x3, x5, c1, x4));
+    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), x5.size(), c1.size(), x4.size());
     dgemm_("T", "N", x2.size()*x1.size()*x0.size(), x3.size()*x5.size()*x4.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+           1.0, i0data_sorted.get(), c1.size(), i1data_sorted.get(), c1.size(),
+           1.0, odata_sorted.get(), x2.size()*x1.size()*x0.size());
   }
-  sort_indices<3,4,5,2,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x3.size(), x5.size(), x4.size());
+  sort_indices<3,4,5,2,1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), x2.size(), x3.size(), x5.size(), x4.size());
   out()->put_block(odata, x3, x5, x4, x2, x1, x0);
 }
 
@@ -920,22 +920,22 @@ void Task839::Task_local::compute() {
   const Index x4 = b(3);
   // tensor label: I804
   std::unique_ptr<double[]> odata = out()->move_block(x3, x5, c1, x4);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x5, c1, x4)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, x5, c1, x4));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x5, c1, x4), 0.0);
   for (auto& a2 : *range_[2]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a2, c1, x4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a2, c1, x4)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), a2.size(), c1.size(), x4.size());
+    const double* i0data = in(0)->get_block_view(x5, a2, c1, x4);
+    BlockBuffer i0data_sorted(in(0)->get_size(x5, a2, c1, x4));
+    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), a2.size(), c1.size(), x4.size());
     // tensor label: I805
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a2, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, x3)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a2.size(), x3.size());
+    const double* i1data = in(1)->get_block_view(a2, x3);
+    BlockBuffer i1data_sorted(in(1)->get_size(a2, x3));
+    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a2.size(), x3.size());
     dgemm_("T", "N", x5.size()*c1.size()*x4.size(), x3.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, x5.size()*c1.size()*x4.size());
+           1.0, i0data_sorted.get(), a2.size(), i1data_sorted.get(), a2.size(),
+           1.0, odata_sorted.get(), x5.size()*c1.size()*x4.size());
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), c1.size(), x4.size(), x3.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x5.size(), c1.size(), x4.size(), x3.size());
   out()->put_block(odata, x3, x5, c1, x4);
 }
 
@@ -946,8 +946,8 @@ void Task840::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a2, x3);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a2, x3);
-    sort_indices<0,1,1,1,-2,1>(i0data, odata, a2.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(a2, x3);
+    sort_indices<0,1,1,1,-2,1>(i0data, odata.get(), a2.size(), x3.size());
   }
   out()->put_block(odata, a2, x3);
 }
@@ -956,28 +956,28 @@ void Task841::Task_local::compute() {
   const Index ci0 = b(0);
   // tensor label: I768
   std::unique_ptr<double[]> odata = out()->move_block(ci0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(ci0)]);
+  BlockBuffer odata_sorted(out()->get_size(ci0));
   std::fill_n(odata_sorted.get(), out()->get_size(ci0), 0.0);
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x0 : *range_[1]) {
         for (auto& x1 : *range_[1]) {
           // tensor label: Gamma282
-          std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x3, x2, x0, x1);
-          std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(ci0, x3, x2, x0, x1)]);
-          sort_indices<1,2,3,4,0,0,1,1,1>(i0data, i0data_sorted, ci0.size(), x3.size(), x2.size(), x0.size(), x1.size());
+          const double* i0data = in(0)->get_block_view(ci0, x3, x2, x0, x1);
+          BlockBuffer i0data_sorted(in(0)->get_size(ci0, x3, x2, x0, x1));
+          sort_indices<1,2,3,4,0,0,1,1,1>(i0data, i0data_sorted.get(), ci0.size(), x3.size(), x2.size(), x0.size(), x1.size());
           // tensor label: I815
-          std::unique_ptr<double[]> i1data = in(1)->get_block(x0, x3, x2, x1);
-          std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, x3, x2, x1)]);
-          sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, x0.size(), x3.size(), x2.size(), x1.size());
+          const double* i1data = in(1)->get_block_view(x0, x3, x2, x1);
+          BlockBuffer i1data_sorted(in(1)->get_size(x0, x3, x2, x1));
+          sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), x3.size(), x2.size(), x1.size());
           dgemm_("T", "N", ci0.size(), 1, x0.size()*x3.size()*x2.size()*x1.size(),
-                 1.0, i0data_sorted, x0.size()*x3.size()*x2.size()*x1.size(), i1data_sorted, x0.size()*x3.size()*x2.size()*x1.size(),
-                 1.0, odata_sorted, ci0.size());
+                 1.0, i0data_sorted.get(), x0.size()*x3.size()*x2.size()*x1.size(), i1data_sorted.get(), x0.size()*x3.size()*x2.size()*x1.size(),
+                 1.0, odata_sorted.get(), ci0.size());
         }
       }
     }
   }
-  sort_indices<0,1,1,1,1>(odata_sorted, odata, ci0.size());
+  sort_indices<0,1,1,1,1>(odata_sorted.get(), odata.get(), ci0.size());
   out()->put_block(odata, ci0);
 }
 
@@ -988,22 +988,22 @@ void Task842::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I815
   std::unique_ptr<double[]> odata = out()->move_block(x0, x3, x2, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x3, x2, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, x3, x2, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x3, x2, x1), 0.0);
   for (auto& c3 : *range_[0]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, c3, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, c3, x1)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), c3.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x3, x2, c3, x1);
+    BlockBuffer i0data_sorted(in(0)->get_size(x3, x2, c3, x1));
+    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x2.size(), c3.size(), x1.size());
     // tensor label: I816
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c3)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, x0.size(), c3.size());
+    const double* i1data = in(1)->get_block_view(x0, c3);
+    BlockBuffer i1data_sorted(in(1)->get_size(x0, c3));
+    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), c3.size());
     dgemm_("T", "N", x3.size()*x2.size()*x1.size(), x0.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, x3.size()*x2.size()*x1.size());
+           1.0, i0data_sorted.get(), c3.size(), i1data_sorted.get(), c3.size(),
+           1.0, odata_sorted.get(), x3.size()*x2.size()*x1.size());
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x0, x3, x2, x1);
 }
 
@@ -1012,24 +1012,24 @@ void Task843::Task_local::compute() {
   const Index c3 = b(1);
   // tensor label: I816
   std::unique_ptr<double[]> odata = out()->move_block(x0, c3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, c3)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, c3));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, c3), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: f1
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size());
+      const double* i0data = in(0)->get_block_view(c1, a2);
+      BlockBuffer i0data_sorted(in(0)->get_size(c1, a2));
+      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size());
       // tensor label: I817
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c3, a2, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c3, a2, c1)]);
-      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted, x0.size(), c3.size(), a2.size(), c1.size());
+      const double* i1data = in(1)->get_block_view(x0, c3, a2, c1);
+      BlockBuffer i1data_sorted(in(1)->get_size(x0, c3, a2, c1));
+      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), c3.size(), a2.size(), c1.size());
       dgemm_("T", "N", 1, x0.size()*c3.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, 1);
+             1.0, i0data_sorted.get(), a2.size()*c1.size(), i1data_sorted.get(), a2.size()*c1.size(),
+             1.0, odata_sorted.get(), 1);
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x0.size(), c3.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), c3.size());
   out()->put_block(odata, x0, c3);
 }
 
@@ -1042,8 +1042,8 @@ void Task844::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x0, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata, c1.size(), a2.size(), c3.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, x0);
+    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), x0.size());
   }
   out()->put_block(odata, x0, c3, a2, c1);
 }
@@ -1055,22 +1055,22 @@ void Task845::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I815
   std::unique_ptr<double[]> odata = out()->move_block(x0, x3, x2, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x3, x2, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, x3, x2, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x3, x2, x1), 0.0);
   for (auto& c1 : *range_[0]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, c1, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, c1, x1)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), c1.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x3, x2, c1, x1);
+    BlockBuffer i0data_sorted(in(0)->get_size(x3, x2, c1, x1));
+    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x2.size(), c1.size(), x1.size());
     // tensor label: I820
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c1)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, x0.size(), c1.size());
+    const double* i1data = in(1)->get_block_view(x0, c1);
+    BlockBuffer i1data_sorted(in(1)->get_size(x0, c1));
+    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), c1.size());
     dgemm_("T", "N", x3.size()*x2.size()*x1.size(), x0.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, x3.size()*x2.size()*x1.size());
+           1.0, i0data_sorted.get(), c1.size(), i1data_sorted.get(), c1.size(),
+           1.0, odata_sorted.get(), x3.size()*x2.size()*x1.size());
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x0, x3, x2, x1);
 }
 
@@ -1079,24 +1079,24 @@ void Task846::Task_local::compute() {
   const Index c1 = b(1);
   // tensor label: I820
   std::unique_ptr<double[]> odata = out()->move_block(x0, c1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, c1)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, c1));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, c1), 0.0);
   for (auto& c3 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: f1
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a2)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c3.size(), a2.size());
+      const double* i0data = in(0)->get_block_view(c3, a2);
+      BlockBuffer i0data_sorted(in(0)->get_size(c3, a2));
+      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), c3.size(), a2.size());
       // tensor label: I821
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c3, a2, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c3, a2, c1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, x0.size(), c3.size(), a2.size(), c1.size());
+      const double* i1data = in(1)->get_block_view(x0, c3, a2, c1);
+      BlockBuffer i1data_sorted(in(1)->get_size(x0, c3, a2, c1));
+      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), c3.size(), a2.size(), c1.size());
       dgemm_("T", "N", 1, x0.size()*c1.size(), c3.size()*a2.size(),
-             1.0, i0data_sorted, c3.size()*a2.size(), i1data_sorted, c3.size()*a2.size(),
-             1.0, odata_sorted, 1);
+             1.0, i0data_sorted.get(), c3.size()*a2.size(), i1data_sorted.get(), c3.size()*a2.size(),
+             1.0, odata_sorted.get(), 1);
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x0.size(), c1.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), c1.size());
   out()->put_block(odata, x0, c1);
 }
 
@@ -1109,8 +1109,8 @@ void Task847::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x0, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata, c1.size(), a2.size(), c3.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, x0);
+    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), x0.size());
   }
   out()->put_block(odata, x0, c3, a2, c1);
 }
@@ -1122,24 +1122,24 @@ void Task848::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I815
   std::unique_ptr<double[]> odata = out()->move_block(x0, x3, x2, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x3, x2, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, x3, x2, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x3, x2, x1), 0.0);
   for (auto& a2 : *range_[2]) {
     for (auto& c1 : *range_[0]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a2, c1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a2, c1, x2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a2.size(), c1.size(), x2.size());
+      const double* i0data = in(0)->get_block_view(x3, a2, c1, x2);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, a2, c1, x2));
+      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a2.size(), c1.size(), x2.size());
       // tensor label: I858
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a2, c1, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a2, c1, x1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, x0.size(), a2.size(), c1.size(), x1.size());
+      const double* i1data = in(1)->get_block_view(x0, a2, c1, x1);
+      BlockBuffer i1data_sorted(in(1)->get_size(x0, a2, c1, x1));
+      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), a2.size(), c1.size(), x1.size());
       dgemm_("T", "N", x3.size()*x2.size(), x0.size()*x1.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), a2.size()*c1.size(), i1data_sorted.get(), a2.size()*c1.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x0.size(), x1.size());
+  sort_indices<2,0,1,3,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x0.size(), x1.size());
   out()->put_block(odata, x0, x3, x2, x1);
 }
 
@@ -1150,22 +1150,22 @@ void Task849::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I858
   std::unique_ptr<double[]> odata = out()->move_block(x0, a2, c1, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, a2, c1, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, a2, c1, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, a2, c1, x1), 0.0);
   for (auto& c3 : *range_[0]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c3, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, x1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c3.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c3, x1);
+    BlockBuffer i0data_sorted(in(0)->get_size(c3, x1));
+    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), c3.size(), x1.size());
     // tensor label: I859
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c3, a2, c1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c3, a2, c1)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, x0.size(), c3.size(), a2.size(), c1.size());
+    const double* i1data = in(1)->get_block_view(x0, c3, a2, c1);
+    BlockBuffer i1data_sorted(in(1)->get_size(x0, c3, a2, c1));
+    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), c3.size(), a2.size(), c1.size());
     dgemm_("T", "N", x1.size(), x0.size()*a2.size()*c1.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, x1.size());
+           1.0, i0data_sorted.get(), c3.size(), i1data_sorted.get(), c3.size(),
+           1.0, odata_sorted.get(), x1.size());
   }
-  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a2.size(), c1.size());
+  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size(), a2.size(), c1.size());
   out()->put_block(odata, x0, a2, c1, x1);
 }
 
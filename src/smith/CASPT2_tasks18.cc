@@ -42,8 +42,8 @@ void Task850::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x0, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata, c1.size(), a2.size(), c3.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, x0);
+    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), x0.size());
   }
   out()->put_block(odata, x0, c3, a2, c1);
 }
@@ -55,24 +55,24 @@ void Task851::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I815
   std::unique_ptr<double[]> odata = out()->move_block(x0, x3, x2, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x3, x2, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, x3, x2, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x3, x2, x1), 0.0);
   for (auto& c3 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2, x3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a2, x3, x2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c3.size(), a2.size(), x3.size(), x2.size());
+      const double* i0data = in(0)->get_block_view(c3, a2, x3, x2);
+      BlockBuffer i0data_sorted(in(0)->get_size(c3, a2, x3, x2));
+      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c3.size(), a2.size(), x3.size(), x2.size());
       // tensor label: I862
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c3, a2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c3, a2, x1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, x0.size(), c3.size(), a2.size(), x1.size());
+      const double* i1data = in(1)->get_block_view(x0, c3, a2, x1);
+      BlockBuffer i1data_sorted(in(1)->get_size(x0, c3, a2, x1));
+      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), c3.size(), a2.size(), x1.size());
       dgemm_("T", "N", x3.size()*x2.size(), x0.size()*x1.size(), c3.size()*a2.size(),
-             1.0, i0data_sorted, c3.size()*a2.size(), i1data_sorted, c3.size()*a2.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), c3.size()*a2.size(), i1data_sorted.get(), c3.size()*a2.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x0.size(), x1.size());
+  sort_indices<2,0,1,3,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x0.size(), x1.size());
   out()->put_block(odata, x0, x3, x2, x1);
 }
 
@@ -83,22 +83,22 @@ void Task852::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I862
   std::unique_ptr<double[]> odata = out()->move_block(x0, c3, a2, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, c3, a2, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, c3, a2, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, c3, a2, x1), 0.0);
   for (auto& c1 : *range_[0]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c1, x1);
+    BlockBuffer i0data_sorted(in(0)->get_size(c1, x1));
+    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), x1.size());
     // tensor label: I863
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c3, a2, c1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c3, a2, c1)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, x0.size(), c3.size(), a2.size(), c1.size());
+    const double* i1data = in(1)->get_block_view(x0, c3, a2, c1);
+    BlockBuffer i1data_sorted(in(1)->get_size(x0, c3, a2, c1));
+    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), c3.size(), a2.size(), c1.size());
     dgemm_("T", "N", x1.size(), x0.size()*c3.size()*a2.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, x1.size());
+           1.0, i0data_sorted.get(), c1.size(), i1data_sorted.get(), c1.size(),
+           1.0, odata_sorted.get(), x1.size());
   }
-  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c3.size(), a2.size());
+  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size(), c3.size(), a2.size());
   out()->put_block(odata, x0, c3, a2, x1);
 }
 
@@ -111,8 +111,8 @@ void Task853::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x0, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata, c1.size(), a2.size(), c3.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, x0);
+    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), x0.size());
   }
   out()->put_block(odata, x0, c3, a2, c1);
 }
@@ -124,24 +124,24 @@ void Task854::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I815
   std::unique_ptr<double[]> odata = out()->move_block(x0, x3, x2, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x3, x2, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, x3, x2, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x3, x2, x1), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, x3, x2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), x3.size(), x2.size());
+      const double* i0data = in(0)->get_block_view(c1, a2, x3, x2);
+      BlockBuffer i0data_sorted(in(0)->get_size(c1, a2, x3, x2));
+      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size(), x3.size(), x2.size());
       // tensor label: I866
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a2, c1, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a2, c1, x1)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, x0.size(), a2.size(), c1.size(), x1.size());
+      const double* i1data = in(1)->get_block_view(x0, a2, c1, x1);
+      BlockBuffer i1data_sorted(in(1)->get_size(x0, a2, c1, x1));
+      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), a2.size(), c1.size(), x1.size());
       dgemm_("T", "N", x3.size()*x2.size(), x0.size()*x1.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), a2.size()*c1.size(), i1data_sorted.get(), a2.size()*c1.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x0.size(), x1.size());
+  sort_indices<2,0,1,3,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x0.size(), x1.size());
   out()->put_block(odata, x0, x3, x2, x1);
 }
 
@@ -152,22 +152,22 @@ void Task855::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I866
   std::unique_ptr<double[]> odata = out()->move_block(x0, a2, c1, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, a2, c1, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, a2, c1, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, a2, c1, x1), 0.0);
   for (auto& c3 : *range_[0]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c3, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, x1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c3.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c3, x1);
+    BlockBuffer i0data_sorted(in(0)->get_size(c3, x1));
+    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), c3.size(), x1.size());
     // tensor label: I867
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c3, a2, c1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c3, a2, c1)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, x0.size(), c3.size(), a2.size(), c1.size());
+    const double* i1data = in(1)->get_block_view(x0, c3, a2, c1);
+    BlockBuffer i1data_sorted(in(1)->get_size(x0, c3, a2, c1));
+    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), c3.size(), a2.size(), c1.size());
     dgemm_("T", "N", x1.size(), x0.size()*a2.size()*c1.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, x1.size());
+           1.0, i0data_sorted.get(), c3.size(), i1data_sorted.get(), c3.size(),
+           1.0, odata_sorted.get(), x1.size());
   }
-  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a2.size(), c1.size());
+  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size(), a2.size(), c1.size());
   out()->put_block(odata, x0, a2, c1, x1);
 }
 
@@ -180,8 +180,8 @@ void Task856::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x0, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata, c1.size(), a2.size(), c3.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, x0);
+    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), x0.size());
   }
   out()->put_block(odata, x0, c3, a2, c1);
 }
@@ -193,24 +193,24 @@ void Task857::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I815
   std::unique_ptr<double[]> odata = out()->move_block(x0, x3, x2, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x3, x2, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, x3, x2, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x3, x2, x1), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: v2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x0, x1, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x0, x1, a2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), x0.size(), x1.size(), a2.size());
+      const double* i0data = in(0)->get_block_view(c1, x0, x1, a2);
+      BlockBuffer i0data_sorted(in(0)->get_size(c1, x0, x1, a2));
+      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), x0.size(), x1.size(), a2.size());
       // tensor label: I1252
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x2, x3, a2, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, x3, a2, c1)]);
-      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted, x2.size(), x3.size(), a2.size(), c1.size());
+      const double* i1data = in(1)->get_block_view(x2, x3, a2, c1);
+      BlockBuffer i1data_sorted(in(1)->get_size(x2, x3, a2, c1));
+      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), x3.size(), a2.size(), c1.size());
       dgemm_("T", "N", x0.size()*x1.size(), x2.size()*x3.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+             1.0, i0data_sorted.get(), a2.size()*c1.size(), i1data_sorted.get(), a2.size()*c1.size(),
+             1.0, odata_sorted.get(), x0.size()*x1.size());
     }
   }
-  sort_indices<0,3,2,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x3.size());
+  sort_indices<0,3,2,1,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), x2.size(), x3.size());
   out()->put_block(odata, x0, x3, x2, x1);
 }
 
@@ -223,8 +223,8 @@ void Task858::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x2, x3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x3, x2);
-    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata, c1.size(), a2.size(), x3.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, x3, x2);
+    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata.get(), c1.size(), a2.size(), x3.size(), x2.size());
   }
   out()->put_block(odata, x2, x3, a2, c1);
 }
@@ -236,22 +236,22 @@ void Task859::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I815
   std::unique_ptr<double[]> odata = out()->move_block(x0, x3, x2, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x3, x2, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, x3, x2, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x3, x2, x1), 0.0);
   for (auto& c1 : *range_[0]) {
     // tensor label: h1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x0)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(c1, x0);
+    BlockBuffer i0data_sorted(in(0)->get_size(c1, x0));
+    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), x0.size());
     // tensor label: I1288
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c1, x2, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c1, x2, x3)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), c1.size(), x2.size(), x3.size());
+    const double* i1data = in(1)->get_block_view(x1, c1, x2, x3);
+    BlockBuffer i1data_sorted(in(1)->get_size(x1, c1, x2, x3));
+    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), c1.size(), x2.size(), x3.size());
     dgemm_("T", "N", x0.size(), x1.size()*x2.size()*x3.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, x0.size());
+           1.0, i0data_sorted.get(), c1.size(), i1data_sorted.get(), c1.size(),
+           1.0, odata_sorted.get(), x0.size());
   }
-  sort_indices<0,3,2,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x3.size());
+  sort_indices<0,3,2,1,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), x2.size(), x3.size());
   out()->put_block(odata, x0, x3, x2, x1);
 }
 
@@ -264,8 +264,8 @@ void Task860::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, c1, x2, x3);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, c1, x1);
-    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata, x3.size(), x2.size(), c1.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x3, x2, c1, x1);
+    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata.get(), x3.size(), x2.size(), c1.size(), x1.size());
   }
   out()->put_block(odata, x1, c1, x2, x3);
 }
@@ -274,24 +274,24 @@ void Task861::Task_local::compute() {
   const Index ci0 = b(0);
   // tensor label: I768
   std::unique_ptr<double[]> odata = out()->move_block(ci0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(ci0)]);
+  BlockBuffer odata_sorted(out()->get_size(ci0));
   std::fill_n(odata_sorted.get(), out()->get_size(ci0), 0.0);
   for (auto& x0 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       // tensor label: Gamma284
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x0, x3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(ci0, x0, x3)]);
-      sort_indices<1,2,0,0,1,1,1>(i0data, i0data_sorted, ci0.size(), x0.size(), x3.size());
+      const double* i0data = in(0)->get_block_view(ci0, x0, x3);
+      BlockBuffer i0data_sorted(in(0)->get_size(ci0, x0, x3));
+      sort_indices<1,2,0,0,1,1,1>(i0data, i0data_sorted.get(), ci0.size(), x0.size(), x3.size());
       // tensor label: I823
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x0, x3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, x3)]);
-      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, x0.size(), x3.size());
+      const double* i1data = in(1)->get_block_view(x0, x3);
+      BlockBuffer i1data_sorted(in(1)->get_size(x0, x3));
+      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), x3.size());
       dgemm_("T", "N", ci0.size(), 1, x0.size()*x3.size(),
-             1.0, i0data_sorted, x0.size()*x3.size(), i1data_sorted, x0.size()*x3.size(),
-             1.0, odata_sorted, ci0.size());
+             1.0, i0data_sorted.get(), x0.size()*x3.size(), i1data_sorted.get(), x0.size()*x3.size(),
+             1.0, odata_sorted.get(), ci0.size());
     }
   }
-  sort_indices<0,1,1,1,1>(odata_sorted, odata, ci0.size());
+  sort_indices<0,1,1,1,1>(odata_sorted.get(), odata.get(), ci0.size());
   out()->put_block(odata, ci0);
 }
 
@@ -300,26 +300,26 @@ void Task862::Task_local::compute() {
   const Index x3 = b(1);
   // tensor label: I823
   std::unique_ptr<double[]> odata = out()->move_block(x0, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x3), 0.0);
   for (auto& c3 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2, c1, x3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a2, c1, x3)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c3.size(), a2.size(), c1.size(), x3.size());
+        const double* i0data = in(0)->get_block_view(c3, a2, c1, x3);
+        BlockBuffer i0data_sorted(in(0)->get_size(c3, a2, c1, x3));
+        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c3.size(), a2.size(), c1.size(), x3.size());
         // tensor label: I824
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c3, a2, c1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c3, a2, c1)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted, x0.size(), c3.size(), a2.size(), c1.size());
+        const double* i1data = in(1)->get_block_view(x0, c3, a2, c1);
+        BlockBuffer i1data_sorted(in(1)->get_size(x0, c3, a2, c1));
+        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), c3.size(), a2.size(), c1.size());
         dgemm_("T", "N", x3.size(), x0.size(), c3.size()*a2.size()*c1.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*c1.size(), i1data_sorted, c3.size()*a2.size()*c1.size(),
-               1.0, odata_sorted, x3.size());
+               1.0, i0data_sorted.get(), c3.size()*a2.size()*c1.size(), i1data_sorted.get(), c3.size()*a2.size()*c1.size(),
+               1.0, odata_sorted.get(), x3.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x0.size());
   out()->put_block(odata, x0, x3);
 }
 
@@ -332,8 +332,8 @@ void Task863::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x0, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata, c1.size(), a2.size(), c3.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, x0);
+    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), x0.size());
   }
   out()->put_block(odata, x0, c3, a2, c1);
 }
@@ -343,26 +343,26 @@ void Task864::Task_local::compute() {
   const Index x3 = b(1);
   // tensor label: I823
   std::unique_ptr<double[]> odata = out()->move_block(x0, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x3), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c3 : *range_[0]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, x3)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), x3.size());
+        const double* i0data = in(0)->get_block_view(c1, a2, c3, x3);
+        BlockBuffer i0data_sorted(in(0)->get_size(c1, a2, c3, x3));
+        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size(), c3.size(), x3.size());
         // tensor label: I827
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c3, a2, c1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c3, a2, c1)]);
-        sort_indices<3,2,1,0,0,1,1,1>(i1data, i1data_sorted, x0.size(), c3.size(), a2.size(), c1.size());
+        const double* i1data = in(1)->get_block_view(x0, c3, a2, c1);
+        BlockBuffer i1data_sorted(in(1)->get_size(x0, c3, a2, c1));
+        sort_indices<3,2,1,0,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), c3.size(), a2.size(), c1.size());
         dgemm_("T", "N", x3.size(), x0.size(), c3.size()*a2.size()*c1.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*c1.size(), i1data_sorted, c3.size()*a2.size()*c1.size(),
-               1.0, odata_sorted, x3.size());
+               1.0, i0data_sorted.get(), c3.size()*a2.size()*c1.size(), i1data_sorted.get(), c3.size()*a2.size()*c1.size(),
+               1.0, odata_sorted.get(), x3.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x0.size());
   out()->put_block(odata, x0, x3);
 }
 
@@ -375,8 +375,8 @@ void Task865::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x0, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata, c1.size(), a2.size(), c3.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, x0);
+    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), x0.size());
   }
   out()->put_block(odata, x0, c3, a2, c1);
 }
@@ -385,24 +385,24 @@ void Task866::Task_local::compute() {
   const Index ci0 = b(0);
   // tensor label: I768
   std::unique_ptr<double[]> odata = out()->move_block(ci0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(ci0)]);
+  BlockBuffer odata_sorted(out()->get_size(ci0));
   std::fill_n(odata_sorted.get(), out()->get_size(ci0), 0.0);
   for (auto& x0 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: Gamma286
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x0, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(ci0, x0, x1)]);
-      sort_indices<1,2,0,0,1,1,1>(i0data, i0data_sorted, ci0.size(), x0.size(), x1.size());
+      const double* i0data = in(0)->get_block_view(ci0, x0, x1);
+      BlockBuffer i0data_sorted(in(0)->get_size(ci0, x0, x1));
+      sort_indices<1,2,0,0,1,1,1>(i0data, i0data_sorted.get(), ci0.size(), x0.size(), x1.size());
       // tensor label: I829
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x0, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, x1)]);
-      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, x0.size(), x1.size());
+      const double* i1data = in(1)->get_block_view(x0, x1);
+      BlockBuffer i1data_sorted(in(1)->get_size(x0, x1));
+      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), x1.size());
       dgemm_("T", "N", ci0.size(), 1, x0.size()*x1.size(),
-             1.0, i0data_sorted, x0.size()*x1.size(), i1data_sorted, x0.size()*x1.size(),
-             1.0, odata_sorted, ci0.size());
+             1.0, i0data_sorted.get(), x0.size()*x1.size(), i1data_sorted.get(), x0.size()*x1.size(),
+             1.0, odata_sorted.get(), ci0.size());
     }
   }
-  sort_indices<0,1,1,1,1>(odata_sorted, odata, ci0.size());
+  sort_indices<0,1,1,1,1>(odata_sorted.get(), odata.get(), ci0.size());
   out()->put_block(odata, ci0);
 }
 
@@ -411,26 +411,26 @@ void Task867::Task_local::compute() {
   const Index x1 = b(1);
   // tensor label: I829
   std::unique_ptr<double[]> odata = out()->move_block(x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1), 0.0);
   for (auto& c4 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c3 : *range_[0]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(c4, a2, c3, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c4, a2, c3, x1)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c4.size(), a2.size(), c3.size(), x1.size());
+        const double* i0data = in(0)->get_block_view(c4, a2, c3, x1);
+        BlockBuffer i0data_sorted(in(0)->get_size(c4, a2, c3, x1));
+        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c4.size(), a2.size(), c3.size(), x1.size());
         // tensor label: I830
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c3, a2, c4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c3, a2, c4)]);
-        sort_indices<3,2,1,0,0,1,1,1>(i1data, i1data_sorted, x0.size(), c3.size(), a2.size(), c4.size());
+        const double* i1data = in(1)->get_block_view(x0, c3, a2, c4);
+        BlockBuffer i1data_sorted(in(1)->get_size(x0, c3, a2, c4));
+        sort_indices<3,2,1,0,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), c3.size(), a2.size(), c4.size());
         dgemm_("T", "N", x1.size(), x0.size(), c3.size()*a2.size()*c4.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*c4.size(), i1data_sorted, c3.size()*a2.size()*c4.size(),
-               1.0, odata_sorted, x1.size());
+               1.0, i0data_sorted.get(), c3.size()*a2.size()*c4.size(), i1data_sorted.get(), c3.size()*a2.size()*c4.size(),
+               1.0, odata_sorted.get(), x1.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size());
   out()->put_block(odata, x0, x1);
 }
 
@@ -441,22 +441,22 @@ void Task868::Task_local::compute() {
   const Index c4 = b(3);
   // tensor label: I830
   std::unique_ptr<double[]> odata = out()->move_block(x0, c3, a2, c4);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, c3, a2, c4)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, c3, a2, c4));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, c3, a2, c4), 0.0);
   for (auto& c1 : *range_[0]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, c4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, c4)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), c4.size());
+    const double* i0data = in(0)->get_block_view(c1, c4);
+    BlockBuffer i0data_sorted(in(0)->get_size(c1, c4));
+    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), c4.size());
     // tensor label: I831
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c3, a2, c1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c3, a2, c1)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, x0.size(), c3.size(), a2.size(), c1.size());
+    const double* i1data = in(1)->get_block_view(x0, c3, a2, c1);
+    BlockBuffer i1data_sorted(in(1)->get_size(x0, c3, a2, c1));
+    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), c3.size(), a2.size(), c1.size());
     dgemm_("T", "N", c4.size(), x0.size()*c3.size()*a2.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, c4.size());
+           1.0, i0data_sorted.get(), c1.size(), i1data_sorted.get(), c1.size(),
+           1.0, odata_sorted.get(), c4.size());
   }
-  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, c4.size(), x0.size(), c3.size(), a2.size());
+  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted.get(), odata.get(), c4.size(), x0.size(), c3.size(), a2.size());
   out()->put_block(odata, x0, c3, a2, c4);
 }
 
@@ -469,8 +469,8 @@ void Task869::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x0, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-    sort_indices<3,2,1,0,1,1,-4,1>(i0data, odata, c1.size(), a2.size(), c3.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, x0);
+    sort_indices<3,2,1,0,1,1,-4,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), x0.size());
   }
   out()->put_block(odata, x0, c3, a2, c1);
 }
@@ -480,26 +480,26 @@ void Task870::Task_local::compute() {
   const Index x1 = b(1);
   // tensor label: I829
   std::unique_ptr<double[]> odata = out()->move_block(x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1), 0.0);
   for (auto& c3 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c4 : *range_[0]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2, c4, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a2, c4, x1)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c3.size(), a2.size(), c4.size(), x1.size());
+        const double* i0data = in(0)->get_block_view(c3, a2, c4, x1);
+        BlockBuffer i0data_sorted(in(0)->get_size(c3, a2, c4, x1));
+        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c3.size(), a2.size(), c4.size(), x1.size());
         // tensor label: I834
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c3, a2, c4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c3, a2, c4)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted, x0.size(), c3.size(), a2.size(), c4.size());
+        const double* i1data = in(1)->get_block_view(x0, c3, a2, c4);
+        BlockBuffer i1data_sorted(in(1)->get_size(x0, c3, a2, c4));
+        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), c3.size(), a2.size(), c4.size());
         dgemm_("T", "N", x1.size(), x0.size(), c3.size()*a2.size()*c4.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*c4.size(), i1data_sorted, c3.size()*a2.size()*c4.size(),
-               1.0, odata_sorted, x1.size());
+               1.0, i0data_sorted.get(), c3.size()*a2.size()*c4.size(), i1data_sorted.get(), c3.size()*a2.size()*c4.size(),
+               1.0, odata_sorted.get(), x1.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size());
   out()->put_block(odata, x0, x1);
 }
 
@@ -510,22 +510,22 @@ void Task871::Task_local::compute() {
   const Index c4 = b(3);
   // tensor label: I834
   std::unique_ptr<double[]> odata = out()->move_block(x0, c3, a2, c4);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, c3, a2, c4)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, c3, a2, c4));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, c3, a2, c4), 0.0);
   for (auto& c1 : *range_[0]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, c4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, c4)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), c4.size());
+    const double* i0data = in(0)->get_block_view(c1, c4);
+    BlockBuffer i0data_sorted(in(0)->get_size(c1, c4));
+    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), c4.size());
     // tensor label: I835
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c3, a2, c1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c3, a2, c1)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, x0.size(), c3.size(), a2.size(), c1.size());
+    const double* i1data = in(1)->get_block_view(x0, c3, a2, c1);
+    BlockBuffer i1data_sorted(in(1)->get_size(x0, c3, a2, c1));
+    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), c3.size(), a2.size(), c1.size());
     dgemm_("T", "N", c4.size(), x0.size()*c3.size()*a2.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, c4.size());
+           1.0, i0data_sorted.get(), c1.size(), i1data_sorted.get(), c1.size(),
+           1.0, odata_sorted.get(), c4.size());
   }
-  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, c4.size(), x0.size(), c3.size(), a2.size());
+  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted.get(), odata.get(), c4.size(), x0.size(), c3.size(), a2.size());
   out()->put_block(odata, x0, c3, a2, c4);
 }
 
@@ -538,8 +538,8 @@ void Task872::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x0, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata, c1.size(), a2.size(), c3.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, x0);
+    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), x0.size());
   }
   out()->put_block(odata, x0, c3, a2, c1);
 }
@@ -549,26 +549,26 @@ void Task873::Task_local::compute() {
   const Index x1 = b(1);
   // tensor label: I829
   std::unique_ptr<double[]> odata = out()->move_block(x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1), 0.0);
   for (auto& c4 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(c4, a2, c1, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c4, a2, c1, x1)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c4.size(), a2.size(), c1.size(), x1.size());
+        const double* i0data = in(0)->get_block_view(c4, a2, c1, x1);
+        BlockBuffer i0data_sorted(in(0)->get_size(c4, a2, c1, x1));
+        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c4.size(), a2.size(), c1.size(), x1.size());
         // tensor label: I838
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a2, c1, c4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a2, c1, c4)]);
-        sort_indices<3,1,2,0,0,1,1,1>(i1data, i1data_sorted, x0.size(), a2.size(), c1.size(), c4.size());
+        const double* i1data = in(1)->get_block_view(x0, a2, c1, c4);
+        BlockBuffer i1data_sorted(in(1)->get_size(x0, a2, c1, c4));
+        sort_indices<3,1,2,0,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), a2.size(), c1.size(), c4.size());
         dgemm_("T", "N", x1.size(), x0.size(), a2.size()*c1.size()*c4.size(),
-               1.0, i0data_sorted, a2.size()*c1.size()*c4.size(), i1data_sorted, a2.size()*c1.size()*c4.size(),
-               1.0, odata_sorted, x1.size());
+               1.0, i0data_sorted.get(), a2.size()*c1.size()*c4.size(), i1data_sorted.get(), a2.size()*c1.size()*c4.size(),
+               1.0, odata_sorted.get(), x1.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size());
   out()->put_block(odata, x0, x1);
 }
 
@@ -579,22 +579,22 @@ void Task874::Task_local::compute() {
   const Index c4 = b(3);
   // tensor label: I838
   std::unique_ptr<double[]> odata = out()->move_block(x0, a2, c1, c4);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, a2, c1, c4)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, a2, c1, c4));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, a2, c1, c4), 0.0);
   for (auto& c3 : *range_[0]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c3, c4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, c4)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c3.size(), c4.size());
+    const double* i0data = in(0)->get_block_view(c3, c4);
+    BlockBuffer i0data_sorted(in(0)->get_size(c3, c4));
+    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), c3.size(), c4.size());
     // tensor label: I839
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c3, a2, c1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c3, a2, c1)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, x0.size(), c3.size(), a2.size(), c1.size());
+    const double* i1data = in(1)->get_block_view(x0, c3, a2, c1);
+    BlockBuffer i1data_sorted(in(1)->get_size(x0, c3, a2, c1));
+    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), c3.size(), a2.size(), c1.size());
     dgemm_("T", "N", c4.size(), x0.size()*a2.size()*c1.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, c4.size());
+           1.0, i0data_sorted.get(), c3.size(), i1data_sorted.get(), c3.size(),
+           1.0, odata_sorted.get(), c4.size());
   }
-  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, c4.size(), x0.size(), a2.size(), c1.size());
+  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted.get(), odata.get(), c4.size(), x0.size(), a2.size(), c1.size());
   out()->put_block(odata, x0, a2, c1, c4);
 }
 
@@ -607,8 +607,8 @@ void Task875::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x0, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata, c1.size(), a2.size(), c3.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, x0);
+    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), x0.size());
   }
   out()->put_block(odata, x0, c3, a2, c1);
 }
@@ -618,26 +618,26 @@ void Task876::Task_local::compute() {
   const Index x1 = b(1);
   // tensor label: I829
   std::unique_ptr<double[]> odata = out()->move_block(x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1), 0.0);
   for (auto& c3 : *range_[0]) {
     for (auto& a4 : *range_[2]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a4, c1, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a4, c1, x1)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c3.size(), a4.size(), c1.size(), x1.size());
+        const double* i0data = in(0)->get_block_view(c3, a4, c1, x1);
+        BlockBuffer i0data_sorted(in(0)->get_size(c3, a4, c1, x1));
+        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c3.size(), a4.size(), c1.size(), x1.size());
         // tensor label: I842
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c3, c1, a4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c3, c1, a4)]);
-        sort_indices<1,3,2,0,0,1,1,1>(i1data, i1data_sorted, x0.size(), c3.size(), c1.size(), a4.size());
+        const double* i1data = in(1)->get_block_view(x0, c3, c1, a4);
+        BlockBuffer i1data_sorted(in(1)->get_size(x0, c3, c1, a4));
+        sort_indices<1,3,2,0,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), c3.size(), c1.size(), a4.size());
         dgemm_("T", "N", x1.size(), x0.size(), c3.size()*c1.size()*a4.size(),
-               1.0, i0data_sorted, c3.size()*c1.size()*a4.size(), i1data_sorted, c3.size()*c1.size()*a4.size(),
-               1.0, odata_sorted, x1.size());
+               1.0, i0data_sorted.get(), c3.size()*c1.size()*a4.size(), i1data_sorted.get(), c3.size()*c1.size()*a4.size(),
+               1.0, odata_sorted.get(), x1.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size());
   out()->put_block(odata, x0, x1);
 }
 
@@ -648,22 +648,22 @@ void Task877::Task_local::compute() {
   const Index a4 = b(3);
   // tensor label: I842
   std::unique_ptr<double[]> odata = out()->move_block(x0, c3, c1, a4);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, c3, c1, a4)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, c3, c1, a4));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, c3, c1, a4), 0.0);
   for (auto& a2 : *range_[2]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a4, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a4, a2)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, a4.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(a4, a2);
+    BlockBuffer i0data_sorted(in(0)->get_size(a4, a2));
+    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted.get(), a4.size(), a2.size());
     // tensor label: I843
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c3, a2, c1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c3, a2, c1)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x0.size(), c3.size(), a2.size(), c1.size());
+    const double* i1data = in(1)->get_block_view(x0, c3, a2, c1);
+    BlockBuffer i1data_sorted(in(1)->get_size(x0, c3, a2, c1));
+    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), c3.size(), a2.size(), c1.size());
     dgemm_("T", "N", a4.size(), x0.size()*c3.size()*c1.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, a4.size());
+           1.0, i0data_sorted.get(), a2.size(), i1data_sorted.get(), a2.size(),
+           1.0, odata_sorted.get(), a4.size());
   }
-  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a4.size(), x0.size(), c3.size(), c1.size());
+  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted.get(), odata.get(), a4.size(), x0.size(), c3.size(), c1.size());
   out()->put_block(odata, x0, c3, c1, a4);
 }
 
@@ -676,8 +676,8 @@ void Task878::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x0, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata, c1.size(), a2.size(), c3.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, x0);
+    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), x0.size());
   }
   out()->put_block(odata, x0, c3, a2, c1);
 }
@@ -687,26 +687,26 @@ void Task879::Task_local::compute() {
   const Index x1 = b(1);
   // tensor label: I829
   std::unique_ptr<double[]> odata = out()->move_block(x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c4 : *range_[0]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c4, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c4, x1)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c4.size(), x1.size());
+        const double* i0data = in(0)->get_block_view(c1, a2, c4, x1);
+        BlockBuffer i0data_sorted(in(0)->get_size(c1, a2, c4, x1));
+        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size(), c4.size(), x1.size());
         // tensor label: I846
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a2, c1, c4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a2, c1, c4)]);
-        sort_indices<2,1,3,0,0,1,1,1>(i1data, i1data_sorted, x0.size(), a2.size(), c1.size(), c4.size());
+        const double* i1data = in(1)->get_block_view(x0, a2, c1, c4);
+        BlockBuffer i1data_sorted(in(1)->get_size(x0, a2, c1, c4));
+        sort_indices<2,1,3,0,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), a2.size(), c1.size(), c4.size());
         dgemm_("T", "N", x1.size(), x0.size(), a2.size()*c1.size()*c4.size(),
-               1.0, i0data_sorted, a2.size()*c1.size()*c4.size(), i1data_sorted, a2.size()*c1.size()*c4.size(),
-               1.0, odata_sorted, x1.size());
+               1.0, i0data_sorted.get(), a2.size()*c1.size()*c4.size(), i1data_sorted.get(), a2.size()*c1.size()*c4.size(),
+               1.0, odata_sorted.get(), x1.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size());
   out()->put_block(odata, x0, x1);
 }
 
@@ -717,22 +717,22 @@ void Task880::Task_local::compute() {
   const Index c4 = b(3);
   // tensor label: I846
   std::unique_ptr<double[]> odata = out()->move_block(x0, a2, c1, c4);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, a2, c1, c4)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, a2, c1, c4));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, a2, c1, c4), 0.0);
   for (auto& c3 : *range_[0]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c3, c4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, c4)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c3.size(), c4.size());
+    const double* i0data = in(0)->get_block_view(c3, c4);
+    BlockBuffer i0data_sorted(in(0)->get_size(c3, c4));
+    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), c3.size(), c4.size());
     // tensor label: I847
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c3, a2, c1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c3, a2, c1)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, x0.size(), c3.size(), a2.size(), c1.size());
+    const double* i1data = in(1)->get_block_view(x0, c3, a2, c1);
+    BlockBuffer i1data_sorted(in(1)->get_size(x0, c3, a2, c1));
+    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), c3.size(), a2.size(), c1.size());
     dgemm_("T", "N", c4.size(), x0.size()*a2.size()*c1.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, c4.size());
+           1.0, i0data_sorted.get(), c3.size(), i1data_sorted.get(), c3.size(),
+           1.0, odata_sorted.get(), c4.size());
   }
-  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, c4.size(), x0.size(), a2.size(), c1.size());
+  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted.get(), odata.get(), c4.size(), x0.size(), a2.size(), c1.size());
   out()->put_block(odata, x0, a2, c1, c4);
 }
 
@@ -745,8 +745,8 @@ void Task881::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x0, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-    sort_indices<3,2,1,0,1,1,-4,1>(i0data, odata, c1.size(), a2.size(), c3.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, x0);
+    sort_indices<3,2,1,0,1,1,-4,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), x0.size());
   }
   out()->put_block(odata, x0, c3, a2, c1);
 }
@@ -756,26 +756,26 @@ void Task882::Task_local::compute() {
   const Index x1 = b(1);
   // tensor label: I829
   std::unique_ptr<double[]> odata = out()->move_block(x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& a4 : *range_[2]) {
       for (auto& c3 : *range_[0]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a4, c3, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a4, c3, x1)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a4.size(), c3.size(), x1.size());
+        const double* i0data = in(0)->get_block_view(c1, a4, c3, x1);
+        BlockBuffer i0data_sorted(in(0)->get_size(c1, a4, c3, x1));
+        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a4.size(), c3.size(), x1.size());
         // tensor label: I850
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c3, c1, a4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c3, c1, a4)]);
-        sort_indices<2,3,1,0,0,1,1,1>(i1data, i1data_sorted, x0.size(), c3.size(), c1.size(), a4.size());
+        const double* i1data = in(1)->get_block_view(x0, c3, c1, a4);
+        BlockBuffer i1data_sorted(in(1)->get_size(x0, c3, c1, a4));
+        sort_indices<2,3,1,0,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), c3.size(), c1.size(), a4.size());
         dgemm_("T", "N", x1.size(), x0.size(), c3.size()*c1.size()*a4.size(),
-               1.0, i0data_sorted, c3.size()*c1.size()*a4.size(), i1data_sorted, c3.size()*c1.size()*a4.size(),
-               1.0, odata_sorted, x1.size());
+               1.0, i0data_sorted.get(), c3.size()*c1.size()*a4.size(), i1data_sorted.get(), c3.size()*c1.size()*a4.size(),
+               1.0, odata_sorted.get(), x1.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size());
   out()->put_block(odata, x0, x1);
 }
 
@@ -786,22 +786,22 @@ void Task883::Task_local::compute() {
   const Index a4 = b(3);
   // tensor label: I850
   std::unique_ptr<double[]> odata = out()->move_block(x0, c3, c1, a4);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, c3, c1, a4)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, c3, c1, a4));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, c3, c1, a4), 0.0);
   for (auto& a2 : *range_[2]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a4, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a4, a2)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, a4.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(a4, a2);
+    BlockBuffer i0data_sorted(in(0)->get_size(a4, a2));
+    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted.get(), a4.size(), a2.size());
     // tensor label: I851
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c3, a2, c1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c3, a2, c1)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x0.size(), c3.size(), a2.size(), c1.size());
+    const double* i1data = in(1)->get_block_view(x0, c3, a2, c1);
+    BlockBuffer i1data_sorted(in(1)->get_size(x0, c3, a2, c1));
+    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), c3.size(), a2.size(), c1.size());
     dgemm_("T", "N", a4.size(), x0.size()*c3.size()*c1.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, a4.size());
+           1.0, i0data_sorted.get(), a2.size(), i1data_sorted.get(), a2.size(),
+           1.0, odata_sorted.get(), a4.size());
   }
-  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a4.size(), x0.size(), c3.size(), c1.size());
+  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted.get(), odata.get(), a4.size(), x0.size(), c3.size(), c1.size());
   out()->put_block(odata, x0, c3, c1, a4);
 }
 
@@ -814,8 +814,8 @@ void Task884::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x0, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata, c1.size(), a2.size(), c3.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, x0);
+    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), x0.size());
   }
   out()->put_block(odata, x0, c3, a2, c1);
 }
@@ -825,22 +825,22 @@ void Task885::Task_local::compute() {
   const Index x1 = b(1);
   // tensor label: I829
   std::unique_ptr<double[]> odata = out()->move_block(x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1), 0.0);
   for (auto& a4 : *range_[2]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a4, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a4, x1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, a4.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(a4, x1);
+    BlockBuffer i0data_sorted(in(0)->get_size(a4, x1));
+    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), a4.size(), x1.size());
     // tensor label: I870
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a4)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, x0.size(), a4.size());
+    const double* i1data = in(1)->get_block_view(x0, a4);
+    BlockBuffer i1data_sorted(in(1)->get_size(x0, a4));
+    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), a4.size());
     dgemm_("T", "N", x1.size(), x0.size(), a4.size(),
-           1.0, i0data_sorted, a4.size(), i1data_sorted, a4.size(),
-           1.0, odata_sorted, x1.size());
+           1.0, i0data_sorted.get(), a4.size(), i1data_sorted.get(), a4.size(),
+           1.0, odata_sorted.get(), x1.size());
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size());
   out()->put_block(odata, x0, x1);
 }
 
@@ -849,26 +849,26 @@ void Task886::Task_local::compute() {
   const Index a4 = b(1);
   // tensor label: I870
   std::unique_ptr<double[]> odata = out()->move_block(x0, a4);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, a4)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, a4));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, a4), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& c3 : *range_[0]) {
       for (auto& a2 : *range_[2]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a4, c3, a2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a4, c3, a2)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a4.size(), c3.size(), a2.size());
+        const double* i0data = in(0)->get_block_view(c1, a4, c3, a2);
+        BlockBuffer i0data_sorted(in(0)->get_size(c1, a4, c3, a2));
+        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a4.size(), c3.size(), a2.size());
         // tensor label: I871
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c3, a2, c1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c3, a2, c1)]);
-        sort_indices<3,1,2,0,0,1,1,1>(i1data, i1data_sorted, x0.size(), c3.size(), a2.size(), c1.size());
+        const double* i1data = in(1)->get_block_view(x0, c3, a2, c1);
+        BlockBuffer i1data_sorted(in(1)->get_size(x0, c3, a2, c1));
+        sort_indices<3,1,2,0,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), c3.size(), a2.size(), c1.size());
         dgemm_("T", "N", a4.size(), x0.size(), c3.size()*a2.size()*c1.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*c1.size(), i1data_sorted, c3.size()*a2.size()*c1.size(),
-               1.0, odata_sorted, a4.size());
+               1.0, i0data_sorted.get(), c3.size()*a2.size()*c1.size(), i1data_sorted.get(), c3.size()*a2.size()*c1.size(),
+               1.0, odata_sorted.get(), a4.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a4.size(), x0.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), a4.size(), x0.size());
   out()->put_block(odata, x0, a4);
 }
 
@@ -881,8 +881,8 @@ void Task887::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x0, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-    sort_indices<3,2,1,0,1,1,-4,1>(i0data, odata, c1.size(), a2.size(), c3.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, x0);
+    sort_indices<3,2,1,0,1,1,-4,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), x0.size());
   }
   out()->put_block(odata, x0, c3, a2, c1);
 }
@@ -892,26 +892,26 @@ void Task888::Task_local::compute() {
   const Index a4 = b(1);
   // tensor label: I870
   std::unique_ptr<double[]> odata = out()->move_block(x0, a4);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, a4)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, a4));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, a4), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c3 : *range_[0]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, a4)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
+        const double* i0data = in(0)->get_block_view(c1, a2, c3, a4);
+        BlockBuffer i0data_sorted(in(0)->get_size(c1, a2, c3, a4));
+        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size(), c3.size(), a4.size());
         // tensor label: I875
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c3, a2, c1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c3, a2, c1)]);
-        sort_indices<3,2,1,0,0,1,1,1>(i1data, i1data_sorted, x0.size(), c3.size(), a2.size(), c1.size());
+        const double* i1data = in(1)->get_block_view(x0, c3, a2, c1);
+        BlockBuffer i1data_sorted(in(1)->get_size(x0, c3, a2, c1));
+        sort_indices<3,2,1,0,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), c3.size(), a2.size(), c1.size());
         dgemm_("T", "N", a4.size(), x0.size(), c3.size()*a2.size()*c1.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*c1.size(), i1data_sorted, c3.size()*a2.size()*c1.size(),
-               1.0, odata_sorted, a4.size());
+               1.0, i0data_sorted.get(), c3.size()*a2.size()*c1.size(), i1data_sorted.get(), c3.size()*a2.size()*c1.size(),
+               1.0, odata_sorted.get(), a4.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a4.size(), x0.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), a4.size(), x0.size());
   out()->put_block(odata, x0, a4);
 }
 
@@ -924,8 +924,8 @@ void Task889::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x0, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-    sort_indices<3,2,1,0,1,1,8,1>(i0data, odata, c1.size(), a2.size(), c3.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, x0);
+    sort_indices<3,2,1,0,1,1,8,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), x0.size());
   }
   out()->put_block(odata, x0, c3, a2, c1);
 }
@@ -935,22 +935,22 @@ void Task890::Task_local::compute() {
   const Index x1 = b(1);
   // tensor label: I829
   std::unique_ptr<double[]> odata = out()->move_block(x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1), 0.0);
   for (auto& a2 : *range_[2]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a2)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(x0, a2);
+    BlockBuffer i0data_sorted(in(0)->get_size(x0, a2));
+    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), a2.size());
     // tensor label: I1013
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a2, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, x1)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a2.size(), x1.size());
+    const double* i1data = in(1)->get_block_view(a2, x1);
+    BlockBuffer i1data_sorted(in(1)->get_size(a2, x1));
+    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a2.size(), x1.size());
     dgemm_("T", "N", x0.size(), x1.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, x0.size());
+           1.0, i0data_sorted.get(), a2.size(), i1data_sorted.get(), a2.size(),
+           1.0, odata_sorted.get(), x0.size());
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size());
   out()->put_block(odata, x0, x1);
 }
 
@@ -959,26 +959,26 @@ void Task891::Task_local::compute() {
   const Index x1 = b(1);
   // tensor label: I1013
   std::unique_ptr<double[]> odata = out()->move_block(a2, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(a2, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(a2, x1), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& a4 : *range_[2]) {
       for (auto& c3 : *range_[0]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a4, c3, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a4, c3, x1)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a4.size(), c3.size(), x1.size());
+        const double* i0data = in(0)->get_block_view(c1, a4, c3, x1);
+        BlockBuffer i0data_sorted(in(0)->get_size(c1, a4, c3, x1));
+        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a4.size(), c3.size(), x1.size());
         // tensor label: I1014
-        std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c3, a2, c1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c3, a2, c1)]);
-        sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, a4.size(), c3.size(), a2.size(), c1.size());
+        const double* i1data = in(1)->get_block_view(a4, c3, a2, c1);
+        BlockBuffer i1data_sorted(in(1)->get_size(a4, c3, a2, c1));
+        sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), c3.size(), a2.size(), c1.size());
         dgemm_("T", "N", x1.size(), a2.size(), a4.size()*c3.size()*c1.size(),
-               1.0, i0data_sorted, a4.size()*c3.size()*c1.size(), i1data_sorted, a4.size()*c3.size()*c1.size(),
-               1.0, odata_sorted, x1.size());
+               1.0, i0data_sorted.get(), a4.size()*c3.size()*c1.size(), i1data_sorted.get(), a4.size()*c3.size()*c1.size(),
+               1.0, odata_sorted.get(), x1.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), a2.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), a2.size());
   out()->put_block(odata, a2, x1);
 }
 
@@ -991,8 +991,8 @@ void Task892::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a4, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-    sort_indices<3,2,1,0,1,1,-4,1>(i0data, odata, c1.size(), a2.size(), c3.size(), a4.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, a4);
+    sort_indices<3,2,1,0,1,1,-4,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), a4.size());
   }
   out()->put_block(odata, a4, c3, a2, c1);
 }
@@ -1002,22 +1002,22 @@ void Task893::Task_local::compute() {
   const Index x1 = b(1);
   // tensor label: I829
   std::unique_ptr<double[]> odata = out()->move_block(x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1), 0.0);
   for (auto& a4 : *range_[2]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a4)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), a4.size());
+    const double* i0data = in(0)->get_block_view(x0, a4);
+    BlockBuffer i0data_sorted(in(0)->get_size(x0, a4));
+    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), a4.size());
     // tensor label: I1017
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a4, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, x1)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a4.size(), x1.size());
+    const double* i1data = in(1)->get_block_view(a4, x1);
+    BlockBuffer i1data_sorted(in(1)->get_size(a4, x1));
+    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), x1.size());
     dgemm_("T", "N", x0.size(), x1.size(), a4.size(),
-           1.0, i0data_sorted, a4.size(), i1data_sorted, a4.size(),
-           1.0, odata_sorted, x0.size());
+           1.0, i0data_sorted.get(), a4.size(), i1data_sorted.get(), a4.size(),
+           1.0, odata_sorted.get(), x0.size());
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size());
   out()->put_block(odata, x0, x1);
 }
 
@@ -1026,26 +1026,26 @@ void Task894::Task_local::compute() {
   const Index x1 = b(1);
   // tensor label: I1017
   std::unique_ptr<double[]> odata = out()->move_block(a4, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(a4, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(a4, x1), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c3 : *range_[0]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, x1)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), x1.size());
+        const double* i0data = in(0)->get_block_view(c1, a2, c3, x1);
+        BlockBuffer i0data_sorted(in(0)->get_size(c1, a2, c3, x1));
+        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size(), c3.size(), x1.size());
         // tensor label: I1018
-        std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c3, a2, c1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c3, a2, c1)]);
-        sort_indices<3,2,1,0,0,1,1,1>(i1data, i1data_sorted, a4.size(), c3.size(), a2.size(), c1.size());
+        const double* i1data = in(1)->get_block_view(a4, c3, a2, c1);
+        BlockBuffer i1data_sorted(in(1)->get_size(a4, c3, a2, c1));
+        sort_indices<3,2,1,0,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), c3.size(), a2.size(), c1.size());
         dgemm_("T", "N", x1.size(), a4.size(), c3.size()*a2.size()*c1.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*c1.size(), i1data_sorted, c3.size()*a2.size()*c1.size(),
-               1.0, odata_sorted, x1.size());
+               1.0, i0data_sorted.get(), c3.size()*a2.size()*c1.size(), i1data_sorted.get(), c3.size()*a2.size()*c1.size(),
+               1.0, odata_sorted.get(), x1.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), a4.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), a4.size());
   out()->put_block(odata, a4, x1);
 }
 
@@ -1058,8 +1058,8 @@ void Task895::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a4, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-    sort_indices<3,2,1,0,1,1,8,1>(i0data, odata, c1.size(), a2.size(), c3.size(), a4.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, a4);
+    sort_indices<3,2,1,0,1,1,8,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), a4.size());
   }
   out()->put_block(odata, a4, c3, a2, c1);
 }
@@ -1069,26 +1069,26 @@ void Task896::Task_local::compute() {
   const Index x1 = b(1);
   // tensor label: I829
   std::unique_ptr<double[]> odata = out()->move_block(x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1), 0.0);
   for (auto& c3 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2, c1, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a2, c1, x1)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c3.size(), a2.size(), c1.size(), x1.size());
+        const double* i0data = in(0)->get_block_view(c3, a2, c1, x1);
+        BlockBuffer i0data_sorted(in(0)->get_size(c3, a2, c1, x1));
+        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c3.size(), a2.size(), c1.size(), x1.size());
         // tensor label: I1138
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c3, a2, c1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c3, a2, c1)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted, x0.size(), c3.size(), a2.size(), c1.size());
+        const double* i1data = in(1)->get_block_view(x0, c3, a2, c1);
+        BlockBuffer i1data_sorted(in(1)->get_size(x0, c3, a2, c1));
+        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), c3.size(), a2.size(), c1.size());
         dgemm_("T", "N", x1.size(), x0.size(), c3.size()*a2.size()*c1.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*c1.size(), i1data_sorted, c3.size()*a2.size()*c1.size(),
-               1.0, odata_sorted, x1.size());
+               1.0, i0data_sorted.get(), c3.size()*a2.size()*c1.size(), i1data_sorted.get(), c3.size()*a2.size()*c1.size(),
+               1.0, odata_sorted.get(), x1.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size());
   out()->put_block(odata, x0, x1);
 }
 
@@ -1103,7 +1103,7 @@ void Task897::Task_local::compute() {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
     dscal_(x0.size()*c3.size()*a2.size()*c1.size(), e0_, i0data.get(), 1);
-    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata, c1.size(), a2.size(), c3.size(), x0.size());
+    sort_indices<3,2,1,0,1,1,2,1>(i0data.get(), odata.get(), c1.size(), a2.size(), c3.size(), x0.size());
   }
   out()->put_block(odata, x0, c3, a2, c1);
 }
@@ -1113,26 +1113,26 @@ void Task898::Task_local::compute() {
   const Index x1 = b(1);
   // tensor label: I829
   std::unique_ptr<double[]> odata = out()->move_block(x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c3 : *range_[0]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, x1)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), x1.size());
+        const double* i0data = in(0)->get_block_view(c1, a2, c3, x1);
+        BlockBuffer i0data_sorted(in(0)->get_size(c1, a2, c3, x1));
+        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size(), c3.size(), x1.size());
         // tensor label: I1141
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c3, a2, c1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c3, a2, c1)]);
-        sort_indices<3,2,1,0,0,1,1,1>(i1data, i1data_sorted, x0.size(), c3.size(), a2.size(), c1.size());
+        const double* i1data = in(1)->get_block_view(x0, c3, a2, c1);
+        BlockBuffer i1data_sorted(in(1)->get_size(x0, c3, a2, c1));
+        sort_indices<3,2,1,0,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), c3.size(), a2.size(), c1.size());
         dgemm_("T", "N", x1.size(), x0.size(), c3.size()*a2.size()*c1.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*c1.size(), i1data_sorted, c3.size()*a2.size()*c1.size(),
-               1.0, odata_sorted, x1.size());
+               1.0, i0data_sorted.get(), c3.size()*a2.size()*c1.size(), i1data_sorted.get(), c3.size()*a2.size()*c1.size(),
+               1.0, odata_sorted.get(), x1.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size());
   out()->put_block(odata, x0, x1);
 }
 
@@ -1147,7 +1147,7 @@ void Task899::Task_local::compute() {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
     dscal_(x0.size()*c3.size()*a2.size()*c1.size(), e0_, i0data.get(), 1);
-    sort_indices<3,2,1,0,1,1,-4,1>(i0data, odata, c1.size(), a2.size(), c3.size(), x0.size());
+    sort_indices<3,2,1,0,1,1,-4,1>(i0data.get(), odata.get(), c1.size(), a2.size(), c3.size(), x0.size());
   }
   out()->put_block(odata, x0, c3, a2, c1);
 }
@@ -38,26 +38,26 @@ void Task900::Task_local::compute() {
   const Index x1 = b(1);
   // tensor label: I829
   std::unique_ptr<double[]> odata = out()->move_block(x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1), 0.0);
   for (auto& c3 : *range_[0]) {
     for (auto& c1 : *range_[0]) {
       for (auto& a2 : *range_[2]) {
         // tensor label: v2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(c3, x1, c1, a2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, x1, c1, a2)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, c3.size(), x1.size(), c1.size(), a2.size());
+        const double* i0data = in(0)->get_block_view(c3, x1, c1, a2);
+        BlockBuffer i0data_sorted(in(0)->get_size(c3, x1, c1, a2));
+        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted.get(), c3.size(), x1.size(), c1.size(), a2.size());
         // tensor label: I1177
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c3, a2, c1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c3, a2, c1)]);
-        sort_indices<1,3,2,0,0,1,1,1>(i1data, i1data_sorted, x0.size(), c3.size(), a2.size(), c1.size());
+        const double* i1data = in(1)->get_block_view(x0, c3, a2, c1);
+        BlockBuffer i1data_sorted(in(1)->get_size(x0, c3, a2, c1));
+        sort_indices<1,3,2,0,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), c3.size(), a2.size(), c1.size());
         dgemm_("T", "N", x1.size(), x0.size(), c3.size()*a2.size()*c1.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*c1.size(), i1data_sorted, c3.size()*a2.size()*c1.size(),
-               1.0, odata_sorted, x1.size());
+               1.0, i0data_sorted.get(), c3.size()*a2.size()*c1.size(), i1data_sorted.get(), c3.size()*a2.size()*c1.size(),
+               1.0, odata_sorted.get(), x1.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size());
   out()->put_block(odata, x0, x1);
 }
 
@@ -70,8 +70,8 @@ void Task901::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x0, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata, c1.size(), a2.size(), c3.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, x0);
+    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), x0.size());
   }
   out()->put_block(odata, x0, c3, a2, c1);
 }
@@ -81,26 +81,26 @@ void Task902::Task_local::compute() {
   const Index x1 = b(1);
   // tensor label: I829
   std::unique_ptr<double[]> odata = out()->move_block(x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& c3 : *range_[0]) {
       for (auto& a2 : *range_[2]) {
         // tensor label: v2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x1, c3, a2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x1, c3, a2)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), x1.size(), c3.size(), a2.size());
+        const double* i0data = in(0)->get_block_view(c1, x1, c3, a2);
+        BlockBuffer i0data_sorted(in(0)->get_size(c1, x1, c3, a2));
+        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), x1.size(), c3.size(), a2.size());
         // tensor label: I1180
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c3, a2, c1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c3, a2, c1)]);
-        sort_indices<3,1,2,0,0,1,1,1>(i1data, i1data_sorted, x0.size(), c3.size(), a2.size(), c1.size());
+        const double* i1data = in(1)->get_block_view(x0, c3, a2, c1);
+        BlockBuffer i1data_sorted(in(1)->get_size(x0, c3, a2, c1));
+        sort_indices<3,1,2,0,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), c3.size(), a2.size(), c1.size());
         dgemm_("T", "N", x1.size(), x0.size(), c3.size()*a2.size()*c1.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*c1.size(), i1data_sorted, c3.size()*a2.size()*c1.size(),
-               1.0, odata_sorted, x1.size());
+               1.0, i0data_sorted.get(), c3.size()*a2.size()*c1.size(), i1data_sorted.get(), c3.size()*a2.size()*c1.size(),
+               1.0, odata_sorted.get(), x1.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size());
   out()->put_block(odata, x0, x1);
 }
 
@@ -113,8 +113,8 @@ void Task903::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x0, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata, c1.size(), a2.size(), c3.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, x0);
+    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), x0.size());
   }
   out()->put_block(odata, x0, c3, a2, c1);
 }
@@ -124,26 +124,26 @@ void Task904::Task_local::compute() {
   const Index x1 = b(1);
   // tensor label: I829
   std::unique_ptr<double[]> odata = out()->move_block(x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1), 0.0);
   for (auto& c3 : *range_[0]) {
     for (auto& c1 : *range_[0]) {
       for (auto& a2 : *range_[2]) {
         // tensor label: v2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(c3, x0, c1, a2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, x0, c1, a2)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, c3.size(), x0.size(), c1.size(), a2.size());
+        const double* i0data = in(0)->get_block_view(c3, x0, c1, a2);
+        BlockBuffer i0data_sorted(in(0)->get_size(c3, x0, c1, a2));
+        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted.get(), c3.size(), x0.size(), c1.size(), a2.size());
         // tensor label: I1231
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c3, a2, c1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c3, a2, c1)]);
-        sort_indices<1,3,2,0,0,1,1,1>(i1data, i1data_sorted, x1.size(), c3.size(), a2.size(), c1.size());
+        const double* i1data = in(1)->get_block_view(x1, c3, a2, c1);
+        BlockBuffer i1data_sorted(in(1)->get_size(x1, c3, a2, c1));
+        sort_indices<1,3,2,0,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), c3.size(), a2.size(), c1.size());
         dgemm_("T", "N", x0.size(), x1.size(), c3.size()*a2.size()*c1.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*c1.size(), i1data_sorted, c3.size()*a2.size()*c1.size(),
-               1.0, odata_sorted, x0.size());
+               1.0, i0data_sorted.get(), c3.size()*a2.size()*c1.size(), i1data_sorted.get(), c3.size()*a2.size()*c1.size(),
+               1.0, odata_sorted.get(), x0.size());
       }
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size());
   out()->put_block(odata, x0, x1);
 }
 
@@ -156,8 +156,8 @@ void Task905::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x1);
-    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata, c1.size(), a2.size(), c3.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, x1);
+    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), x1.size());
   }
   out()->put_block(odata, x1, c3, a2, c1);
 }
@@ -167,26 +167,26 @@ void Task906::Task_local::compute() {
   const Index x1 = b(1);
   // tensor label: I829
   std::unique_ptr<double[]> odata = out()->move_block(x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& c3 : *range_[0]) {
       for (auto& a2 : *range_[2]) {
         // tensor label: v2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x0, c3, a2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x0, c3, a2)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), x0.size(), c3.size(), a2.size());
+        const double* i0data = in(0)->get_block_view(c1, x0, c3, a2);
+        BlockBuffer i0data_sorted(in(0)->get_size(c1, x0, c3, a2));
+        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), x0.size(), c3.size(), a2.size());
         // tensor label: I1234
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c3, a2, c1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c3, a2, c1)]);
-        sort_indices<3,1,2,0,0,1,1,1>(i1data, i1data_sorted, x1.size(), c3.size(), a2.size(), c1.size());
+        const double* i1data = in(1)->get_block_view(x1, c3, a2, c1);
+        BlockBuffer i1data_sorted(in(1)->get_size(x1, c3, a2, c1));
+        sort_indices<3,1,2,0,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), c3.size(), a2.size(), c1.size());
         dgemm_("T", "N", x0.size(), x1.size(), c3.size()*a2.size()*c1.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*c1.size(), i1data_sorted, c3.size()*a2.size()*c1.size(),
-               1.0, odata_sorted, x0.size());
+               1.0, i0data_sorted.get(), c3.size()*a2.size()*c1.size(), i1data_sorted.get(), c3.size()*a2.size()*c1.size(),
+               1.0, odata_sorted.get(), x0.size());
       }
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size());
   out()->put_block(odata, x0, x1);
 }
 
@@ -199,8 +199,8 @@ void Task907::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x1);
-    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata, c1.size(), a2.size(), c3.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, x1);
+    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), x1.size());
   }
   out()->put_block(odata, x1, c3, a2, c1);
 }
@@ -209,28 +209,28 @@ void Task908::Task_local::compute() {
   const Index ci0 = b(0);
   // tensor label: I768
   std::unique_ptr<double[]> odata = out()->move_block(ci0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(ci0)]);
+  BlockBuffer odata_sorted(out()->get_size(ci0));
   std::fill_n(odata_sorted.get(), out()->get_size(ci0), 0.0);
   for (auto& x3 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       for (auto& x0 : *range_[1]) {
         for (auto& x2 : *range_[1]) {
           // tensor label: Gamma292
-          std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x3, x1, x0, x2);
-          std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(ci0, x3, x1, x0, x2)]);
-          sort_indices<1,2,3,4,0,0,1,1,1>(i0data, i0data_sorted, ci0.size(), x3.size(), x1.size(), x0.size(), x2.size());
+          const double* i0data = in(0)->get_block_view(ci0, x3, x1, x0, x2);
+          BlockBuffer i0data_sorted(in(0)->get_size(ci0, x3, x1, x0, x2));
+          sort_indices<1,2,3,4,0,0,1,1,1>(i0data, i0data_sorted.get(), ci0.size(), x3.size(), x1.size(), x0.size(), x2.size());
           // tensor label: I853
-          std::unique_ptr<double[]> i1data = in(1)->get_block(x0, x1, x3, x2);
-          std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, x1, x3, x2)]);
-          sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, x0.size(), x1.size(), x3.size(), x2.size());
+          const double* i1data = in(1)->get_block_view(x0, x1, x3, x2);
+          BlockBuffer i1data_sorted(in(1)->get_size(x0, x1, x3, x2));
+          sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), x1.size(), x3.size(), x2.size());
           dgemm_("T", "N", ci0.size(), 1, x0.size()*x1.size()*x3.size()*x2.size(),
-                 1.0, i0data_sorted, x0.size()*x1.size()*x3.size()*x2.size(), i1data_sorted, x0.size()*x1.size()*x3.size()*x2.size(),
-                 1.0, odata_sorted, ci0.size());
+                 1.0, i0data_sorted.get(), x0.size()*x1.size()*x3.size()*x2.size(), i1data_sorted.get(), x0.size()*x1.size()*x3.size()*x2.size(),
+                 1.0, odata_sorted.get(), ci0.size());
         }
       }
     }
   }
-  sort_indices<0,1,1,1,1>(odata_sorted, odata, ci0.size());
+  sort_indices<0,1,1,1,1>(odata_sorted.get(), odata.get(), ci0.size());
   out()->put_block(odata, ci0);
 }
 
@@ -241,24 +241,24 @@ void Task909::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I853
   std::unique_ptr<double[]> odata = out()->move_block(x0, x1, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, x1, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1, x3, x2), 0.0);
   for (auto& a2 : *range_[2]) {
     for (auto& c3 : *range_[0]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a2, c3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a2, c3, x2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a2.size(), c3.size(), x2.size());
+      const double* i0data = in(0)->get_block_view(x3, a2, c3, x2);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, a2, c3, x2));
+      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a2.size(), c3.size(), x2.size());
       // tensor label: I854
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c3, a2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c3, a2, x1)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, x0.size(), c3.size(), a2.size(), x1.size());
+      const double* i1data = in(1)->get_block_view(x0, c3, a2, x1);
+      BlockBuffer i1data_sorted(in(1)->get_size(x0, c3, a2, x1));
+      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), c3.size(), a2.size(), x1.size());
       dgemm_("T", "N", x3.size()*x2.size(), x0.size()*x1.size(), c3.size()*a2.size(),
-             1.0, i0data_sorted, c3.size()*a2.size(), i1data_sorted, c3.size()*a2.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), c3.size()*a2.size(), i1data_sorted.get(), c3.size()*a2.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x0.size(), x1.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x0.size(), x1.size());
   out()->put_block(odata, x0, x1, x3, x2);
 }
 
@@ -269,22 +269,22 @@ void Task910::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I854
   std::unique_ptr<double[]> odata = out()->move_block(x0, c3, a2, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, c3, a2, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, c3, a2, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, c3, a2, x1), 0.0);
   for (auto& c1 : *range_[0]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c1, x1);
+    BlockBuffer i0data_sorted(in(0)->get_size(c1, x1));
+    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), x1.size());
     // tensor label: I855
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c3, a2, c1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c3, a2, c1)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, x0.size(), c3.size(), a2.size(), c1.size());
+    const double* i1data = in(1)->get_block_view(x0, c3, a2, c1);
+    BlockBuffer i1data_sorted(in(1)->get_size(x0, c3, a2, c1));
+    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), c3.size(), a2.size(), c1.size());
     dgemm_("T", "N", x1.size(), x0.size()*c3.size()*a2.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, x1.size());
+           1.0, i0data_sorted.get(), c1.size(), i1data_sorted.get(), c1.size(),
+           1.0, odata_sorted.get(), x1.size());
   }
-  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c3.size(), a2.size());
+  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size(), c3.size(), a2.size());
   out()->put_block(odata, x0, c3, a2, x1);
 }
 
@@ -297,8 +297,8 @@ void Task911::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x0, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata, c1.size(), a2.size(), c3.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, x0);
+    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), x0.size());
   }
   out()->put_block(odata, x0, c3, a2, c1);
 }
@@ -310,24 +310,24 @@ void Task912::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I853
   std::unique_ptr<double[]> odata = out()->move_block(x0, x1, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, x1, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1, x3, x2), 0.0);
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: v2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c2, x0, x1, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, x0, x1, a1)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, c2.size(), x0.size(), x1.size(), a1.size());
+      const double* i0data = in(0)->get_block_view(c2, x0, x1, a1);
+      BlockBuffer i0data_sorted(in(0)->get_size(c2, x0, x1, a1));
+      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted.get(), c2.size(), x0.size(), x1.size(), a1.size());
       // tensor label: I1240
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c2, a1, x3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c2, a1, x3)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, x2.size(), c2.size(), a1.size(), x3.size());
+      const double* i1data = in(1)->get_block_view(x2, c2, a1, x3);
+      BlockBuffer i1data_sorted(in(1)->get_size(x2, c2, a1, x3));
+      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), c2.size(), a1.size(), x3.size());
       dgemm_("T", "N", x0.size()*x1.size(), x2.size()*x3.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+             1.0, i0data_sorted.get(), c2.size()*a1.size(), i1data_sorted.get(), c2.size()*a1.size(),
+             1.0, odata_sorted.get(), x0.size()*x1.size());
     }
   }
-  sort_indices<0,1,3,2,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x3.size());
+  sort_indices<0,1,3,2,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), x2.size(), x3.size());
   out()->put_block(odata, x0, x1, x3, x2);
 }
 
@@ -340,8 +340,8 @@ void Task913::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x2, c2, a1, x3);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, c2, x2);
-    sort_indices<3,2,1,0,1,1,-1,1>(i0data, odata, x3.size(), a1.size(), c2.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x3, a1, c2, x2);
+    sort_indices<3,2,1,0,1,1,-1,1>(i0data, odata.get(), x3.size(), a1.size(), c2.size(), x2.size());
   }
   out()->put_block(odata, x2, c2, a1, x3);
 }
@@ -350,7 +350,7 @@ void Task914::Task_local::compute() {
   const Index ci0 = b(0);
   // tensor label: I768
   std::unique_ptr<double[]> odata = out()->move_block(ci0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(ci0)]);
+  BlockBuffer odata_sorted(out()->get_size(ci0));
   std::fill_n(odata_sorted.get(), out()->get_size(ci0), 0.0);
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
@@ -359,23 +359,23 @@ void Task914::Task_local::compute() {
           for (auto& x2 : *range_[1]) {
             for (auto& x0 : *range_[1]) {
               // tensor label: Gamma298
-              std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x5, x4, x1, x3, x2, x0);
-              std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(ci0, x5, x4, x1, x3, x2, x0)]);
-              sort_indices<1,2,3,4,5,6,0,0,1,1,1>(i0data, i0data_sorted, ci0.size(), x5.size(), x4.size(), x1.size(), x3.size(), x2.size(), x0.size());
+              const double* i0data = in(0)->get_block_view(ci0, x5, x4, x1, x3, x2, x0);
+              BlockBuffer i0data_sorted(in(0)->get_size(ci0, x5, x4, x1, x3, x2, x0));
+              sort_indices<1,2,3,4,5,6,0,0,1,1,1>(i0data, i0data_sorted.get(), ci0.size(), x5.size(), x4.size(), x1.size(), x3.size(), x2.size(), x0.size());
               // tensor label: I877
-              std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, x2, x5, x4, x3);
-              std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, x2, x5, x4, x3)]);
-              sort_indices<3,4,0,5,2,1,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), x2.size(), x5.size(), x4.size(), x3.size());
+              const double* i1data = in(1)->get_block_view(x1, x0, x2, x5, x4, x3);
+              BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, x2, x5, x4, x3));
+              sort_indices<3,4,0,5,2,1,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), x2.size(), x5.size(), x4.size(), x3.size());
               dgemm_("T", "N", ci0.size(), 1, x1.size()*x0.size()*x2.size()*x5.size()*x4.size()*x3.size(),
-                     1.0, i0data_sorted, x1.size()*x0.size()*x2.size()*x5.size()*x4.size()*x3.size(), i1data_sorted, x1.size()*x0.size()*x2.size()*x5.size()*x4.size()*x3.size(),
-                     1.0, odata_sorted, ci0.size());
+                     1.0, i0data_sorted.get(), x1.size()*x0.size()*x2.size()*x5.size()*x4.size()*x3.size(), i1data_sorted.get(), x1.size()*x0.size()*x2.size()*x5.size()*x4.size()*x3.size(),
+                     1.0, odata_sorted.get(), ci0.size());
             }
           }
         }
       }
     }
   }
-  sort_indices<0,1,1,1,1>(odata_sorted, odata, ci0.size());
+  sort_indices<0,1,1,1,1>(odata_sorted.get(), odata.get(), ci0.size());
   out()->put_block(odata, ci0);
 }
 
@@ -388,22 +388,22 @@ void Task915::Task_local::compute() {
   const Index x3 = b(5);
   // tensor label: I877
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x2, x5, x4, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x2, x5, x4, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x2, x5, x4, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x2, x5, x4, x3), 0.0);
   for (auto& c2 : *range_[0]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, c2, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, c2, x3)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), c2.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(x5, x4, c2, x3);
+    BlockBuffer i0data_sorted(in(0)->get_size(x5, x4, c2, x3));
+    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), x4.size(), c2.size(), x3.size());
     // tensor label: I878
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c2, x0, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c2, x0, x2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), c2.size(), x0.size(), x2.size());
+    const double* i1data = in(1)->get_block_view(x1, c2, x0, x2);
+    BlockBuffer i1data_sorted(in(1)->get_size(x1, c2, x0, x2));
+    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), c2.size(), x0.size(), x2.size());
     dgemm_("T", "N", x5.size()*x4.size()*x3.size(), x1.size()*x0.size()*x2.size(), c2.size(),
-           1.0, i0data_sorted, c2.size(), i1data_sorted, c2.size(),
-           1.0, odata_sorted, x5.size()*x4.size()*x3.size());
+           1.0, i0data_sorted.get(), c2.size(), i1data_sorted.get(), c2.size(),
+           1.0, odata_sorted.get(), x5.size()*x4.size()*x3.size());
   }
-  sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), x1.size(), x0.size(), x2.size());
+  sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x5.size(), x4.size(), x3.size(), x1.size(), x0.size(), x2.size());
   out()->put_block(odata, x1, x0, x2, x5, x4, x3);
 }
 
@@ -414,22 +414,22 @@ void Task916::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I878
   std::unique_ptr<double[]> odata = out()->move_block(x1, c2, x0, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, c2, x0, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, c2, x0, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, c2, x0, x2), 0.0);
   for (auto& a1 : *range_[2]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x2, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, a1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x2.size(), a1.size());
+    const double* i0data = in(0)->get_block_view(x2, a1);
+    BlockBuffer i0data_sorted(in(0)->get_size(x2, a1));
+    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted.get(), x2.size(), a1.size());
     // tensor label: I879
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c2, a1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c2, a1, x0)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), c2.size(), a1.size(), x0.size());
+    const double* i1data = in(1)->get_block_view(x1, c2, a1, x0);
+    BlockBuffer i1data_sorted(in(1)->get_size(x1, c2, a1, x0));
+    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), c2.size(), a1.size(), x0.size());
     dgemm_("T", "N", x2.size(), x1.size()*c2.size()*x0.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, x2.size());
+           1.0, i0data_sorted.get(), a1.size(), i1data_sorted.get(), a1.size(),
+           1.0, odata_sorted.get(), x2.size());
   }
-  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size(), c2.size(), x0.size());
+  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted.get(), odata.get(), x2.size(), x1.size(), c2.size(), x0.size());
   out()->put_block(odata, x1, c2, x0, x2);
 }
 
@@ -442,8 +442,8 @@ void Task917::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata, x0.size(), a1.size(), c2.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, x1);
+    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), x1.size());
   }
   out()->put_block(odata, x1, c2, a1, x0);
 }
@@ -452,28 +452,28 @@ void Task918::Task_local::compute() {
   const Index ci0 = b(0);
   // tensor label: I768
   std::unique_ptr<double[]> odata = out()->move_block(ci0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(ci0)]);
+  BlockBuffer odata_sorted(out()->get_size(ci0));
   std::fill_n(odata_sorted.get(), out()->get_size(ci0), 0.0);
   for (auto& x1 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         for (auto& x0 : *range_[1]) {
           // tensor label: Gamma299
-          std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x1, x3, x2, x0);
-          std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(ci0, x1, x3, x2, x0)]);
-          sort_indices<1,2,3,4,0,0,1,1,1>(i0data, i0data_sorted, ci0.size(), x1.size(), x3.size(), x2.size(), x0.size());
+          const double* i0data = in(0)->get_block_view(ci0, x1, x3, x2, x0);
+          BlockBuffer i0data_sorted(in(0)->get_size(ci0, x1, x3, x2, x0));
+          sort_indices<1,2,3,4,0,0,1,1,1>(i0data, i0data_sorted.get(), ci0.size(), x1.size(), x3.size(), x2.size(), x0.size());
           // tensor label: I881
-          std::unique_ptr<double[]> i1data = in(1)->get_block(x2, x3, x1, x0);
-          std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, x3, x1, x0)]);
-          sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, x2.size(), x3.size(), x1.size(), x0.size());
+          const double* i1data = in(1)->get_block_view(x2, x3, x1, x0);
+          BlockBuffer i1data_sorted(in(1)->get_size(x2, x3, x1, x0));
+          sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), x3.size(), x1.size(), x0.size());
           dgemm_("T", "N", ci0.size(), 1, x2.size()*x3.size()*x1.size()*x0.size(),
-                 1.0, i0data_sorted, x2.size()*x3.size()*x1.size()*x0.size(), i1data_sorted, x2.size()*x3.size()*x1.size()*x0.size(),
-                 1.0, odata_sorted, ci0.size());
+                 1.0, i0data_sorted.get(), x2.size()*x3.size()*x1.size()*x0.size(), i1data_sorted.get(), x2.size()*x3.size()*x1.size()*x0.size(),
+                 1.0, odata_sorted.get(), ci0.size());
         }
       }
     }
   }
-  sort_indices<0,1,1,1,1>(odata_sorted, odata, ci0.size());
+  sort_indices<0,1,1,1,1>(odata_sorted.get(), odata.get(), ci0.size());
   out()->put_block(odata, ci0);
 }
 
@@ -484,24 +484,24 @@ void Task919::Task_local::compute() {
   const Index x0 = b(3);
   // tensor label: I881
   std::unique_ptr<double[]> odata = out()->move_block(x2, x3, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x3, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x2, x3, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x3, x1, x0), 0.0);
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, x1)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
+      const double* i0data = in(0)->get_block_view(x0, a1, c2, x1);
+      BlockBuffer i0data_sorted(in(0)->get_size(x0, a1, c2, x1));
+      sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), a1.size(), c2.size(), x1.size());
       // tensor label: I882
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x2, a1, c2, x3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, a1, c2, x3)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, x2.size(), a1.size(), c2.size(), x3.size());
+      const double* i1data = in(1)->get_block_view(x2, a1, c2, x3);
+      BlockBuffer i1data_sorted(in(1)->get_size(x2, a1, c2, x3));
+      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), a1.size(), c2.size(), x3.size());
       dgemm_("T", "N", x1.size()*x0.size(), x2.size()*x3.size(), a1.size()*c2.size(),
-             1.0, i0data_sorted, a1.size()*c2.size(), i1data_sorted, a1.size()*c2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+             1.0, i0data_sorted.get(), a1.size()*c2.size(), i1data_sorted.get(), a1.size()*c2.size(),
+             1.0, odata_sorted.get(), x1.size()*x0.size());
     }
   }
-  sort_indices<2,3,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x3.size());
+  sort_indices<2,3,1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), x2.size(), x3.size());
   out()->put_block(odata, x2, x3, x1, x0);
 }
 
@@ -512,22 +512,22 @@ void Task920::Task_local::compute() {
   const Index x3 = b(3);
   // tensor label: I882
   std::unique_ptr<double[]> odata = out()->move_block(x2, a1, c2, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, a1, c2, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(x2, a1, c2, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(x2, a1, c2, x3), 0.0);
   for (auto& c3 : *range_[0]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a1, c2, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a1, c2, x3)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c3.size(), a1.size(), c2.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(c3, a1, c2, x3);
+    BlockBuffer i0data_sorted(in(0)->get_size(c3, a1, c2, x3));
+    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c3.size(), a1.size(), c2.size(), x3.size());
     // tensor label: I883
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c3)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, x2.size(), c3.size());
+    const double* i1data = in(1)->get_block_view(x2, c3);
+    BlockBuffer i1data_sorted(in(1)->get_size(x2, c3));
+    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), c3.size());
     dgemm_("T", "N", a1.size()*c2.size()*x3.size(), x2.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, a1.size()*c2.size()*x3.size());
+           1.0, i0data_sorted.get(), c3.size(), i1data_sorted.get(), c3.size(),
+           1.0, odata_sorted.get(), a1.size()*c2.size()*x3.size());
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, a1.size(), c2.size(), x3.size(), x2.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), a1.size(), c2.size(), x3.size(), x2.size());
   out()->put_block(odata, x2, a1, c2, x3);
 }
 
@@ -538,8 +538,8 @@ void Task921::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x2, c3);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x2, c3);
-    sort_indices<0,1,1,1,2,1>(i0data, odata, x2.size(), c3.size());
+    const double* i0data = in(0)->get_block_view(x2, c3);
+    sort_indices<0,1,1,1,2,1>(i0data, odata.get(), x2.size(), c3.size());
   }
   out()->put_block(odata, x2, c3);
 }
@@ -551,24 +551,24 @@ void Task922::Task_local::compute() {
   const Index x0 = b(3);
   // tensor label: I881
   std::unique_ptr<double[]> odata = out()->move_block(x2, x3, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x3, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x2, x3, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x3, x1, x0), 0.0);
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: v2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c2, x3, x2, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, x3, x2, a1)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, c2.size(), x3.size(), x2.size(), a1.size());
+      const double* i0data = in(0)->get_block_view(c2, x3, x2, a1);
+      BlockBuffer i0data_sorted(in(0)->get_size(c2, x3, x2, a1));
+      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted.get(), c2.size(), x3.size(), x2.size(), a1.size());
       // tensor label: I1186
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c2, a1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c2, a1, x0)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), c2.size(), a1.size(), x0.size());
+      const double* i1data = in(1)->get_block_view(x1, c2, a1, x0);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, c2, a1, x0));
+      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), c2.size(), a1.size(), x0.size());
       dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), c2.size()*a1.size(), i1data_sorted.get(), c2.size()*a1.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<1,0,2,3,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<1,0,2,3,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x2, x3, x1, x0);
 }
 
@@ -581,8 +581,8 @@ void Task923::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-    sort_indices<3,2,1,0,1,1,-1,1>(i0data, odata, x0.size(), a1.size(), c2.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, x1);
+    sort_indices<3,2,1,0,1,1,-1,1>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), x1.size());
   }
   out()->put_block(odata, x1, c2, a1, x0);
 }
@@ -591,28 +591,28 @@ void Task924::Task_local::compute() {
   const Index ci0 = b(0);
   // tensor label: I768
   std::unique_ptr<double[]> odata = out()->move_block(ci0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(ci0)]);
+  BlockBuffer odata_sorted(out()->get_size(ci0));
   std::fill_n(odata_sorted.get(), out()->get_size(ci0), 0.0);
   for (auto& x5 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         for (auto& x4 : *range_[1]) {
           // tensor label: Gamma301
-          std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x5, x0, x1, x4);
-          std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(ci0, x5, x0, x1, x4)]);
-          sort_indices<1,2,3,4,0,0,1,1,1>(i0data, i0data_sorted, ci0.size(), x5.size(), x0.size(), x1.size(), x4.size());
+          const double* i0data = in(0)->get_block_view(ci0, x5, x0, x1, x4);
+          BlockBuffer i0data_sorted(in(0)->get_size(ci0, x5, x0, x1, x4));
+          sort_indices<1,2,3,4,0,0,1,1,1>(i0data, i0data_sorted.get(), ci0.size(), x5.size(), x0.size(), x1.size(), x4.size());
           // tensor label: I889
-          std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, x5, x4);
-          std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, x5, x4)]);
-          sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), x5.size(), x4.size());
+          const double* i1data = in(1)->get_block_view(x1, x0, x5, x4);
+          BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, x5, x4));
+          sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), x5.size(), x4.size());
           dgemm_("T", "N", ci0.size(), 1, x1.size()*x0.size()*x5.size()*x4.size(),
-                 1.0, i0data_sorted, x1.size()*x0.size()*x5.size()*x4.size(), i1data_sorted, x1.size()*x0.size()*x5.size()*x4.size(),
-                 1.0, odata_sorted, ci0.size());
+                 1.0, i0data_sorted.get(), x1.size()*x0.size()*x5.size()*x4.size(), i1data_sorted.get(), x1.size()*x0.size()*x5.size()*x4.size(),
+                 1.0, odata_sorted.get(), ci0.size());
         }
       }
     }
   }
-  sort_indices<0,1,1,1,1>(odata_sorted, odata, ci0.size());
+  sort_indices<0,1,1,1,1>(odata_sorted.get(), odata.get(), ci0.size());
   out()->put_block(odata, ci0);
 }
 
@@ -623,24 +623,24 @@ void Task925::Task_local::compute() {
   const Index x4 = b(3);
   // tensor label: I889
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x5, x4);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x5, x4)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x5, x4));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x5, x4), 0.0);
   for (auto& a1 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, c2, x4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a1, c2, x4)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), a1.size(), c2.size(), x4.size());
+      const double* i0data = in(0)->get_block_view(x5, a1, c2, x4);
+      BlockBuffer i0data_sorted(in(0)->get_size(x5, a1, c2, x4));
+      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), a1.size(), c2.size(), x4.size());
       // tensor label: I890
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c2, a1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c2, a1, x0)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), c2.size(), a1.size(), x0.size());
+      const double* i1data = in(1)->get_block_view(x1, c2, a1, x0);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, c2, a1, x0));
+      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), c2.size(), a1.size(), x0.size());
       dgemm_("T", "N", x5.size()*x4.size(), x1.size()*x0.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, x5.size()*x4.size());
+             1.0, i0data_sorted.get(), c2.size()*a1.size(), i1data_sorted.get(), c2.size()*a1.size(),
+             1.0, odata_sorted.get(), x5.size()*x4.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x1.size(), x0.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x5.size(), x4.size(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0, x5, x4);
 }
 
@@ -653,8 +653,8 @@ void Task926::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata, x0.size(), a1.size(), c2.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, x1);
+    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), x1.size());
   }
   out()->put_block(odata, x1, c2, a1, x0);
 }
@@ -663,28 +663,28 @@ void Task927::Task_local::compute() {
   const Index ci0 = b(0);
   // tensor label: I768
   std::unique_ptr<double[]> odata = out()->move_block(ci0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(ci0)]);
+  BlockBuffer odata_sorted(out()->get_size(ci0));
   std::fill_n(odata_sorted.get(), out()->get_size(ci0), 0.0);
   for (auto& x3 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         for (auto& x2 : *range_[1]) {
           // tensor label: Gamma302
-          std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x3, x0, x1, x2);
-          std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(ci0, x3, x0, x1, x2)]);
-          sort_indices<1,2,3,4,0,0,1,1,1>(i0data, i0data_sorted, ci0.size(), x3.size(), x0.size(), x1.size(), x2.size());
+          const double* i0data = in(0)->get_block_view(ci0, x3, x0, x1, x2);
+          BlockBuffer i0data_sorted(in(0)->get_size(ci0, x3, x0, x1, x2));
+          sort_indices<1,2,3,4,0,0,1,1,1>(i0data, i0data_sorted.get(), ci0.size(), x3.size(), x0.size(), x1.size(), x2.size());
           // tensor label: I892
-          std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, x3, x2);
-          std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, x3, x2)]);
-          sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), x3.size(), x2.size());
+          const double* i1data = in(1)->get_block_view(x1, x0, x3, x2);
+          BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, x3, x2));
+          sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), x3.size(), x2.size());
           dgemm_("T", "N", ci0.size(), 1, x1.size()*x0.size()*x3.size()*x2.size(),
-                 1.0, i0data_sorted, x1.size()*x0.size()*x3.size()*x2.size(), i1data_sorted, x1.size()*x0.size()*x3.size()*x2.size(),
-                 1.0, odata_sorted, ci0.size());
+                 1.0, i0data_sorted.get(), x1.size()*x0.size()*x3.size()*x2.size(), i1data_sorted.get(), x1.size()*x0.size()*x3.size()*x2.size(),
+                 1.0, odata_sorted.get(), ci0.size());
         }
       }
     }
   }
-  sort_indices<0,1,1,1,1>(odata_sorted, odata, ci0.size());
+  sort_indices<0,1,1,1,1>(odata_sorted.get(), odata.get(), ci0.size());
   out()->put_block(odata, ci0);
 }
 
@@ -695,24 +695,24 @@ void Task928::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I892
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   for (auto& a1 : *range_[2]) {
     for (auto& c3 : *range_[0]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, c3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, c3, x2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), c3.size(), x2.size());
+      const double* i0data = in(0)->get_block_view(x3, a1, c3, x2);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, a1, c3, x2));
+      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a1.size(), c3.size(), x2.size());
       // tensor label: I893
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a1, x0, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a1, x0, c3)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i1data, i1data_sorted, x1.size(), a1.size(), x0.size(), c3.size());
+      const double* i1data = in(1)->get_block_view(x1, a1, x0, c3);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, a1, x0, c3));
+      sort_indices<1,3,0,2,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), a1.size(), x0.size(), c3.size());
       dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), a1.size()*c3.size(),
-             1.0, i0data_sorted, a1.size()*c3.size(), i1data_sorted, a1.size()*c3.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), a1.size()*c3.size(), i1data_sorted.get(), a1.size()*c3.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0, x3, x2);
 }
 
@@ -723,22 +723,22 @@ void Task929::Task_local::compute() {
   const Index c3 = b(3);
   // tensor label: I893
   std::unique_ptr<double[]> odata = out()->move_block(x1, a1, x0, c3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, a1, x0, c3)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, a1, x0, c3));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, a1, x0, c3), 0.0);
   for (auto& c2 : *range_[0]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c2, c3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, c3)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), c3.size());
+    const double* i0data = in(0)->get_block_view(c2, c3);
+    BlockBuffer i0data_sorted(in(0)->get_size(c2, c3));
+    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), c2.size(), c3.size());
     // tensor label: I894
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c2, a1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c2, a1, x0)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), c2.size(), a1.size(), x0.size());
+    const double* i1data = in(1)->get_block_view(x1, c2, a1, x0);
+    BlockBuffer i1data_sorted(in(1)->get_size(x1, c2, a1, x0));
+    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), c2.size(), a1.size(), x0.size());
     dgemm_("T", "N", c3.size(), x1.size()*a1.size()*x0.size(), c2.size(),
-           1.0, i0data_sorted, c2.size(), i1data_sorted, c2.size(),
-           1.0, odata_sorted, c3.size());
+           1.0, i0data_sorted.get(), c2.size(), i1data_sorted.get(), c2.size(),
+           1.0, odata_sorted.get(), c3.size());
   }
-  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, c3.size(), x1.size(), a1.size(), x0.size());
+  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted.get(), odata.get(), c3.size(), x1.size(), a1.size(), x0.size());
   out()->put_block(odata, x1, a1, x0, c3);
 }
 
@@ -751,8 +751,8 @@ void Task930::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata, x0.size(), a1.size(), c2.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, x1);
+    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), x1.size());
   }
   out()->put_block(odata, x1, c2, a1, x0);
 }
@@ -764,24 +764,24 @@ void Task931::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I892
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   for (auto& a3 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a3, c2, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a3, c2, x2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a3.size(), c2.size(), x2.size());
+      const double* i0data = in(0)->get_block_view(x3, a3, c2, x2);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, a3, c2, x2));
+      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a3.size(), c2.size(), x2.size());
       // tensor label: I897
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c2, x0, a3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c2, x0, a3)]);
-      sort_indices<3,1,0,2,0,1,1,1>(i1data, i1data_sorted, x1.size(), c2.size(), x0.size(), a3.size());
+      const double* i1data = in(1)->get_block_view(x1, c2, x0, a3);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, c2, x0, a3));
+      sort_indices<3,1,0,2,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), c2.size(), x0.size(), a3.size());
       dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), c2.size()*a3.size(),
-             1.0, i0data_sorted, c2.size()*a3.size(), i1data_sorted, c2.size()*a3.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), c2.size()*a3.size(), i1data_sorted.get(), c2.size()*a3.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0, x3, x2);
 }
 
@@ -792,22 +792,22 @@ void Task932::Task_local::compute() {
   const Index a3 = b(3);
   // tensor label: I897
   std::unique_ptr<double[]> odata = out()->move_block(x1, c2, x0, a3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, c2, x0, a3)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, c2, x0, a3));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, c2, x0, a3), 0.0);
   for (auto& a1 : *range_[2]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a3, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a3, a1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, a3.size(), a1.size());
+    const double* i0data = in(0)->get_block_view(a3, a1);
+    BlockBuffer i0data_sorted(in(0)->get_size(a3, a1));
+    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted.get(), a3.size(), a1.size());
     // tensor label: I898
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c2, a1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c2, a1, x0)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), c2.size(), a1.size(), x0.size());
+    const double* i1data = in(1)->get_block_view(x1, c2, a1, x0);
+    BlockBuffer i1data_sorted(in(1)->get_size(x1, c2, a1, x0));
+    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), c2.size(), a1.size(), x0.size());
     dgemm_("T", "N", a3.size(), x1.size()*c2.size()*x0.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, a3.size());
+           1.0, i0data_sorted.get(), a1.size(), i1data_sorted.get(), a1.size(),
+           1.0, odata_sorted.get(), a3.size());
   }
-  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a3.size(), x1.size(), c2.size(), x0.size());
+  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted.get(), odata.get(), a3.size(), x1.size(), c2.size(), x0.size());
   out()->put_block(odata, x1, c2, x0, a3);
 }
 
@@ -820,8 +820,8 @@ void Task933::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata, x0.size(), a1.size(), c2.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, x1);
+    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), x1.size());
   }
   out()->put_block(odata, x1, c2, a1, x0);
 }
@@ -833,24 +833,24 @@ void Task934::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I892
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, x1)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
+      const double* i0data = in(0)->get_block_view(x0, a1, c2, x1);
+      BlockBuffer i0data_sorted(in(0)->get_size(x0, a1, c2, x1));
+      sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), a1.size(), c2.size(), x1.size());
       // tensor label: I928
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x2, x3, a1, c2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, x3, a1, c2)]);
-      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted, x2.size(), x3.size(), a1.size(), c2.size());
+      const double* i1data = in(1)->get_block_view(x2, x3, a1, c2);
+      BlockBuffer i1data_sorted(in(1)->get_size(x2, x3, a1, c2));
+      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), x3.size(), a1.size(), c2.size());
       dgemm_("T", "N", x1.size()*x0.size(), x2.size()*x3.size(), a1.size()*c2.size(),
-             1.0, i0data_sorted, a1.size()*c2.size(), i1data_sorted, a1.size()*c2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+             1.0, i0data_sorted.get(), a1.size()*c2.size(), i1data_sorted.get(), a1.size()*c2.size(),
+             1.0, odata_sorted.get(), x1.size()*x0.size());
     }
   }
-  sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x3.size());
+  sort_indices<1,0,3,2,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), x2.size(), x3.size());
   out()->put_block(odata, x1, x0, x3, x2);
 }
 
@@ -861,22 +861,22 @@ void Task935::Task_local::compute() {
   const Index c2 = b(3);
   // tensor label: I928
   std::unique_ptr<double[]> odata = out()->move_block(x2, x3, a1, c2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x3, a1, c2)]);
+  BlockBuffer odata_sorted(out()->get_size(x2, x3, a1, c2));
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x3, a1, c2), 0.0);
   for (auto& a3 : *range_[2]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, c2, a3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, c2, a3)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), c2.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(x3, a1, c2, a3);
+    BlockBuffer i0data_sorted(in(0)->get_size(x3, a1, c2, a3));
+    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a1.size(), c2.size(), a3.size());
     // tensor label: I929
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x2)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a3.size(), x2.size());
+    const double* i1data = in(1)->get_block_view(a3, x2);
+    BlockBuffer i1data_sorted(in(1)->get_size(a3, x2));
+    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), x2.size());
     dgemm_("T", "N", x3.size()*a1.size()*c2.size(), x2.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, x3.size()*a1.size()*c2.size());
+           1.0, i0data_sorted.get(), a3.size(), i1data_sorted.get(), a3.size(),
+           1.0, odata_sorted.get(), x3.size()*a1.size()*c2.size());
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x3.size(), a1.size(), c2.size(), x2.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), a1.size(), c2.size(), x2.size());
   out()->put_block(odata, x2, x3, a1, c2);
 }
 
@@ -887,8 +887,8 @@ void Task936::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, x2);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a3, x2);
-    sort_indices<0,1,1,1,2,1>(i0data, odata, a3.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(a3, x2);
+    sort_indices<0,1,1,1,2,1>(i0data, odata.get(), a3.size(), x2.size());
   }
   out()->put_block(odata, a3, x2);
 }
@@ -900,24 +900,24 @@ void Task937::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I892
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   for (auto& a1 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, c2, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, c2, x2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), c2.size(), x2.size());
+      const double* i0data = in(0)->get_block_view(x3, a1, c2, x2);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, a1, c2, x2));
+      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a1.size(), c2.size(), x2.size());
       // tensor label: I1055
-      std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x0, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x0, x1)]);
-      sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x0.size(), x1.size());
+      const double* i1data = in(1)->get_block_view(c2, a1, x0, x1);
+      BlockBuffer i1data_sorted(in(1)->get_size(c2, a1, x0, x1));
+      sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted.get(), c2.size(), a1.size(), x0.size(), x1.size());
       dgemm_("T", "N", x3.size()*x2.size(), x0.size()*x1.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), c2.size()*a1.size(), i1data_sorted.get(), c2.size()*a1.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x0.size(), x1.size());
+  sort_indices<3,2,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x0.size(), x1.size());
   out()->put_block(odata, x1, x0, x3, x2);
 }
 
@@ -932,7 +932,7 @@ void Task938::Task_local::compute() {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
     dscal_(x1.size()*c2.size()*a1.size()*x0.size(), e0_, i0data.get(), 1);
-    sort_indices<2,1,0,3,1,1,-2,1>(i0data, odata, x0.size(), a1.size(), c2.size(), x1.size());
+    sort_indices<2,1,0,3,1,1,-2,1>(i0data.get(), odata.get(), x0.size(), a1.size(), c2.size(), x1.size());
   }
   out()->put_block(odata, c2, a1, x0, x1);
 }
@@ -944,22 +944,22 @@ void Task939::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I1055
   std::unique_ptr<double[]> odata = out()->move_block(c2, a1, x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1, x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(c2, a1, x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1, x0, x1), 0.0);
   for (auto& a3 : *range_[2]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a3)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(x1, a3);
+    BlockBuffer i0data_sorted(in(0)->get_size(x1, a3));
+    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), a3.size());
     // tensor label: I1056
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, a1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, a1, x0)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), a1.size(), x0.size());
+    const double* i1data = in(1)->get_block_view(a3, c2, a1, x0);
+    BlockBuffer i1data_sorted(in(1)->get_size(a3, c2, a1, x0));
+    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), c2.size(), a1.size(), x0.size());
     dgemm_("T", "N", x1.size(), c2.size()*a1.size()*x0.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, x1.size());
+           1.0, i0data_sorted.get(), a3.size(), i1data_sorted.get(), a3.size(),
+           1.0, odata_sorted.get(), x1.size());
   }
-  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x1.size(), c2.size(), a1.size(), x0.size());
+  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), c2.size(), a1.size(), x0.size());
   out()->put_block(odata, c2, a1, x0, x1);
 }
 
@@ -972,8 +972,8 @@ void Task940::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata, x0.size(), a1.size(), c2.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, a3);
+    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), a3.size());
   }
   out()->put_block(odata, a3, c2, a1, x0);
 }
@@ -985,24 +985,24 @@ void Task941::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I892
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   for (auto& a1 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       // tensor label: v2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, c2, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, c2, x2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), c2.size(), x2.size());
+      const double* i0data = in(0)->get_block_view(x3, a1, c2, x2);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, a1, c2, x2));
+      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a1.size(), c2.size(), x2.size());
       // tensor label: I1189
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c2, a1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c2, a1, x0)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), c2.size(), a1.size(), x0.size());
+      const double* i1data = in(1)->get_block_view(x1, c2, a1, x0);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, c2, a1, x0));
+      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), c2.size(), a1.size(), x0.size());
       dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), c2.size()*a1.size(), i1data_sorted.get(), c2.size()*a1.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0, x3, x2);
 }
 
@@ -1015,8 +1015,8 @@ void Task942::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata, x0.size(), a1.size(), c2.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, x1);
+    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), x1.size());
   }
   out()->put_block(odata, x1, c2, a1, x0);
 }
@@ -1028,24 +1028,24 @@ void Task943::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I892
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   for (auto& a1 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       // tensor label: v2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, x1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
+      const double* i0data = in(0)->get_block_view(x0, a1, c2, x1);
+      BlockBuffer i0data_sorted(in(0)->get_size(x0, a1, c2, x1));
+      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), a1.size(), c2.size(), x1.size());
       // tensor label: I1243
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c2, a1, x3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c2, a1, x3)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, x2.size(), c2.size(), a1.size(), x3.size());
+      const double* i1data = in(1)->get_block_view(x2, c2, a1, x3);
+      BlockBuffer i1data_sorted(in(1)->get_size(x2, c2, a1, x3));
+      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), c2.size(), a1.size(), x3.size());
       dgemm_("T", "N", x0.size()*x1.size(), x2.size()*x3.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+             1.0, i0data_sorted.get(), c2.size()*a1.size(), i1data_sorted.get(), c2.size()*a1.size(),
+             1.0, odata_sorted.get(), x0.size()*x1.size());
     }
   }
-  sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x3.size());
+  sort_indices<1,0,3,2,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), x2.size(), x3.size());
   out()->put_block(odata, x1, x0, x3, x2);
 }
 
@@ -1058,8 +1058,8 @@ void Task944::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x2, c2, a1, x3);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, c2, x2);
-    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata, x3.size(), a1.size(), c2.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x3, a1, c2, x2);
+    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata.get(), x3.size(), a1.size(), c2.size(), x2.size());
   }
   out()->put_block(odata, x2, c2, a1, x3);
 }
@@ -1068,28 +1068,28 @@ void Task945::Task_local::compute() {
   const Index ci0 = b(0);
   // tensor label: I768
   std::unique_ptr<double[]> odata = out()->move_block(ci0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(ci0)]);
+  BlockBuffer odata_sorted(out()->get_size(ci0));
   std::fill_n(odata_sorted.get(), out()->get_size(ci0), 0.0);
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         for (auto& x0 : *range_[1]) {
           // tensor label: Gamma304
-          std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x5, x4, x1, x0);
-          std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(ci0, x5, x4, x1, x0)]);
-          sort_indices<1,2,3,4,0,0,1,1,1>(i0data, i0data_sorted, ci0.size(), x5.size(), x4.size(), x1.size(), x0.size());
+          const double* i0data = in(0)->get_block_view(ci0, x5, x4, x1, x0);
+          BlockBuffer i0data_sorted(in(0)->get_size(ci0, x5, x4, x1, x0));
+          sort_indices<1,2,3,4,0,0,1,1,1>(i0data, i0data_sorted.get(), ci0.size(), x5.size(), x4.size(), x1.size(), x0.size());
           // tensor label: I900
-          std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, x5, x4);
-          std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, x5, x4)]);
-          sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), x5.size(), x4.size());
+          const double* i1data = in(1)->get_block_view(x1, x0, x5, x4);
+          BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, x5, x4));
+          sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), x5.size(), x4.size());
           dgemm_("T", "N", ci0.size(), 1, x1.size()*x0.size()*x5.size()*x4.size(),
-                 1.0, i0data_sorted, x1.size()*x0.size()*x5.size()*x4.size(), i1data_sorted, x1.size()*x0.size()*x5.size()*x4.size(),
-                 1.0, odata_sorted, ci0.size());
+                 1.0, i0data_sorted.get(), x1.size()*x0.size()*x5.size()*x4.size(), i1data_sorted.get(), x1.size()*x0.size()*x5.size()*x4.size(),
+                 1.0, odata_sorted.get(), ci0.size());
         }
       }
     }
   }
-  sort_indices<0,1,1,1,1>(odata_sorted, odata, ci0.size());
+  sort_indices<0,1,1,1,1>(odata_sorted.get(), odata.get(), ci0.size());
   out()->put_block(odata, ci0);
 }
 
@@ -1100,24 +1100,24 @@ void Task946::Task_local::compute() {
   const Index x4 = b(3);
   // tensor label: I900
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x5, x4);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x5, x4)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x5, x4));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x5, x4), 0.0);
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, x5, x4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1, x5, x4)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size(), x5.size(), x4.size());
+      const double* i0data = in(0)->get_block_view(c2, a1, x5, x4);
+      BlockBuffer i0data_sorted(in(0)->get_size(c2, a1, x5, x4));
+      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c2.size(), a1.size(), x5.size(), x4.size());
       // tensor label: I901
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c2, a1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c2, a1, x0)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), c2.size(), a1.size(), x0.size());
+      const double* i1data = in(1)->get_block_view(x1, c2, a1, x0);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, c2, a1, x0));
+      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), c2.size(), a1.size(), x0.size());
       dgemm_("T", "N", x5.size()*x4.size(), x1.size()*x0.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, x5.size()*x4.size());
+             1.0, i0data_sorted.get(), c2.size()*a1.size(), i1data_sorted.get(), c2.size()*a1.size(),
+             1.0, odata_sorted.get(), x5.size()*x4.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x1.size(), x0.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x5.size(), x4.size(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0, x5, x4);
 }
 
@@ -1130,8 +1130,8 @@ void Task947::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata, x0.size(), a1.size(), c2.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, x1);
+    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), x1.size());
   }
   out()->put_block(odata, x1, c2, a1, x0);
 }
@@ -1143,24 +1143,24 @@ void Task948::Task_local::compute() {
   const Index x4 = b(3);
   // tensor label: I900
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x5, x4);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x5, x4)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x5, x4));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x5, x4), 0.0);
   for (auto& a2 : *range_[2]) {
     for (auto& c1 : *range_[0]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a2, c1, x4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a2, c1, x4)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), a2.size(), c1.size(), x4.size());
+      const double* i0data = in(0)->get_block_view(x5, a2, c1, x4);
+      BlockBuffer i0data_sorted(in(0)->get_size(x5, a2, c1, x4));
+      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), a2.size(), c1.size(), x4.size());
       // tensor label: I944
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, a2, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, a2, c1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), a2.size(), c1.size());
+      const double* i1data = in(1)->get_block_view(x1, x0, a2, c1);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, a2, c1));
+      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), a2.size(), c1.size());
       dgemm_("T", "N", x5.size()*x4.size(), x1.size()*x0.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x5.size()*x4.size());
+             1.0, i0data_sorted.get(), a2.size()*c1.size(), i1data_sorted.get(), a2.size()*c1.size(),
+             1.0, odata_sorted.get(), x5.size()*x4.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x1.size(), x0.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x5.size(), x4.size(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0, x5, x4);
 }
 
@@ -1173,8 +1173,8 @@ void Task949::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x0, x1);
-    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata, c1.size(), a2.size(), x0.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, x0, x1);
+    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata.get(), c1.size(), a2.size(), x0.size(), x1.size());
   }
   out()->put_block(odata, x1, x0, a2, c1);
 }
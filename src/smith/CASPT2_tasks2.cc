@@ -45,7 +45,7 @@ void Task50::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(ci0, x5, x4, x1, x3, x2, x0);
   {
     if (x2 == x4 && x1 == x3) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x5, x0);
+      const double* i0data = in(0)->get_block_view(ci0, x5, x0);
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
           for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
@@ -62,7 +62,7 @@ void Task50::Task_local::compute() {
   }
   {
     if (x1 == x3) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x5, x4, x2, x0);
+      const double* i0data = in(1)->get_block_view(ci0, x5, x4, x2, x0);
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
           for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
@@ -81,7 +81,7 @@ void Task50::Task_local::compute() {
   }
   {
     if (x2 == x3 && x1 == x4) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x5, x0);
+      const double* i0data = in(0)->get_block_view(ci0, x5, x0);
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
           for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
@@ -98,7 +98,7 @@ void Task50::Task_local::compute() {
   }
   {
     if (x1 == x4) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x5, x3, x2, x0);
+      const double* i0data = in(1)->get_block_view(ci0, x5, x3, x2, x0);
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
           for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
@@ -117,7 +117,7 @@ void Task50::Task_local::compute() {
   }
   {
     if (x2 == x3) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x5, x4, x1, x0);
+      const double* i0data = in(1)->get_block_view(ci0, x5, x4, x1, x0);
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
           for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
@@ -136,7 +136,7 @@ void Task50::Task_local::compute() {
   }
   {
     if (x2 == x4) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x5, x0, x1, x3);
+      const double* i0data = in(1)->get_block_view(ci0, x5, x0, x1, x3);
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
           for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
@@ -154,8 +154,8 @@ void Task50::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(ci0, x5, x4, x1, x3, x2, x0);
-    sort_indices<0,1,2,3,4,5,6,1,1,1,1>(i0data, odata, ci0.size(), x5.size(), x4.size(), x1.size(), x3.size(), x2.size(), x0.size());
+    const double* i0data = in(2)->get_block_view(ci0, x5, x4, x1, x3, x2, x0);
+    sort_indices<0,1,2,3,4,5,6,1,1,1,1>(i0data, odata.get(), ci0.size(), x5.size(), x4.size(), x1.size(), x3.size(), x2.size(), x0.size());
   }
   out()->put_block(odata, ci0, x5, x4, x1, x3, x2, x0);
 }
@@ -170,7 +170,7 @@ void Task51::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(ci0, x1, x3, x2, x0);
   {
     if (x1 == x3) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x2, x0);
+      const double* i0data = in(0)->get_block_view(ci0, x2, x0);
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
           for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
@@ -185,7 +185,7 @@ void Task51::Task_local::compute() {
   }
   {
     if (x2 == x3) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x1, x0);
+      const double* i0data = in(0)->get_block_view(ci0, x1, x0);
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
           for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
@@ -199,8 +199,8 @@ void Task51::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x1, x3, x2, x0);
-    sort_indices<0,1,2,3,4,1,1,1,1>(i0data, odata, ci0.size(), x1.size(), x3.size(), x2.size(), x0.size());
+    const double* i0data = in(1)->get_block_view(ci0, x1, x3, x2, x0);
+    sort_indices<0,1,2,3,4,1,1,1,1>(i0data, odata.get(), ci0.size(), x1.size(), x3.size(), x2.size(), x0.size());
   }
   out()->put_block(odata, ci0, x1, x3, x2, x0);
 }
@@ -216,9 +216,9 @@ void Task52::Task_local::compute() {
   // tensor label: Gamma301
   std::unique_ptr<double[]> odata = out()->move_block(ci0, x5, x0, x1, x4);
   // associated with merged
-  std::unique_ptr<double[]> fdata = in(3)->get_block(x3, x2);
+  const double* fdata = in(3)->get_block_view(x3, x2);
   if (x1 == x4) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x5, x0, x3, x2);
+    const double* i0data = in(1)->get_block_view(ci0, x5, x0, x3, x2);
     for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
       for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
         for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
@@ -235,7 +235,7 @@ void Task52::Task_local::compute() {
     }
   }
   if (x3 == x4 && x1 == x2) {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x5, x0);
+    const double* i0data = in(0)->get_block_view(ci0, x5, x0);
     for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
       for (int ix5 = 0; ix5 != x5.size(); ++ix5) {
         for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
@@ -250,7 +250,7 @@ void Task52::Task_local::compute() {
     }
   }
   if (x1 == x2) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x5, x0, x3, x4);
+    const double* i0data = in(1)->get_block_view(ci0, x5, x0, x3, x4);
     for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
       for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
         for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
@@ -267,7 +267,7 @@ void Task52::Task_local::compute() {
     }
   }
   if (x3 == x4) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x5, x0, x1, x2);
+    const double* i0data = in(1)->get_block_view(ci0, x5, x0, x1, x2);
     for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
       for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
         for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
@@ -284,7 +284,7 @@ void Task52::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(ci0, x5, x0, x1, x4, x3, x2);
+    const double* i0data = in(2)->get_block_view(ci0, x5, x0, x1, x4, x3, x2);
     for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
       for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
         for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
@@ -315,7 +315,7 @@ void Task53::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(ci0, x3, x0, x1, x2);
   {
     if (x1 == x2) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x3, x0);
+      const double* i0data = in(0)->get_block_view(ci0, x3, x0);
       for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
         for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
           for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
@@ -329,8 +329,8 @@ void Task53::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x3, x0, x1, x2);
-    sort_indices<0,1,2,3,4,1,1,-1,1>(i0data, odata, ci0.size(), x3.size(), x0.size(), x1.size(), x2.size());
+    const double* i0data = in(1)->get_block_view(ci0, x3, x0, x1, x2);
+    sort_indices<0,1,2,3,4,1,1,-1,1>(i0data, odata.get(), ci0.size(), x3.size(), x0.size(), x1.size(), x2.size());
   }
   out()->put_block(odata, ci0, x3, x0, x1, x2);
 }
@@ -346,9 +346,9 @@ void Task54::Task_local::compute() {
   // tensor label: Gamma304
   std::unique_ptr<double[]> odata = out()->move_block(ci0, x5, x4, x1, x0);
   // associated with merged
-  std::unique_ptr<double[]> fdata = in(3)->get_block(x3, x2);
+  const double* fdata = in(3)->get_block_view(x3, x2);
   if (x1 == x4) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x5, x0, x3, x2);
+    const double* i0data = in(1)->get_block_view(ci0, x5, x0, x3, x2);
     for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
       for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
         for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
@@ -365,7 +365,7 @@ void Task54::Task_local::compute() {
     }
   }
   if (x3 == x4 && x1 == x2) {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x5, x0);
+    const double* i0data = in(0)->get_block_view(ci0, x5, x0);
     for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
       for (int ix5 = 0; ix5 != x5.size(); ++ix5) {
         for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
@@ -380,7 +380,7 @@ void Task54::Task_local::compute() {
     }
   }
   if (x1 == x2) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x5, x4, x3, x0);
+    const double* i0data = in(1)->get_block_view(ci0, x5, x4, x3, x0);
     for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
       for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
         for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
@@ -397,7 +397,7 @@ void Task54::Task_local::compute() {
     }
   }
   if (x3 == x4) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x5, x2, x1, x0);
+    const double* i0data = in(1)->get_block_view(ci0, x5, x2, x1, x0);
     for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
       for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
         for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
@@ -414,7 +414,7 @@ void Task54::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(ci0, x5, x4, x3, x2, x1, x0);
+    const double* i0data = in(2)->get_block_view(ci0, x5, x4, x3, x2, x1, x0);
     for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
       for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
         for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
@@ -445,7 +445,7 @@ void Task55::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(ci0, x3, x2, x1, x0);
   {
     if (x1 == x2) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x3, x0);
+      const double* i0data = in(0)->get_block_view(ci0, x3, x0);
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
           for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
@@ -459,8 +459,8 @@ void Task55::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x3, x2, x1, x0);
-    sort_indices<0,1,2,3,4,1,1,1,1>(i0data, odata, ci0.size(), x3.size(), x2.size(), x1.size(), x0.size());
+    const double* i0data = in(1)->get_block_view(ci0, x3, x2, x1, x0);
+    sort_indices<0,1,2,3,4,1,1,1,1>(i0data, odata.get(), ci0.size(), x3.size(), x2.size(), x1.size(), x0.size());
   }
   out()->put_block(odata, ci0, x3, x2, x1, x0);
 }
@@ -477,7 +477,7 @@ void Task56::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(ci0, x5, x0, x4, x3, x1, x2);
   {
     if (x1 == x2) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x5, x0, x4, x3);
+      const double* i0data = in(0)->get_block_view(ci0, x5, x0, x4, x3);
       for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
           for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
@@ -496,7 +496,7 @@ void Task56::Task_local::compute() {
   }
   {
     if (x1 == x3) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x5, x0, x4, x2);
+      const double* i0data = in(0)->get_block_view(ci0, x5, x0, x4, x2);
       for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
           for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
@@ -514,8 +514,8 @@ void Task56::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x5, x0, x4, x3, x1, x2);
-    sort_indices<0,1,2,3,4,5,6,1,1,-1,1>(i0data, odata, ci0.size(), x5.size(), x0.size(), x4.size(), x3.size(), x1.size(), x2.size());
+    const double* i0data = in(1)->get_block_view(ci0, x5, x0, x4, x3, x1, x2);
+    sort_indices<0,1,2,3,4,5,6,1,1,-1,1>(i0data, odata.get(), ci0.size(), x5.size(), x0.size(), x4.size(), x3.size(), x1.size(), x2.size());
   }
   out()->put_block(odata, ci0, x5, x0, x4, x3, x1, x2);
 }
@@ -527,8 +527,8 @@ void Task57::Task_local::compute() {
   // tensor label: Gamma308
   std::unique_ptr<double[]> odata = out()->move_block(ci0, x1, x0);
   {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x1, x0);
-    sort_indices<0,1,2,1,1,1,1>(i0data, odata, ci0.size(), x1.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(ci0, x1, x0);
+    sort_indices<0,1,2,1,1,1,1>(i0data, odata.get(), ci0.size(), x1.size(), x0.size());
   }
   out()->put_block(odata, ci0, x1, x0);
 }
@@ -545,7 +545,7 @@ void Task58::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(ci0, x5, x2, x4, x3, x1, x0);
   {
     if (x1 == x2) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x5, x0, x4, x3);
+      const double* i0data = in(0)->get_block_view(ci0, x5, x0, x4, x3);
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
           for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
@@ -564,7 +564,7 @@ void Task58::Task_local::compute() {
   }
   {
     if (x1 == x3) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x5, x2, x4, x0);
+      const double* i0data = in(0)->get_block_view(ci0, x5, x2, x4, x0);
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
           for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
@@ -582,8 +582,8 @@ void Task58::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x5, x2, x4, x3, x1, x0);
-    sort_indices<0,1,2,3,4,5,6,1,1,1,1>(i0data, odata, ci0.size(), x5.size(), x2.size(), x4.size(), x3.size(), x1.size(), x0.size());
+    const double* i0data = in(1)->get_block_view(ci0, x5, x2, x4, x3, x1, x0);
+    sort_indices<0,1,2,3,4,5,6,1,1,1,1>(i0data, odata.get(), ci0.size(), x5.size(), x2.size(), x4.size(), x3.size(), x1.size(), x0.size());
   }
   out()->put_block(odata, ci0, x5, x2, x4, x3, x1, x0);
 }
@@ -600,7 +600,7 @@ void Task59::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(ci0, x5, x0, x3, x4, x2, x1);
   {
     if (x2 == x4) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x5, x0, x3, x1);
+      const double* i0data = in(0)->get_block_view(ci0, x5, x0, x3, x1);
       for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
         for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
           for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
@@ -619,7 +619,7 @@ void Task59::Task_local::compute() {
   }
   {
     if (x3 == x4) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x5, x0, x2, x1);
+      const double* i0data = in(0)->get_block_view(ci0, x5, x0, x2, x1);
       for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
         for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
           for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
@@ -637,8 +637,8 @@ void Task59::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x5, x0, x3, x4, x2, x1);
-    sort_indices<0,1,2,3,4,5,6,1,1,-1,1>(i0data, odata, ci0.size(), x5.size(), x0.size(), x3.size(), x4.size(), x2.size(), x1.size());
+    const double* i0data = in(1)->get_block_view(ci0, x5, x0, x3, x4, x2, x1);
+    sort_indices<0,1,2,3,4,5,6,1,1,-1,1>(i0data, odata.get(), ci0.size(), x5.size(), x0.size(), x3.size(), x4.size(), x2.size(), x1.size());
   }
   out()->put_block(odata, ci0, x5, x0, x3, x4, x2, x1);
 }
@@ -655,7 +655,7 @@ void Task60::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(ci0, x5, x4, x3, x0, x2, x1);
   {
     if (x2 == x4) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x5, x1, x3, x0);
+      const double* i0data = in(0)->get_block_view(ci0, x5, x1, x3, x0);
       for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
         for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
           for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
@@ -674,7 +674,7 @@ void Task60::Task_local::compute() {
   }
   {
     if (x3 == x4) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x5, x0, x2, x1);
+      const double* i0data = in(0)->get_block_view(ci0, x5, x0, x2, x1);
       for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
         for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
           for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
@@ -692,8 +692,8 @@ void Task60::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x5, x4, x3, x0, x2, x1);
-    sort_indices<0,1,2,3,4,5,6,1,1,1,1>(i0data, odata, ci0.size(), x5.size(), x4.size(), x3.size(), x0.size(), x2.size(), x1.size());
+    const double* i0data = in(1)->get_block_view(ci0, x5, x4, x3, x0, x2, x1);
+    sort_indices<0,1,2,3,4,5,6,1,1,1,1>(i0data, odata.get(), ci0.size(), x5.size(), x4.size(), x3.size(), x0.size(), x2.size(), x1.size());
   }
   out()->put_block(odata, ci0, x5, x4, x3, x0, x2, x1);
 }
@@ -711,9 +711,9 @@ void Task61::Task_local::compute() {
   // tensor label: Gamma328
   std::unique_ptr<double[]> odata = out()->move_block(ci0, x7, x0, x6, x5, x2, x1);
   // associated with merged
-  std::unique_ptr<double[]> fdata = in(3)->get_block(x4, x3);
+  const double* fdata = in(3)->get_block_view(x4, x3);
   if (x2 == x5) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x7, x0, x6, x1, x4, x3);
+    const double* i0data = in(1)->get_block_view(ci0, x7, x0, x6, x1, x4, x3);
     for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
       for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
         for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
@@ -734,7 +734,7 @@ void Task61::Task_local::compute() {
     }
   }
   if (x4 == x5 && x2 == x3) {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x7, x0, x6, x1);
+    const double* i0data = in(0)->get_block_view(ci0, x7, x0, x6, x1);
     for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
       for (int ix6 = 0; ix6 != x6.size(); ++ix6) {
         for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
@@ -753,7 +753,7 @@ void Task61::Task_local::compute() {
     }
   }
   if (x2 == x3) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x7, x0, x6, x5, x4, x1);
+    const double* i0data = in(1)->get_block_view(ci0, x7, x0, x6, x5, x4, x1);
     for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
       for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
         for (int ix5 = 0; ix5 != x5.size(); ++ix5) {
@@ -774,7 +774,7 @@ void Task61::Task_local::compute() {
     }
   }
   if (x4 == x5) {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x7, x0, x6, x3, x2, x1);
+    const double* i0data = in(1)->get_block_view(ci0, x7, x0, x6, x3, x2, x1);
     for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
       for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
@@ -795,7 +795,7 @@ void Task61::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(ci0, x7, x0, x6, x5, x2, x1);
+    const double* i0data = in(2)->get_block_view(ci0, x7, x0, x6, x5, x2, x1);
     for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
       for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
         for (int ix5 = 0; ix5 != x5.size(); ++ix5) {
@@ -828,7 +828,7 @@ void Task62::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(ci0, x5, x0, x4, x3, x2, x1);
   {
     if (x2 == x3) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x5, x0, x4, x1);
+      const double* i0data = in(0)->get_block_view(ci0, x5, x0, x4, x1);
       for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
           for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
@@ -846,8 +846,8 @@ void Task62::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x5, x0, x4, x3, x2, x1);
-    sort_indices<0,1,2,3,4,5,6,1,1,1,1>(i0data, odata, ci0.size(), x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
+    const double* i0data = in(1)->get_block_view(ci0, x5, x0, x4, x3, x2, x1);
+    sort_indices<0,1,2,3,4,5,6,1,1,1,1>(i0data, odata.get(), ci0.size(), x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
   }
   out()->put_block(odata, ci0, x5, x0, x4, x3, x2, x1);
 }
@@ -861,8 +861,8 @@ void Task63::Task_local::compute() {
   // tensor label: Gamma330
   std::unique_ptr<double[]> odata = out()->move_block(ci0, x3, x0, x2, x1);
   {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x3, x0, x2, x1);
-    sort_indices<0,1,2,3,4,1,1,1,1>(i0data, odata, ci0.size(), x3.size(), x0.size(), x2.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(ci0, x3, x0, x2, x1);
+    sort_indices<0,1,2,3,4,1,1,1,1>(i0data, odata.get(), ci0.size(), x3.size(), x0.size(), x2.size(), x1.size());
   }
   out()->put_block(odata, ci0, x3, x0, x2, x1);
 }
@@ -874,9 +874,9 @@ void Task64::Task_local::compute() {
   // tensor label: Gamma339
   std::unique_ptr<double[]> odata = out()->move_block(ci0);
   // associated with merged
-  std::unique_ptr<double[]> fdata = in(1)->get_block(x1, x0);
+  const double* fdata = in(1)->get_block_view(x1, x0);
   {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x1, x0);
+    const double* i0data = in(0)->get_block_view(ci0, x1, x0);
     for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
       for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
         for (int ici0 = 0; ici0 != ci0.size(); ++ici0) {
@@ -898,9 +898,9 @@ void Task65::Task_local::compute() {
   // tensor label: Gamma351
   std::unique_ptr<double[]> odata = out()->move_block(ci0, x3, x0);
   // associated with merged
-  std::unique_ptr<double[]> fdata = in(1)->get_block(x2, x1);
+  const double* fdata = in(1)->get_block_view(x2, x1);
   {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x3, x0, x2, x1);
+    const double* i0data = in(0)->get_block_view(ci0, x3, x0, x2, x1);
     for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
       for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
         for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
@@ -928,9 +928,9 @@ void Task66::Task_local::compute() {
   // tensor label: Gamma362
   std::unique_ptr<double[]> odata = out()->move_block(ci0, x5, x0, x4, x1);
   // associated with merged
-  std::unique_ptr<double[]> fdata = in(1)->get_block(x3, x2);
+  const double* fdata = in(1)->get_block_view(x3, x2);
   {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x5, x0, x4, x1, x3, x2);
+    const double* i0data = in(0)->get_block_view(ci0, x5, x0, x4, x1, x3, x2);
     for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
       for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
         for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
@@ -963,7 +963,7 @@ void Task67::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(ci0, x2, x5, x4, x3, x1, x0);
   {
     if (x2 == x5 && x1 == x3) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x4, x0);
+      const double* i0data = in(0)->get_block_view(ci0, x4, x0);
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
           for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
@@ -980,7 +980,7 @@ void Task67::Task_local::compute() {
   }
   {
     if (x2 == x3 && x1 == x5) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x4, x0);
+      const double* i0data = in(0)->get_block_view(ci0, x4, x0);
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
           for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
@@ -997,7 +997,7 @@ void Task67::Task_local::compute() {
   }
   {
     if (x1 == x5) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x4, x3, x2, x0);
+      const double* i0data = in(1)->get_block_view(ci0, x4, x3, x2, x0);
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
           for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
@@ -1016,7 +1016,7 @@ void Task67::Task_local::compute() {
   }
   {
     if (x2 == x5) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x4, x3, x1, x0);
+      const double* i0data = in(1)->get_block_view(ci0, x4, x3, x1, x0);
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
           for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
@@ -1035,7 +1035,7 @@ void Task67::Task_local::compute() {
   }
   {
     if (x4 == x5 && x1 == x3) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x2, x0);
+      const double* i0data = in(0)->get_block_view(ci0, x2, x0);
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
           for (int ix5 = 0; ix5 != x5.size(); ++ix5) {
@@ -1052,7 +1052,7 @@ void Task67::Task_local::compute() {
   }
   {
     if (x1 == x3) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x2, x5, x4, x0);
+      const double* i0data = in(1)->get_block_view(ci0, x2, x5, x4, x0);
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
           for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
@@ -1071,7 +1071,7 @@ void Task67::Task_local::compute() {
   }
   {
     if (x4 == x5 && x2 == x3) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x1, x0);
+      const double* i0data = in(0)->get_block_view(ci0, x1, x0);
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
           for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
@@ -1088,7 +1088,7 @@ void Task67::Task_local::compute() {
   }
   {
     if (x2 == x3) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x4, x5, x1, x0);
+      const double* i0data = in(1)->get_block_view(ci0, x4, x5, x1, x0);
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
           for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
@@ -1107,7 +1107,7 @@ void Task67::Task_local::compute() {
   }
   {
     if (x4 == x5) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x2, x3, x1, x0);
+      const double* i0data = in(1)->get_block_view(ci0, x2, x3, x1, x0);
       for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
         for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
           for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
@@ -1125,8 +1125,8 @@ void Task67::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(ci0, x2, x5, x4, x3, x1, x0);
-    sort_indices<0,1,2,3,4,5,6,1,1,-1,1>(i0data, odata, ci0.size(), x2.size(), x5.size(), x4.size(), x3.size(), x1.size(), x0.size());
+    const double* i0data = in(2)->get_block_view(ci0, x2, x5, x4, x3, x1, x0);
+    sort_indices<0,1,2,3,4,5,6,1,1,-1,1>(i0data, odata.get(), ci0.size(), x2.size(), x5.size(), x4.size(), x3.size(), x1.size(), x0.size());
   }
   out()->put_block(odata, ci0, x2, x5, x4, x3, x1, x0);
 }
@@ -1143,7 +1143,7 @@ void Task68::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(ci0, x5, x4, x0, x3, x2, x1);
   {
     if (x2 == x3 && x0 == x1) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x5, x4);
+      const double* i0data = in(0)->get_block_view(ci0, x5, x4);
       for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
           for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
@@ -1160,7 +1160,7 @@ void Task68::Task_local::compute() {
   }
   {
     if (x2 == x4 && x0 == x1) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x5, x3);
+      const double* i0data = in(0)->get_block_view(ci0, x5, x3);
       for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
           for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
@@ -1177,7 +1177,7 @@ void Task68::Task_local::compute() {
   }
   {
     if (x0 == x1) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x5, x4, x2, x3);
+      const double* i0data = in(1)->get_block_view(ci0, x5, x4, x2, x3);
       for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
         for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
           for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
@@ -1196,7 +1196,7 @@ void Task68::Task_local::compute() {
   }
   {
     if (x2 == x4 && x0 == x3) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x5, x1);
+      const double* i0data = in(0)->get_block_view(ci0, x5, x1);
       for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
           for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
@@ -1213,7 +1213,7 @@ void Task68::Task_local::compute() {
   }
   {
     if (x0 == x3) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x5, x4, x2, x1);
+      const double* i0data = in(1)->get_block_view(ci0, x5, x4, x2, x1);
       for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
         for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
           for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
@@ -1232,7 +1232,7 @@ void Task68::Task_local::compute() {
   }
   {
     if (x2 == x3 && x0 == x4) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x5, x1);
+      const double* i0data = in(0)->get_block_view(ci0, x5, x1);
       for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
           for (int ix4 = 0; ix4 != x4.size(); ++ix4) {
@@ -1249,7 +1249,7 @@ void Task68::Task_local::compute() {
   }
   {
     if (x0 == x4) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x5, x3, x2, x1);
+      const double* i0data = in(1)->get_block_view(ci0, x5, x3, x2, x1);
       for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
         for (int ix2 = 0; ix2 != x2.size(); ++ix2) {
           for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
@@ -1268,7 +1268,7 @@ void Task68::Task_local::compute() {
   }
   {
     if (x2 == x3) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x5, x4, x0, x1);
+      const double* i0data = in(1)->get_block_view(ci0, x5, x4, x0, x1);
       for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
           for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
@@ -1287,7 +1287,7 @@ void Task68::Task_local::compute() {
   }
   {
     if (x2 == x4) {
-      std::unique_ptr<double[]> i0data = in(1)->get_block(ci0, x5, x1, x0, x3);
+      const double* i0data = in(1)->get_block_view(ci0, x5, x1, x0, x3);
       for (int ix1 = 0; ix1 != x1.size(); ++ix1) {
         for (int ix3 = 0; ix3 != x3.size(); ++ix3) {
           for (int ix0 = 0; ix0 != x0.size(); ++ix0) {
@@ -1305,8 +1305,8 @@ void Task68::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(2)->get_block(ci0, x5, x4, x0, x3, x2, x1);
-    sort_indices<0,1,2,3,4,5,6,1,1,-1,1>(i0data, odata, ci0.size(), x5.size(), x4.size(), x0.size(), x3.size(), x2.size(), x1.size());
+    const double* i0data = in(2)->get_block_view(ci0, x5, x4, x0, x3, x2, x1);
+    sort_indices<0,1,2,3,4,5,6,1,1,-1,1>(i0data, odata.get(), ci0.size(), x5.size(), x4.size(), x0.size(), x3.size(), x2.size(), x1.size());
   }
   out()->put_block(odata, ci0, x5, x4, x0, x3, x2, x1);
 }
@@ -1320,8 +1320,8 @@ void Task70::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c2, x1, c1, x0);
   {
     // tensor label: I0
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, c2, x0, x1);
-    sort_indices<1,3,0,2,1,1,1,1>(i0data, odata, c1.size(), c2.size(), x0.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c1, c2, x0, x1);
+    sort_indices<1,3,0,2,1,1,1,1>(i0data, odata.get(), c1.size(), c2.size(), x0.size(), x1.size());
   }
   out()->put_block(odata, c2, x1, c1, x0);
 }
@@ -1333,24 +1333,24 @@ void Task71::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I0
   std::unique_ptr<double[]> odata = out()->move_block(c1, c2, x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c2, x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, c2, x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c2, x0, x1), 0.0);
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       // tensor label: Gamma0
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x5, x1, x4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x5, x1, x4)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x0.size(), x5.size(), x1.size(), x4.size());
+      const double* i0data = in(0)->get_block_view(x0, x5, x1, x4);
+      BlockBuffer i0data_sorted(in(0)->get_size(x0, x5, x1, x4));
+      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), x5.size(), x1.size(), x4.size());
       // tensor label: I1
-      std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x5, c2, x4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x5, c2, x4)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i1data, i1data_sorted, c1.size(), x5.size(), c2.size(), x4.size());
+      const double* i1data = in(1)->get_block_view(c1, x5, c2, x4);
+      BlockBuffer i1data_sorted(in(1)->get_size(c1, x5, c2, x4));
+      sort_indices<1,3,0,2,0,1,1,1>(i1data, i1data_sorted.get(), c1.size(), x5.size(), c2.size(), x4.size());
       dgemm_("T", "N", x0.size()*x1.size(), c1.size()*c2.size(), x5.size()*x4.size(),
-             1.0, i0data_sorted, x5.size()*x4.size(), i1data_sorted, x5.size()*x4.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+             1.0, i0data_sorted.get(), x5.size()*x4.size(), i1data_sorted.get(), x5.size()*x4.size(),
+             1.0, odata_sorted.get(), x0.size()*x1.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), c1.size(), c2.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), c1.size(), c2.size());
   out()->put_block(odata, c1, c2, x0, x1);
 }
 
@@ -1363,8 +1363,8 @@ void Task72::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c1, x5, c2, x4);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x5, c2, x4);
-    sort_indices<0,1,2,3,1,1,2,1>(i0data, odata, c1.size(), x5.size(), c2.size(), x4.size());
+    const double* i0data = in(0)->get_block_view(c1, x5, c2, x4);
+    sort_indices<0,1,2,3,1,1,2,1>(i0data, odata.get(), c1.size(), x5.size(), c2.size(), x4.size());
   }
   out()->put_block(odata, c1, x5, c2, x4);
 }
@@ -1376,24 +1376,24 @@ void Task73::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I0
   std::unique_ptr<double[]> odata = out()->move_block(c1, c2, x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c2, x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, c2, x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c2, x0, x1), 0.0);
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma92
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x3, x1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x3, x1, x2)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x0.size(), x3.size(), x1.size(), x2.size());
+      const double* i0data = in(0)->get_block_view(x0, x3, x1, x2);
+      BlockBuffer i0data_sorted(in(0)->get_size(x0, x3, x1, x2));
+      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), x3.size(), x1.size(), x2.size());
       // tensor label: I265
-      std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x3, c2, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x3, c2, x2)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i1data, i1data_sorted, c1.size(), x3.size(), c2.size(), x2.size());
+      const double* i1data = in(1)->get_block_view(c1, x3, c2, x2);
+      BlockBuffer i1data_sorted(in(1)->get_size(c1, x3, c2, x2));
+      sort_indices<1,3,0,2,0,1,1,1>(i1data, i1data_sorted.get(), c1.size(), x3.size(), c2.size(), x2.size());
       dgemm_("T", "N", x0.size()*x1.size(), c1.size()*c2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+             1.0, i0data_sorted.get(), x3.size()*x2.size(), i1data_sorted.get(), x3.size()*x2.size(),
+             1.0, odata_sorted.get(), x0.size()*x1.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), c1.size(), c2.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), c1.size(), c2.size());
   out()->put_block(odata, c1, c2, x0, x1);
 }
 
@@ -1408,12 +1408,12 @@ void Task74::Task_local::compute() {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x3, c2, x2);
     dscal_(c1.size()*x3.size()*c2.size()*x2.size(), e0_, i0data.get(), 1);
-    sort_indices<0,1,2,3,1,1,-2,1>(i0data, odata, c1.size(), x3.size(), c2.size(), x2.size());
+    sort_indices<0,1,2,3,1,1,-2,1>(i0data.get(), odata.get(), c1.size(), x3.size(), c2.size(), x2.size());
   }
   {
     // tensor label: v2
-    std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x3, c2, x2);
-    sort_indices<0,1,2,3,1,1,1,1>(i1data, odata, c1.size(), x3.size(), c2.size(), x2.size());
+    const double* i1data = in(1)->get_block_view(c1, x3, c2, x2);
+    sort_indices<0,1,2,3,1,1,1,1>(i1data, odata.get(), c1.size(), x3.size(), c2.size(), x2.size());
   }
   out()->put_block(odata, c1, x3, c2, x2);
 }
@@ -1427,13 +1427,13 @@ void Task75::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c2, x1, c1, x0);
   {
     // tensor label: I2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c2, c1, x0, x1);
-    sort_indices<0,3,1,2,1,1,1,1>(i0data, odata, c2.size(), c1.size(), x0.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c2, c1, x0, x1);
+    sort_indices<0,3,1,2,1,1,1,1>(i0data, odata.get(), c2.size(), c1.size(), x0.size(), x1.size());
   }
   {
     // tensor label: I2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, c2, x1, x0);
-    sort_indices<1,2,0,3,1,1,1,1>(i0data, odata, c1.size(), c2.size(), x1.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(c1, c2, x1, x0);
+    sort_indices<1,2,0,3,1,1,1,1>(i0data, odata.get(), c1.size(), c2.size(), x1.size(), x0.size());
   }
   out()->put_block(odata, c2, x1, c1, x0);
 }
@@ -1445,24 +1445,24 @@ void Task76::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I2
   std::unique_ptr<double[]> odata = out()->move_block(c2, c1, x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c1, x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(c2, c1, x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c1, x0, x1), 0.0);
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma92
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x3, x1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x3, x1, x2)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x0.size(), x3.size(), x1.size(), x2.size());
+      const double* i0data = in(0)->get_block_view(x0, x3, x1, x2);
+      BlockBuffer i0data_sorted(in(0)->get_size(x0, x3, x1, x2));
+      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), x3.size(), x1.size(), x2.size());
       // tensor label: I3
-      std::unique_ptr<double[]> i1data = in(1)->get_block(c2, c1, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, c1, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c2.size(), c1.size(), x3.size(), x2.size());
+      const double* i1data = in(1)->get_block_view(c2, c1, x3, x2);
+      BlockBuffer i1data_sorted(in(1)->get_size(c2, c1, x3, x2));
+      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted.get(), c2.size(), c1.size(), x3.size(), x2.size());
       dgemm_("T", "N", x0.size()*x1.size(), c2.size()*c1.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+             1.0, i0data_sorted.get(), x3.size()*x2.size(), i1data_sorted.get(), x3.size()*x2.size(),
+             1.0, odata_sorted.get(), x0.size()*x1.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), c2.size(), c1.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), c2.size(), c1.size());
   out()->put_block(odata, c2, c1, x0, x1);
 }
 
@@ -1473,22 +1473,22 @@ void Task77::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I3
   std::unique_ptr<double[]> odata = out()->move_block(c2, c1, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c1, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(c2, c1, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c1, x3, x2), 0.0);
   for (auto& c3 : *range_[0]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x3, c3, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x3, c3, x2)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), x3.size(), c3.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(c1, x3, c3, x2);
+    BlockBuffer i0data_sorted(in(0)->get_size(c1, x3, c3, x2));
+    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), x3.size(), c3.size(), x2.size());
     // tensor label: I4
-    std::unique_ptr<double[]> i1data = in(1)->get_block(c2, c3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, c3)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, c2.size(), c3.size());
+    const double* i1data = in(1)->get_block_view(c2, c3);
+    BlockBuffer i1data_sorted(in(1)->get_size(c2, c3));
+    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), c2.size(), c3.size());
     dgemm_("T", "N", c1.size()*x3.size()*x2.size(), c2.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, c1.size()*x3.size()*x2.size());
+           1.0, i0data_sorted.get(), c3.size(), i1data_sorted.get(), c3.size(),
+           1.0, odata_sorted.get(), c1.size()*x3.size()*x2.size());
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, c1.size(), x3.size(), x2.size(), c2.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), c1.size(), x3.size(), x2.size(), c2.size());
   out()->put_block(odata, c2, c1, x3, x2);
 }
 
@@ -1499,8 +1499,8 @@ void Task78::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c2, c3);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c2, c3);
-    sort_indices<0,1,1,1,-2,1>(i0data, odata, c2.size(), c3.size());
+    const double* i0data = in(0)->get_block_view(c2, c3);
+    sort_indices<0,1,1,1,-2,1>(i0data, odata.get(), c2.size(), c3.size());
   }
   out()->put_block(odata, c2, c3);
 }
@@ -1512,22 +1512,22 @@ void Task79::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I2
   std::unique_ptr<double[]> odata = out()->move_block(c2, c1, x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c1, x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(c2, c1, x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c1, x0, x1), 0.0);
   for (auto& x2 : *range_[1]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c2, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, x2)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, c2.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(c2, x2);
+    BlockBuffer i0data_sorted(in(0)->get_size(c2, x2));
+    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted.get(), c2.size(), x2.size());
     // tensor label: I6
-    std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x0, x1, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x0, x1, x2)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, c1.size(), x0.size(), x1.size(), x2.size());
+    const double* i1data = in(1)->get_block_view(c1, x0, x1, x2);
+    BlockBuffer i1data_sorted(in(1)->get_size(c1, x0, x1, x2));
+    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted.get(), c1.size(), x0.size(), x1.size(), x2.size());
     dgemm_("T", "N", c2.size(), c1.size()*x0.size()*x1.size(), x2.size(),
-           1.0, i0data_sorted, x2.size(), i1data_sorted, x2.size(),
-           1.0, odata_sorted, c2.size());
+           1.0, i0data_sorted.get(), x2.size(), i1data_sorted.get(), x2.size(),
+           1.0, odata_sorted.get(), c2.size());
   }
-  sort_indices<0,1,2,3,1,1,1,1>(odata_sorted, odata, c2.size(), c1.size(), x0.size(), x1.size());
+  sort_indices<0,1,2,3,1,1,1,1>(odata_sorted.get(), odata.get(), c2.size(), c1.size(), x0.size(), x1.size());
   out()->put_block(odata, c2, c1, x0, x1);
 }
 
@@ -1538,26 +1538,26 @@ void Task80::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I6
   std::unique_ptr<double[]> odata = out()->move_block(c1, x0, x1, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x0, x1, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, x0, x1, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x0, x1, x2), 0.0);
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x0, x3, x1, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x0, x3, x1, x2)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x0.size(), x3.size(), x1.size(), x2.size());
+        const double* i0data = in(0)->get_block_view(x5, x4, x0, x3, x1, x2);
+        BlockBuffer i0data_sorted(in(0)->get_size(x5, x4, x0, x3, x1, x2));
+        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), x4.size(), x0.size(), x3.size(), x1.size(), x2.size());
         // tensor label: I7
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, c1, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, c1, x3)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted, x5.size(), x4.size(), c1.size(), x3.size());
+        const double* i1data = in(1)->get_block_view(x5, x4, c1, x3);
+        BlockBuffer i1data_sorted(in(1)->get_size(x5, x4, c1, x3));
+        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted.get(), x5.size(), x4.size(), c1.size(), x3.size());
         dgemm_("T", "N", x0.size()*x1.size()*x2.size(), c1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x0.size()*x1.size()*x2.size());
+               1.0, i0data_sorted.get(), x5.size()*x4.size()*x3.size(), i1data_sorted.get(), x5.size()*x4.size()*x3.size(),
+               1.0, odata_sorted.get(), x0.size()*x1.size()*x2.size());
       }
     }
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), c1.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), x2.size(), c1.size());
   out()->put_block(odata, c1, x0, x1, x2);
 }
 
@@ -1570,8 +1570,8 @@ void Task81::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x5, x4, c1, x3);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, c1, x3);
-    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata, x5.size(), x4.size(), c1.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(x5, x4, c1, x3);
+    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata.get(), x5.size(), x4.size(), c1.size(), x3.size());
   }
   out()->put_block(odata, x5, x4, c1, x3);
 }
@@ -1583,24 +1583,24 @@ void Task82::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I2
   std::unique_ptr<double[]> odata = out()->move_block(c2, c1, x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c1, x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(c2, c1, x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c1, x0, x1), 0.0);
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma3
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x3, x0, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x3, x0, x2)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x1.size(), x3.size(), x0.size(), x2.size());
+      const double* i0data = in(0)->get_block_view(x1, x3, x0, x2);
+      BlockBuffer i0data_sorted(in(0)->get_size(x1, x3, x0, x2));
+      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), x3.size(), x0.size(), x2.size());
       // tensor label: I9
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c1, c2, x3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c1, c2, x3)]);
-      sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, x2.size(), c1.size(), c2.size(), x3.size());
+      const double* i1data = in(1)->get_block_view(x2, c1, c2, x3);
+      BlockBuffer i1data_sorted(in(1)->get_size(x2, c1, c2, x3));
+      sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), c1.size(), c2.size(), x3.size());
       dgemm_("T", "N", x1.size()*x0.size(), c1.size()*c2.size(), x2.size()*x3.size(),
-             1.0, i0data_sorted, x2.size()*x3.size(), i1data_sorted, x2.size()*x3.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+             1.0, i0data_sorted.get(), x2.size()*x3.size(), i1data_sorted.get(), x2.size()*x3.size(),
+             1.0, odata_sorted.get(), x1.size()*x0.size());
     }
   }
-  sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c1.size(), c2.size());
+  sort_indices<3,2,1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size(), c1.size(), c2.size());
   out()->put_block(odata, c2, c1, x0, x1);
 }
 
@@ -1611,22 +1611,22 @@ void Task83::Task_local::compute() {
   const Index x3 = b(3);
   // tensor label: I9
   std::unique_ptr<double[]> odata = out()->move_block(x2, c1, c2, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, c1, c2, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(x2, c1, c2, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(x2, c1, c2, x3), 0.0);
   for (auto& a3 : *range_[2]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a3, c2, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a3, c2, x3)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a3.size(), c2.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(c1, a3, c2, x3);
+    BlockBuffer i0data_sorted(in(0)->get_size(c1, a3, c2, x3));
+    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a3.size(), c2.size(), x3.size());
     // tensor label: I10
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x2)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a3.size(), x2.size());
+    const double* i1data = in(1)->get_block_view(a3, x2);
+    BlockBuffer i1data_sorted(in(1)->get_size(a3, x2));
+    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), x2.size());
     dgemm_("T", "N", c1.size()*c2.size()*x3.size(), x2.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, c1.size()*c2.size()*x3.size());
+           1.0, i0data_sorted.get(), a3.size(), i1data_sorted.get(), a3.size(),
+           1.0, odata_sorted.get(), c1.size()*c2.size()*x3.size());
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, c1.size(), c2.size(), x3.size(), x2.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), c1.size(), c2.size(), x3.size(), x2.size());
   out()->put_block(odata, x2, c1, c2, x3);
 }
 
@@ -1637,8 +1637,8 @@ void Task84::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, x2);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a3, x2);
-    sort_indices<0,1,1,1,-1,1>(i0data, odata, a3.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(a3, x2);
+    sort_indices<0,1,1,1,-1,1>(i0data, odata.get(), a3.size(), x2.size());
   }
   out()->put_block(odata, a3, x2);
 }
@@ -1652,8 +1652,8 @@ void Task85::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c1, x2, x0, x1);
   {
     // tensor label: I11
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x2, x1, x0);
-    sort_indices<0,1,3,2,1,1,1,1>(i0data, odata, c1.size(), x2.size(), x1.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(c1, x2, x1, x0);
+    sort_indices<0,1,3,2,1,1,1,1>(i0data, odata.get(), c1.size(), x2.size(), x1.size(), x0.size());
   }
   out()->put_block(odata, c1, x2, x0, x1);
 }
@@ -1665,26 +1665,26 @@ void Task86::Task_local::compute() {
   const Index x0 = b(3);
   // tensor label: I11
   std::unique_ptr<double[]> odata = out()->move_block(c1, x2, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x2, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, x2, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x2, x1, x0), 0.0);
   for (auto& x5 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x4 : *range_[1]) {
         // tensor label: Gamma4
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x5, x3, x4, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, x5, x3, x4, x1, x0)]);
-        sort_indices<1,2,3,0,4,5,0,1,1,1>(i0data, i0data_sorted, x2.size(), x5.size(), x3.size(), x4.size(), x1.size(), x0.size());
+        const double* i0data = in(0)->get_block_view(x2, x5, x3, x4, x1, x0);
+        BlockBuffer i0data_sorted(in(0)->get_size(x2, x5, x3, x4, x1, x0));
+        sort_indices<1,2,3,0,4,5,0,1,1,1>(i0data, i0data_sorted.get(), x2.size(), x5.size(), x3.size(), x4.size(), x1.size(), x0.size());
         // tensor label: I12
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x3, c1, x5, x4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, c1, x5, x4)]);
-        sort_indices<2,0,3,1,0,1,1,1>(i1data, i1data_sorted, x3.size(), c1.size(), x5.size(), x4.size());
+        const double* i1data = in(1)->get_block_view(x3, c1, x5, x4);
+        BlockBuffer i1data_sorted(in(1)->get_size(x3, c1, x5, x4));
+        sort_indices<2,0,3,1,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), c1.size(), x5.size(), x4.size());
         dgemm_("T", "N", x2.size()*x1.size()*x0.size(), c1.size(), x3.size()*x5.size()*x4.size(),
-               1.0, i0data_sorted, x3.size()*x5.size()*x4.size(), i1data_sorted, x3.size()*x5.size()*x4.size(),
-               1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+               1.0, i0data_sorted.get(), x3.size()*x5.size()*x4.size(), i1data_sorted.get(), x3.size()*x5.size()*x4.size(),
+               1.0, odata_sorted.get(), x2.size()*x1.size()*x0.size());
       }
     }
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size(), x0.size(), c1.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x2.size(), x1.size(), x0.size(), c1.size());
   out()->put_block(odata, c1, x2, x1, x0);
 }
 
@@ -1695,22 +1695,22 @@ void Task87::Task_local::compute() {
   const Index x4 = b(3);
   // tensor label: I12
   std::unique_ptr<double[]> odata = out()->move_block(x3, c1, x5, x4);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, c1, x5, x4)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, c1, x5, x4));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, c1, x5, x4), 0.0);
   for (auto& c2 : *range_[0]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x5, c2, x4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x5, c2, x4)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), x5.size(), c2.size(), x4.size());
+    const double* i0data = in(0)->get_block_view(c1, x5, c2, x4);
+    BlockBuffer i0data_sorted(in(0)->get_size(c1, x5, c2, x4));
+    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), x5.size(), c2.size(), x4.size());
     // tensor label: I13
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x3, c2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, c2)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, x3.size(), c2.size());
+    const double* i1data = in(1)->get_block_view(x3, c2);
+    BlockBuffer i1data_sorted(in(1)->get_size(x3, c2));
+    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), c2.size());
     dgemm_("T", "N", c1.size()*x5.size()*x4.size(), x3.size(), c2.size(),
-           1.0, i0data_sorted, c2.size(), i1data_sorted, c2.size(),
-           1.0, odata_sorted, c1.size()*x5.size()*x4.size());
+           1.0, i0data_sorted.get(), c2.size(), i1data_sorted.get(), c2.size(),
+           1.0, odata_sorted.get(), c1.size()*x5.size()*x4.size());
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, c1.size(), x5.size(), x4.size(), x3.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), c1.size(), x5.size(), x4.size(), x3.size());
   out()->put_block(odata, x3, c1, x5, x4);
 }
 
@@ -1721,8 +1721,8 @@ void Task88::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x3, c2);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, c2);
-    sort_indices<0,1,1,1,2,1>(i0data, odata, x3.size(), c2.size());
+    const double* i0data = in(0)->get_block_view(x3, c2);
+    sort_indices<0,1,1,1,2,1>(i0data, odata.get(), x3.size(), c2.size());
   }
   out()->put_block(odata, x3, c2);
 }
@@ -1734,26 +1734,26 @@ void Task89::Task_local::compute() {
   const Index x0 = b(3);
   // tensor label: I11
   std::unique_ptr<double[]> odata = out()->move_block(c1, x2, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x2, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, x2, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x2, x1, x0), 0.0);
   for (auto& x7 : *range_[1]) {
     for (auto& x6 : *range_[1]) {
       for (auto& x5 : *range_[1]) {
         // tensor label: Gamma5
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x6, x2, x5, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, x6, x2, x5, x1, x0)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted, x7.size(), x6.size(), x2.size(), x5.size(), x1.size(), x0.size());
+        const double* i0data = in(0)->get_block_view(x7, x6, x2, x5, x1, x0);
+        BlockBuffer i0data_sorted(in(0)->get_size(x7, x6, x2, x5, x1, x0));
+        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted.get(), x7.size(), x6.size(), x2.size(), x5.size(), x1.size(), x0.size());
         // tensor label: I15
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x7, x6, c1, x5);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x7, x6, c1, x5)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted, x7.size(), x6.size(), c1.size(), x5.size());
+        const double* i1data = in(1)->get_block_view(x7, x6, c1, x5);
+        BlockBuffer i1data_sorted(in(1)->get_size(x7, x6, c1, x5));
+        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted.get(), x7.size(), x6.size(), c1.size(), x5.size());
         dgemm_("T", "N", x2.size()*x1.size()*x0.size(), c1.size(), x7.size()*x6.size()*x5.size(),
-               1.0, i0data_sorted, x7.size()*x6.size()*x5.size(), i1data_sorted, x7.size()*x6.size()*x5.size(),
-               1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+               1.0, i0data_sorted.get(), x7.size()*x6.size()*x5.size(), i1data_sorted.get(), x7.size()*x6.size()*x5.size(),
+               1.0, odata_sorted.get(), x2.size()*x1.size()*x0.size());
       }
     }
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size(), x0.size(), c1.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x2.size(), x1.size(), x0.size(), c1.size());
   out()->put_block(odata, c1, x2, x1, x0);
 }
 
@@ -1766,8 +1766,8 @@ void Task90::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x7, x6, c1, x5);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x6, c1, x5);
-    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata, x7.size(), x6.size(), c1.size(), x5.size());
+    const double* i0data = in(0)->get_block_view(x7, x6, c1, x5);
+    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata.get(), x7.size(), x6.size(), c1.size(), x5.size());
   }
   out()->put_block(odata, x7, x6, c1, x5);
 }
@@ -1779,26 +1779,26 @@ void Task91::Task_local::compute() {
   const Index x0 = b(3);
   // tensor label: I11
   std::unique_ptr<double[]> odata = out()->move_block(c1, x2, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x2, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, x2, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x2, x1, x0), 0.0);
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma6
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x2, x3, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x2, x3, x1, x0)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
+        const double* i0data = in(0)->get_block_view(x5, x4, x2, x3, x1, x0);
+        BlockBuffer i0data_sorted(in(0)->get_size(x5, x4, x2, x3, x1, x0));
+        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
         // tensor label: I17
-        std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x5, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x5, x4, x3)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted, c1.size(), x5.size(), x4.size(), x3.size());
+        const double* i1data = in(1)->get_block_view(c1, x5, x4, x3);
+        BlockBuffer i1data_sorted(in(1)->get_size(c1, x5, x4, x3));
+        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted.get(), c1.size(), x5.size(), x4.size(), x3.size());
         dgemm_("T", "N", x2.size()*x1.size()*x0.size(), c1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+               1.0, i0data_sorted.get(), x5.size()*x4.size()*x3.size(), i1data_sorted.get(), x5.size()*x4.size()*x3.size(),
+               1.0, odata_sorted.get(), x2.size()*x1.size()*x0.size());
       }
     }
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size(), x0.size(), c1.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x2.size(), x1.size(), x0.size(), c1.size());
   out()->put_block(odata, c1, x2, x1, x0);
 }
 
@@ -1813,12 +1813,12 @@ void Task92::Task_local::compute() {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, c1, x3);
     dscal_(x5.size()*x4.size()*c1.size()*x3.size(), e0_, i0data.get(), 1);
-    sort_indices<2,0,1,3,1,1,-1,1>(i0data, odata, x5.size(), x4.size(), c1.size(), x3.size());
+    sort_indices<2,0,1,3,1,1,-1,1>(i0data.get(), odata.get(), x5.size(), x4.size(), c1.size(), x3.size());
   }
   {
     // tensor label: v2
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, c1, x3);
-    sort_indices<2,0,1,3,1,1,1,2>(i1data, odata, x5.size(), x4.size(), c1.size(), x3.size());
+    const double* i1data = in(1)->get_block_view(x5, x4, c1, x3);
+    sort_indices<2,0,1,3,1,1,1,2>(i1data, odata.get(), x5.size(), x4.size(), c1.size(), x3.size());
   }
   out()->put_block(odata, c1, x5, x4, x3);
 }
@@ -1830,22 +1830,22 @@ void Task93::Task_local::compute() {
   const Index x3 = b(3);
   // tensor label: I17
   std::unique_ptr<double[]> odata = out()->move_block(c1, x5, x4, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x5, x4, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, x5, x4, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x5, x4, x3), 0.0);
   for (auto& c2 : *range_[0]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, c2, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, c2, x3)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), c2.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(x5, x4, c2, x3);
+    BlockBuffer i0data_sorted(in(0)->get_size(x5, x4, c2, x3));
+    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), x4.size(), c2.size(), x3.size());
     // tensor label: I18
-    std::unique_ptr<double[]> i1data = in(1)->get_block(c1, c2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, c2)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, c1.size(), c2.size());
+    const double* i1data = in(1)->get_block_view(c1, c2);
+    BlockBuffer i1data_sorted(in(1)->get_size(c1, c2));
+    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), c1.size(), c2.size());
     dgemm_("T", "N", x5.size()*x4.size()*x3.size(), c1.size(), c2.size(),
-           1.0, i0data_sorted, c2.size(), i1data_sorted, c2.size(),
-           1.0, odata_sorted, x5.size()*x4.size()*x3.size());
+           1.0, i0data_sorted.get(), c2.size(), i1data_sorted.get(), c2.size(),
+           1.0, odata_sorted.get(), x5.size()*x4.size()*x3.size());
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), c1.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x5.size(), x4.size(), x3.size(), c1.size());
   out()->put_block(odata, c1, x5, x4, x3);
 }
 
@@ -1856,8 +1856,8 @@ void Task94::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c1, c2);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, c2);
-    sort_indices<0,1,1,1,-1,1>(i0data, odata, c1.size(), c2.size());
+    const double* i0data = in(0)->get_block_view(c1, c2);
+    sort_indices<0,1,1,1,-1,1>(i0data, odata.get(), c1.size(), c2.size());
   }
   out()->put_block(odata, c1, c2);
 }
@@ -1869,22 +1869,22 @@ void Task95::Task_local::compute() {
   const Index x3 = b(3);
   // tensor label: I17
   std::unique_ptr<double[]> odata = out()->move_block(c1, x5, x4, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x5, x4, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, x5, x4, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x5, x4, x3), 0.0);
   for (auto& a2 : *range_[2]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x5, x4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, x5, x4)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), x5.size(), x4.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, x5, x4);
+    BlockBuffer i0data_sorted(in(0)->get_size(c1, a2, x5, x4));
+    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size(), x5.size(), x4.size());
     // tensor label: I30
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a2, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, x3)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a2.size(), x3.size());
+    const double* i1data = in(1)->get_block_view(a2, x3);
+    BlockBuffer i1data_sorted(in(1)->get_size(a2, x3));
+    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a2.size(), x3.size());
     dgemm_("T", "N", c1.size()*x5.size()*x4.size(), x3.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, c1.size()*x5.size()*x4.size());
+           1.0, i0data_sorted.get(), a2.size(), i1data_sorted.get(), a2.size(),
+           1.0, odata_sorted.get(), c1.size()*x5.size()*x4.size());
   }
-  sort_indices<0,1,2,3,1,1,1,1>(odata_sorted, odata, c1.size(), x5.size(), x4.size(), x3.size());
+  sort_indices<0,1,2,3,1,1,1,1>(odata_sorted.get(), odata.get(), c1.size(), x5.size(), x4.size(), x3.size());
   out()->put_block(odata, c1, x5, x4, x3);
 }
 
@@ -1895,8 +1895,8 @@ void Task96::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a2, x3);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a2, x3);
-    sort_indices<0,1,1,1,1,1>(i0data, odata, a2.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(a2, x3);
+    sort_indices<0,1,1,1,1,1>(i0data, odata.get(), a2.size(), x3.size());
   }
   out()->put_block(odata, a2, x3);
 }
@@ -1908,22 +1908,22 @@ void Task97::Task_local::compute() {
   const Index x0 = b(3);
   // tensor label: I11
   std::unique_ptr<double[]> odata = out()->move_block(c1, x2, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x2, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, x2, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x2, x1, x0), 0.0);
   for (auto& x3 : *range_[1]) {
     // tensor label: Gamma7
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x3, x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, x3, x1, x0)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x2.size(), x3.size(), x1.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(x2, x3, x1, x0);
+    BlockBuffer i0data_sorted(in(0)->get_size(x2, x3, x1, x0));
+    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x2.size(), x3.size(), x1.size(), x0.size());
     // tensor label: I20
-    std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x3)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, c1.size(), x3.size());
+    const double* i1data = in(1)->get_block_view(c1, x3);
+    BlockBuffer i1data_sorted(in(1)->get_size(c1, x3));
+    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), c1.size(), x3.size());
     dgemm_("T", "N", x2.size()*x1.size()*x0.size(), c1.size(), x3.size(),
-           1.0, i0data_sorted, x3.size(), i1data_sorted, x3.size(),
-           1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+           1.0, i0data_sorted.get(), x3.size(), i1data_sorted.get(), x3.size(),
+           1.0, odata_sorted.get(), x2.size()*x1.size()*x0.size());
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size(), x0.size(), c1.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x2.size(), x1.size(), x0.size(), c1.size());
   out()->put_block(odata, c1, x2, x1, x0);
 }
 
@@ -1934,8 +1934,8 @@ void Task98::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c1, x3);
   {
     // tensor label: h1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x3);
-    sort_indices<0,1,1,1,1,1>(i0data, odata, c1.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(c1, x3);
+    sort_indices<0,1,1,1,1,1>(i0data, odata.get(), c1.size(), x3.size());
   }
   out()->put_block(odata, c1, x3);
 }
@@ -1945,24 +1945,24 @@ void Task99::Task_local::compute() {
   const Index x3 = b(1);
   // tensor label: I20
   std::unique_ptr<double[]> odata = out()->move_block(c1, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x3), 0.0);
   for (auto& c2 : *range_[0]) {
     for (auto& a3 : *range_[2]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a3, c1, x3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a3, c1, x3)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a3.size(), c1.size(), x3.size());
+      const double* i0data = in(0)->get_block_view(c2, a3, c1, x3);
+      BlockBuffer i0data_sorted(in(0)->get_size(c2, a3, c1, x3));
+      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c2.size(), a3.size(), c1.size(), x3.size());
       // tensor label: I21
-      std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2)]);
-      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size());
+      const double* i1data = in(1)->get_block_view(a3, c2);
+      BlockBuffer i1data_sorted(in(1)->get_size(a3, c2));
+      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), c2.size());
       dgemm_("T", "N", c1.size()*x3.size(), 1, a3.size()*c2.size(),
-             1.0, i0data_sorted, a3.size()*c2.size(), i1data_sorted, a3.size()*c2.size(),
-             1.0, odata_sorted, c1.size()*x3.size());
+             1.0, i0data_sorted.get(), a3.size()*c2.size(), i1data_sorted.get(), a3.size()*c2.size(),
+             1.0, odata_sorted.get(), c1.size()*x3.size());
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, c1.size(), x3.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), c1.size(), x3.size());
   out()->put_block(odata, c1, x3);
 }
 
@@ -40,24 +40,24 @@ void Task950::Task_local::compute() {
   const Index x4 = b(3);
   // tensor label: I900
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x5, x4);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x5, x4)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x5, x4));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x5, x4), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x5, x4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, x5, x4)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), x5.size(), x4.size());
+      const double* i0data = in(0)->get_block_view(c1, a2, x5, x4);
+      BlockBuffer i0data_sorted(in(0)->get_size(c1, a2, x5, x4));
+      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size(), x5.size(), x4.size());
       // tensor label: I955
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, a2, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, a2, c1)]);
-      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), a2.size(), c1.size());
+      const double* i1data = in(1)->get_block_view(x1, x0, a2, c1);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, a2, c1));
+      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), a2.size(), c1.size());
       dgemm_("T", "N", x5.size()*x4.size(), x1.size()*x0.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x5.size()*x4.size());
+             1.0, i0data_sorted.get(), a2.size()*c1.size(), i1data_sorted.get(), a2.size()*c1.size(),
+             1.0, odata_sorted.get(), x5.size()*x4.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x1.size(), x0.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x5.size(), x4.size(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0, x5, x4);
 }
 
@@ -70,8 +70,8 @@ void Task951::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x0, x1);
-    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata, c1.size(), a2.size(), x0.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, x0, x1);
+    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata.get(), c1.size(), a2.size(), x0.size(), x1.size());
   }
   out()->put_block(odata, x1, x0, a2, c1);
 }
@@ -80,28 +80,28 @@ void Task952::Task_local::compute() {
   const Index ci0 = b(0);
   // tensor label: I768
   std::unique_ptr<double[]> odata = out()->move_block(ci0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(ci0)]);
+  BlockBuffer odata_sorted(out()->get_size(ci0));
   std::fill_n(odata_sorted.get(), out()->get_size(ci0), 0.0);
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         for (auto& x0 : *range_[1]) {
           // tensor label: Gamma305
-          std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x3, x2, x1, x0);
-          std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(ci0, x3, x2, x1, x0)]);
-          sort_indices<1,2,3,4,0,0,1,1,1>(i0data, i0data_sorted, ci0.size(), x3.size(), x2.size(), x1.size(), x0.size());
+          const double* i0data = in(0)->get_block_view(ci0, x3, x2, x1, x0);
+          BlockBuffer i0data_sorted(in(0)->get_size(ci0, x3, x2, x1, x0));
+          sort_indices<1,2,3,4,0,0,1,1,1>(i0data, i0data_sorted.get(), ci0.size(), x3.size(), x2.size(), x1.size(), x0.size());
           // tensor label: I903
-          std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, x3, x2);
-          std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, x3, x2)]);
-          sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), x3.size(), x2.size());
+          const double* i1data = in(1)->get_block_view(x1, x0, x3, x2);
+          BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, x3, x2));
+          sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), x3.size(), x2.size());
           dgemm_("T", "N", ci0.size(), 1, x1.size()*x0.size()*x3.size()*x2.size(),
-                 1.0, i0data_sorted, x1.size()*x0.size()*x3.size()*x2.size(), i1data_sorted, x1.size()*x0.size()*x3.size()*x2.size(),
-                 1.0, odata_sorted, ci0.size());
+                 1.0, i0data_sorted.get(), x1.size()*x0.size()*x3.size()*x2.size(), i1data_sorted.get(), x1.size()*x0.size()*x3.size()*x2.size(),
+                 1.0, odata_sorted.get(), ci0.size());
         }
       }
     }
   }
-  sort_indices<0,1,1,1,1>(odata_sorted, odata, ci0.size());
+  sort_indices<0,1,1,1,1>(odata_sorted.get(), odata.get(), ci0.size());
   out()->put_block(odata, ci0);
 }
 
@@ -112,24 +112,24 @@ void Task953::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I903
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   for (auto& c3 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a1, x3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a1, x3, x2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c3.size(), a1.size(), x3.size(), x2.size());
+      const double* i0data = in(0)->get_block_view(c3, a1, x3, x2);
+      BlockBuffer i0data_sorted(in(0)->get_size(c3, a1, x3, x2));
+      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c3.size(), a1.size(), x3.size(), x2.size());
       // tensor label: I904
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a1, x0, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a1, x0, c3)]);
-      sort_indices<3,1,0,2,0,1,1,1>(i1data, i1data_sorted, x1.size(), a1.size(), x0.size(), c3.size());
+      const double* i1data = in(1)->get_block_view(x1, a1, x0, c3);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, a1, x0, c3));
+      sort_indices<3,1,0,2,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), a1.size(), x0.size(), c3.size());
       dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), a1.size()*c3.size(),
-             1.0, i0data_sorted, a1.size()*c3.size(), i1data_sorted, a1.size()*c3.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), a1.size()*c3.size(), i1data_sorted.get(), a1.size()*c3.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0, x3, x2);
 }
 
@@ -140,22 +140,22 @@ void Task954::Task_local::compute() {
   const Index c3 = b(3);
   // tensor label: I904
   std::unique_ptr<double[]> odata = out()->move_block(x1, a1, x0, c3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, a1, x0, c3)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, a1, x0, c3));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, a1, x0, c3), 0.0);
   for (auto& c2 : *range_[0]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c2, c3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, c3)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), c3.size());
+    const double* i0data = in(0)->get_block_view(c2, c3);
+    BlockBuffer i0data_sorted(in(0)->get_size(c2, c3));
+    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), c2.size(), c3.size());
     // tensor label: I905
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c2, a1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c2, a1, x0)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), c2.size(), a1.size(), x0.size());
+    const double* i1data = in(1)->get_block_view(x1, c2, a1, x0);
+    BlockBuffer i1data_sorted(in(1)->get_size(x1, c2, a1, x0));
+    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), c2.size(), a1.size(), x0.size());
     dgemm_("T", "N", c3.size(), x1.size()*a1.size()*x0.size(), c2.size(),
-           1.0, i0data_sorted, c2.size(), i1data_sorted, c2.size(),
-           1.0, odata_sorted, c3.size());
+           1.0, i0data_sorted.get(), c2.size(), i1data_sorted.get(), c2.size(),
+           1.0, odata_sorted.get(), c3.size());
   }
-  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, c3.size(), x1.size(), a1.size(), x0.size());
+  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted.get(), odata.get(), c3.size(), x1.size(), a1.size(), x0.size());
   out()->put_block(odata, x1, a1, x0, c3);
 }
 
@@ -168,8 +168,8 @@ void Task955::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata, x0.size(), a1.size(), c2.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, x1);
+    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), x1.size());
   }
   out()->put_block(odata, x1, c2, a1, x0);
 }
@@ -181,24 +181,24 @@ void Task956::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I903
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   for (auto& c2 : *range_[0]) {
     for (auto& a3 : *range_[2]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a3, x3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a3, x3, x2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a3.size(), x3.size(), x2.size());
+      const double* i0data = in(0)->get_block_view(c2, a3, x3, x2);
+      BlockBuffer i0data_sorted(in(0)->get_size(c2, a3, x3, x2));
+      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c2.size(), a3.size(), x3.size(), x2.size());
       // tensor label: I908
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c2, x0, a3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c2, x0, a3)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i1data, i1data_sorted, x1.size(), c2.size(), x0.size(), a3.size());
+      const double* i1data = in(1)->get_block_view(x1, c2, x0, a3);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, c2, x0, a3));
+      sort_indices<1,3,0,2,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), c2.size(), x0.size(), a3.size());
       dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), c2.size()*a3.size(),
-             1.0, i0data_sorted, c2.size()*a3.size(), i1data_sorted, c2.size()*a3.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), c2.size()*a3.size(), i1data_sorted.get(), c2.size()*a3.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0, x3, x2);
 }
 
@@ -209,22 +209,22 @@ void Task957::Task_local::compute() {
   const Index a3 = b(3);
   // tensor label: I908
   std::unique_ptr<double[]> odata = out()->move_block(x1, c2, x0, a3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, c2, x0, a3)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, c2, x0, a3));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, c2, x0, a3), 0.0);
   for (auto& a1 : *range_[2]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a3, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a3, a1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, a3.size(), a1.size());
+    const double* i0data = in(0)->get_block_view(a3, a1);
+    BlockBuffer i0data_sorted(in(0)->get_size(a3, a1));
+    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted.get(), a3.size(), a1.size());
     // tensor label: I909
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c2, a1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c2, a1, x0)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), c2.size(), a1.size(), x0.size());
+    const double* i1data = in(1)->get_block_view(x1, c2, a1, x0);
+    BlockBuffer i1data_sorted(in(1)->get_size(x1, c2, a1, x0));
+    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), c2.size(), a1.size(), x0.size());
     dgemm_("T", "N", a3.size(), x1.size()*c2.size()*x0.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, a3.size());
+           1.0, i0data_sorted.get(), a1.size(), i1data_sorted.get(), a1.size(),
+           1.0, odata_sorted.get(), a3.size());
   }
-  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a3.size(), x1.size(), c2.size(), x0.size());
+  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted.get(), odata.get(), a3.size(), x1.size(), c2.size(), x0.size());
   out()->put_block(odata, x1, c2, x0, a3);
 }
 
@@ -237,8 +237,8 @@ void Task958::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata, x0.size(), a1.size(), c2.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, x1);
+    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), x1.size());
   }
   out()->put_block(odata, x1, c2, a1, x0);
 }
@@ -250,22 +250,22 @@ void Task959::Task_local::compute() {
   const Index a3 = b(3);
   // tensor label: I908
   std::unique_ptr<double[]> odata = out()->move_block(x1, c2, x0, a3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, c2, x0, a3)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, c2, x0, a3));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, c2, x0, a3), 0.0);
   for (auto& a1 : *range_[2]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), a1.size());
+    const double* i0data = in(0)->get_block_view(x1, a1);
+    BlockBuffer i0data_sorted(in(0)->get_size(x1, a1));
+    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), a1.size());
     // tensor label: I1060
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, a1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, a1, x0)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), a1.size(), x0.size());
+    const double* i1data = in(1)->get_block_view(a3, c2, a1, x0);
+    BlockBuffer i1data_sorted(in(1)->get_size(a3, c2, a1, x0));
+    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), c2.size(), a1.size(), x0.size());
     dgemm_("T", "N", x1.size(), a3.size()*c2.size()*x0.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, x1.size());
+           1.0, i0data_sorted.get(), a1.size(), i1data_sorted.get(), a1.size(),
+           1.0, odata_sorted.get(), x1.size());
   }
-  sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, x1.size(), a3.size(), c2.size(), x0.size());
+  sort_indices<0,2,3,1,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), a3.size(), c2.size(), x0.size());
   out()->put_block(odata, x1, c2, x0, a3);
 }
 
@@ -278,8 +278,8 @@ void Task960::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata, x0.size(), a1.size(), c2.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, a3);
+    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), a3.size());
   }
   out()->put_block(odata, a3, c2, a1, x0);
 }
@@ -291,24 +291,24 @@ void Task961::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I903
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, x1)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
+      const double* i0data = in(0)->get_block_view(x0, a1, c2, x1);
+      BlockBuffer i0data_sorted(in(0)->get_size(x0, a1, c2, x1));
+      sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), a1.size(), c2.size(), x1.size());
       // tensor label: I924
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x2, x3, c2, a1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, x3, c2, a1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, x2.size(), x3.size(), c2.size(), a1.size());
+      const double* i1data = in(1)->get_block_view(x2, x3, c2, a1);
+      BlockBuffer i1data_sorted(in(1)->get_size(x2, x3, c2, a1));
+      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), x3.size(), c2.size(), a1.size());
       dgemm_("T", "N", x1.size()*x0.size(), x2.size()*x3.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+             1.0, i0data_sorted.get(), c2.size()*a1.size(), i1data_sorted.get(), c2.size()*a1.size(),
+             1.0, odata_sorted.get(), x1.size()*x0.size());
     }
   }
-  sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x3.size());
+  sort_indices<1,0,3,2,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), x2.size(), x3.size());
   out()->put_block(odata, x1, x0, x3, x2);
 }
 
@@ -319,22 +319,22 @@ void Task962::Task_local::compute() {
   const Index a1 = b(3);
   // tensor label: I924
   std::unique_ptr<double[]> odata = out()->move_block(x2, x3, c2, a1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x3, c2, a1)]);
+  BlockBuffer odata_sorted(out()->get_size(x2, x3, c2, a1));
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x3, c2, a1), 0.0);
   for (auto& a3 : *range_[2]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a3, c2, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a3, c2, a1)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a3.size(), c2.size(), a1.size());
+    const double* i0data = in(0)->get_block_view(x3, a3, c2, a1);
+    BlockBuffer i0data_sorted(in(0)->get_size(x3, a3, c2, a1));
+    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a3.size(), c2.size(), a1.size());
     // tensor label: I925
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x2)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a3.size(), x2.size());
+    const double* i1data = in(1)->get_block_view(a3, x2);
+    BlockBuffer i1data_sorted(in(1)->get_size(a3, x2));
+    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), x2.size());
     dgemm_("T", "N", x3.size()*c2.size()*a1.size(), x2.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, x3.size()*c2.size()*a1.size());
+           1.0, i0data_sorted.get(), a3.size(), i1data_sorted.get(), a3.size(),
+           1.0, odata_sorted.get(), x3.size()*c2.size()*a1.size());
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x3.size(), c2.size(), a1.size(), x2.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), c2.size(), a1.size(), x2.size());
   out()->put_block(odata, x2, x3, c2, a1);
 }
 
@@ -345,8 +345,8 @@ void Task963::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, x2);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a3, x2);
-    sort_indices<0,1,1,1,-2,1>(i0data, odata, a3.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(a3, x2);
+    sort_indices<0,1,1,1,-2,1>(i0data, odata.get(), a3.size(), x2.size());
   }
   out()->put_block(odata, a3, x2);
 }
@@ -358,24 +358,24 @@ void Task964::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I903
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   for (auto& a2 : *range_[2]) {
     for (auto& c3 : *range_[0]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a2, c3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a2, c3, x2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a2.size(), c3.size(), x2.size());
+      const double* i0data = in(0)->get_block_view(x3, a2, c3, x2);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, a2, c3, x2));
+      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a2.size(), c3.size(), x2.size());
       // tensor label: I947
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, a2, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, a2, c3)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), a2.size(), c3.size());
+      const double* i1data = in(1)->get_block_view(x1, x0, a2, c3);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, a2, c3));
+      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), a2.size(), c3.size());
       dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), a2.size()*c3.size(),
-             1.0, i0data_sorted, a2.size()*c3.size(), i1data_sorted, a2.size()*c3.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), a2.size()*c3.size(), i1data_sorted.get(), a2.size()*c3.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0, x3, x2);
 }
 
@@ -386,22 +386,22 @@ void Task965::Task_local::compute() {
   const Index c3 = b(3);
   // tensor label: I947
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, a2, c3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, a2, c3)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, a2, c3));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, a2, c3), 0.0);
   for (auto& c1 : *range_[0]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, c3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, c3)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), c3.size());
+    const double* i0data = in(0)->get_block_view(c1, c3);
+    BlockBuffer i0data_sorted(in(0)->get_size(c1, c3));
+    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), c3.size());
     // tensor label: I948
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, a2, c1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, a2, c1)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), a2.size(), c1.size());
+    const double* i1data = in(1)->get_block_view(x1, x0, a2, c1);
+    BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, a2, c1));
+    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), a2.size(), c1.size());
     dgemm_("T", "N", c3.size(), x1.size()*x0.size()*a2.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, c3.size());
+           1.0, i0data_sorted.get(), c1.size(), i1data_sorted.get(), c1.size(),
+           1.0, odata_sorted.get(), c3.size());
   }
-  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, c3.size(), x1.size(), x0.size(), a2.size());
+  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted.get(), odata.get(), c3.size(), x1.size(), x0.size(), a2.size());
   out()->put_block(odata, x1, x0, a2, c3);
 }
 
@@ -414,8 +414,8 @@ void Task966::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x0, x1);
-    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata, c1.size(), a2.size(), x0.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, x0, x1);
+    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata.get(), c1.size(), a2.size(), x0.size(), x1.size());
   }
   out()->put_block(odata, x1, x0, a2, c1);
 }
@@ -427,24 +427,24 @@ void Task967::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I903
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   for (auto& a3 : *range_[2]) {
     for (auto& c1 : *range_[0]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a3, c1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a3, c1, x2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a3.size(), c1.size(), x2.size());
+      const double* i0data = in(0)->get_block_view(x3, a3, c1, x2);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, a3, c1, x2));
+      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a3.size(), c1.size(), x2.size());
       // tensor label: I951
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, c1, a3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, c1, a3)]);
-      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), c1.size(), a3.size());
+      const double* i1data = in(1)->get_block_view(x1, x0, c1, a3);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, c1, a3));
+      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), c1.size(), a3.size());
       dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), c1.size()*a3.size(),
-             1.0, i0data_sorted, c1.size()*a3.size(), i1data_sorted, c1.size()*a3.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), c1.size()*a3.size(), i1data_sorted.get(), c1.size()*a3.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0, x3, x2);
 }
 
@@ -455,22 +455,22 @@ void Task968::Task_local::compute() {
   const Index a3 = b(3);
   // tensor label: I951
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, c1, a3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, c1, a3)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, c1, a3));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, c1, a3), 0.0);
   for (auto& a2 : *range_[2]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a3, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a3, a2)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, a3.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(a3, a2);
+    BlockBuffer i0data_sorted(in(0)->get_size(a3, a2));
+    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted.get(), a3.size(), a2.size());
     // tensor label: I952
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, a2, c1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, a2, c1)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), a2.size(), c1.size());
+    const double* i1data = in(1)->get_block_view(x1, x0, a2, c1);
+    BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, a2, c1));
+    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), a2.size(), c1.size());
     dgemm_("T", "N", a3.size(), x1.size()*x0.size()*c1.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, a3.size());
+           1.0, i0data_sorted.get(), a2.size(), i1data_sorted.get(), a2.size(),
+           1.0, odata_sorted.get(), a3.size());
   }
-  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a3.size(), x1.size(), x0.size(), c1.size());
+  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted.get(), odata.get(), a3.size(), x1.size(), x0.size(), c1.size());
   out()->put_block(odata, x1, x0, c1, a3);
 }
 
@@ -483,8 +483,8 @@ void Task969::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x0, x1);
-    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata, c1.size(), a2.size(), x0.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, x0, x1);
+    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata.get(), c1.size(), a2.size(), x0.size(), x1.size());
   }
   out()->put_block(odata, x1, x0, a2, c1);
 }
@@ -496,24 +496,24 @@ void Task970::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I903
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   for (auto& c3 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2, x3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a2, x3, x2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c3.size(), a2.size(), x3.size(), x2.size());
+      const double* i0data = in(0)->get_block_view(c3, a2, x3, x2);
+      BlockBuffer i0data_sorted(in(0)->get_size(c3, a2, x3, x2));
+      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c3.size(), a2.size(), x3.size(), x2.size());
       // tensor label: I958
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, a2, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, a2, c3)]);
-      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), a2.size(), c3.size());
+      const double* i1data = in(1)->get_block_view(x1, x0, a2, c3);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, a2, c3));
+      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), a2.size(), c3.size());
       dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), a2.size()*c3.size(),
-             1.0, i0data_sorted, a2.size()*c3.size(), i1data_sorted, a2.size()*c3.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), a2.size()*c3.size(), i1data_sorted.get(), a2.size()*c3.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0, x3, x2);
 }
 
@@ -524,22 +524,22 @@ void Task971::Task_local::compute() {
   const Index c3 = b(3);
   // tensor label: I958
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, a2, c3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, a2, c3)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, a2, c3));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, a2, c3), 0.0);
   for (auto& c1 : *range_[0]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, c3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, c3)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), c3.size());
+    const double* i0data = in(0)->get_block_view(c1, c3);
+    BlockBuffer i0data_sorted(in(0)->get_size(c1, c3));
+    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), c3.size());
     // tensor label: I959
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, a2, c1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, a2, c1)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), a2.size(), c1.size());
+    const double* i1data = in(1)->get_block_view(x1, x0, a2, c1);
+    BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, a2, c1));
+    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), a2.size(), c1.size());
     dgemm_("T", "N", c3.size(), x1.size()*x0.size()*a2.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, c3.size());
+           1.0, i0data_sorted.get(), c1.size(), i1data_sorted.get(), c1.size(),
+           1.0, odata_sorted.get(), c3.size());
   }
-  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, c3.size(), x1.size(), x0.size(), a2.size());
+  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted.get(), odata.get(), c3.size(), x1.size(), x0.size(), a2.size());
   out()->put_block(odata, x1, x0, a2, c3);
 }
 
@@ -552,8 +552,8 @@ void Task972::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x0, x1);
-    sort_indices<3,2,1,0,1,1,-4,1>(i0data, odata, c1.size(), a2.size(), x0.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, x0, x1);
+    sort_indices<3,2,1,0,1,1,-4,1>(i0data, odata.get(), c1.size(), a2.size(), x0.size(), x1.size());
   }
   out()->put_block(odata, x1, x0, a2, c1);
 }
@@ -565,24 +565,24 @@ void Task973::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I903
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& a3 : *range_[2]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a3, x3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a3, x3, x2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a3.size(), x3.size(), x2.size());
+      const double* i0data = in(0)->get_block_view(c1, a3, x3, x2);
+      BlockBuffer i0data_sorted(in(0)->get_size(c1, a3, x3, x2));
+      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a3.size(), x3.size(), x2.size());
       // tensor label: I962
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, c1, a3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, c1, a3)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), c1.size(), a3.size());
+      const double* i1data = in(1)->get_block_view(x1, x0, c1, a3);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, c1, a3));
+      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), c1.size(), a3.size());
       dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), c1.size()*a3.size(),
-             1.0, i0data_sorted, c1.size()*a3.size(), i1data_sorted, c1.size()*a3.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), c1.size()*a3.size(), i1data_sorted.get(), c1.size()*a3.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0, x3, x2);
 }
 
@@ -593,22 +593,22 @@ void Task974::Task_local::compute() {
   const Index a3 = b(3);
   // tensor label: I962
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, c1, a3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, c1, a3)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, c1, a3));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, c1, a3), 0.0);
   for (auto& a2 : *range_[2]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a3, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a3, a2)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, a3.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(a3, a2);
+    BlockBuffer i0data_sorted(in(0)->get_size(a3, a2));
+    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted.get(), a3.size(), a2.size());
     // tensor label: I963
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, a2, c1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, a2, c1)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), a2.size(), c1.size());
+    const double* i1data = in(1)->get_block_view(x1, x0, a2, c1);
+    BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, a2, c1));
+    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), a2.size(), c1.size());
     dgemm_("T", "N", a3.size(), x1.size()*x0.size()*c1.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, a3.size());
+           1.0, i0data_sorted.get(), a2.size(), i1data_sorted.get(), a2.size(),
+           1.0, odata_sorted.get(), a3.size());
   }
-  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a3.size(), x1.size(), x0.size(), c1.size());
+  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted.get(), odata.get(), a3.size(), x1.size(), x0.size(), c1.size());
   out()->put_block(odata, x1, x0, c1, a3);
 }
 
@@ -621,8 +621,8 @@ void Task975::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x0, x1);
-    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata, c1.size(), a2.size(), x0.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, x0, x1);
+    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata.get(), c1.size(), a2.size(), x0.size(), x1.size());
   }
   out()->put_block(odata, x1, x0, a2, c1);
 }
@@ -634,24 +634,24 @@ void Task976::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I903
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   for (auto& a2 : *range_[2]) {
     for (auto& c1 : *range_[0]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x0, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, x0, x1)]);
-      sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), x0.size(), x1.size());
+      const double* i0data = in(0)->get_block_view(c1, a2, x0, x1);
+      BlockBuffer i0data_sorted(in(0)->get_size(c1, a2, x0, x1));
+      sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size(), x0.size(), x1.size());
       // tensor label: I978
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x2, x3, c1, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, x3, c1, a2)]);
-      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted, x2.size(), x3.size(), c1.size(), a2.size());
+      const double* i1data = in(1)->get_block_view(x2, x3, c1, a2);
+      BlockBuffer i1data_sorted(in(1)->get_size(x2, x3, c1, a2));
+      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), x3.size(), c1.size(), a2.size());
       dgemm_("T", "N", x1.size()*x0.size(), x2.size()*x3.size(), c1.size()*a2.size(),
-             1.0, i0data_sorted, c1.size()*a2.size(), i1data_sorted, c1.size()*a2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+             1.0, i0data_sorted.get(), c1.size()*a2.size(), i1data_sorted.get(), c1.size()*a2.size(),
+             1.0, odata_sorted.get(), x1.size()*x0.size());
     }
   }
-  sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x3.size());
+  sort_indices<1,0,3,2,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), x2.size(), x3.size());
   out()->put_block(odata, x1, x0, x3, x2);
 }
 
@@ -662,22 +662,22 @@ void Task977::Task_local::compute() {
   const Index a2 = b(3);
   // tensor label: I978
   std::unique_ptr<double[]> odata = out()->move_block(x2, x3, c1, a2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x3, c1, a2)]);
+  BlockBuffer odata_sorted(out()->get_size(x2, x3, c1, a2));
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x3, c1, a2), 0.0);
   for (auto& a3 : *range_[2]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a3, c1, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a3, c1, a2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a3.size(), c1.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(x3, a3, c1, a2);
+    BlockBuffer i0data_sorted(in(0)->get_size(x3, a3, c1, a2));
+    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a3.size(), c1.size(), a2.size());
     // tensor label: I979
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x2)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a3.size(), x2.size());
+    const double* i1data = in(1)->get_block_view(a3, x2);
+    BlockBuffer i1data_sorted(in(1)->get_size(a3, x2));
+    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), x2.size());
     dgemm_("T", "N", x3.size()*c1.size()*a2.size(), x2.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, x3.size()*c1.size()*a2.size());
+           1.0, i0data_sorted.get(), a3.size(), i1data_sorted.get(), a3.size(),
+           1.0, odata_sorted.get(), x3.size()*c1.size()*a2.size());
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x3.size(), c1.size(), a2.size(), x2.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), c1.size(), a2.size(), x2.size());
   out()->put_block(odata, x2, x3, c1, a2);
 }
 
@@ -688,8 +688,8 @@ void Task978::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, x2);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a3, x2);
-    sort_indices<0,1,1,1,4,1>(i0data, odata, a3.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(a3, x2);
+    sort_indices<0,1,1,1,4,1>(i0data, odata.get(), a3.size(), x2.size());
   }
   out()->put_block(odata, a3, x2);
 }
@@ -701,22 +701,22 @@ void Task979::Task_local::compute() {
   const Index a2 = b(3);
   // tensor label: I978
   std::unique_ptr<double[]> odata = out()->move_block(x2, x3, c1, a2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x3, c1, a2)]);
+  BlockBuffer odata_sorted(out()->get_size(x2, x3, c1, a2));
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x3, c1, a2), 0.0);
   for (auto& a3 : *range_[2]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a2, c1, a3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a2, c1, a3)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), a2.size(), c1.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(x3, a2, c1, a3);
+    BlockBuffer i0data_sorted(in(0)->get_size(x3, a2, c1, a3));
+    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a2.size(), c1.size(), a3.size());
     // tensor label: I983
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x2)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a3.size(), x2.size());
+    const double* i1data = in(1)->get_block_view(a3, x2);
+    BlockBuffer i1data_sorted(in(1)->get_size(a3, x2));
+    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), x2.size());
     dgemm_("T", "N", x3.size()*a2.size()*c1.size(), x2.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, x3.size()*a2.size()*c1.size());
+           1.0, i0data_sorted.get(), a3.size(), i1data_sorted.get(), a3.size(),
+           1.0, odata_sorted.get(), x3.size()*a2.size()*c1.size());
   }
-  sort_indices<3,0,2,1,1,1,1,1>(odata_sorted, odata, x3.size(), a2.size(), c1.size(), x2.size());
+  sort_indices<3,0,2,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), a2.size(), c1.size(), x2.size());
   out()->put_block(odata, x2, x3, c1, a2);
 }
 
@@ -727,8 +727,8 @@ void Task980::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, x2);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a3, x2);
-    sort_indices<0,1,1,1,-2,1>(i0data, odata, a3.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(a3, x2);
+    sort_indices<0,1,1,1,-2,1>(i0data, odata.get(), a3.size(), x2.size());
   }
   out()->put_block(odata, a3, x2);
 }
@@ -740,24 +740,24 @@ void Task981::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I903
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   for (auto& a3 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a3, c2, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a3, c2, x2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a3.size(), c2.size(), x2.size());
+      const double* i0data = in(0)->get_block_view(x3, a3, c2, x2);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, a3, c2, x2));
+      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a3.size(), c2.size(), x2.size());
       // tensor label: I1051
-      std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, x0, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, x0, x1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), x0.size(), x1.size());
+      const double* i1data = in(1)->get_block_view(a3, c2, x0, x1);
+      BlockBuffer i1data_sorted(in(1)->get_size(a3, c2, x0, x1));
+      sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), c2.size(), x0.size(), x1.size());
       dgemm_("T", "N", x3.size()*x2.size(), x0.size()*x1.size(), a3.size()*c2.size(),
-             1.0, i0data_sorted, a3.size()*c2.size(), i1data_sorted, a3.size()*c2.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), a3.size()*c2.size(), i1data_sorted.get(), a3.size()*c2.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x0.size(), x1.size());
+  sort_indices<3,2,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x0.size(), x1.size());
   out()->put_block(odata, x1, x0, x3, x2);
 }
 
@@ -768,22 +768,22 @@ void Task982::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I1051
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2, x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(a3, c2, x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, x1), 0.0);
   for (auto& a1 : *range_[2]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), a1.size());
+    const double* i0data = in(0)->get_block_view(x1, a1);
+    BlockBuffer i0data_sorted(in(0)->get_size(x1, a1));
+    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), a1.size());
     // tensor label: I1052
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, a1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, a1, x0)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), a1.size(), x0.size());
+    const double* i1data = in(1)->get_block_view(a3, c2, a1, x0);
+    BlockBuffer i1data_sorted(in(1)->get_size(a3, c2, a1, x0));
+    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), c2.size(), a1.size(), x0.size());
     dgemm_("T", "N", x1.size(), a3.size()*c2.size()*x0.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, x1.size());
+           1.0, i0data_sorted.get(), a1.size(), i1data_sorted.get(), a1.size(),
+           1.0, odata_sorted.get(), x1.size());
   }
-  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x1.size(), a3.size(), c2.size(), x0.size());
+  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), a3.size(), c2.size(), x0.size());
   out()->put_block(odata, a3, c2, x0, x1);
 }
 
@@ -796,8 +796,8 @@ void Task983::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata, x0.size(), a1.size(), c2.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, a3);
+    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), a3.size());
   }
   out()->put_block(odata, a3, c2, a1, x0);
 }
@@ -809,24 +809,24 @@ void Task984::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I903
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, x3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1, x3, x2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size(), x3.size(), x2.size());
+      const double* i0data = in(0)->get_block_view(c2, a1, x3, x2);
+      BlockBuffer i0data_sorted(in(0)->get_size(c2, a1, x3, x2));
+      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c2.size(), a1.size(), x3.size(), x2.size());
       // tensor label: I1063
-      std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x0, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x0, x1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x0.size(), x1.size());
+      const double* i1data = in(1)->get_block_view(c2, a1, x0, x1);
+      BlockBuffer i1data_sorted(in(1)->get_size(c2, a1, x0, x1));
+      sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted.get(), c2.size(), a1.size(), x0.size(), x1.size());
       dgemm_("T", "N", x3.size()*x2.size(), x0.size()*x1.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), c2.size()*a1.size(), i1data_sorted.get(), c2.size()*a1.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x0.size(), x1.size());
+  sort_indices<3,2,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x0.size(), x1.size());
   out()->put_block(odata, x1, x0, x3, x2);
 }
 
@@ -841,7 +841,7 @@ void Task985::Task_local::compute() {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
     dscal_(x1.size()*c2.size()*a1.size()*x0.size(), e0_, i0data.get(), 1);
-    sort_indices<2,1,0,3,1,1,2,1>(i0data, odata, x0.size(), a1.size(), c2.size(), x1.size());
+    sort_indices<2,1,0,3,1,1,2,1>(i0data.get(), odata.get(), x0.size(), a1.size(), c2.size(), x1.size());
   }
   out()->put_block(odata, c2, a1, x0, x1);
 }
@@ -853,22 +853,22 @@ void Task986::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I1063
   std::unique_ptr<double[]> odata = out()->move_block(c2, a1, x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1, x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(c2, a1, x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1, x0, x1), 0.0);
   for (auto& a3 : *range_[2]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a3)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(x1, a3);
+    BlockBuffer i0data_sorted(in(0)->get_size(x1, a3));
+    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), a3.size());
     // tensor label: I1064
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, a1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, a1, x0)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), a1.size(), x0.size());
+    const double* i1data = in(1)->get_block_view(a3, c2, a1, x0);
+    BlockBuffer i1data_sorted(in(1)->get_size(a3, c2, a1, x0));
+    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), c2.size(), a1.size(), x0.size());
     dgemm_("T", "N", x1.size(), c2.size()*a1.size()*x0.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, x1.size());
+           1.0, i0data_sorted.get(), a3.size(), i1data_sorted.get(), a3.size(),
+           1.0, odata_sorted.get(), x1.size());
   }
-  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x1.size(), c2.size(), a1.size(), x0.size());
+  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), c2.size(), a1.size(), x0.size());
   out()->put_block(odata, c2, a1, x0, x1);
 }
 
@@ -881,8 +881,8 @@ void Task987::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata, x0.size(), a1.size(), c2.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, a3);
+    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), a3.size());
   }
   out()->put_block(odata, a3, c2, a1, x0);
 }
@@ -894,24 +894,24 @@ void Task988::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I903
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   for (auto& a2 : *range_[2]) {
     for (auto& c1 : *range_[0]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a2, c1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a2, c1, x2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a2.size(), c1.size(), x2.size());
+      const double* i0data = in(0)->get_block_view(x3, a2, c1, x2);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, a2, c1, x2));
+      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a2.size(), c1.size(), x2.size());
       // tensor label: I1150
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, a2, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, a2, c1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), a2.size(), c1.size());
+      const double* i1data = in(1)->get_block_view(x1, x0, a2, c1);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, a2, c1));
+      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), a2.size(), c1.size());
       dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), a2.size()*c1.size(), i1data_sorted.get(), a2.size()*c1.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0, x3, x2);
 }
 
@@ -926,7 +926,7 @@ void Task989::Task_local::compute() {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x0, x1);
     dscal_(x1.size()*x0.size()*a2.size()*c1.size(), e0_, i0data.get(), 1);
-    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata, c1.size(), a2.size(), x0.size(), x1.size());
+    sort_indices<3,2,1,0,1,1,2,1>(i0data.get(), odata.get(), c1.size(), a2.size(), x0.size(), x1.size());
   }
   out()->put_block(odata, x1, x0, a2, c1);
 }
@@ -938,24 +938,24 @@ void Task990::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I903
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, x3, x2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), x3.size(), x2.size());
+      const double* i0data = in(0)->get_block_view(c1, a2, x3, x2);
+      BlockBuffer i0data_sorted(in(0)->get_size(c1, a2, x3, x2));
+      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size(), x3.size(), x2.size());
       // tensor label: I1153
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, a2, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, a2, c1)]);
-      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), a2.size(), c1.size());
+      const double* i1data = in(1)->get_block_view(x1, x0, a2, c1);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, a2, c1));
+      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), a2.size(), c1.size());
       dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), a2.size()*c1.size(), i1data_sorted.get(), a2.size()*c1.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0, x3, x2);
 }
 
@@ -970,7 +970,7 @@ void Task991::Task_local::compute() {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x0, x1);
     dscal_(x1.size()*x0.size()*a2.size()*c1.size(), e0_, i0data.get(), 1);
-    sort_indices<3,2,1,0,1,1,-4,1>(i0data, odata, c1.size(), a2.size(), x0.size(), x1.size());
+    sort_indices<3,2,1,0,1,1,-4,1>(i0data.get(), odata.get(), c1.size(), a2.size(), x0.size(), x1.size());
   }
   out()->put_block(odata, x1, x0, a2, c1);
 }
@@ -982,24 +982,24 @@ void Task992::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I903
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: v2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, x3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1, x3, x2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size(), x3.size(), x2.size());
+      const double* i0data = in(0)->get_block_view(c2, a1, x3, x2);
+      BlockBuffer i0data_sorted(in(0)->get_size(c2, a1, x3, x2));
+      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c2.size(), a1.size(), x3.size(), x2.size());
       // tensor label: I1183
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c2, a1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c2, a1, x0)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), c2.size(), a1.size(), x0.size());
+      const double* i1data = in(1)->get_block_view(x1, c2, a1, x0);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, c2, a1, x0));
+      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), c2.size(), a1.size(), x0.size());
       dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), c2.size()*a1.size(), i1data_sorted.get(), c2.size()*a1.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0, x3, x2);
 }
 
@@ -1012,8 +1012,8 @@ void Task993::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-    sort_indices<3,2,1,0,1,1,-1,1>(i0data, odata, x0.size(), a1.size(), c2.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, x1);
+    sort_indices<3,2,1,0,1,1,-1,1>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), x1.size());
   }
   out()->put_block(odata, x1, c2, a1, x0);
 }
@@ -1025,24 +1025,24 @@ void Task994::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I903
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: v2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, c2, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, c2, a1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), c2.size(), a1.size());
+      const double* i0data = in(0)->get_block_view(x3, x2, c2, a1);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, x2, c2, a1));
+      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x2.size(), c2.size(), a1.size());
       // tensor label: I1192
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c2, a1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c2, a1, x0)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), c2.size(), a1.size(), x0.size());
+      const double* i1data = in(1)->get_block_view(x1, c2, a1, x0);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, c2, a1, x0));
+      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), c2.size(), a1.size(), x0.size());
       dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), c2.size()*a1.size(), i1data_sorted.get(), c2.size()*a1.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0, x3, x2);
 }
 
@@ -1055,8 +1055,8 @@ void Task995::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-    sort_indices<3,2,1,0,1,1,-1,1>(i0data, odata, x0.size(), a1.size(), c2.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, x1);
+    sort_indices<3,2,1,0,1,1,-1,1>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), x1.size());
   }
   out()->put_block(odata, x1, c2, a1, x0);
 }
@@ -1068,24 +1068,24 @@ void Task996::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I903
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: v2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, x3, x2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), x3.size(), x2.size());
+      const double* i0data = in(0)->get_block_view(c1, a2, x3, x2);
+      BlockBuffer i0data_sorted(in(0)->get_size(c1, a2, x3, x2));
+      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size(), x3.size(), x2.size());
       // tensor label: I1195
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, a2, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, a2, c1)]);
-      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), a2.size(), c1.size());
+      const double* i1data = in(1)->get_block_view(x1, x0, a2, c1);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, a2, c1));
+      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), a2.size(), c1.size());
       dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), a2.size()*c1.size(), i1data_sorted.get(), a2.size()*c1.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0, x3, x2);
 }
 
@@ -1098,8 +1098,8 @@ void Task997::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x0, x1);
-    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata, c1.size(), a2.size(), x0.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, x0, x1);
+    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata.get(), c1.size(), a2.size(), x0.size(), x1.size());
   }
   out()->put_block(odata, x1, x0, a2, c1);
 }
@@ -1111,24 +1111,24 @@ void Task998::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I903
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   for (auto& a2 : *range_[2]) {
     for (auto& c1 : *range_[0]) {
       // tensor label: v2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a2, c1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a2, c1, x2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a2.size(), c1.size(), x2.size());
+      const double* i0data = in(0)->get_block_view(x3, a2, c1, x2);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, a2, c1, x2));
+      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a2.size(), c1.size(), x2.size());
       // tensor label: I1201
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, a2, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, a2, c1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), a2.size(), c1.size());
+      const double* i1data = in(1)->get_block_view(x1, x0, a2, c1);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, a2, c1));
+      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), a2.size(), c1.size());
       dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), a2.size()*c1.size(), i1data_sorted.get(), a2.size()*c1.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0, x3, x2);
 }
 
@@ -1141,8 +1141,8 @@ void Task999::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x0, x1);
-    sort_indices<3,2,1,0,1,1,-1,1>(i0data, odata, c1.size(), a2.size(), x0.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, x0, x1);
+    sort_indices<3,2,1,0,1,1,-1,1>(i0data, odata.get(), c1.size(), a2.size(), x0.size(), x1.size());
   }
   out()->put_block(odata, x1, x0, a2, c1);
 }
@@ -40,24 +40,24 @@ void Task1000::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I903
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: v2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, c1, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, c1, a2)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), c1.size(), a2.size());
+      const double* i0data = in(0)->get_block_view(x3, x2, c1, a2);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, x2, c1, a2));
+      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x2.size(), c1.size(), a2.size());
       // tensor label: I1204
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, a2, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, a2, c1)]);
-      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), a2.size(), c1.size());
+      const double* i1data = in(1)->get_block_view(x1, x0, a2, c1);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, a2, c1));
+      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), a2.size(), c1.size());
       dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), a2.size()*c1.size(), i1data_sorted.get(), a2.size()*c1.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0, x3, x2);
 }
 
@@ -70,8 +70,8 @@ void Task1001::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x0, x1);
-    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata, c1.size(), a2.size(), x0.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, x0, x1);
+    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata.get(), c1.size(), a2.size(), x0.size(), x1.size());
   }
   out()->put_block(odata, x1, x0, a2, c1);
 }
@@ -83,24 +83,24 @@ void Task1002::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I903
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: v2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, x0, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1, x0, x1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size(), x0.size(), x1.size());
+      const double* i0data = in(0)->get_block_view(c2, a1, x0, x1);
+      BlockBuffer i0data_sorted(in(0)->get_size(c2, a1, x0, x1));
+      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c2.size(), a1.size(), x0.size(), x1.size());
       // tensor label: I1237
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c2, a1, x3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c2, a1, x3)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, x2.size(), c2.size(), a1.size(), x3.size());
+      const double* i1data = in(1)->get_block_view(x2, c2, a1, x3);
+      BlockBuffer i1data_sorted(in(1)->get_size(x2, c2, a1, x3));
+      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), c2.size(), a1.size(), x3.size());
       dgemm_("T", "N", x0.size()*x1.size(), x2.size()*x3.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+             1.0, i0data_sorted.get(), c2.size()*a1.size(), i1data_sorted.get(), c2.size()*a1.size(),
+             1.0, odata_sorted.get(), x0.size()*x1.size());
     }
   }
-  sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x3.size());
+  sort_indices<1,0,3,2,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), x2.size(), x3.size());
   out()->put_block(odata, x1, x0, x3, x2);
 }
 
@@ -113,8 +113,8 @@ void Task1003::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x2, c2, a1, x3);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, c2, x2);
-    sort_indices<3,2,1,0,1,1,-1,1>(i0data, odata, x3.size(), a1.size(), c2.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x3, a1, c2, x2);
+    sort_indices<3,2,1,0,1,1,-1,1>(i0data, odata.get(), x3.size(), a1.size(), c2.size(), x2.size());
   }
   out()->put_block(odata, x2, c2, a1, x3);
 }
@@ -126,24 +126,24 @@ void Task1004::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I903
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: v2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1, c2, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1, c2, a1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size(), c2.size(), a1.size());
+      const double* i0data = in(0)->get_block_view(x0, x1, c2, a1);
+      BlockBuffer i0data_sorted(in(0)->get_size(x0, x1, c2, a1));
+      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), x1.size(), c2.size(), a1.size());
       // tensor label: I1246
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c2, a1, x3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c2, a1, x3)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, x2.size(), c2.size(), a1.size(), x3.size());
+      const double* i1data = in(1)->get_block_view(x2, c2, a1, x3);
+      BlockBuffer i1data_sorted(in(1)->get_size(x2, c2, a1, x3));
+      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), c2.size(), a1.size(), x3.size());
       dgemm_("T", "N", x0.size()*x1.size(), x2.size()*x3.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+             1.0, i0data_sorted.get(), c2.size()*a1.size(), i1data_sorted.get(), c2.size()*a1.size(),
+             1.0, odata_sorted.get(), x0.size()*x1.size());
     }
   }
-  sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x3.size());
+  sort_indices<1,0,3,2,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), x2.size(), x3.size());
   out()->put_block(odata, x1, x0, x3, x2);
 }
 
@@ -156,8 +156,8 @@ void Task1005::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x2, c2, a1, x3);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, c2, x2);
-    sort_indices<3,2,1,0,1,1,-1,1>(i0data, odata, x3.size(), a1.size(), c2.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x3, a1, c2, x2);
+    sort_indices<3,2,1,0,1,1,-1,1>(i0data, odata.get(), x3.size(), a1.size(), c2.size(), x2.size());
   }
   out()->put_block(odata, x2, c2, a1, x3);
 }
@@ -169,24 +169,24 @@ void Task1006::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I903
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: v2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x0, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, x0, x1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), x0.size(), x1.size());
+      const double* i0data = in(0)->get_block_view(c1, a2, x0, x1);
+      BlockBuffer i0data_sorted(in(0)->get_size(c1, a2, x0, x1));
+      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size(), x0.size(), x1.size());
       // tensor label: I1249
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x2, x3, a2, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, x3, a2, c1)]);
-      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted, x2.size(), x3.size(), a2.size(), c1.size());
+      const double* i1data = in(1)->get_block_view(x2, x3, a2, c1);
+      BlockBuffer i1data_sorted(in(1)->get_size(x2, x3, a2, c1));
+      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), x3.size(), a2.size(), c1.size());
       dgemm_("T", "N", x0.size()*x1.size(), x2.size()*x3.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+             1.0, i0data_sorted.get(), a2.size()*c1.size(), i1data_sorted.get(), a2.size()*c1.size(),
+             1.0, odata_sorted.get(), x0.size()*x1.size());
     }
   }
-  sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x3.size());
+  sort_indices<1,0,3,2,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), x2.size(), x3.size());
   out()->put_block(odata, x1, x0, x3, x2);
 }
 
@@ -199,8 +199,8 @@ void Task1007::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x2, x3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x3, x2);
-    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata, c1.size(), a2.size(), x3.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, x3, x2);
+    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata.get(), c1.size(), a2.size(), x3.size(), x2.size());
   }
   out()->put_block(odata, x2, x3, a2, c1);
 }
@@ -212,24 +212,24 @@ void Task1008::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I903
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   for (auto& a2 : *range_[2]) {
     for (auto& c1 : *range_[0]) {
       // tensor label: v2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a2, c1, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a2, c1, x1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a2.size(), c1.size(), x1.size());
+      const double* i0data = in(0)->get_block_view(x0, a2, c1, x1);
+      BlockBuffer i0data_sorted(in(0)->get_size(x0, a2, c1, x1));
+      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), a2.size(), c1.size(), x1.size());
       // tensor label: I1255
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x2, x3, a2, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, x3, a2, c1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, x2.size(), x3.size(), a2.size(), c1.size());
+      const double* i1data = in(1)->get_block_view(x2, x3, a2, c1);
+      BlockBuffer i1data_sorted(in(1)->get_size(x2, x3, a2, c1));
+      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), x3.size(), a2.size(), c1.size());
       dgemm_("T", "N", x0.size()*x1.size(), x2.size()*x3.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+             1.0, i0data_sorted.get(), a2.size()*c1.size(), i1data_sorted.get(), a2.size()*c1.size(),
+             1.0, odata_sorted.get(), x0.size()*x1.size());
     }
   }
-  sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x3.size());
+  sort_indices<1,0,3,2,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), x2.size(), x3.size());
   out()->put_block(odata, x1, x0, x3, x2);
 }
 
@@ -242,8 +242,8 @@ void Task1009::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x2, x3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x3, x2);
-    sort_indices<3,2,1,0,1,1,-1,1>(i0data, odata, c1.size(), a2.size(), x3.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, x3, x2);
+    sort_indices<3,2,1,0,1,1,-1,1>(i0data, odata.get(), c1.size(), a2.size(), x3.size(), x2.size());
   }
   out()->put_block(odata, x2, x3, a2, c1);
 }
@@ -255,24 +255,24 @@ void Task1010::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I903
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: v2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1, c1, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1, c1, a2)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size(), c1.size(), a2.size());
+      const double* i0data = in(0)->get_block_view(x0, x1, c1, a2);
+      BlockBuffer i0data_sorted(in(0)->get_size(x0, x1, c1, a2));
+      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), x1.size(), c1.size(), a2.size());
       // tensor label: I1258
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x2, x3, a2, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, x3, a2, c1)]);
-      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted, x2.size(), x3.size(), a2.size(), c1.size());
+      const double* i1data = in(1)->get_block_view(x2, x3, a2, c1);
+      BlockBuffer i1data_sorted(in(1)->get_size(x2, x3, a2, c1));
+      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), x3.size(), a2.size(), c1.size());
       dgemm_("T", "N", x0.size()*x1.size(), x2.size()*x3.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+             1.0, i0data_sorted.get(), a2.size()*c1.size(), i1data_sorted.get(), a2.size()*c1.size(),
+             1.0, odata_sorted.get(), x0.size()*x1.size());
     }
   }
-  sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x3.size());
+  sort_indices<1,0,3,2,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), x2.size(), x3.size());
   out()->put_block(odata, x1, x0, x3, x2);
 }
 
@@ -285,8 +285,8 @@ void Task1011::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x2, x3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x3, x2);
-    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata, c1.size(), a2.size(), x3.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, x3, x2);
+    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata.get(), c1.size(), a2.size(), x3.size(), x2.size());
   }
   out()->put_block(odata, x2, x3, a2, c1);
 }
@@ -295,7 +295,7 @@ void Task1012::Task_local::compute() {
   const Index ci0 = b(0);
   // tensor label: I768
   std::unique_ptr<double[]> odata = out()->move_block(ci0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(ci0)]);
+  BlockBuffer odata_sorted(out()->get_size(ci0));
   std::fill_n(odata_sorted.get(), out()->get_size(ci0), 0.0);
   for (auto& x5 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
@@ -304,23 +304,23 @@ void Task1012::Task_local::compute() {
           for (auto& x1 : *range_[1]) {
             for (auto& x2 : *range_[1]) {
               // tensor label: Gamma307
-              std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x5, x0, x4, x3, x1, x2);
-              std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(ci0, x5, x0, x4, x3, x1, x2)]);
-              sort_indices<1,2,3,4,5,6,0,0,1,1,1>(i0data, i0data_sorted, ci0.size(), x5.size(), x0.size(), x4.size(), x3.size(), x1.size(), x2.size());
+              const double* i0data = in(0)->get_block_view(ci0, x5, x0, x4, x3, x1, x2);
+              BlockBuffer i0data_sorted(in(0)->get_size(ci0, x5, x0, x4, x3, x1, x2));
+              sort_indices<1,2,3,4,5,6,0,0,1,1,1>(i0data, i0data_sorted.get(), ci0.size(), x5.size(), x0.size(), x4.size(), x3.size(), x1.size(), x2.size());
               // tensor label: I911
-              std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, x2, x5, x4, x3);
-              std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, x2, x5, x4, x3)]);
-              sort_indices<3,1,4,5,0,2,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), x2.size(), x5.size(), x4.size(), x3.size());
+              const double* i1data = in(1)->get_block_view(x1, x0, x2, x5, x4, x3);
+              BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, x2, x5, x4, x3));
+              sort_indices<3,1,4,5,0,2,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), x2.size(), x5.size(), x4.size(), x3.size());
               dgemm_("T", "N", ci0.size(), 1, x1.size()*x0.size()*x2.size()*x5.size()*x4.size()*x3.size(),
-                     1.0, i0data_sorted, x1.size()*x0.size()*x2.size()*x5.size()*x4.size()*x3.size(), i1data_sorted, x1.size()*x0.size()*x2.size()*x5.size()*x4.size()*x3.size(),
-                     1.0, odata_sorted, ci0.size());
+                     1.0, i0data_sorted.get(), x1.size()*x0.size()*x2.size()*x5.size()*x4.size()*x3.size(), i1data_sorted.get(), x1.size()*x0.size()*x2.size()*x5.size()*x4.size()*x3.size(),
+                     1.0, odata_sorted.get(), ci0.size());
             }
           }
         }
       }
     }
   }
-  sort_indices<0,1,1,1,1>(odata_sorted, odata, ci0.size());
+  sort_indices<0,1,1,1,1>(odata_sorted.get(), odata.get(), ci0.size());
   out()->put_block(odata, ci0);
 }
 
@@ -333,22 +333,22 @@ void Task1013::Task_local::compute() {
   const Index x3 = b(5);
   // tensor label: I911
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x2, x5, x4, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x2, x5, x4, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x2, x5, x4, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x2, x5, x4, x3), 0.0);
   for (auto& a1 : *range_[2]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, x4, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a1, x4, x3)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), a1.size(), x4.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(x5, a1, x4, x3);
+    BlockBuffer i0data_sorted(in(0)->get_size(x5, a1, x4, x3));
+    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), a1.size(), x4.size(), x3.size());
     // tensor label: I912
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a1, x0, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a1, x0, x2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), a1.size(), x0.size(), x2.size());
+    const double* i1data = in(1)->get_block_view(x1, a1, x0, x2);
+    BlockBuffer i1data_sorted(in(1)->get_size(x1, a1, x0, x2));
+    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), a1.size(), x0.size(), x2.size());
     dgemm_("T", "N", x5.size()*x4.size()*x3.size(), x1.size()*x0.size()*x2.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, x5.size()*x4.size()*x3.size());
+           1.0, i0data_sorted.get(), a1.size(), i1data_sorted.get(), a1.size(),
+           1.0, odata_sorted.get(), x5.size()*x4.size()*x3.size());
   }
-  sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), x1.size(), x0.size(), x2.size());
+  sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x5.size(), x4.size(), x3.size(), x1.size(), x0.size(), x2.size());
   out()->put_block(odata, x1, x0, x2, x5, x4, x3);
 }
 
@@ -359,22 +359,22 @@ void Task1014::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I912
   std::unique_ptr<double[]> odata = out()->move_block(x1, a1, x0, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, a1, x0, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, a1, x0, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, a1, x0, x2), 0.0);
   for (auto& c2 : *range_[0]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c2, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, x2)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(c2, x2);
+    BlockBuffer i0data_sorted(in(0)->get_size(c2, x2));
+    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), c2.size(), x2.size());
     // tensor label: I913
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c2, a1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c2, a1, x0)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), c2.size(), a1.size(), x0.size());
+    const double* i1data = in(1)->get_block_view(x1, c2, a1, x0);
+    BlockBuffer i1data_sorted(in(1)->get_size(x1, c2, a1, x0));
+    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), c2.size(), a1.size(), x0.size());
     dgemm_("T", "N", x2.size(), x1.size()*a1.size()*x0.size(), c2.size(),
-           1.0, i0data_sorted, c2.size(), i1data_sorted, c2.size(),
-           1.0, odata_sorted, x2.size());
+           1.0, i0data_sorted.get(), c2.size(), i1data_sorted.get(), c2.size(),
+           1.0, odata_sorted.get(), x2.size());
   }
-  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size(), a1.size(), x0.size());
+  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted.get(), odata.get(), x2.size(), x1.size(), a1.size(), x0.size());
   out()->put_block(odata, x1, a1, x0, x2);
 }
 
@@ -387,8 +387,8 @@ void Task1015::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata, x0.size(), a1.size(), c2.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, x1);
+    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), x1.size());
   }
   out()->put_block(odata, x1, c2, a1, x0);
 }
@@ -397,24 +397,24 @@ void Task1016::Task_local::compute() {
   const Index ci0 = b(0);
   // tensor label: I768
   std::unique_ptr<double[]> odata = out()->move_block(ci0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(ci0)]);
+  BlockBuffer odata_sorted(out()->get_size(ci0));
   std::fill_n(odata_sorted.get(), out()->get_size(ci0), 0.0);
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma308
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(ci0, x1, x0)]);
-      sort_indices<1,2,0,0,1,1,1>(i0data, i0data_sorted, ci0.size(), x1.size(), x0.size());
+      const double* i0data = in(0)->get_block_view(ci0, x1, x0);
+      BlockBuffer i0data_sorted(in(0)->get_size(ci0, x1, x0));
+      sort_indices<1,2,0,0,1,1,1>(i0data, i0data_sorted.get(), ci0.size(), x1.size(), x0.size());
       // tensor label: I915
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0)]);
-      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size());
+      const double* i1data = in(1)->get_block_view(x1, x0);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, x0));
+      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size());
       dgemm_("T", "N", ci0.size(), 1, x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, ci0.size());
+             1.0, i0data_sorted.get(), x1.size()*x0.size(), i1data_sorted.get(), x1.size()*x0.size(),
+             1.0, odata_sorted.get(), ci0.size());
     }
   }
-  sort_indices<0,1,1,1,1>(odata_sorted, odata, ci0.size());
+  sort_indices<0,1,1,1,1>(odata_sorted.get(), odata.get(), ci0.size());
   out()->put_block(odata, ci0);
 }
 
@@ -423,24 +423,24 @@ void Task1017::Task_local::compute() {
   const Index x0 = b(1);
   // tensor label: I915
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, x1)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
+      const double* i0data = in(0)->get_block_view(x0, a1, c2, x1);
+      BlockBuffer i0data_sorted(in(0)->get_size(x0, a1, c2, x1));
+      sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), a1.size(), c2.size(), x1.size());
       // tensor label: I916
-      std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1)]);
-      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size());
+      const double* i1data = in(1)->get_block_view(c2, a1);
+      BlockBuffer i1data_sorted(in(1)->get_size(c2, a1));
+      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), c2.size(), a1.size());
       dgemm_("T", "N", x1.size()*x0.size(), 1, c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+             1.0, i0data_sorted.get(), c2.size()*a1.size(), i1data_sorted.get(), c2.size()*a1.size(),
+             1.0, odata_sorted.get(), x1.size()*x0.size());
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size());
   out()->put_block(odata, x1, x0);
 }
 
@@ -449,24 +449,24 @@ void Task1018::Task_local::compute() {
   const Index a1 = b(1);
   // tensor label: I916
   std::unique_ptr<double[]> odata = out()->move_block(c2, a1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1)]);
+  BlockBuffer odata_sorted(out()->get_size(c2, a1));
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1), 0.0);
   for (auto& a4 : *range_[2]) {
     for (auto& c3 : *range_[0]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a4, c3, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a4, c3, a1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a4.size(), c3.size(), a1.size());
+      const double* i0data = in(0)->get_block_view(c2, a4, c3, a1);
+      BlockBuffer i0data_sorted(in(0)->get_size(c2, a4, c3, a1));
+      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted.get(), c2.size(), a4.size(), c3.size(), a1.size());
       // tensor label: I917
-      std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c3)]);
-      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a4.size(), c3.size());
+      const double* i1data = in(1)->get_block_view(a4, c3);
+      BlockBuffer i1data_sorted(in(1)->get_size(a4, c3));
+      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), c3.size());
       dgemm_("T", "N", c2.size()*a1.size(), 1, a4.size()*c3.size(),
-             1.0, i0data_sorted, a4.size()*c3.size(), i1data_sorted, a4.size()*c3.size(),
-             1.0, odata_sorted, c2.size()*a1.size());
+             1.0, i0data_sorted.get(), a4.size()*c3.size(), i1data_sorted.get(), a4.size()*c3.size(),
+             1.0, odata_sorted.get(), c2.size()*a1.size());
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), c2.size(), a1.size());
   out()->put_block(odata, c2, a1);
 }
 
@@ -477,8 +477,8 @@ void Task1019::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a4, c3);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a4, c3);
-    sort_indices<0,1,1,1,4,1>(i0data, odata, a4.size(), c3.size());
+    const double* i0data = in(0)->get_block_view(a4, c3);
+    sort_indices<0,1,1,1,4,1>(i0data, odata.get(), a4.size(), c3.size());
   }
   out()->put_block(odata, a4, c3);
 }
@@ -488,24 +488,24 @@ void Task1020::Task_local::compute() {
   const Index a1 = b(1);
   // tensor label: I916
   std::unique_ptr<double[]> odata = out()->move_block(c2, a1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1)]);
+  BlockBuffer odata_sorted(out()->get_size(c2, a1));
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1), 0.0);
   for (auto& c3 : *range_[0]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, c3, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1, c3, a4)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size(), c3.size(), a4.size());
+      const double* i0data = in(0)->get_block_view(c2, a1, c3, a4);
+      BlockBuffer i0data_sorted(in(0)->get_size(c2, a1, c3, a4));
+      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted.get(), c2.size(), a1.size(), c3.size(), a4.size());
       // tensor label: I921
-      std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c3)]);
-      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, a4.size(), c3.size());
+      const double* i1data = in(1)->get_block_view(a4, c3);
+      BlockBuffer i1data_sorted(in(1)->get_size(a4, c3));
+      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), c3.size());
       dgemm_("T", "N", c2.size()*a1.size(), 1, a4.size()*c3.size(),
-             1.0, i0data_sorted, a4.size()*c3.size(), i1data_sorted, a4.size()*c3.size(),
-             1.0, odata_sorted, c2.size()*a1.size());
+             1.0, i0data_sorted.get(), a4.size()*c3.size(), i1data_sorted.get(), a4.size()*c3.size(),
+             1.0, odata_sorted.get(), c2.size()*a1.size());
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), c2.size(), a1.size());
   out()->put_block(odata, c2, a1);
 }
 
@@ -516,8 +516,8 @@ void Task1021::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a4, c3);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a4, c3);
-    sort_indices<0,1,1,1,-8,1>(i0data, odata, a4.size(), c3.size());
+    const double* i0data = in(0)->get_block_view(a4, c3);
+    sort_indices<0,1,1,1,-8,1>(i0data, odata.get(), a4.size(), c3.size());
   }
   out()->put_block(odata, a4, c3);
 }
@@ -527,24 +527,24 @@ void Task1022::Task_local::compute() {
   const Index x0 = b(1);
   // tensor label: I915
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
   for (auto& a2 : *range_[2]) {
     for (auto& c1 : *range_[0]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x0, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, x0, x1)]);
-      sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), x0.size(), x1.size());
+      const double* i0data = in(0)->get_block_view(c1, a2, x0, x1);
+      BlockBuffer i0data_sorted(in(0)->get_size(c1, a2, x0, x1));
+      sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size(), x0.size(), x1.size());
       // tensor label: I970
-      std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2)]);
-      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, c1.size(), a2.size());
+      const double* i1data = in(1)->get_block_view(c1, a2);
+      BlockBuffer i1data_sorted(in(1)->get_size(c1, a2));
+      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), c1.size(), a2.size());
       dgemm_("T", "N", x1.size()*x0.size(), 1, c1.size()*a2.size(),
-             1.0, i0data_sorted, c1.size()*a2.size(), i1data_sorted, c1.size()*a2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+             1.0, i0data_sorted.get(), c1.size()*a2.size(), i1data_sorted.get(), c1.size()*a2.size(),
+             1.0, odata_sorted.get(), x1.size()*x0.size());
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size());
   out()->put_block(odata, x1, x0);
 }
 
@@ -553,24 +553,24 @@ void Task1023::Task_local::compute() {
   const Index a2 = b(1);
   // tensor label: I970
   std::unique_ptr<double[]> odata = out()->move_block(c1, a2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, a2)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, a2));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, a2), 0.0);
   for (auto& a4 : *range_[2]) {
     for (auto& c3 : *range_[0]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a4, c3, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a4, c3, a2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a4.size(), c3.size(), a2.size());
+      const double* i0data = in(0)->get_block_view(c1, a4, c3, a2);
+      BlockBuffer i0data_sorted(in(0)->get_size(c1, a4, c3, a2));
+      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a4.size(), c3.size(), a2.size());
       // tensor label: I971
-      std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c3)]);
-      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a4.size(), c3.size());
+      const double* i1data = in(1)->get_block_view(a4, c3);
+      BlockBuffer i1data_sorted(in(1)->get_size(a4, c3));
+      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), c3.size());
       dgemm_("T", "N", c1.size()*a2.size(), 1, a4.size()*c3.size(),
-             1.0, i0data_sorted, a4.size()*c3.size(), i1data_sorted, a4.size()*c3.size(),
-             1.0, odata_sorted, c1.size()*a2.size());
+             1.0, i0data_sorted.get(), a4.size()*c3.size(), i1data_sorted.get(), a4.size()*c3.size(),
+             1.0, odata_sorted.get(), c1.size()*a2.size());
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), c1.size(), a2.size());
   out()->put_block(odata, c1, a2);
 }
 
@@ -581,8 +581,8 @@ void Task1024::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a4, c3);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a4, c3);
-    sort_indices<0,1,1,1,-8,1>(i0data, odata, a4.size(), c3.size());
+    const double* i0data = in(0)->get_block_view(a4, c3);
+    sort_indices<0,1,1,1,-8,1>(i0data, odata.get(), a4.size(), c3.size());
   }
   out()->put_block(odata, a4, c3);
 }
@@ -592,24 +592,24 @@ void Task1025::Task_local::compute() {
   const Index a2 = b(1);
   // tensor label: I970
   std::unique_ptr<double[]> odata = out()->move_block(c1, a2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, a2)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, a2));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, a2), 0.0);
   for (auto& c3 : *range_[0]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, a4)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
+      const double* i0data = in(0)->get_block_view(c1, a2, c3, a4);
+      BlockBuffer i0data_sorted(in(0)->get_size(c1, a2, c3, a4));
+      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size(), c3.size(), a4.size());
       // tensor label: I975
-      std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c3)]);
-      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, a4.size(), c3.size());
+      const double* i1data = in(1)->get_block_view(a4, c3);
+      BlockBuffer i1data_sorted(in(1)->get_size(a4, c3));
+      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), c3.size());
       dgemm_("T", "N", c1.size()*a2.size(), 1, a4.size()*c3.size(),
-             1.0, i0data_sorted, a4.size()*c3.size(), i1data_sorted, a4.size()*c3.size(),
-             1.0, odata_sorted, c1.size()*a2.size());
+             1.0, i0data_sorted.get(), a4.size()*c3.size(), i1data_sorted.get(), a4.size()*c3.size(),
+             1.0, odata_sorted.get(), c1.size()*a2.size());
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), c1.size(), a2.size());
   out()->put_block(odata, c1, a2);
 }
 
@@ -620,8 +620,8 @@ void Task1026::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a4, c3);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a4, c3);
-    sort_indices<0,1,1,1,16,1>(i0data, odata, a4.size(), c3.size());
+    const double* i0data = in(0)->get_block_view(a4, c3);
+    sort_indices<0,1,1,1,16,1>(i0data, odata.get(), a4.size(), c3.size());
   }
   out()->put_block(odata, a4, c3);
 }
@@ -631,24 +631,24 @@ void Task1027::Task_local::compute() {
   const Index x0 = b(1);
   // tensor label: I915
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
   for (auto& a4 : *range_[2]) {
     for (auto& c1 : *range_[0]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a4, c1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a4, c1, x0)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), a4.size(), c1.size(), x0.size());
+      const double* i0data = in(0)->get_block_view(x1, a4, c1, x0);
+      BlockBuffer i0data_sorted(in(0)->get_size(x1, a4, c1, x0));
+      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), a4.size(), c1.size(), x0.size());
       // tensor label: I1021
-      std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c1)]);
-      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a4.size(), c1.size());
+      const double* i1data = in(1)->get_block_view(a4, c1);
+      BlockBuffer i1data_sorted(in(1)->get_size(a4, c1));
+      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), c1.size());
       dgemm_("T", "N", x1.size()*x0.size(), 1, a4.size()*c1.size(),
-             1.0, i0data_sorted, a4.size()*c1.size(), i1data_sorted, a4.size()*c1.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+             1.0, i0data_sorted.get(), a4.size()*c1.size(), i1data_sorted.get(), a4.size()*c1.size(),
+             1.0, odata_sorted.get(), x1.size()*x0.size());
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0);
 }
 
@@ -657,24 +657,24 @@ void Task1028::Task_local::compute() {
   const Index c1 = b(1);
   // tensor label: I1021
   std::unique_ptr<double[]> odata = out()->move_block(a4, c1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, c1)]);
+  BlockBuffer odata_sorted(out()->get_size(a4, c1));
   std::fill_n(odata_sorted.get(), out()->get_size(a4, c1), 0.0);
   for (auto& c3 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: f1
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a2)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c3.size(), a2.size());
+      const double* i0data = in(0)->get_block_view(c3, a2);
+      BlockBuffer i0data_sorted(in(0)->get_size(c3, a2));
+      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), c3.size(), a2.size());
       // tensor label: I1022
-      std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c3, a2, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c3, a2, c1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, a4.size(), c3.size(), a2.size(), c1.size());
+      const double* i1data = in(1)->get_block_view(a4, c3, a2, c1);
+      BlockBuffer i1data_sorted(in(1)->get_size(a4, c3, a2, c1));
+      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), c3.size(), a2.size(), c1.size());
       dgemm_("T", "N", 1, a4.size()*c1.size(), c3.size()*a2.size(),
-             1.0, i0data_sorted, c3.size()*a2.size(), i1data_sorted, c3.size()*a2.size(),
-             1.0, odata_sorted, 1);
+             1.0, i0data_sorted.get(), c3.size()*a2.size(), i1data_sorted.get(), c3.size()*a2.size(),
+             1.0, odata_sorted.get(), 1);
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, a4.size(), c1.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), a4.size(), c1.size());
   out()->put_block(odata, a4, c1);
 }
 
@@ -687,8 +687,8 @@ void Task1029::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a4, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata, c1.size(), a2.size(), c3.size(), a4.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, a4);
+    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), a4.size());
   }
   out()->put_block(odata, a4, c3, a2, c1);
 }
@@ -698,24 +698,24 @@ void Task1030::Task_local::compute() {
   const Index x0 = b(1);
   // tensor label: I915
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
   for (auto& a2 : *range_[2]) {
     for (auto& c1 : *range_[0]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a2, c1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a2, c1, x0)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), a2.size(), c1.size(), x0.size());
+      const double* i0data = in(0)->get_block_view(x1, a2, c1, x0);
+      BlockBuffer i0data_sorted(in(0)->get_size(x1, a2, c1, x0));
+      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), a2.size(), c1.size(), x0.size());
       // tensor label: I1025
-      std::unique_ptr<double[]> i1data = in(1)->get_block(a2, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, c1)]);
-      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a2.size(), c1.size());
+      const double* i1data = in(1)->get_block_view(a2, c1);
+      BlockBuffer i1data_sorted(in(1)->get_size(a2, c1));
+      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a2.size(), c1.size());
       dgemm_("T", "N", x1.size()*x0.size(), 1, a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+             1.0, i0data_sorted.get(), a2.size()*c1.size(), i1data_sorted.get(), a2.size()*c1.size(),
+             1.0, odata_sorted.get(), x1.size()*x0.size());
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0);
 }
 
@@ -724,24 +724,24 @@ void Task1031::Task_local::compute() {
   const Index c1 = b(1);
   // tensor label: I1025
   std::unique_ptr<double[]> odata = out()->move_block(a2, c1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1)]);
+  BlockBuffer odata_sorted(out()->get_size(a2, c1));
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1), 0.0);
   for (auto& c3 : *range_[0]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: f1
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a4)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c3.size(), a4.size());
+      const double* i0data = in(0)->get_block_view(c3, a4);
+      BlockBuffer i0data_sorted(in(0)->get_size(c3, a4));
+      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), c3.size(), a4.size());
       // tensor label: I1026
-      std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c3, a2, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c3, a2, c1)]);
-      sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, a4.size(), c3.size(), a2.size(), c1.size());
+      const double* i1data = in(1)->get_block_view(a4, c3, a2, c1);
+      BlockBuffer i1data_sorted(in(1)->get_size(a4, c3, a2, c1));
+      sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), c3.size(), a2.size(), c1.size());
       dgemm_("T", "N", 1, a2.size()*c1.size(), a4.size()*c3.size(),
-             1.0, i0data_sorted, a4.size()*c3.size(), i1data_sorted, a4.size()*c3.size(),
-             1.0, odata_sorted, 1);
+             1.0, i0data_sorted.get(), a4.size()*c3.size(), i1data_sorted.get(), a4.size()*c3.size(),
+             1.0, odata_sorted.get(), 1);
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, a2.size(), c1.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), a2.size(), c1.size());
   out()->put_block(odata, a2, c1);
 }
 
@@ -754,8 +754,8 @@ void Task1032::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a4, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-    sort_indices<3,2,1,0,1,1,-8,1>(i0data, odata, c1.size(), a2.size(), c3.size(), a4.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, a4);
+    sort_indices<3,2,1,0,1,1,-8,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), a4.size());
   }
   out()->put_block(odata, a4, c3, a2, c1);
 }
@@ -765,24 +765,24 @@ void Task1033::Task_local::compute() {
   const Index x0 = b(1);
   // tensor label: I915
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a4, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a4, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a4.size(), x1.size(), x0.size());
+      const double* i0data = in(0)->get_block_view(c1, a4, x1, x0);
+      BlockBuffer i0data_sorted(in(0)->get_size(c1, a4, x1, x0));
+      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a4.size(), x1.size(), x0.size());
       // tensor label: I1029
-      std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c1)]);
-      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, a4.size(), c1.size());
+      const double* i1data = in(1)->get_block_view(a4, c1);
+      BlockBuffer i1data_sorted(in(1)->get_size(a4, c1));
+      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), c1.size());
       dgemm_("T", "N", x1.size()*x0.size(), 1, a4.size()*c1.size(),
-             1.0, i0data_sorted, a4.size()*c1.size(), i1data_sorted, a4.size()*c1.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+             1.0, i0data_sorted.get(), a4.size()*c1.size(), i1data_sorted.get(), a4.size()*c1.size(),
+             1.0, odata_sorted.get(), x1.size()*x0.size());
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0);
 }
 
@@ -791,24 +791,24 @@ void Task1034::Task_local::compute() {
   const Index c1 = b(1);
   // tensor label: I1029
   std::unique_ptr<double[]> odata = out()->move_block(a4, c1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, c1)]);
+  BlockBuffer odata_sorted(out()->get_size(a4, c1));
   std::fill_n(odata_sorted.get(), out()->get_size(a4, c1), 0.0);
   for (auto& c3 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: f1
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a2)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c3.size(), a2.size());
+      const double* i0data = in(0)->get_block_view(c3, a2);
+      BlockBuffer i0data_sorted(in(0)->get_size(c3, a2));
+      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), c3.size(), a2.size());
       // tensor label: I1030
-      std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c3, a2, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c3, a2, c1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, a4.size(), c3.size(), a2.size(), c1.size());
+      const double* i1data = in(1)->get_block_view(a4, c3, a2, c1);
+      BlockBuffer i1data_sorted(in(1)->get_size(a4, c3, a2, c1));
+      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), c3.size(), a2.size(), c1.size());
       dgemm_("T", "N", 1, a4.size()*c1.size(), c3.size()*a2.size(),
-             1.0, i0data_sorted, c3.size()*a2.size(), i1data_sorted, c3.size()*a2.size(),
-             1.0, odata_sorted, 1);
+             1.0, i0data_sorted.get(), c3.size()*a2.size(), i1data_sorted.get(), c3.size()*a2.size(),
+             1.0, odata_sorted.get(), 1);
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, a4.size(), c1.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), a4.size(), c1.size());
   out()->put_block(odata, a4, c1);
 }
 
@@ -821,8 +821,8 @@ void Task1035::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a4, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-    sort_indices<3,2,1,0,1,1,-8,1>(i0data, odata, c1.size(), a2.size(), c3.size(), a4.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, a4);
+    sort_indices<3,2,1,0,1,1,-8,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), a4.size());
   }
   out()->put_block(odata, a4, c3, a2, c1);
 }
@@ -832,24 +832,24 @@ void Task1036::Task_local::compute() {
   const Index x0 = b(1);
   // tensor label: I915
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), x1.size(), x0.size());
+      const double* i0data = in(0)->get_block_view(c1, a2, x1, x0);
+      BlockBuffer i0data_sorted(in(0)->get_size(c1, a2, x1, x0));
+      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size(), x1.size(), x0.size());
       // tensor label: I1033
-      std::unique_ptr<double[]> i1data = in(1)->get_block(a2, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, c1)]);
-      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, a2.size(), c1.size());
+      const double* i1data = in(1)->get_block_view(a2, c1);
+      BlockBuffer i1data_sorted(in(1)->get_size(a2, c1));
+      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), a2.size(), c1.size());
       dgemm_("T", "N", x1.size()*x0.size(), 1, a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+             1.0, i0data_sorted.get(), a2.size()*c1.size(), i1data_sorted.get(), a2.size()*c1.size(),
+             1.0, odata_sorted.get(), x1.size()*x0.size());
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0);
 }
 
@@ -858,24 +858,24 @@ void Task1037::Task_local::compute() {
   const Index c1 = b(1);
   // tensor label: I1033
   std::unique_ptr<double[]> odata = out()->move_block(a2, c1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1)]);
+  BlockBuffer odata_sorted(out()->get_size(a2, c1));
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1), 0.0);
   for (auto& c3 : *range_[0]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: f1
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a4)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c3.size(), a4.size());
+      const double* i0data = in(0)->get_block_view(c3, a4);
+      BlockBuffer i0data_sorted(in(0)->get_size(c3, a4));
+      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), c3.size(), a4.size());
       // tensor label: I1034
-      std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c3, a2, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c3, a2, c1)]);
-      sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, a4.size(), c3.size(), a2.size(), c1.size());
+      const double* i1data = in(1)->get_block_view(a4, c3, a2, c1);
+      BlockBuffer i1data_sorted(in(1)->get_size(a4, c3, a2, c1));
+      sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), c3.size(), a2.size(), c1.size());
       dgemm_("T", "N", 1, a2.size()*c1.size(), a4.size()*c3.size(),
-             1.0, i0data_sorted, a4.size()*c3.size(), i1data_sorted, a4.size()*c3.size(),
-             1.0, odata_sorted, 1);
+             1.0, i0data_sorted.get(), a4.size()*c3.size(), i1data_sorted.get(), a4.size()*c3.size(),
+             1.0, odata_sorted.get(), 1);
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, a2.size(), c1.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), a2.size(), c1.size());
   out()->put_block(odata, a2, c1);
 }
 
@@ -888,8 +888,8 @@ void Task1038::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a4, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-    sort_indices<3,2,1,0,1,1,16,1>(i0data, odata, c1.size(), a2.size(), c3.size(), a4.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, a4);
+    sort_indices<3,2,1,0,1,1,16,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), a4.size());
   }
   out()->put_block(odata, a4, c3, a2, c1);
 }
@@ -899,22 +899,22 @@ void Task1039::Task_local::compute() {
   const Index x0 = b(1);
   // tensor label: I915
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
   for (auto& c3 : *range_[0]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c3, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, x0)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c3.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(c3, x0);
+    BlockBuffer i0data_sorted(in(0)->get_size(c3, x0));
+    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), c3.size(), x0.size());
     // tensor label: I1043
-    std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x1)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, c3.size(), x1.size());
+    const double* i1data = in(1)->get_block_view(c3, x1);
+    BlockBuffer i1data_sorted(in(1)->get_size(c3, x1));
+    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), c3.size(), x1.size());
     dgemm_("T", "N", x0.size(), x1.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, x0.size());
+           1.0, i0data_sorted.get(), c3.size(), i1data_sorted.get(), c3.size(),
+           1.0, odata_sorted.get(), x0.size());
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size());
   out()->put_block(odata, x1, x0);
 }
 
@@ -923,26 +923,26 @@ void Task1040::Task_local::compute() {
   const Index x1 = b(1);
   // tensor label: I1043
   std::unique_ptr<double[]> odata = out()->move_block(c3, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(c3, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(c3, x1), 0.0);
   for (auto& a4 : *range_[2]) {
     for (auto& c1 : *range_[0]) {
       for (auto& a2 : *range_[2]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a4, c1, a2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a4, c1, a2)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), a4.size(), c1.size(), a2.size());
+        const double* i0data = in(0)->get_block_view(x1, a4, c1, a2);
+        BlockBuffer i0data_sorted(in(0)->get_size(x1, a4, c1, a2));
+        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), a4.size(), c1.size(), a2.size());
         // tensor label: I1044
-        std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c3, a2, c1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c3, a2, c1)]);
-        sort_indices<0,3,2,1,0,1,1,1>(i1data, i1data_sorted, a4.size(), c3.size(), a2.size(), c1.size());
+        const double* i1data = in(1)->get_block_view(a4, c3, a2, c1);
+        BlockBuffer i1data_sorted(in(1)->get_size(a4, c3, a2, c1));
+        sort_indices<0,3,2,1,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), c3.size(), a2.size(), c1.size());
         dgemm_("T", "N", x1.size(), c3.size(), a4.size()*a2.size()*c1.size(),
-               1.0, i0data_sorted, a4.size()*a2.size()*c1.size(), i1data_sorted, a4.size()*a2.size()*c1.size(),
-               1.0, odata_sorted, x1.size());
+               1.0, i0data_sorted.get(), a4.size()*a2.size()*c1.size(), i1data_sorted.get(), a4.size()*a2.size()*c1.size(),
+               1.0, odata_sorted.get(), x1.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), c3.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), c3.size());
   out()->put_block(odata, c3, x1);
 }
 
@@ -955,8 +955,8 @@ void Task1041::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a4, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-    sort_indices<3,2,1,0,1,1,-8,1>(i0data, odata, c1.size(), a2.size(), c3.size(), a4.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, a4);
+    sort_indices<3,2,1,0,1,1,-8,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), a4.size());
   }
   out()->put_block(odata, a4, c3, a2, c1);
 }
@@ -966,26 +966,26 @@ void Task1042::Task_local::compute() {
   const Index x1 = b(1);
   // tensor label: I1043
   std::unique_ptr<double[]> odata = out()->move_block(c3, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(c3, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(c3, x1), 0.0);
   for (auto& a2 : *range_[2]) {
     for (auto& c1 : *range_[0]) {
       for (auto& a4 : *range_[2]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a2, c1, a4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a2, c1, a4)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), a2.size(), c1.size(), a4.size());
+        const double* i0data = in(0)->get_block_view(x1, a2, c1, a4);
+        BlockBuffer i0data_sorted(in(0)->get_size(x1, a2, c1, a4));
+        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), a2.size(), c1.size(), a4.size());
         // tensor label: I1048
-        std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c3, a2, c1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c3, a2, c1)]);
-        sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, a4.size(), c3.size(), a2.size(), c1.size());
+        const double* i1data = in(1)->get_block_view(a4, c3, a2, c1);
+        BlockBuffer i1data_sorted(in(1)->get_size(a4, c3, a2, c1));
+        sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), c3.size(), a2.size(), c1.size());
         dgemm_("T", "N", x1.size(), c3.size(), a4.size()*a2.size()*c1.size(),
-               1.0, i0data_sorted, a4.size()*a2.size()*c1.size(), i1data_sorted, a4.size()*a2.size()*c1.size(),
-               1.0, odata_sorted, x1.size());
+               1.0, i0data_sorted.get(), a4.size()*a2.size()*c1.size(), i1data_sorted.get(), a4.size()*a2.size()*c1.size(),
+               1.0, odata_sorted.get(), x1.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), c3.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), c3.size());
   out()->put_block(odata, c3, x1);
 }
 
@@ -998,8 +998,8 @@ void Task1043::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a4, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata, c1.size(), a2.size(), c3.size(), a4.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, a4);
+    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), a4.size());
   }
   out()->put_block(odata, a4, c3, a2, c1);
 }
@@ -1009,22 +1009,22 @@ void Task1044::Task_local::compute() {
   const Index x0 = b(1);
   // tensor label: I915
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
   for (auto& c4 : *range_[0]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x1, c4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, c4)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), c4.size());
+    const double* i0data = in(0)->get_block_view(x1, c4);
+    BlockBuffer i0data_sorted(in(0)->get_size(x1, c4));
+    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), c4.size());
     // tensor label: I1075
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c4)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, x0.size(), c4.size());
+    const double* i1data = in(1)->get_block_view(x0, c4);
+    BlockBuffer i1data_sorted(in(1)->get_size(x0, c4));
+    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), c4.size());
     dgemm_("T", "N", x1.size(), x0.size(), c4.size(),
-           1.0, i0data_sorted, c4.size(), i1data_sorted, c4.size(),
-           1.0, odata_sorted, x1.size());
+           1.0, i0data_sorted.get(), c4.size(), i1data_sorted.get(), c4.size(),
+           1.0, odata_sorted.get(), x1.size());
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0);
 }
 
@@ -1033,26 +1033,26 @@ void Task1045::Task_local::compute() {
   const Index c4 = b(1);
   // tensor label: I1075
   std::unique_ptr<double[]> odata = out()->move_block(x0, c4);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, c4)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, c4));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, c4), 0.0);
   for (auto& c2 : *range_[0]) {
     for (auto& a3 : *range_[2]) {
       for (auto& a1 : *range_[2]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a3, c4, a1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a3, c4, a1)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, c2.size(), a3.size(), c4.size(), a1.size());
+        const double* i0data = in(0)->get_block_view(c2, a3, c4, a1);
+        BlockBuffer i0data_sorted(in(0)->get_size(c2, a3, c4, a1));
+        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted.get(), c2.size(), a3.size(), c4.size(), a1.size());
         // tensor label: I1076
-        std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, a1, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, a1, x0)]);
-        sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), a1.size(), x0.size());
+        const double* i1data = in(1)->get_block_view(a3, c2, a1, x0);
+        BlockBuffer i1data_sorted(in(1)->get_size(a3, c2, a1, x0));
+        sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), c2.size(), a1.size(), x0.size());
         dgemm_("T", "N", c4.size(), x0.size(), a3.size()*c2.size()*a1.size(),
-               1.0, i0data_sorted, a3.size()*c2.size()*a1.size(), i1data_sorted, a3.size()*c2.size()*a1.size(),
-               1.0, odata_sorted, c4.size());
+               1.0, i0data_sorted.get(), a3.size()*c2.size()*a1.size(), i1data_sorted.get(), a3.size()*c2.size()*a1.size(),
+               1.0, odata_sorted.get(), c4.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c4.size(), x0.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), c4.size(), x0.size());
   out()->put_block(odata, x0, c4);
 }
 
@@ -1065,8 +1065,8 @@ void Task1046::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-    sort_indices<3,2,1,0,1,1,-8,1>(i0data, odata, x0.size(), a1.size(), c2.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, a3);
+    sort_indices<3,2,1,0,1,1,-8,1>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), a3.size());
   }
   out()->put_block(odata, a3, c2, a1, x0);
 }
@@ -1076,26 +1076,26 @@ void Task1047::Task_local::compute() {
   const Index c4 = b(1);
   // tensor label: I1075
   std::unique_ptr<double[]> odata = out()->move_block(x0, c4);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, c4)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, c4));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, c4), 0.0);
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       for (auto& a3 : *range_[2]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, c4, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1, c4, a3)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size(), c4.size(), a3.size());
+        const double* i0data = in(0)->get_block_view(c2, a1, c4, a3);
+        BlockBuffer i0data_sorted(in(0)->get_size(c2, a1, c4, a3));
+        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted.get(), c2.size(), a1.size(), c4.size(), a3.size());
         // tensor label: I1080
-        std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, a1, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, a1, x0)]);
-        sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), a1.size(), x0.size());
+        const double* i1data = in(1)->get_block_view(a3, c2, a1, x0);
+        BlockBuffer i1data_sorted(in(1)->get_size(a3, c2, a1, x0));
+        sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), c2.size(), a1.size(), x0.size());
         dgemm_("T", "N", c4.size(), x0.size(), a3.size()*c2.size()*a1.size(),
-               1.0, i0data_sorted, a3.size()*c2.size()*a1.size(), i1data_sorted, a3.size()*c2.size()*a1.size(),
-               1.0, odata_sorted, c4.size());
+               1.0, i0data_sorted.get(), a3.size()*c2.size()*a1.size(), i1data_sorted.get(), a3.size()*c2.size()*a1.size(),
+               1.0, odata_sorted.get(), c4.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c4.size(), x0.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), c4.size(), x0.size());
   out()->put_block(odata, x0, c4);
 }
 
@@ -1108,8 +1108,8 @@ void Task1048::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata, x0.size(), a1.size(), c2.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, a3);
+    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), a3.size());
   }
   out()->put_block(odata, a3, c2, a1, x0);
 }
@@ -1119,26 +1119,26 @@ void Task1049::Task_local::compute() {
   const Index x0 = b(1);
   // tensor label: I915
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
   for (auto& a3 : *range_[2]) {
     for (auto& c4 : *range_[0]) {
       for (auto& a1 : *range_[2]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a3, c4, a1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a3, c4, a1)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), a3.size(), c4.size(), a1.size());
+        const double* i0data = in(0)->get_block_view(x1, a3, c4, a1);
+        BlockBuffer i0data_sorted(in(0)->get_size(x1, a3, c4, a1));
+        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), a3.size(), c4.size(), a1.size());
         // tensor label: I1089
-        std::unique_ptr<double[]> i1data = in(1)->get_block(a3, a1, x0, c4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, a1, x0, c4)]);
-        sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, a3.size(), a1.size(), x0.size(), c4.size());
+        const double* i1data = in(1)->get_block_view(a3, a1, x0, c4);
+        BlockBuffer i1data_sorted(in(1)->get_size(a3, a1, x0, c4));
+        sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), a1.size(), x0.size(), c4.size());
         dgemm_("T", "N", x1.size(), x0.size(), a3.size()*a1.size()*c4.size(),
-               1.0, i0data_sorted, a3.size()*a1.size()*c4.size(), i1data_sorted, a3.size()*a1.size()*c4.size(),
-               1.0, odata_sorted, x1.size());
+               1.0, i0data_sorted.get(), a3.size()*a1.size()*c4.size(), i1data_sorted.get(), a3.size()*a1.size()*c4.size(),
+               1.0, odata_sorted.get(), x1.size());
       }
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0);
 }
 
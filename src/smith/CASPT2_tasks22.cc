@@ -40,22 +40,22 @@ void Task1050::Task_local::compute() {
   const Index c4 = b(3);
   // tensor label: I1089
   std::unique_ptr<double[]> odata = out()->move_block(a3, a1, x0, c4);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, a1, x0, c4)]);
+  BlockBuffer odata_sorted(out()->get_size(a3, a1, x0, c4));
   std::fill_n(odata_sorted.get(), out()->get_size(a3, a1, x0, c4), 0.0);
   for (auto& c2 : *range_[0]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c2, c4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, c4)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), c4.size());
+    const double* i0data = in(0)->get_block_view(c2, c4);
+    BlockBuffer i0data_sorted(in(0)->get_size(c2, c4));
+    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), c2.size(), c4.size());
     // tensor label: I1090
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, a1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, a1, x0)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), a1.size(), x0.size());
+    const double* i1data = in(1)->get_block_view(a3, c2, a1, x0);
+    BlockBuffer i1data_sorted(in(1)->get_size(a3, c2, a1, x0));
+    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), c2.size(), a1.size(), x0.size());
     dgemm_("T", "N", c4.size(), a3.size()*a1.size()*x0.size(), c2.size(),
-           1.0, i0data_sorted, c2.size(), i1data_sorted, c2.size(),
-           1.0, odata_sorted, c4.size());
+           1.0, i0data_sorted.get(), c2.size(), i1data_sorted.get(), c2.size(),
+           1.0, odata_sorted.get(), c4.size());
   }
-  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, c4.size(), a3.size(), a1.size(), x0.size());
+  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted.get(), odata.get(), c4.size(), a3.size(), a1.size(), x0.size());
   out()->put_block(odata, a3, a1, x0, c4);
 }
 
@@ -68,8 +68,8 @@ void Task1051::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata, x0.size(), a1.size(), c2.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, a3);
+    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), a3.size());
   }
   out()->put_block(odata, a3, c2, a1, x0);
 }
@@ -79,26 +79,26 @@ void Task1052::Task_local::compute() {
   const Index x0 = b(1);
   // tensor label: I915
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
   for (auto& a1 : *range_[2]) {
     for (auto& c4 : *range_[0]) {
       for (auto& a3 : *range_[2]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a1, c4, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a1, c4, a3)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), a1.size(), c4.size(), a3.size());
+        const double* i0data = in(0)->get_block_view(x1, a1, c4, a3);
+        BlockBuffer i0data_sorted(in(0)->get_size(x1, a1, c4, a3));
+        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), a1.size(), c4.size(), a3.size());
         // tensor label: I1093
-        std::unique_ptr<double[]> i1data = in(1)->get_block(a3, a1, x0, c4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, a1, x0, c4)]);
-        sort_indices<1,3,0,2,0,1,1,1>(i1data, i1data_sorted, a3.size(), a1.size(), x0.size(), c4.size());
+        const double* i1data = in(1)->get_block_view(a3, a1, x0, c4);
+        BlockBuffer i1data_sorted(in(1)->get_size(a3, a1, x0, c4));
+        sort_indices<1,3,0,2,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), a1.size(), x0.size(), c4.size());
         dgemm_("T", "N", x1.size(), x0.size(), a3.size()*a1.size()*c4.size(),
-               1.0, i0data_sorted, a3.size()*a1.size()*c4.size(), i1data_sorted, a3.size()*a1.size()*c4.size(),
-               1.0, odata_sorted, x1.size());
+               1.0, i0data_sorted.get(), a3.size()*a1.size()*c4.size(), i1data_sorted.get(), a3.size()*a1.size()*c4.size(),
+               1.0, odata_sorted.get(), x1.size());
       }
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0);
 }
 
@@ -109,22 +109,22 @@ void Task1053::Task_local::compute() {
   const Index c4 = b(3);
   // tensor label: I1093
   std::unique_ptr<double[]> odata = out()->move_block(a3, a1, x0, c4);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, a1, x0, c4)]);
+  BlockBuffer odata_sorted(out()->get_size(a3, a1, x0, c4));
   std::fill_n(odata_sorted.get(), out()->get_size(a3, a1, x0, c4), 0.0);
   for (auto& c2 : *range_[0]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c2, c4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, c4)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), c4.size());
+    const double* i0data = in(0)->get_block_view(c2, c4);
+    BlockBuffer i0data_sorted(in(0)->get_size(c2, c4));
+    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), c2.size(), c4.size());
     // tensor label: I1094
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, a1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, a1, x0)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), a1.size(), x0.size());
+    const double* i1data = in(1)->get_block_view(a3, c2, a1, x0);
+    BlockBuffer i1data_sorted(in(1)->get_size(a3, c2, a1, x0));
+    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), c2.size(), a1.size(), x0.size());
     dgemm_("T", "N", c4.size(), a3.size()*a1.size()*x0.size(), c2.size(),
-           1.0, i0data_sorted, c2.size(), i1data_sorted, c2.size(),
-           1.0, odata_sorted, c4.size());
+           1.0, i0data_sorted.get(), c2.size(), i1data_sorted.get(), c2.size(),
+           1.0, odata_sorted.get(), c4.size());
   }
-  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, c4.size(), a3.size(), a1.size(), x0.size());
+  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted.get(), odata.get(), c4.size(), a3.size(), a1.size(), x0.size());
   out()->put_block(odata, a3, a1, x0, c4);
 }
 
@@ -137,8 +137,8 @@ void Task1054::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-    sort_indices<3,2,1,0,1,1,-4,1>(i0data, odata, x0.size(), a1.size(), c2.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, a3);
+    sort_indices<3,2,1,0,1,1,-4,1>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), a3.size());
   }
   out()->put_block(odata, a3, c2, a1, x0);
 }
@@ -148,26 +148,26 @@ void Task1055::Task_local::compute() {
   const Index x0 = b(1);
   // tensor label: I915
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
   for (auto& a4 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a3 : *range_[2]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a4, c2, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a4, c2, a3)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), a4.size(), c2.size(), a3.size());
+        const double* i0data = in(0)->get_block_view(x1, a4, c2, a3);
+        BlockBuffer i0data_sorted(in(0)->get_size(x1, a4, c2, a3));
+        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), a4.size(), c2.size(), a3.size());
         // tensor label: I1097
-        std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, x0, a4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, x0, a4)]);
-        sort_indices<3,1,0,2,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), x0.size(), a4.size());
+        const double* i1data = in(1)->get_block_view(a3, c2, x0, a4);
+        BlockBuffer i1data_sorted(in(1)->get_size(a3, c2, x0, a4));
+        sort_indices<3,1,0,2,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), c2.size(), x0.size(), a4.size());
         dgemm_("T", "N", x1.size(), x0.size(), a3.size()*c2.size()*a4.size(),
-               1.0, i0data_sorted, a3.size()*c2.size()*a4.size(), i1data_sorted, a3.size()*c2.size()*a4.size(),
-               1.0, odata_sorted, x1.size());
+               1.0, i0data_sorted.get(), a3.size()*c2.size()*a4.size(), i1data_sorted.get(), a3.size()*c2.size()*a4.size(),
+               1.0, odata_sorted.get(), x1.size());
       }
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0);
 }
 
@@ -178,22 +178,22 @@ void Task1056::Task_local::compute() {
   const Index a4 = b(3);
   // tensor label: I1097
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2, x0, a4);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a4)]);
+  BlockBuffer odata_sorted(out()->get_size(a3, c2, x0, a4));
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a4), 0.0);
   for (auto& a1 : *range_[2]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a4, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a4, a1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, a4.size(), a1.size());
+    const double* i0data = in(0)->get_block_view(a4, a1);
+    BlockBuffer i0data_sorted(in(0)->get_size(a4, a1));
+    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted.get(), a4.size(), a1.size());
     // tensor label: I1098
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, a1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, a1, x0)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), a1.size(), x0.size());
+    const double* i1data = in(1)->get_block_view(a3, c2, a1, x0);
+    BlockBuffer i1data_sorted(in(1)->get_size(a3, c2, a1, x0));
+    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), c2.size(), a1.size(), x0.size());
     dgemm_("T", "N", a4.size(), a3.size()*c2.size()*x0.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, a4.size());
+           1.0, i0data_sorted.get(), a1.size(), i1data_sorted.get(), a1.size(),
+           1.0, odata_sorted.get(), a4.size());
   }
-  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a4.size(), a3.size(), c2.size(), x0.size());
+  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted.get(), odata.get(), a4.size(), a3.size(), c2.size(), x0.size());
   out()->put_block(odata, a3, c2, x0, a4);
 }
 
@@ -206,8 +206,8 @@ void Task1057::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata, x0.size(), a1.size(), c2.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, a3);
+    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), a3.size());
   }
   out()->put_block(odata, a3, c2, a1, x0);
 }
@@ -217,26 +217,26 @@ void Task1058::Task_local::compute() {
   const Index x0 = b(1);
   // tensor label: I915
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
   for (auto& a3 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a4 : *range_[2]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a3, c2, a4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a3, c2, a4)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), a3.size(), c2.size(), a4.size());
+        const double* i0data = in(0)->get_block_view(x1, a3, c2, a4);
+        BlockBuffer i0data_sorted(in(0)->get_size(x1, a3, c2, a4));
+        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), a3.size(), c2.size(), a4.size());
         // tensor label: I1101
-        std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, x0, a4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, x0, a4)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), x0.size(), a4.size());
+        const double* i1data = in(1)->get_block_view(a3, c2, x0, a4);
+        BlockBuffer i1data_sorted(in(1)->get_size(a3, c2, x0, a4));
+        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), c2.size(), x0.size(), a4.size());
         dgemm_("T", "N", x1.size(), x0.size(), a3.size()*c2.size()*a4.size(),
-               1.0, i0data_sorted, a3.size()*c2.size()*a4.size(), i1data_sorted, a3.size()*c2.size()*a4.size(),
-               1.0, odata_sorted, x1.size());
+               1.0, i0data_sorted.get(), a3.size()*c2.size()*a4.size(), i1data_sorted.get(), a3.size()*c2.size()*a4.size(),
+               1.0, odata_sorted.get(), x1.size());
       }
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0);
 }
 
@@ -247,22 +247,22 @@ void Task1059::Task_local::compute() {
   const Index a4 = b(3);
   // tensor label: I1101
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2, x0, a4);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a4)]);
+  BlockBuffer odata_sorted(out()->get_size(a3, c2, x0, a4));
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a4), 0.0);
   for (auto& a1 : *range_[2]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a4, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a4, a1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, a4.size(), a1.size());
+    const double* i0data = in(0)->get_block_view(a4, a1);
+    BlockBuffer i0data_sorted(in(0)->get_size(a4, a1));
+    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted.get(), a4.size(), a1.size());
     // tensor label: I1102
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, a1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, a1, x0)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), a1.size(), x0.size());
+    const double* i1data = in(1)->get_block_view(a3, c2, a1, x0);
+    BlockBuffer i1data_sorted(in(1)->get_size(a3, c2, a1, x0));
+    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), c2.size(), a1.size(), x0.size());
     dgemm_("T", "N", a4.size(), a3.size()*c2.size()*x0.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, a4.size());
+           1.0, i0data_sorted.get(), a1.size(), i1data_sorted.get(), a1.size(),
+           1.0, odata_sorted.get(), a4.size());
   }
-  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a4.size(), a3.size(), c2.size(), x0.size());
+  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted.get(), odata.get(), a4.size(), a3.size(), c2.size(), x0.size());
   out()->put_block(odata, a3, c2, x0, a4);
 }
 
@@ -275,8 +275,8 @@ void Task1060::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata, x0.size(), a1.size(), c2.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, a3);
+    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), a3.size());
   }
   out()->put_block(odata, a3, c2, a1, x0);
 }
@@ -286,26 +286,26 @@ void Task1061::Task_local::compute() {
   const Index x0 = b(1);
   // tensor label: I915
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
   for (auto& a4 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a1 : *range_[2]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a4, c2, a1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a4, c2, a1)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), a4.size(), c2.size(), a1.size());
+        const double* i0data = in(0)->get_block_view(x1, a4, c2, a1);
+        BlockBuffer i0data_sorted(in(0)->get_size(x1, a4, c2, a1));
+        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), a4.size(), c2.size(), a1.size());
         // tensor label: I1105
-        std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x0, a4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x0, a4)]);
-        sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x0.size(), a4.size());
+        const double* i1data = in(1)->get_block_view(c2, a1, x0, a4);
+        BlockBuffer i1data_sorted(in(1)->get_size(c2, a1, x0, a4));
+        sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted.get(), c2.size(), a1.size(), x0.size(), a4.size());
         dgemm_("T", "N", x1.size(), x0.size(), c2.size()*a1.size()*a4.size(),
-               1.0, i0data_sorted, c2.size()*a1.size()*a4.size(), i1data_sorted, c2.size()*a1.size()*a4.size(),
-               1.0, odata_sorted, x1.size());
+               1.0, i0data_sorted.get(), c2.size()*a1.size()*a4.size(), i1data_sorted.get(), c2.size()*a1.size()*a4.size(),
+               1.0, odata_sorted.get(), x1.size());
       }
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0);
 }
 
@@ -316,22 +316,22 @@ void Task1062::Task_local::compute() {
   const Index a4 = b(3);
   // tensor label: I1105
   std::unique_ptr<double[]> odata = out()->move_block(c2, a1, x0, a4);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1, x0, a4)]);
+  BlockBuffer odata_sorted(out()->get_size(c2, a1, x0, a4));
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1, x0, a4), 0.0);
   for (auto& a3 : *range_[2]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a4, a3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a4, a3)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, a4.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(a4, a3);
+    BlockBuffer i0data_sorted(in(0)->get_size(a4, a3));
+    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted.get(), a4.size(), a3.size());
     // tensor label: I1106
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, a1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, a1, x0)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), a1.size(), x0.size());
+    const double* i1data = in(1)->get_block_view(a3, c2, a1, x0);
+    BlockBuffer i1data_sorted(in(1)->get_size(a3, c2, a1, x0));
+    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), c2.size(), a1.size(), x0.size());
     dgemm_("T", "N", a4.size(), c2.size()*a1.size()*x0.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, a4.size());
+           1.0, i0data_sorted.get(), a3.size(), i1data_sorted.get(), a3.size(),
+           1.0, odata_sorted.get(), a4.size());
   }
-  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a4.size(), c2.size(), a1.size(), x0.size());
+  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted.get(), odata.get(), a4.size(), c2.size(), a1.size(), x0.size());
   out()->put_block(odata, c2, a1, x0, a4);
 }
 
@@ -344,8 +344,8 @@ void Task1063::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata, x0.size(), a1.size(), c2.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, a3);
+    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), a3.size());
   }
   out()->put_block(odata, a3, c2, a1, x0);
 }
@@ -355,26 +355,26 @@ void Task1064::Task_local::compute() {
   const Index x0 = b(1);
   // tensor label: I915
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
   for (auto& a1 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a4 : *range_[2]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a1, c2, a4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a1, c2, a4)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), a1.size(), c2.size(), a4.size());
+        const double* i0data = in(0)->get_block_view(x1, a1, c2, a4);
+        BlockBuffer i0data_sorted(in(0)->get_size(x1, a1, c2, a4));
+        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), a1.size(), c2.size(), a4.size());
         // tensor label: I1109
-        std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x0, a4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x0, a4)]);
-        sort_indices<1,0,3,2,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x0.size(), a4.size());
+        const double* i1data = in(1)->get_block_view(c2, a1, x0, a4);
+        BlockBuffer i1data_sorted(in(1)->get_size(c2, a1, x0, a4));
+        sort_indices<1,0,3,2,0,1,1,1>(i1data, i1data_sorted.get(), c2.size(), a1.size(), x0.size(), a4.size());
         dgemm_("T", "N", x1.size(), x0.size(), c2.size()*a1.size()*a4.size(),
-               1.0, i0data_sorted, c2.size()*a1.size()*a4.size(), i1data_sorted, c2.size()*a1.size()*a4.size(),
-               1.0, odata_sorted, x1.size());
+               1.0, i0data_sorted.get(), c2.size()*a1.size()*a4.size(), i1data_sorted.get(), c2.size()*a1.size()*a4.size(),
+               1.0, odata_sorted.get(), x1.size());
       }
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0);
 }
 
@@ -385,22 +385,22 @@ void Task1065::Task_local::compute() {
   const Index a4 = b(3);
   // tensor label: I1109
   std::unique_ptr<double[]> odata = out()->move_block(c2, a1, x0, a4);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1, x0, a4)]);
+  BlockBuffer odata_sorted(out()->get_size(c2, a1, x0, a4));
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1, x0, a4), 0.0);
   for (auto& a3 : *range_[2]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a4, a3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a4, a3)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, a4.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(a4, a3);
+    BlockBuffer i0data_sorted(in(0)->get_size(a4, a3));
+    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted.get(), a4.size(), a3.size());
     // tensor label: I1110
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, a1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, a1, x0)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), a1.size(), x0.size());
+    const double* i1data = in(1)->get_block_view(a3, c2, a1, x0);
+    BlockBuffer i1data_sorted(in(1)->get_size(a3, c2, a1, x0));
+    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), c2.size(), a1.size(), x0.size());
     dgemm_("T", "N", a4.size(), c2.size()*a1.size()*x0.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, a4.size());
+           1.0, i0data_sorted.get(), a3.size(), i1data_sorted.get(), a3.size(),
+           1.0, odata_sorted.get(), a4.size());
   }
-  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a4.size(), c2.size(), a1.size(), x0.size());
+  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted.get(), odata.get(), a4.size(), c2.size(), a1.size(), x0.size());
   out()->put_block(odata, c2, a1, x0, a4);
 }
 
@@ -413,8 +413,8 @@ void Task1066::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata, x0.size(), a1.size(), c2.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, a3);
+    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), a3.size());
   }
   out()->put_block(odata, a3, c2, a1, x0);
 }
@@ -424,26 +424,26 @@ void Task1067::Task_local::compute() {
   const Index x0 = b(1);
   // tensor label: I915
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
   for (auto& a3 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a1 : *range_[2]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a3, c2, a1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a3, c2, a1)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), a3.size(), c2.size(), a1.size());
+        const double* i0data = in(0)->get_block_view(x1, a3, c2, a1);
+        BlockBuffer i0data_sorted(in(0)->get_size(x1, a3, c2, a1));
+        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), a3.size(), c2.size(), a1.size());
         // tensor label: I1159
-        std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, a1, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, a1, x0)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), a1.size(), x0.size());
+        const double* i1data = in(1)->get_block_view(a3, c2, a1, x0);
+        BlockBuffer i1data_sorted(in(1)->get_size(a3, c2, a1, x0));
+        sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), c2.size(), a1.size(), x0.size());
         dgemm_("T", "N", x1.size(), x0.size(), a3.size()*c2.size()*a1.size(),
-               1.0, i0data_sorted, a3.size()*c2.size()*a1.size(), i1data_sorted, a3.size()*c2.size()*a1.size(),
-               1.0, odata_sorted, x1.size());
+               1.0, i0data_sorted.get(), a3.size()*c2.size()*a1.size(), i1data_sorted.get(), a3.size()*c2.size()*a1.size(),
+               1.0, odata_sorted.get(), x1.size());
       }
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0);
 }
 
@@ -458,7 +458,7 @@ void Task1068::Task_local::compute() {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
     dscal_(a3.size()*c2.size()*a1.size()*x0.size(), e0_, i0data.get(), 1);
-    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata, x0.size(), a1.size(), c2.size(), a3.size());
+    sort_indices<3,2,1,0,1,1,2,1>(i0data.get(), odata.get(), x0.size(), a1.size(), c2.size(), a3.size());
   }
   out()->put_block(odata, a3, c2, a1, x0);
 }
@@ -468,26 +468,26 @@ void Task1069::Task_local::compute() {
   const Index x0 = b(1);
   // tensor label: I915
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
   for (auto& a1 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a3 : *range_[2]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a1, c2, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a1, c2, a3)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), a1.size(), c2.size(), a3.size());
+        const double* i0data = in(0)->get_block_view(x1, a1, c2, a3);
+        BlockBuffer i0data_sorted(in(0)->get_size(x1, a1, c2, a3));
+        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), a1.size(), c2.size(), a3.size());
         // tensor label: I1162
-        std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, a1, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, a1, x0)]);
-        sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), a1.size(), x0.size());
+        const double* i1data = in(1)->get_block_view(a3, c2, a1, x0);
+        BlockBuffer i1data_sorted(in(1)->get_size(a3, c2, a1, x0));
+        sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), c2.size(), a1.size(), x0.size());
         dgemm_("T", "N", x1.size(), x0.size(), a3.size()*c2.size()*a1.size(),
-               1.0, i0data_sorted, a3.size()*c2.size()*a1.size(), i1data_sorted, a3.size()*c2.size()*a1.size(),
-               1.0, odata_sorted, x1.size());
+               1.0, i0data_sorted.get(), a3.size()*c2.size()*a1.size(), i1data_sorted.get(), a3.size()*c2.size()*a1.size(),
+               1.0, odata_sorted.get(), x1.size());
       }
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0);
 }
 
@@ -502,7 +502,7 @@ void Task1070::Task_local::compute() {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
     dscal_(a3.size()*c2.size()*a1.size()*x0.size(), e0_, i0data.get(), 1);
-    sort_indices<3,2,1,0,1,1,-4,1>(i0data, odata, x0.size(), a1.size(), c2.size(), a3.size());
+    sort_indices<3,2,1,0,1,1,-4,1>(i0data.get(), odata.get(), x0.size(), a1.size(), c2.size(), a3.size());
   }
   out()->put_block(odata, a3, c2, a1, x0);
 }
@@ -512,26 +512,26 @@ void Task1071::Task_local::compute() {
   const Index x0 = b(1);
   // tensor label: I915
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
   for (auto& a3 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a1 : *range_[2]) {
         // tensor label: v2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a3, c2, a1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a3, c2, a1)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), a3.size(), c2.size(), a1.size());
+        const double* i0data = in(0)->get_block_view(x1, a3, c2, a1);
+        BlockBuffer i0data_sorted(in(0)->get_size(x1, a3, c2, a1));
+        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), a3.size(), c2.size(), a1.size());
         // tensor label: I1213
-        std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, a1, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, a1, x0)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), a1.size(), x0.size());
+        const double* i1data = in(1)->get_block_view(a3, c2, a1, x0);
+        BlockBuffer i1data_sorted(in(1)->get_size(a3, c2, a1, x0));
+        sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), c2.size(), a1.size(), x0.size());
         dgemm_("T", "N", x1.size(), x0.size(), a3.size()*c2.size()*a1.size(),
-               1.0, i0data_sorted, a3.size()*c2.size()*a1.size(), i1data_sorted, a3.size()*c2.size()*a1.size(),
-               1.0, odata_sorted, x1.size());
+               1.0, i0data_sorted.get(), a3.size()*c2.size()*a1.size(), i1data_sorted.get(), a3.size()*c2.size()*a1.size(),
+               1.0, odata_sorted.get(), x1.size());
       }
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0);
 }
 
@@ -544,8 +544,8 @@ void Task1072::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata, x0.size(), a1.size(), c2.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, a3);
+    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), a3.size());
   }
   out()->put_block(odata, a3, c2, a1, x0);
 }
@@ -555,26 +555,26 @@ void Task1073::Task_local::compute() {
   const Index x0 = b(1);
   // tensor label: I915
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
   for (auto& a1 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a3 : *range_[2]) {
         // tensor label: v2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a1, c2, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a1, c2, a3)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), a1.size(), c2.size(), a3.size());
+        const double* i0data = in(0)->get_block_view(x1, a1, c2, a3);
+        BlockBuffer i0data_sorted(in(0)->get_size(x1, a1, c2, a3));
+        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), a1.size(), c2.size(), a3.size());
         // tensor label: I1216
-        std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, a1, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, a1, x0)]);
-        sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), a1.size(), x0.size());
+        const double* i1data = in(1)->get_block_view(a3, c2, a1, x0);
+        BlockBuffer i1data_sorted(in(1)->get_size(a3, c2, a1, x0));
+        sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), c2.size(), a1.size(), x0.size());
         dgemm_("T", "N", x1.size(), x0.size(), a3.size()*c2.size()*a1.size(),
-               1.0, i0data_sorted, a3.size()*c2.size()*a1.size(), i1data_sorted, a3.size()*c2.size()*a1.size(),
-               1.0, odata_sorted, x1.size());
+               1.0, i0data_sorted.get(), a3.size()*c2.size()*a1.size(), i1data_sorted.get(), a3.size()*c2.size()*a1.size(),
+               1.0, odata_sorted.get(), x1.size());
       }
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0);
 }
 
@@ -587,8 +587,8 @@ void Task1074::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata, x0.size(), a1.size(), c2.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, a3);
+    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), a3.size());
   }
   out()->put_block(odata, a3, c2, a1, x0);
 }
@@ -598,26 +598,26 @@ void Task1075::Task_local::compute() {
   const Index x0 = b(1);
   // tensor label: I915
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
   for (auto& a3 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a1 : *range_[2]) {
         // tensor label: v2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a3, c2, a1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a3, c2, a1)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), a3.size(), c2.size(), a1.size());
+        const double* i0data = in(0)->get_block_view(x0, a3, c2, a1);
+        BlockBuffer i0data_sorted(in(0)->get_size(x0, a3, c2, a1));
+        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), a3.size(), c2.size(), a1.size());
         // tensor label: I1267
-        std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, a1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, a1, x1)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), a1.size(), x1.size());
+        const double* i1data = in(1)->get_block_view(a3, c2, a1, x1);
+        BlockBuffer i1data_sorted(in(1)->get_size(a3, c2, a1, x1));
+        sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), c2.size(), a1.size(), x1.size());
         dgemm_("T", "N", x0.size(), x1.size(), a3.size()*c2.size()*a1.size(),
-               1.0, i0data_sorted, a3.size()*c2.size()*a1.size(), i1data_sorted, a3.size()*c2.size()*a1.size(),
-               1.0, odata_sorted, x0.size());
+               1.0, i0data_sorted.get(), a3.size()*c2.size()*a1.size(), i1data_sorted.get(), a3.size()*c2.size()*a1.size(),
+               1.0, odata_sorted.get(), x0.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size());
   out()->put_block(odata, x1, x0);
 }
 
@@ -630,8 +630,8 @@ void Task1076::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2, a1, x1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a1, c2, a3);
-    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata, x1.size(), a1.size(), c2.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(x1, a1, c2, a3);
+    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata.get(), x1.size(), a1.size(), c2.size(), a3.size());
   }
   out()->put_block(odata, a3, c2, a1, x1);
 }
@@ -641,26 +641,26 @@ void Task1077::Task_local::compute() {
   const Index x0 = b(1);
   // tensor label: I915
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
   for (auto& a1 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a3 : *range_[2]) {
         // tensor label: v2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, a3)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
+        const double* i0data = in(0)->get_block_view(x0, a1, c2, a3);
+        BlockBuffer i0data_sorted(in(0)->get_size(x0, a1, c2, a3));
+        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), a1.size(), c2.size(), a3.size());
         // tensor label: I1270
-        std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, a1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, a1, x1)]);
-        sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), a1.size(), x1.size());
+        const double* i1data = in(1)->get_block_view(a3, c2, a1, x1);
+        BlockBuffer i1data_sorted(in(1)->get_size(a3, c2, a1, x1));
+        sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), c2.size(), a1.size(), x1.size());
         dgemm_("T", "N", x0.size(), x1.size(), a3.size()*c2.size()*a1.size(),
-               1.0, i0data_sorted, a3.size()*c2.size()*a1.size(), i1data_sorted, a3.size()*c2.size()*a1.size(),
-               1.0, odata_sorted, x0.size());
+               1.0, i0data_sorted.get(), a3.size()*c2.size()*a1.size(), i1data_sorted.get(), a3.size()*c2.size()*a1.size(),
+               1.0, odata_sorted.get(), x0.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size());
   out()->put_block(odata, x1, x0);
 }
 
@@ -673,8 +673,8 @@ void Task1078::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2, a1, x1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a1, c2, a3);
-    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata, x1.size(), a1.size(), c2.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(x1, a1, c2, a3);
+    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata.get(), x1.size(), a1.size(), c2.size(), a3.size());
   }
   out()->put_block(odata, a3, c2, a1, x1);
 }
@@ -684,24 +684,24 @@ void Task1079::Task_local::compute() {
   const Index x0 = b(1);
   // tensor label: I915
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: h1
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size());
+      const double* i0data = in(0)->get_block_view(c2, a1);
+      BlockBuffer i0data_sorted(in(0)->get_size(c2, a1));
+      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), c2.size(), a1.size());
       // tensor label: I1279
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c2, a1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c2, a1, x0)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), c2.size(), a1.size(), x0.size());
+      const double* i1data = in(1)->get_block_view(x1, c2, a1, x0);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, c2, a1, x0));
+      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), c2.size(), a1.size(), x0.size());
       dgemm_("T", "N", 1, x1.size()*x0.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, 1);
+             1.0, i0data_sorted.get(), c2.size()*a1.size(), i1data_sorted.get(), c2.size()*a1.size(),
+             1.0, odata_sorted.get(), 1);
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0);
 }
 
@@ -714,13 +714,13 @@ void Task1080::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata, x0.size(), a1.size(), c2.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, x1);
+    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), x1.size());
   }
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i1data = in(0)->get_block(x1, a1, c2, x0);
-    sort_indices<0,2,1,3,1,1,-2,1>(i1data, odata, x1.size(), a1.size(), c2.size(), x0.size());
+    const double* i1data = in(0)->get_block_view(x1, a1, c2, x0);
+    sort_indices<0,2,1,3,1,1,-2,1>(i1data, odata.get(), x1.size(), a1.size(), c2.size(), x0.size());
   }
   out()->put_block(odata, x1, c2, a1, x0);
 }
@@ -730,24 +730,24 @@ void Task1081::Task_local::compute() {
   const Index x0 = b(1);
   // tensor label: I915
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: h1
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size());
+      const double* i0data = in(0)->get_block_view(c1, a2);
+      BlockBuffer i0data_sorted(in(0)->get_size(c1, a2));
+      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size());
       // tensor label: I1282
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, a2, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, a2, c1)]);
-      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), a2.size(), c1.size());
+      const double* i1data = in(1)->get_block_view(x1, x0, a2, c1);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, a2, c1));
+      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), a2.size(), c1.size());
       dgemm_("T", "N", 1, x1.size()*x0.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, 1);
+             1.0, i0data_sorted.get(), a2.size()*c1.size(), i1data_sorted.get(), a2.size()*c1.size(),
+             1.0, odata_sorted.get(), 1);
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0);
 }
 
@@ -760,13 +760,13 @@ void Task1082::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x0, x1);
-    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata, c1.size(), a2.size(), x0.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, x0, x1);
+    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata.get(), c1.size(), a2.size(), x0.size(), x1.size());
   }
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i1data = in(0)->get_block(c1, a2, x1, x0);
-    sort_indices<2,3,1,0,1,1,4,1>(i1data, odata, c1.size(), a2.size(), x1.size(), x0.size());
+    const double* i1data = in(0)->get_block_view(c1, a2, x1, x0);
+    sort_indices<2,3,1,0,1,1,4,1>(i1data, odata.get(), c1.size(), a2.size(), x1.size(), x0.size());
   }
   out()->put_block(odata, x1, x0, a2, c1);
 }
@@ -775,7 +775,7 @@ void Task1083::Task_local::compute() {
   const Index ci0 = b(0);
   // tensor label: I768
   std::unique_ptr<double[]> odata = out()->move_block(ci0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(ci0)]);
+  BlockBuffer odata_sorted(out()->get_size(ci0));
   std::fill_n(odata_sorted.get(), out()->get_size(ci0), 0.0);
   for (auto& x5 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
@@ -784,23 +784,23 @@ void Task1083::Task_local::compute() {
           for (auto& x1 : *range_[1]) {
             for (auto& x0 : *range_[1]) {
               // tensor label: Gamma321
-              std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x5, x2, x4, x3, x1, x0);
-              std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(ci0, x5, x2, x4, x3, x1, x0)]);
-              sort_indices<1,2,3,4,5,6,0,0,1,1,1>(i0data, i0data_sorted, ci0.size(), x5.size(), x2.size(), x4.size(), x3.size(), x1.size(), x0.size());
+              const double* i0data = in(0)->get_block_view(ci0, x5, x2, x4, x3, x1, x0);
+              BlockBuffer i0data_sorted(in(0)->get_size(ci0, x5, x2, x4, x3, x1, x0));
+              sort_indices<1,2,3,4,5,6,0,0,1,1,1>(i0data, i0data_sorted.get(), ci0.size(), x5.size(), x2.size(), x4.size(), x3.size(), x1.size(), x0.size());
               // tensor label: I965
-              std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, x2, x5, x4, x3);
-              std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, x2, x5, x4, x3)]);
-              sort_indices<3,2,4,5,0,1,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), x2.size(), x5.size(), x4.size(), x3.size());
+              const double* i1data = in(1)->get_block_view(x1, x0, x2, x5, x4, x3);
+              BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, x2, x5, x4, x3));
+              sort_indices<3,2,4,5,0,1,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), x2.size(), x5.size(), x4.size(), x3.size());
               dgemm_("T", "N", ci0.size(), 1, x1.size()*x0.size()*x2.size()*x5.size()*x4.size()*x3.size(),
-                     1.0, i0data_sorted, x1.size()*x0.size()*x2.size()*x5.size()*x4.size()*x3.size(), i1data_sorted, x1.size()*x0.size()*x2.size()*x5.size()*x4.size()*x3.size(),
-                     1.0, odata_sorted, ci0.size());
+                     1.0, i0data_sorted.get(), x1.size()*x0.size()*x2.size()*x5.size()*x4.size()*x3.size(), i1data_sorted.get(), x1.size()*x0.size()*x2.size()*x5.size()*x4.size()*x3.size(),
+                     1.0, odata_sorted.get(), ci0.size());
             }
           }
         }
       }
     }
   }
-  sort_indices<0,1,1,1,1>(odata_sorted, odata, ci0.size());
+  sort_indices<0,1,1,1,1>(odata_sorted.get(), odata.get(), ci0.size());
   out()->put_block(odata, ci0);
 }
 
@@ -813,22 +813,22 @@ void Task1084::Task_local::compute() {
   const Index x3 = b(5);
   // tensor label: I965
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x2, x5, x4, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x2, x5, x4, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x2, x5, x4, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x2, x5, x4, x3), 0.0);
   for (auto& a2 : *range_[2]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a2, x4, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a2, x4, x3)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), a2.size(), x4.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(x5, a2, x4, x3);
+    BlockBuffer i0data_sorted(in(0)->get_size(x5, a2, x4, x3));
+    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), a2.size(), x4.size(), x3.size());
     // tensor label: I966
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, a2, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, a2, x2)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), a2.size(), x2.size());
+    const double* i1data = in(1)->get_block_view(x1, x0, a2, x2);
+    BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, a2, x2));
+    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), a2.size(), x2.size());
     dgemm_("T", "N", x5.size()*x4.size()*x3.size(), x1.size()*x0.size()*x2.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, x5.size()*x4.size()*x3.size());
+           1.0, i0data_sorted.get(), a2.size(), i1data_sorted.get(), a2.size(),
+           1.0, odata_sorted.get(), x5.size()*x4.size()*x3.size());
   }
-  sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), x1.size(), x0.size(), x2.size());
+  sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x5.size(), x4.size(), x3.size(), x1.size(), x0.size(), x2.size());
   out()->put_block(odata, x1, x0, x2, x5, x4, x3);
 }
 
@@ -839,22 +839,22 @@ void Task1085::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I966
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, a2, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, a2, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, a2, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, a2, x2), 0.0);
   for (auto& c1 : *range_[0]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x2)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(c1, x2);
+    BlockBuffer i0data_sorted(in(0)->get_size(c1, x2));
+    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), x2.size());
     // tensor label: I967
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, a2, c1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, a2, c1)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), a2.size(), c1.size());
+    const double* i1data = in(1)->get_block_view(x1, x0, a2, c1);
+    BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, a2, c1));
+    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), a2.size(), c1.size());
     dgemm_("T", "N", x2.size(), x1.size()*x0.size()*a2.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, x2.size());
+           1.0, i0data_sorted.get(), c1.size(), i1data_sorted.get(), c1.size(),
+           1.0, odata_sorted.get(), x2.size());
   }
-  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size(), x0.size(), a2.size());
+  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted.get(), odata.get(), x2.size(), x1.size(), x0.size(), a2.size());
   out()->put_block(odata, x1, x0, a2, x2);
 }
 
@@ -867,8 +867,8 @@ void Task1086::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x0, x1);
-    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata, c1.size(), a2.size(), x0.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, x0, x1);
+    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata.get(), c1.size(), a2.size(), x0.size(), x1.size());
   }
   out()->put_block(odata, x1, x0, a2, c1);
 }
@@ -882,22 +882,22 @@ void Task1087::Task_local::compute() {
   const Index x3 = b(5);
   // tensor label: I965
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x2, x5, x4, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x2, x5, x4, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x2, x5, x4, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x2, x5, x4, x3), 0.0);
   for (auto& a1 : *range_[2]) {
     // tensor label: v2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1, x2, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1, x2, a1)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size(), x2.size(), a1.size());
+    const double* i0data = in(0)->get_block_view(x0, x1, x2, a1);
+    BlockBuffer i0data_sorted(in(0)->get_size(x0, x1, x2, a1));
+    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), x1.size(), x2.size(), a1.size());
     // tensor label: I1264
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x4, a1, x5);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x4, a1, x5)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), x4.size(), a1.size(), x5.size());
+    const double* i1data = in(1)->get_block_view(x3, x4, a1, x5);
+    BlockBuffer i1data_sorted(in(1)->get_size(x3, x4, a1, x5));
+    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), x4.size(), a1.size(), x5.size());
     dgemm_("T", "N", x0.size()*x1.size()*x2.size(), x3.size()*x4.size()*x5.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, x0.size()*x1.size()*x2.size());
+           1.0, i0data_sorted.get(), a1.size(), i1data_sorted.get(), a1.size(),
+           1.0, odata_sorted.get(), x0.size()*x1.size()*x2.size());
   }
-  sort_indices<1,0,2,5,4,3,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x3.size(), x4.size(), x5.size());
+  sort_indices<1,0,2,5,4,3,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), x2.size(), x3.size(), x4.size(), x5.size());
   out()->put_block(odata, x1, x0, x2, x5, x4, x3);
 }
 
@@ -910,8 +910,8 @@ void Task1088::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x3, x4, a1, x5);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, x4, x3);
-    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata, x5.size(), a1.size(), x4.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(x5, a1, x4, x3);
+    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata.get(), x5.size(), a1.size(), x4.size(), x3.size());
   }
   out()->put_block(odata, x3, x4, a1, x5);
 }
@@ -920,7 +920,7 @@ void Task1089::Task_local::compute() {
   const Index ci0 = b(0);
   // tensor label: I768
   std::unique_ptr<double[]> odata = out()->move_block(ci0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(ci0)]);
+  BlockBuffer odata_sorted(out()->get_size(ci0));
   std::fill_n(odata_sorted.get(), out()->get_size(ci0), 0.0);
   for (auto& x5 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
@@ -929,23 +929,23 @@ void Task1089::Task_local::compute() {
           for (auto& x2 : *range_[1]) {
             for (auto& x1 : *range_[1]) {
               // tensor label: Gamma326
-              std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x5, x0, x3, x4, x2, x1);
-              std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(ci0, x5, x0, x3, x4, x2, x1)]);
-              sort_indices<1,2,3,4,5,6,0,0,1,1,1>(i0data, i0data_sorted, ci0.size(), x5.size(), x0.size(), x3.size(), x4.size(), x2.size(), x1.size());
+              const double* i0data = in(0)->get_block_view(ci0, x5, x0, x3, x4, x2, x1);
+              BlockBuffer i0data_sorted(in(0)->get_size(ci0, x5, x0, x3, x4, x2, x1));
+              sort_indices<1,2,3,4,5,6,0,0,1,1,1>(i0data, i0data_sorted.get(), ci0.size(), x5.size(), x0.size(), x3.size(), x4.size(), x2.size(), x1.size());
               // tensor label: I985
-              std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x5, x4, x2, x1, x0);
-              std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x5, x4, x2, x1, x0)]);
-              sort_indices<1,5,0,2,3,4,0,1,1,1>(i1data, i1data_sorted, x3.size(), x5.size(), x4.size(), x2.size(), x1.size(), x0.size());
+              const double* i1data = in(1)->get_block_view(x3, x5, x4, x2, x1, x0);
+              BlockBuffer i1data_sorted(in(1)->get_size(x3, x5, x4, x2, x1, x0));
+              sort_indices<1,5,0,2,3,4,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), x5.size(), x4.size(), x2.size(), x1.size(), x0.size());
               dgemm_("T", "N", ci0.size(), 1, x3.size()*x5.size()*x4.size()*x2.size()*x1.size()*x0.size(),
-                     1.0, i0data_sorted, x3.size()*x5.size()*x4.size()*x2.size()*x1.size()*x0.size(), i1data_sorted, x3.size()*x5.size()*x4.size()*x2.size()*x1.size()*x0.size(),
-                     1.0, odata_sorted, ci0.size());
+                     1.0, i0data_sorted.get(), x3.size()*x5.size()*x4.size()*x2.size()*x1.size()*x0.size(), i1data_sorted.get(), x3.size()*x5.size()*x4.size()*x2.size()*x1.size()*x0.size(),
+                     1.0, odata_sorted.get(), ci0.size());
             }
           }
         }
       }
     }
   }
-  sort_indices<0,1,1,1,1>(odata_sorted, odata, ci0.size());
+  sort_indices<0,1,1,1,1>(odata_sorted.get(), odata.get(), ci0.size());
   out()->put_block(odata, ci0);
 }
 
@@ -958,22 +958,22 @@ void Task1090::Task_local::compute() {
   const Index x0 = b(5);
   // tensor label: I985
   std::unique_ptr<double[]> odata = out()->move_block(x3, x5, x4, x2, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x5, x4, x2, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, x5, x4, x2, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x5, x4, x2, x1, x0), 0.0);
   for (auto& a1 : *range_[2]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, x1, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, x1, x2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), x1.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, x1, x2);
+    BlockBuffer i0data_sorted(in(0)->get_size(x0, a1, x1, x2));
+    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), a1.size(), x1.size(), x2.size());
     // tensor label: I986
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x5, a1, x4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x5, a1, x4)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), x5.size(), a1.size(), x4.size());
+    const double* i1data = in(1)->get_block_view(x3, x5, a1, x4);
+    BlockBuffer i1data_sorted(in(1)->get_size(x3, x5, a1, x4));
+    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), x5.size(), a1.size(), x4.size());
     dgemm_("T", "N", x2.size()*x1.size()*x0.size(), x3.size()*x5.size()*x4.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+           1.0, i0data_sorted.get(), a1.size(), i1data_sorted.get(), a1.size(),
+           1.0, odata_sorted.get(), x2.size()*x1.size()*x0.size());
   }
-  sort_indices<3,4,5,2,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x3.size(), x5.size(), x4.size());
+  sort_indices<3,4,5,2,1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), x2.size(), x3.size(), x5.size(), x4.size());
   out()->put_block(odata, x3, x5, x4, x2, x1, x0);
 }
 
@@ -984,22 +984,22 @@ void Task1091::Task_local::compute() {
   const Index x4 = b(3);
   // tensor label: I986
   std::unique_ptr<double[]> odata = out()->move_block(x3, x5, a1, x4);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x5, a1, x4)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, x5, a1, x4));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x5, a1, x4), 0.0);
   for (auto& c2 : *range_[0]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, c2, x4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a1, c2, x4)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), a1.size(), c2.size(), x4.size());
+    const double* i0data = in(0)->get_block_view(x5, a1, c2, x4);
+    BlockBuffer i0data_sorted(in(0)->get_size(x5, a1, c2, x4));
+    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), a1.size(), c2.size(), x4.size());
     // tensor label: I987
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x3, c2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, c2)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, x3.size(), c2.size());
+    const double* i1data = in(1)->get_block_view(x3, c2);
+    BlockBuffer i1data_sorted(in(1)->get_size(x3, c2));
+    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), c2.size());
     dgemm_("T", "N", x5.size()*a1.size()*x4.size(), x3.size(), c2.size(),
-           1.0, i0data_sorted, c2.size(), i1data_sorted, c2.size(),
-           1.0, odata_sorted, x5.size()*a1.size()*x4.size());
+           1.0, i0data_sorted.get(), c2.size(), i1data_sorted.get(), c2.size(),
+           1.0, odata_sorted.get(), x5.size()*a1.size()*x4.size());
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), a1.size(), x4.size(), x3.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x5.size(), a1.size(), x4.size(), x3.size());
   out()->put_block(odata, x3, x5, a1, x4);
 }
 
@@ -1010,8 +1010,8 @@ void Task1092::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x3, c2);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, c2);
-    sort_indices<0,1,1,1,2,1>(i0data, odata, x3.size(), c2.size());
+    const double* i0data = in(0)->get_block_view(x3, c2);
+    sort_indices<0,1,1,1,2,1>(i0data, odata.get(), x3.size(), c2.size());
   }
   out()->put_block(odata, x3, c2);
 }
@@ -1020,7 +1020,7 @@ void Task1093::Task_local::compute() {
   const Index ci0 = b(0);
   // tensor label: I768
   std::unique_ptr<double[]> odata = out()->move_block(ci0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(ci0)]);
+  BlockBuffer odata_sorted(out()->get_size(ci0));
   std::fill_n(odata_sorted.get(), out()->get_size(ci0), 0.0);
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
@@ -1029,23 +1029,23 @@ void Task1093::Task_local::compute() {
           for (auto& x2 : *range_[1]) {
             for (auto& x1 : *range_[1]) {
               // tensor label: Gamma327
-              std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x5, x4, x3, x0, x2, x1);
-              std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(ci0, x5, x4, x3, x0, x2, x1)]);
-              sort_indices<1,2,3,4,5,6,0,0,1,1,1>(i0data, i0data_sorted, ci0.size(), x5.size(), x4.size(), x3.size(), x0.size(), x2.size(), x1.size());
+              const double* i0data = in(0)->get_block_view(ci0, x5, x4, x3, x0, x2, x1);
+              BlockBuffer i0data_sorted(in(0)->get_size(ci0, x5, x4, x3, x0, x2, x1));
+              sort_indices<1,2,3,4,5,6,0,0,1,1,1>(i0data, i0data_sorted.get(), ci0.size(), x5.size(), x4.size(), x3.size(), x0.size(), x2.size(), x1.size());
               // tensor label: I989
-              std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x5, x4, x2, x1, x0);
-              std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x5, x4, x2, x1, x0)]);
-              sort_indices<1,2,0,5,3,4,0,1,1,1>(i1data, i1data_sorted, x3.size(), x5.size(), x4.size(), x2.size(), x1.size(), x0.size());
+              const double* i1data = in(1)->get_block_view(x3, x5, x4, x2, x1, x0);
+              BlockBuffer i1data_sorted(in(1)->get_size(x3, x5, x4, x2, x1, x0));
+              sort_indices<1,2,0,5,3,4,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), x5.size(), x4.size(), x2.size(), x1.size(), x0.size());
               dgemm_("T", "N", ci0.size(), 1, x3.size()*x5.size()*x4.size()*x2.size()*x1.size()*x0.size(),
-                     1.0, i0data_sorted, x3.size()*x5.size()*x4.size()*x2.size()*x1.size()*x0.size(), i1data_sorted, x3.size()*x5.size()*x4.size()*x2.size()*x1.size()*x0.size(),
-                     1.0, odata_sorted, ci0.size());
+                     1.0, i0data_sorted.get(), x3.size()*x5.size()*x4.size()*x2.size()*x1.size()*x0.size(), i1data_sorted.get(), x3.size()*x5.size()*x4.size()*x2.size()*x1.size()*x0.size(),
+                     1.0, odata_sorted.get(), ci0.size());
             }
           }
         }
       }
     }
   }
-  sort_indices<0,1,1,1,1>(odata_sorted, odata, ci0.size());
+  sort_indices<0,1,1,1,1>(odata_sorted.get(), odata.get(), ci0.size());
   out()->put_block(odata, ci0);
 }
 
@@ -1058,22 +1058,22 @@ void Task1094::Task_local::compute() {
   const Index x0 = b(5);
   // tensor label: I989
   std::unique_ptr<double[]> odata = out()->move_block(x3, x5, x4, x2, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x5, x4, x2, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, x5, x4, x2, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x5, x4, x2, x1, x0), 0.0);
   for (auto& a1 : *range_[2]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, x1, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, x1, x2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), x1.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, x1, x2);
+    BlockBuffer i0data_sorted(in(0)->get_size(x0, a1, x1, x2));
+    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), a1.size(), x1.size(), x2.size());
     // tensor label: I990
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, x5, x4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, x5, x4)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), a1.size(), x5.size(), x4.size());
+    const double* i1data = in(1)->get_block_view(x3, a1, x5, x4);
+    BlockBuffer i1data_sorted(in(1)->get_size(x3, a1, x5, x4));
+    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), a1.size(), x5.size(), x4.size());
     dgemm_("T", "N", x2.size()*x1.size()*x0.size(), x3.size()*x5.size()*x4.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+           1.0, i0data_sorted.get(), a1.size(), i1data_sorted.get(), a1.size(),
+           1.0, odata_sorted.get(), x2.size()*x1.size()*x0.size());
   }
-  sort_indices<3,4,5,2,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x3.size(), x5.size(), x4.size());
+  sort_indices<3,4,5,2,1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), x2.size(), x3.size(), x5.size(), x4.size());
   out()->put_block(odata, x3, x5, x4, x2, x1, x0);
 }
 
@@ -1084,22 +1084,22 @@ void Task1095::Task_local::compute() {
   const Index x4 = b(3);
   // tensor label: I990
   std::unique_ptr<double[]> odata = out()->move_block(x3, a1, x5, x4);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, a1, x5, x4)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, a1, x5, x4));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, a1, x5, x4), 0.0);
   for (auto& c2 : *range_[0]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, x5, x4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1, x5, x4)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size(), x5.size(), x4.size());
+    const double* i0data = in(0)->get_block_view(c2, a1, x5, x4);
+    BlockBuffer i0data_sorted(in(0)->get_size(c2, a1, x5, x4));
+    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c2.size(), a1.size(), x5.size(), x4.size());
     // tensor label: I991
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x3, c2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, c2)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, x3.size(), c2.size());
+    const double* i1data = in(1)->get_block_view(x3, c2);
+    BlockBuffer i1data_sorted(in(1)->get_size(x3, c2));
+    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), c2.size());
     dgemm_("T", "N", a1.size()*x5.size()*x4.size(), x3.size(), c2.size(),
-           1.0, i0data_sorted, c2.size(), i1data_sorted, c2.size(),
-           1.0, odata_sorted, a1.size()*x5.size()*x4.size());
+           1.0, i0data_sorted.get(), c2.size(), i1data_sorted.get(), c2.size(),
+           1.0, odata_sorted.get(), a1.size()*x5.size()*x4.size());
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, a1.size(), x5.size(), x4.size(), x3.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), a1.size(), x5.size(), x4.size(), x3.size());
   out()->put_block(odata, x3, a1, x5, x4);
 }
 
@@ -1110,8 +1110,8 @@ void Task1096::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x3, c2);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, c2);
-    sort_indices<0,1,1,1,-2,1>(i0data, odata, x3.size(), c2.size());
+    const double* i0data = in(0)->get_block_view(x3, c2);
+    sort_indices<0,1,1,1,-2,1>(i0data, odata.get(), x3.size(), c2.size());
   }
   out()->put_block(odata, x3, c2);
 }
@@ -1125,22 +1125,22 @@ void Task1097::Task_local::compute() {
   const Index x0 = b(5);
   // tensor label: I989
   std::unique_ptr<double[]> odata = out()->move_block(x3, x5, x4, x2, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x5, x4, x2, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, x5, x4, x2, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x5, x4, x2, x1, x0), 0.0);
   for (auto& a1 : *range_[2]) {
     // tensor label: v2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x3, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x3, a1)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x3.size(), a1.size());
+    const double* i0data = in(0)->get_block_view(x5, x4, x3, a1);
+    BlockBuffer i0data_sorted(in(0)->get_size(x5, x4, x3, a1));
+    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), x4.size(), x3.size(), a1.size());
     // tensor label: I1210
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x2, x1, a1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, x1, a1, x0)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x2.size(), x1.size(), a1.size(), x0.size());
+    const double* i1data = in(1)->get_block_view(x2, x1, a1, x0);
+    BlockBuffer i1data_sorted(in(1)->get_size(x2, x1, a1, x0));
+    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), x1.size(), a1.size(), x0.size());
     dgemm_("T", "N", x5.size()*x4.size()*x3.size(), x2.size()*x1.size()*x0.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, x5.size()*x4.size()*x3.size());
+           1.0, i0data_sorted.get(), a1.size(), i1data_sorted.get(), a1.size(),
+           1.0, odata_sorted.get(), x5.size()*x4.size()*x3.size());
   }
-  sort_indices<2,0,1,3,4,5,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<2,0,1,3,4,5,1,1,1,1>(odata_sorted.get(), odata.get(), x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x3, x5, x4, x2, x1, x0);
 }
 
@@ -1153,8 +1153,8 @@ void Task1098::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x2, x1, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, x1, x2);
-    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata, x0.size(), a1.size(), x1.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, x1, x2);
+    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata.get(), x0.size(), a1.size(), x1.size(), x2.size());
   }
   out()->put_block(odata, x2, x1, a1, x0);
 }
@@ -1163,7 +1163,7 @@ void Task1099::Task_local::compute() {
   const Index ci0 = b(0);
   // tensor label: I768
   std::unique_ptr<double[]> odata = out()->move_block(ci0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(ci0)]);
+  BlockBuffer odata_sorted(out()->get_size(ci0));
   std::fill_n(odata_sorted.get(), out()->get_size(ci0), 0.0);
   for (auto& x7 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
@@ -1172,23 +1172,23 @@ void Task1099::Task_local::compute() {
           for (auto& x2 : *range_[1]) {
             for (auto& x1 : *range_[1]) {
               // tensor label: Gamma328
-              std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x7, x0, x6, x5, x2, x1);
-              std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(ci0, x7, x0, x6, x5, x2, x1)]);
-              sort_indices<1,2,3,4,5,6,0,0,1,1,1>(i0data, i0data_sorted, ci0.size(), x7.size(), x0.size(), x6.size(), x5.size(), x2.size(), x1.size());
+              const double* i0data = in(0)->get_block_view(ci0, x7, x0, x6, x5, x2, x1);
+              BlockBuffer i0data_sorted(in(0)->get_size(ci0, x7, x0, x6, x5, x2, x1));
+              sort_indices<1,2,3,4,5,6,0,0,1,1,1>(i0data, i0data_sorted.get(), ci0.size(), x7.size(), x0.size(), x6.size(), x5.size(), x2.size(), x1.size());
               // tensor label: I993
-              std::unique_ptr<double[]> i1data = in(1)->get_block(x2, x1, x0, x7, x6, x5);
-              std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, x1, x0, x7, x6, x5)]);
-              sort_indices<3,2,4,5,0,1,0,1,1,1>(i1data, i1data_sorted, x2.size(), x1.size(), x0.size(), x7.size(), x6.size(), x5.size());
+              const double* i1data = in(1)->get_block_view(x2, x1, x0, x7, x6, x5);
+              BlockBuffer i1data_sorted(in(1)->get_size(x2, x1, x0, x7, x6, x5));
+              sort_indices<3,2,4,5,0,1,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), x1.size(), x0.size(), x7.size(), x6.size(), x5.size());
               dgemm_("T", "N", ci0.size(), 1, x2.size()*x1.size()*x0.size()*x7.size()*x6.size()*x5.size(),
-                     1.0, i0data_sorted, x2.size()*x1.size()*x0.size()*x7.size()*x6.size()*x5.size(), i1data_sorted, x2.size()*x1.size()*x0.size()*x7.size()*x6.size()*x5.size(),
-                     1.0, odata_sorted, ci0.size());
+                     1.0, i0data_sorted.get(), x2.size()*x1.size()*x0.size()*x7.size()*x6.size()*x5.size(), i1data_sorted.get(), x2.size()*x1.size()*x0.size()*x7.size()*x6.size()*x5.size(),
+                     1.0, odata_sorted.get(), ci0.size());
             }
           }
         }
       }
     }
   }
-  sort_indices<0,1,1,1,1>(odata_sorted, odata, ci0.size());
+  sort_indices<0,1,1,1,1>(odata_sorted.get(), odata.get(), ci0.size());
   out()->put_block(odata, ci0);
 }
 
@@ -42,22 +42,22 @@ void Task1100::Task_local::compute() {
   const Index x5 = b(5);
   // tensor label: I993
   std::unique_ptr<double[]> odata = out()->move_block(x2, x1, x0, x7, x6, x5);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1, x0, x7, x6, x5)]);
+  BlockBuffer odata_sorted(out()->get_size(x2, x1, x0, x7, x6, x5));
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1, x0, x7, x6, x5), 0.0);
   for (auto& a1 : *range_[2]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x7, a1, x6, x5);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, a1, x6, x5)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x7.size(), a1.size(), x6.size(), x5.size());
+    const double* i0data = in(0)->get_block_view(x7, a1, x6, x5);
+    BlockBuffer i0data_sorted(in(0)->get_size(x7, a1, x6, x5));
+    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x7.size(), a1.size(), x6.size(), x5.size());
     // tensor label: I994
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x2, x1, a1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, x1, a1, x0)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x2.size(), x1.size(), a1.size(), x0.size());
+    const double* i1data = in(1)->get_block_view(x2, x1, a1, x0);
+    BlockBuffer i1data_sorted(in(1)->get_size(x2, x1, a1, x0));
+    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), x1.size(), a1.size(), x0.size());
     dgemm_("T", "N", x7.size()*x6.size()*x5.size(), x2.size()*x1.size()*x0.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, x7.size()*x6.size()*x5.size());
+           1.0, i0data_sorted.get(), a1.size(), i1data_sorted.get(), a1.size(),
+           1.0, odata_sorted.get(), x7.size()*x6.size()*x5.size());
   }
-  sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted, odata, x7.size(), x6.size(), x5.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x7.size(), x6.size(), x5.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x2, x1, x0, x7, x6, x5);
 }
 
@@ -70,8 +70,8 @@ void Task1101::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x2, x1, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, x1, x2);
-    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata, x0.size(), a1.size(), x1.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, x1, x2);
+    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata.get(), x0.size(), a1.size(), x1.size(), x2.size());
   }
   out()->put_block(odata, x2, x1, a1, x0);
 }
@@ -80,7 +80,7 @@ void Task1102::Task_local::compute() {
   const Index ci0 = b(0);
   // tensor label: I768
   std::unique_ptr<double[]> odata = out()->move_block(ci0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(ci0)]);
+  BlockBuffer odata_sorted(out()->get_size(ci0));
   std::fill_n(odata_sorted.get(), out()->get_size(ci0), 0.0);
   for (auto& x5 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
@@ -89,23 +89,23 @@ void Task1102::Task_local::compute() {
           for (auto& x2 : *range_[1]) {
             for (auto& x1 : *range_[1]) {
               // tensor label: Gamma329
-              std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x5, x0, x4, x3, x2, x1);
-              std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(ci0, x5, x0, x4, x3, x2, x1)]);
-              sort_indices<1,2,3,4,5,6,0,0,1,1,1>(i0data, i0data_sorted, ci0.size(), x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
+              const double* i0data = in(0)->get_block_view(ci0, x5, x0, x4, x3, x2, x1);
+              BlockBuffer i0data_sorted(in(0)->get_size(ci0, x5, x0, x4, x3, x2, x1));
+              sort_indices<1,2,3,4,5,6,0,0,1,1,1>(i0data, i0data_sorted.get(), ci0.size(), x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
               // tensor label: I996
-              std::unique_ptr<double[]> i1data = in(1)->get_block(x2, x1, x0, x5, x4, x3);
-              std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, x1, x0, x5, x4, x3)]);
-              sort_indices<3,2,4,5,0,1,0,1,1,1>(i1data, i1data_sorted, x2.size(), x1.size(), x0.size(), x5.size(), x4.size(), x3.size());
+              const double* i1data = in(1)->get_block_view(x2, x1, x0, x5, x4, x3);
+              BlockBuffer i1data_sorted(in(1)->get_size(x2, x1, x0, x5, x4, x3));
+              sort_indices<3,2,4,5,0,1,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), x1.size(), x0.size(), x5.size(), x4.size(), x3.size());
               dgemm_("T", "N", ci0.size(), 1, x2.size()*x1.size()*x0.size()*x5.size()*x4.size()*x3.size(),
-                     1.0, i0data_sorted, x2.size()*x1.size()*x0.size()*x5.size()*x4.size()*x3.size(), i1data_sorted, x2.size()*x1.size()*x0.size()*x5.size()*x4.size()*x3.size(),
-                     1.0, odata_sorted, ci0.size());
+                     1.0, i0data_sorted.get(), x2.size()*x1.size()*x0.size()*x5.size()*x4.size()*x3.size(), i1data_sorted.get(), x2.size()*x1.size()*x0.size()*x5.size()*x4.size()*x3.size(),
+                     1.0, odata_sorted.get(), ci0.size());
             }
           }
         }
       }
     }
   }
-  sort_indices<0,1,1,1,1>(odata_sorted, odata, ci0.size());
+  sort_indices<0,1,1,1,1>(odata_sorted.get(), odata.get(), ci0.size());
   out()->put_block(odata, ci0);
 }
 
@@ -118,22 +118,22 @@ void Task1103::Task_local::compute() {
   const Index x3 = b(5);
   // tensor label: I996
   std::unique_ptr<double[]> odata = out()->move_block(x2, x1, x0, x5, x4, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1, x0, x5, x4, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(x2, x1, x0, x5, x4, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1, x0, x5, x4, x3), 0.0);
   for (auto& a2 : *range_[2]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a2, x4, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a2, x4, x3)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), a2.size(), x4.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(x5, a2, x4, x3);
+    BlockBuffer i0data_sorted(in(0)->get_size(x5, a2, x4, x3));
+    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), a2.size(), x4.size(), x3.size());
     // tensor label: I997
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x2, x1, x0, a2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, x1, x0, a2)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, x2.size(), x1.size(), x0.size(), a2.size());
+    const double* i1data = in(1)->get_block_view(x2, x1, x0, a2);
+    BlockBuffer i1data_sorted(in(1)->get_size(x2, x1, x0, a2));
+    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), x1.size(), x0.size(), a2.size());
     dgemm_("T", "N", x5.size()*x4.size()*x3.size(), x2.size()*x1.size()*x0.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, x5.size()*x4.size()*x3.size());
+           1.0, i0data_sorted.get(), a2.size(), i1data_sorted.get(), a2.size(),
+           1.0, odata_sorted.get(), x5.size()*x4.size()*x3.size());
   }
-  sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x2, x1, x0, x5, x4, x3);
 }
 
@@ -144,22 +144,22 @@ void Task1104::Task_local::compute() {
   const Index a2 = b(3);
   // tensor label: I997
   std::unique_ptr<double[]> odata = out()->move_block(x2, x1, x0, a2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1, x0, a2)]);
+  BlockBuffer odata_sorted(out()->get_size(x2, x1, x0, a2));
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1, x0, a2), 0.0);
   for (auto& a1 : *range_[2]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a2, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a2, a1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, a2.size(), a1.size());
+    const double* i0data = in(0)->get_block_view(a2, a1);
+    BlockBuffer i0data_sorted(in(0)->get_size(a2, a1));
+    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted.get(), a2.size(), a1.size());
     // tensor label: I998
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x2, x1, a1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, x1, a1, x0)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x2.size(), x1.size(), a1.size(), x0.size());
+    const double* i1data = in(1)->get_block_view(x2, x1, a1, x0);
+    BlockBuffer i1data_sorted(in(1)->get_size(x2, x1, a1, x0));
+    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), x1.size(), a1.size(), x0.size());
     dgemm_("T", "N", a2.size(), x2.size()*x1.size()*x0.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, a2.size());
+           1.0, i0data_sorted.get(), a1.size(), i1data_sorted.get(), a1.size(),
+           1.0, odata_sorted.get(), a2.size());
   }
-  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a2.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted.get(), odata.get(), a2.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x2, x1, x0, a2);
 }
 
@@ -172,8 +172,8 @@ void Task1105::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x2, x1, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, x1, x2);
-    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata, x0.size(), a1.size(), x1.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, x1, x2);
+    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata.get(), x0.size(), a1.size(), x1.size(), x2.size());
   }
   out()->put_block(odata, x2, x1, a1, x0);
 }
@@ -187,22 +187,22 @@ void Task1106::Task_local::compute() {
   const Index x3 = b(5);
   // tensor label: I996
   std::unique_ptr<double[]> odata = out()->move_block(x2, x1, x0, x5, x4, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1, x0, x5, x4, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(x2, x1, x0, x5, x4, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1, x0, x5, x4, x3), 0.0);
   for (auto& a1 : *range_[2]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, x1, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, x1, x2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), x1.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, x1, x2);
+    BlockBuffer i0data_sorted(in(0)->get_size(x0, a1, x1, x2));
+    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), a1.size(), x1.size(), x2.size());
     // tensor label: I1009
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x5, a1, x4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x5, a1, x4)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), x5.size(), a1.size(), x4.size());
+    const double* i1data = in(1)->get_block_view(x3, x5, a1, x4);
+    BlockBuffer i1data_sorted(in(1)->get_size(x3, x5, a1, x4));
+    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), x5.size(), a1.size(), x4.size());
     dgemm_("T", "N", x2.size()*x1.size()*x0.size(), x3.size()*x5.size()*x4.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+           1.0, i0data_sorted.get(), a1.size(), i1data_sorted.get(), a1.size(),
+           1.0, odata_sorted.get(), x2.size()*x1.size()*x0.size());
   }
-  sort_indices<2,1,0,4,5,3,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x3.size(), x5.size(), x4.size());
+  sort_indices<2,1,0,4,5,3,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), x2.size(), x3.size(), x5.size(), x4.size());
   out()->put_block(odata, x2, x1, x0, x5, x4, x3);
 }
 
@@ -213,22 +213,22 @@ void Task1107::Task_local::compute() {
   const Index x4 = b(3);
   // tensor label: I1009
   std::unique_ptr<double[]> odata = out()->move_block(x3, x5, a1, x4);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x5, a1, x4)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, x5, a1, x4));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x5, a1, x4), 0.0);
   for (auto& a2 : *range_[2]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, x4, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a1, x4, a2)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, x5.size(), a1.size(), x4.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(x5, a1, x4, a2);
+    BlockBuffer i0data_sorted(in(0)->get_size(x5, a1, x4, a2));
+    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), a1.size(), x4.size(), a2.size());
     // tensor label: I1010
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a2, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, x3)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a2.size(), x3.size());
+    const double* i1data = in(1)->get_block_view(a2, x3);
+    BlockBuffer i1data_sorted(in(1)->get_size(a2, x3));
+    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a2.size(), x3.size());
     dgemm_("T", "N", x5.size()*a1.size()*x4.size(), x3.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, x5.size()*a1.size()*x4.size());
+           1.0, i0data_sorted.get(), a2.size(), i1data_sorted.get(), a2.size(),
+           1.0, odata_sorted.get(), x5.size()*a1.size()*x4.size());
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), a1.size(), x4.size(), x3.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x5.size(), a1.size(), x4.size(), x3.size());
   out()->put_block(odata, x3, x5, a1, x4);
 }
 
@@ -239,8 +239,8 @@ void Task1108::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a2, x3);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a2, x3);
-    sort_indices<0,1,1,1,4,1>(i0data, odata, a2.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(a2, x3);
+    sort_indices<0,1,1,1,4,1>(i0data, odata.get(), a2.size(), x3.size());
   }
   out()->put_block(odata, a2, x3);
 }
@@ -254,22 +254,22 @@ void Task1109::Task_local::compute() {
   const Index x3 = b(5);
   // tensor label: I996
   std::unique_ptr<double[]> odata = out()->move_block(x2, x1, x0, x5, x4, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1, x0, x5, x4, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(x2, x1, x0, x5, x4, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1, x0, x5, x4, x3), 0.0);
   for (auto& a1 : *range_[2]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, x4, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a1, x4, x3)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), a1.size(), x4.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(x5, a1, x4, x3);
+    BlockBuffer i0data_sorted(in(0)->get_size(x5, a1, x4, x3));
+    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), a1.size(), x4.size(), x3.size());
     // tensor label: I1117
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a1, x0, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a1, x0, x2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), a1.size(), x0.size(), x2.size());
+    const double* i1data = in(1)->get_block_view(x1, a1, x0, x2);
+    BlockBuffer i1data_sorted(in(1)->get_size(x1, a1, x0, x2));
+    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), a1.size(), x0.size(), x2.size());
     dgemm_("T", "N", x5.size()*x4.size()*x3.size(), x1.size()*x0.size()*x2.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, x5.size()*x4.size()*x3.size());
+           1.0, i0data_sorted.get(), a1.size(), i1data_sorted.get(), a1.size(),
+           1.0, odata_sorted.get(), x5.size()*x4.size()*x3.size());
   }
-  sort_indices<5,3,4,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), x1.size(), x0.size(), x2.size());
+  sort_indices<5,3,4,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x5.size(), x4.size(), x3.size(), x1.size(), x0.size(), x2.size());
   out()->put_block(odata, x2, x1, x0, x5, x4, x3);
 }
 
@@ -284,7 +284,7 @@ void Task1110::Task_local::compute() {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, x1, x2);
     dscal_(x2.size()*x1.size()*a1.size()*x0.size(), e0_, i0data.get(), 1);
-    sort_indices<2,1,0,3,1,1,-2,1>(i0data, odata, x0.size(), a1.size(), x1.size(), x2.size());
+    sort_indices<2,1,0,3,1,1,-2,1>(i0data.get(), odata.get(), x0.size(), a1.size(), x1.size(), x2.size());
   }
   out()->put_block(odata, x1, a1, x0, x2);
 }
@@ -296,22 +296,22 @@ void Task1111::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I1117
   std::unique_ptr<double[]> odata = out()->move_block(x1, a1, x0, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, a1, x0, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, a1, x0, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, a1, x0, x2), 0.0);
   for (auto& a2 : *range_[2]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x2, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, a2)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x2.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(x2, a2);
+    BlockBuffer i0data_sorted(in(0)->get_size(x2, a2));
+    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted.get(), x2.size(), a2.size());
     // tensor label: I1118
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a2, x1, a1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, x1, a1, x0)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, a2.size(), x1.size(), a1.size(), x0.size());
+    const double* i1data = in(1)->get_block_view(a2, x1, a1, x0);
+    BlockBuffer i1data_sorted(in(1)->get_size(a2, x1, a1, x0));
+    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted.get(), a2.size(), x1.size(), a1.size(), x0.size());
     dgemm_("T", "N", x2.size(), x1.size()*a1.size()*x0.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, x2.size());
+           1.0, i0data_sorted.get(), a2.size(), i1data_sorted.get(), a2.size(),
+           1.0, odata_sorted.get(), x2.size());
   }
-  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size(), a1.size(), x0.size());
+  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted.get(), odata.get(), x2.size(), x1.size(), a1.size(), x0.size());
   out()->put_block(odata, x1, a1, x0, x2);
 }
 
@@ -324,8 +324,8 @@ void Task1112::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a2, x1, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, x1, a2);
-    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata, x0.size(), a1.size(), x1.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, x1, a2);
+    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata.get(), x0.size(), a1.size(), x1.size(), a2.size());
   }
   out()->put_block(odata, a2, x1, a1, x0);
 }
@@ -339,22 +339,22 @@ void Task1113::Task_local::compute() {
   const Index x3 = b(5);
   // tensor label: I996
   std::unique_ptr<double[]> odata = out()->move_block(x2, x1, x0, x5, x4, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1, x0, x5, x4, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(x2, x1, x0, x5, x4, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1, x0, x5, x4, x3), 0.0);
   for (auto& a1 : *range_[2]) {
     // tensor label: v2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, x4, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a1, x4, x3)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), a1.size(), x4.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(x5, a1, x4, x3);
+    BlockBuffer i0data_sorted(in(0)->get_size(x5, a1, x4, x3));
+    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), a1.size(), x4.size(), x3.size());
     // tensor label: I1207
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x2, x1, a1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, x1, a1, x0)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x2.size(), x1.size(), a1.size(), x0.size());
+    const double* i1data = in(1)->get_block_view(x2, x1, a1, x0);
+    BlockBuffer i1data_sorted(in(1)->get_size(x2, x1, a1, x0));
+    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), x1.size(), a1.size(), x0.size());
     dgemm_("T", "N", x5.size()*x4.size()*x3.size(), x2.size()*x1.size()*x0.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, x5.size()*x4.size()*x3.size());
+           1.0, i0data_sorted.get(), a1.size(), i1data_sorted.get(), a1.size(),
+           1.0, odata_sorted.get(), x5.size()*x4.size()*x3.size());
   }
-  sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x2, x1, x0, x5, x4, x3);
 }
 
@@ -367,8 +367,8 @@ void Task1114::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x2, x1, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, x1, x2);
-    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata, x0.size(), a1.size(), x1.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, x1, x2);
+    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata.get(), x0.size(), a1.size(), x1.size(), x2.size());
   }
   out()->put_block(odata, x2, x1, a1, x0);
 }
@@ -382,22 +382,22 @@ void Task1115::Task_local::compute() {
   const Index x3 = b(5);
   // tensor label: I996
   std::unique_ptr<double[]> odata = out()->move_block(x2, x1, x0, x5, x4, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1, x0, x5, x4, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(x2, x1, x0, x5, x4, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1, x0, x5, x4, x3), 0.0);
   for (auto& a1 : *range_[2]) {
     // tensor label: v2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, x1, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, x1, x2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), x1.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, x1, x2);
+    BlockBuffer i0data_sorted(in(0)->get_size(x0, a1, x1, x2));
+    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), a1.size(), x1.size(), x2.size());
     // tensor label: I1261
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x4, a1, x5);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x4, a1, x5)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), x4.size(), a1.size(), x5.size());
+    const double* i1data = in(1)->get_block_view(x3, x4, a1, x5);
+    BlockBuffer i1data_sorted(in(1)->get_size(x3, x4, a1, x5));
+    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), x4.size(), a1.size(), x5.size());
     dgemm_("T", "N", x0.size()*x1.size()*x2.size(), x3.size()*x4.size()*x5.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, x0.size()*x1.size()*x2.size());
+           1.0, i0data_sorted.get(), a1.size(), i1data_sorted.get(), a1.size(),
+           1.0, odata_sorted.get(), x0.size()*x1.size()*x2.size());
   }
-  sort_indices<2,1,0,5,4,3,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x3.size(), x4.size(), x5.size());
+  sort_indices<2,1,0,5,4,3,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), x2.size(), x3.size(), x4.size(), x5.size());
   out()->put_block(odata, x2, x1, x0, x5, x4, x3);
 }
 
@@ -410,8 +410,8 @@ void Task1116::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x3, x4, a1, x5);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, x4, x3);
-    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata, x5.size(), a1.size(), x4.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(x5, a1, x4, x3);
+    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata.get(), x5.size(), a1.size(), x4.size(), x3.size());
   }
   out()->put_block(odata, x3, x4, a1, x5);
 }
@@ -420,28 +420,28 @@ void Task1117::Task_local::compute() {
   const Index ci0 = b(0);
   // tensor label: I768
   std::unique_ptr<double[]> odata = out()->move_block(ci0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(ci0)]);
+  BlockBuffer odata_sorted(out()->get_size(ci0));
   std::fill_n(odata_sorted.get(), out()->get_size(ci0), 0.0);
   for (auto& x3 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         for (auto& x1 : *range_[1]) {
           // tensor label: Gamma330
-          std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x3, x0, x2, x1);
-          std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(ci0, x3, x0, x2, x1)]);
-          sort_indices<1,2,3,4,0,0,1,1,1>(i0data, i0data_sorted, ci0.size(), x3.size(), x0.size(), x2.size(), x1.size());
+          const double* i0data = in(0)->get_block_view(ci0, x3, x0, x2, x1);
+          BlockBuffer i0data_sorted(in(0)->get_size(ci0, x3, x0, x2, x1));
+          sort_indices<1,2,3,4,0,0,1,1,1>(i0data, i0data_sorted.get(), ci0.size(), x3.size(), x0.size(), x2.size(), x1.size());
           // tensor label: I1000
-          std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, x1, x0);
-          std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, x1, x0)]);
-          sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+          const double* i1data = in(1)->get_block_view(x3, x2, x1, x0);
+          BlockBuffer i1data_sorted(in(1)->get_size(x3, x2, x1, x0));
+          sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), x2.size(), x1.size(), x0.size());
           dgemm_("T", "N", ci0.size(), 1, x3.size()*x2.size()*x1.size()*x0.size(),
-                 1.0, i0data_sorted, x3.size()*x2.size()*x1.size()*x0.size(), i1data_sorted, x3.size()*x2.size()*x1.size()*x0.size(),
-                 1.0, odata_sorted, ci0.size());
+                 1.0, i0data_sorted.get(), x3.size()*x2.size()*x1.size()*x0.size(), i1data_sorted.get(), x3.size()*x2.size()*x1.size()*x0.size(),
+                 1.0, odata_sorted.get(), ci0.size());
         }
       }
     }
   }
-  sort_indices<0,1,1,1,1>(odata_sorted, odata, ci0.size());
+  sort_indices<0,1,1,1,1>(odata_sorted.get(), odata.get(), ci0.size());
   out()->put_block(odata, ci0);
 }
 
@@ -452,22 +452,22 @@ void Task1118::Task_local::compute() {
   const Index x0 = b(3);
   // tensor label: I1000
   std::unique_ptr<double[]> odata = out()->move_block(x3, x2, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, x2, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, x1, x0), 0.0);
   for (auto& a1 : *range_[2]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, x1, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, x1, x2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), x1.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, x1, x2);
+    BlockBuffer i0data_sorted(in(0)->get_size(x0, a1, x1, x2));
+    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), a1.size(), x1.size(), x2.size());
     // tensor label: I1001
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, x3.size(), a1.size());
+    const double* i1data = in(1)->get_block_view(x3, a1);
+    BlockBuffer i1data_sorted(in(1)->get_size(x3, a1));
+    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), a1.size());
     dgemm_("T", "N", x2.size()*x1.size()*x0.size(), x3.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+           1.0, i0data_sorted.get(), a1.size(), i1data_sorted.get(), a1.size(),
+           1.0, odata_sorted.get(), x2.size()*x1.size()*x0.size());
   }
-  sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x3.size());
+  sort_indices<3,2,1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), x2.size(), x3.size());
   out()->put_block(odata, x3, x2, x1, x0);
 }
 
@@ -476,24 +476,24 @@ void Task1119::Task_local::compute() {
   const Index a1 = b(1);
   // tensor label: I1001
   std::unique_ptr<double[]> odata = out()->move_block(x3, a1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, a1)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, a1));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, a1), 0.0);
   for (auto& a3 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a3, c2, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a3, c2, a1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a3.size(), c2.size(), a1.size());
+      const double* i0data = in(0)->get_block_view(x3, a3, c2, a1);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, a3, c2, a1));
+      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a3.size(), c2.size(), a1.size());
       // tensor label: I1002
-      std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2)]);
-      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size());
+      const double* i1data = in(1)->get_block_view(a3, c2);
+      BlockBuffer i1data_sorted(in(1)->get_size(a3, c2));
+      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), c2.size());
       dgemm_("T", "N", x3.size()*a1.size(), 1, a3.size()*c2.size(),
-             1.0, i0data_sorted, a3.size()*c2.size(), i1data_sorted, a3.size()*c2.size(),
-             1.0, odata_sorted, x3.size()*a1.size());
+             1.0, i0data_sorted.get(), a3.size()*c2.size(), i1data_sorted.get(), a3.size()*c2.size(),
+             1.0, odata_sorted.get(), x3.size()*a1.size());
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x3.size(), a1.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), a1.size());
   out()->put_block(odata, x3, a1);
 }
 
@@ -504,8 +504,8 @@ void Task1120::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a3, c2);
-    sort_indices<0,1,1,1,-2,1>(i0data, odata, a3.size(), c2.size());
+    const double* i0data = in(0)->get_block_view(a3, c2);
+    sort_indices<0,1,1,1,-2,1>(i0data, odata.get(), a3.size(), c2.size());
   }
   out()->put_block(odata, a3, c2);
 }
@@ -515,24 +515,24 @@ void Task1121::Task_local::compute() {
   const Index a1 = b(1);
   // tensor label: I1001
   std::unique_ptr<double[]> odata = out()->move_block(x3, a1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, a1)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, a1));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, a1), 0.0);
   for (auto& c2 : *range_[0]) {
     for (auto& a3 : *range_[2]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, c2, a3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, c2, a3)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), c2.size(), a3.size());
+      const double* i0data = in(0)->get_block_view(x3, a1, c2, a3);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, a1, c2, a3));
+      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a1.size(), c2.size(), a3.size());
       // tensor label: I1006
-      std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2)]);
-      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size());
+      const double* i1data = in(1)->get_block_view(a3, c2);
+      BlockBuffer i1data_sorted(in(1)->get_size(a3, c2));
+      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), c2.size());
       dgemm_("T", "N", x3.size()*a1.size(), 1, a3.size()*c2.size(),
-             1.0, i0data_sorted, a3.size()*c2.size(), i1data_sorted, a3.size()*c2.size(),
-             1.0, odata_sorted, x3.size()*a1.size());
+             1.0, i0data_sorted.get(), a3.size()*c2.size(), i1data_sorted.get(), a3.size()*c2.size(),
+             1.0, odata_sorted.get(), x3.size()*a1.size());
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x3.size(), a1.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), a1.size());
   out()->put_block(odata, x3, a1);
 }
 
@@ -543,8 +543,8 @@ void Task1122::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a3, c2);
-    sort_indices<0,1,1,1,4,1>(i0data, odata, a3.size(), c2.size());
+    const double* i0data = in(0)->get_block_view(a3, c2);
+    sort_indices<0,1,1,1,4,1>(i0data, odata.get(), a3.size(), c2.size());
   }
   out()->put_block(odata, a3, c2);
 }
@@ -556,22 +556,22 @@ void Task1123::Task_local::compute() {
   const Index x0 = b(3);
   // tensor label: I1000
   std::unique_ptr<double[]> odata = out()->move_block(x3, x2, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, x2, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, x1, x0), 0.0);
   for (auto& a3 : *range_[2]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a3, x2, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a3, x2, x1)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a3.size(), x2.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x3, a3, x2, x1);
+    BlockBuffer i0data_sorted(in(0)->get_size(x3, a3, x2, x1));
+    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a3.size(), x2.size(), x1.size());
     // tensor label: I1067
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x0)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a3.size(), x0.size());
+    const double* i1data = in(1)->get_block_view(a3, x0);
+    BlockBuffer i1data_sorted(in(1)->get_size(a3, x0));
+    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), x0.size());
     dgemm_("T", "N", x3.size()*x2.size()*x1.size(), x0.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, x3.size()*x2.size()*x1.size());
+           1.0, i0data_sorted.get(), a3.size(), i1data_sorted.get(), a3.size(),
+           1.0, odata_sorted.get(), x3.size()*x2.size()*x1.size());
   }
-  sort_indices<0,1,2,3,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<0,1,2,3,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x3, x2, x1, x0);
 }
 
@@ -580,24 +580,24 @@ void Task1124::Task_local::compute() {
   const Index x0 = b(1);
   // tensor label: I1067
   std::unique_ptr<double[]> odata = out()->move_block(a3, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(a3, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(a3, x0), 0.0);
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: f1
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size());
+      const double* i0data = in(0)->get_block_view(c2, a1);
+      BlockBuffer i0data_sorted(in(0)->get_size(c2, a1));
+      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), c2.size(), a1.size());
       // tensor label: I1068
-      std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, a1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, a1, x0)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), a1.size(), x0.size());
+      const double* i1data = in(1)->get_block_view(a3, c2, a1, x0);
+      BlockBuffer i1data_sorted(in(1)->get_size(a3, c2, a1, x0));
+      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), c2.size(), a1.size(), x0.size());
       dgemm_("T", "N", 1, a3.size()*x0.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, 1);
+             1.0, i0data_sorted.get(), c2.size()*a1.size(), i1data_sorted.get(), c2.size()*a1.size(),
+             1.0, odata_sorted.get(), 1);
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, a3.size(), x0.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), a3.size(), x0.size());
   out()->put_block(odata, a3, x0);
 }
 
@@ -610,8 +610,8 @@ void Task1125::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata, x0.size(), a1.size(), c2.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, a3);
+    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), a3.size());
   }
   out()->put_block(odata, a3, c2, a1, x0);
 }
@@ -623,22 +623,22 @@ void Task1126::Task_local::compute() {
   const Index x0 = b(3);
   // tensor label: I1000
   std::unique_ptr<double[]> odata = out()->move_block(x3, x2, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, x2, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, x1, x0), 0.0);
   for (auto& a1 : *range_[2]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, x2, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, x2, x1)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), x2.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x3, a1, x2, x1);
+    BlockBuffer i0data_sorted(in(0)->get_size(x3, a1, x2, x1));
+    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a1.size(), x2.size(), x1.size());
     // tensor label: I1071
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, x0)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a1.size(), x0.size());
+    const double* i1data = in(1)->get_block_view(a1, x0);
+    BlockBuffer i1data_sorted(in(1)->get_size(a1, x0));
+    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a1.size(), x0.size());
     dgemm_("T", "N", x3.size()*x2.size()*x1.size(), x0.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, x3.size()*x2.size()*x1.size());
+           1.0, i0data_sorted.get(), a1.size(), i1data_sorted.get(), a1.size(),
+           1.0, odata_sorted.get(), x3.size()*x2.size()*x1.size());
   }
-  sort_indices<0,1,2,3,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<0,1,2,3,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x3, x2, x1, x0);
 }
 
@@ -647,24 +647,24 @@ void Task1127::Task_local::compute() {
   const Index x0 = b(1);
   // tensor label: I1071
   std::unique_ptr<double[]> odata = out()->move_block(a1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(a1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0), 0.0);
   for (auto& c2 : *range_[0]) {
     for (auto& a3 : *range_[2]) {
       // tensor label: f1
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a3)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), a3.size());
+      const double* i0data = in(0)->get_block_view(c2, a3);
+      BlockBuffer i0data_sorted(in(0)->get_size(c2, a3));
+      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), c2.size(), a3.size());
       // tensor label: I1072
-      std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, a1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, a1, x0)]);
-      sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), a1.size(), x0.size());
+      const double* i1data = in(1)->get_block_view(a3, c2, a1, x0);
+      BlockBuffer i1data_sorted(in(1)->get_size(a3, c2, a1, x0));
+      sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), c2.size(), a1.size(), x0.size());
       dgemm_("T", "N", 1, a1.size()*x0.size(), a3.size()*c2.size(),
-             1.0, i0data_sorted, a3.size()*c2.size(), i1data_sorted, a3.size()*c2.size(),
-             1.0, odata_sorted, 1);
+             1.0, i0data_sorted.get(), a3.size()*c2.size(), i1data_sorted.get(), a3.size()*c2.size(),
+             1.0, odata_sorted.get(), 1);
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, a1.size(), x0.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), a1.size(), x0.size());
   out()->put_block(odata, a1, x0);
 }
 
@@ -677,8 +677,8 @@ void Task1128::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata, x0.size(), a1.size(), c2.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, a3);
+    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), a3.size());
   }
   out()->put_block(odata, a3, c2, a1, x0);
 }
@@ -690,24 +690,24 @@ void Task1129::Task_local::compute() {
   const Index x0 = b(3);
   // tensor label: I1000
   std::unique_ptr<double[]> odata = out()->move_block(x3, x2, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, x2, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, x1, x0), 0.0);
   for (auto& a1 : *range_[2]) {
     for (auto& a3 : *range_[2]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, x2, a3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, x2, a3)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), x2.size(), a3.size());
+      const double* i0data = in(0)->get_block_view(x3, a1, x2, a3);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, a1, x2, a3));
+      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a1.size(), x2.size(), a3.size());
       // tensor label: I1113
-      std::unique_ptr<double[]> i1data = in(1)->get_block(a3, a1, x0, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, a1, x0, x1)]);
-      sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), a1.size(), x0.size(), x1.size());
+      const double* i1data = in(1)->get_block_view(a3, a1, x0, x1);
+      BlockBuffer i1data_sorted(in(1)->get_size(a3, a1, x0, x1));
+      sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), a1.size(), x0.size(), x1.size());
       dgemm_("T", "N", x3.size()*x2.size(), x0.size()*x1.size(), a3.size()*a1.size(),
-             1.0, i0data_sorted, a3.size()*a1.size(), i1data_sorted, a3.size()*a1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), a3.size()*a1.size(), i1data_sorted.get(), a3.size()*a1.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<0,1,3,2,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x0.size(), x1.size());
+  sort_indices<0,1,3,2,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x0.size(), x1.size());
   out()->put_block(odata, x3, x2, x1, x0);
 }
 
@@ -718,22 +718,22 @@ void Task1130::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I1113
   std::unique_ptr<double[]> odata = out()->move_block(a3, a1, x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, a1, x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(a3, a1, x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(a3, a1, x0, x1), 0.0);
   for (auto& c2 : *range_[0]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c2, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, x1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c2, x1);
+    BlockBuffer i0data_sorted(in(0)->get_size(c2, x1));
+    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), c2.size(), x1.size());
     // tensor label: I1114
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, a1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, a1, x0)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), a1.size(), x0.size());
+    const double* i1data = in(1)->get_block_view(a3, c2, a1, x0);
+    BlockBuffer i1data_sorted(in(1)->get_size(a3, c2, a1, x0));
+    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), c2.size(), a1.size(), x0.size());
     dgemm_("T", "N", x1.size(), a3.size()*a1.size()*x0.size(), c2.size(),
-           1.0, i0data_sorted, c2.size(), i1data_sorted, c2.size(),
-           1.0, odata_sorted, x1.size());
+           1.0, i0data_sorted.get(), c2.size(), i1data_sorted.get(), c2.size(),
+           1.0, odata_sorted.get(), x1.size());
   }
-  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x1.size(), a3.size(), a1.size(), x0.size());
+  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), a3.size(), a1.size(), x0.size());
   out()->put_block(odata, a3, a1, x0, x1);
 }
 
@@ -746,8 +746,8 @@ void Task1131::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-    sort_indices<3,2,1,0,1,1,-4,1>(i0data, odata, x0.size(), a1.size(), c2.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, a3);
+    sort_indices<3,2,1,0,1,1,-4,1>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), a3.size());
   }
   out()->put_block(odata, a3, c2, a1, x0);
 }
@@ -759,22 +759,22 @@ void Task1132::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I1113
   std::unique_ptr<double[]> odata = out()->move_block(a3, a1, x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, a1, x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(a3, a1, x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(a3, a1, x0, x1), 0.0);
   for (auto& a2 : *range_[2]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a3, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a3, a2)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, a3.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(a3, a2);
+    BlockBuffer i0data_sorted(in(0)->get_size(a3, a2));
+    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted.get(), a3.size(), a2.size());
     // tensor label: I1129
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a2, x1, a1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, x1, a1, x0)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, a2.size(), x1.size(), a1.size(), x0.size());
+    const double* i1data = in(1)->get_block_view(a2, x1, a1, x0);
+    BlockBuffer i1data_sorted(in(1)->get_size(a2, x1, a1, x0));
+    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted.get(), a2.size(), x1.size(), a1.size(), x0.size());
     dgemm_("T", "N", a3.size(), x1.size()*a1.size()*x0.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, a3.size());
+           1.0, i0data_sorted.get(), a2.size(), i1data_sorted.get(), a2.size(),
+           1.0, odata_sorted.get(), a3.size());
   }
-  sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, a3.size(), x1.size(), a1.size(), x0.size());
+  sort_indices<0,2,3,1,1,1,1,1>(odata_sorted.get(), odata.get(), a3.size(), x1.size(), a1.size(), x0.size());
   out()->put_block(odata, a3, a1, x0, x1);
 }
 
@@ -787,8 +787,8 @@ void Task1133::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a2, x1, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, x1, a2);
-    sort_indices<3,2,1,0,1,1,8,1>(i0data, odata, x0.size(), a1.size(), x1.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, x1, a2);
+    sort_indices<3,2,1,0,1,1,8,1>(i0data, odata.get(), x0.size(), a1.size(), x1.size(), a2.size());
   }
   out()->put_block(odata, a2, x1, a1, x0);
 }
@@ -800,24 +800,24 @@ void Task1134::Task_local::compute() {
   const Index x0 = b(3);
   // tensor label: I1000
   std::unique_ptr<double[]> odata = out()->move_block(x3, x2, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, x2, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, x1, x0), 0.0);
   for (auto& a2 : *range_[2]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, x1, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, x1, a2)]);
-      sort_indices<3,1,0,2,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), x1.size(), a2.size());
+      const double* i0data = in(0)->get_block_view(x0, a1, x1, a2);
+      BlockBuffer i0data_sorted(in(0)->get_size(x0, a1, x1, a2));
+      sort_indices<3,1,0,2,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), a1.size(), x1.size(), a2.size());
       // tensor label: I1121
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x2, x3, a1, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, x3, a1, a2)]);
-      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted, x2.size(), x3.size(), a1.size(), a2.size());
+      const double* i1data = in(1)->get_block_view(x2, x3, a1, a2);
+      BlockBuffer i1data_sorted(in(1)->get_size(x2, x3, a1, a2));
+      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), x3.size(), a1.size(), a2.size());
       dgemm_("T", "N", x1.size()*x0.size(), x2.size()*x3.size(), a1.size()*a2.size(),
-             1.0, i0data_sorted, a1.size()*a2.size(), i1data_sorted, a1.size()*a2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+             1.0, i0data_sorted.get(), a1.size()*a2.size(), i1data_sorted.get(), a1.size()*a2.size(),
+             1.0, odata_sorted.get(), x1.size()*x0.size());
     }
   }
-  sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x3.size());
+  sort_indices<3,2,1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), x2.size(), x3.size());
   out()->put_block(odata, x3, x2, x1, x0);
 }
 
@@ -828,22 +828,22 @@ void Task1135::Task_local::compute() {
   const Index a2 = b(3);
   // tensor label: I1121
   std::unique_ptr<double[]> odata = out()->move_block(x2, x3, a1, a2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x3, a1, a2)]);
+  BlockBuffer odata_sorted(out()->get_size(x2, x3, a1, a2));
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x3, a1, a2), 0.0);
   for (auto& c3 : *range_[0]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, c3, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, c3, a2)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), c3.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(x3, a1, c3, a2);
+    BlockBuffer i0data_sorted(in(0)->get_size(x3, a1, c3, a2));
+    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a1.size(), c3.size(), a2.size());
     // tensor label: I1122
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c3)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, x2.size(), c3.size());
+    const double* i1data = in(1)->get_block_view(x2, c3);
+    BlockBuffer i1data_sorted(in(1)->get_size(x2, c3));
+    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), c3.size());
     dgemm_("T", "N", x3.size()*a1.size()*a2.size(), x2.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, x3.size()*a1.size()*a2.size());
+           1.0, i0data_sorted.get(), c3.size(), i1data_sorted.get(), c3.size(),
+           1.0, odata_sorted.get(), x3.size()*a1.size()*a2.size());
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x3.size(), a1.size(), a2.size(), x2.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), a1.size(), a2.size(), x2.size());
   out()->put_block(odata, x2, x3, a1, a2);
 }
 
@@ -854,8 +854,8 @@ void Task1136::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x2, c3);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x2, c3);
-    sort_indices<0,1,1,1,-4,1>(i0data, odata, x2.size(), c3.size());
+    const double* i0data = in(0)->get_block_view(x2, c3);
+    sort_indices<0,1,1,1,-4,1>(i0data, odata.get(), x2.size(), c3.size());
   }
   out()->put_block(odata, x2, c3);
 }
@@ -867,24 +867,24 @@ void Task1137::Task_local::compute() {
   const Index x0 = b(3);
   // tensor label: I1000
   std::unique_ptr<double[]> odata = out()->move_block(x3, x2, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, x2, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, x1, x0), 0.0);
   for (auto& a1 : *range_[2]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, x2, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, x2, a2)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), x2.size(), a2.size());
+      const double* i0data = in(0)->get_block_view(x3, a1, x2, a2);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, a1, x2, a2));
+      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a1.size(), x2.size(), a2.size());
       // tensor label: I1165
-      std::unique_ptr<double[]> i1data = in(1)->get_block(a2, x1, a1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, x1, a1, x0)]);
-      sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, a2.size(), x1.size(), a1.size(), x0.size());
+      const double* i1data = in(1)->get_block_view(a2, x1, a1, x0);
+      BlockBuffer i1data_sorted(in(1)->get_size(a2, x1, a1, x0));
+      sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted.get(), a2.size(), x1.size(), a1.size(), x0.size());
       dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), a2.size()*a1.size(),
-             1.0, i0data_sorted, a2.size()*a1.size(), i1data_sorted, a2.size()*a1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), a2.size()*a1.size(), i1data_sorted.get(), a2.size()*a1.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<0,1,2,3,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<0,1,2,3,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x3, x2, x1, x0);
 }
 
@@ -899,7 +899,7 @@ void Task1138::Task_local::compute() {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, x1, a2);
     dscal_(a2.size()*x1.size()*a1.size()*x0.size(), e0_, i0data.get(), 1);
-    sort_indices<3,2,1,0,1,1,-4,1>(i0data, odata, x0.size(), a1.size(), x1.size(), a2.size());
+    sort_indices<3,2,1,0,1,1,-4,1>(i0data.get(), odata.get(), x0.size(), a1.size(), x1.size(), a2.size());
   }
   out()->put_block(odata, a2, x1, a1, x0);
 }
@@ -911,24 +911,24 @@ void Task1139::Task_local::compute() {
   const Index x0 = b(3);
   // tensor label: I1000
   std::unique_ptr<double[]> odata = out()->move_block(x3, x2, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, x2, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, x1, x0), 0.0);
   for (auto& a1 : *range_[2]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: v2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, x2, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, x2, a2)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), x2.size(), a2.size());
+      const double* i0data = in(0)->get_block_view(x3, a1, x2, a2);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, a1, x2, a2));
+      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a1.size(), x2.size(), a2.size());
       // tensor label: I1219
-      std::unique_ptr<double[]> i1data = in(1)->get_block(a2, x1, a1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, x1, a1, x0)]);
-      sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, a2.size(), x1.size(), a1.size(), x0.size());
+      const double* i1data = in(1)->get_block_view(a2, x1, a1, x0);
+      BlockBuffer i1data_sorted(in(1)->get_size(a2, x1, a1, x0));
+      sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted.get(), a2.size(), x1.size(), a1.size(), x0.size());
       dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), a2.size()*a1.size(),
-             1.0, i0data_sorted, a2.size()*a1.size(), i1data_sorted, a2.size()*a1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), a2.size()*a1.size(), i1data_sorted.get(), a2.size()*a1.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<0,1,2,3,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<0,1,2,3,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x3, x2, x1, x0);
 }
 
@@ -941,8 +941,8 @@ void Task1140::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a2, x1, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, x1, a2);
-    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata, x0.size(), a1.size(), x1.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, x1, a2);
+    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata.get(), x0.size(), a1.size(), x1.size(), a2.size());
   }
   out()->put_block(odata, a2, x1, a1, x0);
 }
@@ -954,24 +954,24 @@ void Task1141::Task_local::compute() {
   const Index x0 = b(3);
   // tensor label: I1000
   std::unique_ptr<double[]> odata = out()->move_block(x3, x2, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, x2, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, x1, x0), 0.0);
   for (auto& a1 : *range_[2]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: v2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, x1, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, x1, a2)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), x1.size(), a2.size());
+      const double* i0data = in(0)->get_block_view(x0, a1, x1, a2);
+      BlockBuffer i0data_sorted(in(0)->get_size(x0, a1, x1, a2));
+      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), a1.size(), x1.size(), a2.size());
       // tensor label: I1273
-      std::unique_ptr<double[]> i1data = in(1)->get_block(a2, x2, a1, x3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, x2, a1, x3)]);
-      sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, a2.size(), x2.size(), a1.size(), x3.size());
+      const double* i1data = in(1)->get_block_view(a2, x2, a1, x3);
+      BlockBuffer i1data_sorted(in(1)->get_size(a2, x2, a1, x3));
+      sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted.get(), a2.size(), x2.size(), a1.size(), x3.size());
       dgemm_("T", "N", x0.size()*x1.size(), x2.size()*x3.size(), a2.size()*a1.size(),
-             1.0, i0data_sorted, a2.size()*a1.size(), i1data_sorted, a2.size()*a1.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+             1.0, i0data_sorted.get(), a2.size()*a1.size(), i1data_sorted.get(), a2.size()*a1.size(),
+             1.0, odata_sorted.get(), x0.size()*x1.size());
     }
   }
-  sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x3.size());
+  sort_indices<3,2,1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), x2.size(), x3.size());
   out()->put_block(odata, x3, x2, x1, x0);
 }
 
@@ -984,8 +984,8 @@ void Task1142::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a2, x2, a1, x3);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, x2, a2);
-    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata, x3.size(), a1.size(), x2.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(x3, a1, x2, a2);
+    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata.get(), x3.size(), a1.size(), x2.size(), a2.size());
   }
   out()->put_block(odata, a2, x2, a1, x3);
 }
@@ -997,22 +997,22 @@ void Task1143::Task_local::compute() {
   const Index x0 = b(3);
   // tensor label: I1000
   std::unique_ptr<double[]> odata = out()->move_block(x3, x2, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, x2, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, x1, x0), 0.0);
   for (auto& a1 : *range_[2]) {
     // tensor label: h1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size());
+    const double* i0data = in(0)->get_block_view(x3, a1);
+    BlockBuffer i0data_sorted(in(0)->get_size(x3, a1));
+    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a1.size());
     // tensor label: I1285
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x2, x1, a1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, x1, a1, x0)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x2.size(), x1.size(), a1.size(), x0.size());
+    const double* i1data = in(1)->get_block_view(x2, x1, a1, x0);
+    BlockBuffer i1data_sorted(in(1)->get_size(x2, x1, a1, x0));
+    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), x1.size(), a1.size(), x0.size());
     dgemm_("T", "N", x3.size(), x2.size()*x1.size()*x0.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, x3.size());
+           1.0, i0data_sorted.get(), a1.size(), i1data_sorted.get(), a1.size(),
+           1.0, odata_sorted.get(), x3.size());
   }
-  sort_indices<0,1,2,3,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<0,1,2,3,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x3, x2, x1, x0);
 }
 
@@ -1025,8 +1025,8 @@ void Task1144::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x2, x1, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, x1, x2);
-    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata, x0.size(), a1.size(), x1.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, x1, x2);
+    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata.get(), x0.size(), a1.size(), x1.size(), x2.size());
   }
   out()->put_block(odata, x2, x1, a1, x0);
 }
@@ -1038,22 +1038,22 @@ void Task1145::Task_local::compute() {
   const Index x0 = b(3);
   // tensor label: I1000
   std::unique_ptr<double[]> odata = out()->move_block(x3, x2, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, x2, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, x1, x0), 0.0);
   for (auto& a1 : *range_[2]) {
     // tensor label: h1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size());
+    const double* i0data = in(0)->get_block_view(x0, a1);
+    BlockBuffer i0data_sorted(in(0)->get_size(x0, a1));
+    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), a1.size());
     // tensor label: I1297
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x2, a1, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x2, a1, x3)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), x2.size(), a1.size(), x3.size());
+    const double* i1data = in(1)->get_block_view(x1, x2, a1, x3);
+    BlockBuffer i1data_sorted(in(1)->get_size(x1, x2, a1, x3));
+    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x2.size(), a1.size(), x3.size());
     dgemm_("T", "N", x0.size(), x1.size()*x2.size()*x3.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, x0.size());
+           1.0, i0data_sorted.get(), a1.size(), i1data_sorted.get(), a1.size(),
+           1.0, odata_sorted.get(), x0.size());
   }
-  sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x3.size());
+  sort_indices<3,2,1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), x2.size(), x3.size());
   out()->put_block(odata, x3, x2, x1, x0);
 }
 
@@ -1066,8 +1066,8 @@ void Task1146::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, x2, a1, x3);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, x2, x1);
-    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata, x3.size(), a1.size(), x2.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x3, a1, x2, x1);
+    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata.get(), x3.size(), a1.size(), x2.size(), x1.size());
   }
   out()->put_block(odata, x1, x2, a1, x3);
 }
@@ -1076,42 +1076,42 @@ void Task1147::Task_local::compute() {
   const Index ci0 = b(0);
   // tensor label: I768
   std::unique_ptr<double[]> odata = out()->move_block(ci0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(ci0)]);
+  BlockBuffer odata_sorted(out()->get_size(ci0));
   std::fill_n(odata_sorted.get(), out()->get_size(ci0), 0.0);
   // tensor label: Gamma339
-  std::unique_ptr<double[]> i0data = in(0)->get_block(ci0);
-  std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(ci0)]);
-  sort_indices<0,0,1,1,1>(i0data, i0data_sorted, ci0.size());
+  const double* i0data = in(0)->get_block_view(ci0);
+  BlockBuffer i0data_sorted(in(0)->get_size(ci0));
+  sort_indices<0,0,1,1,1>(i0data, i0data_sorted.get(), ci0.size());
   // tensor label: I1036
-  std::unique_ptr<double[]> i1data = in(1)->get_block();
-  std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size()]);
-  sort_indices<0,1,1,1>(i1data, i1data_sorted);
+  const double* i1data = in(1)->get_block_view();
+  BlockBuffer i1data_sorted(in(1)->get_size());
+  sort_indices<0,1,1,1>(i1data, i1data_sorted.get());
   dgemm_("T", "N", ci0.size(), 1, 1,
-         1.0, i0data_sorted, 1, i1data_sorted, 1,
-         1.0, odata_sorted, ci0.size());
-  sort_indices<0,1,1,1,1>(odata_sorted, odata, ci0.size());
+         1.0, i0data_sorted.get(), 1, i1data_sorted.get(), 1,
+         1.0, odata_sorted.get(), ci0.size());
+  sort_indices<0,1,1,1,1>(odata_sorted.get(), odata.get(), ci0.size());
   out()->put_block(odata, ci0);
 }
 
 void Task1148::Task_local::compute() {
   // tensor label: I1036
   std::unique_ptr<double[]> odata = out()->move_block();
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size()]);
+  BlockBuffer odata_sorted(out()->get_size());
   std::fill_n(odata_sorted.get(), out()->get_size(), 0.0);
   const Index a2 = b(0);
   const Index c3 = b(1);
   const Index a4 = b(2);
   const Index c1 = b(3);
   // tensor label: t2
-  std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a4, c3, a2);
-  std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a4, c3, a2)]);
-  sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a4.size(), c3.size(), a2.size());
+  const double* i0data = in(0)->get_block_view(c1, a4, c3, a2);
+  BlockBuffer i0data_sorted(in(0)->get_size(c1, a4, c3, a2));
+  sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a4.size(), c3.size(), a2.size());
   // tensor label: I1037
-  std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c3, a2, c1);
-  std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c3, a2, c1)]);
-  sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, a4.size(), c3.size(), a2.size(), c1.size());
-  odata_sorted[0] += ddot_(a4.size()*c3.size()*a2.size()*c1.size(), i0data_sorted, 1, i1data_sorted, 1);
-  sort_indices<1,1,1,1>(odata_sorted, odata);
+  const double* i1data = in(1)->get_block_view(a4, c3, a2, c1);
+  BlockBuffer i1data_sorted(in(1)->get_size(a4, c3, a2, c1));
+  sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), c3.size(), a2.size(), c1.size());
+  odata_sorted[0] += ddot_(a4.size()*c3.size()*a2.size()*c1.size(), i0data_sorted.get(), 1, i1data_sorted.get(), 1);
+  sort_indices<1,1,1,1>(odata_sorted.get(), odata.get());
   out()->put_block(odata);
 }
 
@@ -1124,8 +1124,8 @@ void Task1149::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a4, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-    sort_indices<3,2,1,0,1,1,-8,1>(i0data, odata, c1.size(), a2.size(), c3.size(), a4.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, a4);
+    sort_indices<3,2,1,0,1,1,-8,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), a4.size());
   }
   out()->put_block(odata, a4, c3, a2, c1);
 }
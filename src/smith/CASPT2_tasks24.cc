@@ -36,22 +36,22 @@ using namespace bagel::SMITH::CASPT2;
 void Task1150::Task_local::compute() {
   // tensor label: I1036
   std::unique_ptr<double[]> odata = out()->move_block();
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size()]);
+  BlockBuffer odata_sorted(out()->get_size());
   std::fill_n(odata_sorted.get(), out()->get_size(), 0.0);
   const Index a4 = b(0);
   const Index c3 = b(1);
   const Index a2 = b(2);
   const Index c1 = b(3);
   // tensor label: t2
-  std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-  std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, a4)]);
-  sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
+  const double* i0data = in(0)->get_block_view(c1, a2, c3, a4);
+  BlockBuffer i0data_sorted(in(0)->get_size(c1, a2, c3, a4));
+  sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size(), c3.size(), a4.size());
   // tensor label: I1040
-  std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c3, a2, c1);
-  std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c3, a2, c1)]);
-  sort_indices<3,2,1,0,0,1,1,1>(i1data, i1data_sorted, a4.size(), c3.size(), a2.size(), c1.size());
-  odata_sorted[0] += ddot_(a4.size()*c3.size()*a2.size()*c1.size(), i0data_sorted, 1, i1data_sorted, 1);
-  sort_indices<1,1,1,1>(odata_sorted, odata);
+  const double* i1data = in(1)->get_block_view(a4, c3, a2, c1);
+  BlockBuffer i1data_sorted(in(1)->get_size(a4, c3, a2, c1));
+  sort_indices<3,2,1,0,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), c3.size(), a2.size(), c1.size());
+  odata_sorted[0] += ddot_(a4.size()*c3.size()*a2.size()*c1.size(), i0data_sorted.get(), 1, i1data_sorted.get(), 1);
+  sort_indices<1,1,1,1>(odata_sorted.get(), odata.get());
   out()->put_block(odata);
 }
 
@@ -64,8 +64,8 @@ void Task1151::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a4, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-    sort_indices<3,2,1,0,1,1,16,1>(i0data, odata, c1.size(), a2.size(), c3.size(), a4.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, a4);
+    sort_indices<3,2,1,0,1,1,16,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), a4.size());
   }
   out()->put_block(odata, a4, c3, a2, c1);
 }
@@ -74,24 +74,24 @@ void Task1152::Task_local::compute() {
   const Index ci0 = b(0);
   // tensor label: I768
   std::unique_ptr<double[]> odata = out()->move_block(ci0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(ci0)]);
+  BlockBuffer odata_sorted(out()->get_size(ci0));
   std::fill_n(odata_sorted.get(), out()->get_size(ci0), 0.0);
   for (auto& x3 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma351
-      std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x3, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(ci0, x3, x0)]);
-      sort_indices<1,2,0,0,1,1,1>(i0data, i0data_sorted, ci0.size(), x3.size(), x0.size());
+      const double* i0data = in(0)->get_block_view(ci0, x3, x0);
+      BlockBuffer i0data_sorted(in(0)->get_size(ci0, x3, x0));
+      sort_indices<1,2,0,0,1,1,1>(i0data, i0data_sorted.get(), ci0.size(), x3.size(), x0.size());
       // tensor label: I1082
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x0, x3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, x3)]);
-      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, x0.size(), x3.size());
+      const double* i1data = in(1)->get_block_view(x0, x3);
+      BlockBuffer i1data_sorted(in(1)->get_size(x0, x3));
+      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), x3.size());
       dgemm_("T", "N", ci0.size(), 1, x0.size()*x3.size(),
-             1.0, i0data_sorted, x0.size()*x3.size(), i1data_sorted, x0.size()*x3.size(),
-             1.0, odata_sorted, ci0.size());
+             1.0, i0data_sorted.get(), x0.size()*x3.size(), i1data_sorted.get(), x0.size()*x3.size(),
+             1.0, odata_sorted.get(), ci0.size());
     }
   }
-  sort_indices<0,1,1,1,1>(odata_sorted, odata, ci0.size());
+  sort_indices<0,1,1,1,1>(odata_sorted.get(), odata.get(), ci0.size());
   out()->put_block(odata, ci0);
 }
 
@@ -100,26 +100,26 @@ void Task1153::Task_local::compute() {
   const Index x3 = b(1);
   // tensor label: I1082
   std::unique_ptr<double[]> odata = out()->move_block(x0, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x3), 0.0);
   for (auto& a3 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a1 : *range_[2]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a3, c2, a1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a3, c2, a1)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, x3.size(), a3.size(), c2.size(), a1.size());
+        const double* i0data = in(0)->get_block_view(x3, a3, c2, a1);
+        BlockBuffer i0data_sorted(in(0)->get_size(x3, a3, c2, a1));
+        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a3.size(), c2.size(), a1.size());
         // tensor label: I1083
-        std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, a1, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, a1, x0)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), a1.size(), x0.size());
+        const double* i1data = in(1)->get_block_view(a3, c2, a1, x0);
+        BlockBuffer i1data_sorted(in(1)->get_size(a3, c2, a1, x0));
+        sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), c2.size(), a1.size(), x0.size());
         dgemm_("T", "N", x3.size(), x0.size(), a3.size()*c2.size()*a1.size(),
-               1.0, i0data_sorted, a3.size()*c2.size()*a1.size(), i1data_sorted, a3.size()*c2.size()*a1.size(),
-               1.0, odata_sorted, x3.size());
+               1.0, i0data_sorted.get(), a3.size()*c2.size()*a1.size(), i1data_sorted.get(), a3.size()*c2.size()*a1.size(),
+               1.0, odata_sorted.get(), x3.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x0.size());
   out()->put_block(odata, x0, x3);
 }
 
@@ -132,8 +132,8 @@ void Task1154::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata, x0.size(), a1.size(), c2.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, a3);
+    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), a3.size());
   }
   out()->put_block(odata, a3, c2, a1, x0);
 }
@@ -143,26 +143,26 @@ void Task1155::Task_local::compute() {
   const Index x3 = b(1);
   // tensor label: I1082
   std::unique_ptr<double[]> odata = out()->move_block(x0, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x3), 0.0);
   for (auto& a1 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a3 : *range_[2]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, c2, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, c2, a3)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), c2.size(), a3.size());
+        const double* i0data = in(0)->get_block_view(x3, a1, c2, a3);
+        BlockBuffer i0data_sorted(in(0)->get_size(x3, a1, c2, a3));
+        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a1.size(), c2.size(), a3.size());
         // tensor label: I1086
-        std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, a1, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, a1, x0)]);
-        sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), a1.size(), x0.size());
+        const double* i1data = in(1)->get_block_view(a3, c2, a1, x0);
+        BlockBuffer i1data_sorted(in(1)->get_size(a3, c2, a1, x0));
+        sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), c2.size(), a1.size(), x0.size());
         dgemm_("T", "N", x3.size(), x0.size(), a3.size()*c2.size()*a1.size(),
-               1.0, i0data_sorted, a3.size()*c2.size()*a1.size(), i1data_sorted, a3.size()*c2.size()*a1.size(),
-               1.0, odata_sorted, x3.size());
+               1.0, i0data_sorted.get(), a3.size()*c2.size()*a1.size(), i1data_sorted.get(), a3.size()*c2.size()*a1.size(),
+               1.0, odata_sorted.get(), x3.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x0.size());
   out()->put_block(odata, x0, x3);
 }
 
@@ -175,8 +175,8 @@ void Task1156::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata, x0.size(), a1.size(), c2.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, a3);
+    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), a3.size());
   }
   out()->put_block(odata, a3, c2, a1, x0);
 }
@@ -185,28 +185,28 @@ void Task1157::Task_local::compute() {
   const Index ci0 = b(0);
   // tensor label: I768
   std::unique_ptr<double[]> odata = out()->move_block(ci0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(ci0)]);
+  BlockBuffer odata_sorted(out()->get_size(ci0));
   std::fill_n(odata_sorted.get(), out()->get_size(ci0), 0.0);
   for (auto& x5 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       for (auto& x4 : *range_[1]) {
         for (auto& x1 : *range_[1]) {
           // tensor label: Gamma362
-          std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x5, x0, x4, x1);
-          std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(ci0, x5, x0, x4, x1)]);
-          sort_indices<1,2,3,4,0,0,1,1,1>(i0data, i0data_sorted, ci0.size(), x5.size(), x0.size(), x4.size(), x1.size());
+          const double* i0data = in(0)->get_block_view(ci0, x5, x0, x4, x1);
+          BlockBuffer i0data_sorted(in(0)->get_size(ci0, x5, x0, x4, x1));
+          sort_indices<1,2,3,4,0,0,1,1,1>(i0data, i0data_sorted.get(), ci0.size(), x5.size(), x0.size(), x4.size(), x1.size());
           // tensor label: I1124
-          std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, x5, x4);
-          std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, x5, x4)]);
-          sort_indices<2,1,3,0,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), x5.size(), x4.size());
+          const double* i1data = in(1)->get_block_view(x1, x0, x5, x4);
+          BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, x5, x4));
+          sort_indices<2,1,3,0,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), x5.size(), x4.size());
           dgemm_("T", "N", ci0.size(), 1, x1.size()*x0.size()*x5.size()*x4.size(),
-                 1.0, i0data_sorted, x1.size()*x0.size()*x5.size()*x4.size(), i1data_sorted, x1.size()*x0.size()*x5.size()*x4.size(),
-                 1.0, odata_sorted, ci0.size());
+                 1.0, i0data_sorted.get(), x1.size()*x0.size()*x5.size()*x4.size(), i1data_sorted.get(), x1.size()*x0.size()*x5.size()*x4.size(),
+                 1.0, odata_sorted.get(), ci0.size());
         }
       }
     }
   }
-  sort_indices<0,1,1,1,1>(odata_sorted, odata, ci0.size());
+  sort_indices<0,1,1,1,1>(odata_sorted.get(), odata.get(), ci0.size());
   out()->put_block(odata, ci0);
 }
 
@@ -217,24 +217,24 @@ void Task1158::Task_local::compute() {
   const Index x4 = b(3);
   // tensor label: I1124
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x5, x4);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x5, x4)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x5, x4));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x5, x4), 0.0);
   for (auto& a1 : *range_[2]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, x4, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a1, x4, a2)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x5.size(), a1.size(), x4.size(), a2.size());
+      const double* i0data = in(0)->get_block_view(x5, a1, x4, a2);
+      BlockBuffer i0data_sorted(in(0)->get_size(x5, a1, x4, a2));
+      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), a1.size(), x4.size(), a2.size());
       // tensor label: I1125
-      std::unique_ptr<double[]> i1data = in(1)->get_block(a2, x1, a1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, x1, a1, x0)]);
-      sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, a2.size(), x1.size(), a1.size(), x0.size());
+      const double* i1data = in(1)->get_block_view(a2, x1, a1, x0);
+      BlockBuffer i1data_sorted(in(1)->get_size(a2, x1, a1, x0));
+      sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted.get(), a2.size(), x1.size(), a1.size(), x0.size());
       dgemm_("T", "N", x5.size()*x4.size(), x1.size()*x0.size(), a2.size()*a1.size(),
-             1.0, i0data_sorted, a2.size()*a1.size(), i1data_sorted, a2.size()*a1.size(),
-             1.0, odata_sorted, x5.size()*x4.size());
+             1.0, i0data_sorted.get(), a2.size()*a1.size(), i1data_sorted.get(), a2.size()*a1.size(),
+             1.0, odata_sorted.get(), x5.size()*x4.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x1.size(), x0.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x5.size(), x4.size(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0, x5, x4);
 }
 
@@ -247,8 +247,8 @@ void Task1159::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a2, x1, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, x1, a2);
-    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata, x0.size(), a1.size(), x1.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, x1, a2);
+    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata.get(), x0.size(), a1.size(), x1.size(), a2.size());
   }
   out()->put_block(odata, a2, x1, a1, x0);
 }
@@ -257,7 +257,7 @@ void Task1160::Task_local::compute() {
   const Index ci0 = b(0);
   // tensor label: I768
   std::unique_ptr<double[]> odata = out()->move_block(ci0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(ci0)]);
+  BlockBuffer odata_sorted(out()->get_size(ci0));
   std::fill_n(odata_sorted.get(), out()->get_size(ci0), 0.0);
   for (auto& x2 : *range_[1]) {
     for (auto& x5 : *range_[1]) {
@@ -266,23 +266,23 @@ void Task1160::Task_local::compute() {
           for (auto& x1 : *range_[1]) {
             for (auto& x0 : *range_[1]) {
               // tensor label: Gamma377
-              std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x2, x5, x4, x3, x1, x0);
-              std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(ci0, x2, x5, x4, x3, x1, x0)]);
-              sort_indices<1,2,3,4,5,6,0,0,1,1,1>(i0data, i0data_sorted, ci0.size(), x2.size(), x5.size(), x4.size(), x3.size(), x1.size(), x0.size());
+              const double* i0data = in(0)->get_block_view(ci0, x2, x5, x4, x3, x1, x0);
+              BlockBuffer i0data_sorted(in(0)->get_size(ci0, x2, x5, x4, x3, x1, x0));
+              sort_indices<1,2,3,4,5,6,0,0,1,1,1>(i0data, i0data_sorted.get(), ci0.size(), x2.size(), x5.size(), x4.size(), x3.size(), x1.size(), x0.size());
               // tensor label: I1170
-              std::unique_ptr<double[]> i1data = in(1)->get_block(x2, x1, x0, x5, x4, x3);
-              std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, x1, x0, x5, x4, x3)]);
-              sort_indices<0,3,4,5,1,2,0,1,1,1>(i1data, i1data_sorted, x2.size(), x1.size(), x0.size(), x5.size(), x4.size(), x3.size());
+              const double* i1data = in(1)->get_block_view(x2, x1, x0, x5, x4, x3);
+              BlockBuffer i1data_sorted(in(1)->get_size(x2, x1, x0, x5, x4, x3));
+              sort_indices<0,3,4,5,1,2,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), x1.size(), x0.size(), x5.size(), x4.size(), x3.size());
               dgemm_("T", "N", ci0.size(), 1, x2.size()*x1.size()*x0.size()*x5.size()*x4.size()*x3.size(),
-                     1.0, i0data_sorted, x2.size()*x1.size()*x0.size()*x5.size()*x4.size()*x3.size(), i1data_sorted, x2.size()*x1.size()*x0.size()*x5.size()*x4.size()*x3.size(),
-                     1.0, odata_sorted, ci0.size());
+                     1.0, i0data_sorted.get(), x2.size()*x1.size()*x0.size()*x5.size()*x4.size()*x3.size(), i1data_sorted.get(), x2.size()*x1.size()*x0.size()*x5.size()*x4.size()*x3.size(),
+                     1.0, odata_sorted.get(), ci0.size());
             }
           }
         }
       }
     }
   }
-  sort_indices<0,1,1,1,1>(odata_sorted, odata, ci0.size());
+  sort_indices<0,1,1,1,1>(odata_sorted.get(), odata.get(), ci0.size());
   out()->put_block(odata, ci0);
 }
 
@@ -295,22 +295,22 @@ void Task1161::Task_local::compute() {
   const Index x3 = b(5);
   // tensor label: I1170
   std::unique_ptr<double[]> odata = out()->move_block(x2, x1, x0, x5, x4, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1, x0, x5, x4, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(x2, x1, x0, x5, x4, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1, x0, x5, x4, x3), 0.0);
   for (auto& c1 : *range_[0]) {
     // tensor label: v2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x5, x4, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x5, x4, x3)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), x5.size(), x4.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(c1, x5, x4, x3);
+    BlockBuffer i0data_sorted(in(0)->get_size(c1, x5, x4, x3));
+    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), x5.size(), x4.size(), x3.size());
     // tensor label: I1171
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c1, x1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c1, x1, x0)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, x2.size(), c1.size(), x1.size(), x0.size());
+    const double* i1data = in(1)->get_block_view(x2, c1, x1, x0);
+    BlockBuffer i1data_sorted(in(1)->get_size(x2, c1, x1, x0));
+    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), c1.size(), x1.size(), x0.size());
     dgemm_("T", "N", x5.size()*x4.size()*x3.size(), x2.size()*x1.size()*x0.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, x5.size()*x4.size()*x3.size());
+           1.0, i0data_sorted.get(), c1.size(), i1data_sorted.get(), c1.size(),
+           1.0, odata_sorted.get(), x5.size()*x4.size()*x3.size());
   }
-  sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x2, x1, x0, x5, x4, x3);
 }
 
@@ -323,8 +323,8 @@ void Task1162::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x2, c1, x1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1, c1, x2);
-    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata, x0.size(), x1.size(), c1.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x0, x1, c1, x2);
+    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata.get(), x0.size(), x1.size(), c1.size(), x2.size());
   }
   out()->put_block(odata, x2, c1, x1, x0);
 }
@@ -333,7 +333,7 @@ void Task1163::Task_local::compute() {
   const Index ci0 = b(0);
   // tensor label: I768
   std::unique_ptr<double[]> odata = out()->move_block(ci0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(ci0)]);
+  BlockBuffer odata_sorted(out()->get_size(ci0));
   std::fill_n(odata_sorted.get(), out()->get_size(ci0), 0.0);
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
@@ -342,23 +342,23 @@ void Task1163::Task_local::compute() {
           for (auto& x2 : *range_[1]) {
             for (auto& x1 : *range_[1]) {
               // tensor label: Gamma395
-              std::unique_ptr<double[]> i0data = in(0)->get_block(ci0, x5, x4, x0, x3, x2, x1);
-              std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(ci0, x5, x4, x0, x3, x2, x1)]);
-              sort_indices<1,2,3,4,5,6,0,0,1,1,1>(i0data, i0data_sorted, ci0.size(), x5.size(), x4.size(), x0.size(), x3.size(), x2.size(), x1.size());
+              const double* i0data = in(0)->get_block_view(ci0, x5, x4, x0, x3, x2, x1);
+              BlockBuffer i0data_sorted(in(0)->get_size(ci0, x5, x4, x0, x3, x2, x1));
+              sort_indices<1,2,3,4,5,6,0,0,1,1,1>(i0data, i0data_sorted.get(), ci0.size(), x5.size(), x4.size(), x0.size(), x3.size(), x2.size(), x1.size());
               // tensor label: I1224
-              std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x4, x5, x0, x1, x2);
-              std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x4, x5, x0, x1, x2)]);
-              sort_indices<2,1,3,0,5,4,0,1,1,1>(i1data, i1data_sorted, x3.size(), x4.size(), x5.size(), x0.size(), x1.size(), x2.size());
+              const double* i1data = in(1)->get_block_view(x3, x4, x5, x0, x1, x2);
+              BlockBuffer i1data_sorted(in(1)->get_size(x3, x4, x5, x0, x1, x2));
+              sort_indices<2,1,3,0,5,4,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), x4.size(), x5.size(), x0.size(), x1.size(), x2.size());
               dgemm_("T", "N", ci0.size(), 1, x3.size()*x4.size()*x5.size()*x0.size()*x1.size()*x2.size(),
-                     1.0, i0data_sorted, x3.size()*x4.size()*x5.size()*x0.size()*x1.size()*x2.size(), i1data_sorted, x3.size()*x4.size()*x5.size()*x0.size()*x1.size()*x2.size(),
-                     1.0, odata_sorted, ci0.size());
+                     1.0, i0data_sorted.get(), x3.size()*x4.size()*x5.size()*x0.size()*x1.size()*x2.size(), i1data_sorted.get(), x3.size()*x4.size()*x5.size()*x0.size()*x1.size()*x2.size(),
+                     1.0, odata_sorted.get(), ci0.size());
             }
           }
         }
       }
     }
   }
-  sort_indices<0,1,1,1,1>(odata_sorted, odata, ci0.size());
+  sort_indices<0,1,1,1,1>(odata_sorted.get(), odata.get(), ci0.size());
   out()->put_block(odata, ci0);
 }
 
@@ -371,22 +371,22 @@ void Task1164::Task_local::compute() {
   const Index x2 = b(5);
   // tensor label: I1224
   std::unique_ptr<double[]> odata = out()->move_block(x3, x4, x5, x0, x1, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x4, x5, x0, x1, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, x4, x5, x0, x1, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x4, x5, x0, x1, x2), 0.0);
   for (auto& c1 : *range_[0]) {
     // tensor label: v2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x0, x1, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x0, x1, x2)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), x0.size(), x1.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(c1, x0, x1, x2);
+    BlockBuffer i0data_sorted(in(0)->get_size(c1, x0, x1, x2));
+    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), x0.size(), x1.size(), x2.size());
     // tensor label: I1225
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x3, c1, x4, x5);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, c1, x4, x5)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), c1.size(), x4.size(), x5.size());
+    const double* i1data = in(1)->get_block_view(x3, c1, x4, x5);
+    BlockBuffer i1data_sorted(in(1)->get_size(x3, c1, x4, x5));
+    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), c1.size(), x4.size(), x5.size());
     dgemm_("T", "N", x0.size()*x1.size()*x2.size(), x3.size()*x4.size()*x5.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, x0.size()*x1.size()*x2.size());
+           1.0, i0data_sorted.get(), c1.size(), i1data_sorted.get(), c1.size(),
+           1.0, odata_sorted.get(), x0.size()*x1.size()*x2.size());
   }
-  sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x3.size(), x4.size(), x5.size());
+  sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), x2.size(), x3.size(), x4.size(), x5.size());
   out()->put_block(odata, x3, x4, x5, x0, x1, x2);
 }
 
@@ -399,8 +399,8 @@ void Task1165::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x3, c1, x4, x5);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, c1, x3);
-    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata, x5.size(), x4.size(), c1.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(x5, x4, c1, x3);
+    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata.get(), x5.size(), x4.size(), c1.size(), x3.size());
   }
   out()->put_block(odata, x3, c1, x4, x5);
 }
@@ -40,8 +40,8 @@ void Task100::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a3, c2);
-    sort_indices<0,1,1,1,2,1>(i0data, odata, a3.size(), c2.size());
+    const double* i0data = in(0)->get_block_view(a3, c2);
+    sort_indices<0,1,1,1,2,1>(i0data, odata.get(), a3.size(), c2.size());
   }
   out()->put_block(odata, a3, c2);
 }
@@ -51,24 +51,24 @@ void Task101::Task_local::compute() {
   const Index x3 = b(1);
   // tensor label: I20
   std::unique_ptr<double[]> odata = out()->move_block(c1, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x3), 0.0);
   for (auto& a3 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a3, c2, x3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a3, c2, x3)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a3.size(), c2.size(), x3.size());
+      const double* i0data = in(0)->get_block_view(c1, a3, c2, x3);
+      BlockBuffer i0data_sorted(in(0)->get_size(c1, a3, c2, x3));
+      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a3.size(), c2.size(), x3.size());
       // tensor label: I24
-      std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2)]);
-      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size());
+      const double* i1data = in(1)->get_block_view(a3, c2);
+      BlockBuffer i1data_sorted(in(1)->get_size(a3, c2));
+      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), c2.size());
       dgemm_("T", "N", c1.size()*x3.size(), 1, a3.size()*c2.size(),
-             1.0, i0data_sorted, a3.size()*c2.size(), i1data_sorted, a3.size()*c2.size(),
-             1.0, odata_sorted, c1.size()*x3.size());
+             1.0, i0data_sorted.get(), a3.size()*c2.size(), i1data_sorted.get(), a3.size()*c2.size(),
+             1.0, odata_sorted.get(), c1.size()*x3.size());
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, c1.size(), x3.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), c1.size(), x3.size());
   out()->put_block(odata, c1, x3);
 }
 
@@ -79,8 +79,8 @@ void Task102::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a3, c2);
-    sort_indices<0,1,1,1,-1,1>(i0data, odata, a3.size(), c2.size());
+    const double* i0data = in(0)->get_block_view(a3, c2);
+    sort_indices<0,1,1,1,-1,1>(i0data, odata.get(), a3.size(), c2.size());
   }
   out()->put_block(odata, a3, c2);
 }
@@ -92,26 +92,26 @@ void Task103::Task_local::compute() {
   const Index x0 = b(3);
   // tensor label: I11
   std::unique_ptr<double[]> odata = out()->move_block(c1, x2, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x2, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, x2, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x2, x1, x0), 0.0);
   for (auto& x5 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x4 : *range_[1]) {
         // tensor label: Gamma9
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x3, x2, x4, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x3, x2, x4, x1, x0)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x3.size(), x2.size(), x4.size(), x1.size(), x0.size());
+        const double* i0data = in(0)->get_block_view(x5, x3, x2, x4, x1, x0);
+        BlockBuffer i0data_sorted(in(0)->get_size(x5, x3, x2, x4, x1, x0));
+        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), x3.size(), x2.size(), x4.size(), x1.size(), x0.size());
         // tensor label: I26
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x5, c1, x4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x5, c1, x4)]);
-        sort_indices<1,0,3,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), x5.size(), c1.size(), x4.size());
+        const double* i1data = in(1)->get_block_view(x3, x5, c1, x4);
+        BlockBuffer i1data_sorted(in(1)->get_size(x3, x5, c1, x4));
+        sort_indices<1,0,3,2,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), x5.size(), c1.size(), x4.size());
         dgemm_("T", "N", x2.size()*x1.size()*x0.size(), c1.size(), x3.size()*x5.size()*x4.size(),
-               1.0, i0data_sorted, x3.size()*x5.size()*x4.size(), i1data_sorted, x3.size()*x5.size()*x4.size(),
-               1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+               1.0, i0data_sorted.get(), x3.size()*x5.size()*x4.size(), i1data_sorted.get(), x3.size()*x5.size()*x4.size(),
+               1.0, odata_sorted.get(), x2.size()*x1.size()*x0.size());
       }
     }
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size(), x0.size(), c1.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x2.size(), x1.size(), x0.size(), c1.size());
   out()->put_block(odata, c1, x2, x1, x0);
 }
 
@@ -122,22 +122,22 @@ void Task104::Task_local::compute() {
   const Index x4 = b(3);
   // tensor label: I26
   std::unique_ptr<double[]> odata = out()->move_block(x3, x5, c1, x4);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x5, c1, x4)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, x5, c1, x4));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x5, c1, x4), 0.0);
   for (auto& a2 : *range_[2]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a2, c1, x4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a2, c1, x4)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), a2.size(), c1.size(), x4.size());
+    const double* i0data = in(0)->get_block_view(x5, a2, c1, x4);
+    BlockBuffer i0data_sorted(in(0)->get_size(x5, a2, c1, x4));
+    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), a2.size(), c1.size(), x4.size());
     // tensor label: I27
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a2, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, x3)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a2.size(), x3.size());
+    const double* i1data = in(1)->get_block_view(a2, x3);
+    BlockBuffer i1data_sorted(in(1)->get_size(a2, x3));
+    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a2.size(), x3.size());
     dgemm_("T", "N", x5.size()*c1.size()*x4.size(), x3.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, x5.size()*c1.size()*x4.size());
+           1.0, i0data_sorted.get(), a2.size(), i1data_sorted.get(), a2.size(),
+           1.0, odata_sorted.get(), x5.size()*c1.size()*x4.size());
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), c1.size(), x4.size(), x3.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x5.size(), c1.size(), x4.size(), x3.size());
   out()->put_block(odata, x3, x5, c1, x4);
 }
 
@@ -148,8 +148,8 @@ void Task105::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a2, x3);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a2, x3);
-    sort_indices<0,1,1,1,-1,1>(i0data, odata, a2.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(a2, x3);
+    sort_indices<0,1,1,1,-1,1>(i0data, odata.get(), a2.size(), x3.size());
   }
   out()->put_block(odata, a2, x3);
 }
@@ -161,26 +161,26 @@ void Task106::Task_local::compute() {
   const Index x0 = b(3);
   // tensor label: I11
   std::unique_ptr<double[]> odata = out()->move_block(c1, x2, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x2, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, x2, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x2, x1, x0), 0.0);
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma105
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x5, x4, x3, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, x5, x4, x3, x1, x0)]);
-        sort_indices<1,2,3,0,4,5,0,1,1,1>(i0data, i0data_sorted, x2.size(), x5.size(), x4.size(), x3.size(), x1.size(), x0.size());
+        const double* i0data = in(0)->get_block_view(x2, x5, x4, x3, x1, x0);
+        BlockBuffer i0data_sorted(in(0)->get_size(x2, x5, x4, x3, x1, x0));
+        sort_indices<1,2,3,0,4,5,0,1,1,1>(i0data, i0data_sorted.get(), x2.size(), x5.size(), x4.size(), x3.size(), x1.size(), x0.size());
         // tensor label: I291
-        std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x5, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x5, x4, x3)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted, c1.size(), x5.size(), x4.size(), x3.size());
+        const double* i1data = in(1)->get_block_view(c1, x5, x4, x3);
+        BlockBuffer i1data_sorted(in(1)->get_size(c1, x5, x4, x3));
+        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted.get(), c1.size(), x5.size(), x4.size(), x3.size());
         dgemm_("T", "N", x2.size()*x1.size()*x0.size(), c1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+               1.0, i0data_sorted.get(), x5.size()*x4.size()*x3.size(), i1data_sorted.get(), x5.size()*x4.size()*x3.size(),
+               1.0, odata_sorted.get(), x2.size()*x1.size()*x0.size());
       }
     }
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size(), x0.size(), c1.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x2.size(), x1.size(), x0.size(), c1.size());
   out()->put_block(odata, c1, x2, x1, x0);
 }
 
@@ -193,8 +193,8 @@ void Task107::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c1, x5, x4, x3);
   {
     // tensor label: v2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x5, x4, x3);
-    sort_indices<0,1,2,3,1,1,1,2>(i0data, odata, c1.size(), x5.size(), x4.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(c1, x5, x4, x3);
+    sort_indices<0,1,2,3,1,1,1,2>(i0data, odata.get(), c1.size(), x5.size(), x4.size(), x3.size());
   }
   out()->put_block(odata, c1, x5, x4, x3);
 }
@@ -208,8 +208,8 @@ void Task108::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c3, x0, c1, a2);
   {
     // tensor label: I31
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, c3, x0, a2);
-    sort_indices<1,2,0,3,1,1,1,1>(i0data, odata, c1.size(), c3.size(), x0.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(c1, c3, x0, a2);
+    sort_indices<1,2,0,3,1,1,1,1>(i0data, odata.get(), c1.size(), c3.size(), x0.size(), a2.size());
   }
   out()->put_block(odata, c3, x0, c1, a2);
 }
@@ -221,22 +221,22 @@ void Task109::Task_local::compute() {
   const Index a2 = b(3);
   // tensor label: I31
   std::unique_ptr<double[]> odata = out()->move_block(c1, c3, x0, a2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, c3, x0, a2));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   for (auto& x1 : *range_[1]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a2)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(x1, a2);
+    BlockBuffer i0data_sorted(in(0)->get_size(x1, a2));
+    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), a2.size());
     // tensor label: I32
-    std::unique_ptr<double[]> i1data = in(1)->get_block(c1, c3, x1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, c3, x1, x0)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, c1.size(), c3.size(), x1.size(), x0.size());
+    const double* i1data = in(1)->get_block_view(c1, c3, x1, x0);
+    BlockBuffer i1data_sorted(in(1)->get_size(c1, c3, x1, x0));
+    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted.get(), c1.size(), c3.size(), x1.size(), x0.size());
     dgemm_("T", "N", a2.size(), c1.size()*c3.size()*x0.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, a2.size());
+           1.0, i0data_sorted.get(), x1.size(), i1data_sorted.get(), x1.size(),
+           1.0, odata_sorted.get(), a2.size());
   }
-  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a2.size(), c1.size(), c3.size(), x0.size());
+  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted.get(), odata.get(), a2.size(), c1.size(), c3.size(), x0.size());
   out()->put_block(odata, c1, c3, x0, a2);
 }
 
@@ -247,24 +247,24 @@ void Task110::Task_local::compute() {
   const Index x0 = b(3);
   // tensor label: I32
   std::unique_ptr<double[]> odata = out()->move_block(c1, c3, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, c3, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x1, x0), 0.0);
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma3
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x3, x0, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x3, x0, x2)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x1.size(), x3.size(), x0.size(), x2.size());
+      const double* i0data = in(0)->get_block_view(x1, x3, x0, x2);
+      BlockBuffer i0data_sorted(in(0)->get_size(x1, x3, x0, x2));
+      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), x3.size(), x0.size(), x2.size());
       // tensor label: I33
-      std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x3, c3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x3, c3, x2)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i1data, i1data_sorted, c1.size(), x3.size(), c3.size(), x2.size());
+      const double* i1data = in(1)->get_block_view(c1, x3, c3, x2);
+      BlockBuffer i1data_sorted(in(1)->get_size(c1, x3, c3, x2));
+      sort_indices<1,3,0,2,0,1,1,1>(i1data, i1data_sorted.get(), c1.size(), x3.size(), c3.size(), x2.size());
       dgemm_("T", "N", x1.size()*x0.size(), c1.size()*c3.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+             1.0, i0data_sorted.get(), x3.size()*x2.size(), i1data_sorted.get(), x3.size()*x2.size(),
+             1.0, odata_sorted.get(), x1.size()*x0.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c1.size(), c3.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size(), c1.size(), c3.size());
   out()->put_block(odata, c1, c3, x1, x0);
 }
 
@@ -277,8 +277,8 @@ void Task111::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c1, x3, c3, x2);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x3, c3, x2);
-    sort_indices<0,1,2,3,1,1,-2,1>(i0data, odata, c1.size(), x3.size(), c3.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(c1, x3, c3, x2);
+    sort_indices<0,1,2,3,1,1,-2,1>(i0data, odata.get(), c1.size(), x3.size(), c3.size(), x2.size());
   }
   out()->put_block(odata, c1, x3, c3, x2);
 }
@@ -290,20 +290,20 @@ void Task112::Task_local::compute() {
   const Index a2 = b(3);
   // tensor label: I31
   std::unique_ptr<double[]> odata = out()->move_block(c1, c3, x0, a2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, c3, x0, a2));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   // tensor label: f1
-  std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2);
-  std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2)]);
-  sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size());
+  const double* i0data = in(0)->get_block_view(c1, a2);
+  BlockBuffer i0data_sorted(in(0)->get_size(c1, a2));
+  sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size());
   // tensor label: I35
-  std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x0);
-  std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x0)]);
-  sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, c3.size(), x0.size());
+  const double* i1data = in(1)->get_block_view(c3, x0);
+  BlockBuffer i1data_sorted(in(1)->get_size(c3, x0));
+  sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), c3.size(), x0.size());
   dgemm_("T", "N", c1.size()*a2.size(), c3.size()*x0.size(), 1,
-         1.0, i0data_sorted, 1, i1data_sorted, 1,
-         1.0, odata_sorted, c1.size()*a2.size());
-  sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), c3.size(), x0.size());
+         1.0, i0data_sorted.get(), 1, i1data_sorted.get(), 1,
+         1.0, odata_sorted.get(), c1.size()*a2.size());
+  sort_indices<0,2,3,1,1,1,1,1>(odata_sorted.get(), odata.get(), c1.size(), a2.size(), c3.size(), x0.size());
   out()->put_block(odata, c1, c3, x0, a2);
 }
 
@@ -312,26 +312,26 @@ void Task113::Task_local::compute() {
   const Index x0 = b(1);
   // tensor label: I35
   std::unique_ptr<double[]> odata = out()->move_block(c3, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(c3, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(c3, x0), 0.0);
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma12
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x0, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x0, x1)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x0.size(), x1.size());
+        const double* i0data = in(0)->get_block_view(x3, x2, x0, x1);
+        BlockBuffer i0data_sorted(in(0)->get_size(x3, x2, x0, x1));
+        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x2.size(), x0.size(), x1.size());
         // tensor label: I36
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, c3, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, c3, x1)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), x2.size(), c3.size(), x1.size());
+        const double* i1data = in(1)->get_block_view(x3, x2, c3, x1);
+        BlockBuffer i1data_sorted(in(1)->get_size(x3, x2, c3, x1));
+        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), x2.size(), c3.size(), x1.size());
         dgemm_("T", "N", x0.size(), c3.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x0.size());
+               1.0, i0data_sorted.get(), x3.size()*x2.size()*x1.size(), i1data_sorted.get(), x3.size()*x2.size()*x1.size(),
+               1.0, odata_sorted.get(), x0.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), c3.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), c3.size());
   out()->put_block(odata, c3, x0);
 }
 
@@ -344,8 +344,8 @@ void Task114::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x3, x2, c3, x1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, c3, x1);
-    sort_indices<0,1,2,3,1,1,2,1>(i0data, odata, x3.size(), x2.size(), c3.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x3, x2, c3, x1);
+    sort_indices<0,1,2,3,1,1,2,1>(i0data, odata.get(), x3.size(), x2.size(), c3.size(), x1.size());
   }
   out()->put_block(odata, x3, x2, c3, x1);
 }
@@ -357,20 +357,20 @@ void Task115::Task_local::compute() {
   const Index a2 = b(3);
   // tensor label: I31
   std::unique_ptr<double[]> odata = out()->move_block(c1, c3, x0, a2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, c3, x0, a2));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   // tensor label: f1
-  std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2);
-  std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a2)]);
-  sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c3.size(), a2.size());
+  const double* i0data = in(0)->get_block_view(c3, a2);
+  BlockBuffer i0data_sorted(in(0)->get_size(c3, a2));
+  sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), c3.size(), a2.size());
   // tensor label: I38
-  std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x0);
-  std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x0)]);
-  sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, c1.size(), x0.size());
+  const double* i1data = in(1)->get_block_view(c1, x0);
+  BlockBuffer i1data_sorted(in(1)->get_size(c1, x0));
+  sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), c1.size(), x0.size());
   dgemm_("T", "N", c3.size()*a2.size(), c1.size()*x0.size(), 1,
-         1.0, i0data_sorted, 1, i1data_sorted, 1,
-         1.0, odata_sorted, c3.size()*a2.size());
-  sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, c3.size(), a2.size(), c1.size(), x0.size());
+         1.0, i0data_sorted.get(), 1, i1data_sorted.get(), 1,
+         1.0, odata_sorted.get(), c3.size()*a2.size());
+  sort_indices<2,0,3,1,1,1,1,1>(odata_sorted.get(), odata.get(), c3.size(), a2.size(), c1.size(), x0.size());
   out()->put_block(odata, c1, c3, x0, a2);
 }
 
@@ -379,26 +379,26 @@ void Task116::Task_local::compute() {
   const Index x0 = b(1);
   // tensor label: I38
   std::unique_ptr<double[]> odata = out()->move_block(c1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x0), 0.0);
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma12
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x0, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x0, x1)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x0.size(), x1.size());
+        const double* i0data = in(0)->get_block_view(x3, x2, x0, x1);
+        BlockBuffer i0data_sorted(in(0)->get_size(x3, x2, x0, x1));
+        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x2.size(), x0.size(), x1.size());
         // tensor label: I39
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, c1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, c1, x1)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), x2.size(), c1.size(), x1.size());
+        const double* i1data = in(1)->get_block_view(x3, x2, c1, x1);
+        BlockBuffer i1data_sorted(in(1)->get_size(x3, x2, c1, x1));
+        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), x2.size(), c1.size(), x1.size());
         dgemm_("T", "N", x0.size(), c1.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x0.size());
+               1.0, i0data_sorted.get(), x3.size()*x2.size()*x1.size(), i1data_sorted.get(), x3.size()*x2.size()*x1.size(),
+               1.0, odata_sorted.get(), x0.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), c1.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), c1.size());
   out()->put_block(odata, c1, x0);
 }
 
@@ -411,8 +411,8 @@ void Task117::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x3, x2, c1, x1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, c1, x1);
-    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata, x3.size(), x2.size(), c1.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x3, x2, c1, x1);
+    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata.get(), x3.size(), x2.size(), c1.size(), x1.size());
   }
   out()->put_block(odata, x3, x2, c1, x1);
 }
@@ -424,22 +424,22 @@ void Task118::Task_local::compute() {
   const Index a2 = b(3);
   // tensor label: I31
   std::unique_ptr<double[]> odata = out()->move_block(c1, c3, x0, a2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, c3, x0, a2));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   for (auto& x3 : *range_[1]) {
     // tensor label: Gamma14
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x3)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(x0, x3);
+    BlockBuffer i0data_sorted(in(0)->get_size(x0, x3));
+    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), x3.size());
     // tensor label: I41
-    std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, c1, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, c1, x3)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, c3.size(), a2.size(), c1.size(), x3.size());
+    const double* i1data = in(1)->get_block_view(c3, a2, c1, x3);
+    BlockBuffer i1data_sorted(in(1)->get_size(c3, a2, c1, x3));
+    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted.get(), c3.size(), a2.size(), c1.size(), x3.size());
     dgemm_("T", "N", x0.size(), c3.size()*a2.size()*c1.size(), x3.size(),
-           1.0, i0data_sorted, x3.size(), i1data_sorted, x3.size(),
-           1.0, odata_sorted, x0.size());
+           1.0, i0data_sorted.get(), x3.size(), i1data_sorted.get(), x3.size(),
+           1.0, odata_sorted.get(), x0.size());
   }
-  sort_indices<3,1,0,2,1,1,1,1>(odata_sorted, odata, x0.size(), c3.size(), a2.size(), c1.size());
+  sort_indices<3,1,0,2,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), c3.size(), a2.size(), c1.size());
   out()->put_block(odata, c1, c3, x0, a2);
 }
 
@@ -452,13 +452,13 @@ void Task119::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c3, a2, c1, x3);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2, c1, x3);
-    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata, c3.size(), a2.size(), c1.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(c3, a2, c1, x3);
+    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata.get(), c3.size(), a2.size(), c1.size(), x3.size());
   }
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i1data = in(0)->get_block(c1, a2, c3, x3);
-    sort_indices<2,1,0,3,1,1,2,1>(i1data, odata, c1.size(), a2.size(), c3.size(), x3.size());
+    const double* i1data = in(0)->get_block_view(c1, a2, c3, x3);
+    sort_indices<2,1,0,3,1,1,2,1>(i1data, odata.get(), c1.size(), a2.size(), c3.size(), x3.size());
   }
   out()->put_block(odata, c3, a2, c1, x3);
 }
@@ -470,22 +470,22 @@ void Task120::Task_local::compute() {
   const Index a2 = b(3);
   // tensor label: I31
   std::unique_ptr<double[]> odata = out()->move_block(c1, c3, x0, a2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, c3, x0, a2));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma16
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x0, x1);
+    BlockBuffer i0data_sorted(in(0)->get_size(x0, x1));
+    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), x1.size());
     // tensor label: I45
-    std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, x1)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x1.size());
+    const double* i1data = in(1)->get_block_view(c1, a2, c3, x1);
+    BlockBuffer i1data_sorted(in(1)->get_size(c1, a2, c3, x1));
+    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted.get(), c1.size(), a2.size(), c3.size(), x1.size());
     dgemm_("T", "N", x0.size(), c1.size()*a2.size()*c3.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+           1.0, i0data_sorted.get(), x1.size(), i1data_sorted.get(), x1.size(),
+           1.0, odata_sorted.get(), x0.size());
   }
-  sort_indices<1,3,0,2,1,1,1,1>(odata_sorted, odata, x0.size(), c1.size(), a2.size(), c3.size());
+  sort_indices<1,3,0,2,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), c1.size(), a2.size(), c3.size());
   out()->put_block(odata, c1, c3, x0, a2);
 }
 
@@ -500,23 +500,23 @@ void Task121::Task_local::compute() {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2, c1, x1);
     dscal_(c3.size()*a2.size()*c1.size()*x1.size(), e0_, i0data.get(), 1);
-    sort_indices<2,1,0,3,1,1,1,1>(i0data, odata, c3.size(), a2.size(), c1.size(), x1.size());
+    sort_indices<2,1,0,3,1,1,1,1>(i0data.get(), odata.get(), c3.size(), a2.size(), c1.size(), x1.size());
   }
   {
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(0)->get_block(c1, a2, c3, x1);
     dscal_(c1.size()*a2.size()*c3.size()*x1.size(), e0_, i1data.get(), 1);
-    sort_indices<0,1,2,3,1,1,-2,1>(i1data, odata, c1.size(), a2.size(), c3.size(), x1.size());
+    sort_indices<0,1,2,3,1,1,-2,1>(i1data.get(), odata.get(), c1.size(), a2.size(), c3.size(), x1.size());
   }
   {
     // tensor label: v2
-    std::unique_ptr<double[]> i2data = in(1)->get_block(c3, x1, c1, a2);
-    sort_indices<2,3,0,1,1,1,2,1>(i2data, odata, c3.size(), x1.size(), c1.size(), a2.size());
+    const double* i2data = in(1)->get_block_view(c3, x1, c1, a2);
+    sort_indices<2,3,0,1,1,1,2,1>(i2data, odata.get(), c3.size(), x1.size(), c1.size(), a2.size());
   }
   {
     // tensor label: v2
-    std::unique_ptr<double[]> i3data = in(1)->get_block(c1, x1, c3, a2);
-    sort_indices<0,3,2,1,1,1,-1,1>(i3data, odata, c1.size(), x1.size(), c3.size(), a2.size());
+    const double* i3data = in(1)->get_block_view(c1, x1, c3, a2);
+    sort_indices<0,3,2,1,1,1,-1,1>(i3data, odata.get(), c1.size(), x1.size(), c3.size(), a2.size());
   }
   out()->put_block(odata, c1, a2, c3, x1);
 }
@@ -528,22 +528,22 @@ void Task122::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I45
   std::unique_ptr<double[]> odata = out()->move_block(c1, a2, c3, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, a2, c3, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, a2, c3, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, a2, c3, x1), 0.0);
   for (auto& c4 : *range_[0]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c4, a2, c3, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c4, a2, c3, x1)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c4.size(), a2.size(), c3.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c4, a2, c3, x1);
+    BlockBuffer i0data_sorted(in(0)->get_size(c4, a2, c3, x1));
+    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c4.size(), a2.size(), c3.size(), x1.size());
     // tensor label: I46
-    std::unique_ptr<double[]> i1data = in(1)->get_block(c1, c4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, c4)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, c1.size(), c4.size());
+    const double* i1data = in(1)->get_block_view(c1, c4);
+    BlockBuffer i1data_sorted(in(1)->get_size(c1, c4));
+    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), c1.size(), c4.size());
     dgemm_("T", "N", a2.size()*c3.size()*x1.size(), c1.size(), c4.size(),
-           1.0, i0data_sorted, c4.size(), i1data_sorted, c4.size(),
-           1.0, odata_sorted, a2.size()*c3.size()*x1.size());
+           1.0, i0data_sorted.get(), c4.size(), i1data_sorted.get(), c4.size(),
+           1.0, odata_sorted.get(), a2.size()*c3.size()*x1.size());
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, a2.size(), c3.size(), x1.size(), c1.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), a2.size(), c3.size(), x1.size(), c1.size());
   out()->put_block(odata, c1, a2, c3, x1);
 }
 
@@ -554,8 +554,8 @@ void Task123::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c1, c4);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, c4);
-    sort_indices<0,1,1,1,-2,1>(i0data, odata, c1.size(), c4.size());
+    const double* i0data = in(0)->get_block_view(c1, c4);
+    sort_indices<0,1,1,1,-2,1>(i0data, odata.get(), c1.size(), c4.size());
   }
   out()->put_block(odata, c1, c4);
 }
@@ -567,22 +567,22 @@ void Task124::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I45
   std::unique_ptr<double[]> odata = out()->move_block(c1, a2, c3, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, a2, c3, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, a2, c3, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, a2, c3, x1), 0.0);
   for (auto& c4 : *range_[0]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2, c4, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a2, c4, x1)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, c3.size(), a2.size(), c4.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c3, a2, c4, x1);
+    BlockBuffer i0data_sorted(in(0)->get_size(c3, a2, c4, x1));
+    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted.get(), c3.size(), a2.size(), c4.size(), x1.size());
     // tensor label: I49
-    std::unique_ptr<double[]> i1data = in(1)->get_block(c1, c4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, c4)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, c1.size(), c4.size());
+    const double* i1data = in(1)->get_block_view(c1, c4);
+    BlockBuffer i1data_sorted(in(1)->get_size(c1, c4));
+    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), c1.size(), c4.size());
     dgemm_("T", "N", c3.size()*a2.size()*x1.size(), c1.size(), c4.size(),
-           1.0, i0data_sorted, c4.size(), i1data_sorted, c4.size(),
-           1.0, odata_sorted, c3.size()*a2.size()*x1.size());
+           1.0, i0data_sorted.get(), c4.size(), i1data_sorted.get(), c4.size(),
+           1.0, odata_sorted.get(), c3.size()*a2.size()*x1.size());
   }
-  sort_indices<3,1,0,2,1,1,1,1>(odata_sorted, odata, c3.size(), a2.size(), x1.size(), c1.size());
+  sort_indices<3,1,0,2,1,1,1,1>(odata_sorted.get(), odata.get(), c3.size(), a2.size(), x1.size(), c1.size());
   out()->put_block(odata, c1, a2, c3, x1);
 }
 
@@ -593,8 +593,8 @@ void Task125::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c1, c4);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, c4);
-    sort_indices<0,1,1,1,1,1>(i0data, odata, c1.size(), c4.size());
+    const double* i0data = in(0)->get_block_view(c1, c4);
+    sort_indices<0,1,1,1,1,1>(i0data, odata.get(), c1.size(), c4.size());
   }
   out()->put_block(odata, c1, c4);
 }
@@ -606,22 +606,22 @@ void Task126::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I45
   std::unique_ptr<double[]> odata = out()->move_block(c1, a2, c3, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, a2, c3, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, a2, c3, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, a2, c3, x1), 0.0);
   for (auto& c4 : *range_[0]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c4, a2, c1, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c4, a2, c1, x1)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c4.size(), a2.size(), c1.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c4, a2, c1, x1);
+    BlockBuffer i0data_sorted(in(0)->get_size(c4, a2, c1, x1));
+    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c4.size(), a2.size(), c1.size(), x1.size());
     // tensor label: I52
-    std::unique_ptr<double[]> i1data = in(1)->get_block(c3, c4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, c4)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, c3.size(), c4.size());
+    const double* i1data = in(1)->get_block_view(c3, c4);
+    BlockBuffer i1data_sorted(in(1)->get_size(c3, c4));
+    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), c3.size(), c4.size());
     dgemm_("T", "N", a2.size()*c1.size()*x1.size(), c3.size(), c4.size(),
-           1.0, i0data_sorted, c4.size(), i1data_sorted, c4.size(),
-           1.0, odata_sorted, a2.size()*c1.size()*x1.size());
+           1.0, i0data_sorted.get(), c4.size(), i1data_sorted.get(), c4.size(),
+           1.0, odata_sorted.get(), a2.size()*c1.size()*x1.size());
   }
-  sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, a2.size(), c1.size(), x1.size(), c3.size());
+  sort_indices<1,0,3,2,1,1,1,1>(odata_sorted.get(), odata.get(), a2.size(), c1.size(), x1.size(), c3.size());
   out()->put_block(odata, c1, a2, c3, x1);
 }
 
@@ -632,8 +632,8 @@ void Task127::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c3, c4);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c3, c4);
-    sort_indices<0,1,1,1,1,1>(i0data, odata, c3.size(), c4.size());
+    const double* i0data = in(0)->get_block_view(c3, c4);
+    sort_indices<0,1,1,1,1,1>(i0data, odata.get(), c3.size(), c4.size());
   }
   out()->put_block(odata, c3, c4);
 }
@@ -645,22 +645,22 @@ void Task128::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I45
   std::unique_ptr<double[]> odata = out()->move_block(c1, a2, c3, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, a2, c3, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, a2, c3, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, a2, c3, x1), 0.0);
   for (auto& a4 : *range_[2]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a4, c1, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a4, c1, x1)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, c3.size(), a4.size(), c1.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c3, a4, c1, x1);
+    BlockBuffer i0data_sorted(in(0)->get_size(c3, a4, c1, x1));
+    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c3.size(), a4.size(), c1.size(), x1.size());
     // tensor label: I55
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a4, a2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, a2)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a4.size(), a2.size());
+    const double* i1data = in(1)->get_block_view(a4, a2);
+    BlockBuffer i1data_sorted(in(1)->get_size(a4, a2));
+    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), a2.size());
     dgemm_("T", "N", c3.size()*c1.size()*x1.size(), a2.size(), a4.size(),
-           1.0, i0data_sorted, a4.size(), i1data_sorted, a4.size(),
-           1.0, odata_sorted, c3.size()*c1.size()*x1.size());
+           1.0, i0data_sorted.get(), a4.size(), i1data_sorted.get(), a4.size(),
+           1.0, odata_sorted.get(), c3.size()*c1.size()*x1.size());
   }
-  sort_indices<1,3,0,2,1,1,1,1>(odata_sorted, odata, c3.size(), c1.size(), x1.size(), a2.size());
+  sort_indices<1,3,0,2,1,1,1,1>(odata_sorted.get(), odata.get(), c3.size(), c1.size(), x1.size(), a2.size());
   out()->put_block(odata, c1, a2, c3, x1);
 }
 
@@ -671,8 +671,8 @@ void Task129::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a4, a2);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a4, a2);
-    sort_indices<0,1,1,1,-1,1>(i0data, odata, a4.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(a4, a2);
+    sort_indices<0,1,1,1,-1,1>(i0data, odata.get(), a4.size(), a2.size());
   }
   out()->put_block(odata, a4, a2);
 }
@@ -684,22 +684,22 @@ void Task130::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I45
   std::unique_ptr<double[]> odata = out()->move_block(c1, a2, c3, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, a2, c3, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, a2, c3, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, a2, c3, x1), 0.0);
   for (auto& c4 : *range_[0]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c4, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c4, x1)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c4.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c4, x1);
+    BlockBuffer i0data_sorted(in(0)->get_size(c1, a2, c4, x1));
+    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size(), c4.size(), x1.size());
     // tensor label: I58
-    std::unique_ptr<double[]> i1data = in(1)->get_block(c3, c4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, c4)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, c3.size(), c4.size());
+    const double* i1data = in(1)->get_block_view(c3, c4);
+    BlockBuffer i1data_sorted(in(1)->get_size(c3, c4));
+    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), c3.size(), c4.size());
     dgemm_("T", "N", c1.size()*a2.size()*x1.size(), c3.size(), c4.size(),
-           1.0, i0data_sorted, c4.size(), i1data_sorted, c4.size(),
-           1.0, odata_sorted, c1.size()*a2.size()*x1.size());
+           1.0, i0data_sorted.get(), c4.size(), i1data_sorted.get(), c4.size(),
+           1.0, odata_sorted.get(), c1.size()*a2.size()*x1.size());
   }
-  sort_indices<0,1,3,2,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), x1.size(), c3.size());
+  sort_indices<0,1,3,2,1,1,1,1>(odata_sorted.get(), odata.get(), c1.size(), a2.size(), x1.size(), c3.size());
   out()->put_block(odata, c1, a2, c3, x1);
 }
 
@@ -710,8 +710,8 @@ void Task131::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c3, c4);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c3, c4);
-    sort_indices<0,1,1,1,-2,1>(i0data, odata, c3.size(), c4.size());
+    const double* i0data = in(0)->get_block_view(c3, c4);
+    sort_indices<0,1,1,1,-2,1>(i0data, odata.get(), c3.size(), c4.size());
   }
   out()->put_block(odata, c3, c4);
 }
@@ -723,22 +723,22 @@ void Task132::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I45
   std::unique_ptr<double[]> odata = out()->move_block(c1, a2, c3, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, a2, c3, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, a2, c3, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, a2, c3, x1), 0.0);
   for (auto& a4 : *range_[2]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a4, c3, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a4, c3, x1)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a4.size(), c3.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c1, a4, c3, x1);
+    BlockBuffer i0data_sorted(in(0)->get_size(c1, a4, c3, x1));
+    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a4.size(), c3.size(), x1.size());
     // tensor label: I61
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a4, a2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, a2)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a4.size(), a2.size());
+    const double* i1data = in(1)->get_block_view(a4, a2);
+    BlockBuffer i1data_sorted(in(1)->get_size(a4, a2));
+    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), a2.size());
     dgemm_("T", "N", c1.size()*c3.size()*x1.size(), a2.size(), a4.size(),
-           1.0, i0data_sorted, a4.size(), i1data_sorted, a4.size(),
-           1.0, odata_sorted, c1.size()*c3.size()*x1.size());
+           1.0, i0data_sorted.get(), a4.size(), i1data_sorted.get(), a4.size(),
+           1.0, odata_sorted.get(), c1.size()*c3.size()*x1.size());
   }
-  sort_indices<0,3,1,2,1,1,1,1>(odata_sorted, odata, c1.size(), c3.size(), x1.size(), a2.size());
+  sort_indices<0,3,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), c1.size(), c3.size(), x1.size(), a2.size());
   out()->put_block(odata, c1, a2, c3, x1);
 }
 
@@ -749,8 +749,8 @@ void Task133::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a4, a2);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a4, a2);
-    sort_indices<0,1,1,1,2,1>(i0data, odata, a4.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(a4, a2);
+    sort_indices<0,1,1,1,2,1>(i0data, odata.get(), a4.size(), a2.size());
   }
   out()->put_block(odata, a4, a2);
 }
@@ -762,22 +762,22 @@ void Task134::Task_local::compute() {
   const Index a2 = b(3);
   // tensor label: I31
   std::unique_ptr<double[]> odata = out()->move_block(c1, c3, x0, a2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, c3, x0, a2));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   for (auto& x1 : *range_[1]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, c1.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c1, x1);
+    BlockBuffer i0data_sorted(in(0)->get_size(c1, x1));
+    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), x1.size());
     // tensor label: I63
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a2, c3, x1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, c3, x1, x0)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, a2.size(), c3.size(), x1.size(), x0.size());
+    const double* i1data = in(1)->get_block_view(a2, c3, x1, x0);
+    BlockBuffer i1data_sorted(in(1)->get_size(a2, c3, x1, x0));
+    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted.get(), a2.size(), c3.size(), x1.size(), x0.size());
     dgemm_("T", "N", c1.size(), a2.size()*c3.size()*x0.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, c1.size());
+           1.0, i0data_sorted.get(), x1.size(), i1data_sorted.get(), x1.size(),
+           1.0, odata_sorted.get(), c1.size());
   }
-  sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), c3.size(), x0.size());
+  sort_indices<0,2,3,1,1,1,1,1>(odata_sorted.get(), odata.get(), c1.size(), a2.size(), c3.size(), x0.size());
   out()->put_block(odata, c1, c3, x0, a2);
 }
 
@@ -788,24 +788,24 @@ void Task135::Task_local::compute() {
   const Index x0 = b(3);
   // tensor label: I63
   std::unique_ptr<double[]> odata = out()->move_block(a2, c3, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c3, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(a2, c3, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c3, x1, x0), 0.0);
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma22
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x1, x0, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x1, x0, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x1.size(), x0.size(), x2.size());
+      const double* i0data = in(0)->get_block_view(x3, x1, x0, x2);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, x1, x0, x2));
+      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x1.size(), x0.size(), x2.size());
       // tensor label: I64
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a2, c3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a2, c3, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), a2.size(), c3.size(), x2.size());
+      const double* i1data = in(1)->get_block_view(x3, a2, c3, x2);
+      BlockBuffer i1data_sorted(in(1)->get_size(x3, a2, c3, x2));
+      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), a2.size(), c3.size(), x2.size());
       dgemm_("T", "N", x1.size()*x0.size(), a2.size()*c3.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+             1.0, i0data_sorted.get(), x3.size()*x2.size(), i1data_sorted.get(), x3.size()*x2.size(),
+             1.0, odata_sorted.get(), x1.size()*x0.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a2.size(), c3.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size(), a2.size(), c3.size());
   out()->put_block(odata, a2, c3, x1, x0);
 }
 
@@ -818,8 +818,8 @@ void Task136::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x3, a2, c3, x2);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a2, c3, x2);
-    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata, x3.size(), a2.size(), c3.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x3, a2, c3, x2);
+    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata.get(), x3.size(), a2.size(), c3.size(), x2.size());
   }
   out()->put_block(odata, x3, a2, c3, x2);
 }
@@ -831,24 +831,24 @@ void Task137::Task_local::compute() {
   const Index x0 = b(3);
   // tensor label: I63
   std::unique_ptr<double[]> odata = out()->move_block(a2, c3, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c3, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(a2, c3, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c3, x1, x0), 0.0);
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma12
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x0, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x0, x1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x0.size(), x1.size());
+      const double* i0data = in(0)->get_block_view(x3, x2, x0, x1);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, x2, x0, x1));
+      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x2.size(), x0.size(), x1.size());
       // tensor label: I70
-      std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c3.size(), a2.size(), x3.size(), x2.size());
+      const double* i1data = in(1)->get_block_view(c3, a2, x3, x2);
+      BlockBuffer i1data_sorted(in(1)->get_size(c3, a2, x3, x2));
+      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted.get(), c3.size(), a2.size(), x3.size(), x2.size());
       dgemm_("T", "N", x0.size()*x1.size(), c3.size()*a2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+             1.0, i0data_sorted.get(), x3.size()*x2.size(), i1data_sorted.get(), x3.size()*x2.size(),
+             1.0, odata_sorted.get(), x0.size()*x1.size());
     }
   }
-  sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), c3.size(), a2.size());
+  sort_indices<3,2,1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), c3.size(), a2.size());
   out()->put_block(odata, a2, c3, x1, x0);
 }
 
@@ -861,8 +861,8 @@ void Task138::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c3, a2, x3, x2);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2, x3, x2);
-    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata, c3.size(), a2.size(), x3.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(c3, a2, x3, x2);
+    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata.get(), c3.size(), a2.size(), x3.size(), x2.size());
   }
   out()->put_block(odata, c3, a2, x3, x2);
 }
@@ -874,22 +874,22 @@ void Task139::Task_local::compute() {
   const Index a2 = b(3);
   // tensor label: I31
   std::unique_ptr<double[]> odata = out()->move_block(c1, c3, x0, a2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, c3, x0, a2));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   for (auto& x1 : *range_[1]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c3, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, x1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, c3.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c3, x1);
+    BlockBuffer i0data_sorted(in(0)->get_size(c3, x1));
+    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted.get(), c3.size(), x1.size());
     // tensor label: I66
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a2, c1, x0, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, c1, x0, x1)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, a2.size(), c1.size(), x0.size(), x1.size());
+    const double* i1data = in(1)->get_block_view(a2, c1, x0, x1);
+    BlockBuffer i1data_sorted(in(1)->get_size(a2, c1, x0, x1));
+    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted.get(), a2.size(), c1.size(), x0.size(), x1.size());
     dgemm_("T", "N", c3.size(), a2.size()*c1.size()*x0.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, c3.size());
+           1.0, i0data_sorted.get(), x1.size(), i1data_sorted.get(), x1.size(),
+           1.0, odata_sorted.get(), c3.size());
   }
-  sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, c3.size(), a2.size(), c1.size(), x0.size());
+  sort_indices<2,0,3,1,1,1,1,1>(odata_sorted.get(), odata.get(), c3.size(), a2.size(), c1.size(), x0.size());
   out()->put_block(odata, c1, c3, x0, a2);
 }
 
@@ -900,24 +900,24 @@ void Task140::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I66
   std::unique_ptr<double[]> odata = out()->move_block(a2, c1, x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(a2, c1, x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, x0, x1), 0.0);
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma12
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x0, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x0, x1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x0.size(), x1.size());
+      const double* i0data = in(0)->get_block_view(x3, x2, x0, x1);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, x2, x0, x1));
+      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x2.size(), x0.size(), x1.size());
       // tensor label: I67
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a2, c1, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a2, c1, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), a2.size(), c1.size(), x2.size());
+      const double* i1data = in(1)->get_block_view(x3, a2, c1, x2);
+      BlockBuffer i1data_sorted(in(1)->get_size(x3, a2, c1, x2));
+      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), a2.size(), c1.size(), x2.size());
       dgemm_("T", "N", x0.size()*x1.size(), a2.size()*c1.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+             1.0, i0data_sorted.get(), x3.size()*x2.size(), i1data_sorted.get(), x3.size()*x2.size(),
+             1.0, odata_sorted.get(), x0.size()*x1.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a2.size(), c1.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), a2.size(), c1.size());
   out()->put_block(odata, a2, c1, x0, x1);
 }
 
@@ -930,13 +930,13 @@ void Task141::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x3, a2, c1, x2);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a2, c1, x2);
-    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata, x3.size(), a2.size(), c1.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x3, a2, c1, x2);
+    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata.get(), x3.size(), a2.size(), c1.size(), x2.size());
   }
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i1data = in(0)->get_block(c1, a2, x3, x2);
-    sort_indices<2,1,0,3,1,1,2,1>(i1data, odata, c1.size(), a2.size(), x3.size(), x2.size());
+    const double* i1data = in(0)->get_block_view(c1, a2, x3, x2);
+    sort_indices<2,1,0,3,1,1,2,1>(i1data, odata.get(), c1.size(), a2.size(), x3.size(), x2.size());
   }
   out()->put_block(odata, x3, a2, c1, x2);
 }
@@ -948,22 +948,22 @@ void Task142::Task_local::compute() {
   const Index a2 = b(3);
   // tensor label: I31
   std::unique_ptr<double[]> odata = out()->move_block(c1, c3, x0, a2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, c3, x0, a2));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   for (auto& a4 : *range_[2]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a4, c3, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a4, c3, a2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a4.size(), c3.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(c1, a4, c3, a2);
+    BlockBuffer i0data_sorted(in(0)->get_size(c1, a4, c3, a2));
+    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a4.size(), c3.size(), a2.size());
     // tensor label: I75
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a4, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, x0)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a4.size(), x0.size());
+    const double* i1data = in(1)->get_block_view(a4, x0);
+    BlockBuffer i1data_sorted(in(1)->get_size(a4, x0));
+    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), x0.size());
     dgemm_("T", "N", c1.size()*c3.size()*a2.size(), x0.size(), a4.size(),
-           1.0, i0data_sorted, a4.size(), i1data_sorted, a4.size(),
-           1.0, odata_sorted, c1.size()*c3.size()*a2.size());
+           1.0, i0data_sorted.get(), a4.size(), i1data_sorted.get(), a4.size(),
+           1.0, odata_sorted.get(), c1.size()*c3.size()*a2.size());
   }
-  sort_indices<0,1,3,2,1,1,1,1>(odata_sorted, odata, c1.size(), c3.size(), a2.size(), x0.size());
+  sort_indices<0,1,3,2,1,1,1,1>(odata_sorted.get(), odata.get(), c1.size(), c3.size(), a2.size(), x0.size());
   out()->put_block(odata, c1, c3, x0, a2);
 }
 
@@ -972,22 +972,22 @@ void Task143::Task_local::compute() {
   const Index x0 = b(1);
   // tensor label: I75
   std::unique_ptr<double[]> odata = out()->move_block(a4, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(a4, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(a4, x0), 0.0);
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma16
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x0, x1);
+    BlockBuffer i0data_sorted(in(0)->get_size(x0, x1));
+    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), x1.size());
     // tensor label: I76
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a4, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, x1)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, a4.size(), x1.size());
+    const double* i1data = in(1)->get_block_view(a4, x1);
+    BlockBuffer i1data_sorted(in(1)->get_size(a4, x1));
+    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), x1.size());
     dgemm_("T", "N", x0.size(), a4.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+           1.0, i0data_sorted.get(), x1.size(), i1data_sorted.get(), x1.size(),
+           1.0, odata_sorted.get(), x0.size());
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), a4.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), a4.size());
   out()->put_block(odata, a4, x0);
 }
 
@@ -998,8 +998,8 @@ void Task144::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a4, x1);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a4, x1);
-    sort_indices<0,1,1,1,-2,1>(i0data, odata, a4.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(a4, x1);
+    sort_indices<0,1,1,1,-2,1>(i0data, odata.get(), a4.size(), x1.size());
   }
   out()->put_block(odata, a4, x1);
 }
@@ -1011,22 +1011,22 @@ void Task145::Task_local::compute() {
   const Index a2 = b(3);
   // tensor label: I31
   std::unique_ptr<double[]> odata = out()->move_block(c1, c3, x0, a2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, c3, x0, a2));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   for (auto& a4 : *range_[2]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, a4)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, a4);
+    BlockBuffer i0data_sorted(in(0)->get_size(c1, a2, c3, a4));
+    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size(), c3.size(), a4.size());
     // tensor label: I78
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a4, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, x0)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a4.size(), x0.size());
+    const double* i1data = in(1)->get_block_view(a4, x0);
+    BlockBuffer i1data_sorted(in(1)->get_size(a4, x0));
+    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), x0.size());
     dgemm_("T", "N", c1.size()*a2.size()*c3.size(), x0.size(), a4.size(),
-           1.0, i0data_sorted, a4.size(), i1data_sorted, a4.size(),
-           1.0, odata_sorted, c1.size()*a2.size()*c3.size());
+           1.0, i0data_sorted.get(), a4.size(), i1data_sorted.get(), a4.size(),
+           1.0, odata_sorted.get(), c1.size()*a2.size()*c3.size());
   }
-  sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), c3.size(), x0.size());
+  sort_indices<0,2,3,1,1,1,1,1>(odata_sorted.get(), odata.get(), c1.size(), a2.size(), c3.size(), x0.size());
   out()->put_block(odata, c1, c3, x0, a2);
 }
 
@@ -1035,22 +1035,22 @@ void Task146::Task_local::compute() {
   const Index x0 = b(1);
   // tensor label: I78
   std::unique_ptr<double[]> odata = out()->move_block(a4, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(a4, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(a4, x0), 0.0);
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma16
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x0, x1);
+    BlockBuffer i0data_sorted(in(0)->get_size(x0, x1));
+    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), x1.size());
     // tensor label: I79
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a4, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, x1)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, a4.size(), x1.size());
+    const double* i1data = in(1)->get_block_view(a4, x1);
+    BlockBuffer i1data_sorted(in(1)->get_size(a4, x1));
+    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), x1.size());
     dgemm_("T", "N", x0.size(), a4.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+           1.0, i0data_sorted.get(), x1.size(), i1data_sorted.get(), x1.size(),
+           1.0, odata_sorted.get(), x0.size());
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), a4.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), a4.size());
   out()->put_block(odata, a4, x0);
 }
 
@@ -1061,8 +1061,8 @@ void Task147::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a4, x1);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a4, x1);
-    sort_indices<0,1,1,1,4,1>(i0data, odata, a4.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(a4, x1);
+    sort_indices<0,1,1,1,4,1>(i0data, odata.get(), a4.size(), x1.size());
   }
   out()->put_block(odata, a4, x1);
 }
@@ -1076,8 +1076,8 @@ void Task148::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c2, x1, x0, a1);
   {
     // tensor label: I80
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c2, x1, x0, a1);
-    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata, c2.size(), x1.size(), x0.size(), a1.size());
+    const double* i0data = in(0)->get_block_view(c2, x1, x0, a1);
+    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata.get(), c2.size(), x1.size(), x0.size(), a1.size());
   }
   out()->put_block(odata, c2, x1, x0, a1);
 }
@@ -1089,22 +1089,22 @@ void Task149::Task_local::compute() {
   const Index a1 = b(3);
   // tensor label: I80
   std::unique_ptr<double[]> odata = out()->move_block(c2, x1, x0, a1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x0, a1)]);
+  BlockBuffer odata_sorted(out()->get_size(c2, x1, x0, a1));
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x0, a1), 0.0);
   for (auto& x2 : *range_[1]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x2, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, a1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x2.size(), a1.size());
+    const double* i0data = in(0)->get_block_view(x2, a1);
+    BlockBuffer i0data_sorted(in(0)->get_size(x2, a1));
+    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), x2.size(), a1.size());
     // tensor label: I81
-    std::unique_ptr<double[]> i1data = in(1)->get_block(c2, x1, x2, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, x1, x2, x0)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, c2.size(), x1.size(), x2.size(), x0.size());
+    const double* i1data = in(1)->get_block_view(c2, x1, x2, x0);
+    BlockBuffer i1data_sorted(in(1)->get_size(c2, x1, x2, x0));
+    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted.get(), c2.size(), x1.size(), x2.size(), x0.size());
     dgemm_("T", "N", a1.size(), c2.size()*x1.size()*x0.size(), x2.size(),
-           1.0, i0data_sorted, x2.size(), i1data_sorted, x2.size(),
-           1.0, odata_sorted, a1.size());
+           1.0, i0data_sorted.get(), x2.size(), i1data_sorted.get(), x2.size(),
+           1.0, odata_sorted.get(), a1.size());
   }
-  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a1.size(), c2.size(), x1.size(), x0.size());
+  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted.get(), odata.get(), a1.size(), c2.size(), x1.size(), x0.size());
   out()->put_block(odata, c2, x1, x0, a1);
 }
 
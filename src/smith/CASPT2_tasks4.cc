@@ -40,26 +40,26 @@ void Task150::Task_local::compute() {
   const Index x0 = b(3);
   // tensor label: I81
   std::unique_ptr<double[]> odata = out()->move_block(c2, x1, x2, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x2, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(c2, x1, x2, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x2, x0), 0.0);
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma28
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x1, x3, x2, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x1, x3, x2, x0)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x1.size(), x3.size(), x2.size(), x0.size());
+        const double* i0data = in(0)->get_block_view(x5, x4, x1, x3, x2, x0);
+        BlockBuffer i0data_sorted(in(0)->get_size(x5, x4, x1, x3, x2, x0));
+        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), x4.size(), x1.size(), x3.size(), x2.size(), x0.size());
         // tensor label: I82
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, c2, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, c2, x3)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted, x5.size(), x4.size(), c2.size(), x3.size());
+        const double* i1data = in(1)->get_block_view(x5, x4, c2, x3);
+        BlockBuffer i1data_sorted(in(1)->get_size(x5, x4, c2, x3));
+        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted.get(), x5.size(), x4.size(), c2.size(), x3.size());
         dgemm_("T", "N", x1.size()*x2.size()*x0.size(), c2.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x1.size()*x2.size()*x0.size());
+               1.0, i0data_sorted.get(), x5.size()*x4.size()*x3.size(), i1data_sorted.get(), x5.size()*x4.size()*x3.size(),
+               1.0, odata_sorted.get(), x1.size()*x2.size()*x0.size());
       }
     }
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x1.size(), x2.size(), x0.size(), c2.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x2.size(), x0.size(), c2.size());
   out()->put_block(odata, c2, x1, x2, x0);
 }
 
@@ -72,8 +72,8 @@ void Task151::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x5, x4, c2, x3);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, c2, x3);
-    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata, x5.size(), x4.size(), c2.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(x5, x4, c2, x3);
+    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata.get(), x5.size(), x4.size(), c2.size(), x3.size());
   }
   out()->put_block(odata, x5, x4, c2, x3);
 }
@@ -85,24 +85,24 @@ void Task152::Task_local::compute() {
   const Index a1 = b(3);
   // tensor label: I80
   std::unique_ptr<double[]> odata = out()->move_block(c2, x1, x0, a1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x0, a1)]);
+  BlockBuffer odata_sorted(out()->get_size(c2, x1, x0, a1));
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x0, a1), 0.0);
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma29
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x3, x2, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x3, x2, x0)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), x3.size(), x2.size(), x0.size());
+      const double* i0data = in(0)->get_block_view(x1, x3, x2, x0);
+      BlockBuffer i0data_sorted(in(0)->get_size(x1, x3, x2, x0));
+      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), x3.size(), x2.size(), x0.size());
       // tensor label: I84
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x2, a1, c2, x3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, a1, c2, x3)]);
-      sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, x2.size(), a1.size(), c2.size(), x3.size());
+      const double* i1data = in(1)->get_block_view(x2, a1, c2, x3);
+      BlockBuffer i1data_sorted(in(1)->get_size(x2, a1, c2, x3));
+      sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), a1.size(), c2.size(), x3.size());
       dgemm_("T", "N", x1.size()*x0.size(), a1.size()*c2.size(), x2.size()*x3.size(),
-             1.0, i0data_sorted, x2.size()*x3.size(), i1data_sorted, x2.size()*x3.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+             1.0, i0data_sorted.get(), x2.size()*x3.size(), i1data_sorted.get(), x2.size()*x3.size(),
+             1.0, odata_sorted.get(), x1.size()*x0.size());
     }
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a1.size(), c2.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size(), a1.size(), c2.size());
   out()->put_block(odata, c2, x1, x0, a1);
 }
 
@@ -115,8 +115,8 @@ void Task153::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x2, a1, c2, x3);
   {
     // tensor label: v2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c2, x3, x2, a1);
-    sort_indices<2,3,0,1,1,1,-1,2>(i0data, odata, c2.size(), x3.size(), x2.size(), a1.size());
+    const double* i0data = in(0)->get_block_view(c2, x3, x2, a1);
+    sort_indices<2,3,0,1,1,1,-1,2>(i0data, odata.get(), c2.size(), x3.size(), x2.size(), a1.size());
   }
   out()->put_block(odata, x2, a1, c2, x3);
 }
@@ -128,22 +128,22 @@ void Task154::Task_local::compute() {
   const Index x3 = b(3);
   // tensor label: I84
   std::unique_ptr<double[]> odata = out()->move_block(x2, a1, c2, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, a1, c2, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(x2, a1, c2, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(x2, a1, c2, x3), 0.0);
   for (auto& c3 : *range_[0]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a1, c2, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a1, c2, x3)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c3.size(), a1.size(), c2.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(c3, a1, c2, x3);
+    BlockBuffer i0data_sorted(in(0)->get_size(c3, a1, c2, x3));
+    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c3.size(), a1.size(), c2.size(), x3.size());
     // tensor label: I85
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c3)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, x2.size(), c3.size());
+    const double* i1data = in(1)->get_block_view(x2, c3);
+    BlockBuffer i1data_sorted(in(1)->get_size(x2, c3));
+    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), c3.size());
     dgemm_("T", "N", a1.size()*c2.size()*x3.size(), x2.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, a1.size()*c2.size()*x3.size());
+           1.0, i0data_sorted.get(), c3.size(), i1data_sorted.get(), c3.size(),
+           1.0, odata_sorted.get(), a1.size()*c2.size()*x3.size());
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, a1.size(), c2.size(), x3.size(), x2.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), a1.size(), c2.size(), x3.size(), x2.size());
   out()->put_block(odata, x2, a1, c2, x3);
 }
 
@@ -154,8 +154,8 @@ void Task155::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x2, c3);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x2, c3);
-    sort_indices<0,1,1,1,1,1>(i0data, odata, x2.size(), c3.size());
+    const double* i0data = in(0)->get_block_view(x2, c3);
+    sort_indices<0,1,1,1,1,1>(i0data, odata.get(), x2.size(), c3.size());
   }
   out()->put_block(odata, x2, c3);
 }
@@ -167,24 +167,24 @@ void Task156::Task_local::compute() {
   const Index a1 = b(3);
   // tensor label: I80
   std::unique_ptr<double[]> odata = out()->move_block(c2, x1, x0, a1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x0, a1)]);
+  BlockBuffer odata_sorted(out()->get_size(c2, x1, x0, a1));
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x0, a1), 0.0);
   for (auto& x2 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       // tensor label: Gamma7
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x3, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, x3, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x2.size(), x3.size(), x1.size(), x0.size());
+      const double* i0data = in(0)->get_block_view(x2, x3, x1, x0);
+      BlockBuffer i0data_sorted(in(0)->get_size(x2, x3, x1, x0));
+      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x2.size(), x3.size(), x1.size(), x0.size());
       // tensor label: I87
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c2, a1, x3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c2, a1, x3)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x2.size(), c2.size(), a1.size(), x3.size());
+      const double* i1data = in(1)->get_block_view(x2, c2, a1, x3);
+      BlockBuffer i1data_sorted(in(1)->get_size(x2, c2, a1, x3));
+      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), c2.size(), a1.size(), x3.size());
       dgemm_("T", "N", x1.size()*x0.size(), c2.size()*a1.size(), x2.size()*x3.size(),
-             1.0, i0data_sorted, x2.size()*x3.size(), i1data_sorted, x2.size()*x3.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+             1.0, i0data_sorted.get(), x2.size()*x3.size(), i1data_sorted.get(), x2.size()*x3.size(),
+             1.0, odata_sorted.get(), x1.size()*x0.size());
     }
   }
-  sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c2.size(), a1.size());
+  sort_indices<2,0,1,3,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size(), c2.size(), a1.size());
   out()->put_block(odata, c2, x1, x0, a1);
 }
 
@@ -195,22 +195,22 @@ void Task157::Task_local::compute() {
   const Index x3 = b(3);
   // tensor label: I87
   std::unique_ptr<double[]> odata = out()->move_block(x2, c2, a1, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, c2, a1, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(x2, c2, a1, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(x2, c2, a1, x3), 0.0);
   for (auto& c3 : *range_[0]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, c3, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1, c3, x3)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size(), c3.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(c2, a1, c3, x3);
+    BlockBuffer i0data_sorted(in(0)->get_size(c2, a1, c3, x3));
+    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted.get(), c2.size(), a1.size(), c3.size(), x3.size());
     // tensor label: I88
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c3)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, x2.size(), c3.size());
+    const double* i1data = in(1)->get_block_view(x2, c3);
+    BlockBuffer i1data_sorted(in(1)->get_size(x2, c3));
+    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), c3.size());
     dgemm_("T", "N", c2.size()*a1.size()*x3.size(), x2.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, c2.size()*a1.size()*x3.size());
+           1.0, i0data_sorted.get(), c3.size(), i1data_sorted.get(), c3.size(),
+           1.0, odata_sorted.get(), c2.size()*a1.size()*x3.size());
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), x3.size(), x2.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), c2.size(), a1.size(), x3.size(), x2.size());
   out()->put_block(odata, x2, c2, a1, x3);
 }
 
@@ -221,8 +221,8 @@ void Task158::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x2, c3);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x2, c3);
-    sort_indices<0,1,1,1,-1,1>(i0data, odata, x2.size(), c3.size());
+    const double* i0data = in(0)->get_block_view(x2, c3);
+    sort_indices<0,1,1,1,-1,1>(i0data, odata.get(), x2.size(), c3.size());
   }
   out()->put_block(odata, x2, c3);
 }
@@ -234,24 +234,24 @@ void Task159::Task_local::compute() {
   const Index a1 = b(3);
   // tensor label: I80
   std::unique_ptr<double[]> odata = out()->move_block(c2, x1, x0, a1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x0, a1)]);
+  BlockBuffer odata_sorted(out()->get_size(c2, x1, x0, a1));
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x0, a1), 0.0);
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       // tensor label: Gamma31
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x1, x4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x1, x4)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x1.size(), x4.size());
+      const double* i0data = in(0)->get_block_view(x5, x0, x1, x4);
+      BlockBuffer i0data_sorted(in(0)->get_size(x5, x0, x1, x4));
+      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), x0.size(), x1.size(), x4.size());
       // tensor label: I90
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a1, c2, x4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a1, c2, x4)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x5.size(), a1.size(), c2.size(), x4.size());
+      const double* i1data = in(1)->get_block_view(x5, a1, c2, x4);
+      BlockBuffer i1data_sorted(in(1)->get_size(x5, a1, c2, x4));
+      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted.get(), x5.size(), a1.size(), c2.size(), x4.size());
       dgemm_("T", "N", x0.size()*x1.size(), a1.size()*c2.size(), x5.size()*x4.size(),
-             1.0, i0data_sorted, x5.size()*x4.size(), i1data_sorted, x5.size()*x4.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+             1.0, i0data_sorted.get(), x5.size()*x4.size(), i1data_sorted.get(), x5.size()*x4.size(),
+             1.0, odata_sorted.get(), x0.size()*x1.size());
     }
   }
-  sort_indices<3,1,0,2,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a1.size(), c2.size());
+  sort_indices<3,1,0,2,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), a1.size(), c2.size());
   out()->put_block(odata, c2, x1, x0, a1);
 }
 
@@ -264,8 +264,8 @@ void Task160::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x5, a1, c2, x4);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, c2, x4);
-    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata, x5.size(), a1.size(), c2.size(), x4.size());
+    const double* i0data = in(0)->get_block_view(x5, a1, c2, x4);
+    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata.get(), x5.size(), a1.size(), c2.size(), x4.size());
   }
   out()->put_block(odata, x5, a1, c2, x4);
 }
@@ -277,24 +277,24 @@ void Task161::Task_local::compute() {
   const Index a1 = b(3);
   // tensor label: I80
   std::unique_ptr<double[]> odata = out()->move_block(c2, x1, x0, a1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x0, a1)]);
+  BlockBuffer odata_sorted(out()->get_size(c2, x1, x0, a1));
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x0, a1), 0.0);
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma32
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x1, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x1.size(), x2.size());
+      const double* i0data = in(0)->get_block_view(x3, x0, x1, x2);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, x0, x1, x2));
+      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x0.size(), x1.size(), x2.size());
       // tensor label: I92
-      std::unique_ptr<double[]> i1data = in(1)->get_block(c2, x3, a1, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, x3, a1, x2)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i1data, i1data_sorted, c2.size(), x3.size(), a1.size(), x2.size());
+      const double* i1data = in(1)->get_block_view(c2, x3, a1, x2);
+      BlockBuffer i1data_sorted(in(1)->get_size(c2, x3, a1, x2));
+      sort_indices<1,3,0,2,0,1,1,1>(i1data, i1data_sorted.get(), c2.size(), x3.size(), a1.size(), x2.size());
       dgemm_("T", "N", x0.size()*x1.size(), c2.size()*a1.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+             1.0, i0data_sorted.get(), x3.size()*x2.size(), i1data_sorted.get(), x3.size()*x2.size(),
+             1.0, odata_sorted.get(), x0.size()*x1.size());
     }
   }
-  sort_indices<2,1,0,3,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), c2.size(), a1.size());
+  sort_indices<2,1,0,3,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), c2.size(), a1.size());
   out()->put_block(odata, c2, x1, x0, a1);
 }
 
@@ -309,12 +309,12 @@ void Task162::Task_local::compute() {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, c2, x2);
     dscal_(x3.size()*a1.size()*c2.size()*x2.size(), e0_, i0data.get(), 1);
-    sort_indices<2,0,1,3,1,1,-1,1>(i0data, odata, x3.size(), a1.size(), c2.size(), x2.size());
+    sort_indices<2,0,1,3,1,1,-1,1>(i0data.get(), odata.get(), x3.size(), a1.size(), c2.size(), x2.size());
   }
   {
     // tensor label: v2
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, c2, x2);
-    sort_indices<2,0,1,3,1,1,1,2>(i1data, odata, x3.size(), a1.size(), c2.size(), x2.size());
+    const double* i1data = in(1)->get_block_view(x3, a1, c2, x2);
+    sort_indices<2,0,1,3,1,1,1,2>(i1data, odata.get(), x3.size(), a1.size(), c2.size(), x2.size());
   }
   out()->put_block(odata, c2, x3, a1, x2);
 }
@@ -326,22 +326,22 @@ void Task163::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I92
   std::unique_ptr<double[]> odata = out()->move_block(c2, x3, a1, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x3, a1, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(c2, x3, a1, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x3, a1, x2), 0.0);
   for (auto& c3 : *range_[0]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, c3, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, c3, x2)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), c3.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x3, a1, c3, x2);
+    BlockBuffer i0data_sorted(in(0)->get_size(x3, a1, c3, x2));
+    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a1.size(), c3.size(), x2.size());
     // tensor label: I93
-    std::unique_ptr<double[]> i1data = in(1)->get_block(c2, c3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, c3)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, c2.size(), c3.size());
+    const double* i1data = in(1)->get_block_view(c2, c3);
+    BlockBuffer i1data_sorted(in(1)->get_size(c2, c3));
+    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), c2.size(), c3.size());
     dgemm_("T", "N", x3.size()*a1.size()*x2.size(), c2.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, x3.size()*a1.size()*x2.size());
+           1.0, i0data_sorted.get(), c3.size(), i1data_sorted.get(), c3.size(),
+           1.0, odata_sorted.get(), x3.size()*a1.size()*x2.size());
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x3.size(), a1.size(), x2.size(), c2.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), a1.size(), x2.size(), c2.size());
   out()->put_block(odata, c2, x3, a1, x2);
 }
 
@@ -352,8 +352,8 @@ void Task164::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c2, c3);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c2, c3);
-    sort_indices<0,1,1,1,-1,1>(i0data, odata, c2.size(), c3.size());
+    const double* i0data = in(0)->get_block_view(c2, c3);
+    sort_indices<0,1,1,1,-1,1>(i0data, odata.get(), c2.size(), c3.size());
   }
   out()->put_block(odata, c2, c3);
 }
@@ -365,22 +365,22 @@ void Task165::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I92
   std::unique_ptr<double[]> odata = out()->move_block(c2, x3, a1, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x3, a1, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(c2, x3, a1, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x3, a1, x2), 0.0);
   for (auto& a3 : *range_[2]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a3, c2, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a3, c2, x2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a3.size(), c2.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x3, a3, c2, x2);
+    BlockBuffer i0data_sorted(in(0)->get_size(x3, a3, c2, x2));
+    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a3.size(), c2.size(), x2.size());
     // tensor label: I96
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a3, a1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, a1)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a3.size(), a1.size());
+    const double* i1data = in(1)->get_block_view(a3, a1);
+    BlockBuffer i1data_sorted(in(1)->get_size(a3, a1));
+    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), a1.size());
     dgemm_("T", "N", x3.size()*c2.size()*x2.size(), a1.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, x3.size()*c2.size()*x2.size());
+           1.0, i0data_sorted.get(), a3.size(), i1data_sorted.get(), a3.size(),
+           1.0, odata_sorted.get(), x3.size()*c2.size()*x2.size());
   }
-  sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, x3.size(), c2.size(), x2.size(), a1.size());
+  sort_indices<1,0,3,2,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), c2.size(), x2.size(), a1.size());
   out()->put_block(odata, c2, x3, a1, x2);
 }
 
@@ -391,8 +391,8 @@ void Task166::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, a1);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a3, a1);
-    sort_indices<0,1,1,1,1,1>(i0data, odata, a3.size(), a1.size());
+    const double* i0data = in(0)->get_block_view(a3, a1);
+    sort_indices<0,1,1,1,1,1>(i0data, odata.get(), a3.size(), a1.size());
   }
   out()->put_block(odata, a3, a1);
 }
@@ -404,22 +404,22 @@ void Task167::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I92
   std::unique_ptr<double[]> odata = out()->move_block(c2, x3, a1, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x3, a1, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(c2, x3, a1, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x3, a1, x2), 0.0);
   for (auto& a3 : *range_[2]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, c2, a3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, c2, a3)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), c2.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(x3, a1, c2, a3);
+    BlockBuffer i0data_sorted(in(0)->get_size(x3, a1, c2, a3));
+    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a1.size(), c2.size(), a3.size());
     // tensor label: I119
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x2)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a3.size(), x2.size());
+    const double* i1data = in(1)->get_block_view(a3, x2);
+    BlockBuffer i1data_sorted(in(1)->get_size(a3, x2));
+    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), x2.size());
     dgemm_("T", "N", x3.size()*a1.size()*c2.size(), x2.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, x3.size()*a1.size()*c2.size());
+           1.0, i0data_sorted.get(), a3.size(), i1data_sorted.get(), a3.size(),
+           1.0, odata_sorted.get(), x3.size()*a1.size()*c2.size());
   }
-  sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x3.size(), a1.size(), c2.size(), x2.size());
+  sort_indices<2,0,1,3,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), a1.size(), c2.size(), x2.size());
   out()->put_block(odata, c2, x3, a1, x2);
 }
 
@@ -430,8 +430,8 @@ void Task168::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, x2);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a3, x2);
-    sort_indices<0,1,1,1,1,1>(i0data, odata, a3.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(a3, x2);
+    sort_indices<0,1,1,1,1,1>(i0data, odata.get(), a3.size(), x2.size());
   }
   out()->put_block(odata, a3, x2);
 }
@@ -443,24 +443,24 @@ void Task169::Task_local::compute() {
   const Index a1 = b(3);
   // tensor label: I80
   std::unique_ptr<double[]> odata = out()->move_block(c2, x1, x0, a1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x0, a1)]);
+  BlockBuffer odata_sorted(out()->get_size(c2, x1, x0, a1));
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x0, a1), 0.0);
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       // tensor label: Gamma34
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x1.size(), x0.size());
+      const double* i0data = in(0)->get_block_view(x5, x4, x1, x0);
+      BlockBuffer i0data_sorted(in(0)->get_size(x5, x4, x1, x0));
+      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), x4.size(), x1.size(), x0.size());
       // tensor label: I98
-      std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x5, x4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x5, x4)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x5.size(), x4.size());
+      const double* i1data = in(1)->get_block_view(c2, a1, x5, x4);
+      BlockBuffer i1data_sorted(in(1)->get_size(c2, a1, x5, x4));
+      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted.get(), c2.size(), a1.size(), x5.size(), x4.size());
       dgemm_("T", "N", x1.size()*x0.size(), c2.size()*a1.size(), x5.size()*x4.size(),
-             1.0, i0data_sorted, x5.size()*x4.size(), i1data_sorted, x5.size()*x4.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+             1.0, i0data_sorted.get(), x5.size()*x4.size(), i1data_sorted.get(), x5.size()*x4.size(),
+             1.0, odata_sorted.get(), x1.size()*x0.size());
     }
   }
-  sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c2.size(), a1.size());
+  sort_indices<2,0,1,3,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size(), c2.size(), a1.size());
   out()->put_block(odata, c2, x1, x0, a1);
 }
 
@@ -473,8 +473,8 @@ void Task170::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c2, a1, x5, x4);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, x5, x4);
-    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata, c2.size(), a1.size(), x5.size(), x4.size());
+    const double* i0data = in(0)->get_block_view(c2, a1, x5, x4);
+    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata.get(), c2.size(), a1.size(), x5.size(), x4.size());
   }
   out()->put_block(odata, c2, a1, x5, x4);
 }
@@ -486,24 +486,24 @@ void Task171::Task_local::compute() {
   const Index a1 = b(3);
   // tensor label: I80
   std::unique_ptr<double[]> odata = out()->move_block(c2, x1, x0, a1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x0, a1)]);
+  BlockBuffer odata_sorted(out()->get_size(c2, x1, x0, a1));
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x0, a1), 0.0);
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma35
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      const double* i0data = in(0)->get_block_view(x3, x2, x1, x0);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, x2, x1, x0));
+      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: I100
-      std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x3.size(), x2.size());
+      const double* i1data = in(1)->get_block_view(c2, a1, x3, x2);
+      BlockBuffer i1data_sorted(in(1)->get_size(c2, a1, x3, x2));
+      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted.get(), c2.size(), a1.size(), x3.size(), x2.size());
       dgemm_("T", "N", x1.size()*x0.size(), c2.size()*a1.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+             1.0, i0data_sorted.get(), x3.size()*x2.size(), i1data_sorted.get(), x3.size()*x2.size(),
+             1.0, odata_sorted.get(), x1.size()*x0.size());
     }
   }
-  sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c2.size(), a1.size());
+  sort_indices<2,0,1,3,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size(), c2.size(), a1.size());
   out()->put_block(odata, c2, x1, x0, a1);
 }
 
@@ -518,17 +518,17 @@ void Task172::Task_local::compute() {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, x3, x2);
     dscal_(c2.size()*a1.size()*x3.size()*x2.size(), e0_, i0data.get(), 1);
-    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata, c2.size(), a1.size(), x3.size(), x2.size());
+    sort_indices<0,1,2,3,1,1,1,1>(i0data.get(), odata.get(), c2.size(), a1.size(), x3.size(), x2.size());
   }
   {
     // tensor label: v2
-    std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x3, x2);
-    sort_indices<0,1,2,3,1,1,-1,2>(i1data, odata, c2.size(), a1.size(), x3.size(), x2.size());
+    const double* i1data = in(1)->get_block_view(c2, a1, x3, x2);
+    sort_indices<0,1,2,3,1,1,-1,2>(i1data, odata.get(), c2.size(), a1.size(), x3.size(), x2.size());
   }
   {
     // tensor label: v2
-    std::unique_ptr<double[]> i2data = in(1)->get_block(x3, x2, c2, a1);
-    sort_indices<2,3,0,1,1,1,-1,2>(i2data, odata, x3.size(), x2.size(), c2.size(), a1.size());
+    const double* i2data = in(1)->get_block_view(x3, x2, c2, a1);
+    sort_indices<2,3,0,1,1,1,-1,2>(i2data, odata.get(), x3.size(), x2.size(), c2.size(), a1.size());
   }
   out()->put_block(odata, c2, a1, x3, x2);
 }
@@ -540,22 +540,22 @@ void Task173::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I100
   std::unique_ptr<double[]> odata = out()->move_block(c2, a1, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(c2, a1, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1, x3, x2), 0.0);
   for (auto& c3 : *range_[0]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a1, x3, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a1, x3, x2)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c3.size(), a1.size(), x3.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(c3, a1, x3, x2);
+    BlockBuffer i0data_sorted(in(0)->get_size(c3, a1, x3, x2));
+    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c3.size(), a1.size(), x3.size(), x2.size());
     // tensor label: I101
-    std::unique_ptr<double[]> i1data = in(1)->get_block(c2, c3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, c3)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, c2.size(), c3.size());
+    const double* i1data = in(1)->get_block_view(c2, c3);
+    BlockBuffer i1data_sorted(in(1)->get_size(c2, c3));
+    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), c2.size(), c3.size());
     dgemm_("T", "N", a1.size()*x3.size()*x2.size(), c2.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, a1.size()*x3.size()*x2.size());
+           1.0, i0data_sorted.get(), c3.size(), i1data_sorted.get(), c3.size(),
+           1.0, odata_sorted.get(), a1.size()*x3.size()*x2.size());
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, a1.size(), x3.size(), x2.size(), c2.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), a1.size(), x3.size(), x2.size(), c2.size());
   out()->put_block(odata, c2, a1, x3, x2);
 }
 
@@ -566,8 +566,8 @@ void Task174::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c2, c3);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c2, c3);
-    sort_indices<0,1,1,1,1,1>(i0data, odata, c2.size(), c3.size());
+    const double* i0data = in(0)->get_block_view(c2, c3);
+    sort_indices<0,1,1,1,1,1>(i0data, odata.get(), c2.size(), c3.size());
   }
   out()->put_block(odata, c2, c3);
 }
@@ -579,22 +579,22 @@ void Task175::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I100
   std::unique_ptr<double[]> odata = out()->move_block(c2, a1, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(c2, a1, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1, x3, x2), 0.0);
   for (auto& a3 : *range_[2]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a3, x3, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a3, x3, x2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a3.size(), x3.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(c2, a3, x3, x2);
+    BlockBuffer i0data_sorted(in(0)->get_size(c2, a3, x3, x2));
+    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c2.size(), a3.size(), x3.size(), x2.size());
     // tensor label: I104
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a3, a1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, a1)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a3.size(), a1.size());
+    const double* i1data = in(1)->get_block_view(a3, a1);
+    BlockBuffer i1data_sorted(in(1)->get_size(a3, a1));
+    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), a1.size());
     dgemm_("T", "N", c2.size()*x3.size()*x2.size(), a1.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, c2.size()*x3.size()*x2.size());
+           1.0, i0data_sorted.get(), a3.size(), i1data_sorted.get(), a3.size(),
+           1.0, odata_sorted.get(), c2.size()*x3.size()*x2.size());
   }
-  sort_indices<0,3,1,2,1,1,1,1>(odata_sorted, odata, c2.size(), x3.size(), x2.size(), a1.size());
+  sort_indices<0,3,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), c2.size(), x3.size(), x2.size(), a1.size());
   out()->put_block(odata, c2, a1, x3, x2);
 }
 
@@ -605,8 +605,8 @@ void Task176::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, a1);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a3, a1);
-    sort_indices<0,1,1,1,-1,1>(i0data, odata, a3.size(), a1.size());
+    const double* i0data = in(0)->get_block_view(a3, a1);
+    sort_indices<0,1,1,1,-1,1>(i0data, odata.get(), a3.size(), a1.size());
   }
   out()->put_block(odata, a3, a1);
 }
@@ -618,22 +618,22 @@ void Task177::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I100
   std::unique_ptr<double[]> odata = out()->move_block(c2, a1, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(c2, a1, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1, x3, x2), 0.0);
   for (auto& a3 : *range_[2]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a3, c2, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a3, c2, a1)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a3.size(), c2.size(), a1.size());
+    const double* i0data = in(0)->get_block_view(x3, a3, c2, a1);
+    BlockBuffer i0data_sorted(in(0)->get_size(x3, a3, c2, a1));
+    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a3.size(), c2.size(), a1.size());
     // tensor label: I116
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x2)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a3.size(), x2.size());
+    const double* i1data = in(1)->get_block_view(a3, x2);
+    BlockBuffer i1data_sorted(in(1)->get_size(a3, x2));
+    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), x2.size());
     dgemm_("T", "N", x3.size()*c2.size()*a1.size(), x2.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, x3.size()*c2.size()*a1.size());
+           1.0, i0data_sorted.get(), a3.size(), i1data_sorted.get(), a3.size(),
+           1.0, odata_sorted.get(), x3.size()*c2.size()*a1.size());
   }
-  sort_indices<1,2,0,3,1,1,1,1>(odata_sorted, odata, x3.size(), c2.size(), a1.size(), x2.size());
+  sort_indices<1,2,0,3,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), c2.size(), a1.size(), x2.size());
   out()->put_block(odata, c2, a1, x3, x2);
 }
 
@@ -644,8 +644,8 @@ void Task178::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, x2);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a3, x2);
-    sort_indices<0,1,1,1,-1,1>(i0data, odata, a3.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(a3, x2);
+    sort_indices<0,1,1,1,-1,1>(i0data, odata.get(), a3.size(), x2.size());
   }
   out()->put_block(odata, a3, x2);
 }
@@ -657,22 +657,22 @@ void Task179::Task_local::compute() {
   const Index a1 = b(3);
   // tensor label: I80
   std::unique_ptr<double[]> odata = out()->move_block(c2, x1, x0, a1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x0, a1)]);
+  BlockBuffer odata_sorted(out()->get_size(c2, x1, x0, a1));
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x0, a1), 0.0);
   for (auto& x2 : *range_[1]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c2, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, x2)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, c2.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(c2, x2);
+    BlockBuffer i0data_sorted(in(0)->get_size(c2, x2));
+    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted.get(), c2.size(), x2.size());
     // tensor label: I106
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a1, x0, x1, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, x0, x1, x2)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, a1.size(), x0.size(), x1.size(), x2.size());
+    const double* i1data = in(1)->get_block_view(a1, x0, x1, x2);
+    BlockBuffer i1data_sorted(in(1)->get_size(a1, x0, x1, x2));
+    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted.get(), a1.size(), x0.size(), x1.size(), x2.size());
     dgemm_("T", "N", c2.size(), a1.size()*x0.size()*x1.size(), x2.size(),
-           1.0, i0data_sorted, x2.size(), i1data_sorted, x2.size(),
-           1.0, odata_sorted, c2.size());
+           1.0, i0data_sorted.get(), x2.size(), i1data_sorted.get(), x2.size(),
+           1.0, odata_sorted.get(), c2.size());
   }
-  sort_indices<0,3,2,1,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), x0.size(), x1.size());
+  sort_indices<0,3,2,1,1,1,1,1>(odata_sorted.get(), odata.get(), c2.size(), a1.size(), x0.size(), x1.size());
   out()->put_block(odata, c2, x1, x0, a1);
 }
 
@@ -683,26 +683,26 @@ void Task180::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I106
   std::unique_ptr<double[]> odata = out()->move_block(a1, x0, x1, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x1, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(a1, x0, x1, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x1, x2), 0.0);
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma37
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x3, x1, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x3, x1, x2)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x3.size(), x1.size(), x2.size());
+        const double* i0data = in(0)->get_block_view(x5, x0, x4, x3, x1, x2);
+        BlockBuffer i0data_sorted(in(0)->get_size(x5, x0, x4, x3, x1, x2));
+        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), x0.size(), x4.size(), x3.size(), x1.size(), x2.size());
         // tensor label: I107
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a1, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a1, x4, x3)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted, x5.size(), a1.size(), x4.size(), x3.size());
+        const double* i1data = in(1)->get_block_view(x5, a1, x4, x3);
+        BlockBuffer i1data_sorted(in(1)->get_size(x5, a1, x4, x3));
+        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted.get(), x5.size(), a1.size(), x4.size(), x3.size());
         dgemm_("T", "N", x0.size()*x1.size()*x2.size(), a1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x0.size()*x1.size()*x2.size());
+               1.0, i0data_sorted.get(), x5.size()*x4.size()*x3.size(), i1data_sorted.get(), x5.size()*x4.size()*x3.size(),
+               1.0, odata_sorted.get(), x0.size()*x1.size()*x2.size());
       }
     }
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), a1.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), x2.size(), a1.size());
   out()->put_block(odata, a1, x0, x1, x2);
 }
 
@@ -715,8 +715,8 @@ void Task181::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x5, a1, x4, x3);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, x4, x3);
-    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata, x5.size(), a1.size(), x4.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(x5, a1, x4, x3);
+    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata.get(), x5.size(), a1.size(), x4.size(), x3.size());
   }
   out()->put_block(odata, x5, a1, x4, x3);
 }
@@ -728,20 +728,20 @@ void Task182::Task_local::compute() {
   const Index a1 = b(3);
   // tensor label: I80
   std::unique_ptr<double[]> odata = out()->move_block(c2, x1, x0, a1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x0, a1)]);
+  BlockBuffer odata_sorted(out()->get_size(c2, x1, x0, a1));
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x0, a1), 0.0);
   // tensor label: Gamma38
-  std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-  std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-  sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+  const double* i0data = in(0)->get_block_view(x1, x0);
+  BlockBuffer i0data_sorted(in(0)->get_size(x1, x0));
+  sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), x0.size());
   // tensor label: I109
-  std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1);
-  std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1)]);
-  sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size());
+  const double* i1data = in(1)->get_block_view(c2, a1);
+  BlockBuffer i1data_sorted(in(1)->get_size(c2, a1));
+  sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), c2.size(), a1.size());
   dgemm_("T", "N", x1.size()*x0.size(), c2.size()*a1.size(), 1,
-         1.0, i0data_sorted, 1, i1data_sorted, 1,
-         1.0, odata_sorted, x1.size()*x0.size());
-  sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c2.size(), a1.size());
+         1.0, i0data_sorted.get(), 1, i1data_sorted.get(), 1,
+         1.0, odata_sorted.get(), x1.size()*x0.size());
+  sort_indices<2,0,1,3,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size(), c2.size(), a1.size());
   out()->put_block(odata, c2, x1, x0, a1);
 }
 
@@ -752,8 +752,8 @@ void Task183::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c2, a1);
   {
     // tensor label: h1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1);
-    sort_indices<0,1,1,1,-1,1>(i0data, odata, c2.size(), a1.size());
+    const double* i0data = in(0)->get_block_view(c2, a1);
+    sort_indices<0,1,1,1,-1,1>(i0data, odata.get(), c2.size(), a1.size());
   }
   out()->put_block(odata, c2, a1);
 }
@@ -763,24 +763,24 @@ void Task184::Task_local::compute() {
   const Index a1 = b(1);
   // tensor label: I109
   std::unique_ptr<double[]> odata = out()->move_block(c2, a1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1)]);
+  BlockBuffer odata_sorted(out()->get_size(c2, a1));
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1), 0.0);
   for (auto& a4 : *range_[2]) {
     for (auto& c3 : *range_[0]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a4, c3, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a4, c3, a1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a4.size(), c3.size(), a1.size());
+      const double* i0data = in(0)->get_block_view(c2, a4, c3, a1);
+      BlockBuffer i0data_sorted(in(0)->get_size(c2, a4, c3, a1));
+      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted.get(), c2.size(), a4.size(), c3.size(), a1.size());
       // tensor label: I110
-      std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c3)]);
-      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a4.size(), c3.size());
+      const double* i1data = in(1)->get_block_view(a4, c3);
+      BlockBuffer i1data_sorted(in(1)->get_size(a4, c3));
+      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), c3.size());
       dgemm_("T", "N", c2.size()*a1.size(), 1, a4.size()*c3.size(),
-             1.0, i0data_sorted, a4.size()*c3.size(), i1data_sorted, a4.size()*c3.size(),
-             1.0, odata_sorted, c2.size()*a1.size());
+             1.0, i0data_sorted.get(), a4.size()*c3.size(), i1data_sorted.get(), a4.size()*c3.size(),
+             1.0, odata_sorted.get(), c2.size()*a1.size());
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), c2.size(), a1.size());
   out()->put_block(odata, c2, a1);
 }
 
@@ -791,8 +791,8 @@ void Task185::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a4, c3);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a4, c3);
-    sort_indices<0,1,1,1,2,1>(i0data, odata, a4.size(), c3.size());
+    const double* i0data = in(0)->get_block_view(a4, c3);
+    sort_indices<0,1,1,1,2,1>(i0data, odata.get(), a4.size(), c3.size());
   }
   out()->put_block(odata, a4, c3);
 }
@@ -802,24 +802,24 @@ void Task186::Task_local::compute() {
   const Index a1 = b(1);
   // tensor label: I109
   std::unique_ptr<double[]> odata = out()->move_block(c2, a1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1)]);
+  BlockBuffer odata_sorted(out()->get_size(c2, a1));
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1), 0.0);
   for (auto& c3 : *range_[0]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, c3, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1, c3, a4)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size(), c3.size(), a4.size());
+      const double* i0data = in(0)->get_block_view(c2, a1, c3, a4);
+      BlockBuffer i0data_sorted(in(0)->get_size(c2, a1, c3, a4));
+      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted.get(), c2.size(), a1.size(), c3.size(), a4.size());
       // tensor label: I113
-      std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c3)]);
-      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, a4.size(), c3.size());
+      const double* i1data = in(1)->get_block_view(a4, c3);
+      BlockBuffer i1data_sorted(in(1)->get_size(a4, c3));
+      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), c3.size());
       dgemm_("T", "N", c2.size()*a1.size(), 1, a4.size()*c3.size(),
-             1.0, i0data_sorted, a4.size()*c3.size(), i1data_sorted, a4.size()*c3.size(),
-             1.0, odata_sorted, c2.size()*a1.size());
+             1.0, i0data_sorted.get(), a4.size()*c3.size(), i1data_sorted.get(), a4.size()*c3.size(),
+             1.0, odata_sorted.get(), c2.size()*a1.size());
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), c2.size(), a1.size());
   out()->put_block(odata, c2, a1);
 }
 
@@ -830,8 +830,8 @@ void Task187::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a4, c3);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a4, c3);
-    sort_indices<0,1,1,1,-4,1>(i0data, odata, a4.size(), c3.size());
+    const double* i0data = in(0)->get_block_view(a4, c3);
+    sort_indices<0,1,1,1,-4,1>(i0data, odata.get(), a4.size(), c3.size());
   }
   out()->put_block(odata, a4, c3);
 }
@@ -845,8 +845,8 @@ void Task188::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x0, x1, c1, a2);
   {
     // tensor label: I120
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x1, x0, a2);
-    sort_indices<2,1,0,3,1,1,1,1>(i0data, odata, c1.size(), x1.size(), x0.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(c1, x1, x0, a2);
+    sort_indices<2,1,0,3,1,1,1,1>(i0data, odata.get(), c1.size(), x1.size(), x0.size(), a2.size());
   }
   out()->put_block(odata, x0, x1, c1, a2);
 }
@@ -858,22 +858,22 @@ void Task189::Task_local::compute() {
   const Index a2 = b(3);
   // tensor label: I120
   std::unique_ptr<double[]> odata = out()->move_block(c1, x1, x0, a2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x1, x0, a2)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, x1, x0, a2));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x1, x0, a2), 0.0);
   for (auto& x2 : *range_[1]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x2, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, a2)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x2.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(x2, a2);
+    BlockBuffer i0data_sorted(in(0)->get_size(x2, a2));
+    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), x2.size(), a2.size());
     // tensor label: I121
-    std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x2, x1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x2, x1, x0)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, c1.size(), x2.size(), x1.size(), x0.size());
+    const double* i1data = in(1)->get_block_view(c1, x2, x1, x0);
+    BlockBuffer i1data_sorted(in(1)->get_size(c1, x2, x1, x0));
+    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted.get(), c1.size(), x2.size(), x1.size(), x0.size());
     dgemm_("T", "N", a2.size(), c1.size()*x1.size()*x0.size(), x2.size(),
-           1.0, i0data_sorted, x2.size(), i1data_sorted, x2.size(),
-           1.0, odata_sorted, a2.size());
+           1.0, i0data_sorted.get(), x2.size(), i1data_sorted.get(), x2.size(),
+           1.0, odata_sorted.get(), a2.size());
   }
-  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a2.size(), c1.size(), x1.size(), x0.size());
+  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted.get(), odata.get(), a2.size(), c1.size(), x1.size(), x0.size());
   out()->put_block(odata, c1, x1, x0, a2);
 }
 
@@ -884,26 +884,26 @@ void Task190::Task_local::compute() {
   const Index x0 = b(3);
   // tensor label: I121
   std::unique_ptr<double[]> odata = out()->move_block(c1, x2, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x2, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, x2, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x2, x1, x0), 0.0);
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma6
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x2, x3, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x2, x3, x1, x0)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
+        const double* i0data = in(0)->get_block_view(x5, x4, x2, x3, x1, x0);
+        BlockBuffer i0data_sorted(in(0)->get_size(x5, x4, x2, x3, x1, x0));
+        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
         // tensor label: I122
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, c1, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, c1, x3)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted, x5.size(), x4.size(), c1.size(), x3.size());
+        const double* i1data = in(1)->get_block_view(x5, x4, c1, x3);
+        BlockBuffer i1data_sorted(in(1)->get_size(x5, x4, c1, x3));
+        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted.get(), x5.size(), x4.size(), c1.size(), x3.size());
         dgemm_("T", "N", x2.size()*x1.size()*x0.size(), c1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+               1.0, i0data_sorted.get(), x5.size()*x4.size()*x3.size(), i1data_sorted.get(), x5.size()*x4.size()*x3.size(),
+               1.0, odata_sorted.get(), x2.size()*x1.size()*x0.size());
       }
     }
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size(), x0.size(), c1.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x2.size(), x1.size(), x0.size(), c1.size());
   out()->put_block(odata, c1, x2, x1, x0);
 }
 
@@ -916,8 +916,8 @@ void Task191::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x5, x4, c1, x3);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, c1, x3);
-    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata, x5.size(), x4.size(), c1.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(x5, x4, c1, x3);
+    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata.get(), x5.size(), x4.size(), c1.size(), x3.size());
   }
   out()->put_block(odata, x5, x4, c1, x3);
 }
@@ -929,24 +929,24 @@ void Task192::Task_local::compute() {
   const Index a2 = b(3);
   // tensor label: I120
   std::unique_ptr<double[]> odata = out()->move_block(c1, x1, x0, a2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x1, x0, a2)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, x1, x0, a2));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x1, x0, a2), 0.0);
   for (auto& x2 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       // tensor label: Gamma7
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x3, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, x3, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x2.size(), x3.size(), x1.size(), x0.size());
+      const double* i0data = in(0)->get_block_view(x2, x3, x1, x0);
+      BlockBuffer i0data_sorted(in(0)->get_size(x2, x3, x1, x0));
+      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x2.size(), x3.size(), x1.size(), x0.size());
       // tensor label: I124
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x2, a2, c1, x3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, a2, c1, x3)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x2.size(), a2.size(), c1.size(), x3.size());
+      const double* i1data = in(1)->get_block_view(x2, a2, c1, x3);
+      BlockBuffer i1data_sorted(in(1)->get_size(x2, a2, c1, x3));
+      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), a2.size(), c1.size(), x3.size());
       dgemm_("T", "N", x1.size()*x0.size(), a2.size()*c1.size(), x2.size()*x3.size(),
-             1.0, i0data_sorted, x2.size()*x3.size(), i1data_sorted, x2.size()*x3.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+             1.0, i0data_sorted.get(), x2.size()*x3.size(), i1data_sorted.get(), x2.size()*x3.size(),
+             1.0, odata_sorted.get(), x1.size()*x0.size());
     }
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a2.size(), c1.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size(), a2.size(), c1.size());
   out()->put_block(odata, c1, x1, x0, a2);
 }
 
@@ -959,8 +959,8 @@ void Task193::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x2, a2, c1, x3);
   {
     // tensor label: v2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x3, x2, a2);
-    sort_indices<2,3,0,1,1,1,1,2>(i0data, odata, c1.size(), x3.size(), x2.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(c1, x3, x2, a2);
+    sort_indices<2,3,0,1,1,1,1,2>(i0data, odata.get(), c1.size(), x3.size(), x2.size(), a2.size());
   }
   out()->put_block(odata, x2, a2, c1, x3);
 }
@@ -972,22 +972,22 @@ void Task194::Task_local::compute() {
   const Index x3 = b(3);
   // tensor label: I124
   std::unique_ptr<double[]> odata = out()->move_block(x2, a2, c1, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, a2, c1, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(x2, a2, c1, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(x2, a2, c1, x3), 0.0);
   for (auto& c3 : *range_[0]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2, c1, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a2, c1, x3)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c3.size(), a2.size(), c1.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(c3, a2, c1, x3);
+    BlockBuffer i0data_sorted(in(0)->get_size(c3, a2, c1, x3));
+    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c3.size(), a2.size(), c1.size(), x3.size());
     // tensor label: I125
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c3)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, x2.size(), c3.size());
+    const double* i1data = in(1)->get_block_view(x2, c3);
+    BlockBuffer i1data_sorted(in(1)->get_size(x2, c3));
+    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), c3.size());
     dgemm_("T", "N", a2.size()*c1.size()*x3.size(), x2.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, a2.size()*c1.size()*x3.size());
+           1.0, i0data_sorted.get(), c3.size(), i1data_sorted.get(), c3.size(),
+           1.0, odata_sorted.get(), a2.size()*c1.size()*x3.size());
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, a2.size(), c1.size(), x3.size(), x2.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), a2.size(), c1.size(), x3.size(), x2.size());
   out()->put_block(odata, x2, a2, c1, x3);
 }
 
@@ -998,8 +998,8 @@ void Task195::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x2, c3);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x2, c3);
-    sort_indices<0,1,1,1,-1,1>(i0data, odata, x2.size(), c3.size());
+    const double* i0data = in(0)->get_block_view(x2, c3);
+    sort_indices<0,1,1,1,-1,1>(i0data, odata.get(), x2.size(), c3.size());
   }
   out()->put_block(odata, x2, c3);
 }
@@ -1011,22 +1011,22 @@ void Task196::Task_local::compute() {
   const Index x3 = b(3);
   // tensor label: I124
   std::unique_ptr<double[]> odata = out()->move_block(x2, a2, c1, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, a2, c1, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(x2, a2, c1, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(x2, a2, c1, x3), 0.0);
   for (auto& c3 : *range_[0]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, x3)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, x3);
+    BlockBuffer i0data_sorted(in(0)->get_size(c1, a2, c3, x3));
+    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size(), c3.size(), x3.size());
     // tensor label: I128
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c3)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, x2.size(), c3.size());
+    const double* i1data = in(1)->get_block_view(x2, c3);
+    BlockBuffer i1data_sorted(in(1)->get_size(x2, c3));
+    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), c3.size());
     dgemm_("T", "N", c1.size()*a2.size()*x3.size(), x2.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, c1.size()*a2.size()*x3.size());
+           1.0, i0data_sorted.get(), c3.size(), i1data_sorted.get(), c3.size(),
+           1.0, odata_sorted.get(), c1.size()*a2.size()*x3.size());
   }
-  sort_indices<3,1,0,2,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), x3.size(), x2.size());
+  sort_indices<3,1,0,2,1,1,1,1>(odata_sorted.get(), odata.get(), c1.size(), a2.size(), x3.size(), x2.size());
   out()->put_block(odata, x2, a2, c1, x3);
 }
 
@@ -1037,8 +1037,8 @@ void Task197::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x2, c3);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x2, c3);
-    sort_indices<0,1,1,1,2,1>(i0data, odata, x2.size(), c3.size());
+    const double* i0data = in(0)->get_block_view(x2, c3);
+    sort_indices<0,1,1,1,2,1>(i0data, odata.get(), x2.size(), c3.size());
   }
   out()->put_block(odata, x2, c3);
 }
@@ -1050,24 +1050,24 @@ void Task198::Task_local::compute() {
   const Index a2 = b(3);
   // tensor label: I120
   std::unique_ptr<double[]> odata = out()->move_block(c1, x1, x0, a2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x1, x0, a2)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, x1, x0, a2));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x1, x0, a2), 0.0);
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       // tensor label: Gamma34
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x1.size(), x0.size());
+      const double* i0data = in(0)->get_block_view(x5, x4, x1, x0);
+      BlockBuffer i0data_sorted(in(0)->get_size(x5, x4, x1, x0));
+      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), x4.size(), x1.size(), x0.size());
       // tensor label: I130
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a2, c1, x4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a2, c1, x4)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x5.size(), a2.size(), c1.size(), x4.size());
+      const double* i1data = in(1)->get_block_view(x5, a2, c1, x4);
+      BlockBuffer i1data_sorted(in(1)->get_size(x5, a2, c1, x4));
+      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted.get(), x5.size(), a2.size(), c1.size(), x4.size());
       dgemm_("T", "N", x1.size()*x0.size(), a2.size()*c1.size(), x5.size()*x4.size(),
-             1.0, i0data_sorted, x5.size()*x4.size(), i1data_sorted, x5.size()*x4.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+             1.0, i0data_sorted.get(), x5.size()*x4.size(), i1data_sorted.get(), x5.size()*x4.size(),
+             1.0, odata_sorted.get(), x1.size()*x0.size());
     }
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a2.size(), c1.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size(), a2.size(), c1.size());
   out()->put_block(odata, c1, x1, x0, a2);
 }
 
@@ -1080,13 +1080,13 @@ void Task199::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x5, a2, c1, x4);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a2, c1, x4);
-    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata, x5.size(), a2.size(), c1.size(), x4.size());
+    const double* i0data = in(0)->get_block_view(x5, a2, c1, x4);
+    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata.get(), x5.size(), a2.size(), c1.size(), x4.size());
   }
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i1data = in(0)->get_block(c1, a2, x5, x4);
-    sort_indices<2,1,0,3,1,1,2,1>(i1data, odata, c1.size(), a2.size(), x5.size(), x4.size());
+    const double* i1data = in(0)->get_block_view(c1, a2, x5, x4);
+    sort_indices<2,1,0,3,1,1,2,1>(i1data, odata.get(), c1.size(), a2.size(), x5.size(), x4.size());
   }
   out()->put_block(odata, x5, a2, c1, x4);
 }
@@ -40,24 +40,24 @@ void Task200::Task_local::compute() {
   const Index a2 = b(3);
   // tensor label: I120
   std::unique_ptr<double[]> odata = out()->move_block(c1, x1, x0, a2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x1, x0, a2)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, x1, x0, a2));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x1, x0, a2), 0.0);
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma35
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      const double* i0data = in(0)->get_block_view(x3, x2, x1, x0);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, x2, x1, x0));
+      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: I132
-      std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x3, a2, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x3, a2, x2)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i1data, i1data_sorted, c1.size(), x3.size(), a2.size(), x2.size());
+      const double* i1data = in(1)->get_block_view(c1, x3, a2, x2);
+      BlockBuffer i1data_sorted(in(1)->get_size(c1, x3, a2, x2));
+      sort_indices<1,3,0,2,0,1,1,1>(i1data, i1data_sorted.get(), c1.size(), x3.size(), a2.size(), x2.size());
       dgemm_("T", "N", x1.size()*x0.size(), c1.size()*a2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+             1.0, i0data_sorted.get(), x3.size()*x2.size(), i1data_sorted.get(), x3.size()*x2.size(),
+             1.0, odata_sorted.get(), x1.size()*x0.size());
     }
   }
-  sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c1.size(), a2.size());
+  sort_indices<2,0,1,3,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size(), c1.size(), a2.size());
   out()->put_block(odata, c1, x1, x0, a2);
 }
 
@@ -72,28 +72,28 @@ void Task201::Task_local::compute() {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a2, c1, x2);
     dscal_(x3.size()*a2.size()*c1.size()*x2.size(), e0_, i0data.get(), 1);
-    sort_indices<2,0,1,3,1,1,1,1>(i0data, odata, x3.size(), a2.size(), c1.size(), x2.size());
+    sort_indices<2,0,1,3,1,1,1,1>(i0data.get(), odata.get(), x3.size(), a2.size(), c1.size(), x2.size());
   }
   {
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(0)->get_block(c1, a2, x3, x2);
     dscal_(c1.size()*a2.size()*x3.size()*x2.size(), e0_, i1data.get(), 1);
-    sort_indices<0,2,1,3,1,1,-2,1>(i1data, odata, c1.size(), a2.size(), x3.size(), x2.size());
+    sort_indices<0,2,1,3,1,1,-2,1>(i1data.get(), odata.get(), c1.size(), a2.size(), x3.size(), x2.size());
   }
   {
     // tensor label: v2
-    std::unique_ptr<double[]> i2data = in(1)->get_block(c1, a2, x3, x2);
-    sort_indices<0,2,1,3,1,1,1,1>(i2data, odata, c1.size(), a2.size(), x3.size(), x2.size());
+    const double* i2data = in(1)->get_block_view(c1, a2, x3, x2);
+    sort_indices<0,2,1,3,1,1,1,1>(i2data, odata.get(), c1.size(), a2.size(), x3.size(), x2.size());
   }
   {
     // tensor label: v2
-    std::unique_ptr<double[]> i3data = in(1)->get_block(x3, a2, c1, x2);
-    sort_indices<2,0,1,3,1,1,-1,2>(i3data, odata, x3.size(), a2.size(), c1.size(), x2.size());
+    const double* i3data = in(1)->get_block_view(x3, a2, c1, x2);
+    sort_indices<2,0,1,3,1,1,-1,2>(i3data, odata.get(), x3.size(), a2.size(), c1.size(), x2.size());
   }
   {
     // tensor label: v2
-    std::unique_ptr<double[]> i4data = in(1)->get_block(x3, x2, c1, a2);
-    sort_indices<2,0,3,1,1,1,1,1>(i4data, odata, x3.size(), x2.size(), c1.size(), a2.size());
+    const double* i4data = in(1)->get_block_view(x3, x2, c1, a2);
+    sort_indices<2,0,3,1,1,1,1,1>(i4data, odata.get(), x3.size(), x2.size(), c1.size(), a2.size());
   }
   out()->put_block(odata, c1, x3, a2, x2);
 }
@@ -105,22 +105,22 @@ void Task202::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I132
   std::unique_ptr<double[]> odata = out()->move_block(c1, x3, a2, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x3, a2, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, x3, a2, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x3, a2, x2), 0.0);
   for (auto& c3 : *range_[0]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a2, c3, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a2, c3, x2)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a2.size(), c3.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x3, a2, c3, x2);
+    BlockBuffer i0data_sorted(in(0)->get_size(x3, a2, c3, x2));
+    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a2.size(), c3.size(), x2.size());
     // tensor label: I133
-    std::unique_ptr<double[]> i1data = in(1)->get_block(c1, c3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, c3)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, c1.size(), c3.size());
+    const double* i1data = in(1)->get_block_view(c1, c3);
+    BlockBuffer i1data_sorted(in(1)->get_size(c1, c3));
+    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), c1.size(), c3.size());
     dgemm_("T", "N", x3.size()*a2.size()*x2.size(), c1.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, x3.size()*a2.size()*x2.size());
+           1.0, i0data_sorted.get(), c3.size(), i1data_sorted.get(), c3.size(),
+           1.0, odata_sorted.get(), x3.size()*a2.size()*x2.size());
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x3.size(), a2.size(), x2.size(), c1.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), a2.size(), x2.size(), c1.size());
   out()->put_block(odata, c1, x3, a2, x2);
 }
 
@@ -131,8 +131,8 @@ void Task203::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c1, c3);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, c3);
-    sort_indices<0,1,1,1,1,1>(i0data, odata, c1.size(), c3.size());
+    const double* i0data = in(0)->get_block_view(c1, c3);
+    sort_indices<0,1,1,1,1,1>(i0data, odata.get(), c1.size(), c3.size());
   }
   out()->put_block(odata, c1, c3);
 }
@@ -144,22 +144,22 @@ void Task204::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I132
   std::unique_ptr<double[]> odata = out()->move_block(c1, x3, a2, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x3, a2, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, x3, a2, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x3, a2, x2), 0.0);
   for (auto& a3 : *range_[2]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a3, c1, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a3, c1, x2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a3.size(), c1.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x3, a3, c1, x2);
+    BlockBuffer i0data_sorted(in(0)->get_size(x3, a3, c1, x2));
+    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a3.size(), c1.size(), x2.size());
     // tensor label: I136
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a3, a2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, a2)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a3.size(), a2.size());
+    const double* i1data = in(1)->get_block_view(a3, a2);
+    BlockBuffer i1data_sorted(in(1)->get_size(a3, a2));
+    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), a2.size());
     dgemm_("T", "N", x3.size()*c1.size()*x2.size(), a2.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, x3.size()*c1.size()*x2.size());
+           1.0, i0data_sorted.get(), a3.size(), i1data_sorted.get(), a3.size(),
+           1.0, odata_sorted.get(), x3.size()*c1.size()*x2.size());
   }
-  sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, x3.size(), c1.size(), x2.size(), a2.size());
+  sort_indices<1,0,3,2,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), c1.size(), x2.size(), a2.size());
   out()->put_block(odata, c1, x3, a2, x2);
 }
 
@@ -170,8 +170,8 @@ void Task205::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, a2);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a3, a2);
-    sort_indices<0,1,1,1,-1,1>(i0data, odata, a3.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(a3, a2);
+    sort_indices<0,1,1,1,-1,1>(i0data, odata.get(), a3.size(), a2.size());
   }
   out()->put_block(odata, a3, a2);
 }
@@ -183,22 +183,22 @@ void Task206::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I132
   std::unique_ptr<double[]> odata = out()->move_block(c1, x3, a2, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x3, a2, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, x3, a2, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x3, a2, x2), 0.0);
   for (auto& c3 : *range_[0]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2, x3, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a2, x3, x2)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c3.size(), a2.size(), x3.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(c3, a2, x3, x2);
+    BlockBuffer i0data_sorted(in(0)->get_size(c3, a2, x3, x2));
+    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c3.size(), a2.size(), x3.size(), x2.size());
     // tensor label: I141
-    std::unique_ptr<double[]> i1data = in(1)->get_block(c1, c3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, c3)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, c1.size(), c3.size());
+    const double* i1data = in(1)->get_block_view(c1, c3);
+    BlockBuffer i1data_sorted(in(1)->get_size(c1, c3));
+    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), c1.size(), c3.size());
     dgemm_("T", "N", a2.size()*x3.size()*x2.size(), c1.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, a2.size()*x3.size()*x2.size());
+           1.0, i0data_sorted.get(), c3.size(), i1data_sorted.get(), c3.size(),
+           1.0, odata_sorted.get(), a2.size()*x3.size()*x2.size());
   }
-  sort_indices<3,1,0,2,1,1,1,1>(odata_sorted, odata, a2.size(), x3.size(), x2.size(), c1.size());
+  sort_indices<3,1,0,2,1,1,1,1>(odata_sorted.get(), odata.get(), a2.size(), x3.size(), x2.size(), c1.size());
   out()->put_block(odata, c1, x3, a2, x2);
 }
 
@@ -209,8 +209,8 @@ void Task207::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c1, c3);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, c3);
-    sort_indices<0,1,1,1,-2,1>(i0data, odata, c1.size(), c3.size());
+    const double* i0data = in(0)->get_block_view(c1, c3);
+    sort_indices<0,1,1,1,-2,1>(i0data, odata.get(), c1.size(), c3.size());
   }
   out()->put_block(odata, c1, c3);
 }
@@ -222,22 +222,22 @@ void Task208::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I132
   std::unique_ptr<double[]> odata = out()->move_block(c1, x3, a2, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x3, a2, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, x3, a2, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x3, a2, x2), 0.0);
   for (auto& a3 : *range_[2]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a3, x3, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a3, x3, x2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a3.size(), x3.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(c1, a3, x3, x2);
+    BlockBuffer i0data_sorted(in(0)->get_size(c1, a3, x3, x2));
+    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a3.size(), x3.size(), x2.size());
     // tensor label: I144
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a3, a2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, a2)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a3.size(), a2.size());
+    const double* i1data = in(1)->get_block_view(a3, a2);
+    BlockBuffer i1data_sorted(in(1)->get_size(a3, a2));
+    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), a2.size());
     dgemm_("T", "N", c1.size()*x3.size()*x2.size(), a2.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, c1.size()*x3.size()*x2.size());
+           1.0, i0data_sorted.get(), a3.size(), i1data_sorted.get(), a3.size(),
+           1.0, odata_sorted.get(), c1.size()*x3.size()*x2.size());
   }
-  sort_indices<0,1,3,2,1,1,1,1>(odata_sorted, odata, c1.size(), x3.size(), x2.size(), a2.size());
+  sort_indices<0,1,3,2,1,1,1,1>(odata_sorted.get(), odata.get(), c1.size(), x3.size(), x2.size(), a2.size());
   out()->put_block(odata, c1, x3, a2, x2);
 }
 
@@ -248,8 +248,8 @@ void Task209::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, a2);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a3, a2);
-    sort_indices<0,1,1,1,2,1>(i0data, odata, a3.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(a3, a2);
+    sort_indices<0,1,1,1,2,1>(i0data, odata.get(), a3.size(), a2.size());
   }
   out()->put_block(odata, a3, a2);
 }
@@ -261,22 +261,22 @@ void Task210::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I132
   std::unique_ptr<double[]> odata = out()->move_block(c1, x3, a2, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x3, a2, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, x3, a2, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x3, a2, x2), 0.0);
   for (auto& a3 : *range_[2]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a3, c1, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a3, c1, a2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a3.size(), c1.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(x3, a3, c1, a2);
+    BlockBuffer i0data_sorted(in(0)->get_size(x3, a3, c1, a2));
+    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a3.size(), c1.size(), a2.size());
     // tensor label: I156
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x2)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a3.size(), x2.size());
+    const double* i1data = in(1)->get_block_view(a3, x2);
+    BlockBuffer i1data_sorted(in(1)->get_size(a3, x2));
+    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), x2.size());
     dgemm_("T", "N", x3.size()*c1.size()*a2.size(), x2.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, x3.size()*c1.size()*a2.size());
+           1.0, i0data_sorted.get(), a3.size(), i1data_sorted.get(), a3.size(),
+           1.0, odata_sorted.get(), x3.size()*c1.size()*a2.size());
   }
-  sort_indices<1,0,2,3,1,1,1,1>(odata_sorted, odata, x3.size(), c1.size(), a2.size(), x2.size());
+  sort_indices<1,0,2,3,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), c1.size(), a2.size(), x2.size());
   out()->put_block(odata, c1, x3, a2, x2);
 }
 
@@ -287,8 +287,8 @@ void Task211::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, x2);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a3, x2);
-    sort_indices<0,1,1,1,2,1>(i0data, odata, a3.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(a3, x2);
+    sort_indices<0,1,1,1,2,1>(i0data, odata.get(), a3.size(), x2.size());
   }
   out()->put_block(odata, a3, x2);
 }
@@ -300,22 +300,22 @@ void Task212::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I132
   std::unique_ptr<double[]> odata = out()->move_block(c1, x3, a2, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x3, a2, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, x3, a2, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x3, a2, x2), 0.0);
   for (auto& a3 : *range_[2]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a2, c1, a3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a2, c1, a3)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), a2.size(), c1.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(x3, a2, c1, a3);
+    BlockBuffer i0data_sorted(in(0)->get_size(x3, a2, c1, a3));
+    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a2.size(), c1.size(), a3.size());
     // tensor label: I159
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x2)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a3.size(), x2.size());
+    const double* i1data = in(1)->get_block_view(a3, x2);
+    BlockBuffer i1data_sorted(in(1)->get_size(a3, x2));
+    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), x2.size());
     dgemm_("T", "N", x3.size()*a2.size()*c1.size(), x2.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, x3.size()*a2.size()*c1.size());
+           1.0, i0data_sorted.get(), a3.size(), i1data_sorted.get(), a3.size(),
+           1.0, odata_sorted.get(), x3.size()*a2.size()*c1.size());
   }
-  sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x3.size(), a2.size(), c1.size(), x2.size());
+  sort_indices<2,0,1,3,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), a2.size(), c1.size(), x2.size());
   out()->put_block(odata, c1, x3, a2, x2);
 }
 
@@ -326,8 +326,8 @@ void Task213::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, x2);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a3, x2);
-    sort_indices<0,1,1,1,-1,1>(i0data, odata, a3.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(a3, x2);
+    sort_indices<0,1,1,1,-1,1>(i0data, odata.get(), a3.size(), x2.size());
   }
   out()->put_block(odata, a3, x2);
 }
@@ -339,22 +339,22 @@ void Task214::Task_local::compute() {
   const Index a2 = b(3);
   // tensor label: I120
   std::unique_ptr<double[]> odata = out()->move_block(c1, x1, x0, a2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x1, x0, a2)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, x1, x0, a2));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x1, x0, a2), 0.0);
   for (auto& x2 : *range_[1]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x2)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, c1.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(c1, x2);
+    BlockBuffer i0data_sorted(in(0)->get_size(c1, x2));
+    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), x2.size());
     // tensor label: I146
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a2, x2, x1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, x2, x1, x0)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, a2.size(), x2.size(), x1.size(), x0.size());
+    const double* i1data = in(1)->get_block_view(a2, x2, x1, x0);
+    BlockBuffer i1data_sorted(in(1)->get_size(a2, x2, x1, x0));
+    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted.get(), a2.size(), x2.size(), x1.size(), x0.size());
     dgemm_("T", "N", c1.size(), a2.size()*x1.size()*x0.size(), x2.size(),
-           1.0, i0data_sorted, x2.size(), i1data_sorted, x2.size(),
-           1.0, odata_sorted, c1.size());
+           1.0, i0data_sorted.get(), x2.size(), i1data_sorted.get(), x2.size(),
+           1.0, odata_sorted.get(), c1.size());
   }
-  sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), x1.size(), x0.size());
+  sort_indices<0,2,3,1,1,1,1,1>(odata_sorted.get(), odata.get(), c1.size(), a2.size(), x1.size(), x0.size());
   out()->put_block(odata, c1, x1, x0, a2);
 }
 
@@ -365,26 +365,26 @@ void Task215::Task_local::compute() {
   const Index x0 = b(3);
   // tensor label: I146
   std::unique_ptr<double[]> odata = out()->move_block(a2, x2, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, x2, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(a2, x2, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(a2, x2, x1, x0), 0.0);
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma51
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x2, x4, x3, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x2, x4, x3, x1, x0)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x2.size(), x4.size(), x3.size(), x1.size(), x0.size());
+        const double* i0data = in(0)->get_block_view(x5, x2, x4, x3, x1, x0);
+        BlockBuffer i0data_sorted(in(0)->get_size(x5, x2, x4, x3, x1, x0));
+        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), x2.size(), x4.size(), x3.size(), x1.size(), x0.size());
         // tensor label: I147
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a2, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a2, x4, x3)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted, x5.size(), a2.size(), x4.size(), x3.size());
+        const double* i1data = in(1)->get_block_view(x5, a2, x4, x3);
+        BlockBuffer i1data_sorted(in(1)->get_size(x5, a2, x4, x3));
+        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted.get(), x5.size(), a2.size(), x4.size(), x3.size());
         dgemm_("T", "N", x2.size()*x1.size()*x0.size(), a2.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+               1.0, i0data_sorted.get(), x5.size()*x4.size()*x3.size(), i1data_sorted.get(), x5.size()*x4.size()*x3.size(),
+               1.0, odata_sorted.get(), x2.size()*x1.size()*x0.size());
       }
     }
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size(), x0.size(), a2.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x2.size(), x1.size(), x0.size(), a2.size());
   out()->put_block(odata, a2, x2, x1, x0);
 }
 
@@ -397,8 +397,8 @@ void Task216::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x5, a2, x4, x3);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a2, x4, x3);
-    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata, x5.size(), a2.size(), x4.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(x5, a2, x4, x3);
+    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata.get(), x5.size(), a2.size(), x4.size(), x3.size());
   }
   out()->put_block(odata, x5, a2, x4, x3);
 }
@@ -410,20 +410,20 @@ void Task217::Task_local::compute() {
   const Index a2 = b(3);
   // tensor label: I120
   std::unique_ptr<double[]> odata = out()->move_block(c1, x1, x0, a2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x1, x0, a2)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, x1, x0, a2));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x1, x0, a2), 0.0);
   // tensor label: Gamma38
-  std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-  std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-  sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+  const double* i0data = in(0)->get_block_view(x1, x0);
+  BlockBuffer i0data_sorted(in(0)->get_size(x1, x0));
+  sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), x0.size());
   // tensor label: I149
-  std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2);
-  std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2)]);
-  sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, c1.size(), a2.size());
+  const double* i1data = in(1)->get_block_view(c1, a2);
+  BlockBuffer i1data_sorted(in(1)->get_size(c1, a2));
+  sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), c1.size(), a2.size());
   dgemm_("T", "N", x1.size()*x0.size(), c1.size()*a2.size(), 1,
-         1.0, i0data_sorted, 1, i1data_sorted, 1,
-         1.0, odata_sorted, x1.size()*x0.size());
-  sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c1.size(), a2.size());
+         1.0, i0data_sorted.get(), 1, i1data_sorted.get(), 1,
+         1.0, odata_sorted.get(), x1.size()*x0.size());
+  sort_indices<2,0,1,3,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size(), c1.size(), a2.size());
   out()->put_block(odata, c1, x1, x0, a2);
 }
 
@@ -434,8 +434,8 @@ void Task218::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c1, a2);
   {
     // tensor label: h1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2);
-    sort_indices<0,1,1,1,2,1>(i0data, odata, c1.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(c1, a2);
+    sort_indices<0,1,1,1,2,1>(i0data, odata.get(), c1.size(), a2.size());
   }
   out()->put_block(odata, c1, a2);
 }
@@ -445,24 +445,24 @@ void Task219::Task_local::compute() {
   const Index a2 = b(1);
   // tensor label: I149
   std::unique_ptr<double[]> odata = out()->move_block(c1, a2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, a2)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, a2));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, a2), 0.0);
   for (auto& a4 : *range_[2]) {
     for (auto& c3 : *range_[0]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a4, c3, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a4, c3, a2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a4.size(), c3.size(), a2.size());
+      const double* i0data = in(0)->get_block_view(c1, a4, c3, a2);
+      BlockBuffer i0data_sorted(in(0)->get_size(c1, a4, c3, a2));
+      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a4.size(), c3.size(), a2.size());
       // tensor label: I150
-      std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c3)]);
-      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a4.size(), c3.size());
+      const double* i1data = in(1)->get_block_view(a4, c3);
+      BlockBuffer i1data_sorted(in(1)->get_size(a4, c3));
+      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), c3.size());
       dgemm_("T", "N", c1.size()*a2.size(), 1, a4.size()*c3.size(),
-             1.0, i0data_sorted, a4.size()*c3.size(), i1data_sorted, a4.size()*c3.size(),
-             1.0, odata_sorted, c1.size()*a2.size());
+             1.0, i0data_sorted.get(), a4.size()*c3.size(), i1data_sorted.get(), a4.size()*c3.size(),
+             1.0, odata_sorted.get(), c1.size()*a2.size());
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), c1.size(), a2.size());
   out()->put_block(odata, c1, a2);
 }
 
@@ -473,8 +473,8 @@ void Task220::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a4, c3);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a4, c3);
-    sort_indices<0,1,1,1,-4,1>(i0data, odata, a4.size(), c3.size());
+    const double* i0data = in(0)->get_block_view(a4, c3);
+    sort_indices<0,1,1,1,-4,1>(i0data, odata.get(), a4.size(), c3.size());
   }
   out()->put_block(odata, a4, c3);
 }
@@ -484,24 +484,24 @@ void Task221::Task_local::compute() {
   const Index a2 = b(1);
   // tensor label: I149
   std::unique_ptr<double[]> odata = out()->move_block(c1, a2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, a2)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, a2));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, a2), 0.0);
   for (auto& c3 : *range_[0]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, a4)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
+      const double* i0data = in(0)->get_block_view(c1, a2, c3, a4);
+      BlockBuffer i0data_sorted(in(0)->get_size(c1, a2, c3, a4));
+      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size(), c3.size(), a4.size());
       // tensor label: I153
-      std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c3)]);
-      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, a4.size(), c3.size());
+      const double* i1data = in(1)->get_block_view(a4, c3);
+      BlockBuffer i1data_sorted(in(1)->get_size(a4, c3));
+      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), c3.size());
       dgemm_("T", "N", c1.size()*a2.size(), 1, a4.size()*c3.size(),
-             1.0, i0data_sorted, a4.size()*c3.size(), i1data_sorted, a4.size()*c3.size(),
-             1.0, odata_sorted, c1.size()*a2.size());
+             1.0, i0data_sorted.get(), a4.size()*c3.size(), i1data_sorted.get(), a4.size()*c3.size(),
+             1.0, odata_sorted.get(), c1.size()*a2.size());
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), c1.size(), a2.size());
   out()->put_block(odata, c1, a2);
 }
 
@@ -512,8 +512,8 @@ void Task222::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a4, c3);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a4, c3);
-    sort_indices<0,1,1,1,8,1>(i0data, odata, a4.size(), c3.size());
+    const double* i0data = in(0)->get_block_view(a4, c3);
+    sort_indices<0,1,1,1,8,1>(i0data, odata.get(), a4.size(), c3.size());
   }
   out()->put_block(odata, a4, c3);
 }
@@ -527,8 +527,8 @@ void Task223::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, x2, x0, a1);
   {
     // tensor label: I160
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a1, x0, x2, x1);
-    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata, a1.size(), x0.size(), x2.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(a1, x0, x2, x1);
+    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata.get(), a1.size(), x0.size(), x2.size(), x1.size());
   }
   out()->put_block(odata, x1, x2, x0, a1);
 }
@@ -540,26 +540,26 @@ void Task224::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I160
   std::unique_ptr<double[]> odata = out()->move_block(a1, x0, x2, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x2, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(a1, x0, x2, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x2, x1), 0.0);
   for (auto& x5 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x4 : *range_[1]) {
         // tensor label: Gamma56
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x3, x4, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x3, x4, x2, x1)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x3.size(), x4.size(), x2.size(), x1.size());
+        const double* i0data = in(0)->get_block_view(x5, x0, x3, x4, x2, x1);
+        BlockBuffer i0data_sorted(in(0)->get_size(x5, x0, x3, x4, x2, x1));
+        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), x0.size(), x3.size(), x4.size(), x2.size(), x1.size());
         // tensor label: I161
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x5, a1, x4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x5, a1, x4)]);
-        sort_indices<1,0,3,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), x5.size(), a1.size(), x4.size());
+        const double* i1data = in(1)->get_block_view(x3, x5, a1, x4);
+        BlockBuffer i1data_sorted(in(1)->get_size(x3, x5, a1, x4));
+        sort_indices<1,0,3,2,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), x5.size(), a1.size(), x4.size());
         dgemm_("T", "N", x0.size()*x2.size()*x1.size(), a1.size(), x3.size()*x5.size()*x4.size(),
-               1.0, i0data_sorted, x3.size()*x5.size()*x4.size(), i1data_sorted, x3.size()*x5.size()*x4.size(),
-               1.0, odata_sorted, x0.size()*x2.size()*x1.size());
+               1.0, i0data_sorted.get(), x3.size()*x5.size()*x4.size(), i1data_sorted.get(), x3.size()*x5.size()*x4.size(),
+               1.0, odata_sorted.get(), x0.size()*x2.size()*x1.size());
       }
     }
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x2.size(), x1.size(), a1.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x2.size(), x1.size(), a1.size());
   out()->put_block(odata, a1, x0, x2, x1);
 }
 
@@ -570,22 +570,22 @@ void Task225::Task_local::compute() {
   const Index x4 = b(3);
   // tensor label: I161
   std::unique_ptr<double[]> odata = out()->move_block(x3, x5, a1, x4);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x5, a1, x4)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, x5, a1, x4));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x5, a1, x4), 0.0);
   for (auto& c2 : *range_[0]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, c2, x4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a1, c2, x4)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), a1.size(), c2.size(), x4.size());
+    const double* i0data = in(0)->get_block_view(x5, a1, c2, x4);
+    BlockBuffer i0data_sorted(in(0)->get_size(x5, a1, c2, x4));
+    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), a1.size(), c2.size(), x4.size());
     // tensor label: I162
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x3, c2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, c2)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, x3.size(), c2.size());
+    const double* i1data = in(1)->get_block_view(x3, c2);
+    BlockBuffer i1data_sorted(in(1)->get_size(x3, c2));
+    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), c2.size());
     dgemm_("T", "N", x5.size()*a1.size()*x4.size(), x3.size(), c2.size(),
-           1.0, i0data_sorted, c2.size(), i1data_sorted, c2.size(),
-           1.0, odata_sorted, x5.size()*a1.size()*x4.size());
+           1.0, i0data_sorted.get(), c2.size(), i1data_sorted.get(), c2.size(),
+           1.0, odata_sorted.get(), x5.size()*a1.size()*x4.size());
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), a1.size(), x4.size(), x3.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x5.size(), a1.size(), x4.size(), x3.size());
   out()->put_block(odata, x3, x5, a1, x4);
 }
 
@@ -596,8 +596,8 @@ void Task226::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x3, c2);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, c2);
-    sort_indices<0,1,1,1,1,1>(i0data, odata, x3.size(), c2.size());
+    const double* i0data = in(0)->get_block_view(x3, c2);
+    sort_indices<0,1,1,1,1,1>(i0data, odata.get(), x3.size(), c2.size());
   }
   out()->put_block(odata, x3, c2);
 }
@@ -609,26 +609,26 @@ void Task227::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I160
   std::unique_ptr<double[]> odata = out()->move_block(a1, x0, x2, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x2, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(a1, x0, x2, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x2, x1), 0.0);
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma57
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x3, x0, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x3, x0, x2, x1)]);
-        sort_indices<0,1,2,3,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x3.size(), x0.size(), x2.size(), x1.size());
+        const double* i0data = in(0)->get_block_view(x5, x4, x3, x0, x2, x1);
+        BlockBuffer i0data_sorted(in(0)->get_size(x5, x4, x3, x0, x2, x1));
+        sort_indices<0,1,2,3,4,5,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), x4.size(), x3.size(), x0.size(), x2.size(), x1.size());
         // tensor label: I164
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, x5, x4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, x5, x4)]);
-        sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, x3.size(), a1.size(), x5.size(), x4.size());
+        const double* i1data = in(1)->get_block_view(x3, a1, x5, x4);
+        BlockBuffer i1data_sorted(in(1)->get_size(x3, a1, x5, x4));
+        sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), a1.size(), x5.size(), x4.size());
         dgemm_("T", "N", x0.size()*x2.size()*x1.size(), a1.size(), x3.size()*x5.size()*x4.size(),
-               1.0, i0data_sorted, x3.size()*x5.size()*x4.size(), i1data_sorted, x3.size()*x5.size()*x4.size(),
-               1.0, odata_sorted, x0.size()*x2.size()*x1.size());
+               1.0, i0data_sorted.get(), x3.size()*x5.size()*x4.size(), i1data_sorted.get(), x3.size()*x5.size()*x4.size(),
+               1.0, odata_sorted.get(), x0.size()*x2.size()*x1.size());
       }
     }
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x2.size(), x1.size(), a1.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x2.size(), x1.size(), a1.size());
   out()->put_block(odata, a1, x0, x2, x1);
 }
 
@@ -641,8 +641,8 @@ void Task228::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x3, a1, x5, x4);
   {
     // tensor label: v2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x3, a1);
-    sort_indices<2,3,0,1,1,1,1,2>(i0data, odata, x5.size(), x4.size(), x3.size(), a1.size());
+    const double* i0data = in(0)->get_block_view(x5, x4, x3, a1);
+    sort_indices<2,3,0,1,1,1,1,2>(i0data, odata.get(), x5.size(), x4.size(), x3.size(), a1.size());
   }
   out()->put_block(odata, x3, a1, x5, x4);
 }
@@ -654,22 +654,22 @@ void Task229::Task_local::compute() {
   const Index x4 = b(3);
   // tensor label: I164
   std::unique_ptr<double[]> odata = out()->move_block(x3, a1, x5, x4);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, a1, x5, x4)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, a1, x5, x4));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, a1, x5, x4), 0.0);
   for (auto& c2 : *range_[0]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, x5, x4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1, x5, x4)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size(), x5.size(), x4.size());
+    const double* i0data = in(0)->get_block_view(c2, a1, x5, x4);
+    BlockBuffer i0data_sorted(in(0)->get_size(c2, a1, x5, x4));
+    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c2.size(), a1.size(), x5.size(), x4.size());
     // tensor label: I165
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x3, c2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, c2)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, x3.size(), c2.size());
+    const double* i1data = in(1)->get_block_view(x3, c2);
+    BlockBuffer i1data_sorted(in(1)->get_size(x3, c2));
+    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), c2.size());
     dgemm_("T", "N", a1.size()*x5.size()*x4.size(), x3.size(), c2.size(),
-           1.0, i0data_sorted, c2.size(), i1data_sorted, c2.size(),
-           1.0, odata_sorted, a1.size()*x5.size()*x4.size());
+           1.0, i0data_sorted.get(), c2.size(), i1data_sorted.get(), c2.size(),
+           1.0, odata_sorted.get(), a1.size()*x5.size()*x4.size());
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, a1.size(), x5.size(), x4.size(), x3.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), a1.size(), x5.size(), x4.size(), x3.size());
   out()->put_block(odata, x3, a1, x5, x4);
 }
 
@@ -680,8 +680,8 @@ void Task230::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x3, c2);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, c2);
-    sort_indices<0,1,1,1,-1,1>(i0data, odata, x3.size(), c2.size());
+    const double* i0data = in(0)->get_block_view(x3, c2);
+    sort_indices<0,1,1,1,-1,1>(i0data, odata.get(), x3.size(), c2.size());
   }
   out()->put_block(odata, x3, c2);
 }
@@ -693,26 +693,26 @@ void Task231::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I160
   std::unique_ptr<double[]> odata = out()->move_block(a1, x0, x2, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x2, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(a1, x0, x2, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x2, x1), 0.0);
   for (auto& x7 : *range_[1]) {
     for (auto& x6 : *range_[1]) {
       for (auto& x5 : *range_[1]) {
         // tensor label: Gamma58
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x0, x6, x5, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, x0, x6, x5, x2, x1)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x7.size(), x0.size(), x6.size(), x5.size(), x2.size(), x1.size());
+        const double* i0data = in(0)->get_block_view(x7, x0, x6, x5, x2, x1);
+        BlockBuffer i0data_sorted(in(0)->get_size(x7, x0, x6, x5, x2, x1));
+        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted.get(), x7.size(), x0.size(), x6.size(), x5.size(), x2.size(), x1.size());
         // tensor label: I167
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x7, a1, x6, x5);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x7, a1, x6, x5)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted, x7.size(), a1.size(), x6.size(), x5.size());
+        const double* i1data = in(1)->get_block_view(x7, a1, x6, x5);
+        BlockBuffer i1data_sorted(in(1)->get_size(x7, a1, x6, x5));
+        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted.get(), x7.size(), a1.size(), x6.size(), x5.size());
         dgemm_("T", "N", x0.size()*x2.size()*x1.size(), a1.size(), x7.size()*x6.size()*x5.size(),
-               1.0, i0data_sorted, x7.size()*x6.size()*x5.size(), i1data_sorted, x7.size()*x6.size()*x5.size(),
-               1.0, odata_sorted, x0.size()*x2.size()*x1.size());
+               1.0, i0data_sorted.get(), x7.size()*x6.size()*x5.size(), i1data_sorted.get(), x7.size()*x6.size()*x5.size(),
+               1.0, odata_sorted.get(), x0.size()*x2.size()*x1.size());
       }
     }
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x2.size(), x1.size(), a1.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x2.size(), x1.size(), a1.size());
   out()->put_block(odata, a1, x0, x2, x1);
 }
 
@@ -725,8 +725,8 @@ void Task232::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x7, a1, x6, x5);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x7, a1, x6, x5);
-    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata, x7.size(), a1.size(), x6.size(), x5.size());
+    const double* i0data = in(0)->get_block_view(x7, a1, x6, x5);
+    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata.get(), x7.size(), a1.size(), x6.size(), x5.size());
   }
   out()->put_block(odata, x7, a1, x6, x5);
 }
@@ -738,26 +738,26 @@ void Task233::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I160
   std::unique_ptr<double[]> odata = out()->move_block(a1, x0, x2, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x2, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(a1, x0, x2, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x2, x1), 0.0);
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma59
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x3, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x3, x2, x1)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
+        const double* i0data = in(0)->get_block_view(x5, x0, x4, x3, x2, x1);
+        BlockBuffer i0data_sorted(in(0)->get_size(x5, x0, x4, x3, x2, x1));
+        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
         // tensor label: I169
-        std::unique_ptr<double[]> i1data = in(1)->get_block(a1, x5, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, x5, x4, x3)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted, a1.size(), x5.size(), x4.size(), x3.size());
+        const double* i1data = in(1)->get_block_view(a1, x5, x4, x3);
+        BlockBuffer i1data_sorted(in(1)->get_size(a1, x5, x4, x3));
+        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted.get(), a1.size(), x5.size(), x4.size(), x3.size());
         dgemm_("T", "N", x0.size()*x2.size()*x1.size(), a1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x0.size()*x2.size()*x1.size());
+               1.0, i0data_sorted.get(), x5.size()*x4.size()*x3.size(), i1data_sorted.get(), x5.size()*x4.size()*x3.size(),
+               1.0, odata_sorted.get(), x0.size()*x2.size()*x1.size());
       }
     }
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x2.size(), x1.size(), a1.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x2.size(), x1.size(), a1.size());
   out()->put_block(odata, a1, x0, x2, x1);
 }
 
@@ -772,12 +772,12 @@ void Task234::Task_local::compute() {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, x4, x3);
     dscal_(x5.size()*a1.size()*x4.size()*x3.size(), e0_, i0data.get(), 1);
-    sort_indices<1,0,2,3,1,1,-1,1>(i0data, odata, x5.size(), a1.size(), x4.size(), x3.size());
+    sort_indices<1,0,2,3,1,1,-1,1>(i0data.get(), odata.get(), x5.size(), a1.size(), x4.size(), x3.size());
   }
   {
     // tensor label: v2
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a1, x4, x3);
-    sort_indices<1,0,2,3,1,1,1,2>(i1data, odata, x5.size(), a1.size(), x4.size(), x3.size());
+    const double* i1data = in(1)->get_block_view(x5, a1, x4, x3);
+    sort_indices<1,0,2,3,1,1,1,2>(i1data, odata.get(), x5.size(), a1.size(), x4.size(), x3.size());
   }
   out()->put_block(odata, a1, x5, x4, x3);
 }
@@ -789,22 +789,22 @@ void Task235::Task_local::compute() {
   const Index x3 = b(3);
   // tensor label: I169
   std::unique_ptr<double[]> odata = out()->move_block(a1, x5, x4, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x5, x4, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(a1, x5, x4, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x5, x4, x3), 0.0);
   for (auto& a2 : *range_[2]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a2, x4, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a2, x4, x3)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), a2.size(), x4.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(x5, a2, x4, x3);
+    BlockBuffer i0data_sorted(in(0)->get_size(x5, a2, x4, x3));
+    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), a2.size(), x4.size(), x3.size());
     // tensor label: I170
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a2, a1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, a1)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a2.size(), a1.size());
+    const double* i1data = in(1)->get_block_view(a2, a1);
+    BlockBuffer i1data_sorted(in(1)->get_size(a2, a1));
+    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a2.size(), a1.size());
     dgemm_("T", "N", x5.size()*x4.size()*x3.size(), a1.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, x5.size()*x4.size()*x3.size());
+           1.0, i0data_sorted.get(), a2.size(), i1data_sorted.get(), a2.size(),
+           1.0, odata_sorted.get(), x5.size()*x4.size()*x3.size());
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), a1.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x5.size(), x4.size(), x3.size(), a1.size());
   out()->put_block(odata, a1, x5, x4, x3);
 }
 
@@ -815,8 +815,8 @@ void Task236::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a2, a1);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a2, a1);
-    sort_indices<0,1,1,1,1,1>(i0data, odata, a2.size(), a1.size());
+    const double* i0data = in(0)->get_block_view(a2, a1);
+    sort_indices<0,1,1,1,1,1>(i0data, odata.get(), a2.size(), a1.size());
   }
   out()->put_block(odata, a2, a1);
 }
@@ -828,22 +828,22 @@ void Task237::Task_local::compute() {
   const Index x3 = b(3);
   // tensor label: I169
   std::unique_ptr<double[]> odata = out()->move_block(a1, x5, x4, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x5, x4, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(a1, x5, x4, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x5, x4, x3), 0.0);
   for (auto& a2 : *range_[2]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, x4, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a1, x4, a2)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, x5.size(), a1.size(), x4.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(x5, a1, x4, a2);
+    BlockBuffer i0data_sorted(in(0)->get_size(x5, a1, x4, a2));
+    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), a1.size(), x4.size(), a2.size());
     // tensor label: I179
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a2, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, x3)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a2.size(), x3.size());
+    const double* i1data = in(1)->get_block_view(a2, x3);
+    BlockBuffer i1data_sorted(in(1)->get_size(a2, x3));
+    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a2.size(), x3.size());
     dgemm_("T", "N", x5.size()*a1.size()*x4.size(), x3.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, x5.size()*a1.size()*x4.size());
+           1.0, i0data_sorted.get(), a2.size(), i1data_sorted.get(), a2.size(),
+           1.0, odata_sorted.get(), x5.size()*a1.size()*x4.size());
   }
-  sort_indices<1,0,2,3,1,1,1,1>(odata_sorted, odata, x5.size(), a1.size(), x4.size(), x3.size());
+  sort_indices<1,0,2,3,1,1,1,1>(odata_sorted.get(), odata.get(), x5.size(), a1.size(), x4.size(), x3.size());
   out()->put_block(odata, a1, x5, x4, x3);
 }
 
@@ -854,8 +854,8 @@ void Task238::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a2, x3);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a2, x3);
-    sort_indices<0,1,1,1,2,1>(i0data, odata, a2.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(a2, x3);
+    sort_indices<0,1,1,1,2,1>(i0data, odata.get(), a2.size(), x3.size());
   }
   out()->put_block(odata, a2, x3);
 }
@@ -867,22 +867,22 @@ void Task239::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I160
   std::unique_ptr<double[]> odata = out()->move_block(a1, x0, x2, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x2, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(a1, x0, x2, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x2, x1), 0.0);
   for (auto& x3 : *range_[1]) {
     // tensor label: Gamma60
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x3, x0, x2, x1);
+    BlockBuffer i0data_sorted(in(0)->get_size(x3, x0, x2, x1));
+    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x0.size(), x2.size(), x1.size());
     // tensor label: I172
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, x3.size(), a1.size());
+    const double* i1data = in(1)->get_block_view(x3, a1);
+    BlockBuffer i1data_sorted(in(1)->get_size(x3, a1));
+    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), a1.size());
     dgemm_("T", "N", x0.size()*x2.size()*x1.size(), a1.size(), x3.size(),
-           1.0, i0data_sorted, x3.size(), i1data_sorted, x3.size(),
-           1.0, odata_sorted, x0.size()*x2.size()*x1.size());
+           1.0, i0data_sorted.get(), x3.size(), i1data_sorted.get(), x3.size(),
+           1.0, odata_sorted.get(), x0.size()*x2.size()*x1.size());
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x2.size(), x1.size(), a1.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x2.size(), x1.size(), a1.size());
   out()->put_block(odata, a1, x0, x2, x1);
 }
 
@@ -893,8 +893,8 @@ void Task240::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x3, a1);
   {
     // tensor label: h1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1);
-    sort_indices<0,1,1,1,1,1>(i0data, odata, x3.size(), a1.size());
+    const double* i0data = in(0)->get_block_view(x3, a1);
+    sort_indices<0,1,1,1,1,1>(i0data, odata.get(), x3.size(), a1.size());
   }
   out()->put_block(odata, x3, a1);
 }
@@ -904,24 +904,24 @@ void Task241::Task_local::compute() {
   const Index a1 = b(1);
   // tensor label: I172
   std::unique_ptr<double[]> odata = out()->move_block(x3, a1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, a1)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, a1));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, a1), 0.0);
   for (auto& a3 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a3, c2, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a3, c2, a1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a3.size(), c2.size(), a1.size());
+      const double* i0data = in(0)->get_block_view(x3, a3, c2, a1);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, a3, c2, a1));
+      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a3.size(), c2.size(), a1.size());
       // tensor label: I173
-      std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2)]);
-      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size());
+      const double* i1data = in(1)->get_block_view(a3, c2);
+      BlockBuffer i1data_sorted(in(1)->get_size(a3, c2));
+      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), c2.size());
       dgemm_("T", "N", x3.size()*a1.size(), 1, a3.size()*c2.size(),
-             1.0, i0data_sorted, a3.size()*c2.size(), i1data_sorted, a3.size()*c2.size(),
-             1.0, odata_sorted, x3.size()*a1.size());
+             1.0, i0data_sorted.get(), a3.size()*c2.size(), i1data_sorted.get(), a3.size()*c2.size(),
+             1.0, odata_sorted.get(), x3.size()*a1.size());
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x3.size(), a1.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), a1.size());
   out()->put_block(odata, x3, a1);
 }
 
@@ -932,8 +932,8 @@ void Task242::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a3, c2);
-    sort_indices<0,1,1,1,-1,1>(i0data, odata, a3.size(), c2.size());
+    const double* i0data = in(0)->get_block_view(a3, c2);
+    sort_indices<0,1,1,1,-1,1>(i0data, odata.get(), a3.size(), c2.size());
   }
   out()->put_block(odata, a3, c2);
 }
@@ -943,24 +943,24 @@ void Task243::Task_local::compute() {
   const Index a1 = b(1);
   // tensor label: I172
   std::unique_ptr<double[]> odata = out()->move_block(x3, a1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, a1)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, a1));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, a1), 0.0);
   for (auto& c2 : *range_[0]) {
     for (auto& a3 : *range_[2]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, c2, a3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, c2, a3)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), c2.size(), a3.size());
+      const double* i0data = in(0)->get_block_view(x3, a1, c2, a3);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, a1, c2, a3));
+      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a1.size(), c2.size(), a3.size());
       // tensor label: I176
-      std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2)]);
-      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size());
+      const double* i1data = in(1)->get_block_view(a3, c2);
+      BlockBuffer i1data_sorted(in(1)->get_size(a3, c2));
+      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), c2.size());
       dgemm_("T", "N", x3.size()*a1.size(), 1, a3.size()*c2.size(),
-             1.0, i0data_sorted, a3.size()*c2.size(), i1data_sorted, a3.size()*c2.size(),
-             1.0, odata_sorted, x3.size()*a1.size());
+             1.0, i0data_sorted.get(), a3.size()*c2.size(), i1data_sorted.get(), a3.size()*c2.size(),
+             1.0, odata_sorted.get(), x3.size()*a1.size());
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x3.size(), a1.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), a1.size());
   out()->put_block(odata, x3, a1);
 }
 
@@ -971,8 +971,8 @@ void Task244::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a3, c2);
-    sort_indices<0,1,1,1,2,1>(i0data, odata, a3.size(), c2.size());
+    const double* i0data = in(0)->get_block_view(a3, c2);
+    sort_indices<0,1,1,1,2,1>(i0data, odata.get(), a3.size(), c2.size());
   }
   out()->put_block(odata, a3, c2);
 }
@@ -986,13 +986,13 @@ void Task245::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c3, a4, c1, a2);
   {
     // tensor label: I180
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a2, c1, a4, c3);
-    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata, a2.size(), c1.size(), a4.size(), c3.size());
+    const double* i0data = in(0)->get_block_view(a2, c1, a4, c3);
+    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata.get(), a2.size(), c1.size(), a4.size(), c3.size());
   }
   {
     // tensor label: I180
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a4, c3, a2, c1);
-    sort_indices<1,0,3,2,1,1,1,1>(i0data, odata, a4.size(), c3.size(), a2.size(), c1.size());
+    const double* i0data = in(0)->get_block_view(a4, c3, a2, c1);
+    sort_indices<1,0,3,2,1,1,1,1>(i0data, odata.get(), a4.size(), c3.size(), a2.size(), c1.size());
   }
   out()->put_block(odata, c3, a4, c1, a2);
 }
@@ -1004,22 +1004,22 @@ void Task246::Task_local::compute() {
   const Index c3 = b(3);
   // tensor label: I180
   std::unique_ptr<double[]> odata = out()->move_block(a2, c1, a4, c3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
+  BlockBuffer odata_sorted(out()->get_size(a2, c1, a4, c3));
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   for (auto& x1 : *range_[1]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a4, c3, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a4, c3, x1)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a4.size(), c3.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c1, a4, c3, x1);
+    BlockBuffer i0data_sorted(in(0)->get_size(c1, a4, c3, x1));
+    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a4.size(), c3.size(), x1.size());
     // tensor label: I181
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a2, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, x1)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, a2.size(), x1.size());
+    const double* i1data = in(1)->get_block_view(a2, x1);
+    BlockBuffer i1data_sorted(in(1)->get_size(a2, x1));
+    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), a2.size(), x1.size());
     dgemm_("T", "N", c1.size()*a4.size()*c3.size(), a2.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, c1.size()*a4.size()*c3.size());
+           1.0, i0data_sorted.get(), x1.size(), i1data_sorted.get(), x1.size(),
+           1.0, odata_sorted.get(), c1.size()*a4.size()*c3.size());
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, c1.size(), a4.size(), c3.size(), a2.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), c1.size(), a4.size(), c3.size(), a2.size());
   out()->put_block(odata, a2, c1, a4, c3);
 }
 
@@ -1028,22 +1028,22 @@ void Task247::Task_local::compute() {
   const Index x1 = b(1);
   // tensor label: I181
   std::unique_ptr<double[]> odata = out()->move_block(a2, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(a2, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(a2, x1), 0.0);
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma16
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x0, x1);
+    BlockBuffer i0data_sorted(in(0)->get_size(x0, x1));
+    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), x1.size());
     // tensor label: I182
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a2)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, x0.size(), a2.size());
+    const double* i1data = in(1)->get_block_view(x0, a2);
+    BlockBuffer i1data_sorted(in(1)->get_size(x0, a2));
+    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), a2.size());
     dgemm_("T", "N", x1.size(), a2.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+           1.0, i0data_sorted.get(), x0.size(), i1data_sorted.get(), x0.size(),
+           1.0, odata_sorted.get(), x1.size());
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), a2.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), a2.size());
   out()->put_block(odata, a2, x1);
 }
 
@@ -1054,8 +1054,8 @@ void Task248::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x0, a2);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a2);
-    sort_indices<0,1,1,1,-1,1>(i0data, odata, x0.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(x0, a2);
+    sort_indices<0,1,1,1,-1,1>(i0data, odata.get(), x0.size(), a2.size());
   }
   out()->put_block(odata, x0, a2);
 }
@@ -1067,22 +1067,22 @@ void Task249::Task_local::compute() {
   const Index c3 = b(3);
   // tensor label: I180
   std::unique_ptr<double[]> odata = out()->move_block(a2, c1, a4, c3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
+  BlockBuffer odata_sorted(out()->get_size(a2, c1, a4, c3));
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   for (auto& x1 : *range_[1]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, x1)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, x1);
+    BlockBuffer i0data_sorted(in(0)->get_size(c1, a2, c3, x1));
+    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size(), c3.size(), x1.size());
     // tensor label: I184
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a4, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, x1)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, a4.size(), x1.size());
+    const double* i1data = in(1)->get_block_view(a4, x1);
+    BlockBuffer i1data_sorted(in(1)->get_size(a4, x1));
+    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), x1.size());
     dgemm_("T", "N", c1.size()*a2.size()*c3.size(), a4.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, c1.size()*a2.size()*c3.size());
+           1.0, i0data_sorted.get(), x1.size(), i1data_sorted.get(), x1.size(),
+           1.0, odata_sorted.get(), c1.size()*a2.size()*c3.size());
   }
-  sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), c3.size(), a4.size());
+  sort_indices<1,0,3,2,1,1,1,1>(odata_sorted.get(), odata.get(), c1.size(), a2.size(), c3.size(), a4.size());
   out()->put_block(odata, a2, c1, a4, c3);
 }
 
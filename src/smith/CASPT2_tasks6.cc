@@ -38,22 +38,22 @@ void Task250::Task_local::compute() {
   const Index x1 = b(1);
   // tensor label: I184
   std::unique_ptr<double[]> odata = out()->move_block(a4, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(a4, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(a4, x1), 0.0);
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma16
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x0, x1);
+    BlockBuffer i0data_sorted(in(0)->get_size(x0, x1));
+    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), x1.size());
     // tensor label: I185
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a4)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, x0.size(), a4.size());
+    const double* i1data = in(1)->get_block_view(x0, a4);
+    BlockBuffer i1data_sorted(in(1)->get_size(x0, a4));
+    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), a4.size());
     dgemm_("T", "N", x1.size(), a4.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+           1.0, i0data_sorted.get(), x0.size(), i1data_sorted.get(), x0.size(),
+           1.0, odata_sorted.get(), x1.size());
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), a4.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), a4.size());
   out()->put_block(odata, a4, x1);
 }
 
@@ -64,8 +64,8 @@ void Task251::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x0, a4);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a4);
-    sort_indices<0,1,1,1,2,1>(i0data, odata, x0.size(), a4.size());
+    const double* i0data = in(0)->get_block_view(x0, a4);
+    sort_indices<0,1,1,1,2,1>(i0data, odata.get(), x0.size(), a4.size());
   }
   out()->put_block(odata, x0, a4);
 }
@@ -77,20 +77,20 @@ void Task252::Task_local::compute() {
   const Index c3 = b(3);
   // tensor label: I180
   std::unique_ptr<double[]> odata = out()->move_block(a2, c1, a4, c3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
+  BlockBuffer odata_sorted(out()->get_size(a2, c1, a4, c3));
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   // tensor label: f1
-  std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2);
-  std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a2)]);
-  sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c3.size(), a2.size());
+  const double* i0data = in(0)->get_block_view(c3, a2);
+  BlockBuffer i0data_sorted(in(0)->get_size(c3, a2));
+  sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), c3.size(), a2.size());
   // tensor label: I187
-  std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c1);
-  std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c1)]);
-  sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a4.size(), c1.size());
+  const double* i1data = in(1)->get_block_view(a4, c1);
+  BlockBuffer i1data_sorted(in(1)->get_size(a4, c1));
+  sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), c1.size());
   dgemm_("T", "N", c3.size()*a2.size(), a4.size()*c1.size(), 1,
-         1.0, i0data_sorted, 1, i1data_sorted, 1,
-         1.0, odata_sorted, c3.size()*a2.size());
-  sort_indices<1,3,2,0,1,1,1,1>(odata_sorted, odata, c3.size(), a2.size(), a4.size(), c1.size());
+         1.0, i0data_sorted.get(), 1, i1data_sorted.get(), 1,
+         1.0, odata_sorted.get(), c3.size()*a2.size());
+  sort_indices<1,3,2,0,1,1,1,1>(odata_sorted.get(), odata.get(), c3.size(), a2.size(), a4.size(), c1.size());
   out()->put_block(odata, a2, c1, a4, c3);
 }
 
@@ -99,24 +99,24 @@ void Task253::Task_local::compute() {
   const Index c1 = b(1);
   // tensor label: I187
   std::unique_ptr<double[]> odata = out()->move_block(a4, c1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, c1)]);
+  BlockBuffer odata_sorted(out()->get_size(a4, c1));
   std::fill_n(odata_sorted.get(), out()->get_size(a4, c1), 0.0);
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma38
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+      const double* i0data = in(0)->get_block_view(x1, x0);
+      BlockBuffer i0data_sorted(in(0)->get_size(x1, x0));
+      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), x0.size());
       // tensor label: I188
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a4, c1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a4, c1, x0)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x1.size(), a4.size(), c1.size(), x0.size());
+      const double* i1data = in(1)->get_block_view(x1, a4, c1, x0);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, a4, c1, x0));
+      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), a4.size(), c1.size(), x0.size());
       dgemm_("T", "N", 1, a4.size()*c1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, 1);
+             1.0, i0data_sorted.get(), x1.size()*x0.size(), i1data_sorted.get(), x1.size()*x0.size(),
+             1.0, odata_sorted.get(), 1);
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, a4.size(), c1.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), a4.size(), c1.size());
   out()->put_block(odata, a4, c1);
 }
 
@@ -129,13 +129,13 @@ void Task254::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, a4, c1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a4, c1, x0);
-    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata, x1.size(), a4.size(), c1.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(x1, a4, c1, x0);
+    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata.get(), x1.size(), a4.size(), c1.size(), x0.size());
   }
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i1data = in(0)->get_block(c1, a4, x1, x0);
-    sort_indices<2,1,0,3,1,1,-2,1>(i1data, odata, c1.size(), a4.size(), x1.size(), x0.size());
+    const double* i1data = in(0)->get_block_view(c1, a4, x1, x0);
+    sort_indices<2,1,0,3,1,1,-2,1>(i1data, odata.get(), c1.size(), a4.size(), x1.size(), x0.size());
   }
   out()->put_block(odata, x1, a4, c1, x0);
 }
@@ -147,20 +147,20 @@ void Task255::Task_local::compute() {
   const Index c3 = b(3);
   // tensor label: I180
   std::unique_ptr<double[]> odata = out()->move_block(a2, c1, a4, c3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
+  BlockBuffer odata_sorted(out()->get_size(a2, c1, a4, c3));
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   // tensor label: f1
-  std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a4);
-  std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a4)]);
-  sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c3.size(), a4.size());
+  const double* i0data = in(0)->get_block_view(c3, a4);
+  BlockBuffer i0data_sorted(in(0)->get_size(c3, a4));
+  sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), c3.size(), a4.size());
   // tensor label: I190
-  std::unique_ptr<double[]> i1data = in(1)->get_block(a2, c1);
-  std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, c1)]);
-  sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a2.size(), c1.size());
+  const double* i1data = in(1)->get_block_view(a2, c1);
+  BlockBuffer i1data_sorted(in(1)->get_size(a2, c1));
+  sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a2.size(), c1.size());
   dgemm_("T", "N", c3.size()*a4.size(), a2.size()*c1.size(), 1,
-         1.0, i0data_sorted, 1, i1data_sorted, 1,
-         1.0, odata_sorted, c3.size()*a4.size());
-  sort_indices<2,3,1,0,1,1,1,1>(odata_sorted, odata, c3.size(), a4.size(), a2.size(), c1.size());
+         1.0, i0data_sorted.get(), 1, i1data_sorted.get(), 1,
+         1.0, odata_sorted.get(), c3.size()*a4.size());
+  sort_indices<2,3,1,0,1,1,1,1>(odata_sorted.get(), odata.get(), c3.size(), a4.size(), a2.size(), c1.size());
   out()->put_block(odata, a2, c1, a4, c3);
 }
 
@@ -169,24 +169,24 @@ void Task256::Task_local::compute() {
   const Index c1 = b(1);
   // tensor label: I190
   std::unique_ptr<double[]> odata = out()->move_block(a2, c1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1)]);
+  BlockBuffer odata_sorted(out()->get_size(a2, c1));
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1), 0.0);
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma38
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+      const double* i0data = in(0)->get_block_view(x1, x0);
+      BlockBuffer i0data_sorted(in(0)->get_size(x1, x0));
+      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), x0.size());
       // tensor label: I191
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a2, c1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a2, c1, x0)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x1.size(), a2.size(), c1.size(), x0.size());
+      const double* i1data = in(1)->get_block_view(x1, a2, c1, x0);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, a2, c1, x0));
+      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), a2.size(), c1.size(), x0.size());
       dgemm_("T", "N", 1, a2.size()*c1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, 1);
+             1.0, i0data_sorted.get(), x1.size()*x0.size(), i1data_sorted.get(), x1.size()*x0.size(),
+             1.0, odata_sorted.get(), 1);
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, a2.size(), c1.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), a2.size(), c1.size());
   out()->put_block(odata, a2, c1);
 }
 
@@ -199,13 +199,13 @@ void Task257::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, a2, c1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a2, c1, x0);
-    sort_indices<0,1,2,3,1,1,-2,1>(i0data, odata, x1.size(), a2.size(), c1.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(x1, a2, c1, x0);
+    sort_indices<0,1,2,3,1,1,-2,1>(i0data, odata.get(), x1.size(), a2.size(), c1.size(), x0.size());
   }
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i1data = in(0)->get_block(c1, a2, x1, x0);
-    sort_indices<2,1,0,3,1,1,4,1>(i1data, odata, c1.size(), a2.size(), x1.size(), x0.size());
+    const double* i1data = in(0)->get_block_view(c1, a2, x1, x0);
+    sort_indices<2,1,0,3,1,1,4,1>(i1data, odata.get(), c1.size(), a2.size(), x1.size(), x0.size());
   }
   out()->put_block(odata, x1, a2, c1, x0);
 }
@@ -217,22 +217,22 @@ void Task258::Task_local::compute() {
   const Index c3 = b(3);
   // tensor label: I180
   std::unique_ptr<double[]> odata = out()->move_block(a2, c1, a4, c3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
+  BlockBuffer odata_sorted(out()->get_size(a2, c1, a4, c3));
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   for (auto& x1 : *range_[1]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a4, c1, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a4, c1, a2)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), a4.size(), c1.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(x1, a4, c1, a2);
+    BlockBuffer i0data_sorted(in(0)->get_size(x1, a4, c1, a2));
+    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), a4.size(), c1.size(), a2.size());
     // tensor label: I199
-    std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x1)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, c3.size(), x1.size());
+    const double* i1data = in(1)->get_block_view(c3, x1);
+    BlockBuffer i1data_sorted(in(1)->get_size(c3, x1));
+    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), c3.size(), x1.size());
     dgemm_("T", "N", a4.size()*c1.size()*a2.size(), c3.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, a4.size()*c1.size()*a2.size());
+           1.0, i0data_sorted.get(), x1.size(), i1data_sorted.get(), x1.size(),
+           1.0, odata_sorted.get(), a4.size()*c1.size()*a2.size());
   }
-  sort_indices<2,1,0,3,1,1,1,1>(odata_sorted, odata, a4.size(), c1.size(), a2.size(), c3.size());
+  sort_indices<2,1,0,3,1,1,1,1>(odata_sorted.get(), odata.get(), a4.size(), c1.size(), a2.size(), c3.size());
   out()->put_block(odata, a2, c1, a4, c3);
 }
 
@@ -241,22 +241,22 @@ void Task259::Task_local::compute() {
   const Index x1 = b(1);
   // tensor label: I199
   std::unique_ptr<double[]> odata = out()->move_block(c3, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(c3, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(c3, x1), 0.0);
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma38
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(x1, x0);
+    BlockBuffer i0data_sorted(in(0)->get_size(x1, x0));
+    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), x0.size());
     // tensor label: I200
-    std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x0)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, c3.size(), x0.size());
+    const double* i1data = in(1)->get_block_view(c3, x0);
+    BlockBuffer i1data_sorted(in(1)->get_size(c3, x0));
+    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), c3.size(), x0.size());
     dgemm_("T", "N", x1.size(), c3.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+           1.0, i0data_sorted.get(), x0.size(), i1data_sorted.get(), x0.size(),
+           1.0, odata_sorted.get(), x1.size());
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), c3.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), c3.size());
   out()->put_block(odata, c3, x1);
 }
 
@@ -267,8 +267,8 @@ void Task260::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c3, x0);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c3, x0);
-    sort_indices<0,1,1,1,-2,1>(i0data, odata, c3.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(c3, x0);
+    sort_indices<0,1,1,1,-2,1>(i0data, odata.get(), c3.size(), x0.size());
   }
   out()->put_block(odata, c3, x0);
 }
@@ -280,22 +280,22 @@ void Task261::Task_local::compute() {
   const Index c3 = b(3);
   // tensor label: I180
   std::unique_ptr<double[]> odata = out()->move_block(a2, c1, a4, c3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
+  BlockBuffer odata_sorted(out()->get_size(a2, c1, a4, c3));
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   for (auto& x1 : *range_[1]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a2, c1, a4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a2, c1, a4)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), a2.size(), c1.size(), a4.size());
+    const double* i0data = in(0)->get_block_view(x1, a2, c1, a4);
+    BlockBuffer i0data_sorted(in(0)->get_size(x1, a2, c1, a4));
+    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), a2.size(), c1.size(), a4.size());
     // tensor label: I202
-    std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x1)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, c3.size(), x1.size());
+    const double* i1data = in(1)->get_block_view(c3, x1);
+    BlockBuffer i1data_sorted(in(1)->get_size(c3, x1));
+    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), c3.size(), x1.size());
     dgemm_("T", "N", a2.size()*c1.size()*a4.size(), c3.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, a2.size()*c1.size()*a4.size());
+           1.0, i0data_sorted.get(), x1.size(), i1data_sorted.get(), x1.size(),
+           1.0, odata_sorted.get(), a2.size()*c1.size()*a4.size());
   }
-  sort_indices<0,1,2,3,1,1,1,1>(odata_sorted, odata, a2.size(), c1.size(), a4.size(), c3.size());
+  sort_indices<0,1,2,3,1,1,1,1>(odata_sorted.get(), odata.get(), a2.size(), c1.size(), a4.size(), c3.size());
   out()->put_block(odata, a2, c1, a4, c3);
 }
 
@@ -304,22 +304,22 @@ void Task262::Task_local::compute() {
   const Index x1 = b(1);
   // tensor label: I202
   std::unique_ptr<double[]> odata = out()->move_block(c3, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(c3, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(c3, x1), 0.0);
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma38
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(x1, x0);
+    BlockBuffer i0data_sorted(in(0)->get_size(x1, x0));
+    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), x0.size());
     // tensor label: I203
-    std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x0)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, c3.size(), x0.size());
+    const double* i1data = in(1)->get_block_view(c3, x0);
+    BlockBuffer i1data_sorted(in(1)->get_size(c3, x0));
+    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), c3.size(), x0.size());
     dgemm_("T", "N", x1.size(), c3.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+           1.0, i0data_sorted.get(), x0.size(), i1data_sorted.get(), x0.size(),
+           1.0, odata_sorted.get(), x1.size());
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), c3.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), c3.size());
   out()->put_block(odata, c3, x1);
 }
 
@@ -330,8 +330,8 @@ void Task263::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c3, x0);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c3, x0);
-    sort_indices<0,1,1,1,1,1>(i0data, odata, c3.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(c3, x0);
+    sort_indices<0,1,1,1,1,1>(i0data, odata.get(), c3.size(), x0.size());
   }
   out()->put_block(odata, c3, x0);
 }
@@ -345,8 +345,8 @@ void Task264::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c2, a3, x0, a1);
   {
     // tensor label: I204
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a3, c2, x0, a1);
-    sort_indices<1,0,2,3,1,1,1,1>(i0data, odata, a3.size(), c2.size(), x0.size(), a1.size());
+    const double* i0data = in(0)->get_block_view(a3, c2, x0, a1);
+    sort_indices<1,0,2,3,1,1,1,1>(i0data, odata.get(), a3.size(), c2.size(), x0.size(), a1.size());
   }
   out()->put_block(odata, c2, a3, x0, a1);
 }
@@ -358,22 +358,22 @@ void Task265::Task_local::compute() {
   const Index a1 = b(3);
   // tensor label: I204
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2, x0, a1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
+  BlockBuffer odata_sorted(out()->get_size(a3, c2, x0, a1));
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   for (auto& x1 : *range_[1]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), a1.size());
+    const double* i0data = in(0)->get_block_view(x1, a1);
+    BlockBuffer i0data_sorted(in(0)->get_size(x1, a1));
+    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), a1.size());
     // tensor label: I205
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, x1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, x1, x0)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), x1.size(), x0.size());
+    const double* i1data = in(1)->get_block_view(a3, c2, x1, x0);
+    BlockBuffer i1data_sorted(in(1)->get_size(a3, c2, x1, x0));
+    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), c2.size(), x1.size(), x0.size());
     dgemm_("T", "N", a1.size(), a3.size()*c2.size()*x0.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, a1.size());
+           1.0, i0data_sorted.get(), x1.size(), i1data_sorted.get(), x1.size(),
+           1.0, odata_sorted.get(), a1.size());
   }
-  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a1.size(), a3.size(), c2.size(), x0.size());
+  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted.get(), odata.get(), a1.size(), a3.size(), c2.size(), x0.size());
   out()->put_block(odata, a3, c2, x0, a1);
 }
 
@@ -384,24 +384,24 @@ void Task266::Task_local::compute() {
   const Index x0 = b(3);
   // tensor label: I205
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(a3, c2, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x1, x0), 0.0);
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma35
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      const double* i0data = in(0)->get_block_view(x3, x2, x1, x0);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, x2, x1, x0));
+      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: I206
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a3, c2, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a3, c2, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), a3.size(), c2.size(), x2.size());
+      const double* i1data = in(1)->get_block_view(x3, a3, c2, x2);
+      BlockBuffer i1data_sorted(in(1)->get_size(x3, a3, c2, x2));
+      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), a3.size(), c2.size(), x2.size());
       dgemm_("T", "N", x1.size()*x0.size(), a3.size()*c2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+             1.0, i0data_sorted.get(), x3.size()*x2.size(), i1data_sorted.get(), x3.size()*x2.size(),
+             1.0, odata_sorted.get(), x1.size()*x0.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a3.size(), c2.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size(), a3.size(), c2.size());
   out()->put_block(odata, a3, c2, x1, x0);
 }
 
@@ -414,13 +414,13 @@ void Task267::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x3, a3, c2, x2);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a3, c2, x2);
-    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata, x3.size(), a3.size(), c2.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x3, a3, c2, x2);
+    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata.get(), x3.size(), a3.size(), c2.size(), x2.size());
   }
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i1data = in(0)->get_block(c2, a3, x3, x2);
-    sort_indices<2,1,0,3,1,1,2,1>(i1data, odata, c2.size(), a3.size(), x3.size(), x2.size());
+    const double* i1data = in(0)->get_block_view(c2, a3, x3, x2);
+    sort_indices<2,1,0,3,1,1,2,1>(i1data, odata.get(), c2.size(), a3.size(), x3.size(), x2.size());
   }
   out()->put_block(odata, x3, a3, c2, x2);
 }
@@ -432,22 +432,22 @@ void Task268::Task_local::compute() {
   const Index a1 = b(3);
   // tensor label: I204
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2, x0, a1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
+  BlockBuffer odata_sorted(out()->get_size(a3, c2, x0, a1));
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   for (auto& x1 : *range_[1]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a3)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(x1, a3);
+    BlockBuffer i0data_sorted(in(0)->get_size(x1, a3));
+    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), a3.size());
     // tensor label: I208
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a1, c2, x0, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, c2, x0, x1)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, a1.size(), c2.size(), x0.size(), x1.size());
+    const double* i1data = in(1)->get_block_view(a1, c2, x0, x1);
+    BlockBuffer i1data_sorted(in(1)->get_size(a1, c2, x0, x1));
+    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted.get(), a1.size(), c2.size(), x0.size(), x1.size());
     dgemm_("T", "N", a3.size(), a1.size()*c2.size()*x0.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, a3.size());
+           1.0, i0data_sorted.get(), x1.size(), i1data_sorted.get(), x1.size(),
+           1.0, odata_sorted.get(), a3.size());
   }
-  sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, a3.size(), a1.size(), c2.size(), x0.size());
+  sort_indices<0,2,3,1,1,1,1,1>(odata_sorted.get(), odata.get(), a3.size(), a1.size(), c2.size(), x0.size());
   out()->put_block(odata, a3, c2, x0, a1);
 }
 
@@ -458,24 +458,24 @@ void Task269::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I208
   std::unique_ptr<double[]> odata = out()->move_block(a1, c2, x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, c2, x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(a1, c2, x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(a1, c2, x0, x1), 0.0);
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma32
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x1, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x1.size(), x2.size());
+      const double* i0data = in(0)->get_block_view(x3, x0, x1, x2);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, x0, x1, x2));
+      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x0.size(), x1.size(), x2.size());
       // tensor label: I209
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, c2, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, c2, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), a1.size(), c2.size(), x2.size());
+      const double* i1data = in(1)->get_block_view(x3, a1, c2, x2);
+      BlockBuffer i1data_sorted(in(1)->get_size(x3, a1, c2, x2));
+      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), a1.size(), c2.size(), x2.size());
       dgemm_("T", "N", x0.size()*x1.size(), a1.size()*c2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+             1.0, i0data_sorted.get(), x3.size()*x2.size(), i1data_sorted.get(), x3.size()*x2.size(),
+             1.0, odata_sorted.get(), x0.size()*x1.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a1.size(), c2.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), a1.size(), c2.size());
   out()->put_block(odata, a1, c2, x0, x1);
 }
 
@@ -488,8 +488,8 @@ void Task270::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x3, a1, c2, x2);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, c2, x2);
-    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata, x3.size(), a1.size(), c2.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x3, a1, c2, x2);
+    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata.get(), x3.size(), a1.size(), c2.size(), x2.size());
   }
   out()->put_block(odata, x3, a1, c2, x2);
 }
@@ -501,24 +501,24 @@ void Task271::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I208
   std::unique_ptr<double[]> odata = out()->move_block(a1, c2, x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, c2, x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(a1, c2, x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(a1, c2, x0, x1), 0.0);
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma35
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      const double* i0data = in(0)->get_block_view(x3, x2, x1, x0);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, x2, x1, x0));
+      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: I215
-      std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x3.size(), x2.size());
+      const double* i1data = in(1)->get_block_view(c2, a1, x3, x2);
+      BlockBuffer i1data_sorted(in(1)->get_size(c2, a1, x3, x2));
+      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted.get(), c2.size(), a1.size(), x3.size(), x2.size());
       dgemm_("T", "N", x1.size()*x0.size(), c2.size()*a1.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+             1.0, i0data_sorted.get(), x3.size()*x2.size(), i1data_sorted.get(), x3.size()*x2.size(),
+             1.0, odata_sorted.get(), x1.size()*x0.size());
     }
   }
-  sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c2.size(), a1.size());
+  sort_indices<3,2,1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size(), c2.size(), a1.size());
   out()->put_block(odata, a1, c2, x0, x1);
 }
 
@@ -531,8 +531,8 @@ void Task272::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c2, a1, x3, x2);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, x3, x2);
-    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata, c2.size(), a1.size(), x3.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(c2, a1, x3, x2);
+    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata.get(), c2.size(), a1.size(), x3.size(), x2.size());
   }
   out()->put_block(odata, c2, a1, x3, x2);
 }
@@ -544,20 +544,20 @@ void Task273::Task_local::compute() {
   const Index a1 = b(3);
   // tensor label: I204
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2, x0, a1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
+  BlockBuffer odata_sorted(out()->get_size(a3, c2, x0, a1));
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   // tensor label: f1
-  std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1);
-  std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1)]);
-  sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size());
+  const double* i0data = in(0)->get_block_view(c2, a1);
+  BlockBuffer i0data_sorted(in(0)->get_size(c2, a1));
+  sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), c2.size(), a1.size());
   // tensor label: I217
-  std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x0);
-  std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x0)]);
-  sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a3.size(), x0.size());
+  const double* i1data = in(1)->get_block_view(a3, x0);
+  BlockBuffer i1data_sorted(in(1)->get_size(a3, x0));
+  sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), x0.size());
   dgemm_("T", "N", c2.size()*a1.size(), a3.size()*x0.size(), 1,
-         1.0, i0data_sorted, 1, i1data_sorted, 1,
-         1.0, odata_sorted, c2.size()*a1.size());
-  sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), a3.size(), x0.size());
+         1.0, i0data_sorted.get(), 1, i1data_sorted.get(), 1,
+         1.0, odata_sorted.get(), c2.size()*a1.size());
+  sort_indices<2,0,3,1,1,1,1,1>(odata_sorted.get(), odata.get(), c2.size(), a1.size(), a3.size(), x0.size());
   out()->put_block(odata, a3, c2, x0, a1);
 }
 
@@ -566,26 +566,26 @@ void Task274::Task_local::compute() {
   const Index x0 = b(1);
   // tensor label: I217
   std::unique_ptr<double[]> odata = out()->move_block(a3, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(a3, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(a3, x0), 0.0);
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma60
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+        const double* i0data = in(0)->get_block_view(x3, x0, x2, x1);
+        BlockBuffer i0data_sorted(in(0)->get_size(x3, x0, x2, x1));
+        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x0.size(), x2.size(), x1.size());
         // tensor label: I218
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a3, x2, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a3, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted, x3.size(), a3.size(), x2.size(), x1.size());
+        const double* i1data = in(1)->get_block_view(x3, a3, x2, x1);
+        BlockBuffer i1data_sorted(in(1)->get_size(x3, a3, x2, x1));
+        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), a3.size(), x2.size(), x1.size());
         dgemm_("T", "N", x0.size(), a3.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x0.size());
+               1.0, i0data_sorted.get(), x3.size()*x2.size()*x1.size(), i1data_sorted.get(), x3.size()*x2.size()*x1.size(),
+               1.0, odata_sorted.get(), x0.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), a3.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), a3.size());
   out()->put_block(odata, a3, x0);
 }
 
@@ -598,8 +598,8 @@ void Task275::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x3, a3, x2, x1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a3, x2, x1);
-    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata, x3.size(), a3.size(), x2.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x3, a3, x2, x1);
+    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata.get(), x3.size(), a3.size(), x2.size(), x1.size());
   }
   out()->put_block(odata, x3, a3, x2, x1);
 }
@@ -611,20 +611,20 @@ void Task276::Task_local::compute() {
   const Index a1 = b(3);
   // tensor label: I204
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2, x0, a1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
+  BlockBuffer odata_sorted(out()->get_size(a3, c2, x0, a1));
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   // tensor label: f1
-  std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a3);
-  std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a3)]);
-  sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), a3.size());
+  const double* i0data = in(0)->get_block_view(c2, a3);
+  BlockBuffer i0data_sorted(in(0)->get_size(c2, a3));
+  sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), c2.size(), a3.size());
   // tensor label: I220
-  std::unique_ptr<double[]> i1data = in(1)->get_block(a1, x0);
-  std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, x0)]);
-  sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a1.size(), x0.size());
+  const double* i1data = in(1)->get_block_view(a1, x0);
+  BlockBuffer i1data_sorted(in(1)->get_size(a1, x0));
+  sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a1.size(), x0.size());
   dgemm_("T", "N", c2.size()*a3.size(), a1.size()*x0.size(), 1,
-         1.0, i0data_sorted, 1, i1data_sorted, 1,
-         1.0, odata_sorted, c2.size()*a3.size());
-  sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, c2.size(), a3.size(), a1.size(), x0.size());
+         1.0, i0data_sorted.get(), 1, i1data_sorted.get(), 1,
+         1.0, odata_sorted.get(), c2.size()*a3.size());
+  sort_indices<1,0,3,2,1,1,1,1>(odata_sorted.get(), odata.get(), c2.size(), a3.size(), a1.size(), x0.size());
   out()->put_block(odata, a3, c2, x0, a1);
 }
 
@@ -633,26 +633,26 @@ void Task277::Task_local::compute() {
   const Index x0 = b(1);
   // tensor label: I220
   std::unique_ptr<double[]> odata = out()->move_block(a1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(a1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0), 0.0);
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma60
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+        const double* i0data = in(0)->get_block_view(x3, x0, x2, x1);
+        BlockBuffer i0data_sorted(in(0)->get_size(x3, x0, x2, x1));
+        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x0.size(), x2.size(), x1.size());
         // tensor label: I221
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, x2, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted, x3.size(), a1.size(), x2.size(), x1.size());
+        const double* i1data = in(1)->get_block_view(x3, a1, x2, x1);
+        BlockBuffer i1data_sorted(in(1)->get_size(x3, a1, x2, x1));
+        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), a1.size(), x2.size(), x1.size());
         dgemm_("T", "N", x0.size(), a1.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x0.size());
+               1.0, i0data_sorted.get(), x3.size()*x2.size()*x1.size(), i1data_sorted.get(), x3.size()*x2.size()*x1.size(),
+               1.0, odata_sorted.get(), x0.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), a1.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), a1.size());
   out()->put_block(odata, a1, x0);
 }
 
@@ -665,8 +665,8 @@ void Task278::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x3, a1, x2, x1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, x2, x1);
-    sort_indices<0,1,2,3,1,1,2,1>(i0data, odata, x3.size(), a1.size(), x2.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x3, a1, x2, x1);
+    sort_indices<0,1,2,3,1,1,2,1>(i0data, odata.get(), x3.size(), a1.size(), x2.size(), x1.size());
   }
   out()->put_block(odata, x3, a1, x2, x1);
 }
@@ -678,22 +678,22 @@ void Task279::Task_local::compute() {
   const Index a1 = b(3);
   // tensor label: I204
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2, x0, a1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
+  BlockBuffer odata_sorted(out()->get_size(a3, c2, x0, a1));
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   for (auto& c4 : *range_[0]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a3, c4, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a3, c4, a1)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a3.size(), c4.size(), a1.size());
+    const double* i0data = in(0)->get_block_view(c2, a3, c4, a1);
+    BlockBuffer i0data_sorted(in(0)->get_size(c2, a3, c4, a1));
+    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted.get(), c2.size(), a3.size(), c4.size(), a1.size());
     // tensor label: I223
-    std::unique_ptr<double[]> i1data = in(1)->get_block(c4, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c4, x0)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, c4.size(), x0.size());
+    const double* i1data = in(1)->get_block_view(c4, x0);
+    BlockBuffer i1data_sorted(in(1)->get_size(c4, x0));
+    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), c4.size(), x0.size());
     dgemm_("T", "N", c2.size()*a3.size()*a1.size(), x0.size(), c4.size(),
-           1.0, i0data_sorted, c4.size(), i1data_sorted, c4.size(),
-           1.0, odata_sorted, c2.size()*a3.size()*a1.size());
+           1.0, i0data_sorted.get(), c4.size(), i1data_sorted.get(), c4.size(),
+           1.0, odata_sorted.get(), c2.size()*a3.size()*a1.size());
   }
-  sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, c2.size(), a3.size(), a1.size(), x0.size());
+  sort_indices<1,0,3,2,1,1,1,1>(odata_sorted.get(), odata.get(), c2.size(), a3.size(), a1.size(), x0.size());
   out()->put_block(odata, a3, c2, x0, a1);
 }
 
@@ -702,22 +702,22 @@ void Task280::Task_local::compute() {
   const Index x0 = b(1);
   // tensor label: I223
   std::unique_ptr<double[]> odata = out()->move_block(c4, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c4, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(c4, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(c4, x0), 0.0);
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma38
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(x1, x0);
+    BlockBuffer i0data_sorted(in(0)->get_size(x1, x0));
+    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), x0.size());
     // tensor label: I224
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c4)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, x1.size(), c4.size());
+    const double* i1data = in(1)->get_block_view(x1, c4);
+    BlockBuffer i1data_sorted(in(1)->get_size(x1, c4));
+    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), c4.size());
     dgemm_("T", "N", x0.size(), c4.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+           1.0, i0data_sorted.get(), x1.size(), i1data_sorted.get(), x1.size(),
+           1.0, odata_sorted.get(), x0.size());
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), c4.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), c4.size());
   out()->put_block(odata, c4, x0);
 }
 
@@ -728,8 +728,8 @@ void Task281::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, c4);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x1, c4);
-    sort_indices<0,1,1,1,-4,1>(i0data, odata, x1.size(), c4.size());
+    const double* i0data = in(0)->get_block_view(x1, c4);
+    sort_indices<0,1,1,1,-4,1>(i0data, odata.get(), x1.size(), c4.size());
   }
   out()->put_block(odata, x1, c4);
 }
@@ -741,22 +741,22 @@ void Task282::Task_local::compute() {
   const Index a1 = b(3);
   // tensor label: I204
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2, x0, a1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
+  BlockBuffer odata_sorted(out()->get_size(a3, c2, x0, a1));
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   for (auto& c4 : *range_[0]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, c4, a3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1, c4, a3)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size(), c4.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(c2, a1, c4, a3);
+    BlockBuffer i0data_sorted(in(0)->get_size(c2, a1, c4, a3));
+    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted.get(), c2.size(), a1.size(), c4.size(), a3.size());
     // tensor label: I226
-    std::unique_ptr<double[]> i1data = in(1)->get_block(c4, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c4, x0)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, c4.size(), x0.size());
+    const double* i1data = in(1)->get_block_view(c4, x0);
+    BlockBuffer i1data_sorted(in(1)->get_size(c4, x0));
+    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), c4.size(), x0.size());
     dgemm_("T", "N", c2.size()*a1.size()*a3.size(), x0.size(), c4.size(),
-           1.0, i0data_sorted, c4.size(), i1data_sorted, c4.size(),
-           1.0, odata_sorted, c2.size()*a1.size()*a3.size());
+           1.0, i0data_sorted.get(), c4.size(), i1data_sorted.get(), c4.size(),
+           1.0, odata_sorted.get(), c2.size()*a1.size()*a3.size());
   }
-  sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), a3.size(), x0.size());
+  sort_indices<2,0,3,1,1,1,1,1>(odata_sorted.get(), odata.get(), c2.size(), a1.size(), a3.size(), x0.size());
   out()->put_block(odata, a3, c2, x0, a1);
 }
 
@@ -765,22 +765,22 @@ void Task283::Task_local::compute() {
   const Index x0 = b(1);
   // tensor label: I226
   std::unique_ptr<double[]> odata = out()->move_block(c4, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c4, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(c4, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(c4, x0), 0.0);
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma38
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(x1, x0);
+    BlockBuffer i0data_sorted(in(0)->get_size(x1, x0));
+    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), x0.size());
     // tensor label: I227
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c4)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, x1.size(), c4.size());
+    const double* i1data = in(1)->get_block_view(x1, c4);
+    BlockBuffer i1data_sorted(in(1)->get_size(x1, c4));
+    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), c4.size());
     dgemm_("T", "N", x0.size(), c4.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+           1.0, i0data_sorted.get(), x1.size(), i1data_sorted.get(), x1.size(),
+           1.0, odata_sorted.get(), x0.size());
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), c4.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), c4.size());
   out()->put_block(odata, c4, x0);
 }
 
@@ -791,8 +791,8 @@ void Task284::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, c4);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x1, c4);
-    sort_indices<0,1,1,1,2,1>(i0data, odata, x1.size(), c4.size());
+    const double* i0data = in(0)->get_block_view(x1, c4);
+    sort_indices<0,1,1,1,2,1>(i0data, odata.get(), x1.size(), c4.size());
   }
   out()->put_block(odata, x1, c4);
 }
@@ -804,22 +804,22 @@ void Task285::Task_local::compute() {
   const Index a1 = b(3);
   // tensor label: I204
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2, x0, a1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
+  BlockBuffer odata_sorted(out()->get_size(a3, c2, x0, a1));
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   for (auto& x3 : *range_[1]) {
     // tensor label: Gamma79
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(x3, x0);
+    BlockBuffer i0data_sorted(in(0)->get_size(x3, x0));
+    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x0.size());
     // tensor label: I229
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a3, c2, a1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a3, c2, a1)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), a3.size(), c2.size(), a1.size());
+    const double* i1data = in(1)->get_block_view(x3, a3, c2, a1);
+    BlockBuffer i1data_sorted(in(1)->get_size(x3, a3, c2, a1));
+    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), a3.size(), c2.size(), a1.size());
     dgemm_("T", "N", x0.size(), a3.size()*c2.size()*a1.size(), x3.size(),
-           1.0, i0data_sorted, x3.size(), i1data_sorted, x3.size(),
-           1.0, odata_sorted, x0.size());
+           1.0, i0data_sorted.get(), x3.size(), i1data_sorted.get(), x3.size(),
+           1.0, odata_sorted.get(), x0.size());
   }
-  sort_indices<1,2,0,3,1,1,1,1>(odata_sorted, odata, x0.size(), a3.size(), c2.size(), a1.size());
+  sort_indices<1,2,0,3,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), a3.size(), c2.size(), a1.size());
   out()->put_block(odata, a3, c2, x0, a1);
 }
 
@@ -832,13 +832,13 @@ void Task286::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x3, a3, c2, a1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a3, c2, a1);
-    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata, x3.size(), a3.size(), c2.size(), a1.size());
+    const double* i0data = in(0)->get_block_view(x3, a3, c2, a1);
+    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata.get(), x3.size(), a3.size(), c2.size(), a1.size());
   }
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i1data = in(0)->get_block(x3, a1, c2, a3);
-    sort_indices<0,3,2,1,1,1,2,1>(i1data, odata, x3.size(), a1.size(), c2.size(), a3.size());
+    const double* i1data = in(0)->get_block_view(x3, a1, c2, a3);
+    sort_indices<0,3,2,1,1,1,2,1>(i1data, odata.get(), x3.size(), a1.size(), c2.size(), a3.size());
   }
   out()->put_block(odata, x3, a3, c2, a1);
 }
@@ -850,22 +850,22 @@ void Task287::Task_local::compute() {
   const Index a1 = b(3);
   // tensor label: I204
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2, x0, a1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
+  BlockBuffer odata_sorted(out()->get_size(a3, c2, x0, a1));
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma38
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(x1, x0);
+    BlockBuffer i0data_sorted(in(0)->get_size(x1, x0));
+    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), x0.size());
     // tensor label: I233
-    std::unique_ptr<double[]> i1data = in(1)->get_block(c2, x1, a3, a1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, x1, a3, a1)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, c2.size(), x1.size(), a3.size(), a1.size());
+    const double* i1data = in(1)->get_block_view(c2, x1, a3, a1);
+    BlockBuffer i1data_sorted(in(1)->get_size(c2, x1, a3, a1));
+    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted.get(), c2.size(), x1.size(), a3.size(), a1.size());
     dgemm_("T", "N", x0.size(), c2.size()*a3.size()*a1.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+           1.0, i0data_sorted.get(), x1.size(), i1data_sorted.get(), x1.size(),
+           1.0, odata_sorted.get(), x0.size());
   }
-  sort_indices<2,1,0,3,1,1,1,1>(odata_sorted, odata, x0.size(), c2.size(), a3.size(), a1.size());
+  sort_indices<2,1,0,3,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), c2.size(), a3.size(), a1.size());
   out()->put_block(odata, a3, c2, x0, a1);
 }
 
@@ -880,23 +880,23 @@ void Task288::Task_local::compute() {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a3, c2, a1);
     dscal_(x1.size()*a3.size()*c2.size()*a1.size(), e0_, i0data.get(), 1);
-    sort_indices<2,0,1,3,1,1,1,1>(i0data, odata, x1.size(), a3.size(), c2.size(), a1.size());
+    sort_indices<2,0,1,3,1,1,1,1>(i0data.get(), odata.get(), x1.size(), a3.size(), c2.size(), a1.size());
   }
   {
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(0)->get_block(x1, a1, c2, a3);
     dscal_(x1.size()*a1.size()*c2.size()*a3.size(), e0_, i1data.get(), 1);
-    sort_indices<2,0,3,1,1,1,-2,1>(i1data, odata, x1.size(), a1.size(), c2.size(), a3.size());
+    sort_indices<2,0,3,1,1,1,-2,1>(i1data.get(), odata.get(), x1.size(), a1.size(), c2.size(), a3.size());
   }
   {
     // tensor label: v2
-    std::unique_ptr<double[]> i2data = in(1)->get_block(x1, a3, c2, a1);
-    sort_indices<2,0,1,3,1,1,-1,1>(i2data, odata, x1.size(), a3.size(), c2.size(), a1.size());
+    const double* i2data = in(1)->get_block_view(x1, a3, c2, a1);
+    sort_indices<2,0,1,3,1,1,-1,1>(i2data, odata.get(), x1.size(), a3.size(), c2.size(), a1.size());
   }
   {
     // tensor label: v2
-    std::unique_ptr<double[]> i3data = in(1)->get_block(x1, a1, c2, a3);
-    sort_indices<2,0,3,1,1,1,2,1>(i3data, odata, x1.size(), a1.size(), c2.size(), a3.size());
+    const double* i3data = in(1)->get_block_view(x1, a1, c2, a3);
+    sort_indices<2,0,3,1,1,1,2,1>(i3data, odata.get(), x1.size(), a1.size(), c2.size(), a3.size());
   }
   out()->put_block(odata, c2, x1, a3, a1);
 }
@@ -908,22 +908,22 @@ void Task289::Task_local::compute() {
   const Index a1 = b(3);
   // tensor label: I233
   std::unique_ptr<double[]> odata = out()->move_block(c2, x1, a3, a1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, a3, a1)]);
+  BlockBuffer odata_sorted(out()->get_size(c2, x1, a3, a1));
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   for (auto& c4 : *range_[0]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a3, c4, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a3, c4, a1)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), a3.size(), c4.size(), a1.size());
+    const double* i0data = in(0)->get_block_view(x1, a3, c4, a1);
+    BlockBuffer i0data_sorted(in(0)->get_size(x1, a3, c4, a1));
+    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), a3.size(), c4.size(), a1.size());
     // tensor label: I234
-    std::unique_ptr<double[]> i1data = in(1)->get_block(c2, c4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, c4)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, c2.size(), c4.size());
+    const double* i1data = in(1)->get_block_view(c2, c4);
+    BlockBuffer i1data_sorted(in(1)->get_size(c2, c4));
+    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), c2.size(), c4.size());
     dgemm_("T", "N", x1.size()*a3.size()*a1.size(), c2.size(), c4.size(),
-           1.0, i0data_sorted, c4.size(), i1data_sorted, c4.size(),
-           1.0, odata_sorted, x1.size()*a3.size()*a1.size());
+           1.0, i0data_sorted.get(), c4.size(), i1data_sorted.get(), c4.size(),
+           1.0, odata_sorted.get(), x1.size()*a3.size()*a1.size());
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x1.size(), a3.size(), a1.size(), c2.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), a3.size(), a1.size(), c2.size());
   out()->put_block(odata, c2, x1, a3, a1);
 }
 
@@ -934,8 +934,8 @@ void Task290::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c2, c4);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c2, c4);
-    sort_indices<0,1,1,1,1,1>(i0data, odata, c2.size(), c4.size());
+    const double* i0data = in(0)->get_block_view(c2, c4);
+    sort_indices<0,1,1,1,1,1>(i0data, odata.get(), c2.size(), c4.size());
   }
   out()->put_block(odata, c2, c4);
 }
@@ -947,22 +947,22 @@ void Task291::Task_local::compute() {
   const Index a1 = b(3);
   // tensor label: I233
   std::unique_ptr<double[]> odata = out()->move_block(c2, x1, a3, a1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, a3, a1)]);
+  BlockBuffer odata_sorted(out()->get_size(c2, x1, a3, a1));
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   for (auto& c4 : *range_[0]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a1, c4, a3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a1, c4, a3)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), a1.size(), c4.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(x1, a1, c4, a3);
+    BlockBuffer i0data_sorted(in(0)->get_size(x1, a1, c4, a3));
+    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), a1.size(), c4.size(), a3.size());
     // tensor label: I237
-    std::unique_ptr<double[]> i1data = in(1)->get_block(c2, c4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, c4)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, c2.size(), c4.size());
+    const double* i1data = in(1)->get_block_view(c2, c4);
+    BlockBuffer i1data_sorted(in(1)->get_size(c2, c4));
+    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), c2.size(), c4.size());
     dgemm_("T", "N", x1.size()*a1.size()*a3.size(), c2.size(), c4.size(),
-           1.0, i0data_sorted, c4.size(), i1data_sorted, c4.size(),
-           1.0, odata_sorted, x1.size()*a1.size()*a3.size());
+           1.0, i0data_sorted.get(), c4.size(), i1data_sorted.get(), c4.size(),
+           1.0, odata_sorted.get(), x1.size()*a1.size()*a3.size());
   }
-  sort_indices<3,0,2,1,1,1,1,1>(odata_sorted, odata, x1.size(), a1.size(), a3.size(), c2.size());
+  sort_indices<3,0,2,1,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), a1.size(), a3.size(), c2.size());
   out()->put_block(odata, c2, x1, a3, a1);
 }
 
@@ -973,8 +973,8 @@ void Task292::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c2, c4);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c2, c4);
-    sort_indices<0,1,1,1,-2,1>(i0data, odata, c2.size(), c4.size());
+    const double* i0data = in(0)->get_block_view(c2, c4);
+    sort_indices<0,1,1,1,-2,1>(i0data, odata.get(), c2.size(), c4.size());
   }
   out()->put_block(odata, c2, c4);
 }
@@ -986,22 +986,22 @@ void Task293::Task_local::compute() {
   const Index a1 = b(3);
   // tensor label: I233
   std::unique_ptr<double[]> odata = out()->move_block(c2, x1, a3, a1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, a3, a1)]);
+  BlockBuffer odata_sorted(out()->get_size(c2, x1, a3, a1));
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   for (auto& a4 : *range_[2]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a4, c2, a3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a4, c2, a3)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), a4.size(), c2.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(x1, a4, c2, a3);
+    BlockBuffer i0data_sorted(in(0)->get_size(x1, a4, c2, a3));
+    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), a4.size(), c2.size(), a3.size());
     // tensor label: I240
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a4, a1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, a1)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a4.size(), a1.size());
+    const double* i1data = in(1)->get_block_view(a4, a1);
+    BlockBuffer i1data_sorted(in(1)->get_size(a4, a1));
+    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), a1.size());
     dgemm_("T", "N", x1.size()*c2.size()*a3.size(), a1.size(), a4.size(),
-           1.0, i0data_sorted, a4.size(), i1data_sorted, a4.size(),
-           1.0, odata_sorted, x1.size()*c2.size()*a3.size());
+           1.0, i0data_sorted.get(), a4.size(), i1data_sorted.get(), a4.size(),
+           1.0, odata_sorted.get(), x1.size()*c2.size()*a3.size());
   }
-  sort_indices<1,0,2,3,1,1,1,1>(odata_sorted, odata, x1.size(), c2.size(), a3.size(), a1.size());
+  sort_indices<1,0,2,3,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), c2.size(), a3.size(), a1.size());
   out()->put_block(odata, c2, x1, a3, a1);
 }
 
@@ -1012,8 +1012,8 @@ void Task294::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a4, a1);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a4, a1);
-    sort_indices<0,1,1,1,2,1>(i0data, odata, a4.size(), a1.size());
+    const double* i0data = in(0)->get_block_view(a4, a1);
+    sort_indices<0,1,1,1,2,1>(i0data, odata.get(), a4.size(), a1.size());
   }
   out()->put_block(odata, a4, a1);
 }
@@ -1025,22 +1025,22 @@ void Task295::Task_local::compute() {
   const Index a1 = b(3);
   // tensor label: I233
   std::unique_ptr<double[]> odata = out()->move_block(c2, x1, a3, a1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, a3, a1)]);
+  BlockBuffer odata_sorted(out()->get_size(c2, x1, a3, a1));
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   for (auto& a4 : *range_[2]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a3, c2, a4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a3, c2, a4)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, x1.size(), a3.size(), c2.size(), a4.size());
+    const double* i0data = in(0)->get_block_view(x1, a3, c2, a4);
+    BlockBuffer i0data_sorted(in(0)->get_size(x1, a3, c2, a4));
+    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), a3.size(), c2.size(), a4.size());
     // tensor label: I243
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a4, a1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, a1)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a4.size(), a1.size());
+    const double* i1data = in(1)->get_block_view(a4, a1);
+    BlockBuffer i1data_sorted(in(1)->get_size(a4, a1));
+    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), a1.size());
     dgemm_("T", "N", x1.size()*a3.size()*c2.size(), a1.size(), a4.size(),
-           1.0, i0data_sorted, a4.size(), i1data_sorted, a4.size(),
-           1.0, odata_sorted, x1.size()*a3.size()*c2.size());
+           1.0, i0data_sorted.get(), a4.size(), i1data_sorted.get(), a4.size(),
+           1.0, odata_sorted.get(), x1.size()*a3.size()*c2.size());
   }
-  sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x1.size(), a3.size(), c2.size(), a1.size());
+  sort_indices<2,0,1,3,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), a3.size(), c2.size(), a1.size());
   out()->put_block(odata, c2, x1, a3, a1);
 }
 
@@ -1051,8 +1051,8 @@ void Task296::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a4, a1);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a4, a1);
-    sort_indices<0,1,1,1,-1,1>(i0data, odata, a4.size(), a1.size());
+    const double* i0data = in(0)->get_block_view(a4, a1);
+    sort_indices<0,1,1,1,-1,1>(i0data, odata.get(), a4.size(), a1.size());
   }
   out()->put_block(odata, a4, a1);
 }
@@ -1064,22 +1064,22 @@ void Task297::Task_local::compute() {
   const Index a1 = b(3);
   // tensor label: I233
   std::unique_ptr<double[]> odata = out()->move_block(c2, x1, a3, a1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, a3, a1)]);
+  BlockBuffer odata_sorted(out()->get_size(c2, x1, a3, a1));
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   for (auto& a4 : *range_[2]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a4, c2, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a4, c2, a1)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), a4.size(), c2.size(), a1.size());
+    const double* i0data = in(0)->get_block_view(x1, a4, c2, a1);
+    BlockBuffer i0data_sorted(in(0)->get_size(x1, a4, c2, a1));
+    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), a4.size(), c2.size(), a1.size());
     // tensor label: I246
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a4, a3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, a3)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a4.size(), a3.size());
+    const double* i1data = in(1)->get_block_view(a4, a3);
+    BlockBuffer i1data_sorted(in(1)->get_size(a4, a3));
+    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), a3.size());
     dgemm_("T", "N", x1.size()*c2.size()*a1.size(), a3.size(), a4.size(),
-           1.0, i0data_sorted, a4.size(), i1data_sorted, a4.size(),
-           1.0, odata_sorted, x1.size()*c2.size()*a1.size());
+           1.0, i0data_sorted.get(), a4.size(), i1data_sorted.get(), a4.size(),
+           1.0, odata_sorted.get(), x1.size()*c2.size()*a1.size());
   }
-  sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, x1.size(), c2.size(), a1.size(), a3.size());
+  sort_indices<1,0,3,2,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), c2.size(), a1.size(), a3.size());
   out()->put_block(odata, c2, x1, a3, a1);
 }
 
@@ -1090,8 +1090,8 @@ void Task298::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a4, a3);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a4, a3);
-    sort_indices<0,1,1,1,-1,1>(i0data, odata, a4.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(a4, a3);
+    sort_indices<0,1,1,1,-1,1>(i0data, odata.get(), a4.size(), a3.size());
   }
   out()->put_block(odata, a4, a3);
 }
@@ -1103,22 +1103,22 @@ void Task299::Task_local::compute() {
   const Index a1 = b(3);
   // tensor label: I233
   std::unique_ptr<double[]> odata = out()->move_block(c2, x1, a3, a1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, a3, a1)]);
+  BlockBuffer odata_sorted(out()->get_size(c2, x1, a3, a1));
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   for (auto& a4 : *range_[2]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a1, c2, a4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a1, c2, a4)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, x1.size(), a1.size(), c2.size(), a4.size());
+    const double* i0data = in(0)->get_block_view(x1, a1, c2, a4);
+    BlockBuffer i0data_sorted(in(0)->get_size(x1, a1, c2, a4));
+    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), a1.size(), c2.size(), a4.size());
     // tensor label: I249
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a4, a3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, a3)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a4.size(), a3.size());
+    const double* i1data = in(1)->get_block_view(a4, a3);
+    BlockBuffer i1data_sorted(in(1)->get_size(a4, a3));
+    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), a3.size());
     dgemm_("T", "N", x1.size()*a1.size()*c2.size(), a3.size(), a4.size(),
-           1.0, i0data_sorted, a4.size(), i1data_sorted, a4.size(),
-           1.0, odata_sorted, x1.size()*a1.size()*c2.size());
+           1.0, i0data_sorted.get(), a4.size(), i1data_sorted.get(), a4.size(),
+           1.0, odata_sorted.get(), x1.size()*a1.size()*c2.size());
   }
-  sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, x1.size(), a1.size(), c2.size(), a3.size());
+  sort_indices<2,0,3,1,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), a1.size(), c2.size(), a3.size());
   out()->put_block(odata, c2, x1, a3, a1);
 }
 
@@ -40,8 +40,8 @@ void Task300::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a4, a3);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a4, a3);
-    sort_indices<0,1,1,1,2,1>(i0data, odata, a4.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(a4, a3);
+    sort_indices<0,1,1,1,2,1>(i0data, odata.get(), a4.size(), a3.size());
   }
   out()->put_block(odata, a4, a3);
 }
@@ -53,22 +53,22 @@ void Task301::Task_local::compute() {
   const Index a1 = b(3);
   // tensor label: I204
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2, x0, a1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
+  BlockBuffer odata_sorted(out()->get_size(a3, c2, x0, a1));
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   for (auto& x1 : *range_[1]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c2, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, x1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, c2.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c2, x1);
+    BlockBuffer i0data_sorted(in(0)->get_size(c2, x1));
+    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted.get(), c2.size(), x1.size());
     // tensor label: I251
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a1, a3, x0, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, a3, x0, x1)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, a1.size(), a3.size(), x0.size(), x1.size());
+    const double* i1data = in(1)->get_block_view(a1, a3, x0, x1);
+    BlockBuffer i1data_sorted(in(1)->get_size(a1, a3, x0, x1));
+    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted.get(), a1.size(), a3.size(), x0.size(), x1.size());
     dgemm_("T", "N", c2.size(), a1.size()*a3.size()*x0.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, c2.size());
+           1.0, i0data_sorted.get(), x1.size(), i1data_sorted.get(), x1.size(),
+           1.0, odata_sorted.get(), c2.size());
   }
-  sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), a3.size(), x0.size());
+  sort_indices<2,0,3,1,1,1,1,1>(odata_sorted.get(), odata.get(), c2.size(), a1.size(), a3.size(), x0.size());
   out()->put_block(odata, a3, c2, x0, a1);
 }
 
@@ -79,24 +79,24 @@ void Task302::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I251
   std::unique_ptr<double[]> odata = out()->move_block(a1, a3, x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, a3, x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(a1, a3, x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(a1, a3, x0, x1), 0.0);
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma60
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+      const double* i0data = in(0)->get_block_view(x3, x0, x2, x1);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, x0, x2, x1));
+      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x0.size(), x2.size(), x1.size());
       // tensor label: I252
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, x2, a3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, x2, a3)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), a1.size(), x2.size(), a3.size());
+      const double* i1data = in(1)->get_block_view(x3, a1, x2, a3);
+      BlockBuffer i1data_sorted(in(1)->get_size(x3, a1, x2, a3));
+      sort_indices<0,2,1,3,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), a1.size(), x2.size(), a3.size());
       dgemm_("T", "N", x0.size()*x1.size(), a1.size()*a3.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+             1.0, i0data_sorted.get(), x3.size()*x2.size(), i1data_sorted.get(), x3.size()*x2.size(),
+             1.0, odata_sorted.get(), x0.size()*x1.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a1.size(), a3.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), a1.size(), a3.size());
   out()->put_block(odata, a1, a3, x0, x1);
 }
 
@@ -109,8 +109,8 @@ void Task303::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x3, a1, x2, a3);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, x2, a3);
-    sort_indices<0,1,2,3,1,1,-2,1>(i0data, odata, x3.size(), a1.size(), x2.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(x3, a1, x2, a3);
+    sort_indices<0,1,2,3,1,1,-2,1>(i0data, odata.get(), x3.size(), a1.size(), x2.size(), a3.size());
   }
   out()->put_block(odata, x3, a1, x2, a3);
 }
@@ -124,13 +124,13 @@ void Task304::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, a2, x0, a1);
   {
     // tensor label: I253
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a1, x0, x1, a2);
-    sort_indices<2,3,1,0,1,1,1,1>(i0data, odata, a1.size(), x0.size(), x1.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(a1, x0, x1, a2);
+    sort_indices<2,3,1,0,1,1,1,1>(i0data, odata.get(), a1.size(), x0.size(), x1.size(), a2.size());
   }
   {
     // tensor label: I253
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a2, x1, x0, a1);
-    sort_indices<1,0,2,3,1,1,1,1>(i0data, odata, a2.size(), x1.size(), x0.size(), a1.size());
+    const double* i0data = in(0)->get_block_view(a2, x1, x0, a1);
+    sort_indices<1,0,2,3,1,1,1,1>(i0data, odata.get(), a2.size(), x1.size(), x0.size(), a1.size());
   }
   out()->put_block(odata, x1, a2, x0, a1);
 }
@@ -142,22 +142,22 @@ void Task305::Task_local::compute() {
   const Index a2 = b(3);
   // tensor label: I253
   std::unique_ptr<double[]> odata = out()->move_block(a1, x0, x1, a2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x1, a2)]);
+  BlockBuffer odata_sorted(out()->get_size(a1, x0, x1, a2));
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x1, a2), 0.0);
   for (auto& x2 : *range_[1]) {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x2, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, a2)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x2.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(x2, a2);
+    BlockBuffer i0data_sorted(in(0)->get_size(x2, a2));
+    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), x2.size(), a2.size());
     // tensor label: I254
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a1, x0, x2, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, x0, x2, x1)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, a1.size(), x0.size(), x2.size(), x1.size());
+    const double* i1data = in(1)->get_block_view(a1, x0, x2, x1);
+    BlockBuffer i1data_sorted(in(1)->get_size(a1, x0, x2, x1));
+    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted.get(), a1.size(), x0.size(), x2.size(), x1.size());
     dgemm_("T", "N", a2.size(), a1.size()*x0.size()*x1.size(), x2.size(),
-           1.0, i0data_sorted, x2.size(), i1data_sorted, x2.size(),
-           1.0, odata_sorted, a2.size());
+           1.0, i0data_sorted.get(), x2.size(), i1data_sorted.get(), x2.size(),
+           1.0, odata_sorted.get(), a2.size());
   }
-  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a2.size(), a1.size(), x0.size(), x1.size());
+  sort_indices<1,2,3,0,1,1,1,1>(odata_sorted.get(), odata.get(), a2.size(), a1.size(), x0.size(), x1.size());
   out()->put_block(odata, a1, x0, x1, a2);
 }
 
@@ -168,26 +168,26 @@ void Task306::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I254
   std::unique_ptr<double[]> odata = out()->move_block(a1, x0, x2, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x2, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(a1, x0, x2, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x2, x1), 0.0);
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma59
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x3, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x3, x2, x1)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
+        const double* i0data = in(0)->get_block_view(x5, x0, x4, x3, x2, x1);
+        BlockBuffer i0data_sorted(in(0)->get_size(x5, x0, x4, x3, x2, x1));
+        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
         // tensor label: I255
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a1, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a1, x4, x3)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted, x5.size(), a1.size(), x4.size(), x3.size());
+        const double* i1data = in(1)->get_block_view(x5, a1, x4, x3);
+        BlockBuffer i1data_sorted(in(1)->get_size(x5, a1, x4, x3));
+        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted.get(), x5.size(), a1.size(), x4.size(), x3.size());
         dgemm_("T", "N", x0.size()*x2.size()*x1.size(), a1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x0.size()*x2.size()*x1.size());
+               1.0, i0data_sorted.get(), x5.size()*x4.size()*x3.size(), i1data_sorted.get(), x5.size()*x4.size()*x3.size(),
+               1.0, odata_sorted.get(), x0.size()*x2.size()*x1.size());
       }
     }
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x2.size(), x1.size(), a1.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x2.size(), x1.size(), a1.size());
   out()->put_block(odata, a1, x0, x2, x1);
 }
 
@@ -200,8 +200,8 @@ void Task307::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x5, a1, x4, x3);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, x4, x3);
-    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata, x5.size(), a1.size(), x4.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(x5, a1, x4, x3);
+    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata.get(), x5.size(), a1.size(), x4.size(), x3.size());
   }
   out()->put_block(odata, x5, a1, x4, x3);
 }
@@ -213,24 +213,24 @@ void Task308::Task_local::compute() {
   const Index a2 = b(3);
   // tensor label: I253
   std::unique_ptr<double[]> odata = out()->move_block(a1, x0, x1, a2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x1, a2)]);
+  BlockBuffer odata_sorted(out()->get_size(a1, x0, x1, a2));
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x1, a2), 0.0);
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma60
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+      const double* i0data = in(0)->get_block_view(x3, x0, x2, x1);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, x0, x2, x1));
+      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x0.size(), x2.size(), x1.size());
       // tensor label: I257
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x2, x3, a1, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, x3, a1, a2)]);
-      sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, x2.size(), x3.size(), a1.size(), a2.size());
+      const double* i1data = in(1)->get_block_view(x2, x3, a1, a2);
+      BlockBuffer i1data_sorted(in(1)->get_size(x2, x3, a1, a2));
+      sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), x3.size(), a1.size(), a2.size());
       dgemm_("T", "N", x0.size()*x1.size(), a1.size()*a2.size(), x2.size()*x3.size(),
-             1.0, i0data_sorted, x2.size()*x3.size(), i1data_sorted, x2.size()*x3.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+             1.0, i0data_sorted.get(), x2.size()*x3.size(), i1data_sorted.get(), x2.size()*x3.size(),
+             1.0, odata_sorted.get(), x0.size()*x1.size());
     }
   }
-  sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a1.size(), a2.size());
+  sort_indices<2,0,1,3,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), a1.size(), a2.size());
   out()->put_block(odata, a1, x0, x1, a2);
 }
 
@@ -241,22 +241,22 @@ void Task309::Task_local::compute() {
   const Index a2 = b(3);
   // tensor label: I257
   std::unique_ptr<double[]> odata = out()->move_block(x2, x3, a1, a2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x3, a1, a2)]);
+  BlockBuffer odata_sorted(out()->get_size(x2, x3, a1, a2));
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x3, a1, a2), 0.0);
   for (auto& c3 : *range_[0]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, c3, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, c3, a2)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), c3.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(x3, a1, c3, a2);
+    BlockBuffer i0data_sorted(in(0)->get_size(x3, a1, c3, a2));
+    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a1.size(), c3.size(), a2.size());
     // tensor label: I258
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c3)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, x2.size(), c3.size());
+    const double* i1data = in(1)->get_block_view(x2, c3);
+    BlockBuffer i1data_sorted(in(1)->get_size(x2, c3));
+    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), c3.size());
     dgemm_("T", "N", x3.size()*a1.size()*a2.size(), x2.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, x3.size()*a1.size()*a2.size());
+           1.0, i0data_sorted.get(), c3.size(), i1data_sorted.get(), c3.size(),
+           1.0, odata_sorted.get(), x3.size()*a1.size()*a2.size());
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x3.size(), a1.size(), a2.size(), x2.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), a1.size(), a2.size(), x2.size());
   out()->put_block(odata, x2, x3, a1, a2);
 }
 
@@ -267,8 +267,8 @@ void Task310::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x2, c3);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x2, c3);
-    sort_indices<0,1,1,1,-1,1>(i0data, odata, x2.size(), c3.size());
+    const double* i0data = in(0)->get_block_view(x2, c3);
+    sort_indices<0,1,1,1,-1,1>(i0data, odata.get(), x2.size(), c3.size());
   }
   out()->put_block(odata, x2, c3);
 }
@@ -280,22 +280,22 @@ void Task311::Task_local::compute() {
   const Index a2 = b(3);
   // tensor label: I257
   std::unique_ptr<double[]> odata = out()->move_block(x2, x3, a1, a2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x3, a1, a2)]);
+  BlockBuffer odata_sorted(out()->get_size(x2, x3, a1, a2));
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x3, a1, a2), 0.0);
   for (auto& a3 : *range_[2]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, x2, a3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, x2, a3)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), x2.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(x3, a1, x2, a3);
+    BlockBuffer i0data_sorted(in(0)->get_size(x3, a1, x2, a3));
+    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a1.size(), x2.size(), a3.size());
     // tensor label: I263
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a3, a2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, a2)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a3.size(), a2.size());
+    const double* i1data = in(1)->get_block_view(a3, a2);
+    BlockBuffer i1data_sorted(in(1)->get_size(a3, a2));
+    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), a2.size());
     dgemm_("T", "N", x3.size()*a1.size()*x2.size(), a2.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, x3.size()*a1.size()*x2.size());
+           1.0, i0data_sorted.get(), a3.size(), i1data_sorted.get(), a3.size(),
+           1.0, odata_sorted.get(), x3.size()*a1.size()*x2.size());
   }
-  sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x3.size(), a1.size(), x2.size(), a2.size());
+  sort_indices<2,0,1,3,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), a1.size(), x2.size(), a2.size());
   out()->put_block(odata, x2, x3, a1, a2);
 }
 
@@ -306,8 +306,8 @@ void Task312::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, a2);
   {
     // tensor label: f1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a3, a2);
-    sort_indices<0,1,1,1,2,1>(i0data, odata, a3.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(a3, a2);
+    sort_indices<0,1,1,1,2,1>(i0data, odata.get(), a3.size(), a2.size());
   }
   out()->put_block(odata, a3, a2);
 }
@@ -321,8 +321,8 @@ void Task313::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, a2, x0, a1);
   {
     // tensor label: I259
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a1, a2, x0, x1);
-    sort_indices<3,1,2,0,1,1,1,1>(i0data, odata, a1.size(), a2.size(), x0.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(a1, a2, x0, x1);
+    sort_indices<3,1,2,0,1,1,1,1>(i0data, odata.get(), a1.size(), a2.size(), x0.size(), x1.size());
   }
   out()->put_block(odata, x1, a2, x0, a1);
 }
@@ -334,24 +334,24 @@ void Task314::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I259
   std::unique_ptr<double[]> odata = out()->move_block(a1, a2, x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, a2, x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(a1, a2, x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(a1, a2, x0, x1), 0.0);
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       // tensor label: Gamma90
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x1)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x1.size());
+      const double* i0data = in(0)->get_block_view(x5, x0, x4, x1);
+      BlockBuffer i0data_sorted(in(0)->get_size(x5, x0, x4, x1));
+      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), x0.size(), x4.size(), x1.size());
       // tensor label: I260
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a1, x4, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a1, x4, a2)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i1data, i1data_sorted, x5.size(), a1.size(), x4.size(), a2.size());
+      const double* i1data = in(1)->get_block_view(x5, a1, x4, a2);
+      BlockBuffer i1data_sorted(in(1)->get_size(x5, a1, x4, a2));
+      sort_indices<0,2,1,3,0,1,1,1>(i1data, i1data_sorted.get(), x5.size(), a1.size(), x4.size(), a2.size());
       dgemm_("T", "N", x0.size()*x1.size(), a1.size()*a2.size(), x5.size()*x4.size(),
-             1.0, i0data_sorted, x5.size()*x4.size(), i1data_sorted, x5.size()*x4.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+             1.0, i0data_sorted.get(), x5.size()*x4.size(), i1data_sorted.get(), x5.size()*x4.size(),
+             1.0, odata_sorted.get(), x0.size()*x1.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a1.size(), a2.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), a1.size(), a2.size());
   out()->put_block(odata, a1, a2, x0, x1);
 }
 
@@ -364,8 +364,8 @@ void Task315::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x5, a1, x4, a2);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, x4, a2);
-    sort_indices<0,1,2,3,1,1,2,1>(i0data, odata, x5.size(), a1.size(), x4.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(x5, a1, x4, a2);
+    sort_indices<0,1,2,3,1,1,2,1>(i0data, odata.get(), x5.size(), a1.size(), x4.size(), a2.size());
   }
   out()->put_block(odata, x5, a1, x4, a2);
 }
@@ -377,24 +377,24 @@ void Task316::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I259
   std::unique_ptr<double[]> odata = out()->move_block(a1, a2, x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, a2, x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(a1, a2, x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(a1, a2, x0, x1), 0.0);
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma60
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+      const double* i0data = in(0)->get_block_view(x3, x0, x2, x1);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, x0, x2, x1));
+      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x0.size(), x2.size(), x1.size());
       // tensor label: I287
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, x2, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, x2, a2)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), a1.size(), x2.size(), a2.size());
+      const double* i1data = in(1)->get_block_view(x3, a1, x2, a2);
+      BlockBuffer i1data_sorted(in(1)->get_size(x3, a1, x2, a2));
+      sort_indices<0,2,1,3,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), a1.size(), x2.size(), a2.size());
       dgemm_("T", "N", x0.size()*x1.size(), a1.size()*a2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+             1.0, i0data_sorted.get(), x3.size()*x2.size(), i1data_sorted.get(), x3.size()*x2.size(),
+             1.0, odata_sorted.get(), x0.size()*x1.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a1.size(), a2.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), a1.size(), a2.size());
   out()->put_block(odata, a1, a2, x0, x1);
 }
 
@@ -409,12 +409,12 @@ void Task317::Task_local::compute() {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, x2, a2);
     dscal_(x3.size()*a1.size()*x2.size()*a2.size(), e0_, i0data.get(), 1);
-    sort_indices<0,1,2,3,1,1,-2,1>(i0data, odata, x3.size(), a1.size(), x2.size(), a2.size());
+    sort_indices<0,1,2,3,1,1,-2,1>(i0data.get(), odata.get(), x3.size(), a1.size(), x2.size(), a2.size());
   }
   {
     // tensor label: v2
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, x2, a2);
-    sort_indices<0,1,2,3,1,1,1,1>(i1data, odata, x3.size(), a1.size(), x2.size(), a2.size());
+    const double* i1data = in(1)->get_block_view(x3, a1, x2, a2);
+    sort_indices<0,1,2,3,1,1,1,1>(i1data, odata.get(), x3.size(), a1.size(), x2.size(), a2.size());
   }
   out()->put_block(odata, x3, a1, x2, a2);
 }
@@ -428,8 +428,8 @@ void Task318::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c3, a4, c1, a2);
   {
     // tensor label: I318
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a4, c3, a2);
-    sort_indices<2,1,0,3,1,1,1,1>(i0data, odata, c1.size(), a4.size(), c3.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(c1, a4, c3, a2);
+    sort_indices<2,1,0,3,1,1,1,1>(i0data, odata.get(), c1.size(), a4.size(), c3.size(), a2.size());
   }
   out()->put_block(odata, c3, a4, c1, a2);
 }
@@ -443,13 +443,13 @@ void Task319::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c1, a4, c3, a2);
   {
     // tensor label: v2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a4, c3, a2);
-    sort_indices<0,1,2,3,1,1,-2,1>(i0data, odata, c1.size(), a4.size(), c3.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(c1, a4, c3, a2);
+    sort_indices<0,1,2,3,1,1,-2,1>(i0data, odata.get(), c1.size(), a4.size(), c3.size(), a2.size());
   }
   {
     // tensor label: v2
-    std::unique_ptr<double[]> i1data = in(0)->get_block(c1, a2, c3, a4);
-    sort_indices<0,3,2,1,1,1,4,1>(i1data, odata, c1.size(), a2.size(), c3.size(), a4.size());
+    const double* i1data = in(0)->get_block_view(c1, a2, c3, a4);
+    sort_indices<0,3,2,1,1,1,4,1>(i1data, odata.get(), c1.size(), a2.size(), c3.size(), a4.size());
   }
   out()->put_block(odata, c1, a4, c3, a2);
 }
@@ -461,14 +461,14 @@ void Task320::Task_local::compute() {
   const Index x3 = b(2);
   const Index x0 = b(3);
   // tensor label: Gamma92
-  std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x3, x1, x2);
-  std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x3, x1, x2)]);
-  sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), x3.size(), x1.size(), x2.size());
+  const double* i0data = in(0)->get_block_view(x0, x3, x1, x2);
+  BlockBuffer i0data_sorted(in(0)->get_size(x0, x3, x1, x2));
+  sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), x3.size(), x1.size(), x2.size());
   // tensor label: I335
-  std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, x1, x0);
-  std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, x1, x0)]);
-  sort_indices<3,0,2,1,0,1,1,1>(i1data, i1data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
-  target_ += ddot_(x3.size()*x2.size()*x1.size()*x0.size(), i0data_sorted, 1, i1data_sorted, 1);
+  const double* i1data = in(1)->get_block_view(x3, x2, x1, x0);
+  BlockBuffer i1data_sorted(in(1)->get_size(x3, x2, x1, x0));
+  sort_indices<3,0,2,1,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), x2.size(), x1.size(), x0.size());
+  target_ += ddot_(x3.size()*x2.size()*x1.size()*x0.size(), i0data_sorted.get(), 1, i1data_sorted.get(), 1);
 }
 
 void Task321::Task_local::compute() {
@@ -479,24 +479,24 @@ void Task321::Task_local::compute() {
   const Index x0 = b(3);
   // tensor label: I335
   std::unique_ptr<double[]> odata = out()->move_block(x3, x2, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, x2, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, x1, x0), 0.0);
   for (auto& c2 : *range_[0]) {
     for (auto& c1 : *range_[0]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x0, c2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x0, c2, x1)]);
-      sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), x0.size(), c2.size(), x1.size());
+      const double* i0data = in(0)->get_block_view(c1, x0, c2, x1);
+      BlockBuffer i0data_sorted(in(0)->get_size(c1, x0, c2, x1));
+      sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), x0.size(), c2.size(), x1.size());
       // tensor label: I336
-      std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x3, c2, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x3, c2, x2)]);
-      sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, c1.size(), x3.size(), c2.size(), x2.size());
+      const double* i1data = in(1)->get_block_view(c1, x3, c2, x2);
+      BlockBuffer i1data_sorted(in(1)->get_size(c1, x3, c2, x2));
+      sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted.get(), c1.size(), x3.size(), c2.size(), x2.size());
       dgemm_("T", "N", x1.size()*x0.size(), x3.size()*x2.size(), c1.size()*c2.size(),
-             1.0, i0data_sorted, c1.size()*c2.size(), i1data_sorted, c1.size()*c2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+             1.0, i0data_sorted.get(), c1.size()*c2.size(), i1data_sorted.get(), c1.size()*c2.size(),
+             1.0, odata_sorted.get(), x1.size()*x0.size());
     }
   }
-  sort_indices<2,3,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x3.size(), x2.size());
+  sort_indices<2,3,1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), x3.size(), x2.size());
   out()->put_block(odata, x3, x2, x1, x0);
 }
 
@@ -510,8 +510,8 @@ void Task322::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c1, x3, c2, x2);
   {
     // tensor label: v2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x3, c2, x2);
-    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata, c1.size(), x3.size(), c2.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(c1, x3, c2, x2);
+    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata.get(), c1.size(), x3.size(), c2.size(), x2.size());
   }
   out()->put_block(odata, c1, x3, c2, x2);
 }
@@ -523,14 +523,14 @@ void Task323::Task_local::compute() {
   const Index x5 = b(2);
   const Index c1 = b(3);
   // tensor label: v2
-  std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x5, x4, x3);
-  std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x5, x4, x3)]);
-  sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), x5.size(), x4.size(), x3.size());
+  const double* i0data = in(0)->get_block_view(c1, x5, x4, x3);
+  BlockBuffer i0data_sorted(in(0)->get_size(c1, x5, x4, x3));
+  sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), x5.size(), x4.size(), x3.size());
   // tensor label: I338
-  std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x5, x4, x3);
-  std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x5, x4, x3)]);
-  sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, c1.size(), x5.size(), x4.size(), x3.size());
-  target_ += ddot_(c1.size()*x5.size()*x4.size()*x3.size(), i0data_sorted, 1, i1data_sorted, 1);
+  const double* i1data = in(1)->get_block_view(c1, x5, x4, x3);
+  BlockBuffer i1data_sorted(in(1)->get_size(c1, x5, x4, x3));
+  sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted.get(), c1.size(), x5.size(), x4.size(), x3.size());
+  target_ += ddot_(c1.size()*x5.size()*x4.size()*x3.size(), i0data_sorted.get(), 1, i1data_sorted.get(), 1);
 }
 
 void Task324::Task_local::compute() {
@@ -541,26 +541,26 @@ void Task324::Task_local::compute() {
   const Index x3 = b(3);
   // tensor label: I338
   std::unique_ptr<double[]> odata = out()->move_block(c1, x5, x4, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x5, x4, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, x5, x4, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x5, x4, x3), 0.0);
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       for (auto& x0 : *range_[1]) {
         // tensor label: Gamma105
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x5, x4, x3, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, x5, x4, x3, x1, x0)]);
-        sort_indices<0,4,5,1,2,3,0,1,1,1>(i0data, i0data_sorted, x2.size(), x5.size(), x4.size(), x3.size(), x1.size(), x0.size());
+        const double* i0data = in(0)->get_block_view(x2, x5, x4, x3, x1, x0);
+        BlockBuffer i0data_sorted(in(0)->get_size(x2, x5, x4, x3, x1, x0));
+        sort_indices<0,4,5,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x2.size(), x5.size(), x4.size(), x3.size(), x1.size(), x0.size());
         // tensor label: I339
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c1, x1, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c1, x1, x0)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted, x2.size(), c1.size(), x1.size(), x0.size());
+        const double* i1data = in(1)->get_block_view(x2, c1, x1, x0);
+        BlockBuffer i1data_sorted(in(1)->get_size(x2, c1, x1, x0));
+        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), c1.size(), x1.size(), x0.size());
         dgemm_("T", "N", x5.size()*x4.size()*x3.size(), c1.size(), x2.size()*x1.size()*x0.size(),
-               1.0, i0data_sorted, x2.size()*x1.size()*x0.size(), i1data_sorted, x2.size()*x1.size()*x0.size(),
-               1.0, odata_sorted, x5.size()*x4.size()*x3.size());
+               1.0, i0data_sorted.get(), x2.size()*x1.size()*x0.size(), i1data_sorted.get(), x2.size()*x1.size()*x0.size(),
+               1.0, odata_sorted.get(), x5.size()*x4.size()*x3.size());
       }
     }
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), c1.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x5.size(), x4.size(), x3.size(), c1.size());
   out()->put_block(odata, c1, x5, x4, x3);
 }
 
@@ -574,8 +574,8 @@ void Task325::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x2, c1, x1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1, c1, x2);
-    sort_indices<3,2,1,0,1,1,1,2>(i0data, odata, x0.size(), x1.size(), c1.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x0, x1, c1, x2);
+    sort_indices<3,2,1,0,1,1,1,2>(i0data, odata.get(), x0.size(), x1.size(), c1.size(), x2.size());
   }
   out()->put_block(odata, x2, c1, x1, x0);
 }
@@ -587,14 +587,14 @@ void Task326::Task_local::compute() {
   const Index c1 = b(2);
   const Index x2 = b(3);
   // tensor label: t2
-  std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1, c1, x2);
-  std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1, c1, x2)]);
-  sort_indices<3,2,1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size(), c1.size(), x2.size());
+  const double* i0data = in(0)->get_block_view(x0, x1, c1, x2);
+  BlockBuffer i0data_sorted(in(0)->get_size(x0, x1, c1, x2));
+  sort_indices<3,2,1,0,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), x1.size(), c1.size(), x2.size());
   // tensor label: I341
-  std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x2, x1, x0);
-  std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x2, x1, x0)]);
-  sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, c1.size(), x2.size(), x1.size(), x0.size());
-  target_ += ddot_(c1.size()*x2.size()*x1.size()*x0.size(), i0data_sorted, 1, i1data_sorted, 1);
+  const double* i1data = in(1)->get_block_view(c1, x2, x1, x0);
+  BlockBuffer i1data_sorted(in(1)->get_size(c1, x2, x1, x0));
+  sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted.get(), c1.size(), x2.size(), x1.size(), x0.size());
+  target_ += ddot_(c1.size()*x2.size()*x1.size()*x0.size(), i0data_sorted.get(), 1, i1data_sorted.get(), 1);
 }
 
 void Task327::Task_local::compute() {
@@ -605,26 +605,26 @@ void Task327::Task_local::compute() {
   const Index x0 = b(3);
   // tensor label: I341
   std::unique_ptr<double[]> odata = out()->move_block(c1, x2, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x2, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, x2, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x2, x1, x0), 0.0);
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma6
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x2, x3, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x2, x3, x1, x0)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
+        const double* i0data = in(0)->get_block_view(x5, x4, x2, x3, x1, x0);
+        BlockBuffer i0data_sorted(in(0)->get_size(x5, x4, x2, x3, x1, x0));
+        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
         // tensor label: I342
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, c1, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, c1, x3)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted, x5.size(), x4.size(), c1.size(), x3.size());
+        const double* i1data = in(1)->get_block_view(x5, x4, c1, x3);
+        BlockBuffer i1data_sorted(in(1)->get_size(x5, x4, c1, x3));
+        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted.get(), x5.size(), x4.size(), c1.size(), x3.size());
         dgemm_("T", "N", x2.size()*x1.size()*x0.size(), c1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+               1.0, i0data_sorted.get(), x5.size()*x4.size()*x3.size(), i1data_sorted.get(), x5.size()*x4.size()*x3.size(),
+               1.0, odata_sorted.get(), x2.size()*x1.size()*x0.size());
       }
     }
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size(), x0.size(), c1.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x2.size(), x1.size(), x0.size(), c1.size());
   out()->put_block(odata, c1, x2, x1, x0);
 }
 
@@ -638,8 +638,8 @@ void Task328::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x5, x4, c1, x3);
   {
     // tensor label: v2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, c1, x3);
-    sort_indices<0,1,2,3,1,1,1,2>(i0data, odata, x5.size(), x4.size(), c1.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(x5, x4, c1, x3);
+    sort_indices<0,1,2,3,1,1,1,2>(i0data, odata.get(), x5.size(), x4.size(), c1.size(), x3.size());
   }
   out()->put_block(odata, x5, x4, c1, x3);
 }
@@ -649,14 +649,14 @@ void Task329::Task_local::compute() {
   const Index x1 = b(0);
   const Index x0 = b(1);
   // tensor label: Gamma16
-  std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-  std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-  sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+  const double* i0data = in(0)->get_block_view(x0, x1);
+  BlockBuffer i0data_sorted(in(0)->get_size(x0, x1));
+  sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), x1.size());
   // tensor label: I344
-  std::unique_ptr<double[]> i1data = in(1)->get_block(x0, x1);
-  std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, x1)]);
-  sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, x0.size(), x1.size());
-  target_ += ddot_(x0.size()*x1.size(), i0data_sorted, 1, i1data_sorted, 1);
+  const double* i1data = in(1)->get_block_view(x0, x1);
+  BlockBuffer i1data_sorted(in(1)->get_size(x0, x1));
+  sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), x1.size());
+  target_ += ddot_(x0.size()*x1.size(), i0data_sorted.get(), 1, i1data_sorted.get(), 1);
 }
 
 void Task330::Task_local::compute() {
@@ -665,26 +665,26 @@ void Task330::Task_local::compute() {
   const Index x1 = b(1);
   // tensor label: I344
   std::unique_ptr<double[]> odata = out()->move_block(x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1), 0.0);
   for (auto& c3 : *range_[0]) {
     for (auto& c1 : *range_[0]) {
       for (auto& a2 : *range_[2]) {
         // tensor label: v2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(c3, x1, c1, a2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, x1, c1, a2)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, c3.size(), x1.size(), c1.size(), a2.size());
+        const double* i0data = in(0)->get_block_view(c3, x1, c1, a2);
+        BlockBuffer i0data_sorted(in(0)->get_size(c3, x1, c1, a2));
+        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted.get(), c3.size(), x1.size(), c1.size(), a2.size());
         // tensor label: I345
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c3, a2, c1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c3, a2, c1)]);
-        sort_indices<1,3,2,0,0,1,1,1>(i1data, i1data_sorted, x0.size(), c3.size(), a2.size(), c1.size());
+        const double* i1data = in(1)->get_block_view(x0, c3, a2, c1);
+        BlockBuffer i1data_sorted(in(1)->get_size(x0, c3, a2, c1));
+        sort_indices<1,3,2,0,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), c3.size(), a2.size(), c1.size());
         dgemm_("T", "N", x1.size(), x0.size(), c3.size()*a2.size()*c1.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*c1.size(), i1data_sorted, c3.size()*a2.size()*c1.size(),
-               1.0, odata_sorted, x1.size());
+               1.0, i0data_sorted.get(), c3.size()*a2.size()*c1.size(), i1data_sorted.get(), c3.size()*a2.size()*c1.size(),
+               1.0, odata_sorted.get(), x1.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size());
   out()->put_block(odata, x0, x1);
 }
 
@@ -698,8 +698,8 @@ void Task331::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x0, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata, c1.size(), a2.size(), c3.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, x0);
+    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), x0.size());
   }
   out()->put_block(odata, x0, c3, a2, c1);
 }
@@ -710,26 +710,26 @@ void Task332::Task_local::compute() {
   const Index x1 = b(1);
   // tensor label: I344
   std::unique_ptr<double[]> odata = out()->move_block(x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1), 0.0);
   for (auto& c3 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, x0)]);
-        sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
+        const double* i0data = in(0)->get_block_view(c1, a2, c3, x0);
+        BlockBuffer i0data_sorted(in(0)->get_size(c1, a2, c3, x0));
+        sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size(), c3.size(), x0.size());
         // tensor label: I348
-        std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x1, c3, a2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x1, c3, a2)]);
-        sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c1.size(), x1.size(), c3.size(), a2.size());
+        const double* i1data = in(1)->get_block_view(c1, x1, c3, a2);
+        BlockBuffer i1data_sorted(in(1)->get_size(c1, x1, c3, a2));
+        sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted.get(), c1.size(), x1.size(), c3.size(), a2.size());
         dgemm_("T", "N", x0.size(), x1.size(), c1.size()*c3.size()*a2.size(),
-               1.0, i0data_sorted, c1.size()*c3.size()*a2.size(), i1data_sorted, c1.size()*c3.size()*a2.size(),
-               1.0, odata_sorted, x0.size());
+               1.0, i0data_sorted.get(), c1.size()*c3.size()*a2.size(), i1data_sorted.get(), c1.size()*c3.size()*a2.size(),
+               1.0, odata_sorted.get(), x0.size());
       }
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size());
   out()->put_block(odata, x0, x1);
 }
 
@@ -743,8 +743,8 @@ void Task333::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c1, x1, c3, a2);
   {
     // tensor label: v2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x1, c3, a2);
-    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata, c1.size(), x1.size(), c3.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(c1, x1, c3, a2);
+    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata.get(), c1.size(), x1.size(), c3.size(), a2.size());
   }
   out()->put_block(odata, c1, x1, c3, a2);
 }
@@ -756,14 +756,14 @@ void Task334::Task_local::compute() {
   const Index x2 = b(2);
   const Index x3 = b(3);
   // tensor label: Gamma35
-  std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-  std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-  sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+  const double* i0data = in(0)->get_block_view(x3, x2, x1, x0);
+  BlockBuffer i0data_sorted(in(0)->get_size(x3, x2, x1, x0));
+  sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x2.size(), x1.size(), x0.size());
   // tensor label: I350
-  std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, x1, x0);
-  std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, x1, x0)]);
-  sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
-  target_ += ddot_(x3.size()*x2.size()*x1.size()*x0.size(), i0data_sorted, 1, i1data_sorted, 1);
+  const double* i1data = in(1)->get_block_view(x3, x2, x1, x0);
+  BlockBuffer i1data_sorted(in(1)->get_size(x3, x2, x1, x0));
+  sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), x2.size(), x1.size(), x0.size());
+  target_ += ddot_(x3.size()*x2.size()*x1.size()*x0.size(), i0data_sorted.get(), 1, i1data_sorted.get(), 1);
 }
 
 void Task335::Task_local::compute() {
@@ -774,24 +774,24 @@ void Task335::Task_local::compute() {
   const Index x0 = b(3);
   // tensor label: I350
   std::unique_ptr<double[]> odata = out()->move_block(x3, x2, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, x2, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, x1, x0), 0.0);
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, x1)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
+      const double* i0data = in(0)->get_block_view(x0, a1, c2, x1);
+      BlockBuffer i0data_sorted(in(0)->get_size(x0, a1, c2, x1));
+      sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), a1.size(), c2.size(), x1.size());
       // tensor label: I351
-      std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x3, x2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x3.size(), x2.size());
+      const double* i1data = in(1)->get_block_view(c2, a1, x3, x2);
+      BlockBuffer i1data_sorted(in(1)->get_size(c2, a1, x3, x2));
+      sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted.get(), c2.size(), a1.size(), x3.size(), x2.size());
       dgemm_("T", "N", x1.size()*x0.size(), x3.size()*x2.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+             1.0, i0data_sorted.get(), c2.size()*a1.size(), i1data_sorted.get(), c2.size()*a1.size(),
+             1.0, odata_sorted.get(), x1.size()*x0.size());
     }
   }
-  sort_indices<2,3,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x3.size(), x2.size());
+  sort_indices<2,3,1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), x3.size(), x2.size());
   out()->put_block(odata, x3, x2, x1, x0);
 }
 
@@ -805,8 +805,8 @@ void Task336::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c2, a1, x3, x2);
   {
     // tensor label: v2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, x3, x2);
-    sort_indices<0,1,2,3,1,1,-1,2>(i0data, odata, c2.size(), a1.size(), x3.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(c2, a1, x3, x2);
+    sort_indices<0,1,2,3,1,1,-1,2>(i0data, odata.get(), c2.size(), a1.size(), x3.size(), x2.size());
   }
   out()->put_block(odata, c2, a1, x3, x2);
 }
@@ -819,24 +819,24 @@ void Task337::Task_local::compute() {
   const Index x0 = b(3);
   // tensor label: I350
   std::unique_ptr<double[]> odata = out()->move_block(x3, x2, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, x2, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, x1, x0), 0.0);
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: v2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, c2, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, c2, a1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), c2.size(), a1.size());
+      const double* i0data = in(0)->get_block_view(x3, x2, c2, a1);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, x2, c2, a1));
+      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x2.size(), c2.size(), a1.size());
       // tensor label: I360
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c2, a1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c2, a1, x0)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), c2.size(), a1.size(), x0.size());
+      const double* i1data = in(1)->get_block_view(x1, c2, a1, x0);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, c2, a1, x0));
+      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), c2.size(), a1.size(), x0.size());
       dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), c2.size()*a1.size(), i1data_sorted.get(), c2.size()*a1.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<0,1,2,3,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<0,1,2,3,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x3, x2, x1, x0);
 }
 
@@ -850,8 +850,8 @@ void Task338::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-    sort_indices<3,2,1,0,1,1,-1,2>(i0data, odata, x0.size(), a1.size(), c2.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, x1);
+    sort_indices<3,2,1,0,1,1,-1,2>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), x1.size());
   }
   out()->put_block(odata, x1, c2, a1, x0);
 }
@@ -864,24 +864,24 @@ void Task339::Task_local::compute() {
   const Index x0 = b(3);
   // tensor label: I350
   std::unique_ptr<double[]> odata = out()->move_block(x3, x2, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, x2, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, x1, x0), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: v2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, x3, x2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), x3.size(), x2.size());
+      const double* i0data = in(0)->get_block_view(c1, a2, x3, x2);
+      BlockBuffer i0data_sorted(in(0)->get_size(c1, a2, x3, x2));
+      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size(), x3.size(), x2.size());
       // tensor label: I363
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, a2, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, a2, c1)]);
-      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), a2.size(), c1.size());
+      const double* i1data = in(1)->get_block_view(x1, x0, a2, c1);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, a2, c1));
+      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), a2.size(), c1.size());
       dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), a2.size()*c1.size(), i1data_sorted.get(), a2.size()*c1.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<0,1,2,3,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<0,1,2,3,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x3, x2, x1, x0);
 }
 
@@ -895,8 +895,8 @@ void Task340::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x0, x1);
-    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata, c1.size(), a2.size(), x0.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, x0, x1);
+    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata.get(), c1.size(), a2.size(), x0.size(), x1.size());
   }
   out()->put_block(odata, x1, x0, a2, c1);
 }
@@ -909,24 +909,24 @@ void Task341::Task_local::compute() {
   const Index x0 = b(3);
   // tensor label: I350
   std::unique_ptr<double[]> odata = out()->move_block(x3, x2, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, x2, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, x1, x0), 0.0);
   for (auto& a2 : *range_[2]) {
     for (auto& c1 : *range_[0]) {
       // tensor label: v2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a2, c1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a2, c1, x2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a2.size(), c1.size(), x2.size());
+      const double* i0data = in(0)->get_block_view(x3, a2, c1, x2);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, a2, c1, x2));
+      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a2.size(), c1.size(), x2.size());
       // tensor label: I369
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, a2, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, a2, c1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), a2.size(), c1.size());
+      const double* i1data = in(1)->get_block_view(x1, x0, a2, c1);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, a2, c1));
+      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), a2.size(), c1.size());
       dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), a2.size()*c1.size(), i1data_sorted.get(), a2.size()*c1.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<0,1,2,3,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<0,1,2,3,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x3, x2, x1, x0);
 }
 
@@ -940,8 +940,8 @@ void Task342::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x0, x1);
-    sort_indices<3,2,1,0,1,1,-1,2>(i0data, odata, c1.size(), a2.size(), x0.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, x0, x1);
+    sort_indices<3,2,1,0,1,1,-1,2>(i0data, odata.get(), c1.size(), a2.size(), x0.size(), x1.size());
   }
   out()->put_block(odata, x1, x0, a2, c1);
 }
@@ -954,24 +954,24 @@ void Task343::Task_local::compute() {
   const Index x0 = b(3);
   // tensor label: I350
   std::unique_ptr<double[]> odata = out()->move_block(x3, x2, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, x2, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, x1, x0), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: v2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, c1, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, c1, a2)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), c1.size(), a2.size());
+      const double* i0data = in(0)->get_block_view(x3, x2, c1, a2);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, x2, c1, a2));
+      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x2.size(), c1.size(), a2.size());
       // tensor label: I372
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, a2, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, a2, c1)]);
-      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), a2.size(), c1.size());
+      const double* i1data = in(1)->get_block_view(x1, x0, a2, c1);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, a2, c1));
+      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), a2.size(), c1.size());
       dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), a2.size()*c1.size(), i1data_sorted.get(), a2.size()*c1.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<0,1,2,3,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<0,1,2,3,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x3, x2, x1, x0);
 }
 
@@ -985,8 +985,8 @@ void Task344::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x0, x1);
-    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata, c1.size(), a2.size(), x0.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, x0, x1);
+    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata.get(), c1.size(), a2.size(), x0.size(), x1.size());
   }
   out()->put_block(odata, x1, x0, a2, c1);
 }
@@ -998,14 +998,14 @@ void Task345::Task_local::compute() {
   const Index x3 = b(2);
   const Index x1 = b(3);
   // tensor label: Gamma29
-  std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x3, x2, x0);
-  std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x3, x2, x0)]);
-  sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), x3.size(), x2.size(), x0.size());
+  const double* i0data = in(0)->get_block_view(x1, x3, x2, x0);
+  BlockBuffer i0data_sorted(in(0)->get_size(x1, x3, x2, x0));
+  sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), x3.size(), x2.size(), x0.size());
   // tensor label: I353
-  std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, x3, x2);
-  std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, x3, x2)]);
-  sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), x3.size(), x2.size());
-  target_ += ddot_(x1.size()*x0.size()*x3.size()*x2.size(), i0data_sorted, 1, i1data_sorted, 1);
+  const double* i1data = in(1)->get_block_view(x1, x0, x3, x2);
+  BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, x3, x2));
+  sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), x3.size(), x2.size());
+  target_ += ddot_(x1.size()*x0.size()*x3.size()*x2.size(), i0data_sorted.get(), 1, i1data_sorted.get(), 1);
 }
 
 void Task346::Task_local::compute() {
@@ -1016,24 +1016,24 @@ void Task346::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I353
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: v2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c2, x3, x2, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, x3, x2, a1)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, c2.size(), x3.size(), x2.size(), a1.size());
+      const double* i0data = in(0)->get_block_view(c2, x3, x2, a1);
+      BlockBuffer i0data_sorted(in(0)->get_size(c2, x3, x2, a1));
+      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted.get(), c2.size(), x3.size(), x2.size(), a1.size());
       // tensor label: I354
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c2, a1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c2, a1, x0)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), c2.size(), a1.size(), x0.size());
+      const double* i1data = in(1)->get_block_view(x1, c2, a1, x0);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, c2, a1, x0));
+      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), c2.size(), a1.size(), x0.size());
       dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), c2.size()*a1.size(), i1data_sorted.get(), c2.size()*a1.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0, x3, x2);
 }
 
@@ -1047,8 +1047,8 @@ void Task347::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-    sort_indices<3,2,1,0,1,1,-1,2>(i0data, odata, x0.size(), a1.size(), c2.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, x1);
+    sort_indices<3,2,1,0,1,1,-1,2>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), x1.size());
   }
   out()->put_block(odata, x1, c2, a1, x0);
 }
@@ -1060,14 +1060,14 @@ void Task348::Task_local::compute() {
   const Index x0 = b(2);
   const Index x3 = b(3);
   // tensor label: Gamma32
-  std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x1, x2);
-  std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x1, x2)]);
-  sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x1.size(), x2.size());
+  const double* i0data = in(0)->get_block_view(x3, x0, x1, x2);
+  BlockBuffer i0data_sorted(in(0)->get_size(x3, x0, x1, x2));
+  sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x0.size(), x1.size(), x2.size());
   // tensor label: I356
-  std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, x3, x2);
-  std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, x3, x2)]);
-  sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), x3.size(), x2.size());
-  target_ += ddot_(x1.size()*x0.size()*x3.size()*x2.size(), i0data_sorted, 1, i1data_sorted, 1);
+  const double* i1data = in(1)->get_block_view(x1, x0, x3, x2);
+  BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, x3, x2));
+  sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), x3.size(), x2.size());
+  target_ += ddot_(x1.size()*x0.size()*x3.size()*x2.size(), i0data_sorted.get(), 1, i1data_sorted.get(), 1);
 }
 
 void Task349::Task_local::compute() {
@@ -1078,24 +1078,24 @@ void Task349::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I356
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   for (auto& a1 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       // tensor label: v2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, c2, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, c2, x2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), c2.size(), x2.size());
+      const double* i0data = in(0)->get_block_view(x3, a1, c2, x2);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, a1, c2, x2));
+      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a1.size(), c2.size(), x2.size());
       // tensor label: I357
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c2, a1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c2, a1, x0)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), c2.size(), a1.size(), x0.size());
+      const double* i1data = in(1)->get_block_view(x1, c2, a1, x0);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, c2, a1, x0));
+      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), c2.size(), a1.size(), x0.size());
       dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), c2.size()*a1.size(), i1data_sorted.get(), c2.size()*a1.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0, x3, x2);
 }
 
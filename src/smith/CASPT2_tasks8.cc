@@ -43,8 +43,8 @@ void Task350::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-    sort_indices<3,2,1,0,1,1,1,2>(i0data, odata, x0.size(), a1.size(), c2.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, x1);
+    sort_indices<3,2,1,0,1,1,1,2>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), x1.size());
   }
   out()->put_block(odata, x1, c2, a1, x0);
 }
@@ -56,14 +56,14 @@ void Task351::Task_local::compute() {
   const Index x3 = b(2);
   const Index x2 = b(3);
   // tensor label: Gamma7
-  std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x3, x1, x0);
-  std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, x3, x1, x0)]);
-  sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x2.size(), x3.size(), x1.size(), x0.size());
+  const double* i0data = in(0)->get_block_view(x2, x3, x1, x0);
+  BlockBuffer i0data_sorted(in(0)->get_size(x2, x3, x1, x0));
+  sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x2.size(), x3.size(), x1.size(), x0.size());
   // tensor label: I365
-  std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, x3, x2);
-  std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, x3, x2)]);
-  sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), x3.size(), x2.size());
-  target_ += ddot_(x1.size()*x0.size()*x3.size()*x2.size(), i0data_sorted, 1, i1data_sorted, 1);
+  const double* i1data = in(1)->get_block_view(x1, x0, x3, x2);
+  BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, x3, x2));
+  sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), x3.size(), x2.size());
+  target_ += ddot_(x1.size()*x0.size()*x3.size()*x2.size(), i0data_sorted.get(), 1, i1data_sorted.get(), 1);
 }
 
 void Task352::Task_local::compute() {
@@ -74,24 +74,24 @@ void Task352::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I365
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: v2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x3, x2, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x3, x2, a2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), x3.size(), x2.size(), a2.size());
+      const double* i0data = in(0)->get_block_view(c1, x3, x2, a2);
+      BlockBuffer i0data_sorted(in(0)->get_size(c1, x3, x2, a2));
+      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), x3.size(), x2.size(), a2.size());
       // tensor label: I366
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, a2, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, a2, c1)]);
-      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), a2.size(), c1.size());
+      const double* i1data = in(1)->get_block_view(x1, x0, a2, c1);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, a2, c1));
+      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), a2.size(), c1.size());
       dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), a2.size()*c1.size(), i1data_sorted.get(), a2.size()*c1.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0, x3, x2);
 }
 
@@ -105,8 +105,8 @@ void Task353::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x0, x1);
-    sort_indices<3,2,1,0,1,1,1,2>(i0data, odata, c1.size(), a2.size(), x0.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, x0, x1);
+    sort_indices<3,2,1,0,1,1,1,2>(i0data, odata.get(), c1.size(), a2.size(), x0.size(), x1.size());
   }
   out()->put_block(odata, x1, x0, a2, c1);
 }
@@ -120,14 +120,14 @@ void Task354::Task_local::compute() {
   const Index x0 = b(4);
   const Index x5 = b(5);
   // tensor label: Gamma59
-  std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x3, x2, x1);
-  std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x3, x2, x1)]);
-  sort_indices<0,1,2,3,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
+  const double* i0data = in(0)->get_block_view(x5, x0, x4, x3, x2, x1);
+  BlockBuffer i0data_sorted(in(0)->get_size(x5, x0, x4, x3, x2, x1));
+  sort_indices<0,1,2,3,4,5,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
   // tensor label: I374
-  std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, x3, x2, x1, x0);
-  std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, x3, x2, x1, x0)]);
-  sort_indices<0,5,1,2,3,4,0,1,1,1>(i1data, i1data_sorted, x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
-  target_ += ddot_(x5.size()*x4.size()*x3.size()*x2.size()*x1.size()*x0.size(), i0data_sorted, 1, i1data_sorted, 1);
+  const double* i1data = in(1)->get_block_view(x5, x4, x3, x2, x1, x0);
+  BlockBuffer i1data_sorted(in(1)->get_size(x5, x4, x3, x2, x1, x0));
+  sort_indices<0,5,1,2,3,4,0,1,1,1>(i1data, i1data_sorted.get(), x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
+  target_ += ddot_(x5.size()*x4.size()*x3.size()*x2.size()*x1.size()*x0.size(), i0data_sorted.get(), 1, i1data_sorted.get(), 1);
 }
 
 void Task355::Task_local::compute() {
@@ -140,22 +140,22 @@ void Task355::Task_local::compute() {
   const Index x0 = b(5);
   // tensor label: I374
   std::unique_ptr<double[]> odata = out()->move_block(x5, x4, x3, x2, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x5, x4, x3, x2, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x5, x4, x3, x2, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x5, x4, x3, x2, x1, x0), 0.0);
   for (auto& a1 : *range_[2]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, x1, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, x1, x2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), x1.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, x1, x2);
+    BlockBuffer i0data_sorted(in(0)->get_size(x0, a1, x1, x2));
+    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), a1.size(), x1.size(), x2.size());
     // tensor label: I375
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a1, x4, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a1, x4, x3)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, x5.size(), a1.size(), x4.size(), x3.size());
+    const double* i1data = in(1)->get_block_view(x5, a1, x4, x3);
+    BlockBuffer i1data_sorted(in(1)->get_size(x5, a1, x4, x3));
+    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted.get(), x5.size(), a1.size(), x4.size(), x3.size());
     dgemm_("T", "N", x2.size()*x1.size()*x0.size(), x5.size()*x4.size()*x3.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+           1.0, i0data_sorted.get(), a1.size(), i1data_sorted.get(), a1.size(),
+           1.0, odata_sorted.get(), x2.size()*x1.size()*x0.size());
   }
-  sort_indices<3,4,5,2,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x5.size(), x4.size(), x3.size());
+  sort_indices<3,4,5,2,1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), x2.size(), x5.size(), x4.size(), x3.size());
   out()->put_block(odata, x5, x4, x3, x2, x1, x0);
 }
 
@@ -169,8 +169,8 @@ void Task356::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x5, a1, x4, x3);
   {
     // tensor label: v2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, x4, x3);
-    sort_indices<0,1,2,3,1,1,1,2>(i0data, odata, x5.size(), a1.size(), x4.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(x5, a1, x4, x3);
+    sort_indices<0,1,2,3,1,1,1,2>(i0data, odata.get(), x5.size(), a1.size(), x4.size(), x3.size());
   }
   out()->put_block(odata, x5, a1, x4, x3);
 }
@@ -184,14 +184,14 @@ void Task357::Task_local::compute() {
   const Index x4 = b(4);
   const Index x5 = b(5);
   // tensor label: Gamma57
-  std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x3, x0, x2, x1);
-  std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x3, x0, x2, x1)]);
-  sort_indices<0,1,2,3,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x3.size(), x0.size(), x2.size(), x1.size());
+  const double* i0data = in(0)->get_block_view(x5, x4, x3, x0, x2, x1);
+  BlockBuffer i0data_sorted(in(0)->get_size(x5, x4, x3, x0, x2, x1));
+  sort_indices<0,1,2,3,4,5,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), x4.size(), x3.size(), x0.size(), x2.size(), x1.size());
   // tensor label: I377
-  std::unique_ptr<double[]> i1data = in(1)->get_block(x2, x1, x0, x5, x4, x3);
-  std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, x1, x0, x5, x4, x3)]);
-  sort_indices<3,4,5,2,0,1,0,1,1,1>(i1data, i1data_sorted, x2.size(), x1.size(), x0.size(), x5.size(), x4.size(), x3.size());
-  target_ += ddot_(x2.size()*x1.size()*x0.size()*x5.size()*x4.size()*x3.size(), i0data_sorted, 1, i1data_sorted, 1);
+  const double* i1data = in(1)->get_block_view(x2, x1, x0, x5, x4, x3);
+  BlockBuffer i1data_sorted(in(1)->get_size(x2, x1, x0, x5, x4, x3));
+  sort_indices<3,4,5,2,0,1,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), x1.size(), x0.size(), x5.size(), x4.size(), x3.size());
+  target_ += ddot_(x2.size()*x1.size()*x0.size()*x5.size()*x4.size()*x3.size(), i0data_sorted.get(), 1, i1data_sorted.get(), 1);
 }
 
 void Task358::Task_local::compute() {
@@ -204,22 +204,22 @@ void Task358::Task_local::compute() {
   const Index x3 = b(5);
   // tensor label: I377
   std::unique_ptr<double[]> odata = out()->move_block(x2, x1, x0, x5, x4, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1, x0, x5, x4, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(x2, x1, x0, x5, x4, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1, x0, x5, x4, x3), 0.0);
   for (auto& a1 : *range_[2]) {
     // tensor label: v2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x3, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x3, a1)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x3.size(), a1.size());
+    const double* i0data = in(0)->get_block_view(x5, x4, x3, a1);
+    BlockBuffer i0data_sorted(in(0)->get_size(x5, x4, x3, a1));
+    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), x4.size(), x3.size(), a1.size());
     // tensor label: I378
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x2, x1, a1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, x1, a1, x0)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x2.size(), x1.size(), a1.size(), x0.size());
+    const double* i1data = in(1)->get_block_view(x2, x1, a1, x0);
+    BlockBuffer i1data_sorted(in(1)->get_size(x2, x1, a1, x0));
+    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), x1.size(), a1.size(), x0.size());
     dgemm_("T", "N", x5.size()*x4.size()*x3.size(), x2.size()*x1.size()*x0.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, x5.size()*x4.size()*x3.size());
+           1.0, i0data_sorted.get(), a1.size(), i1data_sorted.get(), a1.size(),
+           1.0, odata_sorted.get(), x5.size()*x4.size()*x3.size());
   }
-  sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x2, x1, x0, x5, x4, x3);
 }
 
@@ -233,8 +233,8 @@ void Task359::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x2, x1, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, x1, x2);
-    sort_indices<3,2,1,0,1,1,1,2>(i0data, odata, x0.size(), a1.size(), x1.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, x1, x2);
+    sort_indices<3,2,1,0,1,1,1,2>(i0data, odata.get(), x0.size(), a1.size(), x1.size(), x2.size());
   }
   out()->put_block(odata, x2, x1, a1, x0);
 }
@@ -246,14 +246,14 @@ void Task360::Task_local::compute() {
   const Index a4 = b(2);
   const Index c1 = b(3);
   // tensor label: v2
-  std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a4, c3, a2);
-  std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a4, c3, a2)]);
-  sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a4.size(), c3.size(), a2.size());
+  const double* i0data = in(0)->get_block_view(c1, a4, c3, a2);
+  BlockBuffer i0data_sorted(in(0)->get_size(c1, a4, c3, a2));
+  sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a4.size(), c3.size(), a2.size());
   // tensor label: I380
-  std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c3, a2, c1);
-  std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c3, a2, c1)]);
-  sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, a4.size(), c3.size(), a2.size(), c1.size());
-  target_ += ddot_(a4.size()*c3.size()*a2.size()*c1.size(), i0data_sorted, 1, i1data_sorted, 1);
+  const double* i1data = in(1)->get_block_view(a4, c3, a2, c1);
+  BlockBuffer i1data_sorted(in(1)->get_size(a4, c3, a2, c1));
+  sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), c3.size(), a2.size(), c1.size());
+  target_ += ddot_(a4.size()*c3.size()*a2.size()*c1.size(), i0data_sorted.get(), 1, i1data_sorted.get(), 1);
 }
 
 void Task361::Task_local::compute() {
@@ -266,8 +266,8 @@ void Task361::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a4, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata, c1.size(), a2.size(), c3.size(), a4.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, a4);
+    sort_indices<3,2,1,0,1,1,-2,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), a4.size());
   }
   out()->put_block(odata, a4, c3, a2, c1);
 }
@@ -279,14 +279,14 @@ void Task362::Task_local::compute() {
   const Index a2 = b(2);
   const Index c1 = b(3);
   // tensor label: v2
-  std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-  std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, a4)]);
-  sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
+  const double* i0data = in(0)->get_block_view(c1, a2, c3, a4);
+  BlockBuffer i0data_sorted(in(0)->get_size(c1, a2, c3, a4));
+  sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size(), c3.size(), a4.size());
   // tensor label: I382
-  std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c3, a2, c1);
-  std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c3, a2, c1)]);
-  sort_indices<3,2,1,0,0,1,1,1>(i1data, i1data_sorted, a4.size(), c3.size(), a2.size(), c1.size());
-  target_ += ddot_(a4.size()*c3.size()*a2.size()*c1.size(), i0data_sorted, 1, i1data_sorted, 1);
+  const double* i1data = in(1)->get_block_view(a4, c3, a2, c1);
+  BlockBuffer i1data_sorted(in(1)->get_size(a4, c3, a2, c1));
+  sort_indices<3,2,1,0,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), c3.size(), a2.size(), c1.size());
+  target_ += ddot_(a4.size()*c3.size()*a2.size()*c1.size(), i0data_sorted.get(), 1, i1data_sorted.get(), 1);
 }
 
 void Task363::Task_local::compute() {
@@ -299,8 +299,8 @@ void Task363::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a4, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata, c1.size(), a2.size(), c3.size(), a4.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, a4);
+    sort_indices<3,2,1,0,1,1,4,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), a4.size());
   }
   out()->put_block(odata, a4, c3, a2, c1);
 }
@@ -310,14 +310,14 @@ void Task364::Task_local::compute() {
   const Index x0 = b(0);
   const Index x1 = b(1);
   // tensor label: Gamma38
-  std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-  std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-  sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+  const double* i0data = in(0)->get_block_view(x1, x0);
+  BlockBuffer i0data_sorted(in(0)->get_size(x1, x0));
+  sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), x0.size());
   // tensor label: I384
-  std::unique_ptr<double[]> i1data = in(1)->get_block(x0, x1);
-  std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, x1)]);
-  sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, x0.size(), x1.size());
-  target_ += ddot_(x0.size()*x1.size(), i0data_sorted, 1, i1data_sorted, 1);
+  const double* i1data = in(1)->get_block_view(x0, x1);
+  BlockBuffer i1data_sorted(in(1)->get_size(x0, x1));
+  sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), x1.size());
+  target_ += ddot_(x0.size()*x1.size(), i0data_sorted.get(), 1, i1data_sorted.get(), 1);
 }
 
 void Task365::Task_local::compute() {
@@ -326,26 +326,26 @@ void Task365::Task_local::compute() {
   const Index x1 = b(1);
   // tensor label: I384
   std::unique_ptr<double[]> odata = out()->move_block(x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1), 0.0);
   for (auto& a3 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a1 : *range_[2]) {
         // tensor label: v2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a3, c2, a1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a3, c2, a1)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), a3.size(), c2.size(), a1.size());
+        const double* i0data = in(0)->get_block_view(x1, a3, c2, a1);
+        BlockBuffer i0data_sorted(in(0)->get_size(x1, a3, c2, a1));
+        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), a3.size(), c2.size(), a1.size());
         // tensor label: I385
-        std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, a1, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, a1, x0)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), a1.size(), x0.size());
+        const double* i1data = in(1)->get_block_view(a3, c2, a1, x0);
+        BlockBuffer i1data_sorted(in(1)->get_size(a3, c2, a1, x0));
+        sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), c2.size(), a1.size(), x0.size());
         dgemm_("T", "N", x1.size(), x0.size(), a3.size()*c2.size()*a1.size(),
-               1.0, i0data_sorted, a3.size()*c2.size()*a1.size(), i1data_sorted, a3.size()*c2.size()*a1.size(),
-               1.0, odata_sorted, x1.size());
+               1.0, i0data_sorted.get(), a3.size()*c2.size()*a1.size(), i1data_sorted.get(), a3.size()*c2.size()*a1.size(),
+               1.0, odata_sorted.get(), x1.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size());
   out()->put_block(odata, x0, x1);
 }
 
@@ -359,8 +359,8 @@ void Task366::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-    sort_indices<3,2,1,0,1,1,-1,1>(i0data, odata, x0.size(), a1.size(), c2.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, a3);
+    sort_indices<3,2,1,0,1,1,-1,1>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), a3.size());
   }
   out()->put_block(odata, a3, c2, a1, x0);
 }
@@ -371,26 +371,26 @@ void Task367::Task_local::compute() {
   const Index x1 = b(1);
   // tensor label: I384
   std::unique_ptr<double[]> odata = out()->move_block(x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1), 0.0);
   for (auto& a3 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a1 : *range_[2]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, a3)]);
-        sort_indices<3,2,1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
+        const double* i0data = in(0)->get_block_view(x0, a1, c2, a3);
+        BlockBuffer i0data_sorted(in(0)->get_size(x0, a1, c2, a3));
+        sort_indices<3,2,1,0,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), a1.size(), c2.size(), a3.size());
         // tensor label: I388
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a1, c2, a3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a1, c2, a3)]);
-        sort_indices<3,2,1,0,0,1,1,1>(i1data, i1data_sorted, x1.size(), a1.size(), c2.size(), a3.size());
+        const double* i1data = in(1)->get_block_view(x1, a1, c2, a3);
+        BlockBuffer i1data_sorted(in(1)->get_size(x1, a1, c2, a3));
+        sort_indices<3,2,1,0,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), a1.size(), c2.size(), a3.size());
         dgemm_("T", "N", x0.size(), x1.size(), a1.size()*c2.size()*a3.size(),
-               1.0, i0data_sorted, a1.size()*c2.size()*a3.size(), i1data_sorted, a1.size()*c2.size()*a3.size(),
-               1.0, odata_sorted, x0.size());
+               1.0, i0data_sorted.get(), a1.size()*c2.size()*a3.size(), i1data_sorted.get(), a1.size()*c2.size()*a3.size(),
+               1.0, odata_sorted.get(), x0.size());
       }
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size());
   out()->put_block(odata, x0, x1);
 }
 
@@ -404,8 +404,8 @@ void Task368::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, a1, c2, a3);
   {
     // tensor label: v2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a1, c2, a3);
-    sort_indices<0,1,2,3,1,1,2,1>(i0data, odata, x1.size(), a1.size(), c2.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(x1, a1, c2, a3);
+    sort_indices<0,1,2,3,1,1,2,1>(i0data, odata.get(), x1.size(), a1.size(), c2.size(), a3.size());
   }
   out()->put_block(odata, x1, a1, c2, a3);
 }
@@ -416,24 +416,24 @@ void Task369::Task_local::compute() {
   const Index x1 = b(1);
   // tensor label: I384
   std::unique_ptr<double[]> odata = out()->move_block(x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1), 0.0);
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: h1
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size());
+      const double* i0data = in(0)->get_block_view(c2, a1);
+      BlockBuffer i0data_sorted(in(0)->get_size(c2, a1));
+      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), c2.size(), a1.size());
       // tensor label: I397
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c2, a1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c2, a1, x0)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), c2.size(), a1.size(), x0.size());
+      const double* i1data = in(1)->get_block_view(x1, c2, a1, x0);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, c2, a1, x0));
+      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), c2.size(), a1.size(), x0.size());
       dgemm_("T", "N", 1, x1.size()*x0.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, 1);
+             1.0, i0data_sorted.get(), c2.size()*a1.size(), i1data_sorted.get(), c2.size()*a1.size(),
+             1.0, odata_sorted.get(), 1);
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size());
   out()->put_block(odata, x0, x1);
 }
 
@@ -447,8 +447,8 @@ void Task370::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-    sort_indices<3,2,1,0,1,1,-1,1>(i0data, odata, x0.size(), a1.size(), c2.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, x1);
+    sort_indices<3,2,1,0,1,1,-1,1>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), x1.size());
   }
   out()->put_block(odata, x1, c2, a1, x0);
 }
@@ -459,24 +459,24 @@ void Task371::Task_local::compute() {
   const Index x1 = b(1);
   // tensor label: I384
   std::unique_ptr<double[]> odata = out()->move_block(x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: h1
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size());
+      const double* i0data = in(0)->get_block_view(c1, a2);
+      BlockBuffer i0data_sorted(in(0)->get_size(c1, a2));
+      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size());
       // tensor label: I400
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, a2, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, a2, c1)]);
-      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), a2.size(), c1.size());
+      const double* i1data = in(1)->get_block_view(x1, x0, a2, c1);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, a2, c1));
+      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), a2.size(), c1.size());
       dgemm_("T", "N", 1, x1.size()*x0.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, 1);
+             1.0, i0data_sorted.get(), a2.size()*c1.size(), i1data_sorted.get(), a2.size()*c1.size(),
+             1.0, odata_sorted.get(), 1);
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size());
   out()->put_block(odata, x0, x1);
 }
 
@@ -490,8 +490,8 @@ void Task372::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x0, x1);
-    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata, c1.size(), a2.size(), x0.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, x0, x1);
+    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata.get(), c1.size(), a2.size(), x0.size(), x1.size());
   }
   out()->put_block(odata, x1, x0, a2, c1);
 }
@@ -503,14 +503,14 @@ void Task373::Task_local::compute() {
   const Index x0 = b(2);
   const Index x3 = b(3);
   // tensor label: Gamma60
-  std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-  std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-  sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+  const double* i0data = in(0)->get_block_view(x3, x0, x2, x1);
+  BlockBuffer i0data_sorted(in(0)->get_size(x3, x0, x2, x1));
+  sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x0.size(), x2.size(), x1.size());
   // tensor label: I390
-  std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, x1, x0);
-  std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, x1, x0)]);
-  sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
-  target_ += ddot_(x3.size()*x2.size()*x1.size()*x0.size(), i0data_sorted, 1, i1data_sorted, 1);
+  const double* i1data = in(1)->get_block_view(x3, x2, x1, x0);
+  BlockBuffer i1data_sorted(in(1)->get_size(x3, x2, x1, x0));
+  sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), x2.size(), x1.size(), x0.size());
+  target_ += ddot_(x3.size()*x2.size()*x1.size()*x0.size(), i0data_sorted.get(), 1, i1data_sorted.get(), 1);
 }
 
 void Task374::Task_local::compute() {
@@ -521,24 +521,24 @@ void Task374::Task_local::compute() {
   const Index x0 = b(3);
   // tensor label: I390
   std::unique_ptr<double[]> odata = out()->move_block(x3, x2, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, x2, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, x1, x0), 0.0);
   for (auto& a2 : *range_[2]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, x1, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, x1, a2)]);
-      sort_indices<3,1,0,2,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), x1.size(), a2.size());
+      const double* i0data = in(0)->get_block_view(x0, a1, x1, a2);
+      BlockBuffer i0data_sorted(in(0)->get_size(x0, a1, x1, a2));
+      sort_indices<3,1,0,2,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), a1.size(), x1.size(), a2.size());
       // tensor label: I391
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, x2, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, x2, a2)]);
-      sort_indices<3,1,0,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), a1.size(), x2.size(), a2.size());
+      const double* i1data = in(1)->get_block_view(x3, a1, x2, a2);
+      BlockBuffer i1data_sorted(in(1)->get_size(x3, a1, x2, a2));
+      sort_indices<3,1,0,2,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), a1.size(), x2.size(), a2.size());
       dgemm_("T", "N", x1.size()*x0.size(), x3.size()*x2.size(), a1.size()*a2.size(),
-             1.0, i0data_sorted, a1.size()*a2.size(), i1data_sorted, a1.size()*a2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+             1.0, i0data_sorted.get(), a1.size()*a2.size(), i1data_sorted.get(), a1.size()*a2.size(),
+             1.0, odata_sorted.get(), x1.size()*x0.size());
     }
   }
-  sort_indices<2,3,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x3.size(), x2.size());
+  sort_indices<2,3,1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), x3.size(), x2.size());
   out()->put_block(odata, x3, x2, x1, x0);
 }
 
@@ -552,8 +552,8 @@ void Task375::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x3, a1, x2, a2);
   {
     // tensor label: v2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, x2, a2);
-    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata, x3.size(), a1.size(), x2.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(x3, a1, x2, a2);
+    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata.get(), x3.size(), a1.size(), x2.size(), a2.size());
   }
   out()->put_block(odata, x3, a1, x2, a2);
 }
@@ -566,22 +566,22 @@ void Task376::Task_local::compute() {
   const Index x0 = b(3);
   // tensor label: I390
   std::unique_ptr<double[]> odata = out()->move_block(x3, x2, x1, x0);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, x1, x0)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, x2, x1, x0));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, x1, x0), 0.0);
   for (auto& a1 : *range_[2]) {
     // tensor label: h1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size());
+    const double* i0data = in(0)->get_block_view(x3, a1);
+    BlockBuffer i0data_sorted(in(0)->get_size(x3, a1));
+    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a1.size());
     // tensor label: I403
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x2, x1, a1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, x1, a1, x0)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x2.size(), x1.size(), a1.size(), x0.size());
+    const double* i1data = in(1)->get_block_view(x2, x1, a1, x0);
+    BlockBuffer i1data_sorted(in(1)->get_size(x2, x1, a1, x0));
+    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), x1.size(), a1.size(), x0.size());
     dgemm_("T", "N", x3.size(), x2.size()*x1.size()*x0.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, x3.size());
+           1.0, i0data_sorted.get(), a1.size(), i1data_sorted.get(), a1.size(),
+           1.0, odata_sorted.get(), x3.size());
   }
-  sort_indices<0,1,2,3,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<0,1,2,3,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x3, x2, x1, x0);
 }
 
@@ -595,8 +595,8 @@ void Task377::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x2, x1, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, x1, x2);
-    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata, x0.size(), a1.size(), x1.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, x1, x2);
+    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata.get(), x0.size(), a1.size(), x1.size(), x2.size());
   }
   out()->put_block(odata, x2, x1, a1, x0);
 }
@@ -606,14 +606,14 @@ void Task378::Task_local::compute() {
   const Index x3 = b(0);
   const Index c1 = b(1);
   // tensor label: h1
-  std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x3);
-  std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x3)]);
-  sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), x3.size());
+  const double* i0data = in(0)->get_block_view(c1, x3);
+  BlockBuffer i0data_sorted(in(0)->get_size(c1, x3));
+  sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), x3.size());
   // tensor label: I393
-  std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x3);
-  std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x3)]);
-  sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, c1.size(), x3.size());
-  target_ += ddot_(c1.size()*x3.size(), i0data_sorted, 1, i1data_sorted, 1);
+  const double* i1data = in(1)->get_block_view(c1, x3);
+  BlockBuffer i1data_sorted(in(1)->get_size(c1, x3));
+  sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), c1.size(), x3.size());
+  target_ += ddot_(c1.size()*x3.size(), i0data_sorted.get(), 1, i1data_sorted.get(), 1);
 }
 
 void Task379::Task_local::compute() {
@@ -622,26 +622,26 @@ void Task379::Task_local::compute() {
   const Index x3 = b(1);
   // tensor label: I393
   std::unique_ptr<double[]> odata = out()->move_block(c1, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x3), 0.0);
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       for (auto& x0 : *range_[1]) {
         // tensor label: Gamma7
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x3, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, x3, x1, x0)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x2.size(), x3.size(), x1.size(), x0.size());
+        const double* i0data = in(0)->get_block_view(x2, x3, x1, x0);
+        BlockBuffer i0data_sorted(in(0)->get_size(x2, x3, x1, x0));
+        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted.get(), x2.size(), x3.size(), x1.size(), x0.size());
         // tensor label: I394
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c1, x1, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c1, x1, x0)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted, x2.size(), c1.size(), x1.size(), x0.size());
+        const double* i1data = in(1)->get_block_view(x2, c1, x1, x0);
+        BlockBuffer i1data_sorted(in(1)->get_size(x2, c1, x1, x0));
+        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), c1.size(), x1.size(), x0.size());
         dgemm_("T", "N", x3.size(), c1.size(), x2.size()*x1.size()*x0.size(),
-               1.0, i0data_sorted, x2.size()*x1.size()*x0.size(), i1data_sorted, x2.size()*x1.size()*x0.size(),
-               1.0, odata_sorted, x3.size());
+               1.0, i0data_sorted.get(), x2.size()*x1.size()*x0.size(), i1data_sorted.get(), x2.size()*x1.size()*x0.size(),
+               1.0, odata_sorted.get(), x3.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x3.size(), c1.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), c1.size());
   out()->put_block(odata, c1, x3);
 }
 
@@ -655,8 +655,8 @@ void Task380::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x2, c1, x1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1, c1, x2);
-    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata, x0.size(), x1.size(), c1.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x0, x1, c1, x2);
+    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata.get(), x0.size(), x1.size(), c1.size(), x2.size());
   }
   out()->put_block(odata, x2, c1, x1, x0);
 }
@@ -668,14 +668,14 @@ void Task381::Task_local::compute() {
   const Index x3 = b(2);
   const Index x0 = b(3);
   // tensor label: Gamma92
-  std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x3, x1, x2);
-  std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x3, x1, x2)]);
-  sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), x3.size(), x1.size(), x2.size());
+  const double* i0data = in(0)->get_block_view(x0, x3, x1, x2);
+  BlockBuffer i0data_sorted(in(0)->get_size(x0, x3, x1, x2));
+  sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), x3.size(), x1.size(), x2.size());
   // tensor label: I405
-  std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, x3, x2);
-  std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, x3, x2)]);
-  sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), x3.size(), x2.size());
-  target_ += ddot_(x1.size()*x0.size()*x3.size()*x2.size(), i0data_sorted, 1, i1data_sorted, 1);
+  const double* i1data = in(1)->get_block_view(x1, x0, x3, x2);
+  BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, x3, x2));
+  sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), x3.size(), x2.size());
+  target_ += ddot_(x1.size()*x0.size()*x3.size()*x2.size(), i0data_sorted.get(), 1, i1data_sorted.get(), 1);
 }
 
 void Task382::Task_local::compute() {
@@ -686,24 +686,24 @@ void Task382::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I405
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& c2 : *range_[0]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x3, c2, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x3, c2, x2)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), x3.size(), c2.size(), x2.size());
+      const double* i0data = in(0)->get_block_view(c1, x3, c2, x2);
+      BlockBuffer i0data_sorted(in(0)->get_size(c1, x3, c2, x2));
+      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), x3.size(), c2.size(), x2.size());
       // tensor label: I406
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c2, x0, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c2, x0, c1)]);
-      sort_indices<3,1,0,2,0,1,1,1>(i1data, i1data_sorted, x1.size(), c2.size(), x0.size(), c1.size());
+      const double* i1data = in(1)->get_block_view(x1, c2, x0, c1);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, c2, x0, c1));
+      sort_indices<3,1,0,2,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), c2.size(), x0.size(), c1.size());
       dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), c2.size()*c1.size(),
-             1.0, i0data_sorted, c2.size()*c1.size(), i1data_sorted, c2.size()*c1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), c2.size()*c1.size(), i1data_sorted.get(), c2.size()*c1.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0, x3, x2);
 }
 
@@ -717,8 +717,8 @@ void Task383::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, c2, x0, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x0, c2, x1);
-    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata, c1.size(), x0.size(), c2.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c1, x0, c2, x1);
+    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata.get(), c1.size(), x0.size(), c2.size(), x1.size());
   }
   out()->put_block(odata, x1, c2, x0, c1);
 }
@@ -730,14 +730,14 @@ void Task384::Task_local::compute() {
   const Index x4 = b(2);
   const Index x5 = b(3);
   // tensor label: t2
-  std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, c1, x3);
-  std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, c1, x3)]);
-  sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), c1.size(), x3.size());
+  const double* i0data = in(0)->get_block_view(x5, x4, c1, x3);
+  BlockBuffer i0data_sorted(in(0)->get_size(x5, x4, c1, x3));
+  sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), x4.size(), c1.size(), x3.size());
   // tensor label: I408
-  std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x5, x4, x3);
-  std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x5, x4, x3)]);
-  sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, c1.size(), x5.size(), x4.size(), x3.size());
-  target_ += ddot_(c1.size()*x5.size()*x4.size()*x3.size(), i0data_sorted, 1, i1data_sorted, 1);
+  const double* i1data = in(1)->get_block_view(c1, x5, x4, x3);
+  BlockBuffer i1data_sorted(in(1)->get_size(c1, x5, x4, x3));
+  sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted.get(), c1.size(), x5.size(), x4.size(), x3.size());
+  target_ += ddot_(c1.size()*x5.size()*x4.size()*x3.size(), i0data_sorted.get(), 1, i1data_sorted.get(), 1);
 }
 
 void Task385::Task_local::compute() {
@@ -748,26 +748,26 @@ void Task385::Task_local::compute() {
   const Index x3 = b(3);
   // tensor label: I408
   std::unique_ptr<double[]> odata = out()->move_block(c1, x5, x4, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x5, x4, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, x5, x4, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x5, x4, x3), 0.0);
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       for (auto& x0 : *range_[1]) {
         // tensor label: Gamma6
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x2, x3, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x2, x3, x1, x0)]);
-        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
+        const double* i0data = in(0)->get_block_view(x5, x4, x2, x3, x1, x0);
+        BlockBuffer i0data_sorted(in(0)->get_size(x5, x4, x2, x3, x1, x0));
+        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
         // tensor label: I409
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c1, x1, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c1, x1, x0)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted, x2.size(), c1.size(), x1.size(), x0.size());
+        const double* i1data = in(1)->get_block_view(x2, c1, x1, x0);
+        BlockBuffer i1data_sorted(in(1)->get_size(x2, c1, x1, x0));
+        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), c1.size(), x1.size(), x0.size());
         dgemm_("T", "N", x5.size()*x4.size()*x3.size(), c1.size(), x2.size()*x1.size()*x0.size(),
-               1.0, i0data_sorted, x2.size()*x1.size()*x0.size(), i1data_sorted, x2.size()*x1.size()*x0.size(),
-               1.0, odata_sorted, x5.size()*x4.size()*x3.size());
+               1.0, i0data_sorted.get(), x2.size()*x1.size()*x0.size(), i1data_sorted.get(), x2.size()*x1.size()*x0.size(),
+               1.0, odata_sorted.get(), x5.size()*x4.size()*x3.size());
       }
     }
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), c1.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x5.size(), x4.size(), x3.size(), c1.size());
   out()->put_block(odata, c1, x5, x4, x3);
 }
 
@@ -781,8 +781,8 @@ void Task386::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x2, c1, x1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1, c1, x2);
-    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata, x0.size(), x1.size(), c1.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x0, x1, c1, x2);
+    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata.get(), x0.size(), x1.size(), c1.size(), x2.size());
   }
   out()->put_block(odata, x2, c1, x1, x0);
 }
@@ -792,14 +792,14 @@ void Task387::Task_local::compute() {
   const Index x1 = b(0);
   const Index x0 = b(1);
   // tensor label: Gamma16
-  std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-  std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-  sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+  const double* i0data = in(0)->get_block_view(x0, x1);
+  BlockBuffer i0data_sorted(in(0)->get_size(x0, x1));
+  sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), x1.size());
   // tensor label: I411
-  std::unique_ptr<double[]> i1data = in(1)->get_block(x0, x1);
-  std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, x1)]);
-  sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, x0.size(), x1.size());
-  target_ += ddot_(x0.size()*x1.size(), i0data_sorted, 1, i1data_sorted, 1);
+  const double* i1data = in(1)->get_block_view(x0, x1);
+  BlockBuffer i1data_sorted(in(1)->get_size(x0, x1));
+  sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), x1.size());
+  target_ += ddot_(x0.size()*x1.size(), i0data_sorted.get(), 1, i1data_sorted.get(), 1);
 }
 
 void Task388::Task_local::compute() {
@@ -808,26 +808,26 @@ void Task388::Task_local::compute() {
   const Index x1 = b(1);
   // tensor label: I411
   std::unique_ptr<double[]> odata = out()->move_block(x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1), 0.0);
   for (auto& c3 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2, c1, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a2, c1, x1)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c3.size(), a2.size(), c1.size(), x1.size());
+        const double* i0data = in(0)->get_block_view(c3, a2, c1, x1);
+        BlockBuffer i0data_sorted(in(0)->get_size(c3, a2, c1, x1));
+        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c3.size(), a2.size(), c1.size(), x1.size());
         // tensor label: I412
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c3, a2, c1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c3, a2, c1)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted, x0.size(), c3.size(), a2.size(), c1.size());
+        const double* i1data = in(1)->get_block_view(x0, c3, a2, c1);
+        BlockBuffer i1data_sorted(in(1)->get_size(x0, c3, a2, c1));
+        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), c3.size(), a2.size(), c1.size());
         dgemm_("T", "N", x1.size(), x0.size(), c3.size()*a2.size()*c1.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*c1.size(), i1data_sorted, c3.size()*a2.size()*c1.size(),
-               1.0, odata_sorted, x1.size());
+               1.0, i0data_sorted.get(), c3.size()*a2.size()*c1.size(), i1data_sorted.get(), c3.size()*a2.size()*c1.size(),
+               1.0, odata_sorted.get(), x1.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size());
   out()->put_block(odata, x0, x1);
 }
 
@@ -841,8 +841,8 @@ void Task389::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x0, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-    sort_indices<3,2,1,0,1,1,-1,1>(i0data, odata, c1.size(), a2.size(), c3.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, x0);
+    sort_indices<3,2,1,0,1,1,-1,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), x0.size());
   }
   out()->put_block(odata, x0, c3, a2, c1);
 }
@@ -853,26 +853,26 @@ void Task390::Task_local::compute() {
   const Index x1 = b(1);
   // tensor label: I411
   std::unique_ptr<double[]> odata = out()->move_block(x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c3 : *range_[0]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, x1)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), x1.size());
+        const double* i0data = in(0)->get_block_view(c1, a2, c3, x1);
+        BlockBuffer i0data_sorted(in(0)->get_size(c1, a2, c3, x1));
+        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size(), c3.size(), x1.size());
         // tensor label: I415
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c3, a2, c1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c3, a2, c1)]);
-        sort_indices<3,2,1,0,0,1,1,1>(i1data, i1data_sorted, x0.size(), c3.size(), a2.size(), c1.size());
+        const double* i1data = in(1)->get_block_view(x0, c3, a2, c1);
+        BlockBuffer i1data_sorted(in(1)->get_size(x0, c3, a2, c1));
+        sort_indices<3,2,1,0,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), c3.size(), a2.size(), c1.size());
         dgemm_("T", "N", x1.size(), x0.size(), c3.size()*a2.size()*c1.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*c1.size(), i1data_sorted, c3.size()*a2.size()*c1.size(),
-               1.0, odata_sorted, x1.size());
+               1.0, i0data_sorted.get(), c3.size()*a2.size()*c1.size(), i1data_sorted.get(), c3.size()*a2.size()*c1.size(),
+               1.0, odata_sorted.get(), x1.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size());
   out()->put_block(odata, x0, x1);
 }
 
@@ -886,8 +886,8 @@ void Task391::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x0, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata, c1.size(), a2.size(), c3.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, x0);
+    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), x0.size());
   }
   out()->put_block(odata, x0, c3, a2, c1);
 }
@@ -899,14 +899,14 @@ void Task392::Task_local::compute() {
   const Index x0 = b(2);
   const Index x3 = b(3);
   // tensor label: Gamma32
-  std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x1, x2);
-  std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x1, x2)]);
-  sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x1.size(), x2.size());
+  const double* i0data = in(0)->get_block_view(x3, x0, x1, x2);
+  BlockBuffer i0data_sorted(in(0)->get_size(x3, x0, x1, x2));
+  sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x0.size(), x1.size(), x2.size());
   // tensor label: I417
-  std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, x3, x2);
-  std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, x3, x2)]);
-  sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), x3.size(), x2.size());
-  target_ += ddot_(x1.size()*x0.size()*x3.size()*x2.size(), i0data_sorted, 1, i1data_sorted, 1);
+  const double* i1data = in(1)->get_block_view(x1, x0, x3, x2);
+  BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, x3, x2));
+  sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), x3.size(), x2.size());
+  target_ += ddot_(x1.size()*x0.size()*x3.size()*x2.size(), i0data_sorted.get(), 1, i1data_sorted.get(), 1);
 }
 
 void Task393::Task_local::compute() {
@@ -917,24 +917,24 @@ void Task393::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I417
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   for (auto& a1 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, c2, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, c2, x2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), c2.size(), x2.size());
+      const double* i0data = in(0)->get_block_view(x3, a1, c2, x2);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, a1, c2, x2));
+      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a1.size(), c2.size(), x2.size());
       // tensor label: I418
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c2, a1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c2, a1, x0)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), c2.size(), a1.size(), x0.size());
+      const double* i1data = in(1)->get_block_view(x1, c2, a1, x0);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, c2, a1, x0));
+      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), c2.size(), a1.size(), x0.size());
       dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), c2.size()*a1.size(), i1data_sorted.get(), c2.size()*a1.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0, x3, x2);
 }
 
@@ -948,8 +948,8 @@ void Task394::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata, x0.size(), a1.size(), c2.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, x1);
+    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), x1.size());
   }
   out()->put_block(odata, x1, c2, a1, x0);
 }
@@ -961,14 +961,14 @@ void Task395::Task_local::compute() {
   const Index x2 = b(2);
   const Index x3 = b(3);
   // tensor label: Gamma35
-  std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-  std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-  sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+  const double* i0data = in(0)->get_block_view(x3, x2, x1, x0);
+  BlockBuffer i0data_sorted(in(0)->get_size(x3, x2, x1, x0));
+  sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x2.size(), x1.size(), x0.size());
   // tensor label: I420
-  std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, x3, x2);
-  std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, x3, x2)]);
-  sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), x3.size(), x2.size());
-  target_ += ddot_(x1.size()*x0.size()*x3.size()*x2.size(), i0data_sorted, 1, i1data_sorted, 1);
+  const double* i1data = in(1)->get_block_view(x1, x0, x3, x2);
+  BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, x3, x2));
+  sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), x3.size(), x2.size());
+  target_ += ddot_(x1.size()*x0.size()*x3.size()*x2.size(), i0data_sorted.get(), 1, i1data_sorted.get(), 1);
 }
 
 void Task396::Task_local::compute() {
@@ -979,24 +979,24 @@ void Task396::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I420
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, x3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1, x3, x2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size(), x3.size(), x2.size());
+      const double* i0data = in(0)->get_block_view(c2, a1, x3, x2);
+      BlockBuffer i0data_sorted(in(0)->get_size(c2, a1, x3, x2));
+      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c2.size(), a1.size(), x3.size(), x2.size());
       // tensor label: I421
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c2, a1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c2, a1, x0)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), c2.size(), a1.size(), x0.size());
+      const double* i1data = in(1)->get_block_view(x1, c2, a1, x0);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, c2, a1, x0));
+      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), c2.size(), a1.size(), x0.size());
       dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), c2.size()*a1.size(), i1data_sorted.get(), c2.size()*a1.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0, x3, x2);
 }
 
@@ -1010,8 +1010,8 @@ void Task397::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-    sort_indices<3,2,1,0,1,1,-1,1>(i0data, odata, x0.size(), a1.size(), c2.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, x1);
+    sort_indices<3,2,1,0,1,1,-1,1>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), x1.size());
   }
   out()->put_block(odata, x1, c2, a1, x0);
 }
@@ -1024,24 +1024,24 @@ void Task398::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I420
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   for (auto& a2 : *range_[2]) {
     for (auto& c1 : *range_[0]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a2, c1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a2, c1, x2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a2.size(), c1.size(), x2.size());
+      const double* i0data = in(0)->get_block_view(x3, a2, c1, x2);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, a2, c1, x2));
+      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a2.size(), c1.size(), x2.size());
       // tensor label: I424
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, a2, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, a2, c1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), a2.size(), c1.size());
+      const double* i1data = in(1)->get_block_view(x1, x0, a2, c1);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, a2, c1));
+      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), a2.size(), c1.size());
       dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), a2.size()*c1.size(), i1data_sorted.get(), a2.size()*c1.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0, x3, x2);
 }
 
@@ -1055,8 +1055,8 @@ void Task399::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x0, x1);
-    sort_indices<3,2,1,0,1,1,-1,1>(i0data, odata, c1.size(), a2.size(), x0.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, x0, x1);
+    sort_indices<3,2,1,0,1,1,-1,1>(i0data, odata.get(), c1.size(), a2.size(), x0.size(), x1.size());
   }
   out()->put_block(odata, x1, x0, a2, c1);
 }
@@ -41,24 +41,24 @@ void Task400::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I420
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, x3, x2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), x3.size(), x2.size());
+      const double* i0data = in(0)->get_block_view(c1, a2, x3, x2);
+      BlockBuffer i0data_sorted(in(0)->get_size(c1, a2, x3, x2));
+      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size(), x3.size(), x2.size());
       // tensor label: I427
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, a2, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, a2, c1)]);
-      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), a2.size(), c1.size());
+      const double* i1data = in(1)->get_block_view(x1, x0, a2, c1);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, a2, c1));
+      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), a2.size(), c1.size());
       dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), a2.size()*c1.size(), i1data_sorted.get(), a2.size()*c1.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0, x3, x2);
 }
 
@@ -72,8 +72,8 @@ void Task401::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x0, x1);
-    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata, c1.size(), a2.size(), x0.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, x0, x1);
+    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata.get(), c1.size(), a2.size(), x0.size(), x1.size());
   }
   out()->put_block(odata, x1, x0, a2, c1);
 }
@@ -87,14 +87,14 @@ void Task402::Task_local::compute() {
   const Index x0 = b(4);
   const Index x5 = b(5);
   // tensor label: Gamma59
-  std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x3, x2, x1);
-  std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x3, x2, x1)]);
-  sort_indices<0,1,2,3,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
+  const double* i0data = in(0)->get_block_view(x5, x0, x4, x3, x2, x1);
+  BlockBuffer i0data_sorted(in(0)->get_size(x5, x0, x4, x3, x2, x1));
+  sort_indices<0,1,2,3,4,5,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
   // tensor label: I429
-  std::unique_ptr<double[]> i1data = in(1)->get_block(x2, x1, x0, x5, x4, x3);
-  std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, x1, x0, x5, x4, x3)]);
-  sort_indices<3,2,4,5,0,1,0,1,1,1>(i1data, i1data_sorted, x2.size(), x1.size(), x0.size(), x5.size(), x4.size(), x3.size());
-  target_ += ddot_(x2.size()*x1.size()*x0.size()*x5.size()*x4.size()*x3.size(), i0data_sorted, 1, i1data_sorted, 1);
+  const double* i1data = in(1)->get_block_view(x2, x1, x0, x5, x4, x3);
+  BlockBuffer i1data_sorted(in(1)->get_size(x2, x1, x0, x5, x4, x3));
+  sort_indices<3,2,4,5,0,1,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), x1.size(), x0.size(), x5.size(), x4.size(), x3.size());
+  target_ += ddot_(x2.size()*x1.size()*x0.size()*x5.size()*x4.size()*x3.size(), i0data_sorted.get(), 1, i1data_sorted.get(), 1);
 }
 
 void Task403::Task_local::compute() {
@@ -107,22 +107,22 @@ void Task403::Task_local::compute() {
   const Index x3 = b(5);
   // tensor label: I429
   std::unique_ptr<double[]> odata = out()->move_block(x2, x1, x0, x5, x4, x3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1, x0, x5, x4, x3)]);
+  BlockBuffer odata_sorted(out()->get_size(x2, x1, x0, x5, x4, x3));
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1, x0, x5, x4, x3), 0.0);
   for (auto& a1 : *range_[2]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, x4, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a1, x4, x3)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), a1.size(), x4.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(x5, a1, x4, x3);
+    BlockBuffer i0data_sorted(in(0)->get_size(x5, a1, x4, x3));
+    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), a1.size(), x4.size(), x3.size());
     // tensor label: I430
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x2, x1, a1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, x1, a1, x0)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x2.size(), x1.size(), a1.size(), x0.size());
+    const double* i1data = in(1)->get_block_view(x2, x1, a1, x0);
+    BlockBuffer i1data_sorted(in(1)->get_size(x2, x1, a1, x0));
+    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted.get(), x2.size(), x1.size(), a1.size(), x0.size());
     dgemm_("T", "N", x5.size()*x4.size()*x3.size(), x2.size()*x1.size()*x0.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, x5.size()*x4.size()*x3.size());
+           1.0, i0data_sorted.get(), a1.size(), i1data_sorted.get(), a1.size(),
+           1.0, odata_sorted.get(), x5.size()*x4.size()*x3.size());
   }
-  sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x2, x1, x0, x5, x4, x3);
 }
 
@@ -136,8 +136,8 @@ void Task404::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x2, x1, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, x1, x2);
-    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata, x0.size(), a1.size(), x1.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, x1, x2);
+    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata.get(), x0.size(), a1.size(), x1.size(), x2.size());
   }
   out()->put_block(odata, x2, x1, a1, x0);
 }
@@ -149,14 +149,14 @@ void Task405::Task_local::compute() {
   const Index a4 = b(2);
   const Index c1 = b(3);
   // tensor label: t2
-  std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a4, c3, a2);
-  std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a4, c3, a2)]);
-  sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a4.size(), c3.size(), a2.size());
+  const double* i0data = in(0)->get_block_view(c1, a4, c3, a2);
+  BlockBuffer i0data_sorted(in(0)->get_size(c1, a4, c3, a2));
+  sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a4.size(), c3.size(), a2.size());
   // tensor label: I432
-  std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c3, a2, c1);
-  std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c3, a2, c1)]);
-  sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, a4.size(), c3.size(), a2.size(), c1.size());
-  target_ += ddot_(a4.size()*c3.size()*a2.size()*c1.size(), i0data_sorted, 1, i1data_sorted, 1);
+  const double* i1data = in(1)->get_block_view(a4, c3, a2, c1);
+  BlockBuffer i1data_sorted(in(1)->get_size(a4, c3, a2, c1));
+  sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), c3.size(), a2.size(), c1.size());
+  target_ += ddot_(a4.size()*c3.size()*a2.size()*c1.size(), i0data_sorted.get(), 1, i1data_sorted.get(), 1);
 }
 
 void Task406::Task_local::compute() {
@@ -169,8 +169,8 @@ void Task406::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a4, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-    sort_indices<3,2,1,0,1,1,-4,1>(i0data, odata, c1.size(), a2.size(), c3.size(), a4.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, a4);
+    sort_indices<3,2,1,0,1,1,-4,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), a4.size());
   }
   out()->put_block(odata, a4, c3, a2, c1);
 }
@@ -182,14 +182,14 @@ void Task407::Task_local::compute() {
   const Index a2 = b(2);
   const Index c1 = b(3);
   // tensor label: t2
-  std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-  std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, a4)]);
-  sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
+  const double* i0data = in(0)->get_block_view(c1, a2, c3, a4);
+  BlockBuffer i0data_sorted(in(0)->get_size(c1, a2, c3, a4));
+  sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size(), c3.size(), a4.size());
   // tensor label: I434
-  std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c3, a2, c1);
-  std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c3, a2, c1)]);
-  sort_indices<3,2,1,0,0,1,1,1>(i1data, i1data_sorted, a4.size(), c3.size(), a2.size(), c1.size());
-  target_ += ddot_(a4.size()*c3.size()*a2.size()*c1.size(), i0data_sorted, 1, i1data_sorted, 1);
+  const double* i1data = in(1)->get_block_view(a4, c3, a2, c1);
+  BlockBuffer i1data_sorted(in(1)->get_size(a4, c3, a2, c1));
+  sort_indices<3,2,1,0,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), c3.size(), a2.size(), c1.size());
+  target_ += ddot_(a4.size()*c3.size()*a2.size()*c1.size(), i0data_sorted.get(), 1, i1data_sorted.get(), 1);
 }
 
 void Task408::Task_local::compute() {
@@ -202,8 +202,8 @@ void Task408::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a4, c3, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-    sort_indices<3,2,1,0,1,1,8,1>(i0data, odata, c1.size(), a2.size(), c3.size(), a4.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, c3, a4);
+    sort_indices<3,2,1,0,1,1,8,1>(i0data, odata.get(), c1.size(), a2.size(), c3.size(), a4.size());
   }
   out()->put_block(odata, a4, c3, a2, c1);
 }
@@ -213,14 +213,14 @@ void Task409::Task_local::compute() {
   const Index x0 = b(0);
   const Index x1 = b(1);
   // tensor label: Gamma38
-  std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-  std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-  sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+  const double* i0data = in(0)->get_block_view(x1, x0);
+  BlockBuffer i0data_sorted(in(0)->get_size(x1, x0));
+  sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), x0.size());
   // tensor label: I436
-  std::unique_ptr<double[]> i1data = in(1)->get_block(x0, x1);
-  std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, x1)]);
-  sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, x0.size(), x1.size());
-  target_ += ddot_(x0.size()*x1.size(), i0data_sorted, 1, i1data_sorted, 1);
+  const double* i1data = in(1)->get_block_view(x0, x1);
+  BlockBuffer i1data_sorted(in(1)->get_size(x0, x1));
+  sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted.get(), x0.size(), x1.size());
+  target_ += ddot_(x0.size()*x1.size(), i0data_sorted.get(), 1, i1data_sorted.get(), 1);
 }
 
 void Task410::Task_local::compute() {
@@ -229,26 +229,26 @@ void Task410::Task_local::compute() {
   const Index x1 = b(1);
   // tensor label: I436
   std::unique_ptr<double[]> odata = out()->move_block(x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1), 0.0);
   for (auto& a3 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a1 : *range_[2]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a3, c2, a1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a3, c2, a1)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), a3.size(), c2.size(), a1.size());
+        const double* i0data = in(0)->get_block_view(x1, a3, c2, a1);
+        BlockBuffer i0data_sorted(in(0)->get_size(x1, a3, c2, a1));
+        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), a3.size(), c2.size(), a1.size());
         // tensor label: I437
-        std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, a1, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, a1, x0)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), a1.size(), x0.size());
+        const double* i1data = in(1)->get_block_view(a3, c2, a1, x0);
+        BlockBuffer i1data_sorted(in(1)->get_size(a3, c2, a1, x0));
+        sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), c2.size(), a1.size(), x0.size());
         dgemm_("T", "N", x1.size(), x0.size(), a3.size()*c2.size()*a1.size(),
-               1.0, i0data_sorted, a3.size()*c2.size()*a1.size(), i1data_sorted, a3.size()*c2.size()*a1.size(),
-               1.0, odata_sorted, x1.size());
+               1.0, i0data_sorted.get(), a3.size()*c2.size()*a1.size(), i1data_sorted.get(), a3.size()*c2.size()*a1.size(),
+               1.0, odata_sorted.get(), x1.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size());
   out()->put_block(odata, x0, x1);
 }
 
@@ -262,8 +262,8 @@ void Task411::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-    sort_indices<3,2,1,0,1,1,-1,1>(i0data, odata, x0.size(), a1.size(), c2.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, a3);
+    sort_indices<3,2,1,0,1,1,-1,1>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), a3.size());
   }
   out()->put_block(odata, a3, c2, a1, x0);
 }
@@ -274,26 +274,26 @@ void Task412::Task_local::compute() {
   const Index x1 = b(1);
   // tensor label: I436
   std::unique_ptr<double[]> odata = out()->move_block(x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1), 0.0);
   for (auto& a1 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a3 : *range_[2]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a1, c2, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a1, c2, a3)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), a1.size(), c2.size(), a3.size());
+        const double* i0data = in(0)->get_block_view(x1, a1, c2, a3);
+        BlockBuffer i0data_sorted(in(0)->get_size(x1, a1, c2, a3));
+        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted.get(), x1.size(), a1.size(), c2.size(), a3.size());
         // tensor label: I440
-        std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, a1, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, a1, x0)]);
-        sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), a1.size(), x0.size());
+        const double* i1data = in(1)->get_block_view(a3, c2, a1, x0);
+        BlockBuffer i1data_sorted(in(1)->get_size(a3, c2, a1, x0));
+        sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), c2.size(), a1.size(), x0.size());
         dgemm_("T", "N", x1.size(), x0.size(), a3.size()*c2.size()*a1.size(),
-               1.0, i0data_sorted, a3.size()*c2.size()*a1.size(), i1data_sorted, a3.size()*c2.size()*a1.size(),
-               1.0, odata_sorted, x1.size());
+               1.0, i0data_sorted.get(), a3.size()*c2.size()*a1.size(), i1data_sorted.get(), a3.size()*c2.size()*a1.size(),
+               1.0, odata_sorted.get(), x1.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size());
   out()->put_block(odata, x0, x1);
 }
 
@@ -307,8 +307,8 @@ void Task413::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata, x0.size(), a1.size(), c2.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, a3);
+    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), a3.size());
   }
   out()->put_block(odata, a3, c2, a1, x0);
 }
@@ -320,14 +320,14 @@ void Task414::Task_local::compute() {
   const Index x0 = b(2);
   const Index x3 = b(3);
   // tensor label: Gamma60
-  std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-  std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-  sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+  const double* i0data = in(0)->get_block_view(x3, x0, x2, x1);
+  BlockBuffer i0data_sorted(in(0)->get_size(x3, x0, x2, x1));
+  sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x0.size(), x2.size(), x1.size());
   // tensor label: I442
-  std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, x3, x2);
-  std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, x3, x2)]);
-  sort_indices<2,1,3,0,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), x3.size(), x2.size());
-  target_ += ddot_(x1.size()*x0.size()*x3.size()*x2.size(), i0data_sorted, 1, i1data_sorted, 1);
+  const double* i1data = in(1)->get_block_view(x1, x0, x3, x2);
+  BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, x3, x2));
+  sort_indices<2,1,3,0,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), x3.size(), x2.size());
+  target_ += ddot_(x1.size()*x0.size()*x3.size()*x2.size(), i0data_sorted.get(), 1, i1data_sorted.get(), 1);
 }
 
 void Task415::Task_local::compute() {
@@ -338,24 +338,24 @@ void Task415::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I442
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   for (auto& a1 : *range_[2]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, x2, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, x2, a2)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), x2.size(), a2.size());
+      const double* i0data = in(0)->get_block_view(x3, a1, x2, a2);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, a1, x2, a2));
+      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a1.size(), x2.size(), a2.size());
       // tensor label: I443
-      std::unique_ptr<double[]> i1data = in(1)->get_block(a2, x1, a1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, x1, a1, x0)]);
-      sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, a2.size(), x1.size(), a1.size(), x0.size());
+      const double* i1data = in(1)->get_block_view(a2, x1, a1, x0);
+      BlockBuffer i1data_sorted(in(1)->get_size(a2, x1, a1, x0));
+      sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted.get(), a2.size(), x1.size(), a1.size(), x0.size());
       dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), a2.size()*a1.size(),
-             1.0, i0data_sorted, a2.size()*a1.size(), i1data_sorted, a2.size()*a1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), a2.size()*a1.size(), i1data_sorted.get(), a2.size()*a1.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0, x3, x2);
 }
 
@@ -369,8 +369,8 @@ void Task416::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a2, x1, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, x1, a2);
-    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata, x0.size(), a1.size(), x1.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, x1, a2);
+    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata.get(), x0.size(), a1.size(), x1.size(), a2.size());
   }
   out()->put_block(odata, a2, x1, a1, x0);
 }
@@ -382,8 +382,8 @@ void Task418::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x2, x3);
   {
     // tensor label: I444
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2);
-    sort_indices<1,0,1,1,1,1>(i0data, odata, x3.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x3, x2);
+    sort_indices<1,0,1,1,1,1>(i0data, odata.get(), x3.size(), x2.size());
   }
   out()->put_block(odata, x2, x3);
 }
@@ -393,28 +393,28 @@ void Task419::Task_local::compute() {
   const Index x2 = b(1);
   // tensor label: I444
   std::unique_ptr<double[]> odata = out()->move_block(x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2), 0.0);
   for (auto& x0 : *range_[1]) {
     for (auto& x5 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         for (auto& x4 : *range_[1]) {
           // tensor label: Gamma160
-          std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x5, x1, x4, x3, x2);
-          std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x5, x1, x4, x3, x2)]);
-          sort_indices<0,1,2,3,4,5,0,1,1,1>(i0data, i0data_sorted, x0.size(), x5.size(), x1.size(), x4.size(), x3.size(), x2.size());
+          const double* i0data = in(0)->get_block_view(x0, x5, x1, x4, x3, x2);
+          BlockBuffer i0data_sorted(in(0)->get_size(x0, x5, x1, x4, x3, x2));
+          sort_indices<0,1,2,3,4,5,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), x5.size(), x1.size(), x4.size(), x3.size(), x2.size());
           // tensor label: I445
-          std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, x5, x4);
-          std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, x5, x4)]);
-          sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), x5.size(), x4.size());
+          const double* i1data = in(1)->get_block_view(x1, x0, x5, x4);
+          BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, x5, x4));
+          sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), x5.size(), x4.size());
           dgemm_("T", "N", x3.size()*x2.size(), 1, x1.size()*x0.size()*x5.size()*x4.size(),
-                 1.0, i0data_sorted, x1.size()*x0.size()*x5.size()*x4.size(), i1data_sorted, x1.size()*x0.size()*x5.size()*x4.size(),
-                 1.0, odata_sorted, x3.size()*x2.size());
+                 1.0, i0data_sorted.get(), x1.size()*x0.size()*x5.size()*x4.size(), i1data_sorted.get(), x1.size()*x0.size()*x5.size()*x4.size(),
+                 1.0, odata_sorted.get(), x3.size()*x2.size());
         }
       }
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size());
   out()->put_block(odata, x3, x2);
 }
 
@@ -425,24 +425,24 @@ void Task420::Task_local::compute() {
   const Index x4 = b(3);
   // tensor label: I445
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x5, x4);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x5, x4)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x5, x4));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x5, x4), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& c2 : *range_[0]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x5, c2, x4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x5, c2, x4)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), x5.size(), c2.size(), x4.size());
+      const double* i0data = in(0)->get_block_view(c1, x5, c2, x4);
+      BlockBuffer i0data_sorted(in(0)->get_size(c1, x5, c2, x4));
+      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), x5.size(), c2.size(), x4.size());
       // tensor label: I446
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c2, x0, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c2, x0, c1)]);
-      sort_indices<3,1,0,2,0,1,1,1>(i1data, i1data_sorted, x1.size(), c2.size(), x0.size(), c1.size());
+      const double* i1data = in(1)->get_block_view(x1, c2, x0, c1);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, c2, x0, c1));
+      sort_indices<3,1,0,2,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), c2.size(), x0.size(), c1.size());
       dgemm_("T", "N", x5.size()*x4.size(), x1.size()*x0.size(), c2.size()*c1.size(),
-             1.0, i0data_sorted, c2.size()*c1.size(), i1data_sorted, c2.size()*c1.size(),
-             1.0, odata_sorted, x5.size()*x4.size());
+             1.0, i0data_sorted.get(), c2.size()*c1.size(), i1data_sorted.get(), c2.size()*c1.size(),
+             1.0, odata_sorted.get(), x5.size()*x4.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x1.size(), x0.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x5.size(), x4.size(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0, x5, x4);
 }
 
@@ -455,8 +455,8 @@ void Task421::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, c2, x0, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x0, c2, x1);
-    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata, c1.size(), x0.size(), c2.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c1, x0, c2, x1);
+    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata.get(), c1.size(), x0.size(), c2.size(), x1.size());
   }
   out()->put_block(odata, x1, c2, x0, c1);
 }
@@ -466,28 +466,28 @@ void Task422::Task_local::compute() {
   const Index x2 = b(1);
   // tensor label: I444
   std::unique_ptr<double[]> odata = out()->move_block(x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2), 0.0);
   for (auto& x5 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         for (auto& x4 : *range_[1]) {
           // tensor label: Gamma191
-          std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x1, x4, x3, x2);
-          std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x1, x4, x3, x2)]);
-          sort_indices<0,1,2,3,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x1.size(), x4.size(), x3.size(), x2.size());
+          const double* i0data = in(0)->get_block_view(x5, x0, x1, x4, x3, x2);
+          BlockBuffer i0data_sorted(in(0)->get_size(x5, x0, x1, x4, x3, x2));
+          sort_indices<0,1,2,3,4,5,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), x0.size(), x1.size(), x4.size(), x3.size(), x2.size());
           // tensor label: I538
-          std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, x5, x4);
-          std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, x5, x4)]);
-          sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), x5.size(), x4.size());
+          const double* i1data = in(1)->get_block_view(x1, x0, x5, x4);
+          BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, x5, x4));
+          sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), x5.size(), x4.size());
           dgemm_("T", "N", x3.size()*x2.size(), 1, x1.size()*x0.size()*x5.size()*x4.size(),
-                 1.0, i0data_sorted, x1.size()*x0.size()*x5.size()*x4.size(), i1data_sorted, x1.size()*x0.size()*x5.size()*x4.size(),
-                 1.0, odata_sorted, x3.size()*x2.size());
+                 1.0, i0data_sorted.get(), x1.size()*x0.size()*x5.size()*x4.size(), i1data_sorted.get(), x1.size()*x0.size()*x5.size()*x4.size(),
+                 1.0, odata_sorted.get(), x3.size()*x2.size());
         }
       }
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size());
   out()->put_block(odata, x3, x2);
 }
 
@@ -498,24 +498,24 @@ void Task423::Task_local::compute() {
   const Index x4 = b(3);
   // tensor label: I538
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x5, x4);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x5, x4)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x5, x4));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x5, x4), 0.0);
   for (auto& a1 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, c2, x4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a1, c2, x4)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), a1.size(), c2.size(), x4.size());
+      const double* i0data = in(0)->get_block_view(x5, a1, c2, x4);
+      BlockBuffer i0data_sorted(in(0)->get_size(x5, a1, c2, x4));
+      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), a1.size(), c2.size(), x4.size());
       // tensor label: I539
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c2, a1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c2, a1, x0)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), c2.size(), a1.size(), x0.size());
+      const double* i1data = in(1)->get_block_view(x1, c2, a1, x0);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, c2, a1, x0));
+      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), c2.size(), a1.size(), x0.size());
       dgemm_("T", "N", x5.size()*x4.size(), x1.size()*x0.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, x5.size()*x4.size());
+             1.0, i0data_sorted.get(), c2.size()*a1.size(), i1data_sorted.get(), c2.size()*a1.size(),
+             1.0, odata_sorted.get(), x5.size()*x4.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x1.size(), x0.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x5.size(), x4.size(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0, x5, x4);
 }
 
@@ -528,8 +528,8 @@ void Task424::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata, x0.size(), a1.size(), c2.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, x1);
+    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), x1.size());
   }
   out()->put_block(odata, x1, c2, a1, x0);
 }
@@ -539,28 +539,28 @@ void Task425::Task_local::compute() {
   const Index x2 = b(1);
   // tensor label: I444
   std::unique_ptr<double[]> odata = out()->move_block(x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2), 0.0);
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         for (auto& x0 : *range_[1]) {
           // tensor label: Gamma194
-          std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x3, x2, x1, x0);
-          std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x3, x2, x1, x0)]);
-          sort_indices<0,1,4,5,2,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
+          const double* i0data = in(0)->get_block_view(x5, x4, x3, x2, x1, x0);
+          BlockBuffer i0data_sorted(in(0)->get_size(x5, x4, x3, x2, x1, x0));
+          sort_indices<0,1,4,5,2,3,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
           // tensor label: I547
-          std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, x5, x4);
-          std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, x5, x4)]);
-          sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), x5.size(), x4.size());
+          const double* i1data = in(1)->get_block_view(x1, x0, x5, x4);
+          BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, x5, x4));
+          sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), x5.size(), x4.size());
           dgemm_("T", "N", x3.size()*x2.size(), 1, x1.size()*x0.size()*x5.size()*x4.size(),
-                 1.0, i0data_sorted, x1.size()*x0.size()*x5.size()*x4.size(), i1data_sorted, x1.size()*x0.size()*x5.size()*x4.size(),
-                 1.0, odata_sorted, x3.size()*x2.size());
+                 1.0, i0data_sorted.get(), x1.size()*x0.size()*x5.size()*x4.size(), i1data_sorted.get(), x1.size()*x0.size()*x5.size()*x4.size(),
+                 1.0, odata_sorted.get(), x3.size()*x2.size());
         }
       }
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size());
   out()->put_block(odata, x3, x2);
 }
 
@@ -571,24 +571,24 @@ void Task426::Task_local::compute() {
   const Index x4 = b(3);
   // tensor label: I547
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x5, x4);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x5, x4)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x5, x4));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x5, x4), 0.0);
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, x5, x4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1, x5, x4)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size(), x5.size(), x4.size());
+      const double* i0data = in(0)->get_block_view(c2, a1, x5, x4);
+      BlockBuffer i0data_sorted(in(0)->get_size(c2, a1, x5, x4));
+      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c2.size(), a1.size(), x5.size(), x4.size());
       // tensor label: I548
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c2, a1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c2, a1, x0)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), c2.size(), a1.size(), x0.size());
+      const double* i1data = in(1)->get_block_view(x1, c2, a1, x0);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, c2, a1, x0));
+      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), c2.size(), a1.size(), x0.size());
       dgemm_("T", "N", x5.size()*x4.size(), x1.size()*x0.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, x5.size()*x4.size());
+             1.0, i0data_sorted.get(), c2.size()*a1.size(), i1data_sorted.get(), c2.size()*a1.size(),
+             1.0, odata_sorted.get(), x5.size()*x4.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x1.size(), x0.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x5.size(), x4.size(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0, x5, x4);
 }
 
@@ -601,8 +601,8 @@ void Task427::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-    sort_indices<3,2,1,0,1,1,-1,1>(i0data, odata, x0.size(), a1.size(), c2.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, x1);
+    sort_indices<3,2,1,0,1,1,-1,1>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), x1.size());
   }
   out()->put_block(odata, x1, c2, a1, x0);
 }
@@ -614,24 +614,24 @@ void Task428::Task_local::compute() {
   const Index x4 = b(3);
   // tensor label: I547
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x5, x4);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x5, x4)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x5, x4));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x5, x4), 0.0);
   for (auto& a2 : *range_[2]) {
     for (auto& c1 : *range_[0]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a2, c1, x4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a2, c1, x4)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), a2.size(), c1.size(), x4.size());
+      const double* i0data = in(0)->get_block_view(x5, a2, c1, x4);
+      BlockBuffer i0data_sorted(in(0)->get_size(x5, a2, c1, x4));
+      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), a2.size(), c1.size(), x4.size());
       // tensor label: I581
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, a2, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, a2, c1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), a2.size(), c1.size());
+      const double* i1data = in(1)->get_block_view(x1, x0, a2, c1);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, a2, c1));
+      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), a2.size(), c1.size());
       dgemm_("T", "N", x5.size()*x4.size(), x1.size()*x0.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x5.size()*x4.size());
+             1.0, i0data_sorted.get(), a2.size()*c1.size(), i1data_sorted.get(), a2.size()*c1.size(),
+             1.0, odata_sorted.get(), x5.size()*x4.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x1.size(), x0.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x5.size(), x4.size(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0, x5, x4);
 }
 
@@ -644,8 +644,8 @@ void Task429::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x0, x1);
-    sort_indices<3,2,1,0,1,1,-1,1>(i0data, odata, c1.size(), a2.size(), x0.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, x0, x1);
+    sort_indices<3,2,1,0,1,1,-1,1>(i0data, odata.get(), c1.size(), a2.size(), x0.size(), x1.size());
   }
   out()->put_block(odata, x1, x0, a2, c1);
 }
@@ -657,24 +657,24 @@ void Task430::Task_local::compute() {
   const Index x4 = b(3);
   // tensor label: I547
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x5, x4);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x5, x4)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x5, x4));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x5, x4), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x5, x4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, x5, x4)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), x5.size(), x4.size());
+      const double* i0data = in(0)->get_block_view(c1, a2, x5, x4);
+      BlockBuffer i0data_sorted(in(0)->get_size(c1, a2, x5, x4));
+      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), a2.size(), x5.size(), x4.size());
       // tensor label: I590
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, a2, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, a2, c1)]);
-      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), a2.size(), c1.size());
+      const double* i1data = in(1)->get_block_view(x1, x0, a2, c1);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, a2, c1));
+      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), a2.size(), c1.size());
       dgemm_("T", "N", x5.size()*x4.size(), x1.size()*x0.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x5.size()*x4.size());
+             1.0, i0data_sorted.get(), a2.size()*c1.size(), i1data_sorted.get(), a2.size()*c1.size(),
+             1.0, odata_sorted.get(), x5.size()*x4.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x1.size(), x0.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x5.size(), x4.size(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0, x5, x4);
 }
 
@@ -687,8 +687,8 @@ void Task431::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, a2, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x0, x1);
-    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata, c1.size(), a2.size(), x0.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c1, a2, x0, x1);
+    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata.get(), c1.size(), a2.size(), x0.size(), x1.size());
   }
   out()->put_block(odata, x1, x0, a2, c1);
 }
@@ -698,28 +698,28 @@ void Task432::Task_local::compute() {
   const Index x2 = b(1);
   // tensor label: I444
   std::unique_ptr<double[]> odata = out()->move_block(x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2), 0.0);
   for (auto& x5 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       for (auto& x4 : *range_[1]) {
         for (auto& x1 : *range_[1]) {
           // tensor label: Gamma252
-          std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x1, x3, x2);
-          std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x1, x3, x2)]);
-          sort_indices<0,1,2,3,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x1.size(), x3.size(), x2.size());
+          const double* i0data = in(0)->get_block_view(x5, x0, x4, x1, x3, x2);
+          BlockBuffer i0data_sorted(in(0)->get_size(x5, x0, x4, x1, x3, x2));
+          sort_indices<0,1,2,3,4,5,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), x0.size(), x4.size(), x1.size(), x3.size(), x2.size());
           // tensor label: I729
-          std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, x5, x4);
-          std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, x5, x4)]);
-          sort_indices<2,1,3,0,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), x5.size(), x4.size());
+          const double* i1data = in(1)->get_block_view(x1, x0, x5, x4);
+          BlockBuffer i1data_sorted(in(1)->get_size(x1, x0, x5, x4));
+          sort_indices<2,1,3,0,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), x0.size(), x5.size(), x4.size());
           dgemm_("T", "N", x3.size()*x2.size(), 1, x1.size()*x0.size()*x5.size()*x4.size(),
-                 1.0, i0data_sorted, x1.size()*x0.size()*x5.size()*x4.size(), i1data_sorted, x1.size()*x0.size()*x5.size()*x4.size(),
-                 1.0, odata_sorted, x3.size()*x2.size());
+                 1.0, i0data_sorted.get(), x1.size()*x0.size()*x5.size()*x4.size(), i1data_sorted.get(), x1.size()*x0.size()*x5.size()*x4.size(),
+                 1.0, odata_sorted.get(), x3.size()*x2.size());
         }
       }
     }
   }
-  sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size());
+  sort_indices<0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size());
   out()->put_block(odata, x3, x2);
 }
 
@@ -730,24 +730,24 @@ void Task433::Task_local::compute() {
   const Index x4 = b(3);
   // tensor label: I729
   std::unique_ptr<double[]> odata = out()->move_block(x1, x0, x5, x4);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x5, x4)]);
+  BlockBuffer odata_sorted(out()->get_size(x1, x0, x5, x4));
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x5, x4), 0.0);
   for (auto& a1 : *range_[2]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, x4, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a1, x4, a2)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x5.size(), a1.size(), x4.size(), a2.size());
+      const double* i0data = in(0)->get_block_view(x5, a1, x4, a2);
+      BlockBuffer i0data_sorted(in(0)->get_size(x5, a1, x4, a2));
+      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), a1.size(), x4.size(), a2.size());
       // tensor label: I730
-      std::unique_ptr<double[]> i1data = in(1)->get_block(a2, x1, a1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, x1, a1, x0)]);
-      sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, a2.size(), x1.size(), a1.size(), x0.size());
+      const double* i1data = in(1)->get_block_view(a2, x1, a1, x0);
+      BlockBuffer i1data_sorted(in(1)->get_size(a2, x1, a1, x0));
+      sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted.get(), a2.size(), x1.size(), a1.size(), x0.size());
       dgemm_("T", "N", x5.size()*x4.size(), x1.size()*x0.size(), a2.size()*a1.size(),
-             1.0, i0data_sorted, a2.size()*a1.size(), i1data_sorted, a2.size()*a1.size(),
-             1.0, odata_sorted, x5.size()*x4.size());
+             1.0, i0data_sorted.get(), a2.size()*a1.size(), i1data_sorted.get(), a2.size()*a1.size(),
+             1.0, odata_sorted.get(), x5.size()*x4.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x1.size(), x0.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x5.size(), x4.size(), x1.size(), x0.size());
   out()->put_block(odata, x1, x0, x5, x4);
 }
 
@@ -760,8 +760,8 @@ void Task434::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a2, x1, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, x1, a2);
-    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata, x0.size(), a1.size(), x1.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, x1, a2);
+    sort_indices<3,2,1,0,1,1,2,1>(i0data, odata.get(), x0.size(), a1.size(), x1.size(), a2.size());
   }
   out()->put_block(odata, a2, x1, a1, x0);
 }
@@ -773,8 +773,8 @@ void Task435::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(c3, c2);
   {
     // tensor label: I447
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c2, c3);
-    sort_indices<1,0,1,1,1,1>(i0data, odata, c2.size(), c3.size());
+    const double* i0data = in(0)->get_block_view(c2, c3);
+    sort_indices<1,0,1,1,1,1>(i0data, odata.get(), c2.size(), c3.size());
   }
   out()->put_block(odata, c3, c2);
 }
@@ -784,26 +784,26 @@ void Task436::Task_local::compute() {
   const Index c3 = b(1);
   // tensor label: I447
   std::unique_ptr<double[]> odata = out()->move_block(c2, c3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c3)]);
+  BlockBuffer odata_sorted(out()->get_size(c2, c3));
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c3), 0.0);
   for (auto& c1 : *range_[0]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x3, c3, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x3, c3, x2)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), x3.size(), c3.size(), x2.size());
+        const double* i0data = in(0)->get_block_view(c1, x3, c3, x2);
+        BlockBuffer i0data_sorted(in(0)->get_size(c1, x3, c3, x2));
+        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), x3.size(), c3.size(), x2.size());
         // tensor label: I448
-        std::unique_ptr<double[]> i1data = in(1)->get_block(c2, c1, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, c1, x3, x2)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted, c2.size(), c1.size(), x3.size(), x2.size());
+        const double* i1data = in(1)->get_block_view(c2, c1, x3, x2);
+        BlockBuffer i1data_sorted(in(1)->get_size(c2, c1, x3, x2));
+        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted.get(), c2.size(), c1.size(), x3.size(), x2.size());
         dgemm_("T", "N", c3.size(), c2.size(), c1.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, c1.size()*x3.size()*x2.size(), i1data_sorted, c1.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, c3.size());
+               1.0, i0data_sorted.get(), c1.size()*x3.size()*x2.size(), i1data_sorted.get(), c1.size()*x3.size()*x2.size(),
+               1.0, odata_sorted.get(), c3.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c3.size(), c2.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), c3.size(), c2.size());
   out()->put_block(odata, c2, c3);
 }
 
@@ -814,24 +814,24 @@ void Task437::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I448
   std::unique_ptr<double[]> odata = out()->move_block(c2, c1, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c1, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(c2, c1, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c1, x3, x2), 0.0);
   for (auto& x0 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: Gamma92
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x3, x1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x3, x1, x2)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), x3.size(), x1.size(), x2.size());
+      const double* i0data = in(0)->get_block_view(x0, x3, x1, x2);
+      BlockBuffer i0data_sorted(in(0)->get_size(x0, x3, x1, x2));
+      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), x3.size(), x1.size(), x2.size());
       // tensor label: I449
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c2, x0, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c2, x0, c1)]);
-      sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), c2.size(), x0.size(), c1.size());
+      const double* i1data = in(1)->get_block_view(x1, c2, x0, c1);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, c2, x0, c1));
+      sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), c2.size(), x0.size(), c1.size());
       dgemm_("T", "N", x3.size()*x2.size(), c2.size()*c1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), x1.size()*x0.size(), i1data_sorted.get(), x1.size()*x0.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), c2.size(), c1.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), c2.size(), c1.size());
   out()->put_block(odata, c2, c1, x3, x2);
 }
 
@@ -844,8 +844,8 @@ void Task438::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, c2, x0, c1);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x0, c2, x1);
-    sort_indices<3,2,1,0,1,1,-4,1>(i0data, odata, c1.size(), x0.size(), c2.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(c1, x0, c2, x1);
+    sort_indices<3,2,1,0,1,1,-4,1>(i0data, odata.get(), c1.size(), x0.size(), c2.size(), x1.size());
   }
   out()->put_block(odata, x1, c2, x0, c1);
 }
@@ -855,26 +855,26 @@ void Task439::Task_local::compute() {
   const Index c3 = b(1);
   // tensor label: I447
   std::unique_ptr<double[]> odata = out()->move_block(c2, c3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c3)]);
+  BlockBuffer odata_sorted(out()->get_size(c2, c3));
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c3), 0.0);
   for (auto& x3 : *range_[1]) {
     for (auto& a1 : *range_[2]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, c3, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, c3, x2)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), c3.size(), x2.size());
+        const double* i0data = in(0)->get_block_view(x3, a1, c3, x2);
+        BlockBuffer i0data_sorted(in(0)->get_size(x3, a1, c3, x2));
+        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a1.size(), c3.size(), x2.size());
         // tensor label: I541
-        std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x3, x2)]);
-        sort_indices<2,1,3,0,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x3.size(), x2.size());
+        const double* i1data = in(1)->get_block_view(c2, a1, x3, x2);
+        BlockBuffer i1data_sorted(in(1)->get_size(c2, a1, x3, x2));
+        sort_indices<2,1,3,0,0,1,1,1>(i1data, i1data_sorted.get(), c2.size(), a1.size(), x3.size(), x2.size());
         dgemm_("T", "N", c3.size(), c2.size(), a1.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, a1.size()*x3.size()*x2.size(), i1data_sorted, a1.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, c3.size());
+               1.0, i0data_sorted.get(), a1.size()*x3.size()*x2.size(), i1data_sorted.get(), a1.size()*x3.size()*x2.size(),
+               1.0, odata_sorted.get(), c3.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c3.size(), c2.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), c3.size(), c2.size());
   out()->put_block(odata, c2, c3);
 }
 
@@ -885,24 +885,24 @@ void Task440::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I541
   std::unique_ptr<double[]> odata = out()->move_block(c2, a1, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(c2, a1, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1, x3, x2), 0.0);
   for (auto& x0 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: Gamma32
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x1, x2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x1.size(), x2.size());
+      const double* i0data = in(0)->get_block_view(x3, x0, x1, x2);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, x0, x1, x2));
+      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x0.size(), x1.size(), x2.size());
       // tensor label: I542
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c2, a1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c2, a1, x0)]);
-      sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, x1.size(), c2.size(), a1.size(), x0.size());
+      const double* i1data = in(1)->get_block_view(x1, c2, a1, x0);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, c2, a1, x0));
+      sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), c2.size(), a1.size(), x0.size());
       dgemm_("T", "N", x3.size()*x2.size(), c2.size()*a1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), x1.size()*x0.size(), i1data_sorted.get(), x1.size()*x0.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), c2.size(), a1.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), c2.size(), a1.size());
   out()->put_block(odata, c2, a1, x3, x2);
 }
 
@@ -915,8 +915,8 @@ void Task441::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-    sort_indices<3,2,1,0,1,1,-1,1>(i0data, odata, x0.size(), a1.size(), c2.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, x1);
+    sort_indices<3,2,1,0,1,1,-1,1>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), x1.size());
   }
   out()->put_block(odata, x1, c2, a1, x0);
 }
@@ -926,26 +926,26 @@ void Task442::Task_local::compute() {
   const Index c3 = b(1);
   // tensor label: I447
   std::unique_ptr<double[]> odata = out()->move_block(c2, c3);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c3)]);
+  BlockBuffer odata_sorted(out()->get_size(c2, c3));
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c3), 0.0);
   for (auto& a1 : *range_[2]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a1, x3, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a1, x3, x2)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, c3.size(), a1.size(), x3.size(), x2.size());
+        const double* i0data = in(0)->get_block_view(c3, a1, x3, x2);
+        BlockBuffer i0data_sorted(in(0)->get_size(c3, a1, x3, x2));
+        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted.get(), c3.size(), a1.size(), x3.size(), x2.size());
         // tensor label: I550
-        std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x3, x2)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x3.size(), x2.size());
+        const double* i1data = in(1)->get_block_view(c2, a1, x3, x2);
+        BlockBuffer i1data_sorted(in(1)->get_size(c2, a1, x3, x2));
+        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted.get(), c2.size(), a1.size(), x3.size(), x2.size());
         dgemm_("T", "N", c3.size(), c2.size(), a1.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, a1.size()*x3.size()*x2.size(), i1data_sorted, a1.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, c3.size());
+               1.0, i0data_sorted.get(), a1.size()*x3.size()*x2.size(), i1data_sorted.get(), a1.size()*x3.size()*x2.size(),
+               1.0, odata_sorted.get(), c3.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c3.size(), c2.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), c3.size(), c2.size());
   out()->put_block(odata, c2, c3);
 }
 
@@ -956,24 +956,24 @@ void Task443::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I550
   std::unique_ptr<double[]> odata = out()->move_block(c2, a1, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(c2, a1, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1, x3, x2), 0.0);
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma35
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      const double* i0data = in(0)->get_block_view(x3, x2, x1, x0);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, x2, x1, x0));
+      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: I551
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c2, a1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c2, a1, x0)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x1.size(), c2.size(), a1.size(), x0.size());
+      const double* i1data = in(1)->get_block_view(x1, c2, a1, x0);
+      BlockBuffer i1data_sorted(in(1)->get_size(x1, c2, a1, x0));
+      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted.get(), x1.size(), c2.size(), a1.size(), x0.size());
       dgemm_("T", "N", x3.size()*x2.size(), c2.size()*a1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), x1.size()*x0.size(), i1data_sorted.get(), x1.size()*x0.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), c2.size(), a1.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), c2.size(), a1.size());
   out()->put_block(odata, c2, a1, x3, x2);
 }
 
@@ -986,8 +986,8 @@ void Task444::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, c2, a1, x0);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata, x0.size(), a1.size(), c2.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x0, a1, c2, x1);
+    sort_indices<3,2,1,0,1,1,1,1>(i0data, odata.get(), x0.size(), a1.size(), c2.size(), x1.size());
   }
   out()->put_block(odata, x1, c2, a1, x0);
 }
@@ -999,8 +999,8 @@ void Task445::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x2, c2);
   {
     // tensor label: I450
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x2, c2);
-    sort_indices<0,1,1,1,1,1>(i0data, odata, x2.size(), c2.size());
+    const double* i0data = in(0)->get_block_view(x2, c2);
+    sort_indices<0,1,1,1,1,1>(i0data, odata.get(), x2.size(), c2.size());
   }
   out()->put_block(odata, x2, c2);
 }
@@ -1010,26 +1010,26 @@ void Task446::Task_local::compute() {
   const Index c2 = b(1);
   // tensor label: I450
   std::unique_ptr<double[]> odata = out()->move_block(x2, c2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, c2)]);
+  BlockBuffer odata_sorted(out()->get_size(x2, c2));
   std::fill_n(odata_sorted.get(), out()->get_size(x2, c2), 0.0);
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x0, c2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x0, c2, x1)]);
-        sort_indices<3,1,0,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), x0.size(), c2.size(), x1.size());
+        const double* i0data = in(0)->get_block_view(c1, x0, c2, x1);
+        BlockBuffer i0data_sorted(in(0)->get_size(c1, x0, c2, x1));
+        sort_indices<3,1,0,2,0,1,1,1>(i0data, i0data_sorted.get(), c1.size(), x0.size(), c2.size(), x1.size());
         // tensor label: I451
-        std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x0, x1, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x0, x1, x2)]);
-        sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, c1.size(), x0.size(), x1.size(), x2.size());
+        const double* i1data = in(1)->get_block_view(c1, x0, x1, x2);
+        BlockBuffer i1data_sorted(in(1)->get_size(c1, x0, x1, x2));
+        sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted.get(), c1.size(), x0.size(), x1.size(), x2.size());
         dgemm_("T", "N", c2.size(), x2.size(), c1.size()*x0.size()*x1.size(),
-               1.0, i0data_sorted, c1.size()*x0.size()*x1.size(), i1data_sorted, c1.size()*x0.size()*x1.size(),
-               1.0, odata_sorted, c2.size());
+               1.0, i0data_sorted.get(), c1.size()*x0.size()*x1.size(), i1data_sorted.get(), c1.size()*x0.size()*x1.size(),
+               1.0, odata_sorted.get(), c2.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c2.size(), x2.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), c2.size(), x2.size());
   out()->put_block(odata, x2, c2);
 }
 
@@ -1040,26 +1040,26 @@ void Task447::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I451
   std::unique_ptr<double[]> odata = out()->move_block(c1, x0, x1, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x0, x1, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(c1, x0, x1, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x0, x1, x2), 0.0);
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x0, x3, x1, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x0, x3, x1, x2)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x0.size(), x3.size(), x1.size(), x2.size());
+        const double* i0data = in(0)->get_block_view(x5, x4, x0, x3, x1, x2);
+        BlockBuffer i0data_sorted(in(0)->get_size(x5, x4, x0, x3, x1, x2));
+        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), x4.size(), x0.size(), x3.size(), x1.size(), x2.size());
         // tensor label: I452
-        std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, c1, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, c1, x3)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted, x5.size(), x4.size(), c1.size(), x3.size());
+        const double* i1data = in(1)->get_block_view(x5, x4, c1, x3);
+        BlockBuffer i1data_sorted(in(1)->get_size(x5, x4, c1, x3));
+        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted.get(), x5.size(), x4.size(), c1.size(), x3.size());
         dgemm_("T", "N", x0.size()*x1.size()*x2.size(), c1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x0.size()*x1.size()*x2.size());
+               1.0, i0data_sorted.get(), x5.size()*x4.size()*x3.size(), i1data_sorted.get(), x5.size()*x4.size()*x3.size(),
+               1.0, odata_sorted.get(), x0.size()*x1.size()*x2.size());
       }
     }
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), c1.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), x2.size(), c1.size());
   out()->put_block(odata, c1, x0, x1, x2);
 }
 
@@ -1072,8 +1072,8 @@ void Task448::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x5, x4, c1, x3);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, c1, x3);
-    sort_indices<0,1,2,3,1,1,2,1>(i0data, odata, x5.size(), x4.size(), c1.size(), x3.size());
+    const double* i0data = in(0)->get_block_view(x5, x4, c1, x3);
+    sort_indices<0,1,2,3,1,1,2,1>(i0data, odata.get(), x5.size(), x4.size(), c1.size(), x3.size());
   }
   out()->put_block(odata, x5, x4, c1, x3);
 }
@@ -1083,26 +1083,26 @@ void Task449::Task_local::compute() {
   const Index c2 = b(1);
   // tensor label: I450
   std::unique_ptr<double[]> odata = out()->move_block(x2, c2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, c2)]);
+  BlockBuffer odata_sorted(out()->get_size(x2, c2));
   std::fill_n(odata_sorted.get(), out()->get_size(x2, c2), 0.0);
   for (auto& x1 : *range_[1]) {
     for (auto& a1 : *range_[2]) {
       for (auto& x0 : *range_[1]) {
         // tensor label: t2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, x1)]);
-        sort_indices<3,1,0,2,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
+        const double* i0data = in(0)->get_block_view(x0, a1, c2, x1);
+        BlockBuffer i0data_sorted(in(0)->get_size(x0, a1, c2, x1));
+        sort_indices<3,1,0,2,0,1,1,1>(i0data, i0data_sorted.get(), x0.size(), a1.size(), c2.size(), x1.size());
         // tensor label: I556
-        std::unique_ptr<double[]> i1data = in(1)->get_block(a1, x0, x1, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, x0, x1, x2)]);
-        sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, a1.size(), x0.size(), x1.size(), x2.size());
+        const double* i1data = in(1)->get_block_view(a1, x0, x1, x2);
+        BlockBuffer i1data_sorted(in(1)->get_size(a1, x0, x1, x2));
+        sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted.get(), a1.size(), x0.size(), x1.size(), x2.size());
         dgemm_("T", "N", c2.size(), x2.size(), a1.size()*x0.size()*x1.size(),
-               1.0, i0data_sorted, a1.size()*x0.size()*x1.size(), i1data_sorted, a1.size()*x0.size()*x1.size(),
-               1.0, odata_sorted, c2.size());
+               1.0, i0data_sorted.get(), a1.size()*x0.size()*x1.size(), i1data_sorted.get(), a1.size()*x0.size()*x1.size(),
+               1.0, odata_sorted.get(), c2.size());
       }
     }
   }
-  sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c2.size(), x2.size());
+  sort_indices<1,0,1,1,1,1>(odata_sorted.get(), odata.get(), c2.size(), x2.size());
   out()->put_block(odata, x2, c2);
 }
 
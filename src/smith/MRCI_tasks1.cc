@@ -43,9 +43,9 @@ void Task0::Task_local::compute() {
   // tensor label: Gamma0
   std::unique_ptr<double[]> odata = out()->move_block(x5, x0, x4, x1);
   // associated with merged
-  std::unique_ptr<double[]> fdata = in(1)->get_block(x3, x2);
+  const double* fdata = in(1)->get_block_view(x3, x2);
   {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x1, x3, x2);
+    const double* i0data = in(0)->get_block_view(x5, x0, x4, x1, x3, x2);
     for (int i2 = 0; i2 != x2.size(); ++i2) {
       for (int i3 = 0; i3 != x3.size(); ++i3) {
         for (int i1 = 0; i1 != x1.size(); ++i1) {
@@ -76,9 +76,9 @@ void Task1::Task_local::compute() {
   // tensor label: Gamma2
   std::unique_ptr<double[]> odata = out()->move_block(x7, x0, x6, x1);
   // associated with merged
-  std::unique_ptr<double[]> fdata = in(2)->get_block(x5, x4, x3, x2);
+  const double* fdata = in(2)->get_block_view(x5, x4, x3, x2);
   if (x3 == x4) {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x0, x6, x1, x5, x2);
+    const double* i0data = in(0)->get_block_view(x7, x0, x6, x1, x5, x2);
     for (int i2 = 0; i2 != x2.size(); ++i2) {
       for (int i5 = 0; i5 != x5.size(); ++i5) {
         for (int i1 = 0; i1 != x1.size(); ++i1) {
@@ -97,7 +97,7 @@ void Task1::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(x7, x0, x6, x1, x5, x4, x3, x2);
+    const double* i0data = in(1)->get_block_view(x7, x0, x6, x1, x5, x4, x3, x2);
     for (int i2 = 0; i2 != x2.size(); ++i2) {
       for (int i3 = 0; i3 != x3.size(); ++i3) {
         for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -128,8 +128,8 @@ void Task2::Task_local::compute() {
   // tensor label: Gamma7
   std::unique_ptr<double[]> odata = out()->move_block(x3, x1, x2, x0);
   {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x1, x2, x0);
-    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata, x3.size(), x1.size(), x2.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(x3, x1, x2, x0);
+    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata.get(), x3.size(), x1.size(), x2.size(), x0.size());
   }
   out()->put_block(odata, x3, x1, x2, x0);
 }
@@ -142,8 +142,8 @@ void Task3::Task_local::compute() {
   // tensor label: Gamma1
   std::unique_ptr<double[]> odata = out()->move_block(x3, x0, x2, x1);
   {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata, x3.size(), x0.size(), x2.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x3, x0, x2, x1);
+    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata.get(), x3.size(), x0.size(), x2.size(), x1.size());
   }
   out()->put_block(odata, x3, x0, x2, x1);
 }
@@ -158,8 +158,8 @@ void Task4::Task_local::compute() {
   // tensor label: Gamma3
   std::unique_ptr<double[]> odata = out()->move_block(x5, x0, x4, x1, x3, x2);
   {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x1, x3, x2);
-    sort_indices<0,1,2,3,4,5,1,1,1,1>(i0data, odata, x5.size(), x0.size(), x4.size(), x1.size(), x3.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x5, x0, x4, x1, x3, x2);
+    sort_indices<0,1,2,3,4,5,1,1,1,1>(i0data, odata.get(), x5.size(), x0.size(), x4.size(), x1.size(), x3.size(), x2.size());
   }
   out()->put_block(odata, x5, x0, x4, x1, x3, x2);
 }
@@ -175,7 +175,7 @@ void Task5::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x5, x0, x4, x3, x2, x1);
   {
     if (x2 == x3) {
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x1);
+      const double* i0data = in(0)->get_block_view(x5, x0, x4, x1);
       for (int i1 = 0; i1 != x1.size(); ++i1) {
         for (int i3 = 0; i3 != x3.size(); ++i3) {
           for (int i4 = 0; i4 != x4.size(); ++i4) {
@@ -191,8 +191,8 @@ void Task5::Task_local::compute() {
     }
   }
   {
-    std::unique_ptr<double[]> i0data = in(1)->get_block(x5, x0, x4, x3, x2, x1);
-    sort_indices<0,1,2,3,4,5,1,1,1,1>(i0data, odata, x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
+    const double* i0data = in(1)->get_block_view(x5, x0, x4, x3, x2, x1);
+    sort_indices<0,1,2,3,4,5,1,1,1,1>(i0data, odata.get(), x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
   }
   out()->put_block(odata, x5, x0, x4, x3, x2, x1);
 }
@@ -207,8 +207,8 @@ void Task6::Task_local::compute() {
   // tensor label: Gamma5
   std::unique_ptr<double[]> odata = out()->move_block(x5, x0, x4, x2, x3, x1);
   {
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x2, x3, x1);
-    sort_indices<0,1,2,3,4,5,1,1,-1,1>(i0data, odata, x5.size(), x0.size(), x4.size(), x2.size(), x3.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x5, x0, x4, x2, x3, x1);
+    sort_indices<0,1,2,3,4,5,1,1,-1,1>(i0data, odata.get(), x5.size(), x0.size(), x4.size(), x2.size(), x3.size(), x1.size());
   }
   out()->put_block(odata, x5, x0, x4, x2, x3, x1);
 }
@@ -222,8 +222,8 @@ void Task8::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, a2, x0, a1);
   {
     // tensor label: I0
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1, a1, a2);
-    sort_indices<1,3,0,2,1,1,1,1>(i0data, odata, x0.size(), x1.size(), a1.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(x0, x1, a1, a2);
+    sort_indices<1,3,0,2,1,1,1,1>(i0data, odata.get(), x0.size(), x1.size(), a1.size(), a2.size());
   }
   out()->put_block(odata, x1, a2, x0, a1);
 }
@@ -235,24 +235,24 @@ void Task9::Task_local::compute() {
   const Index a2 = b(3);
   // tensor label: I0
   std::unique_ptr<double[]> odata = out()->move_block(x0, x1, a1, a2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1, a1, a2)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, x1, a1, a2));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1, a1, a2), 0.0);
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, x4, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a1, x4, a2)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), a1.size(), x4.size(), a2.size());
+      const double* i0data = in(0)->get_block_view(x5, a1, x4, a2);
+      BlockBuffer i0data_sorted(in(0)->get_size(x5, a1, x4, a2));
+      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), a1.size(), x4.size(), a2.size());
       // tensor label: I1
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x0, x4, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x0, x4, x1)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i1data, i1data_sorted, x5.size(), x0.size(), x4.size(), x1.size());
+      const double* i1data = in(1)->get_block_view(x5, x0, x4, x1);
+      BlockBuffer i1data_sorted(in(1)->get_size(x5, x0, x4, x1));
+      sort_indices<0,2,1,3,0,1,1,1>(i1data, i1data_sorted.get(), x5.size(), x0.size(), x4.size(), x1.size());
       dgemm_("T", "N", a1.size()*a2.size(), x0.size()*x1.size(), x5.size()*x4.size(),
-             1.0, i0data_sorted, x5.size()*x4.size(), i1data_sorted, x5.size()*x4.size(),
-             1.0, odata_sorted, a1.size()*a2.size());
+             1.0, i0data_sorted.get(), x5.size()*x4.size(), i1data_sorted.get(), x5.size()*x4.size(),
+             1.0, odata_sorted.get(), a1.size()*a2.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, a1.size(), a2.size(), x0.size(), x1.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), a1.size(), a2.size(), x0.size(), x1.size());
   out()->put_block(odata, x0, x1, a1, a2);
 }
 
@@ -265,8 +265,8 @@ void Task10::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x5, x0, x4, x1);
   {
     // tensor label: Gamma0
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x1);
-    sort_indices<0,1,2,3,1,1,2,1>(i0data, odata, x5.size(), x0.size(), x4.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(x5, x0, x4, x1);
+    sort_indices<0,1,2,3,1,1,2,1>(i0data, odata.get(), x5.size(), x0.size(), x4.size(), x1.size());
   }
   out()->put_block(odata, x5, x0, x4, x1);
 }
@@ -278,24 +278,24 @@ void Task11::Task_local::compute() {
   const Index a2 = b(3);
   // tensor label: I0
   std::unique_ptr<double[]> odata = out()->move_block(x0, x1, a1, a2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1, a1, a2)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, x1, a1, a2));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1, a1, a2), 0.0);
   for (auto& x7 : *range_[1]) {
     for (auto& x6 : *range_[1]) {
       // tensor label: Gamma2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x0, x6, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, x0, x6, x1)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x7.size(), x0.size(), x6.size(), x1.size());
+      const double* i0data = in(0)->get_block_view(x7, x0, x6, x1);
+      BlockBuffer i0data_sorted(in(0)->get_size(x7, x0, x6, x1));
+      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted.get(), x7.size(), x0.size(), x6.size(), x1.size());
       // tensor label: I6
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x7, a1, x6, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x7, a1, x6, a2)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i1data, i1data_sorted, x7.size(), a1.size(), x6.size(), a2.size());
+      const double* i1data = in(1)->get_block_view(x7, a1, x6, a2);
+      BlockBuffer i1data_sorted(in(1)->get_size(x7, a1, x6, a2));
+      sort_indices<0,2,1,3,0,1,1,1>(i1data, i1data_sorted.get(), x7.size(), a1.size(), x6.size(), a2.size());
       dgemm_("T", "N", x0.size()*x1.size(), a1.size()*a2.size(), x7.size()*x6.size(),
-             1.0, i0data_sorted, x7.size()*x6.size(), i1data_sorted, x7.size()*x6.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+             1.0, i0data_sorted.get(), x7.size()*x6.size(), i1data_sorted.get(), x7.size()*x6.size(),
+             1.0, odata_sorted.get(), x0.size()*x1.size());
     }
   }
-  sort_indices<0,1,2,3,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a1.size(), a2.size());
+  sort_indices<0,1,2,3,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), a1.size(), a2.size());
   out()->put_block(odata, x0, x1, a1, a2);
 }
 
@@ -308,8 +308,8 @@ void Task12::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x7, a1, x6, a2);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x7, a1, x6, a2);
-    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata, x7.size(), a1.size(), x6.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(x7, a1, x6, a2);
+    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata.get(), x7.size(), a1.size(), x6.size(), a2.size());
   }
   out()->put_block(odata, x7, a1, x6, a2);
 }
@@ -321,24 +321,24 @@ void Task13::Task_local::compute() {
   const Index a2 = b(3);
   // tensor label: I0
   std::unique_ptr<double[]> odata = out()->move_block(x0, x1, a1, a2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1, a1, a2)]);
+  BlockBuffer odata_sorted(out()->get_size(x0, x1, a1, a2));
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1, a1, a2), 0.0);
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma7
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x1, x2, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x1, x2, x0)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x1.size(), x2.size(), x0.size());
+      const double* i0data = in(0)->get_block_view(x3, x1, x2, x0);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, x1, x2, x0));
+      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x1.size(), x2.size(), x0.size());
       // tensor label: I20
-      std::unique_ptr<double[]> i1data = in(1)->get_block(a1, a2, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, a2, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, a1.size(), a2.size(), x3.size(), x2.size());
+      const double* i1data = in(1)->get_block_view(a1, a2, x3, x2);
+      BlockBuffer i1data_sorted(in(1)->get_size(a1, a2, x3, x2));
+      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted.get(), a1.size(), a2.size(), x3.size(), x2.size());
       dgemm_("T", "N", x1.size()*x0.size(), a1.size()*a2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+             1.0, i0data_sorted.get(), x3.size()*x2.size(), i1data_sorted.get(), x3.size()*x2.size(),
+             1.0, odata_sorted.get(), x1.size()*x0.size());
     }
   }
-  sort_indices<1,0,2,3,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a1.size(), a2.size());
+  sort_indices<1,0,2,3,1,1,1,1>(odata_sorted.get(), odata.get(), x1.size(), x0.size(), a1.size(), a2.size());
   out()->put_block(odata, x0, x1, a1, a2);
 }
 
@@ -349,24 +349,24 @@ void Task14::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I20
   std::unique_ptr<double[]> odata = out()->move_block(a1, a2, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, a2, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(a1, a2, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(a1, a2, x3, x2), 0.0);
   for (auto& a3 : *range_[2]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: t2
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a3, x2, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a3, x2, a4)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), a3.size(), x2.size(), a4.size());
+      const double* i0data = in(0)->get_block_view(x3, a3, x2, a4);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, a3, x2, a4));
+      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a3.size(), x2.size(), a4.size());
       // tensor label: I21
-      std::unique_ptr<double[]> i1data = in(1)->get_block(a4, a1, a3, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, a1, a3, a2)]);
-      sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, a4.size(), a1.size(), a3.size(), a2.size());
+      const double* i1data = in(1)->get_block_view(a4, a1, a3, a2);
+      BlockBuffer i1data_sorted(in(1)->get_size(a4, a1, a3, a2));
+      sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted.get(), a4.size(), a1.size(), a3.size(), a2.size());
       dgemm_("T", "N", x3.size()*x2.size(), a1.size()*a2.size(), a4.size()*a3.size(),
-             1.0, i0data_sorted, a4.size()*a3.size(), i1data_sorted, a4.size()*a3.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+             1.0, i0data_sorted.get(), a4.size()*a3.size(), i1data_sorted.get(), a4.size()*a3.size(),
+             1.0, odata_sorted.get(), x3.size()*x2.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), a1.size(), a2.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), x2.size(), a1.size(), a2.size());
   out()->put_block(odata, a1, a2, x3, x2);
 }
 
@@ -379,8 +379,8 @@ void Task15::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a4, a1, a3, a2);
   {
     // tensor label: v2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a4, a1, a3, a2);
-    sort_indices<0,1,2,3,1,1,-2,1>(i0data, odata, a4.size(), a1.size(), a3.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(a4, a1, a3, a2);
+    sort_indices<0,1,2,3,1,1,-2,1>(i0data, odata.get(), a4.size(), a1.size(), a3.size(), a2.size());
   }
   out()->put_block(odata, a4, a1, a3, a2);
 }
@@ -394,13 +394,13 @@ void Task16::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, a2, x0, a1);
   {
     // tensor label: I2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a2, a1, x0, x1);
-    sort_indices<3,0,2,1,1,1,1,1>(i0data, odata, a2.size(), a1.size(), x0.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(a2, a1, x0, x1);
+    sort_indices<3,0,2,1,1,1,1,1>(i0data, odata.get(), a2.size(), a1.size(), x0.size(), x1.size());
   }
   {
     // tensor label: I2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a1, a2, x1, x0);
-    sort_indices<2,1,3,0,1,1,1,1>(i0data, odata, a1.size(), a2.size(), x1.size(), x0.size());
+    const double* i0data = in(0)->get_block_view(a1, a2, x1, x0);
+    sort_indices<2,1,3,0,1,1,1,1>(i0data, odata.get(), a1.size(), a2.size(), x1.size(), x0.size());
   }
   out()->put_block(odata, x1, a2, x0, a1);
 }
@@ -412,24 +412,24 @@ void Task17::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I2
   std::unique_ptr<double[]> odata = out()->move_block(a2, a1, x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, a1, x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(a2, a1, x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(a2, a1, x0, x1), 0.0);
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma1
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+      const double* i0data = in(0)->get_block_view(x3, x0, x2, x1);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, x0, x2, x1));
+      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x0.size(), x2.size(), x1.size());
       // tensor label: I3
-      std::unique_ptr<double[]> i1data = in(1)->get_block(a2, x3, a1, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, x3, a1, x2)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i1data, i1data_sorted, a2.size(), x3.size(), a1.size(), x2.size());
+      const double* i1data = in(1)->get_block_view(a2, x3, a1, x2);
+      BlockBuffer i1data_sorted(in(1)->get_size(a2, x3, a1, x2));
+      sort_indices<1,3,0,2,0,1,1,1>(i1data, i1data_sorted.get(), a2.size(), x3.size(), a1.size(), x2.size());
       dgemm_("T", "N", x0.size()*x1.size(), a2.size()*a1.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+             1.0, i0data_sorted.get(), x3.size()*x2.size(), i1data_sorted.get(), x3.size()*x2.size(),
+             1.0, odata_sorted.get(), x0.size()*x1.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a2.size(), a1.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), a2.size(), a1.size());
   out()->put_block(odata, a2, a1, x0, x1);
 }
 
@@ -440,22 +440,22 @@ void Task18::Task_local::compute() {
   const Index x2 = b(3);
   // tensor label: I3
   std::unique_ptr<double[]> odata = out()->move_block(a2, x3, a1, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, x3, a1, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(a2, x3, a1, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(a2, x3, a1, x2), 0.0);
   for (auto& a3 : *range_[2]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, x2, a3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, x2, a3)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), x2.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(x3, a1, x2, a3);
+    BlockBuffer i0data_sorted(in(0)->get_size(x3, a1, x2, a3));
+    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), a1.size(), x2.size(), a3.size());
     // tensor label: I4
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a3, a2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, a2)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a3.size(), a2.size());
+    const double* i1data = in(1)->get_block_view(a3, a2);
+    BlockBuffer i1data_sorted(in(1)->get_size(a3, a2));
+    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), a2.size());
     dgemm_("T", "N", x3.size()*a1.size()*x2.size(), a2.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, x3.size()*a1.size()*x2.size());
+           1.0, i0data_sorted.get(), a3.size(), i1data_sorted.get(), a3.size(),
+           1.0, odata_sorted.get(), x3.size()*a1.size()*x2.size());
   }
-  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x3.size(), a1.size(), x2.size(), a2.size());
+  sort_indices<3,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x3.size(), a1.size(), x2.size(), a2.size());
   out()->put_block(odata, a2, x3, a1, x2);
 }
 
@@ -466,8 +466,8 @@ void Task19::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, a2);
   {
     // tensor label: h1
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a3, a2);
-    sort_indices<0,1,1,1,2,1>(i0data, odata, a3.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(a3, a2);
+    sort_indices<0,1,1,1,2,1>(i0data, odata.get(), a3.size(), a2.size());
   }
   out()->put_block(odata, a3, a2);
 }
@@ -479,26 +479,26 @@ void Task20::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I2
   std::unique_ptr<double[]> odata = out()->move_block(a2, a1, x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, a1, x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(a2, a1, x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(a2, a1, x0, x1), 0.0);
   for (auto& a3 : *range_[2]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: v2
-        std::unique_ptr<double[]> i0data = in(0)->get_block(a3, a2, x3, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a3, a2, x3, x2)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, a3.size(), a2.size(), x3.size(), x2.size());
+        const double* i0data = in(0)->get_block_view(a3, a2, x3, x2);
+        BlockBuffer i0data_sorted(in(0)->get_size(a3, a2, x3, x2));
+        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted.get(), a3.size(), a2.size(), x3.size(), x2.size());
         // tensor label: I8
-        std::unique_ptr<double[]> i1data = in(1)->get_block(a1, a3, x0, x1, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, a3, x0, x1, x3, x2)]);
-        sort_indices<1,4,5,0,2,3,0,1,1,1>(i1data, i1data_sorted, a1.size(), a3.size(), x0.size(), x1.size(), x3.size(), x2.size());
+        const double* i1data = in(1)->get_block_view(a1, a3, x0, x1, x3, x2);
+        BlockBuffer i1data_sorted(in(1)->get_size(a1, a3, x0, x1, x3, x2));
+        sort_indices<1,4,5,0,2,3,0,1,1,1>(i1data, i1data_sorted.get(), a1.size(), a3.size(), x0.size(), x1.size(), x3.size(), x2.size());
         dgemm_("T", "N", a2.size(), a1.size()*x0.size()*x1.size(), a3.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, a3.size()*x3.size()*x2.size(), i1data_sorted, a3.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, a2.size());
+               1.0, i0data_sorted.get(), a3.size()*x3.size()*x2.size(), i1data_sorted.get(), a3.size()*x3.size()*x2.size(),
+               1.0, odata_sorted.get(), a2.size());
       }
     }
   }
-  sort_indices<0,1,2,3,1,1,1,1>(odata_sorted, odata, a2.size(), a1.size(), x0.size(), x1.size());
+  sort_indices<0,1,2,3,1,1,1,1>(odata_sorted.get(), odata.get(), a2.size(), a1.size(), x0.size(), x1.size());
   out()->put_block(odata, a2, a1, x0, x1);
 }
 
@@ -511,24 +511,24 @@ void Task21::Task_local::compute() {
   const Index x2 = b(5);
   // tensor label: I8
   std::unique_ptr<double[]> odata = out()->move_block(a1, a3, x0, x1, x3, x2);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, a3, x0, x1, x3, x2)]);
+  BlockBuffer odata_sorted(out()->get_size(a1, a3, x0, x1, x3, x2));
   std::fill_n(odata_sorted.get(), out()->get_size(a1, a3, x0, x1, x3, x2), 0.0);
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       // tensor label: Gamma3
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x1, x3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x1, x3, x2)]);
-      sort_indices<0,2,1,3,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x1.size(), x3.size(), x2.size());
+      const double* i0data = in(0)->get_block_view(x5, x0, x4, x1, x3, x2);
+      BlockBuffer i0data_sorted(in(0)->get_size(x5, x0, x4, x1, x3, x2));
+      sort_indices<0,2,1,3,4,5,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), x0.size(), x4.size(), x1.size(), x3.size(), x2.size());
       // tensor label: I9
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a1, x4, a3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a1, x4, a3)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i1data, i1data_sorted, x5.size(), a1.size(), x4.size(), a3.size());
+      const double* i1data = in(1)->get_block_view(x5, a1, x4, a3);
+      BlockBuffer i1data_sorted(in(1)->get_size(x5, a1, x4, a3));
+      sort_indices<0,2,1,3,0,1,1,1>(i1data, i1data_sorted.get(), x5.size(), a1.size(), x4.size(), a3.size());
       dgemm_("T", "N", x0.size()*x1.size()*x3.size()*x2.size(), a1.size()*a3.size(), x5.size()*x4.size(),
-             1.0, i0data_sorted, x5.size()*x4.size(), i1data_sorted, x5.size()*x4.size(),
-             1.0, odata_sorted, x0.size()*x1.size()*x3.size()*x2.size());
+             1.0, i0data_sorted.get(), x5.size()*x4.size(), i1data_sorted.get(), x5.size()*x4.size(),
+             1.0, odata_sorted.get(), x0.size()*x1.size()*x3.size()*x2.size());
     }
   }
-  sort_indices<4,5,0,1,2,3,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x3.size(), x2.size(), a1.size(), a3.size());
+  sort_indices<4,5,0,1,2,3,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), x3.size(), x2.size(), a1.size(), a3.size());
   out()->put_block(odata, a1, a3, x0, x1, x3, x2);
 }
 
@@ -541,8 +541,8 @@ void Task22::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x5, a1, x4, a3);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, x4, a3);
-    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata, x5.size(), a1.size(), x4.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(x5, a1, x4, a3);
+    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata.get(), x5.size(), a1.size(), x4.size(), a3.size());
   }
   out()->put_block(odata, x5, a1, x4, a3);
 }
@@ -554,28 +554,28 @@ void Task23::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I2
   std::unique_ptr<double[]> odata = out()->move_block(a2, a1, x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, a1, x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(a2, a1, x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(a2, a1, x0, x1), 0.0);
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         for (auto& x2 : *range_[1]) {
           // tensor label: Gamma4
-          std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x3, x2, x1);
-          std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x3, x2, x1)]);
-          sort_indices<0,2,3,4,1,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
+          const double* i0data = in(0)->get_block_view(x5, x0, x4, x3, x2, x1);
+          BlockBuffer i0data_sorted(in(0)->get_size(x5, x0, x4, x3, x2, x1));
+          sort_indices<0,2,3,4,1,5,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
           // tensor label: I11
-          std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, a2, x5, a1, x4);
-          std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, a2, x5, a1, x4)]);
-          sort_indices<3,5,0,1,2,4,0,1,1,1>(i1data, i1data_sorted, x3.size(), x2.size(), a2.size(), x5.size(), a1.size(), x4.size());
+          const double* i1data = in(1)->get_block_view(x3, x2, a2, x5, a1, x4);
+          BlockBuffer i1data_sorted(in(1)->get_size(x3, x2, a2, x5, a1, x4));
+          sort_indices<3,5,0,1,2,4,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), x2.size(), a2.size(), x5.size(), a1.size(), x4.size());
           dgemm_("T", "N", x0.size()*x1.size(), a2.size()*a1.size(), x3.size()*x2.size()*x5.size()*x4.size(),
-                 1.0, i0data_sorted, x3.size()*x2.size()*x5.size()*x4.size(), i1data_sorted, x3.size()*x2.size()*x5.size()*x4.size(),
-                 1.0, odata_sorted, x0.size()*x1.size());
+                 1.0, i0data_sorted.get(), x3.size()*x2.size()*x5.size()*x4.size(), i1data_sorted.get(), x3.size()*x2.size()*x5.size()*x4.size(),
+                 1.0, odata_sorted.get(), x0.size()*x1.size());
         }
       }
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a2.size(), a1.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), a2.size(), a1.size());
   out()->put_block(odata, a2, a1, x0, x1);
 }
 
@@ -588,22 +588,22 @@ void Task24::Task_local::compute() {
   const Index x4 = b(5);
   // tensor label: I11
   std::unique_ptr<double[]> odata = out()->move_block(x3, x2, a2, x5, a1, x4);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, a2, x5, a1, x4)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, x2, a2, x5, a1, x4));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, a2, x5, a1, x4), 0.0);
   for (auto& a3 : *range_[2]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, x4, a3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a1, x4, a3)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, x5.size(), a1.size(), x4.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(x5, a1, x4, a3);
+    BlockBuffer i0data_sorted(in(0)->get_size(x5, a1, x4, a3));
+    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), a1.size(), x4.size(), a3.size());
     // tensor label: I12
-    std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x3, x2, a2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x3, x2, a2)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), x3.size(), x2.size(), a2.size());
+    const double* i1data = in(1)->get_block_view(a3, x3, x2, a2);
+    BlockBuffer i1data_sorted(in(1)->get_size(a3, x3, x2, a2));
+    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted.get(), a3.size(), x3.size(), x2.size(), a2.size());
     dgemm_("T", "N", x5.size()*a1.size()*x4.size(), x3.size()*x2.size()*a2.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, x5.size()*a1.size()*x4.size());
+           1.0, i0data_sorted.get(), a3.size(), i1data_sorted.get(), a3.size(),
+           1.0, odata_sorted.get(), x5.size()*a1.size()*x4.size());
   }
-  sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), a1.size(), x4.size(), x3.size(), x2.size(), a2.size());
+  sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x5.size(), a1.size(), x4.size(), x3.size(), x2.size(), a2.size());
   out()->put_block(odata, x3, x2, a2, x5, a1, x4);
 }
 
@@ -616,8 +616,8 @@ void Task25::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(a3, x3, x2, a2);
   {
     // tensor label: v2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a3, x3, x2, a2);
-    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata, a3.size(), x3.size(), x2.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(a3, x3, x2, a2);
+    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata.get(), a3.size(), x3.size(), x2.size(), a2.size());
   }
   out()->put_block(odata, a3, x3, x2, a2);
 }
@@ -629,28 +629,28 @@ void Task26::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I2
   std::unique_ptr<double[]> odata = out()->move_block(a2, a1, x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, a1, x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(a2, a1, x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(a2, a1, x0, x1), 0.0);
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         for (auto& x3 : *range_[1]) {
           // tensor label: Gamma5
-          std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x2, x3, x1);
-          std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x2, x3, x1)]);
-          sort_indices<0,2,3,4,1,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x2.size(), x3.size(), x1.size());
+          const double* i0data = in(0)->get_block_view(x5, x0, x4, x2, x3, x1);
+          BlockBuffer i0data_sorted(in(0)->get_size(x5, x0, x4, x2, x3, x1));
+          sort_indices<0,2,3,4,1,5,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), x0.size(), x4.size(), x2.size(), x3.size(), x1.size());
           // tensor label: I14
-          std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a2, x2, x5, a1, x4);
-          std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a2, x2, x5, a1, x4)]);
-          sort_indices<3,5,2,0,1,4,0,1,1,1>(i1data, i1data_sorted, x3.size(), a2.size(), x2.size(), x5.size(), a1.size(), x4.size());
+          const double* i1data = in(1)->get_block_view(x3, a2, x2, x5, a1, x4);
+          BlockBuffer i1data_sorted(in(1)->get_size(x3, a2, x2, x5, a1, x4));
+          sort_indices<3,5,2,0,1,4,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), a2.size(), x2.size(), x5.size(), a1.size(), x4.size());
           dgemm_("T", "N", x0.size()*x1.size(), a2.size()*a1.size(), x3.size()*x2.size()*x5.size()*x4.size(),
-                 1.0, i0data_sorted, x3.size()*x2.size()*x5.size()*x4.size(), i1data_sorted, x3.size()*x2.size()*x5.size()*x4.size(),
-                 1.0, odata_sorted, x0.size()*x1.size());
+                 1.0, i0data_sorted.get(), x3.size()*x2.size()*x5.size()*x4.size(), i1data_sorted.get(), x3.size()*x2.size()*x5.size()*x4.size(),
+                 1.0, odata_sorted.get(), x0.size()*x1.size());
         }
       }
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a2.size(), a1.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), a2.size(), a1.size());
   out()->put_block(odata, a2, a1, x0, x1);
 }
 
@@ -663,22 +663,22 @@ void Task27::Task_local::compute() {
   const Index x4 = b(5);
   // tensor label: I14
   std::unique_ptr<double[]> odata = out()->move_block(x3, a2, x2, x5, a1, x4);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, a2, x2, x5, a1, x4)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, a2, x2, x5, a1, x4));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, a2, x2, x5, a1, x4), 0.0);
   for (auto& a3 : *range_[2]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, x4, a3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a1, x4, a3)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, x5.size(), a1.size(), x4.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(x5, a1, x4, a3);
+    BlockBuffer i0data_sorted(in(0)->get_size(x5, a1, x4, a3));
+    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), a1.size(), x4.size(), a3.size());
     // tensor label: I15
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a2, a3, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a2, a3, x2)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), a2.size(), a3.size(), x2.size());
+    const double* i1data = in(1)->get_block_view(x3, a2, a3, x2);
+    BlockBuffer i1data_sorted(in(1)->get_size(x3, a2, a3, x2));
+    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), a2.size(), a3.size(), x2.size());
     dgemm_("T", "N", x5.size()*a1.size()*x4.size(), x3.size()*a2.size()*x2.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, x5.size()*a1.size()*x4.size());
+           1.0, i0data_sorted.get(), a3.size(), i1data_sorted.get(), a3.size(),
+           1.0, odata_sorted.get(), x5.size()*a1.size()*x4.size());
   }
-  sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), a1.size(), x4.size(), x3.size(), a2.size(), x2.size());
+  sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x5.size(), a1.size(), x4.size(), x3.size(), a2.size(), x2.size());
   out()->put_block(odata, x3, a2, x2, x5, a1, x4);
 }
 
@@ -691,8 +691,8 @@ void Task28::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x3, a2, a3, x2);
   {
     // tensor label: v2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a2, a3, x2);
-    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata, x3.size(), a2.size(), a3.size(), x2.size());
+    const double* i0data = in(0)->get_block_view(x3, a2, a3, x2);
+    sort_indices<0,1,2,3,1,1,-1,1>(i0data, odata.get(), x3.size(), a2.size(), a3.size(), x2.size());
   }
   out()->put_block(odata, x3, a2, a3, x2);
 }
@@ -704,28 +704,28 @@ void Task29::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I2
   std::unique_ptr<double[]> odata = out()->move_block(a2, a1, x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, a1, x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(a2, a1, x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(a2, a1, x0, x1), 0.0);
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         for (auto& x2 : *range_[1]) {
           // tensor label: Gamma3
-          std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x1, x3, x2);
-          std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x1, x3, x2)]);
-          sort_indices<0,2,4,5,1,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x1.size(), x3.size(), x2.size());
+          const double* i0data = in(0)->get_block_view(x5, x0, x4, x1, x3, x2);
+          BlockBuffer i0data_sorted(in(0)->get_size(x5, x0, x4, x1, x3, x2));
+          sort_indices<0,2,4,5,1,3,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), x0.size(), x4.size(), x1.size(), x3.size(), x2.size());
           // tensor label: I17
-          std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, a2, x5, a1, x4);
-          std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, a2, x5, a1, x4)]);
-          sort_indices<3,5,0,1,2,4,0,1,1,1>(i1data, i1data_sorted, x3.size(), x2.size(), a2.size(), x5.size(), a1.size(), x4.size());
+          const double* i1data = in(1)->get_block_view(x3, x2, a2, x5, a1, x4);
+          BlockBuffer i1data_sorted(in(1)->get_size(x3, x2, a2, x5, a1, x4));
+          sort_indices<3,5,0,1,2,4,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), x2.size(), a2.size(), x5.size(), a1.size(), x4.size());
           dgemm_("T", "N", x0.size()*x1.size(), a2.size()*a1.size(), x3.size()*x2.size()*x5.size()*x4.size(),
-                 1.0, i0data_sorted, x3.size()*x2.size()*x5.size()*x4.size(), i1data_sorted, x3.size()*x2.size()*x5.size()*x4.size(),
-                 1.0, odata_sorted, x0.size()*x1.size());
+                 1.0, i0data_sorted.get(), x3.size()*x2.size()*x5.size()*x4.size(), i1data_sorted.get(), x3.size()*x2.size()*x5.size()*x4.size(),
+                 1.0, odata_sorted.get(), x0.size()*x1.size());
         }
       }
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a2.size(), a1.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), a2.size(), a1.size());
   out()->put_block(odata, a2, a1, x0, x1);
 }
 
@@ -738,22 +738,22 @@ void Task30::Task_local::compute() {
   const Index x4 = b(5);
   // tensor label: I17
   std::unique_ptr<double[]> odata = out()->move_block(x3, x2, a2, x5, a1, x4);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, a2, x5, a1, x4)]);
+  BlockBuffer odata_sorted(out()->get_size(x3, x2, a2, x5, a1, x4));
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, a2, x5, a1, x4), 0.0);
   for (auto& a3 : *range_[2]) {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, x4, a3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a1, x4, a3)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, x5.size(), a1.size(), x4.size(), a3.size());
+    const double* i0data = in(0)->get_block_view(x5, a1, x4, a3);
+    BlockBuffer i0data_sorted(in(0)->get_size(x5, a1, x4, a3));
+    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted.get(), x5.size(), a1.size(), x4.size(), a3.size());
     // tensor label: I18
-    std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, a3, a2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, a3, a2)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), x2.size(), a3.size(), a2.size());
+    const double* i1data = in(1)->get_block_view(x3, x2, a3, a2);
+    BlockBuffer i1data_sorted(in(1)->get_size(x3, x2, a3, a2));
+    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), x2.size(), a3.size(), a2.size());
     dgemm_("T", "N", x5.size()*a1.size()*x4.size(), x3.size()*x2.size()*a2.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, x5.size()*a1.size()*x4.size());
+           1.0, i0data_sorted.get(), a3.size(), i1data_sorted.get(), a3.size(),
+           1.0, odata_sorted.get(), x5.size()*a1.size()*x4.size());
   }
-  sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), a1.size(), x4.size(), x3.size(), x2.size(), a2.size());
+  sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted.get(), odata.get(), x5.size(), a1.size(), x4.size(), x3.size(), x2.size(), a2.size());
   out()->put_block(odata, x3, x2, a2, x5, a1, x4);
 }
 
@@ -766,8 +766,8 @@ void Task31::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x3, x2, a3, a2);
   {
     // tensor label: v2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, a3, a2);
-    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata, x3.size(), x2.size(), a3.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(x3, x2, a3, a2);
+    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata.get(), x3.size(), x2.size(), a3.size(), a2.size());
   }
   out()->put_block(odata, x3, x2, a3, a2);
 }
@@ -781,8 +781,8 @@ void Task33::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, a2, x0, a1);
   {
     // tensor label: I22
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a1, a2, x0, x1);
-    sort_indices<3,1,2,0,1,1,1,1>(i0data, odata, a1.size(), a2.size(), x0.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(a1, a2, x0, x1);
+    sort_indices<3,1,2,0,1,1,1,1>(i0data, odata.get(), a1.size(), a2.size(), x0.size(), x1.size());
   }
   out()->put_block(odata, x1, a2, x0, a1);
 }
@@ -794,24 +794,24 @@ void Task34::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I22
   std::unique_ptr<double[]> odata = out()->move_block(a1, a2, x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, a2, x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(a1, a2, x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(a1, a2, x0, x1), 0.0);
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma1
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+      const double* i0data = in(0)->get_block_view(x3, x0, x2, x1);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, x0, x2, x1));
+      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x0.size(), x2.size(), x1.size());
       // tensor label: I23
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, x2, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, x2, a2)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), a1.size(), x2.size(), a2.size());
+      const double* i1data = in(1)->get_block_view(x3, a1, x2, a2);
+      BlockBuffer i1data_sorted(in(1)->get_size(x3, a1, x2, a2));
+      sort_indices<0,2,1,3,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), a1.size(), x2.size(), a2.size());
       dgemm_("T", "N", x0.size()*x1.size(), a1.size()*a2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+             1.0, i0data_sorted.get(), x3.size()*x2.size(), i1data_sorted.get(), x3.size()*x2.size(),
+             1.0, odata_sorted.get(), x0.size()*x1.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a1.size(), a2.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), a1.size(), a2.size());
   out()->put_block(odata, a1, a2, x0, x1);
 }
 
@@ -824,8 +824,8 @@ void Task35::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x3, a1, x2, a2);
   {
     // tensor label: v2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, x2, a2);
-    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata, x3.size(), a1.size(), x2.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(x3, a1, x2, a2);
+    sort_indices<0,1,2,3,1,1,1,1>(i0data, odata.get(), x3.size(), a1.size(), x2.size(), a2.size());
   }
   out()->put_block(odata, x3, a1, x2, a2);
 }
@@ -839,8 +839,8 @@ void Task37::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x1, a2, x0, a1);
   {
     // tensor label: I24
-    std::unique_ptr<double[]> i0data = in(0)->get_block(a1, a2, x0, x1);
-    sort_indices<3,1,2,0,1,1,1,1>(i0data, odata, a1.size(), a2.size(), x0.size(), x1.size());
+    const double* i0data = in(0)->get_block_view(a1, a2, x0, x1);
+    sort_indices<3,1,2,0,1,1,1,1>(i0data, odata.get(), a1.size(), a2.size(), x0.size(), x1.size());
   }
   out()->put_block(odata, x1, a2, x0, a1);
 }
@@ -852,24 +852,24 @@ void Task38::Task_local::compute() {
   const Index x1 = b(3);
   // tensor label: I24
   std::unique_ptr<double[]> odata = out()->move_block(a1, a2, x0, x1);
-  std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, a2, x0, x1)]);
+  BlockBuffer odata_sorted(out()->get_size(a1, a2, x0, x1));
   std::fill_n(odata_sorted.get(), out()->get_size(a1, a2, x0, x1), 0.0);
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma1
-      std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+      const double* i0data = in(0)->get_block_view(x3, x0, x2, x1);
+      BlockBuffer i0data_sorted(in(0)->get_size(x3, x0, x2, x1));
+      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted.get(), x3.size(), x0.size(), x2.size(), x1.size());
       // tensor label: I25
-      std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, x2, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, x2, a2)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), a1.size(), x2.size(), a2.size());
+      const double* i1data = in(1)->get_block_view(x3, a1, x2, a2);
+      BlockBuffer i1data_sorted(in(1)->get_size(x3, a1, x2, a2));
+      sort_indices<0,2,1,3,0,1,1,1>(i1data, i1data_sorted.get(), x3.size(), a1.size(), x2.size(), a2.size());
       dgemm_("T", "N", x0.size()*x1.size(), a1.size()*a2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+             1.0, i0data_sorted.get(), x3.size()*x2.size(), i1data_sorted.get(), x3.size()*x2.size(),
+             1.0, odata_sorted.get(), x0.size()*x1.size());
     }
   }
-  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a1.size(), a2.size());
+  sort_indices<2,3,0,1,1,1,1,1>(odata_sorted.get(), odata.get(), x0.size(), x1.size(), a1.size(), a2.size());
   out()->put_block(odata, a1, a2, x0, x1);
 }
 
@@ -882,8 +882,8 @@ void Task39::Task_local::compute() {
   std::unique_ptr<double[]> odata = out()->move_block(x3, a1, x2, a2);
   {
     // tensor label: t2
-    std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, x2, a2);
-    sort_indices<0,1,2,3,1,1,2,1>(i0data, odata, x3.size(), a1.size(), x2.size(), a2.size());
+    const double* i0data = in(0)->get_block_view(x3, a1, x2, a2);
+    sort_indices<0,1,2,3,1,1,2,1>(i0data, odata.get(), x3.size(), a1.size(), x2.size(), a2.size());
   }
   out()->put_block(odata, x3, a1, x2, a2);
 }
@@ -0,0 +1,69 @@
+//
+// BAGEL - Parallel electron correlation program.
+// Filename: blockpool.cc
+// Copyright (C) 2026 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// The BAGEL package is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 3, or (at your option)
+// any later version.
+//
+// The BAGEL package is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the BAGEL package; see COPYING.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+
+
+#include <src/smith/blockpool.h>
+
+using namespace bagel::SMITH;
+using namespace std;
+
+
+unique_ptr<double[]> BlockPool::get(const size_t size) {
+  {
+    lock_guard<mutex> lock(mutex_);
+    auto iter = free_.find(size);
+    if (iter != free_.end() && !iter->second.empty()) {
+      unique_ptr<double[]> out = move(iter->second.back());
+      iter->second.pop_back();
+      cached_ -= size;
+      return out;
+    }
+  }
+  return unique_ptr<double[]>(new double[size]);
+}
+
+
+void BlockPool::release(unique_ptr<double[]>&& buf, const size_t size) {
+  if (size == 0)
+    return;
+  lock_guard<mutex> lock(mutex_);
+  if (cached_ + size <= max_cached_) {
+    free_[size].push_back(move(buf));
+    cached_ += size;
+  }
+}
+
+
+void BlockPool::clear() {
+  lock_guard<mutex> lock(mutex_);
+  free_.clear();
+  cached_ = 0lu;
+}
+
+
+BlockPool& BlockPool::global() {
+  static BlockPool pool;
+  return pool;
+}
@@ -0,0 +1,90 @@
+//
+// BAGEL - Parallel electron correlation program.
+// Filename: blockpool.h
+// Copyright (C) 2026 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// The BAGEL package is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 3, or (at your option)
+// any later version.
+//
+// The BAGEL package is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the BAGEL package; see COPYING.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+
+// Thread-safe recycling of the scratch buffers used in the SMITH tasks
+// (sorted copies of blocks and dgemm targets). These have a handful of
+// distinct sizes that repeat many times per iteration.
+
+#ifndef __SRC_SMITH_BLOCKPOOL_H
+#define __SRC_SMITH_BLOCKPOOL_H
+
+#include <stddef.h>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace bagel {
+namespace SMITH {
+
+class BlockPool {
+  protected:
+    std::mutex mutex_;
+    // free buffers, binned by their length
+    std::map<size_t, std::vector<std::unique_ptr<double[]>>> free_;
+    // total number of doubles currently held and the upper bound thereof
+    size_t cached_;
+    const size_t max_cached_;
+
+  public:
+    BlockPool(const size_t max_cached = (1lu << 25)) : cached_(0lu), max_cached_(max_cached) { }
+
+    // returns an uninitialized buffer of length size
+    std::unique_ptr<double[]> get(const size_t size);
+    // gives a buffer back to the pool; it is freed if the pool is full
+    void release(std::unique_ptr<double[]>&& buf, const size_t size);
+    void clear();
+
+    size_t cached() const { return cached_; }
+
+    static BlockPool& global();
+};
+
+
+// scoped buffer that is returned to the global pool on destruction
+class BlockBuffer {
+  protected:
+    std::unique_ptr<double[]> data_;
+    size_t size_;
+
+  public:
+    BlockBuffer(const size_t size) : data_(BlockPool::global().get(size)), size_(size) { }
+    BlockBuffer(const BlockBuffer&) = delete;
+    BlockBuffer& operator=(const BlockBuffer&) = delete;
+    ~BlockBuffer() { if (data_) BlockPool::global().release(std::move(data_), size_); }
+
+    double* get() { return data_.get(); }
+    const double* get() const { return data_.get(); }
+
+    double& operator[](const size_t i) { return data_[i]; }
+    const double& operator[](const size_t i) const { return data_[i]; }
+
+    size_t size() const { return size_; }
+};
+
+}
+}
+
+#endif
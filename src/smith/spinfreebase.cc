@@ -24,6 +24,7 @@
 //
 
 #include <src/smith/moint.h>
+#include <src/smith/blockpool.h>
 #include <src/smith/spinfreebase.h>
 
 using namespace std;
@@ -249,8 +250,8 @@ double SpinFreeMethod::compute_e0() const {
   for (auto& i1 : active_) {
     for (auto& i0 : active_) {
       const size_t size = i0.size() * i1.size();
-      unique_ptr<double[]> fdata = f1_->get_block(i0, i1);
-      unique_ptr<double[]> rdata = rdm1_->get_block(i0, i1);
+      const double* fdata = f1_->get_block_view(i0, i1);
+      const double* rdata = rdm1_->get_block_view(i0, i1);
       sum += ddot_(size, fdata, 1, rdata, 1);
     }
   }
@@ -271,10 +272,10 @@ void SpinFreeMethod::update_amplitude(shared_ptr<Tensor> t, shared_ptr<const Ten
           // if this block is not included in the current wave function, skip it
           if (!r->get_size_alloc(i0, i1, i2, i3)) continue;
           unique_ptr<double[]>       data0 = r->get_block(i0, i1, i2, i3);
-          const unique_ptr<double[]> data1 = r->get_block(i0, i3, i2, i1);
+          const double*              data1 = r->get_block_view(i0, i3, i2, i1);
 
           // this is an inverse of the overlap.
-          sort_indices<0,3,2,1,2,12,1,12>(data1, data0, i0.size(), i3.size(), i2.size(), i1.size());
+          sort_indices<0,3,2,1,2,12,1,12>(data1, data0.get(), i0.size(), i3.size(), i2.size(), i1.size());
           size_t iall = 0;
           for (int j3 = i3.offset(); j3 != i3.offset()+i3.size(); ++j3)
             for (int j2 = i2.offset(); j2 != i2.offset()+i2.size(); ++j2)
@@ -308,11 +309,11 @@ void SpinFreeMethod::update_amplitude(shared_ptr<Tensor> t, shared_ptr<const Ten
           // sort. Active indices run faster
           sort_indices<0,2,1,3,0,1,1,1>(data0, data1, i0.size(), i1.size(), i2.size(), i3.size());
           // intermediate area
-          unique_ptr<double[]> interm(new double[i1.size()*i3.size()*nact*nact]);
+          BlockBuffer interm(i1.size()*i3.size()*nact*nact);
 
           // move to orthogonal basis
-          dgemm_("N", "N", nact*nact, i1.size()*i3.size(), i0.size()*i2.size(), 1.0, transp, nact*nact, data1, i0.size()*i2.size(),
-                                                                                0.0, interm, nact*nact);
+          dgemm_("N", "N", nact*nact, i1.size()*i3.size(), i0.size()*i2.size(), 1.0, transp.get(), nact*nact, data1.get(), i0.size()*i2.size(),
+                                                                                0.0, interm.get(), nact*nact);
 
           size_t iall = 0;
           for (int j3 = i3.offset(); j3 != i3.offset()+i3.size(); ++j3)
@@ -322,8 +323,8 @@ void SpinFreeMethod::update_amplitude(shared_ptr<Tensor> t, shared_ptr<const Ten
 
           // move back to non-orthogonal basis
           // factor of 0.5 due to the factor in the overlap
-          dgemm_("T", "N", i0.size()*i2.size(), i1.size()*i3.size(), nact*nact, 0.5, transp, nact*nact, interm, nact*nact,
-                                                                                0.0, data0,  i0.size()*i2.size());
+          dgemm_("T", "N", i0.size()*i2.size(), i1.size()*i3.size(), nact*nact, 0.5, transp.get(), nact*nact, interm.get(), nact*nact,
+                                                                                0.0, data0.get(),  i0.size()*i2.size());
 
           // sort back to the original order
           sort_indices<0,2,1,3,0,1,1,1>(data0, data1, i0.size(), i2.size(), i1.size(), i3.size());
@@ -347,15 +348,15 @@ void SpinFreeMethod::update_amplitude(shared_ptr<Tensor> t, shared_ptr<const Ten
           if (!r->get_size_alloc(i2, i3, i0, i1)) continue;
           assert(r->get_size_alloc(i2, i1, i0, i3));
           unique_ptr<double[]>       data0 = r->get_block(i2, i3, i0, i1);
-          const unique_ptr<double[]> data1 = r->get_block(i2, i1, i0, i3);
+          const double*              data1 = r->get_block_view(i2, i1, i0, i3);
           unique_ptr<double[]> data2(new double[r->get_size(i2, i3, i0, i1)]);
           sort_indices<2,3,0,1,0,1,1,1>(data0, data2, i2.size(), i3.size(), i0.size(), i1.size());
-          sort_indices<2,1,0,3,2,3,1,3>(data1, data2, i2.size(), i1.size(), i0.size(), i3.size());
+          sort_indices<2,1,0,3,2,3,1,3>(data1, data2.get(), i2.size(), i1.size(), i0.size(), i3.size());
 
           // move to orthogonal basis
-          unique_ptr<double[]> interm(new double[i1.size()*i2.size()*i3.size()*nact]);
-          dgemm_("N", "N", nact, i1.size()*i2.size()*i3.size(), i0.size(), 1.0, transp, nact, data2, i0.size(),
-                                                                           0.0, interm, nact);
+          BlockBuffer interm(i1.size()*i2.size()*i3.size()*nact);
+          dgemm_("N", "N", nact, i1.size()*i2.size()*i3.size(), i0.size(), 1.0, transp.get(), nact, data2.get(), i0.size(),
+                                                                           0.0, interm.get(), nact);
 
           size_t iall = 0;
           for (int j3 = i3.offset(); j3 != i3.offset()+i3.size(); ++j3)
@@ -365,8 +366,8 @@ void SpinFreeMethod::update_amplitude(shared_ptr<Tensor> t, shared_ptr<const Ten
                   interm[iall] /= e0_ - (denom_x(j0) + eig_[j3] - eig_[j2] + eig_[j1]);
 
           // move back to non-orthogonal basis
-          dgemm_("T", "N", i0.size(), i1.size()*i2.size()*i3.size(), nact, 1.0, transp, nact, interm, nact,
-                                                                           0.0, data2,  i0.size());
+          dgemm_("T", "N", i0.size(), i1.size()*i2.size()*i3.size(), nact, 1.0, transp.get(), nact, interm.get(), nact,
+                                                                           0.0, data2.get(),  i0.size());
 
           t->add_block(data2, i0, i1, i2, i3);
         }
@@ -388,15 +389,15 @@ void SpinFreeMethod::update_amplitude(shared_ptr<Tensor> t, shared_ptr<const Ten
           if (!r->get_size_alloc(i2, i3, i0, i1)) continue;
           assert(r->get_size_alloc(i0, i3, i2, i1));
           unique_ptr<double[]>       data0 = r->get_block(i2, i3, i0, i1);
-          const unique_ptr<double[]> data1 = r->get_block(i0, i3, i2, i1);
+          const double*              data1 = r->get_block_view(i0, i3, i2, i1);
           unique_ptr<double[]> data2(new double[r->get_size(i2, i3, i0, i1)]);
           sort_indices<2,3,0,1,0,1,1,1>(data0, data2, i2.size(), i3.size(), i0.size(), i1.size());
-          sort_indices<0,3,2,1,2,3,1,3>(data1, data2, i0.size(), i3.size(), i2.size(), i1.size());
-          unique_ptr<double[]> interm(new double[i0.size()*i1.size()*i2.size()*nact]);
+          sort_indices<0,3,2,1,2,3,1,3>(data1, data2.get(), i0.size(), i3.size(), i2.size(), i1.size());
+          BlockBuffer interm(i0.size()*i1.size()*i2.size()*nact);
 
           // move to orthogonal basis
-          dgemm_("N", "T", i0.size()*i1.size()*i2.size(), nact, i3.size(), 1.0, data2, i0.size()*i1.size()*i2.size(), transp, nact,
-                                                                           0.0, interm, i0.size()*i1.size()*i2.size());
+          dgemm_("N", "T", i0.size()*i1.size()*i2.size(), nact, i3.size(), 1.0, data2.get(), i0.size()*i1.size()*i2.size(), transp.get(), nact,
+                                                                           0.0, interm.get(), i0.size()*i1.size()*i2.size());
 
           size_t iall = 0;
           for (int j3 = 0; j3 != nact; ++j3)
@@ -406,8 +407,8 @@ void SpinFreeMethod::update_amplitude(shared_ptr<Tensor> t, shared_ptr<const Ten
                   interm[iall] /= e0_ - (denom_h(j3) - eig_[j2] + eig_[j1] - eig_[j0]);
 
           // move back to non-orthogonal basis
-          dgemm_("N", "N", i0.size()*i1.size()*i2.size(), i3.size(), nact, 1.0, interm, i0.size()*i1.size()*i2.size(), transp, nact,
-                                                                           0.0, data2,  i0.size()*i1.size()*i2.size());
+          dgemm_("N", "N", i0.size()*i1.size()*i2.size(), i3.size(), nact, 1.0, interm.get(), i0.size()*i1.size()*i2.size(), transp.get(), nact,
+                                                                           0.0, data2.get(),  i0.size()*i1.size()*i2.size());
 
           t->add_block(data2, i0, i1, i2, i3);
         }
@@ -434,11 +435,11 @@ void SpinFreeMethod::update_amplitude(shared_ptr<Tensor> t, shared_ptr<const Ten
           // sort. Active indices run slower
           sort_indices<0,2,1,3,0,1,1,1>(data0, data1, i0.size(), i1.size(), i2.size(), i3.size());
           // intermediate area
-          unique_ptr<double[]> interm(new double[i0.size()*i2.size()*nact*nact]);
+          BlockBuffer interm(i0.size()*i2.size()*nact*nact);
 
           // move to orthogonal basis
-          dgemm_("N", "T", i0.size()*i2.size(), nact*nact, i1.size()*i3.size(), 1.0, data1, i0.size()*i2.size(), transp, nact*nact,
-                                                                                0.0, interm, i0.size()*i2.size());
+          dgemm_("N", "T", i0.size()*i2.size(), nact*nact, i1.size()*i3.size(), 1.0, data1.get(), i0.size()*i2.size(), transp.get(), nact*nact,
+                                                                                0.0, interm.get(), i0.size()*i2.size());
 
           size_t iall = 0;
           for (int j13 = 0; j13 != nact*nact; ++j13)
@@ -448,8 +449,8 @@ void SpinFreeMethod::update_amplitude(shared_ptr<Tensor> t, shared_ptr<const Ten
 
           // move back to non-orthogonal basis
           // factor of 0.5 due to the factor in the overlap
-          dgemm_("N", "N", i0.size()*i2.size(), i1.size()*i3.size(), nact*nact, 0.5, interm, i0.size()*i2.size(), transp, nact*nact,
-                                                                                0.0, data0,  i0.size()*i2.size());
+          dgemm_("N", "N", i0.size()*i2.size(), i1.size()*i3.size(), nact*nact, 0.5, interm.get(), i0.size()*i2.size(), transp.get(), nact*nact,
+                                                                                0.0, data0.get(),  i0.size()*i2.size());
 
           // sort back to the original order
           sort_indices<0,2,1,3,0,1,1,1>(data0, data1, i0.size(), i2.size(), i1.size(), i3.size());
@@ -484,11 +485,11 @@ void SpinFreeMethod::update_amplitude(shared_ptr<Tensor> t, shared_ptr<const Ten
           sort_indices<2,3,0,1,0,1,1,1>(data0.get(), data2.get()          , i2.size(), i3.size(), i0.size(), i1.size());
           sort_indices<0,3,2,1,0,1,1,1>(data1.get(), data2.get()+blocksize, i0.size(), i3.size(), i2.size(), i1.size());
           // intermediate area
-          unique_ptr<double[]> interm(new double[i0.size()*i1.size()*nact*nact*2]);
+          BlockBuffer interm(i0.size()*i1.size()*nact*nact*2);
 
           // move to orthogonal basis
-          dgemm_("N", "T", i0.size()*i1.size(), nact*nact*2, i2.size()*i3.size()*2, 1.0, data2,  i0.size()*i1.size(), transp, nact*nact*2,
-                                                                                    0.0, interm, i0.size()*i1.size());
+          dgemm_("N", "T", i0.size()*i1.size(), nact*nact*2, i2.size()*i3.size()*2, 1.0, data2.get(),  i0.size()*i1.size(), transp.get(), nact*nact*2,
+                                                                                    0.0, interm.get(), i0.size()*i1.size());
 
           size_t iall = 0;
           for (int j23 = 0; j23 != nact*nact*2; ++j23)
@@ -497,8 +498,8 @@ void SpinFreeMethod::update_amplitude(shared_ptr<Tensor> t, shared_ptr<const Ten
                 interm[iall] /= e0_ - (denom_xh(j23) + eig_[j1] - eig_[j0]);
 
           // move back to non-orthogonal basis
-          dgemm_("N", "N", i0.size()*i1.size(), i2.size()*i3.size()*2, nact*nact*2, 1.0, interm, i0.size()*i1.size(), transp, nact*nact*2,
-                                                                                    0.0, data2,  i0.size()*i1.size());
+          dgemm_("N", "N", i0.size()*i1.size(), i2.size()*i3.size()*2, nact*nact*2, 1.0, interm.get(), i0.size()*i1.size(), transp.get(), nact*nact*2,
+                                                                                    0.0, data2.get(),  i0.size()*i1.size());
 
           // sort back to the original order
           copy_n(data2.get(), blocksize, data0.get());
@@ -531,11 +532,11 @@ void SpinFreeMethod::update_amplitude(shared_ptr<Tensor> t, shared_ptr<const Ten
           // sort. Active indices run slower
           sort_indices<3,2,0,1,0,1,1,1>(data0, data1, i2.size(), i3.size(), i0.size(), i1.size());
           // intermediate area
-          unique_ptr<double[]> interm(new double[i1.size()*nact*nact*nact]);
+          BlockBuffer interm(i1.size()*nact*nact*nact);
 
           // move to orthogonal basis
-          dgemm_("N", "T", i1.size(), nact*nact*nact, i0.size()*i2.size()*i3.size(), 1.0, data1,  i1.size(), transp, nact*nact*nact,
-                                                                                     0.0, interm, i1.size());
+          dgemm_("N", "T", i1.size(), nact*nact*nact, i0.size()*i2.size()*i3.size(), 1.0, data1.get(),  i1.size(), transp.get(), nact*nact*nact,
+                                                                                     0.0, interm.get(), i1.size());
 
           size_t iall = 0;
           for (int j123 = 0; j123 != nact*nact*nact; ++j123)
@@ -543,8 +544,8 @@ void SpinFreeMethod::update_amplitude(shared_ptr<Tensor> t, shared_ptr<const Ten
               interm[iall] /= e0_ - (denom_xhh(j123) + eig_[j1]);
 
           // move back to non-orthogonal basis
-          dgemm_("N", "N", i1.size(), i0.size()*i2.size()*i3.size(), nact*nact*nact, 1.0, interm, i1.size(), transp, nact*nact*nact,
-                                                                                     0.0, data0,  i1.size());
+          dgemm_("N", "N", i1.size(), i0.size()*i2.size()*i3.size(), nact*nact*nact, 1.0, interm.get(), i1.size(), transp.get(), nact*nact*nact,
+                                                                                     0.0, data0.get(),  i1.size());
 
           // sort back to the original order
           sort_indices<1,0,2,3,0,1,1,1>(data0, data1, i1.size(), i0.size(), i2.size(), i3.size());
@@ -575,11 +576,11 @@ void SpinFreeMethod::update_amplitude(shared_ptr<Tensor> t, shared_ptr<const Ten
           // sort. Active indices run slower
           sort_indices<0,2,3,1,0,1,1,1>(data0, data1, i2.size(), i3.size(), i0.size(), i1.size());
           // intermediate area
-          unique_ptr<double[]> interm(new double[i2.size()*nact*nact*nact]);
+          BlockBuffer interm(i2.size()*nact*nact*nact);
 
           // move to orthogonal basis
-          dgemm_("N", "T", i2.size(), nact*nact*nact, i0.size()*i1.size()*i3.size(), 1.0, data1,  i2.size(), transp, nact*nact*nact,
-                                                                                     0.0, interm, i2.size());
+          dgemm_("N", "T", i2.size(), nact*nact*nact, i0.size()*i1.size()*i3.size(), 1.0, data1.get(),  i2.size(), transp.get(), nact*nact*nact,
+                                                                                     0.0, interm.get(), i2.size());
 
           size_t iall = 0;
           for (int j013 = 0; j013 != nact*nact*nact; ++j013)
@@ -587,8 +588,8 @@ void SpinFreeMethod::update_amplitude(shared_ptr<Tensor> t, shared_ptr<const Ten
               interm[iall] /= e0_ - (denom_xxh(j013) - eig_[j2]);
 
           // move back to non-orthogonal basis
-          dgemm_("N", "N", i2.size(), i0.size()*i1.size()*i3.size(), nact*nact*nact, 1.0, interm, i2.size(), transp, nact*nact*nact,
-                                                                                     0.0, data0,  i2.size());
+          dgemm_("N", "N", i2.size(), i0.size()*i1.size()*i3.size(), nact*nact*nact, 1.0, interm.get(), i2.size(), transp.get(), nact*nact*nact,
+                                                                                     0.0, data0.get(),  i2.size());
 
           // sort back to the original order
           sort_indices<1,2,0,3,0,1,1,1>(data0, data1, i2.size(), i0.size(), i1.size(), i3.size());
@@ -126,6 +126,14 @@ unique_ptr<double[]> Storage_Incore::get_block(const size_t& key) const {
 }
 
 
+const double* Storage_Incore::get_block_view(const size_t& key) const {
+  auto hash = hashtable_.find(key);
+  if (hash == hashtable_.end())
+    throw logic_error("a key was not found in Storage::get_block_view(const size_t&)");
+  return hash->second->get_block_view();
+}
+
+
 unique_ptr<double[]> Storage_Incore::move_block(const size_t& key) {
   // first find a key
   auto hash = hashtable_.find(key);
@@ -80,6 +80,8 @@ class Storage_base {
     virtual std::unique_ptr<double[]> move_block(const size_t& key) = 0;
     virtual void put_block(const size_t& key, std::unique_ptr<double[]>& dat) = 0;
     virtual void add_block(const size_t& key, const std::unique_ptr<double[]>& dat) = 0;
+    // read-only access to a block without copying; valid until the block is moved or put
+    virtual const double* get_block_view(const size_t& key) const = 0;
 
     virtual void zero() = 0;
     virtual void scale(const double a) = 0;
@@ -110,6 +112,7 @@ class StorageBlock {
 
     std::unique_ptr<double[]> get_block() const;
     std::unique_ptr<double[]> move_block();
+    const double* get_block_view() const { assert(initialized_); return data_.get(); }
 
     double dot_product(const StorageBlock& o) const;
     void ax_plus_y(const double a, const StorageBlock& o);
@@ -125,6 +128,7 @@ class Storage_Incore : public Storage_base<StorageBlock> {
     std::unique_ptr<double[]> move_block(const size_t& key);
     void put_block(const size_t& key, std::unique_ptr<double[]>& dat);
     void add_block(const size_t& key, const std::unique_ptr<double[]>& dat);
+    const double* get_block_view(const size_t& key) const;
 
     void zero();
     void scale(const double a);
@@ -40,6 +40,7 @@
 #include <src/util/math/matop.h>
 #include <src/util/prim_op.h>
 #include <src/smith/storage.h>
+#include <src/smith/blockpool.h>
 #include <src/smith/indexrange.h>
 #include <src/smith/loopgenerator.h>
 
@@ -119,6 +120,13 @@ class Tensor {
       return data_->get_block(generate_hash_key(p...));
     }
 
+    // no copy is made; the pointer aliases the storage and must not outlive it
+    template<typename ...args>
+    const double* get_block_view(const args& ...p) const {
+      if (!initialized_) init();
+      return data_->get_block_view(generate_hash_key(p...));
+    }
+
     template<typename ...args>
     std::unique_ptr<double[]> move_block(const args& ...p) {
       return data_->move_block(generate_hash_key(p...));
@@ -69,8 +69,13 @@ bool compare(const T a, const T b, const double thr = THRESH) {
 //#include <src/testimpl/test_zcasscf.cc>
 #include <src/testimpl/test_ras.cc>
 #include <src/testimpl/test_nevpt2.cc>
+#include <src/testimpl/test_smith.cc>
 #include <src/testimpl/test_opt.cc>
+#include <src/testimpl/test_batch.cc>
+#include <src/testimpl/test_hessian.cc>
 #include <src/testimpl/test_localize.cc>
 #include <src/testimpl/test_asd.cc>
 #include <src/testimpl/test_asd_dmrg.cc>
 #include <src/testimpl/test_london.cc>
+#include <src/testimpl/test_transpose.cc>
+#include <src/testimpl/test_contract.cc>
@@ -0,0 +1,80 @@
+//
+// BAGEL - Parallel electron correlation program.
+// Filename: test_batch.cc
+// Copyright (C) 2026 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// The BAGEL package is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 3, or (at your option)
+// any later version.
+//
+// The BAGEL package is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the BAGEL package; see COPYING.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+
+#include <src/grad/batcheval.h>
+#include <src/grad/force.h>
+
+// Runs the batch block and, for each of its geometries, a separate single-point gradient; returns the largest
+// deviation of the energies and gradients of the batch from the single points. energies receives the batch energies.
+double batch_error(std::string filename, std::vector<double>& energies) {
+  auto ofs = std::make_shared<std::ofstream>(filename + ".testout", std::ios::trunc);
+  std::streambuf* backup_stream = std::cout.rdbuf(ofs->rdbuf());
+
+  auto idata = std::make_shared<const PTree>(location__ + filename + ".json");
+  std::shared_ptr<const Geometry> geom;
+  double error = 0.0;
+
+  auto keys = idata->get_child("bagel");
+  for (auto& itree : *keys) {
+    const std::string title = to_lower(itree->get<std::string>("title", ""));
+    if (title == "molecule") {
+      geom = std::make_shared<const Geometry>(itree);
+    } else if (title == "batch") {
+      auto batch = std::make_shared<BatchEval>(itree, geom, nullptr);
+      batch->compute();
+      energies = batch->energies();
+
+      int i = 0;
+      auto geometries = itree->get_child("geometries");
+      for (auto& g : *geometries) {
+        auto mol = std::make_shared<PTree>();
+        mol->add_child("geometry", std::make_shared<PTree>(*g));
+        auto cgeom = std::make_shared<const Geometry>(*geom, mol);
+        auto input = std::make_shared<PTree>();
+        input->add_child("method", std::make_shared<PTree>(*itree->get_child("method")));
+        Force force(input, cgeom, nullptr);
+        std::shared_ptr<const GradFile> grad = force.compute();
+
+        if (!batch->status()[i]) throw std::runtime_error("a job failed in the batch test");
+        error = std::max(error, std::fabs(force.energy() - energies[i]));
+        for (int j = 0; j != grad->size(); ++j)
+          error = std::max(error, std::fabs(*(grad->data()+j) - *(batch->gradients()[i]->data()+j)));
+        ++i;
+      }
+    }
+  }
+  std::cout.rdbuf(backup_stream);
+  return error;
+}
+
+BOOST_AUTO_TEST_SUITE(TEST_BATCH)
+
+BOOST_AUTO_TEST_CASE(BATCH) {
+    std::vector<double> energies;
+    BOOST_CHECK(compare(batch_error("hf_svp_dfhf_batch", energies), 0.0, 1.0e-8));
+    BOOST_CHECK(compare(energies.front(), -99.84772354));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -26,6 +26,7 @@
 #include <src/multi/casscf/superci.h>
 #include <src/multi/casscf/casbfgs.h>
 #include <src/multi/casscf/cashybrid.h>
+#include <src/grad/gradeval.h>
 
 double cas_energy(std::string filename) {
   auto ofs = std::make_shared<std::ofstream>(filename + ".testout", std::ios::trunc);
@@ -73,6 +74,50 @@ double cas_energy(std::string filename) {
   return 0.0;
 }
 
+// SA-CASSCF nuclear gradients of the given target states (all solved in one CP-CASSCF call), concatenated
+std::vector<double> sacas_gradients(std::string filename, const std::vector<int> targets) {
+  auto ofs = std::make_shared<std::ofstream>(filename + ".testout", std::ios::app);
+  std::streambuf* backup_stream = std::cout.rdbuf(ofs->rdbuf());
+
+  std::stringstream ss; ss << location__ << filename << ".json";
+  auto idata = std::make_shared<const PTree>(ss.str());
+  auto keys = idata->get_child("bagel");
+  std::shared_ptr<Geometry> geom;
+  std::vector<double> out;
+
+  for (auto& itree : *keys) {
+    const std::string method = to_lower(itree->get<std::string>("title", ""));
+
+    if (method == "molecule") {
+      geom = std::make_shared<Geometry>(itree);
+
+    } else if (method == "casscf") {
+      auto cinput = std::make_shared<PTree>(*itree);
+      cinput->erase("targets");
+      auto tlist = std::make_shared<PTree>();
+      for (auto& t : targets)
+        tlist->push_back(t);
+      cinput->add_child("targets", tlist);
+
+      auto grad = std::make_shared<GradEval<SuperCIGrad>>(cinput, geom, nullptr);
+      grad->compute();
+      for (auto& g : grad->gradients())
+        out.insert(out.end(), g->data(), g->data()+g->size());
+    }
+  }
+  std::cout.rdbuf(backup_stream);
+  return out;
+}
+
+std::vector<double> reference_sacas_gradients() {
+  std::vector<double> out(12);
+  out[2]  = -0.0019342522;
+  out[5]  =  0.0019342522;
+  out[8]  = -0.2535235802;
+  out[11] =  0.2535235802;
+  return out;
+}
+
 BOOST_AUTO_TEST_SUITE(TEST_CASSCF)
 
 BOOST_AUTO_TEST_CASE(DF_CASSCF) {
@@ -82,4 +127,14 @@ BOOST_AUTO_TEST_CASE(DF_CASSCF) {
 //    BOOST_CHECK(compare(cas_energy("crco6_sto3g_cas66"),    -1699.66508838));
 }
 
+BOOST_AUTO_TEST_CASE(SA_CASSCF_GRADIENT) {
+    // two states solved together must agree with the two single-state solutions
+    std::vector<double> single = sacas_gradients("hf_svp_sacas_grad", {0});
+    const std::vector<double> second = sacas_gradients("hf_svp_sacas_grad", {1});
+    single.insert(single.end(), second.begin(), second.end());
+    const std::vector<double> block = sacas_gradients("hf_svp_sacas_grad", {0, 1});
+    BOOST_CHECK(compare<std::vector<double>>(block, single, 1.0e-7));
+    BOOST_CHECK(compare<std::vector<double>>(block, reference_sacas_gradients(), 1.0e-6));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
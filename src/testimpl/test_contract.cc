@@ -0,0 +1,164 @@
+//
+// BAGEL - Parallel electron correlation program.
+// Filename: test_contract.cc
+// Copyright (C) 2026 Toru Shiozaki
+//
+// Author: Shane Parker < shane.parker@u.northwestern.edu >
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// The BAGEL package is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 3, or (at your option)
+// any later version.
+//
+// The BAGEL package is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the BAGEL package; see COPYING.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+
+#include <complex>
+#include <functional>
+#include <random>
+#include <src/util/math/btas_interface.h>
+
+// the rank of btas::CRange is set at run time, so that TensorN of any N is the same type
+template<typename T>
+using AnyTensor = btas::TensorN<T,1>;
+
+void contract_fill(AnyTensor<double>& a, std::mt19937& gen) {
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  for (auto& i : a) i = dist(gen);
+}
+
+void contract_fill(AnyTensor<std::complex<double>>& a, std::mt19937& gen) {
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  for (auto& i : a) i = std::complex<double>(dist(gen), dist(gen));
+}
+
+double contract_alpha(const double) { return 0.7; }
+std::complex<double> contract_alpha(const std::complex<double>) { return std::complex<double>(0.7, 0.2); }
+
+double contract_conj(const double a, const bool) { return a; }
+std::complex<double> contract_conj(const std::complex<double> a, const bool c) { return c ? std::conj(a) : a; }
+
+// call performs C = alpha op(A) op(B) + beta C with btas::contract using the annotations la, lb, and lc;
+// the result is compared with the element-by-element sum over all the indices.
+template<typename T>
+double contract_error(const std::vector<int>& la, const std::vector<int>& lb, const std::vector<int>& lc, const bool conja, const bool conjb,
+                      std::function<void(const T, const AnyTensor<T>&, const AnyTensor<T>&, const T, AnyTensor<T>&)> call) {
+  const std::vector<long> extents{3, 4, 2, 3, 4, 2};
+  auto make = [&extents](const std::vector<int>& l) {
+    std::vector<long> e;
+    for (auto& i : l) e.push_back(extents[i]);
+    return AnyTensor<T>(btas::CRange<1>(e), T(0.0));
+  };
+  AnyTensor<T> a = make(la);
+  AnyTensor<T> b = make(lb);
+  AnyTensor<T> c = make(lc);
+  std::mt19937 gen(la.size()*100 + lb.size()*10 + lc.size());
+  contract_fill(a, gen);
+  contract_fill(b, gen);
+  contract_fill(c, gen);
+  const T alpha = contract_alpha(T());
+  const T beta = T(0.3);
+
+  // column-major offsets of a given set of index values
+  std::vector<int> labels(la);
+  labels.insert(labels.end(), lb.begin(), lb.end());
+  std::sort(labels.begin(), labels.end());
+  labels.erase(std::unique(labels.begin(), labels.end()), labels.end());
+  auto offset = [&extents](const std::vector<int>& l, const std::vector<long>& value) {
+    size_t out = 0, stride = 1;
+    for (auto& i : l) {
+      out += value[i] * stride;
+      stride *= extents[i];
+    }
+    return out;
+  };
+
+  std::vector<T> ref(c.begin(), c.end());
+  for (auto& i : ref) i *= beta;
+  std::vector<long> value(extents.size(), 0);
+  while (true) {
+    ref[offset(lc, value)] += alpha * contract_conj(a.data()[offset(la, value)], conja) * contract_conj(b.data()[offset(lb, value)], conjb);
+    int p = 0;
+    for ( ; p != labels.size(); ++p) {
+      if (++value[labels[p]] != extents[labels[p]]) break;
+      value[labels[p]] = 0;
+    }
+    if (p == labels.size()) break;
+  }
+
+  call(alpha, a, b, beta, c);
+
+  double error = 0.0;
+  auto r = ref.begin();
+  for (auto& i : c)
+    error = std::max(error, std::abs(i-*r++));
+  return error;
+}
+
+// plans beyond the capacity of the cache evict the stored ones; plans already handed out stay valid
+bool contract_plan_cache_bounded() {
+  btas::ContractPlanCache cache(2);
+  std::vector<std::shared_ptr<const btas::ContractPlan>> plans;
+  for (size_t n = 2; n != 6; ++n)
+    plans.push_back(cache.get(std::vector<int>{0,1}, std::vector<size_t>{n,3}, std::vector<int>{1,2}, std::vector<size_t>{3,4},
+                              std::vector<int>{0,2}, std::vector<size_t>{n,4}, false, false));
+  bool out = cache.size() <= 2;
+  for (size_t n = 2; n != 6; ++n)
+    out &= plans[n-2]->m * plans[n-2]->n == n*4;
+  return out;
+}
+
+BOOST_AUTO_TEST_SUITE(TEST_CONTRACT)
+
+BOOST_AUTO_TEST_CASE(REAL_CONTRACTION) {
+    using T = double;
+    using Ten = AnyTensor<T>;
+    // hand-written kernels
+    BOOST_CHECK(compare(contract_error<T>({0,1}, {1,2}, {0,2}, false, false,
+      [](const T al, const Ten& a, const Ten& b, const T be, Ten& c) { btas::contract(al, a, {0,1}, b, {1,2}, be, c, {0,2}); }), 0.0, 1.0e-12));
+    BOOST_CHECK(compare(contract_error<T>({0,1,2}, {3,1}, {0,3,2}, false, false,
+      [](const T al, const Ten& a, const Ten& b, const T be, Ten& c) { btas::contract(al, a, {0,1,2}, b, {3,1}, be, c, {0,3,2}); }), 0.0, 1.0e-12));
+    // general contractions with permuted outputs
+    BOOST_CHECK(compare(contract_error<T>({0,1}, {1,2}, {2,0}, false, false,
+      [](const T al, const Ten& a, const Ten& b, const T be, Ten& c) { btas::contract(al, a, {0,1}, b, {1,2}, be, c, {2,0}); }), 0.0, 1.0e-12));
+    BOOST_CHECK(compare(contract_error<T>({0,1,2}, {2,3,4}, {4,0,3,1}, false, false,
+      [](const T al, const Ten& a, const Ten& b, const T be, Ten& c) { btas::contract(al, a, {0,1,2}, b, {2,3,4}, be, c, {4,0,3,1}); }), 0.0, 1.0e-12));
+    BOOST_CHECK(compare(contract_error<T>({0,1,2,3}, {4,2}, {3,0,4,1}, false, false,
+      [](const T al, const Ten& a, const Ten& b, const T be, Ten& c) { btas::contract(al, a, {0,1,2,3}, b, {4,2}, be, c, {3,0,4,1}); }), 0.0, 1.0e-12));
+    BOOST_CHECK(compare(contract_error<T>({0,1,2,3}, {2,4,3,5}, {5,0,4,1}, false, false,
+      [](const T al, const Ten& a, const Ten& b, const T be, Ten& c) { btas::contract(al, a, {0,1,2,3}, b, {2,4,3,5}, be, c, {5,0,4,1}); }), 0.0, 1.0e-12));
+    // trailing indices shared by A and C are looped over
+    BOOST_CHECK(compare(contract_error<T>({0,1,2,3}, {1,4}, {0,4,2,3}, false, false,
+      [](const T al, const Ten& a, const Ten& b, const T be, Ten& c) { btas::contract(al, a, {0,1,2,3}, b, {1,4}, be, c, {0,4,2,3}); }), 0.0, 1.0e-12));
+    BOOST_CHECK(contract_plan_cache_bounded());
+}
+
+BOOST_AUTO_TEST_CASE(COMPLEX_CONTRACTION) {
+    using T = std::complex<double>;
+    using Ten = AnyTensor<T>;
+    for (const bool ca : {false, true})
+      for (const bool cb : {false, true}) {
+        BOOST_CHECK(compare(contract_error<T>({0,1}, {1,2}, {2,0}, ca, cb,
+          [&](const T al, const Ten& a, const Ten& b, const T be, Ten& c) { btas::contract(al, a, {0,1}, b, {1,2}, be, c, {2,0}, ca, cb); }), 0.0, 1.0e-12));
+        BOOST_CHECK(compare(contract_error<T>({0,1,2}, {3,1}, {0,3,2}, ca, cb,
+          [&](const T al, const Ten& a, const Ten& b, const T be, Ten& c) { btas::contract(al, a, {0,1,2}, b, {3,1}, be, c, {0,3,2}, ca, cb); }), 0.0, 1.0e-12));
+        BOOST_CHECK(compare(contract_error<T>({0,1,2}, {2,3,4}, {4,0,3,1}, ca, cb,
+          [&](const T al, const Ten& a, const Ten& b, const T be, Ten& c) { btas::contract(al, a, {0,1,2}, b, {2,3,4}, be, c, {4,0,3,1}, ca, cb); }), 0.0, 1.0e-12));
+        BOOST_CHECK(compare(contract_error<T>({0,1,2,3}, {2,4,3,5}, {5,0,4,1}, ca, cb,
+          [&](const T al, const Ten& a, const Ten& b, const T be, Ten& c) { btas::contract(al, a, {0,1,2,3}, b, {2,4,3,5}, be, c, {5,0,4,1}, ca, cb); }), 0.0, 1.0e-12));
+        BOOST_CHECK(compare(contract_error<T>({0,1,2,3}, {1,4}, {0,4,2,3}, ca, cb,
+          [&](const T al, const Ten& a, const Ten& b, const T be, Ten& c) { btas::contract(al, a, {0,1,2,3}, b, {1,4}, be, c, {0,4,2,3}, ca, cb); }), 0.0, 1.0e-12));
+      }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
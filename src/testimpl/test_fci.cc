@@ -116,6 +116,12 @@ BOOST_AUTO_TEST_CASE(HARRISON_ZARRABIAN) {
     BOOST_CHECK(compare(fci_energy("hhe_svp_fci_hz_trip"), reference_fci_energy2()));
 }
 
+BOOST_AUTO_TEST_CASE(MIXED_PRECISION) {
+    // single-precision alpha-beta sigma GEMMs until the residual drops below 1.0e-5, then Davidson restarts in double precision
+    BOOST_CHECK(compare(fci_energy("hf_sto3g_fci_kh_mixed"), reference_fci_energy()));
+    BOOST_CHECK(compare(fci_energy("hf_sto3g_fci_hz_mixed"), reference_fci_energy()));
+}
+
 #ifdef HAVE_MPI_H
 BOOST_AUTO_TEST_CASE(DIST_FCI) {
     BOOST_CHECK(compare(fci_energy("hf_sto3g_fci_dist"), reference_fci_energy()));
@@ -0,0 +1,92 @@
+//
+// BAGEL - Parallel electron correlation program.
+// Filename: test_hessian.cc
+// Copyright (C) 2026 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// The BAGEL package is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 3, or (at your option)
+// any later version.
+//
+// The BAGEL package is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the BAGEL package; see COPYING.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+
+#include <src/grad/hessian.h>
+#include <src/scf/hf/rhf.h>
+
+std::shared_ptr<const Hessian> run_hessian(std::string filename) {
+  auto ofs = std::make_shared<std::ofstream>(filename + ".testout", std::ios::trunc);
+  std::streambuf* backup_stream = std::cout.rdbuf(ofs->rdbuf());
+
+  auto idata = std::make_shared<const PTree>(location__ + filename + ".json");
+  std::shared_ptr<const Geometry> geom;
+  std::shared_ptr<const Hessian> out;
+
+  auto keys = idata->get_child("bagel");
+  for (auto& itree : *keys) {
+    const std::string title = to_lower(itree->get<std::string>("title", ""));
+    if (title == "molecule") {
+      geom = std::make_shared<const Geometry>(itree);
+    } else if (title == "hessian") {
+      auto hess = std::make_shared<Hessian>(itree, geom, nullptr);
+      hess->compute();
+      out = hess;
+    }
+  }
+  std::cout.rdbuf(backup_stream);
+  return out;
+}
+
+// d^2E/dz^2 of the first atom by central differences of HF energies with step h
+double energy_second_derivative(std::string filename, const double h) {
+  auto ofs = std::make_shared<std::ofstream>(filename + "_energy.testout", std::ios::trunc);
+  std::streambuf* backup_stream = std::cout.rdbuf(ofs->rdbuf());
+
+  auto idata = std::make_shared<const PTree>(location__ + filename + ".json");
+  std::shared_ptr<const PTree> minput;
+  auto keys = idata->get_child("bagel");
+  for (auto& itree : *keys)
+    if (to_lower(itree->get<std::string>("title", "")) == "molecule")
+      minput = itree;
+  auto geom = std::make_shared<const Geometry>(minput);
+  auto hfinput = std::make_shared<PTree>();
+  hfinput->put("thresh", 1.0e-10);
+
+  std::array<double,3> energy;
+  for (int i = -1; i <= 1; ++i) {
+    auto displ = std::make_shared<Matrix>(3, geom->natom(), true);
+    displ->element(2, 0) = i * h;
+    auto dgeom = std::make_shared<const Geometry>(*geom, displ, minput, /*rotate*/false);
+    auto scf = std::make_shared<RHF>(hfinput, dgeom);
+    scf->compute();
+    energy[i+1] = scf->energy();
+  }
+  std::cout.rdbuf(backup_stream);
+  return (energy[0] - 2.0*energy[1] + energy[2]) / (h*h);
+}
+
+BOOST_AUTO_TEST_SUITE(TEST_HESSIAN)
+
+BOOST_AUTO_TEST_CASE(FREQUENCIES) {
+    // with C2v symmetry, 9 of the 18 displaced gradients are computed and the rest of the Hessian is generated by Petite
+    std::shared_ptr<const Hessian> c2v = run_hessian("h2o_svp_hf_hessian");
+    std::shared_ptr<const Hessian> c1  = run_hessian("h2o_svp_hf_hessian_c1");
+    BOOST_CHECK(compare(c2v->frequencies(), std::vector<double>{1789.97, 3979.16, 4068.72}, 1.0e-1));
+    BOOST_CHECK(compare(c2v->frequencies(), c1->frequencies(), 1.0e-1));
+    // the zz element of the oxygen atom against second differences of energies
+    BOOST_CHECK(compare(c1->hessian()->element(2, 2), energy_second_derivative("h2o_svp_hf_hessian_c1", 0.005), 1.0e-4));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -66,6 +66,11 @@ BOOST_AUTO_TEST_CASE(DF_KS) {
     BOOST_CHECK(compare(ks_energy("hf_svp_b3lyp"),         -100.28959774));
 }
 
+BOOST_AUTO_TEST_CASE(DF_KS_COSX) {
+    // seminumerical exact exchange on the XC grid against the analytical exchange
+    BOOST_CHECK(compare(ks_energy("hf_svp_b3lyp_cosx"),    -100.28959774, 1.0e-4));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 #endif
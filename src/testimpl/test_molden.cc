@@ -26,6 +26,7 @@
 
 #include <src/util/io/moldenout.h>
 #include <src/util/io/moldenin.h>
+#include <src/util/io/orbitalcheckpoint.h>
 #include <src/scf/hf/fock.h>
 
 double molden_out_energy(std::string inp1, std::string inp2) {
@@ -94,6 +95,43 @@ double molden_out_energy(std::string inp1, std::string inp2) {
   return energy;
 }
 
+double checkpoint_energy(std::string inp) {
+
+  auto ofs = std::make_shared<std::ofstream>(inp + ".testout", std::ios::trunc);
+  std::streambuf* backup_stream = std::cout.rdbuf(ofs->rdbuf());
+
+  std::stringstream ss; ss << location__ << inp << ".json";
+  auto idata = std::make_shared<const PTree>(ss.str());
+  auto keys = idata->get_child("bagel");
+  std::shared_ptr<Geometry> geom;
+
+  for (auto& itree : *keys) {
+    const std::string method = to_lower(itree->get<std::string>("title", ""));
+
+    if (method == "molecule") {
+      geom = std::make_shared<Geometry>(itree);
+
+    } else if (method == "hf") {
+      auto scf = std::make_shared<RHF>(itree, geom);
+      scf->compute();
+      OrbitalCheckpoint(inp + ".orb").write(scf->conv_to_ref());
+    }
+  }
+
+  std::shared_ptr<const Reference> ref = OrbitalCheckpoint(inp + ".orb").read(geom);
+
+  std::shared_ptr<const Matrix> ao_density = ref->coeff()->form_density_rhf(ref->nclosed());
+  auto hcore = std::make_shared<const Hcore>(geom);
+  auto fock = std::make_shared<const Fock<1>>(geom, hcore, ao_density, geom->schwarz());
+
+  auto hcore_fock = std::make_shared<const Matrix>(*hcore + *fock);
+  double energy = ((*ao_density)*(*hcore_fock)).trace();
+  energy = 0.5*energy + geom->nuclear_repulsion();
+
+  std::cout.rdbuf(backup_stream);
+  return energy;
+}
+
 BOOST_AUTO_TEST_SUITE(TEST_MOLDEN)
 
 BOOST_AUTO_TEST_CASE(MOLDEN) {
@@ -101,4 +139,8 @@ BOOST_AUTO_TEST_CASE(MOLDEN) {
     BOOST_CHECK(compare(molden_out_energy("hf_write_mol_cart", "hf_read_mol_cart"), -99.84911270 ));
 }
 
+BOOST_AUTO_TEST_CASE(CHECKPOINT) {
+    BOOST_CHECK(compare(checkpoint_energy("hf_write_mol_sph"),   -99.84772354 ));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -26,6 +26,7 @@
 
 #include <memory>
 #include <src/pt2/mp2/mp2.h>
+#include <src/pt2/dmp2/dmp2.h>
 
 double mp2_energy(const std::string job) {
 
@@ -50,6 +51,13 @@ double mp2_energy(const std::string job) {
 
       std::cout.rdbuf(backup_stream);
       return mp2->energy();
+
+    } else if (method == "dmp2") {
+      auto dmp2 = std::make_shared<DMP2>(itree, geom, nullptr);
+      dmp2->compute();
+
+      std::cout.rdbuf(backup_stream);
+      return dmp2->energy();
     }
   }
   assert(false);
@@ -63,4 +71,10 @@ BOOST_AUTO_TEST_CASE(MP2) {
     BOOST_CHECK(compare(mp2_energy("benzene_svp_mp2_aux"),  -231.31450878));
 }
 
+BOOST_AUTO_TEST_CASE(DMP2) {
+    // Dirac-Coulomb HF + MP2; with virtual_block 4 the 28 virtual spinors are processed in 7 blocks (28 pairs of blocks)
+    BOOST_CHECK(compare(mp2_energy("hf_svp_dmp2"),       -100.15294973));
+    BOOST_CHECK(compare(mp2_energy("hf_svp_dmp2_block"), -100.15294973));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
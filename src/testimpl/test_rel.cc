@@ -72,4 +72,24 @@ BOOST_AUTO_TEST_CASE(DIRAC_FOCK) {
     BOOST_CHECK(compare(rel_energy("hf_svp_breit"),          -99.92755305));
 }
 
+BOOST_AUTO_TEST_CASE(DIRAC_FOCK_KRAMERS) {
+    // Kramers-restricted Fock builds for the closed-shell references above
+    BOOST_CHECK(compare(rel_energy("hf_svp_coulomb_kramers"), -99.93791152));
+    BOOST_CHECK(compare(rel_energy("hf_svp_gaunt_kramers"),   -99.92699858));
+}
+
+BOOST_AUTO_TEST_CASE(DIRAC_FOCK_APPROXIMATIONS) {
+    // (SS|SS) neglected, with the simple Coulomb correction (one-centre integrals and atomic charges), and screened at 1.0e-12 (same as the full treatment)
+    const double neglect = rel_energy("hf_svp_coulomb_neglect");
+    const double scc     = rel_energy("hf_svp_coulomb_scc");
+    BOOST_CHECK(compare(neglect, -99.93792000));
+    BOOST_CHECK(compare(scc,     -99.93791153));
+    // the error of scc should be much smaller than that of neglecting the integrals
+    BOOST_CHECK(fabs(scc - -99.93791152) < 0.01 * fabs(neglect - -99.93791152));
+    BOOST_CHECK(compare(rel_energy("hf_svp_coulomb_ss_thresh"), -99.93791152));
+    BOOST_CHECK(compare(rel_energy("hf_svp_gaunt_scc"),         -99.92699859));
+    // Gaunt switched on after the Dirac-Coulomb SCF converges; same as hf_svp_gaunt
+    BOOST_CHECK(compare(rel_energy("hf_svp_gaunt_lazy"),        -99.92699858));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
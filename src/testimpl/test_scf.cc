@@ -104,4 +104,32 @@ BOOST_AUTO_TEST_CASE(DF_HF) {
     BOOST_CHECK(compare(scf_energy("hbr_ecp_sohf"),       -13.68431370));
 }
 
+BOOST_AUTO_TEST_CASE(DF_HF_INCREMENTAL) {
+    // incremental Fock builds in the early iterations; the converged energies come from full builds
+    BOOST_CHECK(compare(scf_energy("hf_svp_dfhf_incremental"), -99.84772354));
+    BOOST_CHECK(compare(scf_energy("oh_svp_uhf_incremental"),  -75.28410147));
+    BOOST_CHECK(compare(scf_energy("hc_svp_rohf_incremental"), -38.16810629));
+}
+
+BOOST_AUTO_TEST_CASE(DF_HF_LOCAL_EXCHANGE) {
+    // exchange from localized orbitals with the default local_exchange_thresh (1.0e-4; about 7 of the 9 atoms per domain) against dense DF exchange
+    BOOST_CHECK(compare(scf_energy("watertrimer_sto3g_dfhf_lx"), scf_energy("watertrimer_sto3g_dfhf"), 1.0e-6));
+}
+
+BOOST_AUTO_TEST_CASE(DF_HF_MIXED_PRECISION) {
+    // single-precision exchange in the early iterations; the converged energies come from double-precision builds
+    BOOST_CHECK(compare(scf_energy("hf_svp_dfhf_mixed"),  -99.84772354));
+    BOOST_CHECK(compare(scf_energy("oh_svp_uhf_mixed"),   -75.28410147));
+}
+
+BOOST_AUTO_TEST_CASE(DF_HF_COSX) {
+    // seminumerical exchange on the default grid against the analytical exchange; the quadrature error of the grid is about 1.0e-4
+    BOOST_CHECK(compare(scf_energy("hf_svp_dfhf_cosx"),   -99.84772354, 2.0e-4));
+}
+
+BOOST_AUTO_TEST_CASE(CHOLESKY_HF) {
+    // Cholesky vectors with cholesky_thresh 1.0e-8 in place of the auxiliary basis, against the conventional energy
+    BOOST_CHECK(compare(scf_energy("hf_svp_cholesky"),    -99.84779026, 1.0e-6));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
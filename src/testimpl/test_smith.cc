@@ -0,0 +1,115 @@
+//
+// BAGEL - Parallel electron correlation program.
+// Filename: test_smith.cc
+// Copyright (C) 2026 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// The BAGEL package is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 3, or (at your option)
+// any later version.
+//
+// The BAGEL package is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the BAGEL package; see COPYING.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+
+#include <bagel_config.h>
+#ifdef COMPILE_SMITH
+#include <src/multi/casscf/superci.h>
+#include <src/smith/smith.h>
+#include <src/grad/force.h>
+
+// energies as returned by the SMITH solvers: the correlation energy for CASPT2, and for MRCI the energy without the core and nuclear contributions
+double smith_energy(std::string filename) {
+  auto ofs = std::make_shared<std::ofstream>(filename + ".testout", std::ios::trunc);
+  std::streambuf* backup_stream = std::cout.rdbuf(ofs->rdbuf());
+
+  auto idata = std::make_shared<const PTree>(location__ + filename + ".json");
+  std::shared_ptr<const Geometry> geom;
+  std::shared_ptr<const Reference> ref;
+
+  auto keys = idata->get_child("bagel");
+  for (auto& itree : *keys) {
+    const std::string method = to_lower(itree->get<std::string>("title", ""));
+
+    if (method == "molecule") {
+      geom = std::make_shared<const Geometry>(itree);
+
+    } else if (method == "casscf") {
+      auto cas = std::make_shared<SuperCI>(itree, geom);
+      cas->compute();
+      ref = cas->conv_to_ref();
+
+    } else if (method == "smith") {
+      auto smith = std::make_shared<Smith>(itree, geom, ref);
+      smith->compute();
+
+      std::cout.rdbuf(backup_stream);
+      return smith->algo()->energy();
+    }
+  }
+  assert(false);
+  return 0.0;
+}
+
+std::vector<double> smith_gradient(std::string filename) {
+  auto ofs = std::make_shared<std::ofstream>(filename + ".testout", std::ios::trunc);
+  std::streambuf* backup_stream = std::cout.rdbuf(ofs->rdbuf());
+
+  auto idata = std::make_shared<const PTree>(location__ + filename + ".json");
+  std::shared_ptr<const Geometry> geom;
+  std::vector<double> out;
+
+  auto keys = idata->get_child("bagel");
+  for (auto& itree : *keys) {
+    const std::string method = to_lower(itree->get<std::string>("title", ""));
+
+    if (method == "molecule") {
+      geom = std::make_shared<const Geometry>(itree);
+
+    } else if (method == "force") {
+      Force force(itree, geom, nullptr);
+      std::shared_ptr<const GradFile> grad = force.compute();
+      out.push_back(force.energy());
+      out.insert(out.end(), grad->data(), grad->data()+grad->size());
+    }
+  }
+  std::cout.rdbuf(backup_stream);
+  return out;
+}
+
+std::vector<double> reference_caspt2_gradient() {
+  std::vector<double> out(7);
+  out[0] = -99.99791024;
+  out[3] =   0.0930659829;
+  out[6] =  -0.0930659829;
+  return out;
+}
+
+BOOST_AUTO_TEST_SUITE(TEST_SMITH)
+
+BOOST_AUTO_TEST_CASE(CASPT2) {
+    BOOST_CHECK(compare(smith_energy("hf_svp_caspt2"),     -0.16288978));
+}
+
+BOOST_AUTO_TEST_CASE(MRCI) {
+    BOOST_CHECK(compare(smith_energy("hf_svp_mrci"),       -1.79116485));
+}
+
+BOOST_AUTO_TEST_CASE(CASPT2_GRADIENT) {
+    // the energy followed by the gradient
+    BOOST_CHECK(compare<std::vector<double>>(smith_gradient("hf_svp_caspt2_grad"), reference_caspt2_gradient(), 1.0e-6));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+#endif
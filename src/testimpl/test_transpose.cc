@@ -0,0 +1,137 @@
+//
+// BAGEL - Parallel electron correlation program.
+// Filename: test_transpose.cc
+// Copyright (C) 2026 Toru Shiozaki
+//
+// Author: Shane Parker < shane.parker@u.northwestern.edu >
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// The BAGEL package is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 3, or (at your option)
+// any later version.
+//
+// The BAGEL package is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the BAGEL package; see COPYING.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+
+#include <random>
+#include <src/util/prim_op.h>
+#include <src/wfn/rdm.h>
+
+// element-by-element transposition; the code path of sort_indices prior to blas::tensor_transpose
+void transpose_reference(const double* in, double* out, const std::vector<int>& dims, const std::vector<int>& perm,
+                         const double alpha, const double beta) {
+  const int rank = dims.size();
+  std::vector<size_t> ostride(rank);
+  size_t size = 1;
+  for (int q = 0; q != rank; ++q) {
+    ostride[perm[q]] = size;
+    size *= dims[perm[q]];
+  }
+  std::vector<int> idx(rank, 0);
+  for (size_t iall = 0; iall != size; ++iall) {
+    size_t ib = 0;
+    for (int p = 0; p != rank; ++p)
+      ib += idx[p]*ostride[p];
+    out[ib] = (beta == 0.0 ? 0.0 : beta*out[ib]) + alpha*in[iall];
+    for (int p = 0; p != rank; ++p) {
+      if (++idx[p] != dims[p]) break;
+      idx[p] = 0;
+    }
+  }
+}
+
+double transpose_error(const std::vector<int>& dims, const std::vector<int>& perm, const double alpha, const double beta, const int nthreads = 1) {
+  const size_t size = std::accumulate(dims.begin(), dims.end(), 1lu, std::multiplies<size_t>());
+  std::mt19937 gen(size);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  std::vector<double> in(size), out(size);
+  for (auto& i : in) i = dist(gen);
+  for (auto& i : out) i = dist(gen);
+  std::vector<double> ref(out);
+
+  transpose_reference(in.data(), ref.data(), dims, perm, alpha, beta);
+  blas::tensor_transpose(in.data(), out.data(), dims.size(), dims.data(), perm.data(), alpha, beta, nthreads);
+
+  double error = 0.0;
+  for (size_t i = 0; i != size; ++i)
+    error = std::max(error, std::fabs(out[i]-ref[i]));
+  return error;
+}
+
+// a typical SMITH permutation (see the CASPT2 tasks) through the sort_indices front end
+double sort_indices_error() {
+  const int a = 9, b = 7, c = 11, d = 5;
+  std::unique_ptr<double[]> in(new double[a*b*c*d]);
+  std::unique_ptr<double[]> out(new double[a*b*c*d]);
+  std::vector<double> ref(a*b*c*d);
+  for (int i = 0; i != a*b*c*d; ++i) {
+    in[i] = std::sin(i);
+    out[i] = ref[i] = std::cos(i);
+  }
+  sort_indices<0,2,3,1,1,1,-1,2>(in, out, d, c, b, a);
+  transpose_reference(in.get(), ref.data(), {d, c, b, a}, {0, 2, 3, 1}, -0.5, 1.0);
+  double error = 0.0;
+  for (int i = 0; i != a*b*c*d; ++i)
+    error = std::max(error, std::fabs(out[i]-ref[i]));
+  return error;
+}
+
+// RDM<2>::transform goes through the general contraction in btas; compared with the element-wise transformation
+double rdm2_transform_error() {
+  const int n = 6;
+  std::mt19937 gen(n);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  RDM<2> rdm(n);
+  auto coeff = std::make_shared<Matrix>(n, n);
+  for (auto& i : rdm) i = dist(gen);
+  for (auto& i : *coeff) i = dist(gen);
+
+  RDM<2> ref(n);
+  for (int a = 0; a != n; ++a)
+    for (int b = 0; b != n; ++b)
+      for (int c = 0; c != n; ++c)
+        for (int d = 0; d != n; ++d)
+          for (int i = 0; i != n; ++i)
+            for (int j = 0; j != n; ++j)
+              for (int k = 0; k != n; ++k)
+                for (int l = 0; l != n; ++l)
+                  ref(a,b,c,d) += rdm(i,j,k,l) * coeff->element(i,a) * coeff->element(j,b) * coeff->element(k,c) * coeff->element(l,d);
+  rdm.transform(coeff);
+
+  double error = 0.0;
+  auto r = ref.begin();
+  for (auto& i : rdm)
+    error = std::max(error, std::fabs(i-*r++));
+  return error;
+}
+
+BOOST_AUTO_TEST_SUITE(TEST_TRANSPOSE)
+
+BOOST_AUTO_TEST_CASE(TENSOR_TRANSPOSE) {
+    BOOST_CHECK(compare(transpose_error({37, 41}, {1, 0}, 1.0, 0.0), 0.0));
+    BOOST_CHECK(compare(transpose_error({13, 1, 29}, {2, 0, 1}, 2.0, 1.0), 0.0));
+    BOOST_CHECK(compare(transpose_error({9, 7, 11, 5}, {0, 2, 3, 1}, 1.0, 0.0), 0.0));
+    BOOST_CHECK(compare(transpose_error({9, 7, 11, 5}, {1, 0, 3, 2}, -1.0, 1.0), 0.0));
+    BOOST_CHECK(compare(transpose_error({6, 5, 4, 7, 3}, {4, 2, 0, 3, 1}, 0.5, 2.0), 0.0));
+    BOOST_CHECK(compare(transpose_error({5, 6, 3, 4, 5, 3}, {3, 0, 1, 2, 5, 4}, 1.0, 1.0), 0.0));
+    BOOST_CHECK(compare(transpose_error({3, 4, 2, 5, 3, 2, 4}, {6, 5, 4, 3, 2, 1, 0}, 1.0, 0.0), 0.0));
+    BOOST_CHECK(compare(transpose_error({4, 3, 5, 2, 3, 4, 2, 3}, {1, 0, 2, 3, 7, 6, 4, 5}, -2.0, 0.5), 0.0));
+    BOOST_CHECK(compare(transpose_error({40, 30, 20, 10}, {3, 1, 2, 0}, 1.0, 0.0, 4), 0.0));
+    BOOST_CHECK(compare(transpose_error({0, 5}, {1, 0}, 1.0, 0.0), 0.0));
+    BOOST_CHECK(compare(transpose_error({4, 0, 3}, {1, 2, 0}, 1.0, 1.0), 0.0));
+    BOOST_CHECK(compare(transpose_error({3, 4, 0}, {2, 0, 1}, -1.0, 0.0, 4), 0.0));
+    BOOST_CHECK(compare(sort_indices_error(), 0.0));
+    BOOST_CHECK(compare(rdm2_transform_error(), 0.0));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -483,6 +483,102 @@ AtomMap::AtomMap () {
   nuclear_exponents.emplace("hn", 1.1905722195E+08);
   nuclear_exponents.emplace("mt", 1.1878724932E+08);
 
+  // most abundant (or longest-lived) isotopes (AME 2012)
+  masses.emplace("h",  1.00782503207);
+  masses.emplace("he", 4.00260325415);
+  masses.emplace("li", 7.01600455);
+  masses.emplace("be", 9.0121822);
+  masses.emplace("b",  11.0093054);
+  masses.emplace("c",  12.0000000);
+  masses.emplace("n",  14.0030740048);
+  masses.emplace("o",  15.99491461956);
+  masses.emplace("f",  18.99840322);
+  masses.emplace("ne", 19.9924401754);
+  masses.emplace("na", 22.9897692809);
+  masses.emplace("mg", 23.985041700);
+  masses.emplace("al", 26.98153863);
+  masses.emplace("si", 27.9769265325);
+  masses.emplace("p",  30.97376163);
+  masses.emplace("s",  31.97207100);
+  masses.emplace("cl", 34.96885268);
+  masses.emplace("ar", 39.9623831225);
+  masses.emplace("k",  38.96370668);
+  masses.emplace("ca", 39.96259098);
+  masses.emplace("sc", 44.9559119);
+  masses.emplace("ti", 47.9479463);
+  masses.emplace("v",  50.9439595);
+  masses.emplace("cr", 51.9405075);
+  masses.emplace("mn", 54.9380451);
+  masses.emplace("fe", 55.9349375);
+  masses.emplace("co", 58.9331950);
+  masses.emplace("ni", 57.9353429);
+  masses.emplace("cu", 62.9295975);
+  masses.emplace("zn", 63.9291422);
+  masses.emplace("ga", 68.9255736);
+  masses.emplace("ge", 73.9211778);
+  masses.emplace("as", 74.9215965);
+  masses.emplace("se", 79.9165213);
+  masses.emplace("br", 78.9183371);
+  masses.emplace("kr", 83.911507);
+  masses.emplace("rb", 84.911789738);
+  masses.emplace("sr", 87.9056121);
+  masses.emplace("y",  88.9058483);
+  masses.emplace("zr", 89.9047044);
+  masses.emplace("nb", 92.9063781);
+  masses.emplace("mo", 97.9054082);
+  masses.emplace("tc", 97.907216);
+  masses.emplace("ru", 101.9043493);
+  masses.emplace("rh", 102.905504);
+  masses.emplace("pd", 105.903486);
+  masses.emplace("ag", 106.905097);
+  masses.emplace("cd", 113.9033585);
+  masses.emplace("in", 114.903878);
+  masses.emplace("sn", 119.9021947);
+  masses.emplace("sb", 120.9038157);
+  masses.emplace("te", 129.9062244);
+  masses.emplace("i",  126.904473);
+  masses.emplace("xe", 131.9041535);
+  masses.emplace("cs", 132.905451933);
+  masses.emplace("ba", 137.9052472);
+  masses.emplace("la", 138.9063533);
+  masses.emplace("ce", 139.9054387);
+  masses.emplace("pr", 140.9076528);
+  masses.emplace("nd", 141.9077233);
+  masses.emplace("pm", 144.912749);
+  masses.emplace("sm", 151.9197324);
+  masses.emplace("eu", 152.9212303);
+  masses.emplace("gd", 157.9241039);
+  masses.emplace("tb", 158.9253468);
+  masses.emplace("dy", 163.9291748);
+  masses.emplace("ho", 164.9303221);
+  masses.emplace("er", 165.9302931);
+  masses.emplace("tm", 168.9342133);
+  masses.emplace("yb", 173.9388621);
+  masses.emplace("lu", 174.9407718);
+  masses.emplace("hf", 179.9465500);
+  masses.emplace("ta", 180.9479958);
+  masses.emplace("w",  183.9509312);
+  masses.emplace("re", 186.9557531);
+  masses.emplace("os", 191.9614807);
+  masses.emplace("ir", 192.9629264);
+  masses.emplace("pt", 194.9647911);
+  masses.emplace("au", 196.9665687);
+  masses.emplace("hg", 201.9706430);
+  masses.emplace("tl", 204.9744275);
+  masses.emplace("pb", 207.9766521);
+  masses.emplace("bi", 208.9803987);
+  masses.emplace("po", 208.9824304);
+  masses.emplace("at", 209.987148);
+  masses.emplace("rn", 222.0175777);
+  masses.emplace("fr", 223.0197359);
+  masses.emplace("ra", 226.0254098);
+  masses.emplace("ac", 227.0277521);
+  masses.emplace("th", 232.0380553);
+  masses.emplace("pa", 231.0358840);
+  masses.emplace("u",  238.0507882);
+  masses.emplace("np", 237.0481734);
+  masses.emplace("pu", 244.064204);
+
   angmap.emplace("s", 0);
   angmap.emplace("p", 1);
   angmap.emplace("d", 2);
@@ -757,6 +853,13 @@ double AtomMap::cov_radius(const string input) const {
 }
 
 
+double AtomMap::mass(const string input) const {
+  auto miter = masses.find(input);
+  if (miter == masses.end()) throw runtime_error("Unknown atom (mass).");
+  return miter->second;
+}
+
+
 double AtomMap::nuclear_exponent(const string input) const {
   auto miter = nuclear_exponents.find(input);
   if (miter == nuclear_exponents.end()) throw runtime_error("Unknown atom (Finite nucleus exponent).");
@@ -52,6 +52,7 @@ static constexpr double au2kilogram__ = 9.10938291e-31;    // CODATA 2010 electr
 static constexpr double au2coulomb__ = 1.602176565e-19;    // CODATA 2010 elementary charge
 static constexpr double au2meter__ = 5.2917721092e-11;     // CODATA 2010 Bohr radius
 static constexpr double avogadro__ = 6.02214129e23;        // CODATA 2010 Avogadro constant
+static constexpr double amu2kilogram__ = 1.660538921e-27;  // CODATA 2010 atomic mass constant
 
 /************************************************************
 *  Derived unit conversions                                 *
@@ -62,6 +63,8 @@ static const double au2joule__ = au2kilogram__ * std::pow(au2meter__ / au2second
 static const double au2kjmol__ = au2joule__ * avogadro__ / 1.0e3;
 static const double au2eV__ = au2kilogram__ * au2meter__ * au2meter__ / au2second__ / au2second__ / au2coulomb__;
 static const double au2tesla__ = au2kilogram__ / au2coulomb__ / au2second__;
+static const double amu2au__ = amu2kilogram__ / au2kilogram__;
+static const double au2wavenumber__ = 1.0 / (2.0 * pi__ * 2.99792458e10 * au2second__);
 
 /************************************************************
 *  Numerical constants                                      *
@@ -44,6 +44,9 @@ extern "C" {
  void dgemm_(const char* transa, const char* transb, const int* m, const int* n, const int* k,
              const double* alpha, const double* a, const int* lda, const double* b, const int* ldb,
              const double* beta, double* c, const int* ldc);
+ void sgemm_(const char* transa, const char* transb, const int* m, const int* n, const int* k,
+             const float* alpha, const float* a, const int* lda, const float* b, const int* ldb,
+             const float* beta, float* c, const int* ldc);
  void dsysv_(const char* uplo, const int* n, const int* nrhs, double* a, const int* lda, int* ipiv,
              double* b, const int* ldb, double* work, const int* lwork, int* info);
  void drot_(const int*, const double*, const int*, const double*, const int*, const double*, const double*);
@@ -101,6 +104,9 @@ namespace {
              const double alpha, const std::unique_ptr<double []>& a, const int lda, const std::unique_ptr<double []>& b, const int ldb,
              const double beta, std::unique_ptr<double []>& c, const int ldc)
              { ::dgemm_(transa,transb,&m,&n,&k,&alpha,a.get(),&lda,b.get(),&ldb,&beta,c.get(),&ldc); }
+ void sgemm_(const char* transa, const char* transb, const int m, const int n, const int k,
+             const float alpha, const float* a, const int lda, const float* b, const int ldb,
+             const float beta, float* c, const int ldc) { ::sgemm_(transa,transb,&m,&n,&k,&alpha,a,&lda,b,&ldb,&beta,c,&ldc); }
  void dgemv_(const char* a, const int b, const int c, const double d, const double* e, const int f, const double* g, const int h,
              const double i, double* j, const int k) { ::dgemv_(a,&b,&c,&d,e,&f,g,&h,&i,j,&k); }
  void dgemv_(const char* a, const int b, const int c, const double d, const std::unique_ptr<double []>& e, const int f,
@@ -23,6 +23,8 @@
 // the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
 //
 
+#include <map>
+#include <mutex>
 #include <fstream>
 #include <string>
 #include <src/util/input/input.h>
@@ -99,6 +101,14 @@ void PTree::print() const {
 
 shared_ptr<const PTree> PTree::read_basis(string name) {
   name = to_lower(name);
+  // parsed basis sets are kept, since they are read for every geometry (e.g., in batch jobs and finite differences)
+  static mutex mtx;
+  static map<string, shared_ptr<const PTree>> parsed;
+  lock_guard<mutex> lock(mtx);
+  auto iter = parsed.find(name);
+  if (iter != parsed.end())
+    return iter->second;
+
   shared_ptr<const PTree> out;
   // first try the absolute path (or current directory)
   try {
@@ -120,5 +130,6 @@ shared_ptr<const PTree> PTree::read_basis(string name) {
       }
     }
   }
+  parsed.emplace(name, out);
   return out;
 }
@@ -143,39 +143,25 @@ void MoldenIn::read() {
   string line; // Contains the current line of the file
 
   /************************************************************
-  *  An inelegant search to check for the 5D keyword          *
-  ************************************************************/
-  {
-    cartesian_ = true;
-    ifstream sph_input(filename_);
-    if (!sph_input.is_open()){
-      throw runtime_error("Molden input file not found");
-    }
-    else {
-      regex _5d_re("\\[5[Dd]\\]");
-      regex _5d7f_re("\\[5[Dd]7[Ff]\\]");
-      while (!sph_input.eof()) {
-        getline(sph_input, line);
-        if (regex_search(line,_5d_re)){
-          cartesian_ = false;
-        }
-        else if(regex_search(line,_5d7f_re)) {
-          cartesian_ = false;
-        }
-      }
-    }
-  }
-
-  /************************************************************
-  *  Open input stream                                        *
+  *  Open input stream. The file is read only once; the 5D    *
+  *  keyword is picked up wherever it appears.                *
   ************************************************************/
+  cartesian_ = true;
+  regex _5d_re("\\[5[Dd]\\]");
+  regex _5d7f_re("\\[5[Dd]7[Ff]\\]");
 
   ifstream ifs(filename_);
+  if (!ifs.is_open())
+    throw runtime_error("Molden input file not found");
 
   getline(ifs, line);
 
   while (!ifs.eof()){
-    if (regex_search(line,atoms_re)) {
+    if (regex_search(line,_5d_re) || regex_search(line,_5d7f_re)) {
+      cartesian_ = false;
+      getline(ifs, line);
+    }
+    else if (regex_search(line,atoms_re)) {
       regex ang_re("Angs");
       regex atoms_line("(\\w{1,2})\\s+\\d+\\s+\\d+\\s+(\\S+)\\s+(\\S+)\\s+(\\S+)");
 
@@ -286,27 +272,37 @@ void MoldenIn::read() {
       regex ene_re("Ene=\\s+(\\S+)");
       regex spin_re("Spin=\\s+(\\w+)");
       regex occup_re("Occup=\\s+(\\S+)"); */
-      regex coeff_re("\\d+\\s+(\\S+)");
-
+      // coefficient lines are "index value"; they are parsed without regex since they make up most of the file
+      auto parse_coeff = [](const string& l, double& value) {
+        const char* c = l.c_str();
+        while (isspace(*c)) ++c;
+        if (!isdigit(*c)) return false;
+        while (isdigit(*c)) ++c;
+        if (!isspace(*c)) return false;
+        char* end;
+        value = strtod(c, &end);
+        return end != c;
+      };
+
+      double coeff;
       getline(ifs, line);
       while (!regex_search(line,other_re) && !ifs.eof()) {
         vector<double> movec;
+        if (!mo_coefficients_.empty())
+          movec.reserve(mo_coefficients_.back().size());
 
         getline(ifs, line);
-        while (!regex_search(line.c_str(),coeff_re)) {
+        while (!parse_coeff(line, coeff) && !ifs.eof()) {
           /* For now, throwing away excess data until we get to MO coefficients */
           getline(ifs, line);
         }
 
-        while (regex_search(line.c_str(),matches,coeff_re)){
-          string mo_string(matches[1].first, matches[1].second);
-          double coeff = lexical_cast<double>(mo_string);
-
+        while (parse_coeff(line, coeff)) {
           movec.push_back(coeff);
           getline(ifs, line);
         }
 
-        mo_coefficients_.push_back(movec);
+        mo_coefficients_.push_back(move(movec));
       }
     } else {
       getline(ifs, line);
@@ -23,6 +23,7 @@
 // the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
 //
 
+#include <cstdio>
 #include <src/util/io/moldenout.h>
 #include <src/util/atommap.h>
 
@@ -32,8 +33,11 @@ using namespace std;
 /************************************************************************************
 ************************************************************************************/
 
-MoldenOut::MoldenOut(string filename) : MoldenIO(filename), ofs_(filename) {
-  ofs_ << "[Molden Format]" << endl;
+MoldenOut::MoldenOut(string filename) : MoldenIO(filename), buffer_(new char[buffer_size__]) {
+  // the buffer has to be set before the file is opened
+  ofs_.rdbuf()->pubsetbuf(buffer_.get(), buffer_size__);
+  ofs_.open(filename);
+  ofs_ << "[Molden Format]\n";
 }
 
 MoldenOut& MoldenOut::operator<< (shared_ptr<const Molecule> mol) {
@@ -54,7 +58,7 @@ MoldenOut& MoldenOut::operator<< (shared_ptr<const Reference> ref) {
 void MoldenOut::write_geom() {
   const int num_atoms = mol_->natom();
 
-  ofs_ << "[Atoms] Angs" << endl;
+  ofs_ << "[Atoms] Angs" << "\n";
 
   for (int i = 0; i < num_atoms; ++i) {
      shared_ptr<const Atom> cur_atom = mol_->atoms(i);
@@ -67,7 +71,7 @@ void MoldenOut::write_geom() {
                                  << setw(8)  << cur_number << setiosflags(ios_base::scientific)
                                  << setw(20) << setprecision(12) << cur_pos[0]*au2angstrom__
                                  << setw(20) << setprecision(12) << cur_pos[1]*au2angstrom__
-                                 << setw(20) << setprecision(12) << cur_pos[2]*au2angstrom__ << endl;
+                                 << setw(20) << setprecision(12) << cur_pos[2]*au2angstrom__ << "\n";
   }
 }
 
@@ -80,12 +84,12 @@ void MoldenOut::write_mos() {
   /************************************************************
   *  Print GTO section                                        *
   ************************************************************/
-  ofs_ << "[GTO]" << endl;
+  ofs_ << "[GTO]" << "\n";
 
   AtomMap am;
   auto iatom = atoms.begin();
   for (int ii = 0; ii != num_atoms; ++iatom, ++ii) {
-    ofs_ << ii+1 << endl;
+    ofs_ << ii+1 << "\n";
 
     vector<shared_ptr<const Shell>> shells = (*iatom)->shells();
     for (auto& ishell : shells) {
@@ -96,54 +100,66 @@ void MoldenOut::write_mos() {
       for (int jj = 0; jj < num_contracted; ++jj) {
         pair<int,int> range = ishell->contraction_ranges(jj);
 
-        ofs_ << setw(2) << ang_l << setw(8) << range.second - range.first << endl;
+        ofs_ << setw(2) << ang_l << setw(8) << range.second - range.first << "\n";
         for (int kk = range.first; kk < range.second; ++kk) {
           ofs_ << setiosflags(ios_base::scientific)
                << setw(20) << setprecision(8) << exponents[kk]
                << setw(20) << setprecision(8)
-               << ishell->contractions(jj)[kk]*denormalize(ishell->angular_number(), exponents[kk]) << endl;
+               << ishell->contractions(jj)[kk]*denormalize(ishell->angular_number(), exponents[kk]) << "\n";
         }
       }
     }
-    ofs_ << endl;
+    ofs_ << "\n";
   }
-  ofs_ << endl;
-  if (is_spherical) ofs_ << "[5D]" << endl;
-  ofs_ << "[MO]" << endl;
+  ofs_ << "\n";
+  if (is_spherical) ofs_ << "[5D]" << "\n";
+  ofs_ << "[MO]" << "\n";
 
   const int num_mos = ref_->coeff()->mdim();
+  const int nbasis = ref_->coeff()->ndim();
   int nocc = ref_->nclosed();
 
-  const double* modata = ref_->coeff()->data();
-
   VectorB eigvec = ref_->eig();
   if (eigvec.empty())
     eigvec = VectorB(num_mos);
   assert(eigvec.size() == num_mos);
 
-  for (auto& ieig : eigvec) {
+  // order and scaling of the basis functions in the Molden convention; the same for all MOs
+  vector<pair<int, double>> order;
+  order.reserve(nbasis);
+  for (auto& iatom : atoms) {
+    for (auto& ishell : iatom->shells()) {
+      const vector<int>& corder = (is_spherical ? b2m_sph_.at(ishell->angular_number()) : b2m_cart_.at(ishell->angular_number()));
+      for (int icont = 0; icont != ishell->num_contracted(); ++icont) {
+        const int offset = order.size();
+        for (auto& iorder : corder)
+          order.emplace_back(offset + iorder, is_spherical ? 1.0 : scaling_.at(ishell->angular_number()).at(iorder));
+      }
+    }
+  }
+  assert(order.size() == nbasis);
 
-    ofs_ << " Ene=" << setw(12) << setprecision(6) << fixed << ieig << endl;
+  // each MO is formatted into a buffer that is written at once
+  string buffer;
+  buffer.reserve((nbasis + 3) * 32);
+  char line[64];
+  for (int imo = 0; imo != num_mos; ++imo) {
+    buffer.clear();
+    snprintf(line, sizeof(line), " Ene=%12.6f\n", eigvec(imo));
+    buffer += line;
 
     /* At the moment only thinking about RHF, so assume spin is Alpha */
-    ofs_ << " Spin=" << "  Alpha" << endl;
+    buffer += " Spin=  Alpha\n";
 
     /* At the moment, assuming occupation can be 2 or 0. Should be fine for RHF */
-    const string occ_string = nocc-- > 0 ? "  2.000" : "  0.000";
-    ofs_ << " Occup=" << occ_string << endl;
-
-    int j = 0;
-    for (auto& iatom : atoms) {
-      for (auto& ishell : iatom->shells()) {
-        for (int icont = 0; icont != ishell->num_contracted(); ++icont) {
-          vector<int> corder = (is_spherical ? b2m_sph_.at(ishell->angular_number()) : b2m_cart_.at(ishell->angular_number()));
-          vector<double> scales = (is_spherical ? vector<double>(corder.size(), 1.0) : scaling_.at(ishell->angular_number()));
-          for (auto& iorder : corder) {
-             ofs_ << fixed << setw(4) << ++j << setw(22) << setprecision(16) << modata[iorder] / scales.at(iorder) << endl;
-          }
-          modata += corder.size();
-        }
-      }
+    buffer += nocc-- > 0 ? " Occup=  2.000\n" : " Occup=  0.000\n";
+
+    const double* modata = ref_->coeff()->element_ptr(0, imo);
+    for (int j = 0; j != nbasis; ++j) {
+      snprintf(line, sizeof(line), "%4d%22.16f\n", j+1, modata[order[j].first] / order[j].second);
+      buffer += line;
     }
+    ofs_.write(buffer.data(), buffer.size());
   }
+  ofs_.flush();
 }
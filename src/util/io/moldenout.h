@@ -32,8 +32,12 @@ namespace bagel {
 
 class MoldenOut : public MoldenIO {
    protected:
+      // buffer of the file stream (declared before ofs_ so that it outlives the stream)
+      std::unique_ptr<char[]> buffer_;
       std::ofstream ofs_;
 
+      static const size_t buffer_size__ = 1 << 20;
+
       void write_geom();
       void write_mos();
 
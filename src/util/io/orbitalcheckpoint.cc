@@ -0,0 +1,151 @@
+//
+// BAGEL - Parallel electron correlation program.
+// Filename: orbitalcheckpoint.cc
+// Copyright (C) 2015 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// The BAGEL package is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 3, or (at your option)
+// any later version.
+//
+// The BAGEL package is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the BAGEL package; see COPYING.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+
+#include <cstring>
+#include <fstream>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <src/util/io/orbitalcheckpoint.h>
+
+using namespace std;
+using namespace bagel;
+
+static const char magic__[8] = {'B', 'A', 'G', 'E', 'L', 'O', 'R', 'B'};
+
+namespace {
+  // FNV-1a
+  void hash_bytes(uint64_t& h, const void* p, const size_t n) {
+    const unsigned char* c = static_cast<const unsigned char*>(p);
+    for (size_t i = 0; i != n; ++i) {
+      h ^= c[i];
+      h *= 1099511628211ull;
+    }
+  }
+}
+
+
+uint64_t OrbitalCheckpoint::fingerprint(shared_ptr<const Molecule> mol) {
+  uint64_t h = 14695981039346656037ull;
+  const uint32_t spherical = mol->spherical();
+  hash_bytes(h, &spherical, sizeof(uint32_t));
+  for (auto& atom : mol->atoms()) {
+    hash_bytes(h, atom->name().data(), atom->name().size());
+    for (auto& shell : atom->shells()) {
+      const int32_t l = shell->angular_number();
+      hash_bytes(h, &l, sizeof(int32_t));
+      hash_bytes(h, shell->exponents().data(), shell->exponents().size()*sizeof(double));
+      for (auto& c : shell->contractions())
+        hash_bytes(h, c.data(), c.size()*sizeof(double));
+    }
+  }
+  return h;
+}
+
+
+void OrbitalCheckpoint::write(shared_ptr<const Reference> ref) const {
+  shared_ptr<const Coeff> coeff = ref->coeff();
+  const size_t nbasis = coeff->ndim();
+  const size_t nmo = coeff->mdim();
+
+  Header header;
+  memset(&header, 0, sizeof(Header));
+  copy_n(magic__, 8, header.magic);
+  header.version = version__;
+  header.spherical = ref->geom()->spherical();
+  header.nbasis = nbasis;
+  header.nmo = nmo;
+  header.nclosed = ref->nclosed();
+  header.nact = ref->nact();
+  header.nvirt = ref->nvirt();
+  header.fingerprint = fingerprint(ref->geom());
+  header.energy = ref->energy();
+  header.coeff_offset = align(sizeof(Header));
+  header.eig_offset = header.coeff_offset + align(nbasis*nmo*sizeof(double));
+  header.size = header.eig_offset + align(nmo*sizeof(double));
+
+  VectorB eig(nmo);
+  if (ref->eig().size() == nmo)
+    copy_n(ref->eig().data(), nmo, eig.data());
+
+  ofstream ofs(filename_, ios::binary | ios::trunc);
+  if (!ofs.is_open())
+    throw runtime_error("could not open " + filename_ + " for writing");
+
+  const vector<char> padding(alignment__, 0);
+  auto write_section = [&](const char* data, const size_t n, const size_t offset) {
+    assert(static_cast<size_t>(ofs.tellp()) <= offset);
+    ofs.write(padding.data(), offset - ofs.tellp());
+    ofs.write(data, n);
+  };
+  ofs.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+  write_section(reinterpret_cast<const char*>(coeff->data()), nbasis*nmo*sizeof(double), header.coeff_offset);
+  write_section(reinterpret_cast<const char*>(eig.data()), nmo*sizeof(double), header.eig_offset);
+  ofs.write(padding.data(), header.size - ofs.tellp());
+  if (!ofs.good())
+    throw runtime_error("error while writing " + filename_);
+}
+
+
+shared_ptr<Reference> OrbitalCheckpoint::read(shared_ptr<const Geometry> geom) const {
+  const int fd = open(filename_.c_str(), O_RDONLY);
+  if (fd < 0)
+    throw runtime_error(filename_ + " not found");
+  struct stat st;
+  if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(Header)) {
+    close(fd);
+    throw runtime_error(filename_ + " is not an orbital checkpoint file");
+  }
+  const size_t size = st.st_size;
+  void* map = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (map == MAP_FAILED)
+    throw runtime_error("could not map " + filename_);
+  // unmapped when leaving this function
+  unique_ptr<void, function<void(void*)>> mapped(map, [size](void* p) { munmap(p, size); });
+
+  const char* base = static_cast<const char*>(map);
+  const Header& header = *reinterpret_cast<const Header*>(base);
+
+  if (!equal(magic__, magic__+8, header.magic))
+    throw runtime_error(filename_ + " is not an orbital checkpoint file");
+  if (header.version > version__)
+    throw runtime_error(filename_ + " was written by a newer version of the program");
+  if (header.size > size)
+    throw runtime_error(filename_ + " is truncated");
+  if (header.nbasis != geom->nbasis() || header.fingerprint != fingerprint(geom) || header.spherical != static_cast<uint32_t>(geom->spherical()))
+    throw runtime_error("basis set in " + filename_ + " does not match the current geometry");
+
+  const size_t nmo = header.nmo;
+  auto coeff = make_shared<Coeff>(Matrix(header.nbasis, nmo));
+  copy_n(reinterpret_cast<const double*>(base + header.coeff_offset), header.nbasis*nmo, coeff->data());
+
+  auto out = make_shared<Reference>(geom, coeff, header.nclosed, header.nact, header.nvirt, header.energy);
+  VectorB eig(nmo);
+  copy_n(reinterpret_cast<const double*>(base + header.eig_offset), nmo, eig.data());
+  out->set_eig(eig);
+  return out;
+}
@@ -0,0 +1,78 @@
+//
+// BAGEL - Parallel electron correlation program.
+// Filename: orbitalcheckpoint.h
+// Copyright (C) 2015 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// The BAGEL package is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 3, or (at your option)
+// any later version.
+//
+// The BAGEL package is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the BAGEL package; see COPYING.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+
+#ifndef __SRC_IO_ORBITALCHECKPOINT_H
+#define __SRC_IO_ORBITALCHECKPOINT_H
+
+#include <cstdint>
+#include <src/util/io/fileio.h>
+#include <src/wfn/reference.h>
+
+namespace bagel {
+
+// Compact, versioned binary file for MO coefficients and orbital energies.
+// Unlike the boost archives of Reference, it does not store the Geometry (and hence DF objects); instead
+// a fingerprint of the basis set is stored and checked upon reading. Density matrices are not stored either,
+// so a Reference read from the file only carries orbitals. All the sections are aligned to 64 bytes,
+// so that the file can be memory mapped and the coefficients are copied into Coeff without parsing.
+class OrbitalCheckpoint : public FileIO {
+  public:
+    struct Header {
+      char magic[8];
+      uint32_t version;
+      uint32_t spherical;
+      uint64_t nbasis;
+      uint64_t nmo;
+      int64_t nclosed;
+      int64_t nact;
+      int64_t nvirt;
+      uint64_t fingerprint;
+      double energy;
+      // offsets in bytes from the beginning of the file
+      uint64_t coeff_offset;
+      uint64_t eig_offset;
+      uint64_t size;
+    };
+
+    static const uint32_t version__ = 1;
+    static const size_t alignment__ = 64;
+
+  protected:
+    static size_t align(const size_t n) { return (n + alignment__ - 1) / alignment__ * alignment__; }
+
+  public:
+    OrbitalCheckpoint(const std::string filename) : FileIO(filename) { }
+
+    // hash of the basis functions (angular numbers, exponents and contraction coefficients, per atom)
+    static uint64_t fingerprint(std::shared_ptr<const Molecule> mol);
+
+    void write(std::shared_ptr<const Reference> ref) const;
+    // returns a Reference on geom. Throws if the basis set is not the same as the one used to write the file.
+    std::shared_ptr<Reference> read(std::shared_ptr<const Geometry> geom) const;
+};
+
+}
+
+#endif
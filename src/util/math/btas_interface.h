@@ -40,8 +40,25 @@
 #include <btas/tensor_func.h>
 #include <src/util/math/btas_varray.h>
 #include <src/util/math/preallocarray.h>
+#include <src/util/math/tensortranspose.h>
 
 namespace btas {
+  // the general path of btas::contract uses the blocked transposition
+  template<>
+  struct contract_transpose<double> {
+    static void call(const double* in, double* out, const int rank, const int* dims, const int* perm, const double alpha = 1.0, const double beta = 0.0) {
+      bagel::blas::tensor_transpose(in, out, rank, dims, perm, alpha, beta);
+    }
+  };
+
+  template<>
+  struct contract_transpose<std::complex<double>> {
+    static void call(const std::complex<double>* in, std::complex<double>* out, const int rank, const int* dims, const int* perm,
+                     const std::complex<double> alpha = 1.0, const std::complex<double> beta = 0.0) {
+      bagel::blas::tensor_transpose(in, out, rank, dims, perm, alpha, beta);
+    }
+  };
+
   // int N is not nessesary, but leave it so that we can switch to fixed-rank tensors in the future
   template<int N>
   using CRange = RangeNd<CblasColMajor>;
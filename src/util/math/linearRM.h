@@ -97,6 +97,82 @@ class LinearRM {
 
 };
 
+
+// Residual minimization for several right-hand sides that share A.
+// All trial vectors span one subspace, so each trial vector (and its sigma vector) benefits every right-hand side.
+template<typename T>
+class BlockLinearRM {
+
+  protected:
+    std::list<std::shared_ptr<const T>> c_;
+    std::list<std::shared_ptr<const T>> sigma_;
+
+    const int max_;
+    int size_;
+    const std::vector<std::shared_ptr<const T>> grad_;
+
+    // contains
+    std::shared_ptr<Matrix> mat_;
+    std::shared_ptr<Matrix> vec_;
+    std::shared_ptr<Matrix> prod_;
+
+  public:
+    BlockLinearRM(const int ndim, const std::vector<std::shared_ptr<const T>>& grad) : max_(ndim), size_(0), grad_(grad) {
+      mat_ = std::make_shared<Matrix>(max_, max_);
+      prod_ = std::make_shared<Matrix>(max_, grad_.size());
+    }
+
+    // registers new trial vectors and returns the residual for every right-hand side
+    std::vector<std::shared_ptr<T>> compute_residual(const std::vector<std::shared_ptr<const T>>& c, const std::vector<std::shared_ptr<const T>>& s) {
+      assert(c.size() == s.size());
+      if (size_ + c.size() > max_) throw std::runtime_error("max size reached in BlockLinearRM");
+
+      auto ic = c.begin();
+      for (auto& is : s) {
+        c_.push_back(*ic++);
+        sigma_.push_back(is);
+        ++size_;
+        auto siter = sigma_.begin();
+        for (int i = 0; i != size_; ++i)
+          mat_->element(i,size_-1) = mat_->element(size_-1,i) = is->dot_product(**siter++);
+        // NOTE THE MINUS SIGN HERE!!
+        for (int k = 0; k != grad_.size(); ++k)
+          prod_->element(size_-1,k) = - is->dot_product(*grad_[k]);
+      }
+
+      // one linear solve for all the right-hand sides
+      vec_ = prod_->solve(mat_, size_);
+
+      std::vector<std::shared_ptr<T>> out;
+      for (int k = 0; k != grad_.size(); ++k) {
+        out.push_back(std::make_shared<T>(*grad_[k]));
+        int cnt = 0;
+        for (auto& j : sigma_)
+          out.back()->ax_plus_y(vec_->element(cnt++, k), j);
+      }
+      return out;
+    }
+
+    std::shared_ptr<T> civec(const int k) const {
+      std::shared_ptr<T> out = c_.front()->clone();
+      int cnt = 0;
+      for (auto& i : c_)
+        out->ax_plus_y(vec_->element(cnt++, k), i);
+      return out;
+    }
+
+    int nrhs() const { return grad_.size(); }
+    int size() const { return size_; }
+
+    // make cc orthogonal to c_ and to the vectors in extra (trial vectors of the same batch)
+    double orthog(std::shared_ptr<T>& cc, const std::vector<std::shared_ptr<const T>>& extra = {}) const {
+      std::list<std::shared_ptr<const T>> all = c_;
+      all.insert(all.end(), extra.begin(), extra.end());
+      return cc->orthog(all);
+    }
+
+};
+
 }
 
 #endif
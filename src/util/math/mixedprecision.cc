@@ -0,0 +1,61 @@
+//
+// BAGEL - Parallel electron correlation program.
+// Filename: mixedprecision.cc
+// Copyright (C) 2026 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// The BAGEL package is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 3, or (at your option)
+// any later version.
+//
+// The BAGEL package is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the BAGEL package; see COPYING.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+
+#include <src/util/f77.h>
+#include <src/util/math/mixedprecision.h>
+
+using namespace std;
+
+namespace bagel {
+namespace blas {
+
+vector<float> to_single(const double* a, const size_t n) {
+  return vector<float>(a, a+n);
+}
+
+
+void mixed_gemm(const char* transa, const char* transb, const int m, const int n, const int k,
+                const double alpha, const float* a, const int lda, const float* b, const int ldb,
+                const double beta, double* c, const int ldc) {
+  if (m == 0 || n == 0) return;
+  vector<float> fc(static_cast<size_t>(m)*n, 0.0f);
+  if (k)
+    sgemm_(transa, transb, m, n, k, 1.0f, a, lda, b, ldb, 0.0f, fc.data(), m);
+
+  for (int j = 0; j != n; ++j) {
+    double* cj = c + static_cast<size_t>(j)*ldc;
+    const float* fj = fc.data() + static_cast<size_t>(j)*m;
+    if (beta == 0.0) {
+      for (int i = 0; i != m; ++i)
+        cj[i] = alpha * fj[i];
+    } else {
+      for (int i = 0; i != m; ++i)
+        cj[i] = beta * cj[i] + alpha * fj[i];
+    }
+  }
+}
+
+}
+}
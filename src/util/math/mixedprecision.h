@@ -0,0 +1,68 @@
+//
+// BAGEL - Parallel electron correlation program.
+// Filename: mixedprecision.h
+// Copyright (C) 2026 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// The BAGEL package is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 3, or (at your option)
+// any later version.
+//
+// The BAGEL package is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the BAGEL package; see COPYING.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+
+#ifndef __SRC_MATH_MIXEDPRECISION_H
+#define __SRC_MATH_MIXEDPRECISION_H
+
+#include <vector>
+
+namespace bagel {
+namespace blas {
+
+// single-precision copy of n contiguous elements
+std::vector<float> to_single(const double* a, const size_t n);
+
+// C = alpha * op(A) * op(B) + beta * C with A and B in single precision; op(A) * op(B) is formed with sgemm
+// and accumulated into the double-precision C. The operands are converted once by the caller (see to_single).
+void mixed_gemm(const char* transa, const char* transb, const int m, const int n, const int k,
+                const double alpha, const float* a, const int lda, const float* b, const int ldb,
+                const double beta, double* c, const int ldc);
+
+}
+
+// Tracks the opt-in mixed-precision mode of an iterative solver: it stays on while the error is above thresh and
+// is switched off for the rest of the solve once the error drops below it. The solver owns its single-precision
+// data (e.g., FloatDF in SCF) and releases it when update() returns true.
+class MixedPrecision {
+  protected:
+    bool active_;
+    const double thresh_;
+
+  public:
+    MixedPrecision(const bool active, const double thresh) : active_(active), thresh_(thresh) { }
+
+    // returns true if the mode has been switched off in this call
+    bool update(const double error) {
+      if (!active_ || error >= thresh_) return false;
+      active_ = false;
+      return true;
+    }
+
+    bool active() const { return active_; }
+};
+
+}
+
+#endif
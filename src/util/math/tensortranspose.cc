@@ -0,0 +1,207 @@
+//
+// BAGEL - Parallel electron correlation program.
+// Filename: tensortranspose.cc
+// Copyright (C) 2026 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// The BAGEL package is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 3, or (at your option)
+// any later version.
+//
+// The BAGEL package is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the BAGEL package; see COPYING.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+
+#include <array>
+#include <complex>
+#include <numeric>
+#include <algorithm>
+#include <functional>
+#include <cassert>
+#include <src/util/math/tensortranspose.h>
+#include <src/util/taskqueue.h>
+
+using namespace std;
+
+namespace bagel {
+namespace blas {
+
+namespace {
+
+// edge of the square tiles used when the fastest index changes
+const size_t tile__ = 16;
+// tensors smaller than this are transposed by a single thread
+const size_t thread_min__ = 1lu << 15;
+
+// extents and strides after adjacent indices have been fused
+struct FusedLayout {
+  int rank;
+  array<size_t, max_transpose_rank> n;
+  array<size_t, max_transpose_rank> is;
+  array<size_t, max_transpose_rank> os;
+
+  FusedLayout(const int r, const int* dims, const int* perm) : rank(0) {
+    assert(r <= max_transpose_rank);
+    array<size_t, max_transpose_rank> ostride;
+    size_t s = 1;
+    for (int q = 0; q != r; ++q) {
+      ostride[perm[q]] = s;
+      s *= dims[perm[q]];
+    }
+    size_t istride = 1;
+    for (int p = 0; p != r; ++p) {
+      if (dims[p] == 1) continue;
+      if (rank > 0 && ostride[p] == os[rank-1]*n[rank-1]) {
+        n[rank-1] *= dims[p];
+      } else {
+        n[rank] = dims[p];
+        is[rank] = istride;
+        os[rank] = ostride[p];
+        ++rank;
+      }
+      istride *= dims[p];
+    }
+    if (rank == 0) {
+      n[0] = is[0] = os[0] = 1;
+      rank = 1;
+    }
+  }
+
+  size_t size() const { return accumulate(n.begin(), n.begin()+rank, 1lu, multiplies<size_t>()); }
+};
+
+
+template<bool accum, typename T>
+void transpose_row(const T* in, T* out, const size_t n, const T alpha, const T beta) {
+  if (accum) {
+    for (size_t i = 0; i != n; ++i)
+      out[i] = beta*out[i] + alpha*in[i];
+  } else {
+    for (size_t i = 0; i != n; ++i)
+      out[i] = alpha*in[i];
+  }
+}
+
+
+// in is n0 x nb (n0 contiguous, nb with stride isb); out is nb x n0 (nb contiguous, n0 with stride os0)
+template<bool accum, typename T>
+void transpose_tiles(const T* in, T* out, const size_t n0, const size_t nb, const size_t isb, const size_t os0,
+                     const T alpha, const T beta) {
+  T buf[tile__*tile__];
+  for (size_t j0 = 0; j0 < n0; j0 += tile__) {
+    for (size_t jb = 0; jb < nb; jb += tile__) {
+      const T* cin = in + j0 + isb*jb;
+      T* cout = out + jb + os0*j0;
+      if (j0+tile__ <= n0 && jb+tile__ <= nb) {
+        // full tiles with compile-time extents so that both passes vectorize
+        for (size_t b = 0; b != tile__; ++b)
+          for (size_t a = 0; a != tile__; ++a)
+            buf[b+tile__*a] = cin[a+isb*b];
+        for (size_t a = 0; a != tile__; ++a)
+          transpose_row<accum>(buf+tile__*a, cout+os0*a, tile__, alpha, beta);
+      } else {
+        const size_t m0 = min(tile__, n0-j0);
+        const size_t mb = min(tile__, nb-jb);
+        for (size_t b = 0; b != mb; ++b)
+          for (size_t a = 0; a != m0; ++a)
+            buf[b+tile__*a] = cin[a+isb*b];
+        for (size_t a = 0; a != m0; ++a)
+          transpose_row<accum>(buf+tile__*a, cout+os0*a, mb, alpha, beta);
+      }
+    }
+  }
+}
+
+
+// performs outer iterations [start, end) of a fused layout
+template<bool accum, typename T>
+void transpose_range(const FusedLayout& l, const T* in, T* out, const T alpha, const T beta, const size_t start, const size_t end) {
+  // index that becomes the fastest in the output
+  int b = 0;
+  while (l.os[b] != 1) ++b;
+
+  array<int, max_transpose_rank> outer;
+  int nouter = 0;
+  for (int k = 1; k != l.rank; ++k)
+    if (k != b) outer[nouter++] = k;
+
+  array<size_t, max_transpose_rank> idx;
+  size_t ioff = 0, ooff = 0, rem = start;
+  for (int m = 0; m != nouter; ++m) {
+    const int k = outer[m];
+    idx[m] = rem % l.n[k];
+    rem /= l.n[k];
+    ioff += idx[m]*l.is[k];
+    ooff += idx[m]*l.os[k];
+  }
+
+  for (size_t it = start; it != end; ++it) {
+    if (b == 0)
+      transpose_row<accum>(in+ioff, out+ooff, l.n[0], alpha, beta);
+    else
+      transpose_tiles<accum>(in+ioff, out+ooff, l.n[0], l.n[b], l.is[b], l.os[0], alpha, beta);
+
+    for (int m = 0; m != nouter; ++m) {
+      const int k = outer[m];
+      ioff += l.is[k];
+      ooff += l.os[k];
+      if (++idx[m] != l.n[k]) break;
+      ioff -= l.n[k]*l.is[k];
+      ooff -= l.n[k]*l.os[k];
+      idx[m] = 0;
+    }
+  }
+}
+
+}
+
+
+template<typename T>
+void tensor_transpose(const T* in, T* out, const int rank, const int* dims, const int* perm, const T alpha, const T beta, const int nthreads) {
+  const FusedLayout l(rank, dims, perm);
+  // nothing to do for empty tensors (e.g., an empty orbital space); no index has an output stride of one
+  if (l.size() == 0) return;
+  const bool accum = beta != static_cast<T>(0.0);
+
+  int b = 0;
+  while (l.os[b] != 1) ++b;
+  const size_t nrow = l.n[0] * (b == 0 ? 1 : l.n[b]);
+  const size_t nouter = l.size() / nrow;
+
+  auto run = [&](const size_t start, const size_t end) {
+    if (accum) transpose_range<true>(l, in, out, alpha, beta, start, end);
+    else       transpose_range<false>(l, in, out, alpha, beta, start, end);
+  };
+
+  if (nthreads > 1 && nouter > 1 && l.size() >= thread_min__) {
+    const size_t nchunk = min(nouter, static_cast<size_t>(nthreads)*4);
+    TaskQueue<function<void()>> tasks(nchunk);
+    for (size_t i = 0; i != nchunk; ++i) {
+      const size_t start = nouter*i/nchunk;
+      const size_t end = nouter*(i+1)/nchunk;
+      tasks.emplace_back([&run, start, end]() { run(start, end); });
+    }
+    tasks.compute(nthreads);
+  } else {
+    run(0, nouter);
+  }
+}
+
+
+template void tensor_transpose(const double*, double*, const int, const int*, const int*, const double, const double, const int);
+template void tensor_transpose(const complex<double>*, complex<double>*, const int, const int*, const int*,
+                               const complex<double>, const complex<double>, const int);
+
+}
+}
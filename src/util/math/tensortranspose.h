@@ -0,0 +1,51 @@
+//
+// BAGEL - Parallel electron correlation program.
+// Filename: tensortranspose.h
+// Copyright (C) 2026 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// The BAGEL package is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 3, or (at your option)
+// any later version.
+//
+// The BAGEL package is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the BAGEL package; see COPYING.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+
+
+#ifndef __SRC_MATH_TENSORTRANSPOSE_H
+#define __SRC_MATH_TENSORTRANSPOSE_H
+
+namespace bagel {
+namespace blas {
+
+// General transposition of a dense tensor with fused scaling:
+//   out(perm) = beta * out(perm) + alpha * in
+// dims are the extents of "in" with the first index running fastest; the q-th (fastest first) index
+// of "out" is the perm[q]-th index of "in" (the convention of sort_indices in prim_op.h).
+// Indices that remain adjacent are fused; the rest is done either by contiguous rows or by cache-blocked
+// 2D tiles. When nthreads > 1 the outer loops of large tensors are distributed over threads.
+// When beta is zero, "out" is not read.
+const static int max_transpose_rank = 10;
+
+template<typename T>
+void tensor_transpose(const T* in, T* out, const int rank, const int* dims, const int* perm,
+                      const T alpha = 1.0, const T beta = 0.0, const int nthreads = 1);
+
+// instantiated for double and std::complex<double> in tensortranspose.cc
+
+}
+}
+
+#endif
@@ -0,0 +1,91 @@
+//
+// BAGEL - Parallel electron correlation program.
+// Filename: testcode/transpose/main.cc
+// Copyright (C) 2026 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// The BAGEL package is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 3, or (at your option)
+// any later version.
+//
+// The BAGEL package is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the BAGEL package; see COPYING.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+
+// Timings of blas::tensor_transpose against the element-wise loop that sort_indices used before.
+// Not part of the test suite; see make.sh.
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <numeric>
+#include <functional>
+#include <src/util/math/tensortranspose.h>
+#include <src/util/parallel/resources.h>
+#include <src/util/parallel/mpi_interface.h>
+#include <src/util/timer.h>
+
+using namespace std;
+using namespace bagel;
+
+Resources b(8);
+Resources* bagel::resources__ = &b;
+static MPI_Interface c;
+MPI_Interface* bagel::mpi__ = &c;
+
+void transpose_reference(const double* in, double* out, const vector<int>& dims, const vector<int>& perm) {
+  const int rank = dims.size();
+  vector<size_t> ostride(rank);
+  size_t size = 1;
+  for (int q = 0; q != rank; ++q) {
+    ostride[perm[q]] = size;
+    size *= dims[perm[q]];
+  }
+  vector<int> idx(rank, 0);
+  for (size_t iall = 0; iall != size; ++iall) {
+    size_t ib = 0;
+    for (int p = 0; p != rank; ++p)
+      ib += idx[p]*ostride[p];
+    out[ib] += in[iall];
+    for (int p = 0; p != rank; ++p) {
+      if (++idx[p] != dims[p]) break;
+      idx[p] = 0;
+    }
+  }
+}
+
+void speedup(const vector<int>& dims, const vector<int>& perm, const int nthreads) {
+  const size_t size = accumulate(dims.begin(), dims.end(), 1lu, multiplies<size_t>());
+  vector<double> in(size, 1.0), out(size, 0.0);
+  const int nrepeat = 5;
+  Timer timer;
+  for (int i = 0; i != nrepeat; ++i)
+    transpose_reference(in.data(), out.data(), dims, perm);
+  const double tref = timer.tick();
+  for (int i = 0; i != nrepeat; ++i)
+    blas::tensor_transpose(in.data(), out.data(), dims.size(), dims.data(), perm.data(), 1.0, 1.0, nthreads);
+  const double tnew = timer.tick();
+  cout << "  rank " << dims.size() << " permutation (";
+  for (auto& i : perm) cout << " " << i;
+  cout << " ) : " << setprecision(3) << fixed << tref << " sec (element-wise), " << tnew << " sec (blocked, "
+       << nthreads << " threads), speedup " << setprecision(2) << tref / max(tnew, 1.0e-9) << endl;
+}
+
+int main(int argc, char** argv) {
+  const int nthreads = argc > 1 ? atoi(argv[1]) : 1;
+  speedup({40, 40, 40, 40}, {2, 3, 0, 1}, nthreads);
+  speedup({12, 12, 12, 12, 12, 12}, {0, 2, 4, 1, 3, 5}, nthreads);
+  speedup({6, 6, 6, 6, 6, 6, 6, 6}, {1, 0, 3, 2, 5, 4, 7, 6}, nthreads);
+  return 0;
+}
@@ -0,0 +1,5 @@
+#!/bin/sh
+
+# BAGEL_BUILD points to a configured build tree of BAGEL
+g++ -O3 -std=c++11 -I$HOME/develop/BAGEL -I$BAGEL_BUILD main.cc -L$BAGEL_BUILD/src/.libs -lbagel -lblas -llapack -lpthread -o run
+chmod 700 run
@@ -48,6 +48,9 @@ MPI_Interface::MPI_Interface()
 
   MPI_Comm_rank(MPI_COMM_WORLD, &rank_);
   MPI_Comm_size(MPI_COMM_WORLD, &size_);
+  world_rank_ = rank_;
+  world_size_ = size_;
+  mpi_comm_ = MPI_COMM_WORLD;
 #ifdef HAVE_SCALAPACK
   tie(nprow_, npcol_) = numgrid(size());
   if (rank() == 0)
@@ -82,8 +85,8 @@ MPI_Interface::MPI_Interface()
     tag_ub_ = *get_val;
   }
 #else
-  rank_ = 0;
-  size_ = 1;
+  rank_ = world_rank_ = 0;
+  size_ = world_size_ = 1;
 #endif
 }
 
@@ -102,7 +105,7 @@ MPI_Interface::~MPI_Interface() {
 
 void MPI_Interface::barrier() const {
 #ifdef HAVE_MPI_H
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(mpi_comm_);
 #endif
 }
 
@@ -129,14 +132,15 @@ void MPI_Interface::soft_barrier() {
 
 void MPI_Interface::reduce(double* a, const size_t size, const int root) const {
 #ifdef HAVE_MPI_H
-  MPI_Reduce(MPI_IN_PLACE, static_cast<void*>(a), size, MPI_DOUBLE, MPI::SUM, root, MPI_COMM_WORLD);
+  // MPI_IN_PLACE is only valid on the root
+  MPI_Reduce(rank_ == root ? MPI_IN_PLACE : static_cast<void*>(a), static_cast<void*>(a), size, MPI_DOUBLE, MPI_SUM, root, mpi_comm_);
 #endif
 }
 
 
 void MPI_Interface::reduce_scatter(double* sendbuf, double* recvbuf, int* recvcnts) const {
 #ifdef HAVE_MPI_H
-  MPI_Reduce_scatter(sendbuf, recvbuf, recvcnts, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  MPI_Reduce_scatter(sendbuf, recvbuf, recvcnts, MPI_DOUBLE, MPI_SUM, mpi_comm_);
 #endif
 }
 
@@ -144,7 +148,7 @@ int MPI_Interface::ireduce_scatter(double* sendbuf, double* recvbuf, int* recvcn
 #ifdef HAVE_MPI_H
   vector<MPI_Request> rq;
   MPI_Request c;
-  MPI_Ireduce_scatter(sendbuf, recvbuf, recvcnts, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD, &c);
+  MPI_Ireduce_scatter(sendbuf, recvbuf, recvcnts, MPI_DOUBLE, MPI_SUM, mpi_comm_, &c);
   rq.push_back(c);
 #endif
   lock_guard<mutex> lock(mpimutex_);
@@ -158,21 +162,21 @@ int MPI_Interface::ireduce_scatter(double* sendbuf, double* recvbuf, int* recvcn
 
 void MPI_Interface::allreduce(double* a, const size_t size) const {
 #ifdef HAVE_MPI_H
-  MPI_Allreduce(MPI_IN_PLACE, static_cast<void*>(a), size, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  MPI_Allreduce(MPI_IN_PLACE, static_cast<void*>(a), size, MPI_DOUBLE, MPI_SUM, mpi_comm_);
 #endif
 }
 
 
 void MPI_Interface::allreduce(int* a, const size_t size) const {
 #ifdef HAVE_MPI_H
-  MPI_Allreduce(MPI_IN_PLACE, static_cast<void*>(a), size, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+  MPI_Allreduce(MPI_IN_PLACE, static_cast<void*>(a), size, MPI_INT, MPI_SUM, mpi_comm_);
 #endif
 }
 
 
 void MPI_Interface::allreduce(complex<double>* a, const size_t size) const {
 #ifdef HAVE_MPI_H
-  MPI_Allreduce(MPI_IN_PLACE, static_cast<void*>(a), size, MPI_DOUBLE_COMPLEX, MPI_SUM, MPI_COMM_WORLD);
+  MPI_Allreduce(MPI_IN_PLACE, static_cast<void*>(a), size, MPI_DOUBLE_COMPLEX, MPI_SUM, mpi_comm_);
 #endif
 }
 
@@ -182,7 +186,7 @@ int MPI_Interface::iallreduce(size_t* a, const size_t size) {
 #ifdef HAVE_MPI_H
   vector<MPI_Request> rq;
   MPI_Request c;
-  MPI_Iallreduce(MPI_IN_PLACE, static_cast<void*>(a), size, MPI_LONG_LONG, MPI_SUM, MPI_COMM_WORLD, &c);
+  MPI_Iallreduce(MPI_IN_PLACE, static_cast<void*>(a), size, MPI_LONG_LONG, MPI_SUM, mpi_comm_, &c);
   rq.push_back(c);
 #endif
   lock_guard<mutex> lock(mpimutex_);
@@ -219,21 +223,21 @@ void MPI_Interface::soft_allreduce(size_t* a, const size_t size) {
 void MPI_Interface::broadcast(size_t* a, const size_t size, const int root) const {
 #ifdef HAVE_MPI_H
   static_assert(sizeof(size_t) == sizeof(long long), "size_t is assumed to be the same size as long long");
-  MPI_Bcast(static_cast<void*>(a), size, MPI_LONG_LONG, root, MPI_COMM_WORLD);
+  MPI_Bcast(static_cast<void*>(a), size, MPI_LONG_LONG, root, mpi_comm_);
 #endif
 }
 
 
 void MPI_Interface::broadcast(double* a, const size_t size, const int root) const {
 #ifdef HAVE_MPI_H
-  MPI_Bcast(static_cast<void*>(a), size, MPI_DOUBLE, root, MPI_COMM_WORLD);
+  MPI_Bcast(static_cast<void*>(a), size, MPI_DOUBLE, root, mpi_comm_);
 #endif
 }
 
 
 void MPI_Interface::broadcast(complex<double>* a, const size_t size, const int root) const {
 #ifdef HAVE_MPI_H
-  MPI_Bcast(static_cast<void*>(a), size, MPI_DOUBLE_COMPLEX, root, MPI_COMM_WORLD);
+  MPI_Bcast(static_cast<void*>(a), size, MPI_DOUBLE_COMPLEX, root, mpi_comm_);
 #endif
 }
 
@@ -242,7 +246,7 @@ int MPI_Interface::ibroadcast(double* a, const size_t size, const int root) {
 #ifdef HAVE_MPI_H
   vector<MPI_Request> rq;
   MPI_Request c;
-  MPI_Ibcast(static_cast<void*>(a), size, MPI_DOUBLE, root, MPI_COMM_WORLD, &c);
+  MPI_Ibcast(static_cast<void*>(a), size, MPI_DOUBLE, root, mpi_comm_, &c);
   rq.push_back(c);
 #endif
   lock_guard<mutex> lock(mpimutex_);
@@ -258,7 +262,7 @@ void MPI_Interface::broadcast_force(const double* a, const size_t size, const in
 #ifdef HAVE_MPI_H
   // sometimes we need to broadcast const objects for consistency...
   double* aa = const_cast<double*>(a);
-  MPI_Bcast(static_cast<void*>(aa), size, MPI_DOUBLE, root, MPI_COMM_WORLD);
+  MPI_Bcast(static_cast<void*>(aa), size, MPI_DOUBLE, root, mpi_comm_);
 #endif
 }
 
@@ -266,7 +270,7 @@ void MPI_Interface::broadcast_force(const double* a, const size_t size, const in
 void MPI_Interface::allgather(const double* send, const size_t ssize, double* rec, const size_t rsize) const {
 #ifdef HAVE_MPI_H
   // I hate const_cast. Blame the MPI C binding
-  MPI_Allgather(const_cast<void*>(static_cast<const void*>(send)), ssize, MPI_DOUBLE, static_cast<void*>(rec), rsize, MPI_DOUBLE, MPI_COMM_WORLD);
+  MPI_Allgather(const_cast<void*>(static_cast<const void*>(send)), ssize, MPI_DOUBLE, static_cast<void*>(rec), rsize, MPI_DOUBLE, mpi_comm_);
 #else
   assert(ssize == rsize);
   copy_n(send, ssize, rec);
@@ -278,7 +282,7 @@ void MPI_Interface::allgather(const size_t* send, const size_t ssize, size_t* re
 #ifdef HAVE_MPI_H
   static_assert(sizeof(size_t) == sizeof(long long), "size_t is assumed to be the same size as long long");
   // I hate const_cast. Blame the MPI C binding
-  MPI_Allgather(const_cast<void*>(static_cast<const void*>(send)), ssize, MPI_LONG_LONG, static_cast<void*>(rec), rsize, MPI_LONG_LONG, MPI_COMM_WORLD);
+  MPI_Allgather(const_cast<void*>(static_cast<const void*>(send)), ssize, MPI_LONG_LONG, static_cast<void*>(rec), rsize, MPI_LONG_LONG, mpi_comm_);
 #else
   assert(ssize == rsize);
   copy_n(send, ssize, rec);
@@ -289,7 +293,7 @@ void MPI_Interface::allgather(const size_t* send, const size_t ssize, size_t* re
 void MPI_Interface::allgather(const int* send, const size_t ssize, int* rec, const size_t rsize) const {
 #ifdef HAVE_MPI_H
   // I hate const_cast. Blame the MPI C binding
-  MPI_Allgather(const_cast<void*>(static_cast<const void*>(send)), ssize, MPI_INT, static_cast<void*>(rec), rsize, MPI_INT, MPI_COMM_WORLD);
+  MPI_Allgather(const_cast<void*>(static_cast<const void*>(send)), ssize, MPI_INT, static_cast<void*>(rec), rsize, MPI_INT, mpi_comm_);
 #else
   assert(ssize == rsize);
   copy_n(send, ssize, rec);
@@ -305,7 +309,7 @@ int MPI_Interface::request_send(const double* sbuf, const size_t size, const int
   for (int i = 0; i != nbatch; ++i) {
     MPI_Request c;
     // I hate const_cast. Blame the MPI C binding
-    MPI_Isend(const_cast<double*>(sbuf+i*bsize), (i+1 == nbatch ? size-i*bsize : bsize), MPI_DOUBLE, dest, tag, MPI_COMM_WORLD, &c);
+    MPI_Isend(const_cast<double*>(sbuf+i*bsize), (i+1 == nbatch ? size-i*bsize : bsize), MPI_DOUBLE, dest, tag, mpi_comm_, &c);
     rq.push_back(c);
   }
 #endif
@@ -326,7 +330,7 @@ int MPI_Interface::request_send(const complex<double>* sbuf, const size_t size,
   for (int i = 0; i != nbatch; ++i) {
     MPI_Request c;
     // I hate const_cast. Blame the MPI C binding
-    MPI_Isend(const_cast<complex<double>*>(sbuf+i*bsize), (i+1 == nbatch ? size-i*bsize : bsize), MPI_DOUBLE_COMPLEX, dest, tag, MPI_COMM_WORLD, &c);
+    MPI_Isend(const_cast<complex<double>*>(sbuf+i*bsize), (i+1 == nbatch ? size-i*bsize : bsize), MPI_DOUBLE_COMPLEX, dest, tag, mpi_comm_, &c);
     rq.push_back(c);
   }
 #endif
@@ -348,7 +352,7 @@ int MPI_Interface::request_send(const size_t* sbuf, const size_t size, const int
   for (int i = 0; i != nbatch; ++i) {
     MPI_Request c;
     // I hate const_cast. Blame the MPI C binding
-    MPI_Isend(const_cast<size_t*>(sbuf+i*bsize), (i+1 == nbatch ? size-i*bsize : bsize), MPI_LONG_LONG, dest, tag, MPI_COMM_WORLD, &c);
+    MPI_Isend(const_cast<size_t*>(sbuf+i*bsize), (i+1 == nbatch ? size-i*bsize : bsize), MPI_LONG_LONG, dest, tag, mpi_comm_, &c);
     rq.push_back(c);
   }
 #endif
@@ -369,7 +373,7 @@ int MPI_Interface::request_recv(double* rbuf, const size_t size, const int origi
   const int nbatch = (size-1)/bsize  + 1;
   for (int i = 0; i != nbatch; ++i) {
     MPI_Request c;
-    MPI_Irecv(rbuf+i*bsize, (i+1 == nbatch ? size-i*bsize : bsize), MPI_DOUBLE, (origin == -1 ? MPI_ANY_SOURCE : origin), (tag==-1 ? MPI_ANY_TAG : tag), MPI_COMM_WORLD, &c);
+    MPI_Irecv(rbuf+i*bsize, (i+1 == nbatch ? size-i*bsize : bsize), MPI_DOUBLE, (origin == -1 ? MPI_ANY_SOURCE : origin), (tag==-1 ? MPI_ANY_TAG : tag), mpi_comm_, &c);
     rq.push_back(c);
   }
 #endif
@@ -389,7 +393,7 @@ int MPI_Interface::request_recv(complex<double>* rbuf, const size_t size, const
   const int nbatch = (size-1)/bsize  + 1;
   for (int i = 0; i != nbatch; ++i) {
     MPI_Request c;
-    MPI_Irecv(rbuf+i*bsize, (i+1 == nbatch ? size-i*bsize : bsize), MPI_DOUBLE_COMPLEX, (origin == -1 ? MPI_ANY_SOURCE : origin), (tag==-1 ? MPI_ANY_TAG : tag), MPI_COMM_WORLD, &c);
+    MPI_Irecv(rbuf+i*bsize, (i+1 == nbatch ? size-i*bsize : bsize), MPI_DOUBLE_COMPLEX, (origin == -1 ? MPI_ANY_SOURCE : origin), (tag==-1 ? MPI_ANY_TAG : tag), mpi_comm_, &c);
     rq.push_back(c);
   }
 #endif
@@ -409,7 +413,7 @@ int MPI_Interface::request_recv(size_t* rbuf, const size_t size, const int origi
   const int nbatch = (size-1)/bsize  + 1;
   for (int i = 0; i != nbatch; ++i) {
     MPI_Request c;
-    MPI_Irecv(rbuf+i*bsize, (i+1 == nbatch ? size-i*bsize : bsize), MPI_LONG_LONG, (origin == -1 ? MPI_ANY_SOURCE : origin), (tag==-1 ? MPI_ANY_TAG : tag), MPI_COMM_WORLD, &c);
+    MPI_Irecv(rbuf+i*bsize, (i+1 == nbatch ? size-i*bsize : bsize), MPI_LONG_LONG, (origin == -1 ? MPI_ANY_SOURCE : origin), (tag==-1 ? MPI_ANY_TAG : tag), mpi_comm_, &c);
     rq.push_back(c);
   }
 #endif
@@ -460,6 +464,68 @@ bool MPI_Interface::test(const int rq) {
 }
 
 
+// process groups
+
+#if defined(HAVE_MPI_H) && defined(HAVE_SCALAPACK)
+extern "C" {
+  // BLACS C interface, used to build process grids on sub-communicators
+  int Csys2blacs_handle(MPI_Comm);
+  void Cfree_blacs_system_handle(int);
+  void Cblacs_gridinit(int*, const char*, int, int);
+}
+#endif
+
+int MPI_Interface::split(const int n) {
+  if (n < 1 || n > size_)
+    throw runtime_error("MPI_Interface::split: the number of groups should be between 1 and the number of processes");
+  // the first (size_ % n) groups have one more process
+  const int large = size_ / n + 1;
+  const int nlarge = size_ % n;
+  const int group = rank_ < nlarge*large ? rank_ / large : nlarge + (rank_ - nlarge*large) / (large-1);
+#ifdef HAVE_MPI_H
+  assert(request_.empty());
+  mpi_comm_old_.emplace_back(mpi_comm_, array<int,7>{{rank_, size_, nprow_, npcol_, context_, myprow_, mypcol_}});
+  MPI_Comm newcomm;
+  MPI_Comm_split(mpi_comm_, group, rank_, &newcomm);
+  mpi_comm_ = newcomm;
+  MPI_Comm_rank(mpi_comm_, &rank_);
+  MPI_Comm_size(mpi_comm_, &size_);
+#ifdef HAVE_SCALAPACK
+  tie(nprow_, npcol_) = numgrid(size_);
+  const int handle = Csys2blacs_handle(mpi_comm_);
+  context_ = handle;
+  Cblacs_gridinit(&context_, "R", nprow_, npcol_);
+  blacs_gridinfo_(context_, nprow_, npcol_, myprow_, mypcol_);
+  Cfree_blacs_system_handle(handle);
+#endif
+#endif
+  return group;
+}
+
+
+void MPI_Interface::merge() {
+#ifdef HAVE_MPI_H
+  if (mpi_comm_old_.empty())
+    throw logic_error("MPI_Interface::merge called without split");
+  assert(request_.empty());
+#ifdef HAVE_SCALAPACK
+  blacs_gridexit_(context_);
+#endif
+  MPI_Comm_free(&mpi_comm_);
+  mpi_comm_ = mpi_comm_old_.back().first;
+  const array<int,7>& state = mpi_comm_old_.back().second;
+  rank_    = state[0];
+  size_    = state[1];
+  nprow_   = state[2];
+  npcol_   = state[3];
+  context_ = state[4];
+  myprow_  = state[5];
+  mypcol_  = state[6];
+  mpi_comm_old_.pop_back();
+#endif
+}
+
+
 // ScaLapack interfaces
 
 pair<int,int> MPI_Interface::numroc(const int ndim, const int ncol) const {
@@ -32,6 +32,7 @@
 #include <complex>
 #include <mutex>
 #include <vector>
+#include <array>
 #include <map>
 #ifdef HAVE_MPI_H
  #include <mpi.h>
@@ -41,6 +42,8 @@ namespace bagel {
 
 class MPI_Interface {
   protected:
+    int world_rank_;
+    int world_size_;
     int rank_;
     int size_;
 
@@ -64,6 +67,12 @@ class MPI_Interface {
     // MPI's internal variables
     int tag_ub_;
 
+#ifdef HAVE_MPI_H
+    // communicator of the current process group, and those (with rank, size and BLACS grid) that split() has replaced
+    MPI_Comm mpi_comm_;
+    std::vector<std::pair<MPI_Comm, std::array<int,7>>> mpi_comm_old_;
+#endif
+
   public:
     MPI_Interface();
     ~MPI_Interface();
@@ -72,6 +81,15 @@ class MPI_Interface {
     int size() const { return size_; }
     bool last() const { return rank() == size()-1; }
 
+    int world_rank() const { return world_rank_; }
+    int world_size() const { return world_size_; }
+
+    // Splits the current processes into n groups of contiguous ranks (the first size() % n groups have one more process).
+    // Until merge() is called, rank(), size(), the collective functions and the BLACS grid refer to the group.
+    // Returns the index of the group to which this process belongs. Splits can be nested.
+    int split(const int n);
+    void merge();
+
     // collective functions
     // barrier
     void barrier() const;
@@ -32,17 +32,17 @@ using namespace std;
 using namespace bagel;
 
 Process::Process() : print_level_(3) {
-  if (mpi__->rank() != 0) {
+  if (mpi__->world_rank() != 0) {
     cout_orig = cout.rdbuf();
     cout.rdbuf(ss_.rdbuf());
   }
 }
 
 Process::~Process() {
-  if (mpi__->rank() != 0)
+  if (mpi__->world_rank() != 0)
     cout.rdbuf(cout_orig);
 }
 
 
-void Process::cout_on()  const { if (mpi__->rank() != 0) cout.rdbuf(cout_orig); }
-void Process::cout_off() const { if (mpi__->rank() != 0) cout.rdbuf(ss_.rdbuf()); }
+void Process::cout_on()  const { if (mpi__->world_rank() != 0) cout.rdbuf(cout_orig); }
+void Process::cout_off() const { if (mpi__->world_rank() != 0) cout.rdbuf(ss_.rdbuf()); }
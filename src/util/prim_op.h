@@ -32,15 +32,39 @@
 #include <vector>
 #include <cassert>
 #include <src/util/math/algo.h>
+#include <src/util/math/tensortranspose.h>
 #include <src/util/f77.h>
 
 #define USE_SPECIALIZATION_SORT_INDICES
+// generic permutations are done by blas::tensor_transpose for double and complex<double>
+#define USE_TRANSPOSE_ENGINE_SORT_INDICES
 
 namespace bagel {
 namespace {
 
+template<typename T>
+struct sort_engine {
+  static bool apply(const T*, T*, const int, const int*, const int*, const T, const T) { return false; }
+};
+template<>
+struct sort_engine<double> {
+  static bool apply(const double* u, double* s, const int r, const int* d, const int* p, const double f, const double a) {
+    blas::tensor_transpose(u, s, r, d, p, f, a);
+    return true;
+  }
+};
+template<>
+struct sort_engine<std::complex<double>> {
+  static bool apply(const std::complex<double>* u, std::complex<double>* s, const int r, const int* d, const int* p,
+                    const std::complex<double> f, const std::complex<double> a) {
+    blas::tensor_transpose(u, s, r, d, p, f, a);
+    return true;
+  }
+};
+
+
 template <int an, int ad, int fn, int fd, class T>
-void sort_indices(const std::unique_ptr<T[]>& unsorted, std::unique_ptr<T[]>& sorted) {
+void sort_indices(const T* unsorted, T* sorted) {
   const T afac = static_cast<T>(an) /static_cast<T>(ad);
   const T factor = static_cast<T>(fn) /static_cast<T>(fd);
   if (an != 0)
@@ -50,9 +74,14 @@ void sort_indices(const std::unique_ptr<T[]>& unsorted, std::unique_ptr<T[]>& so
 }
 
 
+template <int an, int ad, int fn, int fd, class T>
+void sort_indices(const std::unique_ptr<T[]>& unsorted, std::unique_ptr<T[]>& sorted) {
+  sort_indices<an,ad,fn,fd>(unsorted.get(), sorted.get());
+}
+
+
 template <int i, int an, int ad, int fn, int fd, class T>
-void sort_indices(const std::unique_ptr<T[]>& unsorted, std::unique_ptr<T[]>& sorted,
-                         const int a) { // according to unsorted
+void sort_indices(const T* unsorted, T* sorted, const int a) { // according to unsorted
   static_assert(ad != 0 && fd != 0, "sort_indices, prefactor");
   const T afac = static_cast<T>(an) /static_cast<T>(ad);
   const T factor = static_cast<T>(fn) /static_cast<T>(fd);
@@ -72,11 +101,24 @@ void sort_indices(const std::unique_ptr<T[]>& unsorted, std::unique_ptr<T[]>& so
 }
 
 
+template <int i, int an, int ad, int fn, int fd, class T>
+void sort_indices(const std::unique_ptr<T[]>& unsorted, std::unique_ptr<T[]>& sorted, const int a) {
+  sort_indices<i,an,ad,fn,fd>(unsorted.get(), sorted.get(), a);
+}
+
+
 template <int i, int j, int an, int ad, int fn, int fd, class T>
 void sort_indices(const T* unsorted, T* sorted, const int b, const int a) { // according to unsorted
   static_assert(ad != 0 && fd != 0, "sort_indices, prefactor");
   const T afac = static_cast<T>(an) /static_cast<T>(ad);
   const T factor = static_cast<T>(fn) /static_cast<T>(fd);
+#ifdef USE_TRANSPOSE_ENGINE_SORT_INDICES
+  {
+    const int dims[] = {b, a};
+    const int perm[] = {i, j};
+    if (sort_engine<T>::apply(unsorted, sorted, 2, dims, perm, factor, afac)) return;
+  }
+#endif
   {
     int id[2];
     int jd[2] = {b, a};
@@ -137,6 +179,13 @@ void sort_indices(const T* const unsorted, T* const sorted,
   static_assert(ad != 0 && fd != 0, "sort_indices, prefactor");
   const T afac = static_cast<T>(an) /static_cast<T>(ad);
   const T factor = static_cast<T>(fn) /static_cast<T>(fd);
+#ifdef USE_TRANSPOSE_ENGINE_SORT_INDICES
+  {
+    const int dims[] = {d, c, b};
+    const int perm[] = {i, j, k};
+    if (sort_engine<T>::apply(unsorted, sorted, 3, dims, perm, factor, afac)) return;
+  }
+#endif
   int id[3];
   int jd[3] = {d, c, b};
 
@@ -211,6 +260,13 @@ void sort_indices(const T* unsorted, T* sorted,
   static_assert(ad != 0 && fd != 0, "sort_indices, prefactor");
   const T afac = static_cast<T>(an) /static_cast<T>(ad);
   const T factor = static_cast<T>(fn) /static_cast<T>(fd);
+#ifdef USE_TRANSPOSE_ENGINE_SORT_INDICES
+  {
+    const int dims[] = {d, c, b, a};
+    const int perm[] = {i, j, k, l};
+    if (sort_engine<T>::apply(unsorted, sorted, 4, dims, perm, factor, afac)) return;
+  }
+#endif
   int id[4];
   int jd[4] = {d, c, b, a};
 
@@ -311,6 +367,13 @@ void sort_indices(const T* unsorted, T* sorted,
   static_assert(ad != 0 && fd != 0, "sort_indices, prefactor");
   const T afac = static_cast<T>(an) /static_cast<T>(ad);
   const T factor = static_cast<T>(fn) /static_cast<T>(fd);
+#ifdef USE_TRANSPOSE_ENGINE_SORT_INDICES
+  {
+    const int dims[] = {e, d, c, b, a};
+    const int perm[] = {i, j, k, l, m};
+    if (sort_engine<T>::apply(unsorted, sorted, 5, dims, perm, factor, afac)) return;
+  }
+#endif
   int id[5];
   int jd[5] = {e, d, c, b, a};
 
@@ -351,6 +414,13 @@ void sort_indices(const T* unsorted, T* sorted,
   static_assert(ad != 0 && fd != 0, "sort_indices, prefactor");
   const T afac = static_cast<T>(an) /static_cast<T>(ad);
   const T factor = static_cast<T>(fn) /static_cast<T>(fd);
+#ifdef USE_TRANSPOSE_ENGINE_SORT_INDICES
+  {
+    const int dims[] = {f, e, d, c, b, a};
+    const int perm[] = {i, j, k, l, m, n};
+    if (sort_engine<T>::apply(unsorted, sorted, 6, dims, perm, factor, afac)) return;
+  }
+#endif
   int id[6];
   int jd[6] = {f, e, d, c, b, a};
 
@@ -394,6 +464,13 @@ void sort_indices(const T* unsorted, T* sorted,
   static_assert(ad != 0 && fd != 0, "sort_indices, prefactor");
   const T afac = static_cast<T>(an) /static_cast<T>(ad);
   const T factor = static_cast<T>(fn) /static_cast<T>(fd);
+#ifdef USE_TRANSPOSE_ENGINE_SORT_INDICES
+  {
+    const int dims[] = {g, f, e, d, c, b, a};
+    const int perm[] = {i, j, k, l, m, n, o};
+    if (sort_engine<T>::apply(unsorted, sorted, 7, dims, perm, factor, afac)) return;
+  }
+#endif
   int id[7];
   int jd[7] = {g, f, e, d, c, b, a};
 
@@ -472,6 +549,13 @@ void sort_indices(const T* unsorted, T* sorted,
   static_assert(ad != 0 && fd != 0, "sort_indices, prefactor");
   const T afac = static_cast<T>(an) /static_cast<T>(ad);
   const T factor = static_cast<T>(fn) /static_cast<T>(fd);
+#ifdef USE_TRANSPOSE_ENGINE_SORT_INDICES
+  {
+    const int dims[] = {h, g, f, e, d, c, b, a};
+    const int perm[] = {i, j, k, l, m, n, o, p};
+    if (sort_engine<T>::apply(unsorted, sorted, 8, dims, perm, factor, afac)) return;
+  }
+#endif
   int id[8];
   int jd[8] = {h, g, f, e, d, c, b, a};
 
@@ -538,6 +622,13 @@ void sort_indices(const T* unsorted, T* sorted,
   static_assert(ad != 0 && fd != 0, "sort_indices, prefactor");
   const T afac = static_cast<T>(an) /static_cast<T>(ad);
   const T factor = static_cast<T>(fn) /static_cast<T>(fd);
+#ifdef USE_TRANSPOSE_ENGINE_SORT_INDICES
+  {
+    const int dims[] = {ia, h, g, f, e, d, c, b, a};
+    const int perm[] = {i, j, k, l, m, n, o, p, q};
+    if (sort_engine<T>::apply(unsorted, sorted, 9, dims, perm, factor, afac)) return;
+  }
+#endif
   int id[9];
   int jd[9] = {ia, h, g, f, e, d, c, b, a};
 
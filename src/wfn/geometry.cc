@@ -25,6 +25,7 @@
 
 
 #include <src/wfn/geometry.h>
+#include <src/df/cholesky.h>
 #include <src/df/complexdf.h>
 #include <src/integral/rys/eribatch.h>
 #include <src/integral/rys/smalleribatch.h>
@@ -50,6 +51,9 @@ Geometry::Geometry(shared_ptr<const PTree> geominfo) : magnetism_(false) {
 
   schwarz_thresh_ = geominfo->get<double>("schwarz_thresh", 1.0e-12);
   overlap_thresh_ = geominfo->get<double>("thresh_overlap", 1.0e-8);
+  // the ERIs are Cholesky decomposed instead of being fitted with an auxiliary basis
+  if (geominfo->get<bool>("cholesky", false))
+    cholesky_thresh_ = geominfo->get<double>("cholesky_thresh", 1.0e-6);
 
   // symmetry
   symmetry_ = to_lower(geominfo->get<string>("symmetry", "c1"));
@@ -136,7 +140,14 @@ void Geometry::common_init2(const bool print, const double thresh, const bool no
 
   if (london_ || nonzero_magnetic_field()) init_magnetism();
 
-  if (!auxfile_.empty() && !nodf) {
+  if (cholesky() && !magnetism_ && !nodf) {
+    cout << "  Since Cholesky decomposition is requested, we compute Cholesky vectors of the ERIs:" << endl;
+    Timer timer;
+    compute_integrals(thresh);
+    cout << "    o Being stored without compression. Storage requirement is "
+         << setprecision(3) << df_->naux()*nbasis()*nbasis()*8.e-9 << " GB" << endl;
+    cout << "        elapsed time:  " << setw(10) << setprecision(2) << timer.tick() << " sec." << endl << endl;
+  } else if (!auxfile_.empty() && !nodf) {
     if (print) cout << "  Number of auxiliary basis functions: " << setw(8) << naux() << endl << endl;
     cout << "  Since a DF basis is specified, we compute 2- and 3-index integrals:" << endl;
     const double scale = magnetism_ ? 2.0 : 1.0;
@@ -146,6 +157,9 @@ void Geometry::common_init2(const bool print, const double thresh, const bool no
     compute_integrals(thresh);
     cout << "        elapsed time:  " << setw(10) << setprecision(2) << timer.tick() << " sec." << endl << endl;
   }
+  // the number of Cholesky vectors plays the role of the auxiliary basis size
+  if (cholesky() && !magnetism_ && df_)
+    naux_ = df_->naux();
 
   // symmetry set-up
   plist_ = make_shared<Petite>(atoms_, symmetry_);
@@ -165,7 +179,7 @@ void Geometry::common_init2(const bool print, const double thresh, const bool no
 
 // suitable for geometry updates in optimization
 Geometry::Geometry(const Geometry& o, shared_ptr<const Matrix> displ, shared_ptr<const PTree> geominfo, const bool rotate, const bool nodf)
-  : schwarz_thresh_(o.schwarz_thresh_), magnetism_(false), london_(o.london_) {
+  : schwarz_thresh_(o.schwarz_thresh_), cholesky_thresh_(o.cholesky_thresh_), magnetism_(false), london_(o.london_) {
 
   // Members of Molecule
   spherical_ = o.spherical_;
@@ -179,10 +193,12 @@ Geometry::Geometry(const Geometry& o, shared_ptr<const Matrix> displ, shared_ptr
 
   // first construct atoms using displacements
   int iat = 0;
-  for (auto i = o.atoms_.begin(), j = o.aux_atoms_.begin(); i != o.atoms_.end(); ++i, ++j, ++iat) {
+  // aux_atoms_ is empty when the ERIs are Cholesky decomposed
+  for (auto i = o.atoms_.begin(); i != o.atoms_.end(); ++i, ++iat) {
     array<double,3> cdispl = {{displ->element(0,iat), displ->element(1,iat), displ->element(2,iat)}};
     atoms_.push_back(make_shared<Atom>(**i, cdispl));
-    aux_atoms_.push_back(make_shared<Atom>(**j, cdispl));
+    if (!o.aux_atoms_.empty())
+      aux_atoms_.push_back(make_shared<Atom>(*o.aux_atoms_[iat], cdispl));
   }
 
   // second find the unique frame.
@@ -206,14 +222,16 @@ Geometry::Geometry(const Geometry& o, shared_ptr<const Matrix> displ, shared_ptr
     // first subtract mc, rotate, and then add oc
     vector<shared_ptr<const Atom>> newatoms;
     vector<shared_ptr<const Atom>> newauxatoms;
-    for (auto i = atoms_.begin(), j = aux_atoms_.begin(); i != atoms_.end(); ++i, ++j) {
-      assert((*i)->position() == (*j)->position());
-      Quatern<double> source = (*i)->position();
+    for (size_t i = 0; i != atoms_.size(); ++i) {
+      Quatern<double> source = atoms_[i]->position();
       Quatern<double> target = op * (source - mc) * opd + oc;
       array<double,3> cdispl = (target - source).ijk();
 
-      newatoms.push_back(make_shared<Atom>(**i, cdispl));
-      newauxatoms.push_back(make_shared<Atom>(**j, cdispl));
+      newatoms.push_back(make_shared<Atom>(*atoms_[i], cdispl));
+      if (!aux_atoms_.empty()) {
+        assert(atoms_[i]->position() == aux_atoms_[i]->position());
+        newauxatoms.push_back(make_shared<Atom>(*aux_atoms_[i], cdispl));
+      }
     }
     atoms_ = newatoms;
     aux_atoms_ = newauxatoms;
@@ -239,14 +257,16 @@ Geometry::Geometry(const Geometry& o, shared_ptr<const Matrix> displ, shared_ptr
 
       newatoms.clear();
       newauxatoms.clear();
-      for (auto i = atoms_.begin(), j = aux_atoms_.begin(); i != atoms_.end(); ++i, ++j) {
-        assert((*i)->position() == (*j)->position());
-        Quatern<double> source = (*i)->position();
+      for (size_t i = 0; i != atoms_.size(); ++i) {
+        Quatern<double> source = atoms_[i]->position();
         Quatern<double> target = op * (source - mc) * opd + oc;
         array<double,3> cdispl = (target - source).ijk();
 
-        newatoms.push_back(make_shared<Atom>(**i, cdispl));
-        newauxatoms.push_back(make_shared<Atom>(**j, cdispl));
+        newatoms.push_back(make_shared<Atom>(*atoms_[i], cdispl));
+        if (!aux_atoms_.empty()) {
+          assert(atoms_[i]->position() == aux_atoms_[i]->position());
+          newauxatoms.push_back(make_shared<Atom>(*aux_atoms_[i], cdispl));
+        }
       }
       atoms_ = newatoms;
       aux_atoms_ = newauxatoms;
@@ -263,7 +283,7 @@ Geometry::Geometry(const Geometry& o, shared_ptr<const Matrix> displ, shared_ptr
 
 
 Geometry::Geometry(const Geometry& o, const array<double,3> displ)
-  : schwarz_thresh_(o.schwarz_thresh_), overlap_thresh_(o.overlap_thresh_), magnetism_(false), london_(o.london_) {
+  : schwarz_thresh_(o.schwarz_thresh_), overlap_thresh_(o.overlap_thresh_), cholesky_thresh_(o.cholesky_thresh_), magnetism_(false), london_(o.london_) {
 
   // members of Molecule
   spherical_ = o.spherical_;
@@ -293,7 +313,7 @@ Geometry::Geometry(const Geometry& o, const array<double,3> displ)
 
 // used when a new Geometry block is provided in input
 Geometry::Geometry(const Geometry& o, shared_ptr<const PTree> geominfo, const bool discard)
-  : schwarz_thresh_(o.schwarz_thresh_), overlap_thresh_(o.overlap_thresh_), magnetism_(false), london_(o.london_) {
+  : schwarz_thresh_(o.schwarz_thresh_), overlap_thresh_(o.overlap_thresh_), cholesky_thresh_(o.cholesky_thresh_), magnetism_(false), london_(o.london_) {
 
   // members of Molecule
   spherical_ = o.spherical_;
@@ -310,6 +330,10 @@ Geometry::Geometry(const Geometry& o, shared_ptr<const PTree> geominfo, const bo
   // check all the options
   schwarz_thresh_ = geominfo->get<double>("schwarz_thresh", schwarz_thresh_);
   overlap_thresh_ = geominfo->get<double>("thresh_overlap", overlap_thresh_);
+  if (geominfo->get<bool>("cholesky", cholesky()))
+    cholesky_thresh_ = geominfo->get<double>("cholesky_thresh", cholesky() ? cholesky_thresh_ : 1.0e-6);
+  else
+    cholesky_thresh_ = 0.0;
   symmetry_ = to_lower(geominfo->get<string>("symmetry", symmetry_));
 
   spherical_ = !geominfo->get<bool>("cartesian", !spherical_);
@@ -365,7 +389,7 @@ Geometry::Geometry(const Geometry& o, shared_ptr<const PTree> geominfo, const bo
 
   common_init1();
 
-  if (o.basisfile_ != basisfile_ || o.auxfile_ != auxfile_ || atoms || newfield) {
+  if (o.basisfile_ != basisfile_ || o.auxfile_ != auxfile_ || o.cholesky_thresh_ != cholesky_thresh_ || atoms || newfield) {
     // discard the previous one before we compute the new one. Note that df_'s are mutable... too bad, I know..
     if (discard)
       o.discard_df();
@@ -385,7 +409,8 @@ Geometry::Geometry(const Geometry& o, shared_ptr<const PTree> geominfo, const bo
 *  supergeometry                                            *
 ************************************************************/
 Geometry::Geometry(vector<shared_ptr<const Geometry>> nmer) :
-  schwarz_thresh_(nmer.front()->schwarz_thresh_), overlap_thresh_(nmer.front()->overlap_thresh_), magnetism_(false), london_(nmer.front()->london_) {
+  schwarz_thresh_(nmer.front()->schwarz_thresh_), overlap_thresh_(nmer.front()->overlap_thresh_), cholesky_thresh_(nmer.front()->cholesky_thresh_),
+  magnetism_(false), london_(nmer.front()->london_) {
 
   // A member of Molecule
   spherical_ = nmer.front()->spherical_;
@@ -548,18 +573,27 @@ vector<double> Geometry::schwarz() const {
       shared_ptr<const Shell> b1 = basis[i1];
 
       array<shared_ptr<const Shell>,4> input = {{b1, b0, b1, b0}};
+      double cmax = 0.0;
+      if (magnetism_) {
+        // London orbitals: the bound is given by the moduli of the complex integrals
+        ComplexERIBatch eribatch(input, 1.0);
+        eribatch.compute();
+        const complex<double>* eridata = eribatch.data();
+        for (int xi = 0; xi != eribatch.data_size(); ++xi, ++eridata)
+          cmax = max(cmax, abs(*eridata));
+      } else {
 #ifdef LIBINT_INTERFACE
-      Libint eribatch(input);
+        Libint eribatch(input);
 #else
-      ERIBatch eribatch(input, 1.0);
+        ERIBatch eribatch(input, 1.0);
 #endif
-      eribatch.compute();
-      const double* eridata = eribatch.data();
-      const int datasize = eribatch.data_size();
-      double cmax = 0.0;
-      for (int xi = 0; xi != datasize; ++xi, ++eridata) {
-        const double absed = fabs(*eridata);
-        if (absed > cmax) cmax = absed;
+        eribatch.compute();
+        const double* eridata = eribatch.data();
+        const int datasize = eribatch.data_size();
+        for (int xi = 0; xi != datasize; ++xi, ++eridata) {
+          const double absed = fabs(*eridata);
+          if (absed > cmax) cmax = absed;
+        }
       }
       schwarz[i0 * size + i1] = cmax;
       schwarz[i1 * size + i0] = cmax;
@@ -609,21 +643,29 @@ void Geometry::compute_relativistic_integrals(const bool do_gaunt) {
   df_->average_3index();
   shared_ptr<Matrix> d2 = df_->data2()->copy();
 
-  if (!magnetism_) {
+  if (!magnetism_)
     dfs_  = form_fit<DFDist_ints<SmallERIBatch>>(overlap_thresh_, true, 0.0, true, d2);
-    if (do_gaunt)
-      dfsl_ = form_fit<DFDist_ints<MixedERIBatch>>(overlap_thresh_, true, 0.0, true, d2);
-  } else {
+  else
     dfs_  = form_fit<ComplexDFDist_ints<ComplexSmallERIBatch>>(overlap_thresh_, true, 0.0, true, d2);
-    if (do_gaunt)
-      dfsl_ = form_fit<ComplexDFDist_ints<ComplexMixedERIBatch>>(overlap_thresh_, true, 0.0, true, d2);
-  }
+
+  if (do_gaunt)
+    compute_gaunt_integrals();
 
   // suppress some of the printing
   resources__->proc()->set_print_level(2);
 }
 
 
+void Geometry::compute_gaunt_integrals() const {
+  if (dfsl_) return;
+  shared_ptr<Matrix> d2 = df_->data2()->copy();
+  if (!magnetism_)
+    dfsl_ = form_fit<DFDist_ints<MixedERIBatch>>(overlap_thresh_, true, 0.0, true, d2);
+  else
+    dfsl_ = form_fit<ComplexDFDist_ints<ComplexMixedERIBatch>>(overlap_thresh_, true, 0.0, true, d2);
+}
+
+
 void Geometry::discard_relativistic() const {
   dfs_.reset();
   dfsl_.reset();
@@ -640,6 +682,10 @@ void Geometry::set_london(shared_ptr<const PTree>& geominfo) {
 
 
 void Geometry::compute_integrals(const double thresh) const {
+  if (cholesky() && !magnetism_) {
+    df_ = CholeskyERI(atoms_, cholesky_thresh_).df();
+    return;
+  }
 #ifdef LIBINT_INTERFACE
   if (!magnetism_)
     df_ = form_fit<DFDist_ints<Libint>>(thresh, true); // true means we construct J^-1/2
@@ -38,6 +38,8 @@ class Geometry : public Molecule {
     // integral screening
     double schwarz_thresh_;
     double overlap_thresh_;
+    // threshold for the Cholesky decomposition of ERIs that replaces density fitting (0.0 when not used)
+    double cholesky_thresh_ = 0.0;
 
     // for DF calculations
     mutable std::shared_ptr<DFDist> df_;
@@ -63,7 +65,7 @@ class Geometry : public Molecule {
 
     template<class Archive>
     void save(Archive& ar, const unsigned int) const {
-      ar << boost::serialization::base_object<Molecule>(*this) << schwarz_thresh_ << overlap_thresh_ << magnetism_ << london_;
+      ar << boost::serialization::base_object<Molecule>(*this) << schwarz_thresh_ << overlap_thresh_ << cholesky_thresh_ << magnetism_ << london_;
       const size_t dfindex = !df_ ? 0 : std::hash<DFDist*>()(df_.get());
       ar << dfindex;
       const bool do_rel   = !!dfs_;
@@ -72,8 +74,12 @@ class Geometry : public Molecule {
     }
 
     template<class Archive>
-    void load(Archive& ar, const unsigned int) {
-      ar >> boost::serialization::base_object<Molecule>(*this) >> schwarz_thresh_ >> overlap_thresh_ >> magnetism_ >> london_;
+    void load(Archive& ar, const unsigned int version) {
+      ar >> boost::serialization::base_object<Molecule>(*this) >> schwarz_thresh_ >> overlap_thresh_;
+      // archives written before the Cholesky backend (version 0) do not have cholesky_thresh_
+      if (version >= 1)
+        ar >> cholesky_thresh_;
+      ar >> magnetism_ >> london_;
       size_t dfindex;
       ar >> dfindex;
       static std::map<size_t, std::weak_ptr<DFDist>> dfmap;
@@ -108,6 +114,8 @@ class Geometry : public Molecule {
     std::shared_ptr<const Matrix> compute_grad_vnuc() const;
     double schwarz_thresh() const { return schwarz_thresh_; }
     double overlap_thresh() const { return overlap_thresh_; }
+    double cholesky_thresh() const { return cholesky_thresh_; }
+    bool cholesky() const { return cholesky_thresh_ > 0.0; }
     bool london() const { return london_; }
     bool magnetism() const { return magnetism_; }
 
@@ -131,6 +139,8 @@ class Geometry : public Molecule {
     // initialize relativistic components
     std::shared_ptr<const Geometry> relativistic(const bool do_gaunt, const bool do_coulomb = true) const;
     void compute_relativistic_integrals(const bool do_gaunt);
+    // Gaunt (and Breit) 3-index integrals, if they have not been computed yet
+    void compute_gaunt_integrals() const;
     void discard_relativistic() const;
 
 };
@@ -138,6 +148,8 @@ class Geometry : public Molecule {
 }
 
 #include <src/util/archive.h>
+#include <boost/serialization/version.hpp>
 BOOST_CLASS_EXPORT_KEY(bagel::Geometry)
+BOOST_CLASS_VERSION(bagel::Geometry, 1)
 
 #endif
@@ -99,21 +99,12 @@ void RDM<1>::transform(const shared_ptr<Matrix>& coeff) {
 
 template<>
 void RDM<2>::transform(const shared_ptr<Matrix>& coeff) {
-  const double* start = coeff->data();
-  const int dim = norb()*norb();
-  unique_ptr<double[]> buf(new double[dim*dim]);
-  // first half transformation
-  dgemm_("N", "N", dim*norb(), norb(), norb(), 1.0, data(), dim*norb(), start, norb(), 0.0, buf.get(), dim*norb());
-  for (int i = 0; i != norb(); ++i)
-    dgemm_("N", "N", dim, norb(), norb(), 1.0, buf.get()+i*dim*norb(), dim, start, norb(), 0.0, data()+i*dim*norb(), dim);
-  // then tranpose
-  blas::transpose(data(), dim, dim, buf.get());
-  // and do it again
-  dgemm_("N", "N", dim*norb(), norb(), norb(), 1.0, buf.get(), dim*norb(), start, norb(), 0.0, data(), dim*norb());
-  for (int i = 0; i != norb(); ++i)
-    dgemm_("N", "N", dim, norb(), norb(), 1.0, data()+i*dim*norb(), dim, start, norb(), 0.0, buf.get()+i*dim*norb(), dim);
-  // to make sure for non-symmetric density matrices (and anyway this should be cheap).
-  blas::transpose(buf.get(), dim, dim, data());
+  // one index at a time; none of these requires a reordering copy
+  auto buf = clone();
+  btas::contract(1.0, *this, {0,1,2,3}, *coeff, {3,4}, 0.0, *buf, {0,1,2,4});
+  btas::contract(1.0, *buf, {0,1,2,3}, *coeff, {2,4}, 0.0, *this, {0,1,4,3});
+  btas::contract(1.0, *this, {0,1,2,3}, *coeff, {1,4}, 0.0, *buf, {0,4,2,3});
+  btas::contract(1.0, *coeff, {0,4}, *buf, {0,1,2,3}, 0.0, *this, {4,1,2,3});
 }
 
 